@@ -51,24 +51,85 @@ WriteLockGuard BestPractices::WriteLock() {
     }
 }
 
+void BestPractices::PostCreateDevice(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) {
+    StateTracker::PostCreateDevice(pCreateInfo, loc);
+
+    if (global_settings.best_practices_report_interval != 0) {
+        report_aggregator_ = std::make_unique<PerformanceReportAggregator>(global_settings.best_practices_report_interval);
+    }
+    if (global_settings.best_practices_gpu_timing) {
+        gpu_timing_profiler_ = std::make_unique<GpuTimingProfiler>(phys_dev_props.limits.timestampPeriod);
+    }
+}
+
+void BestPractices::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
+                                               const RecordObject& record_obj) {
+    // What was counted since the last report would be lost otherwise
+    ReportAggregatedWarnings();
+    // Destroys the command buffers that are left, which resolves their timestamps
+    StateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
+
+    if (gpu_timing_profiler_) {
+        const std::string report = gpu_timing_profiler_->BuildReport(*debug_report);
+        if (!report.empty()) {
+            ValidationObject::LogPerformanceWarning("BestPractices-GpuTiming-HotSpots", device, record_obj.location, "%s",
+                                                    report.c_str());
+        }
+    }
+}
+
+bool BestPractices::LogPerformanceWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc,
+                                          const char* format, ...) const {
+    va_list argptr;
+    va_start(argptr, format);
+    if (gpu_timing_profiler_) {
+        AddGpuTimingFinding(vuid_text, objlist, loc);
+    }
+    bool result = false;
+    if (!report_aggregator_ || !report_aggregator_->Count(*debug_report, vuid_text, objlist, loc, format, argptr)) {
+        result = debug_report->LogMsg(kPerformanceWarningBit, objlist, loc, vuid_text, format, argptr);
+    }
+    va_end(argptr);
+    return result;
+}
+
+void BestPractices::ReportAggregatedWarnings() const {
+    if (!report_aggregator_) {
+        return;
+    }
+    report_aggregator_->Report([this](const PerformanceReportAggregator::Sample& sample, uint64_t count) {
+        ValidationObject::LogPerformanceWarning(sample.vuid, sample.objects, sample.location.Get(),
+                                                "%s (Reported %" PRIu64 " times since the last report)", sample.message.c_str(),
+                                                count);
+    });
+}
+
 std::shared_ptr<vvl::CommandBuffer> BestPractices::CreateCmdBufferState(VkCommandBuffer handle,
                                                                         const VkCommandBufferAllocateInfo* allocate_info,
                                                                         const vvl::CommandPool* pool) {
-    return std::static_pointer_cast<vvl::CommandBuffer>(
-        std::make_shared<bp_state::CommandBuffer>(*this, handle, allocate_info, pool));
+    auto cb_state = std::make_shared<bp_state::CommandBuffer>(*this, handle, allocate_info, pool);
+    // Timestamps can't be written in protected command buffers, and only the primary ones are timed
+    if (gpu_timing_profiler_ && cb_state->IsPrimary() && pool->unprotected &&
+        physical_device_state->queue_family_properties[pool->queueFamilyIndex].timestampValidBits != 0) {
+        cb_state->gpu_timing = std::make_unique<bp_state::CommandBufferGpuTiming>();
+    }
+    return std::static_pointer_cast<vvl::CommandBuffer>(std::move(cb_state));
 }
 
 bp_state::CommandBuffer::CommandBuffer(BestPractices& bp, VkCommandBuffer handle, const VkCommandBufferAllocateInfo* allocate_info,
                                        const vvl::CommandPool* pool)
-    : vvl::CommandBuffer(bp, handle, allocate_info, pool) {}
+    : vvl::CommandBuffer(bp, handle, allocate_info, pool) {
+    if (bp.VendorCheckEnabled(kBPVendorNVIDIA)) {
+        nv = std::make_unique<CommandBufferStateNV>();
+    }
+}
 
+// Called for nearly every recorded command, so test the enables directly instead of walking GetVendorInfo()
 bool BestPractices::VendorCheckEnabled(BPVendorFlags vendors) const {
-    for (const auto& vendor : GetVendorInfo()) {
-        if (vendors & vendor.first && enabled[vendor.second.vendor_id]) {
-            return true;
-        }
-    }
-    return false;
+    return ((vendors & kBPVendorArm) && enabled[vendor_specific_arm]) ||
+           ((vendors & kBPVendorAMD) && enabled[vendor_specific_amd]) ||
+           ((vendors & kBPVendorIMG) && enabled[vendor_specific_img]) ||
+           ((vendors & kBPVendorNVIDIA) && enabled[vendor_specific_nvidia]);
 }
 
 const char* BestPractices::VendorSpecificTag(BPVendorFlags vendors) const {
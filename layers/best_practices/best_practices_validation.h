@@ -22,6 +22,7 @@
 #include "generated/chassis.h"
 #include "state_tracker/state_tracker.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "best_practices/bp_report_aggregator.h"
 #include <string>
 #include <deque>
 #include <chrono>
@@ -184,7 +185,7 @@ VALSTATETRACK_DERIVED_STATE_OBJECT(VkImage, bp_state::Image, vvl::Image)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkDescriptorPool, bp_state::DescriptorPool, vvl::DescriptorPool)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkPipeline, bp_state::Pipeline, vvl::Pipeline)
 
-class BestPractices : public ValidationStateTracker {
+class BestPractices final : public ValidationStateTracker {
   public:
     using StateTracker = ValidationStateTracker;
     using Func = vvl::Func;
@@ -198,6 +199,43 @@ class BestPractices : public ValidationStateTracker {
 
     std::string GetAPIVersionName(uint32_t version) const;
 
+    // With best_practices_report_interval set, the warnings are counted and reported once every few frames instead
+    bool DECORATE_PRINTF(5, 6) LogPerformanceWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc,
+                                                     const char* format, ...) const;
+    void ReportAggregatedWarnings() const;
+
+    // best_practices_gpu_timing, reads back the timestamps of the last recording of the command buffer that was submitted
+    void ResolveGpuTiming(bp_state::CommandBuffer& cb_state);
+    void BeginGpuTimedRange(bp_state::CommandBuffer& cb_state, vvl::Func command, const VulkanTypedHandle& object);
+    void EndGpuTimedRange(bp_state::CommandBuffer& cb_state);
+    void AddGpuTimingFinding(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc) const;
+
+    void PreCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                                         VkSubpassContents contents, const RecordObject& record_obj) override;
+    void PreCallRecordCmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                                          const VkSubpassBeginInfo* pSubpassBeginInfo, const RecordObject& record_obj) override;
+    void PreCallRecordCmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                                             const VkSubpassBeginInfo* pSubpassBeginInfo, const RecordObject& record_obj) override;
+    void PreCallRecordCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo,
+                                        const RecordObject& record_obj) override;
+    void PreCallRecordCmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo,
+                                           const RecordObject& record_obj) override;
+    void PostCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
+    void PostCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo,
+                                         const RecordObject& record_obj) override;
+    void PostCallRecordCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo,
+                                            const RecordObject& record_obj) override;
+    void PostCallRecordCmdEndRendering(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
+    void PostCallRecordCmdEndRenderingKHR(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
+    void PreCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ,
+                                  const RecordObject& record_obj) override;
+    void PreCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                          const RecordObject& record_obj) override;
+
+    void PostCreateDevice(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) override;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
+                                    const RecordObject& record_obj) override;
+
     void LogPositiveSuccessCode(const RecordObject& record_obj) const;
     void LogErrorCode(const RecordObject& record_obj) const;
 
@@ -960,4 +998,9 @@ class BestPractices : public ValidationStateTracker {
 
     vvl::unordered_set<VkPipeline> pipelines_used_in_frame_;
     mutable std::shared_mutex pipeline_lock_;
+
+    // Only created when best_practices_report_interval is set
+    std::unique_ptr<PerformanceReportAggregator> report_aggregator_;
+    // Only created when best_practices_gpu_timing is set
+    std::unique_ptr<GpuTimingProfiler> gpu_timing_profiler_;
 };
@@ -167,7 +167,7 @@ void BestPractices::PostCallRecordCmdSetDepthCompareOp(VkCommandBuffer commandBu
     auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
 
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
-        RecordSetDepthTestState(*cb_state, depthCompareOp, cb_state->nv.depth_test_enable);
+        RecordSetDepthTestState(*cb_state, depthCompareOp, cb_state->nv->depth_test_enable);
     }
 }
 
@@ -183,7 +183,7 @@ void BestPractices::PostCallRecordCmdSetDepthTestEnable(VkCommandBuffer commandB
     auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
 
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
-        RecordSetDepthTestState(*cb_state, cb_state->nv.depth_compare_op, depthTestEnable != VK_FALSE);
+        RecordSetDepthTestState(*cb_state, cb_state->nv->depth_compare_op, depthTestEnable != VK_FALSE);
     }
 }
 
@@ -56,23 +56,23 @@ void BestPractices::RecordSetDepthTestState(bp_state::CommandBuffer& cmd_state,
                                             bool new_depth_test_enable) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
-    if (cmd_state.nv.depth_compare_op != new_depth_compare_op) {
+    if (cmd_state.nv->depth_compare_op != new_depth_compare_op) {
         switch (new_depth_compare_op) {
             case VK_COMPARE_OP_LESS:
             case VK_COMPARE_OP_LESS_OR_EQUAL:
-                cmd_state.nv.zcull_direction = ZcullDirection::Less;
+                cmd_state.nv->zcull_direction = ZcullDirection::Less;
                 break;
             case VK_COMPARE_OP_GREATER:
             case VK_COMPARE_OP_GREATER_OR_EQUAL:
-                cmd_state.nv.zcull_direction = ZcullDirection::Greater;
+                cmd_state.nv->zcull_direction = ZcullDirection::Greater;
                 break;
             default:
                 // The other ops carry over the previous state.
                 break;
         }
     }
-    cmd_state.nv.depth_compare_op = new_depth_compare_op;
-    cmd_state.nv.depth_test_enable = new_depth_test_enable;
+    cmd_state.nv->depth_compare_op = new_depth_compare_op;
+    cmd_state.nv->depth_test_enable = new_depth_test_enable;
 }
 
 void BestPractices::RecordBindZcullScope(bp_state::CommandBuffer& cmd_state, VkImage depth_attachment,
@@ -80,7 +80,7 @@ void BestPractices::RecordBindZcullScope(bp_state::CommandBuffer& cmd_state, VkI
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
     if (depth_attachment == VK_NULL_HANDLE) {
-        cmd_state.nv.zcull_scope = {};
+        cmd_state.nv->zcull_scope = {};
         return;
     }
 
@@ -92,16 +92,16 @@ void BestPractices::RecordBindZcullScope(bp_state::CommandBuffer& cmd_state, VkI
     const uint32_t mip_levels = image_state->create_info.mipLevels;
     const uint32_t array_layers = image_state->create_info.arrayLayers;
 
-    auto& tree = cmd_state.nv.zcull_per_image[depth_attachment];
+    auto& tree = cmd_state.nv->zcull_per_image[depth_attachment];
     if (tree.states.empty()) {
         tree.mip_levels = mip_levels;
         tree.array_layers = array_layers;
         tree.states.resize(array_layers * mip_levels);
     }
 
-    cmd_state.nv.zcull_scope.image = depth_attachment;
-    cmd_state.nv.zcull_scope.range = subresource_range;
-    cmd_state.nv.zcull_scope.tree = &tree;
+    cmd_state.nv->zcull_scope.image = depth_attachment;
+    cmd_state.nv->zcull_scope.range = subresource_range;
+    cmd_state.nv->zcull_scope.tree = &tree;
 }
 
 void BestPractices::RecordUnbindZcullScope(bp_state::CommandBuffer& cmd_state) {
@@ -113,7 +113,7 @@ void BestPractices::RecordUnbindZcullScope(bp_state::CommandBuffer& cmd_state) {
 void BestPractices::RecordResetScopeZcullDirection(bp_state::CommandBuffer& cmd_state) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
-    auto& scope = cmd_state.nv.zcull_scope;
+    auto& scope = cmd_state.nv->zcull_scope;
     RecordResetZcullDirection(cmd_state, scope.image, scope.range);
 }
 
@@ -139,8 +139,8 @@ void BestPractices::RecordResetZcullDirection(bp_state::CommandBuffer& cmd_state
 
     RecordSetZcullDirection(cmd_state, depth_image, subresource_range, ZcullDirection::Unknown);
 
-    const auto image_it = cmd_state.nv.zcull_per_image.find(depth_image);
-    if (image_it == cmd_state.nv.zcull_per_image.end()) {
+    const auto image_it = cmd_state.nv->zcull_per_image.find(depth_image);
+    if (image_it == cmd_state.nv->zcull_per_image.end()) {
         return;
     }
     auto& tree = image_it->second;
@@ -158,7 +158,7 @@ void BestPractices::RecordResetZcullDirection(bp_state::CommandBuffer& cmd_state
 void BestPractices::RecordSetScopeZcullDirection(bp_state::CommandBuffer& cmd_state, ZcullDirection mode) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
-    auto& scope = cmd_state.nv.zcull_scope;
+    auto& scope = cmd_state.nv->zcull_scope;
     RecordSetZcullDirection(cmd_state, scope.image, scope.range, mode);
 }
 
@@ -166,8 +166,8 @@ void BestPractices::RecordSetZcullDirection(bp_state::CommandBuffer& cmd_state,
                                             const VkImageSubresourceRange& subresource_range, ZcullDirection mode) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
-    const auto image_it = cmd_state.nv.zcull_per_image.find(depth_image);
-    if (image_it == cmd_state.nv.zcull_per_image.end()) {
+    const auto image_it = cmd_state.nv->zcull_per_image.find(depth_image);
+    if (image_it == cmd_state.nv->zcull_per_image.end()) {
         return;
     }
     auto& tree = image_it->second;
@@ -176,7 +176,7 @@ void BestPractices::RecordSetZcullDirection(bp_state::CommandBuffer& cmd_state,
     ASSERT_AND_RETURN(image);
 
     ForEachSubresource(*image, subresource_range, [&tree, &cmd_state](uint32_t layer, uint32_t level) {
-        tree.GetState(layer, level).direction = cmd_state.nv.zcull_direction;
+        tree.GetState(layer, level).direction = cmd_state.nv->zcull_direction;
     });
 }
 
@@ -184,7 +184,7 @@ void BestPractices::RecordZcullDraw(bp_state::CommandBuffer& cmd_state) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
     // Add one draw to each subresource depending on the current Z-cull direction
-    auto& scope = cmd_state.nv.zcull_scope;
+    auto& scope = cmd_state.nv->zcull_scope;
 
     auto image = Get<vvl::Image>(scope.image);
     if (!image) return;
@@ -212,8 +212,8 @@ bool BestPractices::ValidateZcullScope(const bp_state::CommandBuffer& cmd_state,
 
     bool skip = false;
 
-    if (cmd_state.nv.depth_test_enable) {
-        auto& scope = cmd_state.nv.zcull_scope;
+    if (cmd_state.nv->depth_test_enable) {
+        auto& scope = cmd_state.nv->zcull_scope;
         skip |= ValidateZcull(cmd_state, scope.image, scope.range, loc);
     }
 
@@ -228,8 +228,8 @@ bool BestPractices::ValidateZcull(const bp_state::CommandBuffer& cmd_state, VkIm
     const char* bad_mode = nullptr;
     bool is_balanced = false;
 
-    const auto image_it = cmd_state.nv.zcull_per_image.find(image);
-    if (image_it == cmd_state.nv.zcull_per_image.end()) {
+    const auto image_it = cmd_state.nv->zcull_per_image.find(image);
+    if (image_it == cmd_state.nv->zcull_per_image.end()) {
         return skip;
     }
     const auto& tree = image_it->second;
@@ -270,7 +270,7 @@ bool BestPractices::ValidateZcull(const bp_state::CommandBuffer& cmd_state, VkIm
             "Z-cull is disabled for the least used direction, which harms depth testing performance. "
             "The Z-cull direction can be reset by clearing the depth attachment, transitioning from VK_IMAGE_LAYOUT_UNDEFINED, "
             "using VK_ATTACHMENT_LOAD_OP_DONT_CARE, or using VK_ATTACHMENT_STORE_OP_DONT_CARE.",
-            VendorSpecificTag(kBPVendorNVIDIA), FormatHandle(cmd_state.nv.zcull_scope.image).c_str(), good_mode, bad_mode);
+            VendorSpecificTag(kBPVendorNVIDIA), FormatHandle(cmd_state.nv->zcull_scope.image).c_str(), good_mode, bad_mode);
     }
 
     return skip;
@@ -143,12 +143,18 @@ bool BestPractices::PreCallValidateFreeMemory(VkDevice device, VkDeviceMemory me
     auto mem_info = Get<vvl::DeviceMemory>(memory);
     ASSERT_AND_RETURN_SKIP(mem_info);
 
-    for (const auto& item : mem_info->ObjectBindings()) {
-        const auto& obj = item.first;
+    auto log_reference = [this, device, &mem_info, &error_obj, &skip](const VulkanTypedHandle& obj) {
         const LogObjectList objlist(device, obj, mem_info->Handle());
         skip |= LogWarning(layer_name.c_str(), objlist, error_obj.location, "VK Object %s still has a reference to mem obj %s.",
                            FormatHandle(obj).c_str(), FormatHandle(mem_info->Handle()).c_str());
+    };
+    for (const auto& item : mem_info->ObjectBindings()) {
+        log_reference(item.first);
     }
+    mem_info->AnyBoundResource(0, std::numeric_limits<VkDeviceSize>::max(), [&log_reference](const vvl::StateObject& obj) {
+        log_reference(obj.Handle());
+        return false;
+    });
 
     return skip;
 }
@@ -48,8 +48,6 @@ bool BestPractices::ValidateCmdDrawType(VkCommandBuffer cmd_buffer, const Locati
 }
 
 bool BestPractices::ValidatePushConstants(VkCommandBuffer cmd_buffer, const Location& loc) const {
-    using Range = sparse_container::range<uint32_t>;
-
     bool skip = false;
 
     const auto cb_state = GetRead<bp_state::CommandBuffer>(cmd_buffer);
@@ -59,18 +57,7 @@ bool BestPractices::ValidatePushConstants(VkCommandBuffer cmd_buffer, const Loca
     }
 
     for (const VkPushConstantRange& push_constant_range : *cb_state->push_constant_ranges_layout) {
-        Range layout_range(push_constant_range.offset, push_constant_range.offset + push_constant_range.size);
-        uint32_t size_not_set = push_constant_range.size;
-        for (const vvl::CommandBuffer::PushConstantData& filled_pcr : cb_state->push_constant_data_chunks) {
-            Range filled_range(filled_pcr.offset, filled_pcr.offset + static_cast<uint32_t>(filled_pcr.values.size()));
-            Range intersection = layout_range & filled_range;
-            if (intersection.valid()) {
-                size_not_set -= std::min(intersection.distance(), size_not_set);
-            }
-            if (size_not_set == 0) {
-                break;
-            }
-        }
+        const uint32_t size_not_set = cb_state->PushConstantBytesNotSet(push_constant_range.offset, push_constant_range.size);
         if (size_not_set > 0) {
             skip |= LogWarning("BestPractices-PushConstants", cmd_buffer, loc,
                                "Pipeline uses a push constant range with offset %" PRIu32 " and size %" PRIu32 ", but %" PRIu32
@@ -124,8 +111,8 @@ void BestPractices::RecordCmdDrawTypeArm(bp_state::CommandBuffer& cb_state, uint
 void BestPractices::RecordCmdDrawTypeNVIDIA(bp_state::CommandBuffer& cmd_state) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
-    if (cmd_state.nv.depth_test_enable && cmd_state.nv.zcull_direction != ZcullDirection::Unknown) {
-        RecordSetScopeZcullDirection(cmd_state, cmd_state.nv.zcull_direction);
+    if (cmd_state.nv->depth_test_enable && cmd_state.nv->zcull_direction != ZcullDirection::Unknown) {
+        RecordSetScopeZcullDirection(cmd_state, cmd_state.nv->zcull_direction);
         RecordZcullDraw(cmd_state);
     }
 }
@@ -682,12 +669,14 @@ void BestPractices::PostCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uin
                                               const RecordObject& record_obj) {
     const auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
     ValidateBoundDescriptorSets(*cb_state, VK_PIPELINE_BIND_POINT_COMPUTE, record_obj.location.function);
+    EndGpuTimedRange(*cb_state);
 }
 
 void BestPractices::PostCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                       const RecordObject& record_obj) {
     const auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
     ValidateBoundDescriptorSets(*cb_state, VK_PIPELINE_BIND_POINT_COMPUTE, record_obj.location.function);
+    EndGpuTimedRange(*cb_state);
 }
 
 bool BestPractices::PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer, const ErrorObject& error_obj) const {
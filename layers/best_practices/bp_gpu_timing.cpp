@@ -0,0 +1,337 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "best_practices/bp_gpu_timing.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "best_practices/best_practices_validation.h"
+#include "best_practices/bp_state.h"
+#include "generated/layer_chassis_dispatch.h"
+
+static void AddUnique(std::vector<std::string> &vuids, std::string_view vuid) {
+    if (std::find(vuids.begin(), vuids.end(), vuid) == vuids.end()) {
+        vuids.emplace_back(vuid);
+    }
+}
+
+void bp_state::CommandBufferGpuTiming::AddFinding(std::string_view vuid, vvl::Func command) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (range_open) {
+        AddUnique(ranges.back().vuids, vuid);
+        return;
+    }
+    // Only the next range opened by this same command claims the pending findings
+    if (pending_command != command) {
+        pending_command = command;
+        pending_vuids.clear();
+    }
+    AddUnique(pending_vuids, vuid);
+}
+
+void GpuTimingProfiler::Resolve(VkDevice device, bp_state::CommandBufferGpuTiming &timing, uint32_t timestamp_valid_bits) {
+    std::lock_guard<std::mutex> timing_guard(timing.lock);
+    // A range left open has no end timestamp
+    const uint32_t range_count = static_cast<uint32_t>(timing.ranges.size()) - (timing.range_open ? 1 : 0);
+    if (timing.query_pool == VK_NULL_HANDLE || range_count == 0) {
+        return;
+    }
+
+    // Value and availability of each query, the start and end of a range are next to each other
+    std::vector<uint64_t> results(range_count * 4);
+    const VkResult result = DispatchGetQueryPoolResults(device, timing.query_pool, 0, range_count * 2,
+                                                        results.size() * sizeof(uint64_t), results.data(), 2 * sizeof(uint64_t),
+                                                        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+    if (result < VK_SUCCESS) {
+        return;
+    }
+
+    const uint64_t mask = timestamp_valid_bits >= 64 ? ~uint64_t(0) : (uint64_t(1) << timestamp_valid_bits) - 1;
+    std::lock_guard<std::mutex> guard(lock_);
+    for (uint32_t i = 0; i < range_count; ++i) {
+        const uint64_t *range_results = &results[i * 4];
+        if (range_results[1] == 0 || range_results[3] == 0) {
+            continue;
+        }
+        auto &range = timing.ranges[i];
+        const double time_ns = static_cast<double>((range_results[2] - range_results[0]) & mask) * timestamp_period_;
+        total_time_ns_ += time_ns;
+        ++total_range_count_;
+        for (const auto &vuid : range.vuids) {
+            auto &vuid_time = time_per_vuid_[vuid];
+            vuid_time.time_ns += time_ns;
+            ++vuid_time.range_count;
+        }
+
+        if (hot_spots_.size() == kMaxHotSpots && hot_spots_.back().time_ns >= time_ns) {
+            continue;
+        }
+        auto pos = std::find_if(hot_spots_.begin(), hot_spots_.end(),
+                                [time_ns](const HotSpot &hot_spot) { return hot_spot.time_ns < time_ns; });
+        hot_spots_.insert(pos, HotSpot{time_ns, range.command, range.object, range.vuids});
+        if (hot_spots_.size() > kMaxHotSpots) {
+            hot_spots_.pop_back();
+        }
+    }
+}
+
+std::string GpuTimingProfiler::BuildReport(const DebugReport &debug_report) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (total_range_count_ == 0) {
+        return {};
+    }
+
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "Measured " << total_range_count_ << " render passes and dispatches taking " << total_time_ns_ / 1e6
+       << " ms of GPU time.";
+
+    if (!time_per_vuid_.empty()) {
+        std::vector<std::pair<const std::string *, VuidTime>> vuids;
+        vuids.reserve(time_per_vuid_.size());
+        for (const auto &[vuid, vuid_time] : time_per_vuid_) {
+            vuids.emplace_back(&vuid, vuid_time);
+        }
+        std::sort(vuids.begin(), vuids.end(), [](const auto &a, const auto &b) { return a.second.time_ns > b.second.time_ns; });
+        ss << "\nWarnings by GPU time of the commands they were reported on:";
+        for (const auto &[vuid, vuid_time] : vuids) {
+            ss << "\n    " << *vuid << ": " << vuid_time.time_ns / 1e6 << " ms over " << vuid_time.range_count << " commands";
+        }
+    }
+
+    ss << "\nSlowest commands:";
+    for (const auto &hot_spot : hot_spots_) {
+        ss << "\n    " << hot_spot.time_ns / 1e6 << " ms " << vvl::String(hot_spot.command);
+        if (hot_spot.object.type != kVulkanObjectTypeUnknown) {
+            ss << " (" << debug_report.FormatHandle(hot_spot.object) << ")";
+        }
+        for (size_t i = 0; i < hot_spot.vuids.size(); ++i) {
+            ss << (i == 0 ? ": " : ", ") << hot_spot.vuids[i];
+        }
+    }
+    return ss.str();
+}
+
+void BestPractices::ResolveGpuTiming(bp_state::CommandBuffer& cb_state) {
+    auto* timing = cb_state.gpu_timing.get();
+    // Called before the state of the recording is reset, never submitted means the queries were never reset either
+    if (cb_state.submitCount > 0 && gpu_timing_profiler_) {
+        const uint32_t timestamp_valid_bits =
+            physical_device_state->queue_family_properties[cb_state.command_pool->queueFamilyIndex].timestampValidBits;
+        gpu_timing_profiler_->Resolve(device, *timing, timestamp_valid_bits);
+    }
+    std::lock_guard<std::mutex> guard(timing->lock);
+    timing->ranges.clear();
+    timing->range_open = false;
+    timing->pending_command = Func::Empty;
+    timing->pending_vuids.clear();
+}
+
+void bp_state::CommandBuffer::Reset(const Location& loc) {
+    if (gpu_timing) {
+        static_cast<BestPractices&>(dev_data).ResolveGpuTiming(*this);
+    }
+    vvl::CommandBuffer::Reset(loc);
+}
+
+void bp_state::CommandBuffer::Destroy() {
+    if (gpu_timing) {
+        static_cast<BestPractices&>(dev_data).ResolveGpuTiming(*this);
+        if (gpu_timing->query_pool != VK_NULL_HANDLE) {
+            DispatchDestroyQueryPool(dev_data.device, gpu_timing->query_pool, nullptr);
+        }
+        gpu_timing.reset();
+    }
+    vvl::CommandBuffer::Destroy();
+}
+
+void BestPractices::BeginGpuTimedRange(bp_state::CommandBuffer& cb_state, vvl::Func command, const VulkanTypedHandle& object) {
+    auto* timing = cb_state.gpu_timing.get();
+    if (!timing) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(timing->lock);
+    if (timing->range_open || timing->ranges.size() >= bp_state::CommandBufferGpuTiming::kMaxRanges) {
+        return;
+    }
+    if (timing->query_pool == VK_NULL_HANDLE) {
+        VkQueryPoolCreateInfo query_pool_ci = vku::InitStructHelper();
+        query_pool_ci.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        query_pool_ci.queryCount = 2 * bp_state::CommandBufferGpuTiming::kMaxRanges;
+        if (DispatchCreateQueryPool(device, &query_pool_ci, nullptr, &timing->query_pool) != VK_SUCCESS) {
+            timing->query_pool = VK_NULL_HANDLE;
+            return;
+        }
+    }
+
+    // The layer's own queries go straight to the driver, validation never sees them
+    const uint32_t query = 2 * static_cast<uint32_t>(timing->ranges.size());
+    DispatchCmdResetQueryPool(cb_state.VkHandle(), timing->query_pool, query, 2);
+    DispatchCmdWriteTimestamp(cb_state.VkHandle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timing->query_pool, query);
+
+    auto& range = timing->ranges.emplace_back();
+    range.command = command;
+    range.object = object;
+    if (timing->pending_command == command) {
+        range.vuids = std::move(timing->pending_vuids);
+    }
+    timing->pending_command = Func::Empty;
+    timing->pending_vuids.clear();
+    timing->range_open = true;
+}
+
+void BestPractices::EndGpuTimedRange(bp_state::CommandBuffer& cb_state) {
+    auto* timing = cb_state.gpu_timing.get();
+    if (!timing) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(timing->lock);
+    if (!timing->range_open) {
+        return;
+    }
+    const uint32_t query = 2 * static_cast<uint32_t>(timing->ranges.size() - 1) + 1;
+    DispatchCmdWriteTimestamp(cb_state.VkHandle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timing->query_pool, query);
+    timing->range_open = false;
+}
+
+void BestPractices::AddGpuTimingFinding(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc) const {
+    for (const auto& object : objlist) {
+        if (object.type == kVulkanObjectTypeCommandBuffer) {
+            const auto cb_state = Get<bp_state::CommandBuffer>(CastFromUint64<VkCommandBuffer>(object.handle));
+            if (cb_state && cb_state->gpu_timing) {
+                cb_state->gpu_timing->AddFinding(vuid_text, loc.function);
+            }
+            return;
+        }
+    }
+}
+
+void BestPractices::PreCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                                                    VkSubpassContents contents, const RecordObject& record_obj) {
+    StateTracker::PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents, record_obj);
+    if (gpu_timing_profiler_) {
+        auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
+        BeginGpuTimedRange(*cb_state, record_obj.location.function,
+                           VulkanTypedHandle(pRenderPassBegin->renderPass, kVulkanObjectTypeRenderPass));
+    }
+}
+
+void BestPractices::PreCallRecordCmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                                                     const VkSubpassBeginInfo* pSubpassBeginInfo, const RecordObject& record_obj) {
+    StateTracker::PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+    if (gpu_timing_profiler_) {
+        auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
+        BeginGpuTimedRange(*cb_state, record_obj.location.function,
+                           VulkanTypedHandle(pRenderPassBegin->renderPass, kVulkanObjectTypeRenderPass));
+    }
+}
+
+void BestPractices::PreCallRecordCmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer,
+                                                        const VkRenderPassBeginInfo* pRenderPassBegin,
+                                                        const VkSubpassBeginInfo* pSubpassBeginInfo,
+                                                        const RecordObject& record_obj) {
+    StateTracker::PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
+    if (gpu_timing_profiler_) {
+        auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
+        BeginGpuTimedRange(*cb_state, record_obj.location.function,
+                           VulkanTypedHandle(pRenderPassBegin->renderPass, kVulkanObjectTypeRenderPass));
+    }
+}
+
+// A suspended render pass instance can't have the timestamps in between its parts
+static bool IsTimedRendering(const VkRenderingInfo* pRenderingInfo) {
+    return (pRenderingInfo->flags & (VK_RENDERING_SUSPENDING_BIT | VK_RENDERING_RESUMING_BIT)) == 0;
+}
+
+void BestPractices::PreCallRecordCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo,
+                                                   const RecordObject& record_obj) {
+    StateTracker::PreCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo, record_obj);
+    if (gpu_timing_profiler_ && IsTimedRendering(pRenderingInfo)) {
+        auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
+        BeginGpuTimedRange(*cb_state, record_obj.location.function, VulkanTypedHandle());
+    }
+}
+
+void BestPractices::PreCallRecordCmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo,
+                                                      const RecordObject& record_obj) {
+    StateTracker::PreCallRecordCmdBeginRenderingKHR(commandBuffer, pRenderingInfo, record_obj);
+    if (gpu_timing_profiler_ && IsTimedRendering(pRenderingInfo)) {
+        auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
+        BeginGpuTimedRange(*cb_state, record_obj.location.function, VulkanTypedHandle());
+    }
+}
+
+void BestPractices::PostCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer, const RecordObject& record_obj) {
+    StateTracker::PostCallRecordCmdEndRenderPass(commandBuffer, record_obj);
+    if (gpu_timing_profiler_) {
+        EndGpuTimedRange(*GetWrite<bp_state::CommandBuffer>(commandBuffer));
+    }
+}
+
+void BestPractices::PostCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo,
+                                                    const RecordObject& record_obj) {
+    StateTracker::PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo, record_obj);
+    if (gpu_timing_profiler_) {
+        EndGpuTimedRange(*GetWrite<bp_state::CommandBuffer>(commandBuffer));
+    }
+}
+
+void BestPractices::PostCallRecordCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo,
+                                                       const RecordObject& record_obj) {
+    StateTracker::PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo, record_obj);
+    if (gpu_timing_profiler_) {
+        EndGpuTimedRange(*GetWrite<bp_state::CommandBuffer>(commandBuffer));
+    }
+}
+
+void BestPractices::PostCallRecordCmdEndRendering(VkCommandBuffer commandBuffer, const RecordObject& record_obj) {
+    StateTracker::PostCallRecordCmdEndRendering(commandBuffer, record_obj);
+    if (gpu_timing_profiler_) {
+        EndGpuTimedRange(*GetWrite<bp_state::CommandBuffer>(commandBuffer));
+    }
+}
+
+void BestPractices::PostCallRecordCmdEndRenderingKHR(VkCommandBuffer commandBuffer, const RecordObject& record_obj) {
+    StateTracker::PostCallRecordCmdEndRenderingKHR(commandBuffer, record_obj);
+    if (gpu_timing_profiler_) {
+        EndGpuTimedRange(*GetWrite<bp_state::CommandBuffer>(commandBuffer));
+    }
+}
+
+void BestPractices::PreCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                                             uint32_t groupCountZ, const RecordObject& record_obj) {
+    StateTracker::PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
+    if (gpu_timing_profiler_) {
+        auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
+        BeginGpuTimedRange(*cb_state, record_obj.location.function,
+                           vvl::StateObject::Handle(cb_state->GetCurrentPipeline(VK_PIPELINE_BIND_POINT_COMPUTE)));
+    }
+}
+
+void BestPractices::PreCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                     const RecordObject& record_obj) {
+    StateTracker::PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset, record_obj);
+    if (gpu_timing_profiler_) {
+        auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
+        BeginGpuTimedRange(*cb_state, record_obj.location.function,
+                           vvl::StateObject::Handle(cb_state->GetCurrentPipeline(VK_PIPELINE_BIND_POINT_COMPUTE)));
+    }
+}
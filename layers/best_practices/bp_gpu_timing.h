@@ -0,0 +1,93 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "containers/custom_containers.h"
+#include "error_message/logging.h"
+#include "generated/error_location_helper.h"
+
+namespace bp_state {
+
+// The render passes and dispatches of one recording of a primary command buffer, see the best_practices_gpu_timing setting.
+// Each range is surrounded by two timestamps the layer writes into its own query pool, around the commands and outside of any
+// render pass instance. The performance warnings reported on the commands of a range are kept with it.
+struct CommandBufferGpuTiming {
+    struct Range {
+        vvl::Func command;
+        // The render pass or the bound compute pipeline
+        VulkanTypedHandle object;
+        std::vector<std::string> vuids;
+    };
+    // Past this, the rest of the recording is not timed
+    static constexpr uint32_t kMaxRanges = 256;
+
+    void AddFinding(std::string_view vuid, vvl::Func command);
+
+    VkQueryPool query_pool = VK_NULL_HANDLE;
+    std::vector<Range> ranges;
+    bool range_open = false;
+    // The warnings of the command opening a range are validated before the range is recorded
+    vvl::Func pending_command = vvl::Func::Empty;
+    std::vector<std::string> pending_vuids;
+    // Findings can be added from a validation call on another thread (a submit naming the command buffer)
+    std::mutex lock;
+};
+
+}  // namespace bp_state
+
+// Collects the measured ranges of every command buffer of the device and ranks them, and the performance warnings found on
+// them, by GPU time.
+class GpuTimingProfiler {
+  public:
+    explicit GpuTimingProfiler(float timestamp_period) : timestamp_period_(timestamp_period) {}
+
+    // Reads back the timestamps of a recording that is done executing, ranges whose queries are not available are dropped
+    void Resolve(VkDevice device, bp_state::CommandBufferGpuTiming &timing, uint32_t timestamp_valid_bits);
+
+    // Empty if nothing was measured
+    std::string BuildReport(const DebugReport &debug_report) const;
+
+  private:
+    struct HotSpot {
+        double time_ns;
+        vvl::Func command;
+        VulkanTypedHandle object;
+        std::vector<std::string> vuids;
+    };
+    struct VuidTime {
+        double time_ns = 0.0;
+        uint64_t range_count = 0;
+    };
+    static constexpr size_t kMaxHotSpots = 16;
+
+    const float timestamp_period_;
+
+    mutable std::mutex lock_;
+    double total_time_ns_ = 0.0;
+    uint64_t total_range_count_ = 0;
+    // Sorted, slowest first
+    std::vector<HotSpot> hot_spots_;
+    vvl::unordered_map<std::string, VuidTime> time_per_vuid_;
+};
@@ -466,7 +466,7 @@ void BestPractices::PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer,
 
             if (VendorCheckEnabled(kBPVendorNVIDIA)) {
                 using TessGeometryMeshState = bp_state::CommandBufferStateNV::TessGeometryMesh::State;
-                auto& tgm = cb_state->nv.tess_geometry_mesh;
+                auto& tgm = cb_state->nv->tess_geometry_mesh;
 
                 // Make sure the message is only signaled once per command buffer
                 tgm.threshold_signaled = tgm.num_switches >= kNumBindPipelineTessGeometryMeshSwitchesThresholdNVIDIA;
@@ -495,11 +495,11 @@ void BestPractices::PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer,
                         std::find(dynamic_state_begin, dynamic_state_end, VK_DYNAMIC_STATE_DEPTH_COMPARE_OP) != dynamic_state_end;
 
                     if (!dynamic_depth_test_enable) {
-                        RecordSetDepthTestState(*cb_state, cb_state->nv.depth_compare_op,
+                        RecordSetDepthTestState(*cb_state, cb_state->nv->depth_compare_op,
                                                 depth_stencil_state->depthTestEnable != VK_FALSE);
                     }
                     if (!dynamic_depth_func) {
-                        RecordSetDepthTestState(*cb_state, depth_stencil_state->depthCompareOp, cb_state->nv.depth_test_enable);
+                        RecordSetDepthTestState(*cb_state, depth_stencil_state->depthCompareOp, cb_state->nv->depth_test_enable);
                     }
                 }
             }
@@ -639,7 +639,7 @@ bool BestPractices::PreCallValidateCmdBindPipeline(VkCommandBuffer commandBuffer
     }
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
         auto cb_state = Get<bp_state::CommandBuffer>(commandBuffer);
-        const auto& tgm = cb_state->nv.tess_geometry_mesh;
+        const auto& tgm = cb_state->nv->tess_geometry_mesh;
         if (tgm.num_switches >= kNumBindPipelineTessGeometryMeshSwitchesThresholdNVIDIA && !tgm.threshold_signaled) {
             LogPerformanceWarning("BestPractices-NVIDIA-BindPipeline-SwitchTessGeometryMesh", commandBuffer, error_obj.location,
                                   "%s Avoid switching between pipelines with and without tessellation, geometry, task, "
@@ -662,7 +662,9 @@ void BestPractices::PostRecordCmdBeginRenderPass(bp_state::CommandBuffer& cb_sta
     // Don't reset state related to pipeline state.
 
     // Reset NV state
-    cb_state.nv = {};
+    if (cb_state.nv) {
+        *cb_state.nv = {};
+    }
 
     if (auto rp_state = Get<vvl::RenderPass>(pRenderPassBegin->renderPass)) {
         // track depth / color attachment usage within the renderpass
@@ -0,0 +1,93 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "best_practices/bp_report_aggregator.h"
+
+#include <cstdio>
+
+#include "utils/hash_util.h"
+
+static uint64_t MixKey(uint32_t vuid_hash, uint64_t handle) {
+    // splitmix64 finalizer, the keys are used for probing as is
+    uint64_t key = handle ^ (uint64_t(vuid_hash) * 0x9e3779b97f4a7c15ull);
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+    key ^= key >> 31;
+    return key != 0 ? key : 1;
+}
+
+static std::string FormatMessage(const char *format, va_list argptr) {
+    va_list arg_copy;
+    va_copy(arg_copy, argptr);
+    const int length = vsnprintf(nullptr, 0, format, arg_copy);
+    va_end(arg_copy);
+    if (length < 0) {
+        return "Message generation failure";
+    }
+    std::string message(static_cast<size_t>(length) + 1, '\0');
+    vsnprintf(message.data(), message.size(), format, argptr);
+    message.resize(static_cast<size_t>(length));
+    return message;
+}
+
+PerformanceReportAggregator::Slot *PerformanceReportAggregator::ClaimSlot(uint64_t key, bool &claimed) {
+    for (uint32_t probe = 0; probe < kSize; ++probe) {
+        Slot &slot = slots_[(key + probe) & (kSize - 1)];
+        uint64_t slot_key = slot.key.load(std::memory_order_acquire);
+        if (slot_key == 0 && slot.key.compare_exchange_strong(slot_key, key, std::memory_order_acq_rel)) {
+            claimed = true;
+            return &slot;
+        }
+        // Either the slot was taken already or another thread just claimed it, slot_key holds its key in both cases
+        if (slot_key == key) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+bool PerformanceReportAggregator::Count(const DebugReport &debug_report, std::string_view vuid_text,
+                                        const LogObjectList &objlist, const Location &loc, const char *format, va_list argptr) {
+    const uint64_t handle = objlist.empty() ? 0 : objlist.object_list[0].handle;
+    bool claimed = false;
+    Slot *slot = ClaimSlot(MixKey(hash_util::VuidHash(vuid_text), handle), claimed);
+    if (!slot) {
+        return false;
+    }
+    // A muted message never gets a sample, its occurrences are counted but not reported
+    if (claimed && debug_report.IsMessageReportable(kPerformanceWarningBit, vuid_text)) {
+        Sample sample{std::string(vuid_text), objlist, vvl::LocationCapture(loc), FormatMessage(format, argptr)};
+        std::lock_guard<std::mutex> guard(samples_lock_);
+        samples_.emplace_back(slot, std::move(sample));
+    }
+    slot->count.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool PerformanceReportAggregator::EndFrame() {
+    return (frame_count_.fetch_add(1, std::memory_order_relaxed) + 1) % frame_interval_ == 0;
+}
+
+void PerformanceReportAggregator::Report(const ReportFunc &report) {
+    std::lock_guard<std::mutex> guard(samples_lock_);
+    for (const auto &[slot, sample] : samples_) {
+        const uint64_t count = slot->count.exchange(0, std::memory_order_relaxed);
+        if (count != 0) {
+            report(sample, count);
+        }
+    }
+}
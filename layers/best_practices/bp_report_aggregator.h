@@ -0,0 +1,76 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdarg>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "error_message/error_location.h"
+#include "error_message/logging.h"
+
+// Counts the performance warnings of BestPractices per (VUID, first object) during the frame instead of logging each one,
+// see the best_practices_report_interval setting. Counting is lock free, only the first occurrence of a key formats its
+// message. Report() then logs that message once per key, with the number of occurrences since the previous report.
+class PerformanceReportAggregator {
+  public:
+    struct Sample {
+        std::string vuid;
+        LogObjectList objects;
+        vvl::LocationCapture location;
+        std::string message;
+    };
+    using ReportFunc = std::function<void(const Sample &sample, uint64_t count)>;
+
+    explicit PerformanceReportAggregator(uint32_t frame_interval) : frame_interval_(frame_interval) {}
+
+    // Returns false if the warning could not be counted because the table is full, the caller logs it as usual then
+    bool Count(const DebugReport &debug_report, std::string_view vuid_text, const LogObjectList &objlist, const Location &loc,
+               const char *format, va_list argptr);
+
+    // Returns true once every frame_interval frames, when the counted warnings are due to be reported
+    bool EndFrame();
+    // Reports and resets every counted warning
+    void Report(const ReportFunc &report);
+
+  private:
+    static constexpr uint32_t kSize = 1u << 12;
+
+    struct Slot {
+        // Mix of the VUID hash and the object handle, 0 marks an empty slot
+        std::atomic<uint64_t> key{0};
+        std::atomic<uint64_t> count{0};
+    };
+
+    // Returns the slot of key, claiming an empty one if needed (claimed is then set), or nullptr if the table is full
+    Slot *ClaimSlot(uint64_t key, bool &claimed);
+
+    const uint32_t frame_interval_;
+    std::atomic<uint32_t> frame_count_{0};
+
+    std::array<Slot, kSize> slots_;
+
+    // Slots stay claimed across reports, so a sample is only added the first time its key is seen
+    std::mutex samples_lock_;
+    std::vector<std::pair<Slot *, Sample>> samples_;
+};
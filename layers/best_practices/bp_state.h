@@ -25,6 +25,7 @@
 #include "state_tracker/image_state.h"
 #include "state_tracker/device_state.h"
 #include "state_tracker/descriptor_sets.h"
+#include "best_practices/bp_gpu_timing.h"
 
 class BestPractices;
 
@@ -195,8 +196,14 @@ class CommandBuffer : public vvl::CommandBuffer {
     CommandBuffer(BestPractices& bp, VkCommandBuffer handle, const VkCommandBufferAllocateInfo* allocate_info,
                   const vvl::CommandPool* pool);
 
+    void Reset(const Location& loc) override;
+    void Destroy() override;
+
     RenderPassState render_pass_state;
-    CommandBufferStateNV nv;
+    // Only allocated when the NVIDIA checks are enabled, every access is behind VendorCheckEnabled(kBPVendorNVIDIA)
+    std::unique_ptr<CommandBufferStateNV> nv;
+    // Only allocated with best_practices_gpu_timing, for primary command buffers of a queue family with timestamps
+    std::unique_ptr<CommandBufferGpuTiming> gpu_timing;
     uint64_t num_submits = 0;
     bool uses_vertex_buffer = false;
     uint32_t small_indexed_draw_call_count = 0;
@@ -174,6 +174,10 @@ void BestPractices::ManualPostCallRecordQueuePresentKHR(VkQueue queue, const VkP
     num_queue_submissions_ = 0;
     num_barriers_objects_ = 0;
     ClearPipelinesUsedInFrame();
+
+    if (report_aggregator_ && report_aggregator_->EndFrame()) {
+        ReportAggregatedWarnings();
+    }
 }
 
 bool BestPractices::PreCallValidateGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface,
@@ -19,6 +19,7 @@
  */
 
 #pragma once
+#include <optional>
 #include <vector>
 #include "state_tracker/shader_module.h"
 
@@ -43,6 +44,8 @@ struct CreateShaderModule {
     // creation time where the rest of the information is needed to do the remaining SPIR-V validation.
     std::shared_ptr<spirv::Module> module_state;  // contains SPIR-V to validate
     spirv::StatelessData stateless_data;
+    // Hash of pCode, set by the first one needing it so spirv-val's cache and module_state don't hash the code again
+    std::optional<hash_util::Hash128> spirv_hash;
 };
 
 struct ShaderObjectInstrumentationData {
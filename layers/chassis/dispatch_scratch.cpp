@@ -0,0 +1,170 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chassis/dispatch_scratch.h"
+
+#include <algorithm>
+
+namespace vvl {
+namespace dispatch {
+
+MonotonicArena &GetScratchArena() {
+    thread_local MonotonicArena arena(16 * 1024);
+    return arena;
+}
+
+// A scope can be nested if a dispatch call re-enters the layer on the same thread
+static thread_local uint32_t scratch_scope_depth = 0;
+
+ScratchScope::ScratchScope() : arena(GetScratchArena()) { ++scratch_scope_depth; }
+
+ScratchScope::~ScratchScope() {
+    if (--scratch_scope_depth == 0) {
+        arena.Reset();
+    }
+}
+
+// Walks a pNext chain, true if every struct in it is one of the given types
+template <size_t N>
+static bool ChainOnlyHas(const void *pNext, const VkStructureType (&types)[N]) {
+    for (auto *header = static_cast<const VkBaseInStructure *>(pNext); header; header = header->pNext) {
+        if (std::find(std::begin(types), std::end(types), header->sType) == std::end(types)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CanUnwrapInScratch(uint32_t write_count, const VkWriteDescriptorSet *writes) {
+    if (!writes) {
+        return false;
+    }
+    static constexpr VkStructureType kInlineUniformBlockChain[] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK};
+    for (uint32_t i = 0; i < write_count; ++i) {
+        const VkWriteDescriptorSet &write = writes[i];
+        switch (write.descriptorType) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                if (write.pNext) {
+                    return false;
+                }
+                break;
+            case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
+                if (!ChainOnlyHas(write.pNext, kInlineUniformBlockChain)) {
+                    return false;
+                }
+                break;
+            default:
+                // Acceleration structures are written through a pNext struct with handles
+                return false;
+        }
+    }
+    return true;
+}
+
+bool CanUnwrapInScratch(uint32_t submit_count, const VkSubmitInfo *submits) {
+    if (!submits) {
+        return false;
+    }
+    static constexpr VkStructureType kHandleFreeChain[] = {
+        VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO, VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO,
+        VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO, VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR};
+    for (uint32_t i = 0; i < submit_count; ++i) {
+        if (!ChainOnlyHas(submits[i].pNext, kHandleFreeChain)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CanUnwrapInScratch(uint32_t submit_count, const VkSubmitInfo2 *submits) {
+    if (!submits) {
+        return false;
+    }
+    static constexpr VkStructureType kHandleFreeChain[] = {VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR};
+    for (uint32_t i = 0; i < submit_count; ++i) {
+        const VkSubmitInfo2 &submit = submits[i];
+        if (!ChainOnlyHas(submit.pNext, kHandleFreeChain)) {
+            return false;
+        }
+        for (uint32_t j = 0; j < submit.waitSemaphoreInfoCount; ++j) {
+            if (submit.pWaitSemaphoreInfos[j].pNext) {
+                return false;
+            }
+        }
+        for (uint32_t j = 0; j < submit.commandBufferInfoCount; ++j) {
+            if (submit.pCommandBufferInfos[j].pNext) {
+                return false;
+            }
+        }
+        for (uint32_t j = 0; j < submit.signalSemaphoreInfoCount; ++j) {
+            if (submit.pSignalSemaphoreInfos[j].pNext) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool CanUnwrapInScratch(uint32_t buffer_barrier_count, const VkBufferMemoryBarrier *buffer_barriers, uint32_t image_barrier_count,
+                        const VkImageMemoryBarrier *image_barriers) {
+    for (uint32_t i = 0; buffer_barriers && i < buffer_barrier_count; ++i) {
+        if (buffer_barriers[i].pNext) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; image_barriers && i < image_barrier_count; ++i) {
+        if (image_barriers[i].pNext) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CanUnwrapInScratch(const VkDependencyInfo *dependency_info) {
+    if (!dependency_info || dependency_info->pNext) {
+        return false;
+    }
+    for (uint32_t i = 0; i < dependency_info->memoryBarrierCount; ++i) {
+        if (dependency_info->pMemoryBarriers[i].pNext) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < dependency_info->bufferMemoryBarrierCount; ++i) {
+        if (dependency_info->pBufferMemoryBarriers[i].pNext) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < dependency_info->imageMemoryBarrierCount; ++i) {
+        if (dependency_info->pImageMemoryBarriers[i].pNext) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace dispatch
+}  // namespace vvl
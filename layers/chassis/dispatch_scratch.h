@@ -0,0 +1,89 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <vulkan/vulkan.h>
+
+#include "containers/arena.h"
+
+// When handle wrapping is on, the dispatch functions pass down the chain a copy of their structs with the handles unwrapped.
+// Those copies are usually heap allocated safe structs. The entry points called every frame (descriptor set updates, queue
+// submissions and pipeline barriers) instead copy their structs in a thread local scratch arena, when the structs have no
+// extension with handles. The arena keeps its memory, so a steady state call does not allocate.
+namespace vvl {
+namespace dispatch {
+
+// The arena of the calling thread
+MonotonicArena &GetScratchArena();
+
+// The scratch arena is reset when the outermost scope of the thread ends
+class ScratchScope {
+  public:
+    ScratchScope();
+    ~ScratchScope();
+    ScratchScope(const ScratchScope &) = delete;
+    ScratchScope &operator=(const ScratchScope &) = delete;
+
+    MonotonicArena &arena;
+
+    // Mutable copy, so the handles can be unwrapped in place
+    template <typename T>
+    T *Copy(const T *src, size_t count) {
+        if (!src || count == 0) {
+            return nullptr;
+        }
+        T *dst = arena.AllocateArray<T>(count);
+        std::memcpy(dst, src, sizeof(T) * count);
+        return dst;
+    }
+};
+
+// True when the structs only chain extensions without handles, so the copies can be shallow
+bool CanUnwrapInScratch(uint32_t write_count, const VkWriteDescriptorSet *writes);
+bool CanUnwrapInScratch(uint32_t submit_count, const VkSubmitInfo *submits);
+bool CanUnwrapInScratch(uint32_t submit_count, const VkSubmitInfo2 *submits);
+// Barriers are only taken without any pNext
+bool CanUnwrapInScratch(uint32_t buffer_barrier_count, const VkBufferMemoryBarrier *buffer_barriers, uint32_t image_barrier_count,
+                        const VkImageMemoryBarrier *image_barriers);
+bool CanUnwrapInScratch(const VkDependencyInfo *dependency_info);
+
+}  // namespace dispatch
+}  // namespace vvl
+
+// Used by the generated dispatch functions once CanUnwrapInScratch returned true, see layer_chassis_dispatch_manual.cpp
+class ValidationObject;
+void ScratchDispatchUpdateDescriptorSets(ValidationObject *layer_data, VkDevice device, uint32_t descriptorWriteCount,
+                                         const VkWriteDescriptorSet *pDescriptorWrites, uint32_t descriptorCopyCount,
+                                         const VkCopyDescriptorSet *pDescriptorCopies);
+VkResult ScratchDispatchQueueSubmit(ValidationObject *layer_data, VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                    VkFence fence);
+// Shared by vkQueueSubmit2 and vkQueueSubmit2KHR, down_call is the matching dispatch table entry
+VkResult ScratchDispatchQueueSubmit2(ValidationObject *layer_data, PFN_vkQueueSubmit2 down_call, VkQueue queue,
+                                     uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence);
+void ScratchDispatchCmdPipelineBarrier(ValidationObject *layer_data, VkCommandBuffer commandBuffer,
+                                       VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
+                                       VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount,
+                                       const VkMemoryBarrier *pMemoryBarriers, uint32_t bufferMemoryBarrierCount,
+                                       const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
+                                       const VkImageMemoryBarrier *pImageMemoryBarriers);
+// Shared by vkCmdPipelineBarrier2 and vkCmdPipelineBarrier2KHR
+void ScratchDispatchCmdPipelineBarrier2(ValidationObject *layer_data, PFN_vkCmdPipelineBarrier2 down_call,
+                                        VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo);
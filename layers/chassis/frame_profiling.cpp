@@ -0,0 +1,146 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chassis/frame_profiling.h"
+
+#include <array>
+#include <cinttypes>
+#include <mutex>
+
+#include "chassis.h"
+#include "chassis/intercept_timing.h"
+#include "profiling/profiling.h"
+
+namespace vvl {
+namespace frame_profiling {
+
+std::atomic<bool> enabled{false};
+
+// The validation objects with a column in the timeline, and their Tracy plot names (which must outlive the plots)
+struct ProfiledObject {
+    LayerObjectTypeId object_type;
+    const char *plot_name;
+};
+static constexpr std::array<ProfiledObject, 7> kProfiledObjects = {{
+    {LayerObjectTypeThreading, "VVL ThreadSafety ms"},
+    {LayerObjectTypeParameterValidation, "VVL StatelessValidation ms"},
+    {LayerObjectTypeObjectTracker, "VVL ObjectLifetimes ms"},
+    {LayerObjectTypeCoreValidation, "VVL CoreChecks ms"},
+    {LayerObjectTypeBestPractices, "VVL BestPractices ms"},
+    {LayerObjectTypeGpuAssisted, "VVL gpuav::Validator ms"},
+    {LayerObjectTypeSyncValidation, "VVL SyncValidator ms"},
+}};
+
+// What was added up at the end of the previous frame
+struct FrameState {
+    std::mutex lock;
+    FILE *csv_file = nullptr;
+    bool presented = false;
+    uint64_t frame_count = 0;
+    uint64_t time_ns = 0;
+    std::array<uint64_t, intercept_timing::kMaxObjectTypes> object_ns{};
+    uint64_t messages = 0;
+    uint64_t errors = 0;
+};
+// Never destroyed, like the other chassis wide profiling state
+static FrameState &State() {
+    static FrameState *state = new FrameState();
+    return *state;
+}
+
+void Enable(FILE *csv_file) {
+    intercept_timing::Enable();
+    FrameState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    if (state.csv_file) {
+        fclose(state.csv_file);
+    }
+    state.csv_file = csv_file;
+    if (state.csv_file) {
+        fprintf(state.csv_file, "frame,boundary,frame_id,frame_ms,layer_ms");
+        for (const ProfiledObject &object : kProfiledObjects) {
+            fprintf(state.csv_file, ",%s_ms", intercept_timing::ObjectName(object.object_type));
+        }
+        fprintf(state.csv_file, ",messages,errors\n");
+        fflush(state.csv_file);
+    }
+    // A new instance starts a new timeline
+    state.presented = false;
+    state.frame_count = 0;
+    state.time_ns = intercept_timing::Now();
+    state.object_ns = intercept_timing::ObjectTotals();
+    state.messages = 0;
+    state.errors = 0;
+    enabled.store(true, std::memory_order_release);
+}
+
+static double ToMs(uint64_t ns) { return static_cast<double>(ns) / 1e6; }
+
+void EndFrame(Boundary boundary, uint64_t frame_id, const DebugReport &debug_report) {
+    if (boundary == Boundary::FrameBoundary) {
+        // Frame boundaries of submissions are only used when the application doesn't present
+        if (State().presented) {
+            return;
+        }
+        // Present already marks its frames
+        VVL_TracyCFrameMark;
+    }
+
+    const uint64_t now = intercept_timing::Now();
+    const std::array<uint64_t, intercept_timing::kMaxObjectTypes> object_ns = intercept_timing::ObjectTotals();
+    const uint64_t messages = debug_report.LoggedMessageCount();
+    const uint64_t errors = debug_report.LoggedErrorCount();
+
+    FrameState &state = State();
+    std::lock_guard<std::mutex> guard(state.lock);
+    state.presented |= boundary == Boundary::Present;
+    const uint64_t frame = state.frame_count++;
+    const uint64_t frame_ns = now - state.time_ns;
+
+    std::array<uint64_t, kProfiledObjects.size()> frame_object_ns{};
+    uint64_t layer_ns = 0;
+    for (size_t i = 0; i < kProfiledObjects.size(); ++i) {
+        const uint32_t object_type = kProfiledObjects[i].object_type;
+        frame_object_ns[i] = object_ns[object_type] - state.object_ns[object_type];
+        layer_ns += frame_object_ns[i];
+        VVL_TracyPlot(kProfiledObjects[i].plot_name, ToMs(frame_object_ns[i]));
+    }
+    // Another instance can share the chassis wide counters with its own DebugReport
+    const uint64_t frame_messages = messages >= state.messages ? messages - state.messages : messages;
+    const uint64_t frame_errors = errors >= state.errors ? errors - state.errors : errors;
+    VVL_TracyPlot("VVL layer ms", ToMs(layer_ns));
+    VVL_TracyPlot("VVL messages", static_cast<int64_t>(frame_messages));
+
+    if (state.csv_file) {
+        fprintf(state.csv_file, "%" PRIu64 ",%s,%" PRIu64 ",%.3f,%.3f", frame,
+                boundary == Boundary::Present ? "present" : "frame_boundary", frame_id, ToMs(frame_ns), ToMs(layer_ns));
+        for (const uint64_t ns : frame_object_ns) {
+            fprintf(state.csv_file, ",%.3f", ToMs(ns));
+        }
+        fprintf(state.csv_file, ",%" PRIu64 ",%" PRIu64 "\n", frame_messages, frame_errors);
+        // A line per frame, the timeline must be readable while the application runs or after it crashed
+        fflush(state.csv_file);
+    }
+
+    state.time_ns = now;
+    state.object_ns = object_ns;
+    state.messages = messages;
+    state.errors = errors;
+}
+
+}  // namespace frame_profiling
+}  // namespace vvl
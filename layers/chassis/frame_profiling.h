@@ -0,0 +1,65 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+
+#include <vulkan/vulkan.h>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+class DebugReport;
+
+namespace vvl {
+namespace frame_profiling {
+
+// What ended a frame
+enum class Boundary : uint32_t {
+    Present,
+    // VkFrameBoundaryEXT with VK_FRAME_BOUNDARY_FRAME_END_BIT_EXT in a queue submission, for applications that don't present
+    FrameBoundary,
+};
+
+extern std::atomic<bool> enabled;
+inline bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+// Also turns intercept timing on, the time of the validation objects comes from it. With a csv_file (owned from now on) every
+// frame is written as one line of it.
+void Enable(FILE *csv_file);
+
+// Adds up what the layer did since the previous frame (time in each validation object, messages logged through debug_report)
+// and plots it in Tracy and in the CSV timeline. Frame boundaries of submissions are ignored once a present was seen, so the
+// same frame is not counted twice.
+void EndFrame(Boundary boundary, uint64_t frame_id, const DebugReport &debug_report);
+
+// Called by the chassis after the submissions, VkSubmitInfo, VkSubmitInfo2 and VkBindSparseInfo can end a frame
+template <typename SubmitInfo>
+void OnSubmit(uint32_t submit_count, const SubmitInfo *submits, const DebugReport &debug_report) {
+    if (!IsEnabled() || !submits) {
+        return;
+    }
+    for (uint32_t i = 0; i < submit_count; ++i) {
+        const auto *frame_boundary = vku::FindStructInPNextChain<VkFrameBoundaryEXT>(submits[i].pNext);
+        if (frame_boundary && (frame_boundary->flags & VK_FRAME_BOUNDARY_FRAME_END_BIT_EXT)) {
+            EndFrame(Boundary::FrameBoundary, frame_boundary->frameID, debug_report);
+            return;
+        }
+    }
+}
+
+}  // namespace frame_profiling
+}  // namespace vvl
@@ -0,0 +1,319 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chassis/intercept_timing.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "chassis.h"
+
+namespace vvl {
+namespace intercept_timing {
+
+static_assert(LayerObjectTypeMaxEnum <= kMaxObjectTypes);
+
+static constexpr uint32_t kPhaseCount = static_cast<uint32_t>(Phase::Count);
+// How many entry points of each object the text report lists
+static constexpr size_t kReportedEntryPoints = 10;
+
+std::atomic<bool> enabled{false};
+
+static std::atomic<uint64_t> frame_count{0};
+
+// The counters of one thread. Only that thread adds to them, so the hot entry points called from many threads don't share
+// cache lines, the report sums all the threads.
+struct AtomicCallStats {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> ns{0};
+};
+struct ThreadStats {
+    // The counters of every (object, phase) of an entry point, allocated the first time the thread times that entry point
+    std::atomic<AtomicCallStats *> functions[kMaxFunctions] = {};
+    std::atomic<uint64_t> object_ns[kMaxObjectTypes] = {};
+
+    ~ThreadStats() {
+        for (std::atomic<AtomicCallStats *> &function_stats : functions) {
+            delete[] function_stats.load(std::memory_order_relaxed);
+        }
+    }
+};
+
+// Every ThreadStats ever created, the ones of exited threads are handed to new threads, so they keep their counts
+struct ThreadStatsRegistry {
+    std::mutex lock;
+    std::vector<std::unique_ptr<ThreadStats>> all;
+    std::vector<ThreadStats *> unused;
+};
+// Never destroyed, threads can still exit after the static destructors ran
+static ThreadStatsRegistry &Registry() {
+    static ThreadStatsRegistry *registry = new ThreadStatsRegistry();
+    return *registry;
+}
+
+// Gives the ThreadStats of the thread back to the registry when the thread exits
+struct ThreadStatsOwner {
+    ThreadStats *stats = nullptr;
+    ~ThreadStatsOwner() {
+        if (stats) {
+            ThreadStatsRegistry &registry = Registry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            registry.unused.emplace_back(stats);
+        }
+    }
+};
+
+static ThreadStats &LocalThreadStats() {
+    thread_local ThreadStatsOwner owner;
+    if (!owner.stats) {
+        ThreadStatsRegistry &registry = Registry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        if (registry.unused.empty()) {
+            owner.stats = registry.all.emplace_back(std::make_unique<ThreadStats>()).get();
+        } else {
+            owner.stats = registry.unused.back();
+            registry.unused.pop_back();
+        }
+    }
+    return *owner.stats;
+}
+
+void Enable() { enabled.store(true, std::memory_order_release); }
+
+uint64_t Now() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static uint32_t StatsIndex(uint32_t object_type, Phase phase) { return object_type * kPhaseCount + static_cast<uint32_t>(phase); }
+
+void Record(uint32_t object_type, Func function, Phase phase, uint64_t ns) {
+    const uint32_t function_index = static_cast<uint32_t>(function);
+    assert(function_index < kMaxFunctions);
+    if (function_index >= kMaxFunctions || object_type >= kMaxObjectTypes) {
+        return;
+    }
+    ThreadStats &thread_stats = LocalThreadStats();
+    std::atomic<AtomicCallStats *> &function_slot = thread_stats.functions[function_index];
+    AtomicCallStats *function_stats = function_slot.load(std::memory_order_relaxed);
+    if (!function_stats) {
+        function_stats = new AtomicCallStats[kMaxObjectTypes * kPhaseCount];
+        // Release so the reports of other threads see constructed counters
+        function_slot.store(function_stats, std::memory_order_release);
+    }
+    // Not contended, only the reports and Reset() read or write the counters of another thread
+    AtomicCallStats &stats = function_stats[StatsIndex(object_type, phase)];
+    stats.calls.fetch_add(1, std::memory_order_relaxed);
+    stats.ns.fetch_add(ns, std::memory_order_relaxed);
+    thread_stats.object_ns[object_type].fetch_add(ns, std::memory_order_relaxed);
+}
+
+// Calls callback(function_index, counters of the entry point) for every entry point that a thread timed
+template <typename Callback>
+static void ForEachThreadFunctionStats(Callback &&callback) {
+    ThreadStatsRegistry &registry = Registry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    for (const std::unique_ptr<ThreadStats> &thread_stats : registry.all) {
+        for (uint32_t function_index = 0; function_index < kMaxFunctions; ++function_index) {
+            if (AtomicCallStats *function_stats = thread_stats->functions[function_index].load(std::memory_order_acquire)) {
+                callback(function_index, function_stats);
+            }
+        }
+    }
+}
+
+CallStats Stats(uint32_t object_type, Func function, Phase phase) {
+    CallStats total;
+    const uint32_t function_index = static_cast<uint32_t>(function);
+    if (function_index >= kMaxFunctions || object_type >= kMaxObjectTypes) {
+        return total;
+    }
+    ForEachThreadFunctionStats([&](uint32_t index, const AtomicCallStats *function_stats) {
+        if (index == function_index) {
+            const AtomicCallStats &stats = function_stats[StatsIndex(object_type, phase)];
+            total.calls += stats.calls.load(std::memory_order_relaxed);
+            total.ns += stats.ns.load(std::memory_order_relaxed);
+        }
+    });
+    return total;
+}
+
+std::array<uint64_t, kMaxObjectTypes> ObjectTotals() {
+    std::array<uint64_t, kMaxObjectTypes> totals{};
+    ThreadStatsRegistry &registry = Registry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    for (const std::unique_ptr<ThreadStats> &thread_stats : registry.all) {
+        for (uint32_t object_type = 0; object_type < kMaxObjectTypes; ++object_type) {
+            totals[object_type] += thread_stats->object_ns[object_type].load(std::memory_order_relaxed);
+        }
+    }
+    return totals;
+}
+
+bool EndFrame(uint32_t frame_interval) {
+    const uint64_t frame = frame_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    return frame_interval != 0 && frame % frame_interval == 0;
+}
+
+const char *ObjectName(uint32_t object_type) {
+    switch (static_cast<LayerObjectTypeId>(object_type)) {
+        case LayerObjectTypeThreading:
+            return "ThreadSafety";
+        case LayerObjectTypeParameterValidation:
+            return "StatelessValidation";
+        case LayerObjectTypeObjectTracker:
+            return "ObjectLifetimes";
+        case LayerObjectTypeCoreValidation:
+            return "CoreChecks";
+        case LayerObjectTypeBestPractices:
+            return "BestPractices";
+        case LayerObjectTypeGpuAssisted:
+            return "gpuav::Validator";
+        case LayerObjectTypeSyncValidation:
+            return "SyncValidator";
+        case LayerObjectTypeInstance:
+        case LayerObjectTypeDevice:
+        case LayerObjectTypeMaxEnum:
+            break;
+    }
+    return "ValidationObject";
+}
+
+static const char *PhaseName(Phase phase) {
+    switch (phase) {
+        case Phase::PreCallValidate:
+            return "PreCallValidate";
+        case Phase::PreCallRecord:
+            return "PreCallRecord";
+        case Phase::PostCallRecord:
+            return "PostCallRecord";
+        case Phase::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+struct TimedCall {
+    uint32_t object_type;
+    Func function;
+    Phase phase;
+    uint64_t calls;
+    uint64_t ns;
+};
+
+// Every (object, entry point, phase) that was called at least once, sorted by object
+static std::vector<TimedCall> CollectTimedCalls() {
+    // Sum of all threads, indexed like the counters of a thread
+    std::vector<CallStats> totals;
+    ForEachThreadFunctionStats([&totals](uint32_t function_index, const AtomicCallStats *function_stats) {
+        if (totals.empty()) {
+            totals.resize(kMaxFunctions * kMaxObjectTypes * kPhaseCount);
+        }
+        CallStats *function_totals = &totals[function_index * kMaxObjectTypes * kPhaseCount];
+        for (uint32_t i = 0; i < kMaxObjectTypes * kPhaseCount; ++i) {
+            function_totals[i].calls += function_stats[i].calls.load(std::memory_order_relaxed);
+            function_totals[i].ns += function_stats[i].ns.load(std::memory_order_relaxed);
+        }
+    });
+
+    std::vector<TimedCall> timed_calls;
+    if (totals.empty()) {
+        return timed_calls;
+    }
+    for (uint32_t object_type = 0; object_type < kMaxObjectTypes; ++object_type) {
+        for (uint32_t function = 0; function < kMaxFunctions; ++function) {
+            for (uint32_t phase = 0; phase < kPhaseCount; ++phase) {
+                const CallStats &stats =
+                    totals[function * kMaxObjectTypes * kPhaseCount + StatsIndex(object_type, static_cast<Phase>(phase))];
+                if (stats.calls != 0) {
+                    timed_calls.push_back({object_type, static_cast<Func>(function), static_cast<Phase>(phase), stats.calls,
+                                           stats.ns});
+                }
+            }
+        }
+    }
+    return timed_calls;
+}
+
+std::string Report() {
+    std::string report = "Validation object timing:\n";
+    std::vector<TimedCall> timed_calls = CollectTimedCalls();
+    if (timed_calls.empty()) {
+        report += "    No entry point was timed.\n";
+        return report;
+    }
+
+    char line[256];
+    auto object_begin = timed_calls.begin();
+    while (object_begin != timed_calls.end()) {
+        const uint32_t object_type = object_begin->object_type;
+        const auto object_end = std::find_if(object_begin, timed_calls.end(),
+                                             [object_type](const TimedCall &call) { return call.object_type != object_type; });
+        uint64_t object_calls = 0;
+        uint64_t object_ns = 0;
+        for (auto it = object_begin; it != object_end; ++it) {
+            object_calls += it->calls;
+            object_ns += it->ns;
+        }
+        std::snprintf(line, sizeof(line), "    %s: %" PRIu64 " calls, %.3fms\n", ObjectName(object_type), object_calls,
+                      static_cast<double>(object_ns) / 1e6);
+        report += line;
+
+        std::sort(object_begin, object_end, [](const TimedCall &a, const TimedCall &b) { return a.ns > b.ns; });
+        const size_t listed = std::min(kReportedEntryPoints, static_cast<size_t>(object_end - object_begin));
+        for (auto it = object_begin; it != object_begin + listed; ++it) {
+            std::snprintf(line, sizeof(line), "        %s %s: %" PRIu64 " calls, %.3fms (%.0fns per call)\n",
+                          String(it->function), PhaseName(it->phase), it->calls, static_cast<double>(it->ns) / 1e6,
+                          static_cast<double>(it->ns) / static_cast<double>(it->calls));
+            report += line;
+        }
+        object_begin = object_end;
+    }
+    return report;
+}
+
+std::string ReportJson() {
+    std::string report = "[";
+    char entry[256];
+    for (const TimedCall &call : CollectTimedCalls()) {
+        std::snprintf(entry, sizeof(entry),
+                      "%s{\"object\":\"%s\",\"function\":\"%s\",\"phase\":\"%s\",\"calls\":%" PRIu64 ",\"ns\":%" PRIu64 "}",
+                      report.size() == 1 ? "" : ",", ObjectName(call.object_type), String(call.function), PhaseName(call.phase),
+                      call.calls, call.ns);
+        report += entry;
+    }
+    report += "]";
+    return report;
+}
+
+void Reset() {
+    ForEachThreadFunctionStats([](uint32_t, AtomicCallStats *function_stats) {
+        for (uint32_t i = 0; i < kMaxObjectTypes * kPhaseCount; ++i) {
+            function_stats[i].calls.store(0, std::memory_order_relaxed);
+            function_stats[i].ns.store(0, std::memory_order_relaxed);
+        }
+    });
+}
+
+}  // namespace intercept_timing
+}  // namespace vvl
@@ -0,0 +1,100 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "generated/error_location_helper.h"
+
+namespace vvl {
+namespace intercept_timing {
+
+// The three places of an entry point where the chassis calls into the validation objects
+enum class Phase : uint32_t {
+    PreCallValidate,
+    PreCallRecord,
+    PostCallRecord,
+    Count,
+};
+
+// Enough for every vvl::Func and LayerObjectTypeId, the calls past these limits are not timed
+static constexpr uint32_t kMaxFunctions = 1024;
+static constexpr uint32_t kMaxObjectTypes = 16;
+
+struct CallStats {
+    uint64_t calls = 0;
+    uint64_t ns = 0;
+};
+
+extern std::atomic<bool> enabled;
+inline bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+// Like lock profiling, timing can't be turned off once on
+void Enable();
+
+uint64_t Now();
+// Adds to the counters of the calling thread, threads never write the same counters
+void Record(uint32_t object_type, Func function, Phase phase, uint64_t ns);
+// Sum of the counters of every thread
+CallStats Stats(uint32_t object_type, Func function, Phase phase);
+// Time spent in each validation object by every thread since timing was enabled. Never reset, users look at the difference
+// between two calls (see frame_profiling).
+std::array<uint64_t, kMaxObjectTypes> ObjectTotals();
+const char *ObjectName(uint32_t object_type);
+
+// Counts a present, returns true once every frame_interval presents, when the periodic report is due
+bool EndFrame(uint32_t frame_interval);
+
+// Time spent in each validation object, with the entry points that cost the most
+std::string Report();
+// Every timed (object, entry point, phase) as a JSON array, for tools that compare runs
+std::string ReportJson();
+void Reset();
+
+}  // namespace intercept_timing
+
+// Times one call of the chassis into a validation object. When timing is off it costs one relaxed load.
+class InterceptTimer {
+  public:
+    InterceptTimer(uint32_t object_type, Func function, intercept_timing::Phase phase)
+        : start_(intercept_timing::IsEnabled() ? intercept_timing::Now() : 0),
+          object_type_(object_type),
+          function_(function),
+          phase_(phase) {}
+    ~InterceptTimer() {
+        if (start_ != 0) {
+            intercept_timing::Record(object_type_, function_, phase_, intercept_timing::Now() - start_);
+        }
+    }
+    InterceptTimer(const InterceptTimer &) = delete;
+    InterceptTimer &operator=(const InterceptTimer &) = delete;
+
+  private:
+    const uint64_t start_;
+    const uint32_t object_type_;
+    const Func function_;
+    const intercept_timing::Phase phase_;
+};
+
+}  // namespace vvl
+
+// Used by the generated chassis right after taking the lock of the validation object, so lock waits are not included
+#define VVL_InterceptTimer(intercept, phase, function)                                                   \
+    const vvl::InterceptTimer intercept_timer(static_cast<uint32_t>((intercept)->container_type), function, \
+                                              vvl::intercept_timing::Phase::phase)
@@ -21,9 +21,12 @@
 #include "generated/layer_chassis_dispatch.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include "state_tracker/pipeline_state.h"
+#include "chassis/dispatch_scratch.h"
 
 std::shared_mutex dispatch_lock;
 
+bool IsWrappedHandle(uint64_t handle) { return wrap_handles && unique_id_mapping.find(handle) != unique_id_mapping.end(); }
+
 #ifdef VK_USE_PLATFORM_METAL_EXT
 // The vkExportMetalObjects extension returns data from the driver -- we've created a copy of the pNext chain, so
 // copy the returned data to the caller
@@ -1715,3 +1718,161 @@ VkResult DispatchCreateIndirectExecutionSetEXT(VkDevice device, const VkIndirect
     }
     return result;
 }
+
+void ScratchDispatchUpdateDescriptorSets(ValidationObject *layer_data, VkDevice device, uint32_t descriptorWriteCount,
+                                         const VkWriteDescriptorSet *pDescriptorWrites, uint32_t descriptorCopyCount,
+                                         const VkCopyDescriptorSet *pDescriptorCopies) {
+    vvl::dispatch::ScratchScope scratch;
+
+    VkWriteDescriptorSet *local_pDescriptorWrites = scratch.Copy(pDescriptorWrites, descriptorWriteCount);
+    for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
+        VkWriteDescriptorSet &write = local_pDescriptorWrites[index0];
+        write.dstSet = layer_data->Unwrap(write.dstSet);
+        // Only the array matching the descriptor type is valid, CanUnwrapInScratch let through the types using one of them
+        switch (write.descriptorType) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: {
+                VkDescriptorImageInfo *image_infos = scratch.Copy(write.pImageInfo, write.descriptorCount);
+                for (uint32_t index1 = 0; image_infos && index1 < write.descriptorCount; ++index1) {
+                    image_infos[index1].sampler = layer_data->Unwrap(image_infos[index1].sampler);
+                    image_infos[index1].imageView = layer_data->Unwrap(image_infos[index1].imageView);
+                }
+                write.pImageInfo = image_infos;
+                write.pBufferInfo = nullptr;
+                write.pTexelBufferView = nullptr;
+                break;
+            }
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
+                VkDescriptorBufferInfo *buffer_infos = scratch.Copy(write.pBufferInfo, write.descriptorCount);
+                for (uint32_t index1 = 0; buffer_infos && index1 < write.descriptorCount; ++index1) {
+                    buffer_infos[index1].buffer = layer_data->Unwrap(buffer_infos[index1].buffer);
+                }
+                write.pImageInfo = nullptr;
+                write.pBufferInfo = buffer_infos;
+                write.pTexelBufferView = nullptr;
+                break;
+            }
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: {
+                VkBufferView *texel_buffer_views = scratch.Copy(write.pTexelBufferView, write.descriptorCount);
+                for (uint32_t index1 = 0; texel_buffer_views && index1 < write.descriptorCount; ++index1) {
+                    texel_buffer_views[index1] = layer_data->Unwrap(texel_buffer_views[index1]);
+                }
+                write.pImageInfo = nullptr;
+                write.pBufferInfo = nullptr;
+                write.pTexelBufferView = texel_buffer_views;
+                break;
+            }
+            default:
+                // Inline uniform blocks are entirely in the pNext chain
+                write.pImageInfo = nullptr;
+                write.pBufferInfo = nullptr;
+                write.pTexelBufferView = nullptr;
+                break;
+        }
+    }
+
+    VkCopyDescriptorSet *local_pDescriptorCopies = scratch.Copy(pDescriptorCopies, descriptorCopyCount);
+    for (uint32_t index0 = 0; local_pDescriptorCopies && index0 < descriptorCopyCount; ++index0) {
+        local_pDescriptorCopies[index0].srcSet = layer_data->Unwrap(local_pDescriptorCopies[index0].srcSet);
+        local_pDescriptorCopies[index0].dstSet = layer_data->Unwrap(local_pDescriptorCopies[index0].dstSet);
+    }
+
+    layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, local_pDescriptorWrites,
+                                                           descriptorCopyCount, local_pDescriptorCopies);
+}
+
+VkResult ScratchDispatchQueueSubmit(ValidationObject *layer_data, VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                    VkFence fence) {
+    vvl::dispatch::ScratchScope scratch;
+
+    VkSubmitInfo *local_pSubmits = scratch.Copy(pSubmits, submitCount);
+    for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
+        VkSubmitInfo &submit = local_pSubmits[index0];
+        VkSemaphore *wait_semaphores = scratch.Copy(submit.pWaitSemaphores, submit.waitSemaphoreCount);
+        for (uint32_t index1 = 0; wait_semaphores && index1 < submit.waitSemaphoreCount; ++index1) {
+            wait_semaphores[index1] = layer_data->Unwrap(wait_semaphores[index1]);
+        }
+        submit.pWaitSemaphores = wait_semaphores;
+        VkSemaphore *signal_semaphores = scratch.Copy(submit.pSignalSemaphores, submit.signalSemaphoreCount);
+        for (uint32_t index1 = 0; signal_semaphores && index1 < submit.signalSemaphoreCount; ++index1) {
+            signal_semaphores[index1] = layer_data->Unwrap(signal_semaphores[index1]);
+        }
+        submit.pSignalSemaphores = signal_semaphores;
+    }
+
+    return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, local_pSubmits, layer_data->Unwrap(fence));
+}
+
+VkResult ScratchDispatchQueueSubmit2(ValidationObject *layer_data, PFN_vkQueueSubmit2 down_call, VkQueue queue,
+                                     uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) {
+    vvl::dispatch::ScratchScope scratch;
+
+    VkSubmitInfo2 *local_pSubmits = scratch.Copy(pSubmits, submitCount);
+    for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
+        VkSubmitInfo2 &submit = local_pSubmits[index0];
+        VkSemaphoreSubmitInfo *wait_infos = scratch.Copy(submit.pWaitSemaphoreInfos, submit.waitSemaphoreInfoCount);
+        for (uint32_t index1 = 0; wait_infos && index1 < submit.waitSemaphoreInfoCount; ++index1) {
+            wait_infos[index1].semaphore = layer_data->Unwrap(wait_infos[index1].semaphore);
+        }
+        submit.pWaitSemaphoreInfos = wait_infos;
+        VkSemaphoreSubmitInfo *signal_infos = scratch.Copy(submit.pSignalSemaphoreInfos, submit.signalSemaphoreInfoCount);
+        for (uint32_t index1 = 0; signal_infos && index1 < submit.signalSemaphoreInfoCount; ++index1) {
+            signal_infos[index1].semaphore = layer_data->Unwrap(signal_infos[index1].semaphore);
+        }
+        submit.pSignalSemaphoreInfos = signal_infos;
+    }
+
+    return down_call(queue, submitCount, local_pSubmits, layer_data->Unwrap(fence));
+}
+
+void ScratchDispatchCmdPipelineBarrier(ValidationObject *layer_data, VkCommandBuffer commandBuffer,
+                                       VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
+                                       VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount,
+                                       const VkMemoryBarrier *pMemoryBarriers, uint32_t bufferMemoryBarrierCount,
+                                       const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
+                                       const VkImageMemoryBarrier *pImageMemoryBarriers) {
+    vvl::dispatch::ScratchScope scratch;
+
+    // Global memory barriers have no handles and are passed as they are
+    VkBufferMemoryBarrier *local_pBufferMemoryBarriers = scratch.Copy(pBufferMemoryBarriers, bufferMemoryBarrierCount);
+    for (uint32_t index0 = 0; local_pBufferMemoryBarriers && index0 < bufferMemoryBarrierCount; ++index0) {
+        local_pBufferMemoryBarriers[index0].buffer = layer_data->Unwrap(local_pBufferMemoryBarriers[index0].buffer);
+    }
+    VkImageMemoryBarrier *local_pImageMemoryBarriers = scratch.Copy(pImageMemoryBarriers, imageMemoryBarrierCount);
+    for (uint32_t index0 = 0; local_pImageMemoryBarriers && index0 < imageMemoryBarrierCount; ++index0) {
+        local_pImageMemoryBarriers[index0].image = layer_data->Unwrap(local_pImageMemoryBarriers[index0].image);
+    }
+
+    layer_data->device_dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags,
+                                                         memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                                                         local_pBufferMemoryBarriers, imageMemoryBarrierCount,
+                                                         local_pImageMemoryBarriers);
+}
+
+void ScratchDispatchCmdPipelineBarrier2(ValidationObject *layer_data, PFN_vkCmdPipelineBarrier2 down_call,
+                                        VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo) {
+    vvl::dispatch::ScratchScope scratch;
+
+    VkDependencyInfo local_dependency_info = *pDependencyInfo;
+    VkBufferMemoryBarrier2 *buffer_barriers =
+        scratch.Copy(pDependencyInfo->pBufferMemoryBarriers, pDependencyInfo->bufferMemoryBarrierCount);
+    for (uint32_t index0 = 0; buffer_barriers && index0 < pDependencyInfo->bufferMemoryBarrierCount; ++index0) {
+        buffer_barriers[index0].buffer = layer_data->Unwrap(buffer_barriers[index0].buffer);
+    }
+    local_dependency_info.pBufferMemoryBarriers = buffer_barriers;
+    VkImageMemoryBarrier2 *image_barriers =
+        scratch.Copy(pDependencyInfo->pImageMemoryBarriers, pDependencyInfo->imageMemoryBarrierCount);
+    for (uint32_t index0 = 0; image_barriers && index0 < pDependencyInfo->imageMemoryBarrierCount; ++index0) {
+        image_barriers[index0].image = layer_data->Unwrap(image_barriers[index0].image);
+    }
+    local_dependency_info.pImageMemoryBarriers = image_barriers;
+
+    down_call(commandBuffer, &local_dependency_info);
+}
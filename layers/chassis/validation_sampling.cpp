@@ -0,0 +1,34 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chassis/validation_sampling.h"
+
+namespace vvl {
+namespace validation_sampling {
+
+std::atomic<uint32_t> rate{0};
+std::atomic<uint32_t> call_counts[kMaxFunctions];
+
+void SetRate(uint32_t sampling_rate) {
+    for (auto &call_count : call_counts) {
+        call_count.store(0, std::memory_order_relaxed);
+    }
+    rate.store(sampling_rate, std::memory_order_release);
+}
+
+}  // namespace validation_sampling
+}  // namespace vvl
@@ -0,0 +1,53 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "generated/error_location_helper.h"
+
+namespace vvl {
+namespace validation_sampling {
+
+// Enough for every vvl::Func, the calls past this limit are always validated
+static constexpr uint32_t kMaxFunctions = 1024;
+
+// 0 and 1 validate every call
+extern std::atomic<uint32_t> rate;
+extern std::atomic<uint32_t> call_counts[kMaxFunctions];
+
+// Like the other chassis settings the rate is process wide, the count of each entry point restarts when it is set
+void SetRate(uint32_t sampling_rate);
+
+// The chassis asks this once per command buffer recording call, before the PreCallValidate of every validation object.
+// Returns true for 1 in rate calls of each entry point (the first one included), the PreCallRecord and PostCallRecord of the
+// other calls still run so the state tracking stays exact. When sampling is off it costs one relaxed load.
+inline bool ShouldValidate(Func function) {
+    const uint32_t sampling_rate = rate.load(std::memory_order_relaxed);
+    if (sampling_rate <= 1) {
+        return true;
+    }
+    const uint32_t function_index = static_cast<uint32_t>(function);
+    if (function_index >= kMaxFunctions) {
+        return true;
+    }
+    return call_counts[function_index].fetch_add(1, std::memory_order_relaxed) % sampling_rate == 0;
+}
+
+}  // namespace validation_sampling
+}  // namespace vvl
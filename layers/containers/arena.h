@@ -0,0 +1,118 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+// Bump allocator for data that lives exactly as long as its owner, like the state of one command buffer recording.
+//
+// Memory is only given back by Reset(), which keeps the blocks so that the next use of the arena does not allocate again.
+// Nothing placed in the arena is ever destroyed, so only trivially destructible types can go in it.
+class MonotonicArena {
+  public:
+    explicit MonotonicArena(size_t block_size = 4096) : block_size_(block_size) {}
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+    void *Allocate(size_t size, size_t alignment) {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+        while (current_block_ < blocks_.size()) {
+            if (void *result = AllocateFromBlock(blocks_[current_block_], size, alignment)) {
+                return result;
+            }
+            // Whatever is left in the block is skipped, it will be used again after the next Reset()
+            ++current_block_;
+            offset_ = 0;
+        }
+        // Each new block doubles in size (up to a limit) so a large recording only needs a few of them
+        const size_t growth = std::min<size_t>(blocks_.size(), 8);
+        const size_t new_block_size = std::max(block_size_ << growth, size + alignment);
+        // Not value initialized, unlike make_unique
+        blocks_.emplace_back(Block{std::unique_ptr<std::byte[]>(new std::byte[new_block_size]), new_block_size});
+        current_block_ = blocks_.size() - 1;
+        offset_ = 0;
+        return AllocateFromBlock(blocks_.back(), size, alignment);
+    }
+
+    template <typename T>
+    T *AllocateArray(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "MonotonicArena never runs destructors");
+        return static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    template <typename T>
+    span<const T> Copy(const T *data, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (count == 0) {
+            return {};
+        }
+        T *copy = AllocateArray<T>(count);
+        std::memcpy(copy, data, sizeof(T) * count);
+        return span<const T>(copy, count);
+    }
+
+    // Everything allocated so far becomes invalid
+    void Reset() {
+        current_block_ = 0;
+        offset_ = 0;
+    }
+
+    // Amount of memory held by the arena, used or not
+    size_t Capacity() const {
+        size_t capacity = 0;
+        for (const Block &block : blocks_) {
+            capacity += block.size;
+        }
+        return capacity;
+    }
+
+  private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    void *AllocateFromBlock(Block &block, size_t size, size_t alignment) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+        const uintptr_t aligned = (base + offset_ + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        const size_t start = static_cast<size_t>(aligned - base);
+        if (start + size > block.size) {
+            return nullptr;
+        }
+        offset_ = start + size;
+        return block.data.get() + start;
+    }
+
+    const size_t block_size_;
+    std::vector<Block> blocks_;
+    size_t current_block_ = 0;
+    size_t offset_ = 0;
+};
+
+}  // namespace vvl
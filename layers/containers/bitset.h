@@ -0,0 +1,266 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace vvl {
+
+// Fixed size bitset with the interface of std::bitset, for the wide flag sets used in the inner validation loops.
+//
+// Unlike std::bitset in C++17 every operation is constexpr, so flag constants defined in headers are built at compile time
+// instead of being dynamic initializers in each translation unit, and masks known at compile time can be folded into the code
+// that uses them. The operations are plain loops over 64 bit words, which the compiler unrolls and vectorizes for the target.
+// intersects() and is_subset_of() test against another set without building a temporary.
+template <size_t N>
+class bitset {
+    using Word = uint64_t;
+    static constexpr size_t kWordBits = 64;
+    static constexpr size_t kWordCount = (N + kWordBits - 1) / kWordBits;
+    static constexpr Word kLastWordMask = (N % kWordBits) ? (Word(1) << (N % kWordBits)) - 1 : ~Word(0);
+    static_assert(N > 0, "bitset must have at least one bit");
+
+  public:
+    class reference {
+      public:
+        constexpr reference &operator=(bool value) noexcept {
+            set_.set(pos_, value);
+            return *this;
+        }
+        constexpr reference &operator=(const reference &other) noexcept { return *this = bool(other); }
+        constexpr operator bool() const noexcept { return set_.test(pos_); }
+        constexpr bool operator~() const noexcept { return !set_.test(pos_); }
+        constexpr reference &flip() noexcept {
+            set_.flip(pos_);
+            return *this;
+        }
+
+      private:
+        friend class bitset;
+        constexpr reference(bitset &set, size_t pos) noexcept : set_(set), pos_(pos) {}
+        bitset &set_;
+        size_t pos_;
+    };
+
+    constexpr bitset() noexcept : words_{} {}
+    constexpr bitset(unsigned long long value) noexcept : words_{} {
+        words_[0] = static_cast<Word>(value);
+        words_[kWordCount - 1] &= kLastWordMask;
+    }
+
+    constexpr bool operator[](size_t pos) const noexcept { return test(pos); }
+    constexpr reference operator[](size_t pos) noexcept { return reference(*this, pos); }
+
+    constexpr bool test(size_t pos) const noexcept {
+        assert(pos < N);
+        return (words_[pos / kWordBits] >> (pos % kWordBits)) & 1;
+    }
+
+    constexpr bool all() const noexcept {
+        for (size_t i = 0; i + 1 < kWordCount; ++i) {
+            if (words_[i] != ~Word(0)) return false;
+        }
+        return words_[kWordCount - 1] == kLastWordMask;
+    }
+    constexpr bool any() const noexcept {
+        Word combined = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            combined |= words_[i];
+        }
+        return combined != 0;
+    }
+    constexpr bool none() const noexcept { return !any(); }
+
+    // Same as (*this & other).any()
+    constexpr bool intersects(const bitset &other) const noexcept {
+        Word combined = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            combined |= words_[i] & other.words_[i];
+        }
+        return combined != 0;
+    }
+    // Same as (*this & ~other).none()
+    constexpr bool is_subset_of(const bitset &other) const noexcept {
+        Word combined = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            combined |= words_[i] & ~other.words_[i];
+        }
+        return combined == 0;
+    }
+
+    constexpr size_t count() const noexcept {
+        size_t result = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            for (Word word = words_[i]; word != 0; word &= word - 1) {
+                ++result;
+            }
+        }
+        return result;
+    }
+    constexpr size_t size() const noexcept { return N; }
+
+    constexpr bitset &operator&=(const bitset &other) noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] &= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr bitset &operator|=(const bitset &other) noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr bitset &operator^=(const bitset &other) noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] ^= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr bitset operator~() const noexcept {
+        bitset result(*this);
+        result.flip();
+        return result;
+    }
+
+    constexpr bitset &operator<<=(size_t shift) noexcept {
+        const size_t word_shift = shift / kWordBits;
+        const size_t bit_shift = shift % kWordBits;
+        for (size_t i = kWordCount; i-- > 0;) {
+            Word word = 0;
+            if (i >= word_shift) {
+                word = words_[i - word_shift] << bit_shift;
+                if (bit_shift != 0 && i > word_shift) {
+                    word |= words_[i - word_shift - 1] >> (kWordBits - bit_shift);
+                }
+            }
+            words_[i] = word;
+        }
+        words_[kWordCount - 1] &= kLastWordMask;
+        return *this;
+    }
+    constexpr bitset &operator>>=(size_t shift) noexcept {
+        const size_t word_shift = shift / kWordBits;
+        const size_t bit_shift = shift % kWordBits;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            Word word = 0;
+            if (i + word_shift < kWordCount) {
+                word = words_[i + word_shift] >> bit_shift;
+                if (bit_shift != 0 && i + word_shift + 1 < kWordCount) {
+                    word |= words_[i + word_shift + 1] << (kWordBits - bit_shift);
+                }
+            }
+            words_[i] = word;
+        }
+        return *this;
+    }
+    constexpr bitset operator<<(size_t shift) const noexcept { return bitset(*this) <<= shift; }
+    constexpr bitset operator>>(size_t shift) const noexcept { return bitset(*this) >>= shift; }
+
+    constexpr bitset &set() noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] = ~Word(0);
+        }
+        words_[kWordCount - 1] &= kLastWordMask;
+        return *this;
+    }
+    constexpr bitset &set(size_t pos, bool value = true) noexcept {
+        assert(pos < N);
+        const Word bit = Word(1) << (pos % kWordBits);
+        if (value) {
+            words_[pos / kWordBits] |= bit;
+        } else {
+            words_[pos / kWordBits] &= ~bit;
+        }
+        return *this;
+    }
+    constexpr bitset &reset() noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] = 0;
+        }
+        return *this;
+    }
+    constexpr bitset &reset(size_t pos) noexcept { return set(pos, false); }
+    constexpr bitset &flip() noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] = ~words_[i];
+        }
+        words_[kWordCount - 1] &= kLastWordMask;
+        return *this;
+    }
+    constexpr bitset &flip(size_t pos) noexcept {
+        assert(pos < N);
+        words_[pos / kWordBits] ^= Word(1) << (pos % kWordBits);
+        return *this;
+    }
+
+    constexpr bool operator==(const bitset &other) const noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            if (words_[i] != other.words_[i]) return false;
+        }
+        return true;
+    }
+    constexpr bool operator!=(const bitset &other) const noexcept { return !(*this == other); }
+
+    std::string to_string(char zero = '0', char one = '1') const {
+        std::string result(N, zero);
+        for (size_t i = 0; i < N; ++i) {
+            if (test(i)) {
+                result[N - 1 - i] = one;
+            }
+        }
+        return result;
+    }
+
+    size_t hash() const noexcept {
+        size_t result = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            result ^= std::hash<Word>()(words_[i]) + static_cast<size_t>(0x9e3779b97f4a7c15ULL) + (result << 6) + (result >> 2);
+        }
+        return result;
+    }
+
+  private:
+    Word words_[kWordCount];
+};
+
+template <size_t N>
+constexpr bitset<N> operator&(const bitset<N> &lhs, const bitset<N> &rhs) noexcept {
+    return bitset<N>(lhs) &= rhs;
+}
+template <size_t N>
+constexpr bitset<N> operator|(const bitset<N> &lhs, const bitset<N> &rhs) noexcept {
+    return bitset<N>(lhs) |= rhs;
+}
+template <size_t N>
+constexpr bitset<N> operator^(const bitset<N> &lhs, const bitset<N> &rhs) noexcept {
+    return bitset<N>(lhs) ^= rhs;
+}
+
+}  // namespace vvl
+
+namespace std {
+template <size_t N>
+struct hash<vvl::bitset<N>> {
+    size_t operator()(const vvl::bitset<N> &value) const noexcept { return value.hash(); }
+};
+}  // namespace std
@@ -0,0 +1,95 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace vvl {
+
+// Fixed size table of counters keyed by 32 bit hashes, where every operation is lock free.
+//
+// The keys are placed with linear probing. A slot is claimed with a compare and swap on its key the first time the key is
+// counted and stays claimed, there is no erase. Once every slot is claimed, new keys are not counted at all.
+template <uint32_t SizeLog2 = 12>
+class ConcurrentCounterTable {
+  public:
+    // Adds one to the counter of key if it is below limit, returns false if the counter already reached limit.
+    // A key that doesn't fit in the table anymore can't be counted and always returns true.
+    bool IncrementBelow(uint32_t key, uint32_t limit) {
+        Slot *slot = ClaimSlot(key);
+        if (!slot) {
+            return true;
+        }
+        uint32_t count = slot->count.load(std::memory_order_relaxed);
+        do {
+            if (count >= limit) {
+                return false;
+            }
+        } while (!slot->count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+        return true;
+    }
+
+    uint32_t Get(uint32_t key) const {
+        const uint64_t stored_key = kUsedBit | key;
+        for (uint32_t probe = 0; probe < kSize; ++probe) {
+            const Slot &slot = slots_[(key + probe) & (kSize - 1)];
+            const uint64_t slot_key = slot.key.load(std::memory_order_acquire);
+            if (slot_key == 0) {
+                break;
+            }
+            if (slot_key == stored_key) {
+                return slot.count.load(std::memory_order_relaxed);
+            }
+        }
+        return 0;
+    }
+
+  private:
+    static constexpr uint32_t kSize = 1u << SizeLog2;
+    // Keys are stored with this bit set so that 0 can mean an empty slot
+    static constexpr uint64_t kUsedBit = uint64_t(1) << 32;
+
+    struct Slot {
+        std::atomic<uint64_t> key{0};
+        std::atomic<uint32_t> count{0};
+    };
+
+    // Returns the slot of key, claiming an empty one if needed, or nullptr if the table is full
+    Slot *ClaimSlot(uint32_t key) {
+        const uint64_t stored_key = kUsedBit | key;
+        // The low bits of the keys (VUID hashes) are already well distributed
+        for (uint32_t probe = 0; probe < kSize; ++probe) {
+            Slot &slot = slots_[(key + probe) & (kSize - 1)];
+            uint64_t slot_key = slot.key.load(std::memory_order_acquire);
+            if (slot_key == 0 && slot.key.compare_exchange_strong(slot_key, stored_key, std::memory_order_acq_rel)) {
+                return &slot;
+            }
+            // Either the slot was taken already or another thread just claimed it, slot_key holds its key in both cases
+            if (slot_key == stored_key) {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    std::array<Slot, kSize> slots_;
+};
+
+}  // namespace vvl
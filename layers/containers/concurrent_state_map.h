@@ -0,0 +1,239 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+// Same interface as vvl::concurrent_unordered_map, with iteration that does not copy the whole map.
+//
+// The map is split in buckets, each with its own lock. ForEach() and AnyOf() walk the buckets one at a time through a
+// cached copy of the bucket values. The copy is made the first time a bucket is iterated and dropped by the next write
+// to the bucket, so iterating maps which rarely change (queues, swapchains) only costs a reference count per bucket.
+// The callback runs with no lock held: it can use the map, and it sees each bucket as it was when the walk reached it.
+template <typename Key, typename T, int BucketsLog2 = 2>
+class ConcurrentStateMap {
+  public:
+    using size_type = size_t;
+
+    template <typename... Args>
+    void insert_or_assign(const Key &key, Args &&...args) {
+        Bucket &bucket = GetBucket(key);
+        std::unique_lock<std::shared_mutex> lock(bucket.lock);
+        bucket.map[key] = T(std::forward<Args>(args)...);
+        bucket.InvalidateValues();
+    }
+
+    template <typename... Args>
+    bool insert(const Key &key, Args &&...args) {
+        Bucket &bucket = GetBucket(key);
+        std::unique_lock<std::shared_mutex> lock(bucket.lock);
+        const bool inserted = bucket.map.insert(typename Inner::value_type(key, T(std::forward<Args>(args)...))).second;
+        if (inserted) {
+            bucket.InvalidateValues();
+        }
+        return inserted;
+    }
+
+    size_type erase(const Key &key) {
+        Bucket &bucket = GetBucket(key);
+        std::unique_lock<std::shared_mutex> lock(bucket.lock);
+        const size_type erased = bucket.map.erase(key);
+        if (erased) {
+            bucket.InvalidateValues();
+        }
+        return erased;
+    }
+
+    bool contains(const Key &key) const {
+        const Bucket &bucket = GetBucket(key);
+        std::shared_lock<std::shared_mutex> lock(bucket.lock);
+        return bucket.map.find(key) != bucket.map.end();
+    }
+
+    // Same shape as the FindResult of vku::concurrent::unordered_map, == and != only compare against end()
+    class FindResult {
+      public:
+        FindResult(bool found, T value) : result_(found, std::move(value)) {}
+
+        bool operator==(const FindResult &other) const { return !result_.first && !other.result_.first; }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+
+        std::pair<bool, T> *operator->() { return &result_; }
+        const std::pair<bool, T> *operator->() const { return &result_; }
+
+      private:
+        std::pair<bool, T> result_;
+    };
+
+    FindResult end() const { return FindResult(false, T()); }
+
+    FindResult find(const Key &key) const {
+        const Bucket &bucket = GetBucket(key);
+        std::shared_lock<std::shared_mutex> lock(bucket.lock);
+        auto it = bucket.map.find(key);
+        if (it == bucket.map.end()) {
+            return end();
+        }
+        return FindResult(true, it->second);
+    }
+
+    FindResult pop(const Key &key) {
+        Bucket &bucket = GetBucket(key);
+        std::unique_lock<std::shared_mutex> lock(bucket.lock);
+        auto it = bucket.map.find(key);
+        if (it == bucket.map.end()) {
+            return end();
+        }
+        FindResult result(true, std::move(it->second));
+        bucket.map.erase(it);
+        bucket.InvalidateValues();
+        return result;
+    }
+
+    // Copies the whole map, prefer ForEach() when the keys are not needed
+    std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> filter = nullptr) const {
+        std::vector<std::pair<const Key, T>> result;
+        for (const Bucket &bucket : buckets_) {
+            std::shared_lock<std::shared_mutex> lock(bucket.lock);
+            for (const auto &entry : bucket.map) {
+                if (!filter || filter(entry.second)) {
+                    result.emplace_back(entry.first, entry.second);
+                }
+            }
+        }
+        return result;
+    }
+
+    // Calls fn(const T &) for every value
+    template <typename Fn>
+    void ForEach(Fn &&fn) const {
+        for (const Bucket &bucket : buckets_) {
+            const auto values = bucket.GetValues();
+            for (const T &value : *values) {
+                fn(value);
+            }
+        }
+    }
+
+    // Returns true as soon as fn(const T &) returns true for a value
+    template <typename Fn>
+    bool AnyOf(Fn &&fn) const {
+        for (const Bucket &bucket : buckets_) {
+            const auto values = bucket.GetValues();
+            for (const T &value : *values) {
+                if (fn(value)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void clear() {
+        for (Bucket &bucket : buckets_) {
+            std::unique_lock<std::shared_mutex> lock(bucket.lock);
+            bucket.map.clear();
+            bucket.InvalidateValues();
+        }
+    }
+
+    size_type size() const {
+        size_type result = 0;
+        for (const Bucket &bucket : buckets_) {
+            std::shared_lock<std::shared_mutex> lock(bucket.lock);
+            result += bucket.map.size();
+        }
+        return result;
+    }
+
+    bool empty() const {
+        for (const Bucket &bucket : buckets_) {
+            std::shared_lock<std::shared_mutex> lock(bucket.lock);
+            if (!bucket.map.empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    using Inner = vvl::unordered_map<Key, T>;
+    using ValueList = std::vector<T>;
+    static constexpr int kBuckets = 1 << BucketsLog2;
+
+    struct alignas(vku::concurrent::get_hardware_destructive_interference_size()) Bucket {
+        mutable std::shared_mutex lock;
+        Inner map;
+        // Guards values, which readers fill while they only hold lock for reading
+        mutable std::mutex values_lock;
+        // Copy of the values of map, nullptr if map changed since the last iteration
+        mutable std::shared_ptr<const ValueList> values;
+
+        // The caller holds lock for writing
+        void InvalidateValues() {
+            std::lock_guard<std::mutex> guard(values_lock);
+            values.reset();
+        }
+
+        std::shared_ptr<const ValueList> GetValues() const {
+            std::shared_lock<std::shared_mutex> lock_guard(lock);
+            std::lock_guard<std::mutex> guard(values_lock);
+            if (!values) {
+                auto new_values = std::make_shared<ValueList>();
+                new_values->reserve(map.size());
+                for (const auto &entry : map) {
+                    new_values->emplace_back(entry.second);
+                }
+                values = std::move(new_values);
+            }
+            return values;
+        }
+    };
+
+    // Same hash as vku::concurrent::unordered_map, keys are Vulkan handles
+    static uint32_t BucketIndex(const Key &key) {
+        uint64_t u64 = 0;
+        if constexpr (std::is_pointer_v<Key>) {
+            u64 = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key));
+        } else {
+            u64 = static_cast<uint64_t>(key);
+        }
+        uint32_t hash = static_cast<uint32_t>(u64 >> 32) + static_cast<uint32_t>(u64);
+        hash ^= (hash >> BucketsLog2) ^ (hash >> (2 * BucketsLog2));
+        return hash & (kBuckets - 1);
+    }
+
+    Bucket &GetBucket(const Key &key) { return buckets_[BucketIndex(key)]; }
+    const Bucket &GetBucket(const Key &key) const { return buckets_[BucketIndex(key)]; }
+
+    std::array<Bucket, kBuckets> buckets_;
+};
+
+}  // namespace vvl
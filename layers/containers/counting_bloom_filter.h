@@ -0,0 +1,96 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace vvl {
+
+// Fixed size counting bloom filter of 64 bit keys, where every operation is lock free.
+//
+// MayContain() never misses a key that was added and not removed, but can return true for a key that never was, so a hit
+// has to be confirmed with an exact lookup. Each key bumps kHashCount counters of 8 bits. A counter reaching 0xff stays
+// there, as it no longer knows how many keys it counts, which only makes false positives a bit more likely.
+template <uint32_t SizeLog2 = 16>
+class CountingBloomFilter {
+  public:
+    CountingBloomFilter() {
+        for (auto &counter : counters_) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void Add(uint64_t key) {
+        ForEachCounter(key, [](std::atomic<uint8_t> &counter) {
+            uint8_t count = counter.load(std::memory_order_relaxed);
+            while (count != kSaturated && !counter.compare_exchange_weak(count, count + 1, std::memory_order_relaxed)) {
+            }
+        });
+    }
+
+    // key must have been added before
+    void Remove(uint64_t key) {
+        ForEachCounter(key, [](std::atomic<uint8_t> &counter) {
+            uint8_t count = counter.load(std::memory_order_relaxed);
+            while (count != kSaturated && count != 0 &&
+                   !counter.compare_exchange_weak(count, count - 1, std::memory_order_relaxed)) {
+            }
+        });
+    }
+
+    bool MayContain(uint64_t key) const {
+        const uint64_t hash = Mix(key);
+        const uint32_t h1 = static_cast<uint32_t>(hash);
+        const uint32_t h2 = static_cast<uint32_t>(hash >> 32) | 1;
+        for (uint32_t i = 0; i < kHashCount; ++i) {
+            if (counters_[(h1 + i * h2) & (kSize - 1)].load(std::memory_order_relaxed) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    static constexpr uint32_t kSize = 1u << SizeLog2;
+    static constexpr uint32_t kHashCount = 3;
+    static constexpr uint8_t kSaturated = 0xff;
+
+    // splitmix64 finalizer, handles are often pointers or small counters with few varying bits
+    static uint64_t Mix(uint64_t key) {
+        key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+        key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+        return key ^ (key >> 31);
+    }
+
+    // The kHashCount positions come from two halves of one hash (double hashing), h2 is odd so they are distinct
+    template <typename Func>
+    void ForEachCounter(uint64_t key, Func &&func) {
+        const uint64_t hash = Mix(key);
+        const uint32_t h1 = static_cast<uint32_t>(hash);
+        const uint32_t h2 = static_cast<uint32_t>(hash >> 32) | 1;
+        for (uint32_t i = 0; i < kHashCount; ++i) {
+            func(counters_[(h1 + i * h2) & (kSize - 1)]);
+        }
+    }
+
+    std::array<std::atomic<uint8_t>, kSize> counters_;
+};
+
+}  // namespace vvl
@@ -38,6 +38,8 @@
 #include <unordered_set>
 #endif
 
+#include "utils/allocator.h"
+
 #include <vulkan/utility/vk_concurrent_unordered_map.hpp>
 
 // namespace aliases to allow map and set implementations to easily be swapped out
@@ -97,11 +99,12 @@ struct insert_iterator {
 template <typename T>
 using hash = std::hash<T>;
 
+// robin_hood allocates with malloc and can't be given an allocator, the std containers go through vvl::allocator
 template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
-using unordered_set = std::unordered_set<Key, Hash, KeyEqual>;
+using unordered_set = std::unordered_set<Key, Hash, KeyEqual, vvl::Allocator<Key>>;
 
 template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
-using unordered_map = std::unordered_map<Key, T, Hash, KeyEqual>;
+using unordered_map = std::unordered_map<Key, T, Hash, KeyEqual, vvl::Allocator<std::pair<const Key, T>>>;
 
 template <typename Key, typename T>
 using map_entry = std::pair<Key, T>;
@@ -169,7 +172,10 @@ class small_vector {
         size_ = size;
     }
 
-    ~small_vector() { clear(); }
+    ~small_vector() {
+        clear();
+        FreeLargeStore();
+    }
 
     bool operator==(const small_vector &rhs) const {
         if (size_ != rhs.size_) return false;
@@ -293,7 +299,7 @@ class small_vector {
     void emplace_back(Args &&...args) {
         assert(size_ < kMaxCapacity);
         reserve(size_ + 1);
-        new (GetWorkingStore() + size_) value_type(args...);
+        new (GetWorkingStore() + size_) value_type(std::forward<Args>(args)...);
         size_++;
     }
 
@@ -331,13 +337,14 @@ class small_vector {
         // Since this can't shrink, if we're growing we're newing
         if (new_cap > capacity_) {
             assert(capacity_ >= kSmallCapacity);
-            auto new_store = std::unique_ptr<BackingStore[]>(new BackingStore[new_cap]);
+            BackingStore *new_store = AllocateLargeStore(new_cap);
             auto working_store = GetWorkingStore();
             for (size_type i = 0; i < size_; i++) {
                 new (new_store[i].data) value_type(std::move(working_store[i]));
                 working_store[i].~value_type();
             }
-            large_store_ = std::move(new_store);
+            FreeLargeStore();
+            large_store_ = new_store;
             assert(new_cap > kSmallCapacity);
             capacity_ = new_cap;
         }
@@ -369,26 +376,29 @@ class small_vector {
     void shrink_to_fit() {
         if (size_ == 0) {
             // shrink resets to small when empty
+            FreeLargeStore();
             capacity_ = kSmallCapacity;
-            large_store_.reset();
             UpdateWorkingStore();
         } else if ((capacity_ > kSmallCapacity) && (capacity_ > size_)) {
             auto source = GetWorkingStore();
             // Keep the source from disappearing until the end of the function
-            auto old_store = std::unique_ptr<BackingStore[]>(std::move(large_store_));
-            assert(!large_store_);
+            BackingStore *old_store = large_store_;
+            const size_type old_capacity = capacity_;
+            large_store_ = nullptr;
             if (size_ < kSmallCapacity) {
                 capacity_ = kSmallCapacity;
             } else {
-                large_store_ = std::unique_ptr<BackingStore[]>(new BackingStore[size_]);
+                large_store_ = AllocateLargeStore(size_);
                 capacity_ = size_;
             }
             UpdateWorkingStore();
             auto dest = GetWorkingStore();
             for (size_type i = 0; i < size_; i++) {
-                dest[i] = std::move(source[i]);
+                // dest is raw memory, construct rather than assign
+                new (dest + i) value_type(std::move(source[i]));
                 source[i].~value_type();
             }
+            FreeStore(old_store, old_capacity);
         }
     }
 
@@ -409,13 +419,13 @@ class small_vector {
     inline const_pointer ComputeWorkingStore() const {
         assert(large_store_ || (capacity_ == kSmallCapacity));
 
-        const BackingStore *store = large_store_ ? large_store_.get() : small_store_;
+        const BackingStore *store = large_store_ ? large_store_ : small_store_;
         return &store->object;
     }
     inline pointer ComputeWorkingStore() {
         assert(large_store_ || (capacity_ == kSmallCapacity));
 
-        BackingStore *store = large_store_ ? large_store_.get() : small_store_;
+        BackingStore *store = large_store_ ? large_store_ : small_store_;
         return &store->object;
     }
 
@@ -442,7 +452,8 @@ class small_vector {
     size_type size_;
     size_type capacity_;
     BackingStore small_store_[N];
-    std::unique_ptr<BackingStore[]> large_store_;
+    // Holds capacity_ elements when set
+    BackingStore *large_store_ = nullptr;
     value_type *working_store_;
 
 #ifndef NDEBUG
@@ -452,11 +463,27 @@ class small_vector {
 #endif
 
   private:
+    static BackingStore *AllocateLargeStore(size_type capacity) {
+        return static_cast<BackingStore *>(vvl::allocator::Allocate(sizeof(BackingStore) * capacity, alignof(BackingStore)));
+    }
+    static void FreeStore(BackingStore *store, size_type capacity) {
+        vvl::allocator::Free(store, sizeof(BackingStore) * capacity, alignof(BackingStore));
+    }
+    // Must be called before capacity_ changes
+    void FreeLargeStore() {
+        if (large_store_) {
+            FreeStore(large_store_, capacity_);
+            large_store_ = nullptr;
+        }
+    }
+
     void MoveLargeStore(small_vector &other) {
         assert(other.large_store_);
         assert(other.capacity_ > kSmallCapacity);
         // In move operations, from a small vector with a large store, we can move from it
-        large_store_ = std::move(other.large_store_);
+        FreeLargeStore();
+        large_store_ = other.large_store_;
+        other.large_store_ = nullptr;
         capacity_ = other.capacity_;
         size_ = other.size_;
         UpdateWorkingStore();
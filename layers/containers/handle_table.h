@@ -0,0 +1,290 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "utils/lock_profiling.h"
+
+namespace vvl {
+
+// Maps wrapped (unique) ids to driver handles.
+//
+// The wrapped id encodes where the value lives: the low 32 bits are a slot index and the high 32 bits are the
+// generation of that slot. Looking up an id is a couple of atomic loads and never takes a lock, which matters because
+// every API call with a non-dispatchable handle goes through Unwrap(). Insertion and removal are serialized by a mutex.
+//
+// Slots are reused after removal, the generation makes sure a stale id never aliases the new occupant of its slot.
+// Storage blocks are allocated on demand and are never released while the table is alive, so a reader racing with a
+// writer always touches valid memory.
+//
+// Once all kMaxSlots slots are in use, new ids get a slot index past kMaxSlots and their value is kept in a map
+// guarded by a lock instead. Only the ids handed out after the table filled up pay for it.
+class HandleTable {
+  public:
+    // Same shape as the FindResult of vku::concurrent::unordered_map so call sites can use it like an iterator
+    struct FindResult {
+        FindResult(bool a, uint64_t b) : result(a, b) {}
+        bool operator==(const FindResult &other) const { return result.first == other.result.first; }
+        bool operator!=(const FindResult &other) const { return result.first != other.result.first; }
+        std::pair<bool, uint64_t> *operator->() { return &result; }
+        const std::pair<bool, uint64_t> *operator->() const { return &result; }
+
+      private:
+        std::pair<bool, uint64_t> result;
+    };
+
+    HandleTable() : blocks_(std::make_unique<std::atomic<Block *>[]>(kMaxBlocks)) {
+        for (uint64_t i = 0; i < kMaxBlocks; ++i) {
+            blocks_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~HandleTable() {
+        for (uint64_t i = 0; i < kMaxBlocks; ++i) {
+            delete blocks_[i].load(std::memory_order_relaxed);
+        }
+    }
+    HandleTable(const HandleTable &) = delete;
+    HandleTable &operator=(const HandleTable &) = delete;
+
+    FindResult end() const { return FindResult(false, 0); }
+
+    // Stores value and returns the id that refers to it. The returned id is never 0.
+    uint64_t insert(uint64_t value) {
+        std::lock_guard<WriteLock> guard(write_lock_);
+        uint64_t id;
+        if (!free_ids_.empty()) {
+            id = NextGeneration(free_ids_.back());
+            free_ids_.pop_back();
+        } else {
+            if (next_slot_ >= kMaxSlots) {
+                return InsertOverflow(value);
+            }
+            const uint64_t slot = next_slot_++;
+            if ((slot & kBlockMask) == 0) {
+                blocks_[slot >> kBlockBits].store(new Block(), std::memory_order_release);
+            }
+            id = (uint64_t(1) << kGenerationShift) | slot;
+        }
+        Slot &entry = GetSlot(SlotIndex(id));
+        // value must be visible before the id is, find() validates the id on both sides of the value load
+        entry.value.store(value, std::memory_order_release);
+        entry.id.store(id, std::memory_order_release);
+        return id;
+    }
+
+    FindResult find(uint64_t id) const {
+        const uint64_t slot = SlotIndex(id);
+        if (slot >= kMaxSlots) return FindOverflow(id);
+        const Block *block = blocks_[slot >> kBlockBits].load(std::memory_order_acquire);
+        if (!block) return end();
+        const Slot &entry = block->slots[slot & kBlockMask];
+        if (entry.id.load(std::memory_order_acquire) != id) return end();
+        const uint64_t value = entry.value.load(std::memory_order_acquire);
+        // If the slot was released (and possibly reused) while reading value, the id no longer matches
+        if (entry.id.load(std::memory_order_acquire) != id) return end();
+        return FindResult(true, value);
+    }
+
+    // Removes id and returns the value it referred to
+    FindResult pop(uint64_t id) {
+        if (id == 0) return end();
+        std::lock_guard<WriteLock> guard(write_lock_);
+        if (!InTable(id)) return PopOverflow(id);
+        Slot *entry = FindSlot(id);
+        if (!entry) return end();
+        const uint64_t value = entry->value.load(std::memory_order_relaxed);
+        Release(*entry, id);
+        return FindResult(true, value);
+    }
+
+    bool erase(uint64_t id) {
+        if (id == 0) return false;
+        std::lock_guard<WriteLock> guard(write_lock_);
+        if (!InTable(id)) return PopOverflow(id) != end();
+        Slot *entry = FindSlot(id);
+        if (!entry) return false;
+        Release(*entry, id);
+        return true;
+    }
+
+    // False for the ids given out after the slots ran out, they have no slot in a HandleSlotArray either
+    static bool InTable(uint64_t id) { return SlotIndex(id) < kMaxSlots; }
+
+  private:
+    template <typename T>
+    friend class HandleSlotArray;
+
+    static constexpr uint32_t kGenerationShift = 32;
+    static constexpr uint32_t kBlockBits = 12;
+    static constexpr uint64_t kBlockSize = uint64_t(1) << kBlockBits;
+    static constexpr uint64_t kBlockMask = kBlockSize - 1;
+    static constexpr uint64_t kMaxBlocks = uint64_t(1) << 16;
+    static constexpr uint64_t kMaxSlots = kMaxBlocks * kBlockSize;
+    // Number of slot index values past kMaxSlots, the generation part of an overflow id counts how many times they wrapped
+    static constexpr uint64_t kOverflowSlots = (uint64_t(1) << kGenerationShift) - kMaxSlots;
+
+    struct Slot {
+        std::atomic<uint64_t> id{0};
+        std::atomic<uint64_t> value{0};
+    };
+    struct Block {
+        Slot slots[kBlockSize];
+    };
+
+    static uint64_t SlotIndex(uint64_t id) { return id & 0xFFFFFFFFull; }
+
+    static uint64_t NextGeneration(uint64_t id) {
+        uint32_t generation = uint32_t(id >> kGenerationShift) + 1;
+        // generation 0 is skipped so no id can ever be 0 (VK_NULL_HANDLE)
+        if (generation == 0) generation = 1;
+        return (uint64_t(generation) << kGenerationShift) | SlotIndex(id);
+    }
+
+    Slot &GetSlot(uint64_t slot) { return blocks_[slot >> kBlockBits].load(std::memory_order_relaxed)->slots[slot & kBlockMask]; }
+
+    // Caller must hold write_lock_
+    Slot *FindSlot(uint64_t id) {
+        const uint64_t slot = SlotIndex(id);
+        if (slot >= next_slot_) return nullptr;
+        Slot &entry = GetSlot(slot);
+        return (entry.id.load(std::memory_order_relaxed) == id) ? &entry : nullptr;
+    }
+
+    // Caller must hold write_lock_
+    void Release(Slot &entry, uint64_t id) {
+        entry.id.store(0, std::memory_order_release);
+        free_ids_.emplace_back(id);
+    }
+
+    // Caller must hold write_lock_
+    uint64_t InsertOverflow(uint64_t value) {
+        const uint64_t count = next_overflow_++;
+        const uint64_t id = ((count / kOverflowSlots + 1) << kGenerationShift) | (kMaxSlots + count % kOverflowSlots);
+        std::unique_lock<std::shared_mutex> guard(overflow_lock_);
+        overflow_.emplace(id, value);
+        return id;
+    }
+
+    FindResult FindOverflow(uint64_t id) const {
+        std::shared_lock<std::shared_mutex> guard(overflow_lock_);
+        auto it = overflow_.find(id);
+        return (it != overflow_.end()) ? FindResult(true, it->second) : end();
+    }
+
+    // Caller must hold write_lock_
+    FindResult PopOverflow(uint64_t id) {
+        std::unique_lock<std::shared_mutex> guard(overflow_lock_);
+        auto it = overflow_.find(id);
+        if (it == overflow_.end()) return end();
+        const uint64_t value = it->second;
+        overflow_.erase(it);
+        return FindResult(true, value);
+    }
+
+    // Every table (one per layer with handle wrapping on) adds to the same lock_profiling counters
+    using WriteLock = ProfiledMutex<std::mutex, ProfiledLock::HandleTable>;
+
+    std::unique_ptr<std::atomic<Block *>[]> blocks_;
+    WriteLock write_lock_;
+    uint64_t next_slot_ = 0;
+    std::vector<uint64_t> free_ids_;
+
+    // Overflow ids are never reused, they are only needed with more than kMaxSlots handles alive at once
+    mutable std::shared_mutex overflow_lock_;
+    std::unordered_map<uint64_t, uint64_t> overflow_;
+    uint64_t next_overflow_ = 0;
+};
+
+// Data kept next to the slots of a HandleTable, the data of an id lives at the slot index of that id so it is reached
+// without hashing.
+//
+// The array does not know which id occupies a slot, T has to record it if the caller needs to tell a stale id apart.
+// Like in HandleTable, blocks are allocated on first use and only released with the array, so a pointer returned by
+// Find() or Get() stays valid for the lifetime of the array.
+template <typename T>
+class HandleSlotArray {
+  public:
+    HandleSlotArray() : blocks_(std::make_unique<std::atomic<Block *>[]>(HandleTable::kMaxBlocks)) {
+        for (uint64_t i = 0; i < HandleTable::kMaxBlocks; ++i) {
+            blocks_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~HandleSlotArray() {
+        for (uint64_t i = 0; i < HandleTable::kMaxBlocks; ++i) {
+            delete blocks_[i].load(std::memory_order_relaxed);
+        }
+    }
+    HandleSlotArray(const HandleSlotArray &) = delete;
+    HandleSlotArray &operator=(const HandleSlotArray &) = delete;
+
+    // Returns nullptr if nothing was stored in the block of the slot of id yet, or if id has no slot (see InTable)
+    T *Find(uint64_t id) const {
+        const uint64_t slot = HandleTable::SlotIndex(id);
+        if (slot >= HandleTable::kMaxSlots) return nullptr;
+        Block *block = blocks_[slot >> HandleTable::kBlockBits].load(std::memory_order_acquire);
+        return block ? &block->slots[slot & HandleTable::kBlockMask] : nullptr;
+    }
+
+    // id must come from a HandleTable and be InTable(), the block of its slot is allocated if needed
+    T &Get(uint64_t id) {
+        const uint64_t slot = HandleTable::SlotIndex(id);
+        assert(HandleTable::InTable(id));
+        std::atomic<Block *> &block_ptr = blocks_[slot >> HandleTable::kBlockBits];
+        Block *block = block_ptr.load(std::memory_order_acquire);
+        if (!block) {
+            Block *new_block = new Block();
+            if (block_ptr.compare_exchange_strong(block, new_block, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                block = new_block;
+            } else {
+                // Another thread allocated it first, block now holds its pointer
+                delete new_block;
+            }
+        }
+        return block->slots[slot & HandleTable::kBlockMask];
+    }
+
+    // Calls fn(T &) for every slot of the allocated blocks, including the ones never used
+    template <typename Fn>
+    void ForEach(Fn &&fn) const {
+        for (uint64_t i = 0; i < HandleTable::kMaxBlocks; ++i) {
+            if (Block *block = blocks_[i].load(std::memory_order_acquire)) {
+                for (T &slot : block->slots) {
+                    fn(slot);
+                }
+            }
+        }
+    }
+
+  private:
+    struct Block {
+        T slots[HandleTable::kBlockSize];
+    };
+
+    std::unique_ptr<std::atomic<Block *>[]> blocks_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,214 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Map from small uint32_t keys (vertex binding numbers, locations...) stored in a vector indexed by the key, with the
+// interface of the unordered_map it replaces.
+//
+// The keys are bounded by small device limits, so find() is an index and iteration is a linear scan in key order, with no
+// hashing. Keys of kMaxDenseKey or more can only come from an invalid application and are kept in a small overflow list,
+// so a huge key does not allocate a huge table. Inserting can move the values, like a rehash.
+template <typename T, uint32_t kMaxDenseKey = 256>
+class IndexMap {
+  public:
+    using key_type = uint32_t;
+    using mapped_type = T;
+    using value_type = std::pair<const uint32_t, T>;
+    using size_type = size_t;
+
+  private:
+    using Slot = std::optional<value_type>;
+
+    template <bool kIsConst>
+    class Iterator {
+        using Map = std::conditional_t<kIsConst, const IndexMap, IndexMap>;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = IndexMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<kIsConst, const value_type *, value_type *>;
+        using reference = std::conditional_t<kIsConst, const value_type &, value_type &>;
+
+        Iterator() = default;
+        Iterator(Map *map, size_t pos) : map_(map), pos_(pos) { SkipEmpty(); }
+        // iterator converts to const_iterator
+        template <bool kOtherConst, typename = std::enable_if_t<kIsConst && !kOtherConst>>
+        Iterator(const Iterator<kOtherConst> &other) : map_(other.map_), pos_(other.pos_) {}
+
+        reference operator*() const { return *map_->SlotAt(pos_); }
+        pointer operator->() const { return &*map_->SlotAt(pos_); }
+        Iterator &operator++() {
+            ++pos_;
+            SkipEmpty();
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+        bool operator==(const Iterator &other) const { return pos_ == other.pos_; }
+        bool operator!=(const Iterator &other) const { return pos_ != other.pos_; }
+
+      private:
+        friend class IndexMap;
+        template <bool>
+        friend class Iterator;
+
+        void SkipEmpty() {
+            const size_t end = map_->SlotCount();
+            while (pos_ < end && !map_->SlotAt(pos_).has_value()) {
+                ++pos_;
+            }
+        }
+
+        Map *map_ = nullptr;
+        // Index in dense_, then in overflow_
+        size_t pos_ = 0;
+    };
+
+  public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    IndexMap() = default;
+    IndexMap(const IndexMap &) = default;
+    IndexMap(IndexMap &&) noexcept = default;
+    // The key is const in the slots, as in a map, so slots can't be assigned one by one
+    IndexMap &operator=(IndexMap other) noexcept {
+        dense_.swap(other.dense_);
+        overflow_.swap(other.overflow_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, SlotCount()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, SlotCount()); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+
+    void clear() {
+        dense_.clear();
+        overflow_.clear();
+        size_ = 0;
+    }
+
+    iterator find(uint32_t key) {
+        const size_t pos = Position(key);
+        return pos == kNotFound ? end() : iterator(this, pos);
+    }
+    const_iterator find(uint32_t key) const {
+        const size_t pos = Position(key);
+        return pos == kNotFound ? end() : const_iterator(this, pos);
+    }
+    size_type count(uint32_t key) const { return Position(key) == kNotFound ? 0 : 1; }
+    bool contains(uint32_t key) const { return Position(key) != kNotFound; }
+
+    // Like unordered_map, does nothing if the key is already in the map
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(uint32_t key, Args &&...args) {
+        const size_t found = Position(key);
+        if (found != kNotFound) {
+            return {iterator(this, found), false};
+        }
+        const size_t pos = EmptySlot(key);
+        SlotAt(pos).emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+        ++size_;
+        return {iterator(this, pos), true};
+    }
+
+    template <typename Value>
+    std::pair<iterator, bool> insert_or_assign(uint32_t key, Value &&value) {
+        const size_t found = Position(key);
+        if (found != kNotFound) {
+            SlotAt(found)->second = std::forward<Value>(value);
+            return {iterator(this, found), false};
+        }
+        return emplace(key, std::forward<Value>(value));
+    }
+
+    size_type erase(uint32_t key) {
+        const size_t pos = Position(key);
+        if (pos == kNotFound) {
+            return 0;
+        }
+        SlotAt(pos).reset();
+        --size_;
+        return 1;
+    }
+
+  private:
+    static constexpr size_t kNotFound = ~size_t(0);
+
+    size_t SlotCount() const { return dense_.size() + overflow_.size(); }
+    Slot &SlotAt(size_t pos) { return pos < dense_.size() ? dense_[pos] : overflow_[pos - dense_.size()]; }
+    const Slot &SlotAt(size_t pos) const { return pos < dense_.size() ? dense_[pos] : overflow_[pos - dense_.size()]; }
+
+    size_t Position(uint32_t key) const {
+        if (key < kMaxDenseKey) {
+            return (key < dense_.size() && dense_[key].has_value()) ? key : kNotFound;
+        }
+        for (size_t i = 0; i < overflow_.size(); ++i) {
+            if (overflow_[i].has_value() && overflow_[i]->first == key) {
+                return dense_.size() + i;
+            }
+        }
+        return kNotFound;
+    }
+
+    // Position of the empty slot for a key not in the map
+    size_t EmptySlot(uint32_t key) {
+        if (key < kMaxDenseKey) {
+            if (key >= dense_.size()) {
+                dense_.resize(key + 1);
+            }
+            return key;
+        }
+        for (size_t i = 0; i < overflow_.size(); ++i) {
+            if (!overflow_[i].has_value()) {
+                return dense_.size() + i;
+            }
+        }
+        overflow_.emplace_back();
+        return dense_.size() + overflow_.size() - 1;
+    }
+
+    std::vector<Slot> dense_;
+    std::vector<Slot> overflow_;
+    size_t size_ = 0;
+};
+
+}  // namespace vvl
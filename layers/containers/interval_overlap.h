@@ -0,0 +1,83 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// The half open range [begin, end) one region covers along the axis being swept, index is the position of the region
+struct TaggedInterval {
+    int64_t begin;
+    int64_t end;
+    uint32_t index;
+};
+
+// Calls on_overlap(a_index, b_index) for every interval of a intersecting an interval of b, in increasing (a_index, b_index)
+// order, the same order two nested loops over the regions would find them. Empty intervals never intersect anything.
+//
+// Both lists are sorted and swept together, each interval is only compared with the still open intervals of the other list,
+// so disjoint regions cost O(n log n) instead of checking every pair. The lists are reordered.
+template <typename Callback>
+void ForEachIntersectingPair(std::vector<TaggedInterval> &a, std::vector<TaggedInterval> &b, Callback &&on_overlap) {
+    const auto by_begin = [](const TaggedInterval &lhs, const TaggedInterval &rhs) { return lhs.begin < rhs.begin; };
+    const auto is_empty = [](const TaggedInterval &interval) { return interval.end <= interval.begin; };
+    a.erase(std::remove_if(a.begin(), a.end(), is_empty), a.end());
+    b.erase(std::remove_if(b.begin(), b.end(), is_empty), b.end());
+    std::sort(a.begin(), a.end(), by_begin);
+    std::sort(b.begin(), b.end(), by_begin);
+
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    std::vector<const TaggedInterval *> open_a;
+    std::vector<const TaggedInterval *> open_b;
+    // Drops the intervals ending before begin, as begins only grow they can't intersect anything that comes later
+    const auto close_before = [](std::vector<const TaggedInterval *> &open, int64_t begin) {
+        const auto closed = [begin](const TaggedInterval *interval) { return interval->end <= begin; };
+        open.erase(std::remove_if(open.begin(), open.end(), closed), open.end());
+    };
+
+    size_t a_i = 0;
+    size_t b_i = 0;
+    while (a_i < a.size() || b_i < b.size()) {
+        if (b_i == b.size() || (a_i < a.size() && a[a_i].begin <= b[b_i].begin)) {
+            const TaggedInterval &interval = a[a_i++];
+            close_before(open_b, interval.begin);
+            for (const TaggedInterval *other : open_b) {
+                pairs.emplace_back(interval.index, other->index);
+            }
+            open_a.emplace_back(&interval);
+        } else {
+            const TaggedInterval &interval = b[b_i++];
+            close_before(open_a, interval.begin);
+            for (const TaggedInterval *other : open_a) {
+                pairs.emplace_back(other->index, interval.index);
+            }
+            open_b.emplace_back(&interval);
+        }
+    }
+
+    std::sort(pairs.begin(), pairs.end());
+    for (const auto &[a_index, b_index] : pairs) {
+        on_overlap(a_index, b_index);
+    }
+}
+
+}  // namespace vvl
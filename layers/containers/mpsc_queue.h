@@ -0,0 +1,79 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace vvl {
+
+// Unbounded multiple producers, single consumer queue.
+//
+// Push() is lock free (one atomic exchange), any number of threads can push at the same time. Only one thread at a time can
+// pop. Values come out in the order their Push() did the exchange, so the values pushed by one thread stay in order.
+template <typename T>
+class MpscQueue {
+  public:
+    MpscQueue() : head_(new Node()), tail_(head_.load(std::memory_order_relaxed)) {}
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    ~MpscQueue() {
+        while (TryPop()) {
+        }
+        delete tail_;
+    }
+
+    void Push(T value) {
+        Node *node = new Node();
+        node->value.emplace(std::move(value));
+        Node *prev = head_.exchange(node, std::memory_order_acq_rel);
+        // Until this store the newer nodes can't be reached from the consumer side
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Consumer side. Returns nothing when the queue is empty, which includes the short time a producer spends between the two
+    // steps of Push(), the caller has to try again if it knows a value is coming.
+    std::optional<T> TryPop() {
+        Node *tail = tail_;
+        Node *next = tail->next.load(std::memory_order_acquire);
+        if (!next) {
+            return std::nullopt;
+        }
+        std::optional<T> value = std::move(next->value);
+        next->value.reset();
+        // next is now the empty node the queue always keeps at its tail
+        tail_ = next;
+        delete tail;
+        return value;
+    }
+
+  private:
+    struct Node {
+        std::atomic<Node *> next{nullptr};
+        std::optional<T> value;
+    };
+
+    // Last pushed node
+    std::atomic<Node *> head_;
+    // Empty node before the oldest value, only used by the consumer
+    Node *tail_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,263 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "utils/allocator.h"
+#include "utils/memory_accounting.h"
+
+namespace vvl {
+
+// Memory for the nodes of a node based container, like the std::map behind sparse_container::range_map.
+//
+// Nodes are carved out of blocks that grow geometrically, so nodes inserted one after the other end up next to each other in
+// memory and an insertion does not go to the global allocator. Freed nodes are reused by the next insertions, and all the
+// memory is given back when the last node is freed. Only one node size is pooled (the first one asked for), anything else is
+// passed through to vvl::allocator, like the blocks.
+//
+// The blocks and the passed through allocations are counted under the tag of the pool (see memory_accounting).
+//
+// Not thread safe, it is meant to be used by a single container which is not thread safe either.
+class NodePool {
+  public:
+    // With release_when_empty false the blocks are kept once the last node is freed, for pools where a few nodes come and go
+    explicit NodePool(bool release_when_empty = true, MemoryTag tag = MemoryTag::Other)
+        : release_when_empty_(release_when_empty), tag_(tag) {}
+    ~NodePool() {
+        ReleaseBlocks();
+        memory_accounting::Free(tag_, block_bytes_);
+    }
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    void *Allocate(size_t size, size_t alignment) {
+        if (node_size_ == 0 && alignment <= alignof(std::max_align_t)) {
+            // Every node has to be able to hold the free list link and stay aligned inside a block
+            node_size_ = std::max(size, sizeof(FreeNode));
+            node_size_ = (node_size_ + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+            requested_size_ = size;
+        }
+        if (size != requested_size_ || alignment > alignof(std::max_align_t)) {
+            memory_accounting::Allocate(tag_, size);
+            return allocator::Allocate(size);
+        }
+
+        ++live_count_;
+        if (free_list_) {
+            FreeNode *node = free_list_;
+            free_list_ = node->next;
+            return node;
+        }
+        if (block_offset_ == block_capacity_) {
+            block_capacity_ = std::min<size_t>(kFirstBlockNodes << blocks_.size(), kMaxBlockNodes);
+            const size_t block_size = block_capacity_ * node_size_;
+            blocks_.emplace_back(Block{static_cast<std::byte *>(allocator::Allocate(block_size)), block_size});
+            block_offset_ = 0;
+            block_bytes_ += block_size;
+            memory_accounting::Allocate(tag_, block_size);
+        }
+        return blocks_.back().data + (block_offset_++ * node_size_);
+    }
+
+    void Deallocate(void *p, size_t size) {
+        if (size != requested_size_) {
+            memory_accounting::Free(tag_, size);
+            allocator::Free(p, size);
+            return;
+        }
+        FreeNode *node = static_cast<FreeNode *>(p);
+        node->next = free_list_;
+        free_list_ = node;
+        if (--live_count_ == 0 && release_when_empty_) {
+            // Container is empty, don't hold on to the memory of its largest size
+            ReleaseBlocks();
+            memory_accounting::Free(tag_, block_bytes_);
+            block_bytes_ = 0;
+            free_list_ = nullptr;
+            block_offset_ = 0;
+            block_capacity_ = 0;
+        }
+    }
+
+    size_t BlockCount() const { return blocks_.size(); }
+
+  private:
+    struct FreeNode {
+        FreeNode *next;
+    };
+    struct Block {
+        std::byte *data;
+        size_t size;
+    };
+    void ReleaseBlocks() {
+        for (const Block &block : blocks_) {
+            allocator::Free(block.data, block.size);
+        }
+        blocks_.clear();
+    }
+
+    static constexpr size_t kFirstBlockNodes = 16;
+    static constexpr size_t kMaxBlockNodes = 1024;
+
+    const bool release_when_empty_;
+    const MemoryTag tag_;
+    size_t requested_size_ = 0;
+    size_t node_size_ = 0;
+    size_t live_count_ = 0;
+    FreeNode *free_list_ = nullptr;
+    std::vector<Block> blocks_;
+    size_t block_offset_ = 0;
+    size_t block_capacity_ = 0;
+    size_t block_bytes_ = 0;
+};
+
+// Allocator giving each container its own NodePool. A copied container gets a new pool, copies of the allocator itself (like the
+// ones a container rebinds to its node type, or the one a moved from container keeps) share the pool.
+template <typename T, MemoryTag kTag = MemoryTag::Other>
+class NodePoolAllocator {
+  public:
+    using value_type = T;
+    template <typename U>
+    struct rebind {
+        using other = NodePoolAllocator<U, kTag>;
+    };
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    NodePoolAllocator() : pool_(std::make_shared<NodePool>(true, kTag)) {}
+    NodePoolAllocator(const NodePoolAllocator &other) noexcept : pool_(other.pool_) {}
+    template <typename U>
+    NodePoolAllocator(const NodePoolAllocator<U, kTag> &other) noexcept : pool_(other.pool_) {}
+    NodePoolAllocator &operator=(const NodePoolAllocator &other) noexcept {
+        pool_ = other.pool_;
+        return *this;
+    }
+
+    NodePoolAllocator select_on_container_copy_construction() const { return NodePoolAllocator(); }
+
+    T *allocate(size_t n) {
+        if (n == 1) {
+            return static_cast<T *>(pool_->Allocate(sizeof(T), alignof(T)));
+        }
+        return Allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, size_t n) {
+        if (n == 1) {
+            pool_->Deallocate(p, sizeof(T));
+        } else {
+            Allocator<T>().deallocate(p, n);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const NodePoolAllocator<U, kTag> &other) const {
+        return pool_ == other.pool_;
+    }
+    template <typename U>
+    bool operator!=(const NodePoolAllocator<U, kTag> &other) const {
+        return pool_ != other.pool_;
+    }
+
+    const NodePool &pool() const { return *pool_; }
+
+  private:
+    template <typename U, MemoryTag>
+    friend class NodePoolAllocator;
+    std::shared_ptr<NodePool> pool_;
+};
+
+// Thread safe NodePool, shared by every TypedPoolAllocator<T> of one T
+class ConcurrentNodePool {
+  public:
+    explicit ConcurrentNodePool(MemoryTag tag) : pool_(false, tag) {}
+
+    void *Allocate(size_t size, size_t alignment) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return pool_.Allocate(size, alignment);
+    }
+    void Deallocate(void *p, size_t size) {
+        std::lock_guard<std::mutex> guard(lock_);
+        pool_.Deallocate(p, size);
+    }
+    size_t BlockCount() const {
+        std::lock_guard<std::mutex> guard(lock_);
+        return pool_.BlockCount();
+    }
+
+  private:
+    mutable std::mutex lock_;
+    NodePool pool_;
+};
+
+// Stateless allocator with one process wide pool per type, for objects which are created and destroyed all the time from any
+// thread (like the state objects of per frame buffer views or descriptor sets). With std::allocate_shared the allocator is
+// rebound to the control block type, so the object and its reference counts come from a pool holding only that size.
+// When vvl::allocator already caches per thread, the lock of the shared pool would only add contention and it is skipped.
+template <typename T>
+class TypedPoolAllocator {
+  public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    TypedPoolAllocator() noexcept = default;
+    template <typename U>
+    TypedPoolAllocator(const TypedPoolAllocator<U> &) noexcept {}
+
+    T *allocate(size_t n) {
+        if (n == 1 && !allocator::kCachesPerThread) {
+            return static_cast<T *>(Pool().Allocate(sizeof(T), alignof(T)));
+        }
+        return Allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, size_t n) {
+        if (n == 1 && !allocator::kCachesPerThread) {
+            Pool().Deallocate(p, sizeof(T));
+        } else {
+            Allocator<T>().deallocate(p, n);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const TypedPoolAllocator<U> &) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const TypedPoolAllocator<U> &) const {
+        return false;
+    }
+
+    static ConcurrentNodePool &Pool() {
+        // Never destroyed, objects can outlive the static destructors (like state freed by a layer being unloaded)
+        static ConcurrentNodePool *pool = new ConcurrentNodePool(MemoryTag::StateObjects);
+        return *pool;
+    }
+};
+
+}  // namespace vvl
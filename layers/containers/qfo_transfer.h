@@ -17,8 +17,13 @@
  * limitations under the License.
  */
 #pragma once
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 #include "custom_containers.h"
 #include "sync/sync_utils.h"
+#include "utils/cast_utils.h"
 #include "utils/hash_util.h"
 
 // Types to store queue family ownership (QFO) Transfers
@@ -54,6 +59,9 @@ struct QFOTransferBarrierBase {
         return (srcQueueFamilyIndex == rhs.srcQueueFamilyIndex) && (dstQueueFamilyIndex == rhs.dstQueueFamilyIndex) &&
                (handle == rhs.handle);
     }
+
+    // Orders by resource first, so all the barriers of one resource are adjacent once sorted
+    auto base_tie() const { return std::make_tuple(CastToUint64(handle), srcQueueFamilyIndex, dstQueueFamilyIndex); }
 };
 
 // Image barrier specific implementation
@@ -80,6 +88,15 @@ struct QFOImageTransferBarrier : public QFOTransferBarrierBase<VkImage> {
         // Ignoring layout w.r.t. equality. See comment in hash above.
         return (static_cast<BaseType>(*this) == static_cast<BaseType>(rhs)) && (subresourceRange == rhs.subresourceRange);
     }
+    // Consistent with operator==, layouts are ignored
+    bool operator<(const QFOImageTransferBarrier &rhs) const {
+        const auto &range = subresourceRange;
+        const auto &rhs_range = rhs.subresourceRange;
+        return std::tuple_cat(base_tie(), std::tie(range.aspectMask, range.baseMipLevel, range.levelCount, range.baseArrayLayer,
+                                                   range.layerCount)) <
+               std::tuple_cat(rhs.base_tie(), std::tie(rhs_range.aspectMask, rhs_range.baseMipLevel, rhs_range.levelCount,
+                                                       rhs_range.baseArrayLayer, rhs_range.layerCount));
+    }
     // TODO: codegen a comprehensive complie time type -> string (and or other traits) template family
     static const char *BarrierName() { return "VkImageMemoryBarrier"; }
     static const char *HandleName() { return "VkImage"; }
@@ -111,6 +128,9 @@ struct QFOBufferTransferBarrier : public QFOTransferBarrierBase<VkBuffer> {
     bool operator==(const QFOBufferTransferBarrier &rhs) const {
         return (static_cast<BaseType>(*this) == static_cast<BaseType>(rhs)) && (offset == rhs.offset) && (size == rhs.size);
     }
+    bool operator<(const QFOBufferTransferBarrier &rhs) const {
+        return std::tuple_cat(base_tie(), std::tie(offset, size)) < std::tuple_cat(rhs.base_tie(), std::tie(rhs.offset, rhs.size));
+    }
     static const char *BarrierName() { return "VkBufferMemoryBarrier"; }
     static const char *HandleName() { return "VkBuffer"; }
     // QFO transfer buffer barrier must not duplicate QFO recorded in command buffer
@@ -140,10 +160,53 @@ struct QFOTransferBarrierSets {
     }
 };
 
+// The barriers of a command buffer set in resource order, the barriers of one resource end up adjacent and sorted
+template <typename TransferBarrier>
+std::vector<const TransferBarrier *> SortedQFOTransferBarriers(const QFOTransferBarrierSet<TransferBarrier> &set) {
+    std::vector<const TransferBarrier *> sorted;
+    sorted.reserve(set.size());
+    for (const TransferBarrier &barrier : set) {
+        sorted.emplace_back(&barrier);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const TransferBarrier *lhs, const TransferBarrier *rhs) { return *lhs < *rhs; });
+    return sorted;
+}
+
+// Pending release barriers of one resource, kept sorted. A resource rarely has more than one release in flight, which is
+// stored inline so copying the list out of the global map does not allocate.
+template <typename TransferBarrier>
+class QFOTransferBarrierList {
+  public:
+    const TransferBarrier *Find(const TransferBarrier &barrier) const {
+        const auto it = std::lower_bound(barriers_.begin(), barriers_.end(), barrier);
+        return (it != barriers_.end() && *it == barrier) ? &(*it) : nullptr;
+    }
+    void Insert(const TransferBarrier &barrier) {
+        const auto it = std::lower_bound(barriers_.begin(), barriers_.end(), barrier);
+        if (it != barriers_.end() && *it == barrier) {
+            return;
+        }
+        const auto pos = it - barriers_.begin();
+        barriers_.emplace_back(barrier);
+        std::rotate(barriers_.begin() + pos, barriers_.end() - 1, barriers_.end());
+    }
+    void Erase(const TransferBarrier &barrier) {
+        const auto it = std::lower_bound(barriers_.begin(), barriers_.end(), barrier);
+        if (it != barriers_.end() && *it == barrier) {
+            std::move(it + 1, barriers_.end(), it);
+            barriers_.resize(barriers_.size() - 1);
+        }
+    }
+    bool empty() const { return barriers_.empty(); }
+
+  private:
+    small_vector<TransferBarrier, 1, uint32_t> barriers_;
+};
+
 // The layer_data stores the map of pending release barriers
 template <typename TransferBarrier>
 using GlobalQFOTransferBarrierMap =
-    vvl::concurrent_unordered_map<typename TransferBarrier::HandleType, QFOTransferBarrierSet<TransferBarrier>>;
+    vvl::concurrent_unordered_map<typename TransferBarrier::HandleType, QFOTransferBarrierList<TransferBarrier>>;
 
 // Submit queue uses the Scoreboard to track all release/acquire operations in a batch.
 template <typename TransferBarrier>
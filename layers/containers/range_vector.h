@@ -29,6 +29,7 @@
 #include <utility>
 #include <cstdint>
 #include "custom_containers.h"
+#include "node_pool_allocator.h"
 
 #define RANGE_ASSERT(b) assert(b)
 
@@ -751,6 +752,14 @@ class range_map {
     const ImplMap &get_implementation_map() const { return impl_map_; }
 };
 
+// range_map on a std::map whose nodes come from a per map pool (see vvl::NodePoolAllocator), for the large, frequently updated
+// maps where the node allocations dominate. Iterators stay valid across inserts and erases exactly as with the default ImplMap.
+// The pools are counted under kTag.
+template <typename Key, typename T, typename RangeKey = range<Key>, vvl::MemoryTag kTag = vvl::MemoryTag::Other>
+using pooled_range_map =
+    range_map<Key, T, RangeKey,
+              std::map<RangeKey, T, std::less<RangeKey>, vvl::NodePoolAllocator<std::pair<const RangeKey, T>, kTag>>>;
+
 template <typename Container>
 using const_correct_iterator = decltype(std::declval<Container>().begin());
 
@@ -1099,7 +1108,7 @@ class small_range_map {
         RANGE_ASSERT(first_pos <= last_pos);
         const SmallRange clear_me(first_pos, last_pos);
         if (!clear_me.empty()) {
-            const SmallRange empty_range(find_empty_left(clear_me), last_pos);
+            const SmallRange empty_range(find_inuse_left(clear_me), last_pos);
             clear_and_set_range(empty_range.begin, empty_range.end, make_invalid_range(empty_range));
         }
         return iterator(this, last_pos);
@@ -1993,14 +2002,14 @@ bool update_range_value(Map &map, const Range &range, MapValue &&value, value_pr
     return updated;
 }
 
-//  combines directly adjacent ranges with equal RangeMap::mapped_type .
-template <typename RangeMap>
-void consolidate(RangeMap &map) {
+// Combines directly adjacent ranges with equal RangeMap::mapped_type, for the runs starting at current up to the ones starting at
+// limit
+template <typename RangeMap, typename Index = typename RangeMap::key_type::index_type>
+void consolidate_runs(RangeMap &map, typename RangeMap::iterator current, const Index &limit) {
     using Value = typename RangeMap::value_type;
     using Key = typename RangeMap::key_type;
     using It = typename RangeMap::iterator;
 
-    It current = map.begin();
     const It map_end = map.end();
 
     // To be included in a merge range there must be no gap in the Key space, and the mapped_type values must match
@@ -2008,7 +2017,7 @@ void consolidate(RangeMap &map) {
         return cur->first.begin == last->first.end && cur->second == last->second;
     };
 
-    while (current != map_end) {
+    while (current != map_end && current->first.begin <= limit) {
         // Establish a trival merge range at the current location, advancing current. Merge range is inclusive of merge_last
         const It merge_first = current;
         It merge_last = current;
@@ -2032,6 +2041,26 @@ void consolidate(RangeMap &map) {
     }
 }
 
+//  combines directly adjacent ranges with equal RangeMap::mapped_type .
+template <typename RangeMap>
+void consolidate(RangeMap &map) {
+    using Index = typename RangeMap::key_type::index_type;
+    consolidate_runs(map, map.begin(), std::numeric_limits<Index>::max());
+}
+
+// Same as consolidate, limited to the ranges intersecting or touching range. Cheap enough to run after each update of range, so
+// the map does not fragment the way it does when the equal values are only merged at a later consolidate.
+template <typename RangeMap>
+void consolidate(RangeMap &map, const typename RangeMap::key_type &range) {
+    using Key = typename RangeMap::key_type;
+    if (range.empty()) {
+        return;
+    }
+    // Start at the range containing range.begin - 1, which can merge with the first range updated
+    const auto first_index = (range.begin > 0) ? range.begin - 1 : range.begin;
+    consolidate_runs(map, map.lower_bound(Key(first_index, first_index + 1)), range.end);
+}
+
 }  // namespace sparse_container
 
 // Returns the intersection of the ranges [x, x + x_size) and [y, y + y_size)
@@ -18,6 +18,7 @@
  * John Zulauf <jzulauf@lunarg.com>
  *
  */
+#include <algorithm>
 #include <cassert>
 #include <vulkan/utility/vk_format_utils.h>
 
@@ -25,6 +26,7 @@
 #include <cmath>
 #include "state_tracker/image_state.h"
 #include "generated/layer_chassis_dispatch.h"
+#include "utils/hash_util.h"
 
 namespace subresource_adapter {
 Subresource::Subresource(const RangeEncoder& encoder, const VkImageSubresource& subres)
@@ -269,6 +271,44 @@ RangeGenerator& RangeGenerator::operator++() {
     return *this;
 }
 
+uint32_t RangeGenerator::MaxRangeCount(const RangeEncoder& encoder, const VkImageSubresourceRange& subres_range) {
+    return encoder.Limits().aspect_index * subres_range.levelCount;
+}
+
+uint32_t RangeGenerator::GenerateRanges(const RangeEncoder& encoder, const VkImageSubresourceRange& subres_range,
+                                        IndexRange* ranges) {
+    assert(IsValid(encoder, subres_range));
+    const auto& limits = encoder.Limits();
+    const IndexType mip_size = encoder.MipSize();
+    uint32_t count = 0;
+
+    if (subres_range.baseArrayLayer == 0 && subres_range.layerCount == limits.arrayLayer) {
+        // The selected mips of an aspect are contiguous, one range per aspect, merged with the previous aspect when adjacent
+        const IndexType mips_offset = subres_range.baseMipLevel * mip_size;
+        const IndexType mips_size = subres_range.levelCount * mip_size;
+        for (uint32_t aspect_index = 0; aspect_index < limits.aspect_index; ++aspect_index) {
+            if ((subres_range.aspectMask & encoder.AspectBit(aspect_index)) == 0) continue;
+            const IndexType begin = encoder.AspectBase(aspect_index) + mips_offset;
+            if (count > 0 && ranges[count - 1].end == begin) {
+                ranges[count - 1].end = begin + mips_size;
+            } else {
+                ranges[count++] = IndexRange(begin, begin + mips_size);
+            }
+        }
+        return count;
+    }
+
+    // A range per selected mip of each selected aspect, no two of them touch
+    for (uint32_t aspect_index = 0; aspect_index < limits.aspect_index; ++aspect_index) {
+        if ((subres_range.aspectMask & encoder.AspectBit(aspect_index)) == 0) continue;
+        IndexType begin = encoder.AspectBase(aspect_index) + subres_range.baseMipLevel * mip_size + subres_range.baseArrayLayer;
+        for (uint32_t mip = 0; mip < subres_range.levelCount; ++mip, begin += mip_size) {
+            ranges[count++] = IndexRange(begin, begin + subres_range.layerCount);
+        }
+    }
+    return count;
+}
+
 ImageRangeEncoder::ImageRangeEncoder(const vvl::Image& image)
     : ImageRangeEncoder(image, AspectParameters::Get(image.full_range.aspectMask)) {}
 
@@ -877,6 +917,50 @@ ImageRangeEncoder::SubresInfo::SubresInfo(const SubresInfo&rhs)
       z_step_pitch(rhs.z_step_pitch),
       layer_span(rhs.layer_span) {}
 
+ImageRangeEncoderCache::Key::Key(const vvl::Image& image)
+    : flags(image.create_info.flags),
+      image_type(image.create_info.imageType),
+      format(image.create_info.format),
+      extent(image.create_info.extent),
+      mip_levels(image.full_range.levelCount),
+      array_layers(image.full_range.layerCount),
+      aspect_mask(image.full_range.aspectMask) {}
+
+bool ImageRangeEncoderCache::Key::operator==(const Key& rhs) const {
+    return flags == rhs.flags && image_type == rhs.image_type && format == rhs.format && extent.width == rhs.extent.width &&
+           extent.height == rhs.extent.height && extent.depth == rhs.extent.depth && mip_levels == rhs.mip_levels &&
+           array_layers == rhs.array_layers && aspect_mask == rhs.aspect_mask;
+}
+
+size_t ImageRangeEncoderCache::Key::Hash::operator()(const Key& key) const {
+    hash_util::HashCombiner hc;
+    hc << key.flags << key.image_type << key.format << key.extent.width << key.extent.height << key.extent.depth
+       << key.mip_levels << key.array_layers << key.aspect_mask;
+    return hc.Value();
+}
+
+std::shared_ptr<const ImageRangeEncoder> ImageRangeEncoderCache::Get(const vvl::Image& image) {
+    if (image.create_info.tiling == VK_IMAGE_TILING_LINEAR) {
+        return std::make_shared<const ImageRangeEncoder>(image);
+    }
+    const Key key(image);
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto& entry = entries_[key];
+    if (auto encoder = entry.lock()) {
+        return encoder;
+    }
+    auto encoder = std::make_shared<const ImageRangeEncoder>(image);
+    entry = encoder;
+    // Drop the entries of the encoders nobody uses anymore once in a while, so the map doesn't grow with every image ever made
+    if (entries_.size() > 2 * live_entries_hint_) {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            it = it->second.expired() ? entries_.erase(it) : std::next(it);
+        }
+        live_entries_hint_ = std::max<size_t>(entries_.size(), kMinPruneSize);
+    }
+    return encoder;
+}
+
 void ImageRangeGenerator::IncrementerState::Set(uint32_t y_count_, uint32_t layer_z_count_, IndexType base, IndexType span,
                                                 IndexType y_step, IndexType z_step) {
     y_count = y_count_;
@@ -20,6 +20,8 @@
  */
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <vector>
 #include "range_vector.h"
 #include "custom_containers.h"
@@ -334,6 +336,12 @@ class RangeGenerator {
     Subresource& GetSubresource() { return isr_pos_; }
     RangeGenerator& operator++();
 
+    // Bulk alternative to stepping a generator: writes every index range of subres_range to ranges in increasing order and returns
+    // how many were written. ranges must hold at least MaxRangeCount() entries. Ranges that touch are merged, so when all array
+    // layers are selected each aspect produces a single range, and a full image a single one.
+    static uint32_t MaxRangeCount(const RangeEncoder& encoder, const VkImageSubresourceRange& subres_range);
+    static uint32_t GenerateRanges(const RangeEncoder& encoder, const VkImageSubresourceRange& subres_range, IndexRange* ranges);
+
   private:
     const RangeEncoder* encoder_;
     SubresourceGenerator isr_pos_;
@@ -401,6 +409,38 @@ class ImageRangeEncoder : public RangeEncoder {
     bool is_compressed_;
 };
 
+// The fragment encoder of an optimal tiling image only depends on a few create info fields, and applications create many images
+// with the same ones. The cache hands out one shared, immutable encoder per distinct set of fields and forgets it once the last
+// image using it is gone. Linear images query their layouts from the driver, each of them gets its own encoder.
+class ImageRangeEncoderCache {
+  public:
+    std::shared_ptr<const ImageRangeEncoder> Get(const vvl::Image& image);
+
+  private:
+    struct Key {
+        VkImageCreateFlags flags;
+        VkImageType image_type;
+        VkFormat format;
+        VkExtent3D extent;
+        uint32_t mip_levels;
+        uint32_t array_layers;
+        VkImageAspectFlags aspect_mask;
+
+        explicit Key(const vvl::Image& image);
+        bool operator==(const Key& rhs) const;
+        struct Hash {
+            size_t operator()(const Key& key) const;
+        };
+    };
+
+    static constexpr size_t kMinPruneSize = 64;
+
+    std::mutex mutex_;
+    vvl::unordered_map<Key, std::weak_ptr<const ImageRangeEncoder>, Key::Hash> entries_;
+    // Number of entries left by the last pruning, the next one happens when the map gets twice as big
+    size_t live_entries_hint_ = kMinPruneSize;
+};
+
 class ImageRangeGenerator {
   public:
     using RangeType = IndexRange;
@@ -669,6 +709,17 @@ class BothRangeMap {
         }
     }
 
+    inline iterator erase(const iterator& first, const iterator& last) {
+        assert(!Tristate());
+        if (SmallMode()) {
+            assert(first.SmallMode() && last.SmallMode());
+            return iterator(small_map_->erase(first.small_it_, last.small_it_));
+        } else {
+            assert(first.BigMode() && last.BigMode());
+            return iterator(big_map_->erase(first.big_it_, last.big_it_));
+        }
+    }
+
     template <typename SplitOp>
     iterator split(const iterator whole_it, const index_type& index, const SplitOp& split_op) {
         assert(!Tristate());
@@ -51,7 +51,7 @@ bool CoreChecks::PreCallValidateFreeCommandBuffers(VkDevice device, VkCommandPoo
     for (uint32_t i = 0; i < commandBufferCount; i++) {
         auto cb_state = GetRead<vvl::CommandBuffer>(pCommandBuffers[i]);
         // Delete CB information structure, and remove from commandBufferMap
-        if (cb_state && cb_state->InUse()) {
+        if (cb_state && InUseAfterObservedSemaphores(*cb_state, error_obj.location)) {
             const LogObjectList objlist(pCommandBuffers[i], commandPool);
             skip |= LogError("VUID-vkFreeCommandBuffers-pCommandBuffers-00047", objlist,
                              error_obj.location.dot(Field::pCommandBuffers, i), "(%s) is in use.",
@@ -66,7 +66,7 @@ bool CoreChecks::PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuffer
     auto cb_state = GetRead<vvl::CommandBuffer>(commandBuffer);
     if (!cb_state) return false;
     bool skip = false;
-    if (cb_state->InUse()) {
+    if (InUseAfterObservedSemaphores(*cb_state, error_obj.location)) {
         skip |= LogError("VUID-vkBeginCommandBuffer-commandBuffer-00049", commandBuffer, error_obj.location,
                          "on active %s before it has completed. You must check "
                          "command buffer fence before this call.",
@@ -369,7 +369,7 @@ bool CoreChecks::PreCallValidateResetCommandBuffer(VkCommandBuffer commandBuffer
                          FormatHandle(cmd_pool).c_str(), string_VkCommandPoolCreateFlags(pool->createFlags).c_str());
     }
 
-    if (cb_state->InUse()) {
+    if (InUseAfterObservedSemaphores(*cb_state, error_obj.location)) {
         const LogObjectList objlist(commandBuffer, cmd_pool);
         skip |= LogError("VUID-vkResetCommandBuffer-commandBuffer-00045", objlist, error_obj.location, "(%s) is in use.",
                          FormatHandle(commandBuffer).c_str());
@@ -1340,7 +1340,7 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
         skip |= ValidateSecondaryCommandBufferState(cb_state, sub_cb_state, cb_loc);
         skip |= ValidateCommandBufferState(sub_cb_state, cb_loc, 0, "VUID-vkCmdExecuteCommands-pCommandBuffers-00089");
         if (!(sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
-            if (sub_cb_state.InUse()) {
+            if (InUseAfterObservedSemaphores(sub_cb_state, cb_loc)) {
                 const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
                 skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00091", objlist, cb_loc,
                                  "Cannot execute pending %s without VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT set.",
@@ -17,6 +17,7 @@
  * limitations under the License.
  */
 
+#include <initializer_list>
 #include <vulkan/vk_enum_string_helper.h>
 #include "generated/chassis.h"
 #include "core_validation.h"
@@ -231,6 +232,116 @@ bool CoreChecks::ValidateDynamicStateIsSet(const LastBound& last_bound_state, co
 // Goal to move all of ValidateGraphicsDynamicStatePipelineSetStatus() and ValidateDrawDynamicStateShaderObject() here and remove
 // them
 bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const {
+    bool skip = false;
+    const vvl::CommandBuffer& cb_state = last_bound_state.cb_state;
+    const vvl::Pipeline* pipeline = last_bound_state.pipeline_state;
+
+    // Everything the walk can require is dynamic in the pipeline (for shader objects, in graphics_shader_object_dynamic_states),
+    // so once it was all set in the command buffer only the values are left to check
+    const CBDynamicFlags& required_state = pipeline ? pipeline->dynamic_state : graphics_shader_object_dynamic_states;
+    if ((required_state & ~cb_state.dynamic_state_status.cb).any()) {
+        skip |= ValidateGraphicsDynamicStatesAreSet(last_bound_state, vuid);
+    }
+
+    // Some VUs are only if pipeline had the state dynamic (otherwise it is checked at pipeline creation time).
+    // For ShaderObject is always dynamic
+    auto has_dynamic_state = [pipeline](CBDynamicState dynamic_state) { return !pipeline || pipeline->IsDynamic(dynamic_state); };
+
+    if (enabled_features.shadingRateImage && !last_bound_state.IsRasterizationDisabled() &&
+        last_bound_state.IsShadingRateImageEnable() &&
+        cb_state.IsDynamicStateSet(CB_DYNAMIC_STATE_VIEWPORT_SHADING_RATE_PALETTE_NV) &&
+        cb_state.dynamic_state_value.shading_rate_palette_count < cb_state.dynamic_state_value.viewport_count) {
+        skip |= LogError(vuid.shading_rate_palette_08637, cb_state.Handle(), vuid.loc(),
+                         "Graphics stages are bound, but viewportCount set with vkCmdSetViewportWithCount() was %" PRIu32
+                         " and viewportCount set with vkCmdSetViewportShadingRatePaletteNV() was %" PRIu32 ".",
+                         cb_state.dynamic_state_value.viewport_count, cb_state.dynamic_state_value.shading_rate_palette_count);
+    }
+
+    if (has_dynamic_state(CB_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) && has_dynamic_state(CB_DYNAMIC_STATE_SCISSOR_WITH_COUNT)) {
+        if (cb_state.dynamic_state_value.viewport_count != cb_state.dynamic_state_value.scissor_count) {
+            skip |= LogError(vuid.viewport_and_scissor_with_count_03419, cb_state.Handle(), vuid.loc(),
+                             "Graphics stages are bound, but viewportCount set with vkCmdSetViewportWithCount() was %" PRIu32
+                             " and scissorCount set with vkCmdSetScissorWithCount() was %" PRIu32 ".",
+                             cb_state.dynamic_state_value.viewport_count, cb_state.dynamic_state_value.scissor_count);
+        }
+    }
+
+    if (IsExtEnabled(device_extensions.vk_nv_clip_space_w_scaling) && last_bound_state.IsViewportWScalingEnable() &&
+        has_dynamic_state(CB_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) && has_dynamic_state(CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_NV) &&
+        cb_state.dynamic_state_value.viewport_w_scaling_count < cb_state.dynamic_state_value.viewport_count) {
+        skip |= LogError(vuid.viewport_w_scaling_08636, cb_state.Handle(), vuid.loc(),
+                         "Graphics stages are bound, but viewportCount set with vkCmdSetViewportWithCount() was %" PRIu32
+                         " and viewportCount set with vkCmdSetViewportWScalingNV() was %" PRIu32 ".",
+                         cb_state.dynamic_state_value.viewport_count, cb_state.dynamic_state_value.viewport_w_scaling_count);
+    }
+
+    return skip;
+}
+
+// Everything ValidateGraphicsDynamicStatesAreSet() can check with shader objects bound, ignoring the bound stages and the values
+// of other states. Keep in sync with it.
+CBDynamicFlags CoreChecks::GetGraphicsShaderObjectDynamicStates() const {
+    CBDynamicFlags flags = 0;
+    for (const CBDynamicState state :
+         {CB_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE, CB_DYNAMIC_STATE_CULL_MODE, CB_DYNAMIC_STATE_DEPTH_TEST_ENABLE,
+          CB_DYNAMIC_STATE_DEPTH_WRITE_ENABLE, CB_DYNAMIC_STATE_STENCIL_TEST_ENABLE, CB_DYNAMIC_STATE_DEPTH_BIAS_ENABLE,
+          CB_DYNAMIC_STATE_POLYGON_MODE_EXT, CB_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT, CB_DYNAMIC_STATE_SAMPLE_MASK_EXT,
+          CB_DYNAMIC_STATE_DEPTH_COMPARE_OP, CB_DYNAMIC_STATE_DEPTH_BIAS, CB_DYNAMIC_STATE_DEPTH_BOUNDS,
+          CB_DYNAMIC_STATE_STENCIL_COMPARE_MASK, CB_DYNAMIC_STATE_STENCIL_WRITE_MASK, CB_DYNAMIC_STATE_STENCIL_REFERENCE,
+          CB_DYNAMIC_STATE_STENCIL_OP, CB_DYNAMIC_STATE_FRONT_FACE, CB_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT,
+          CB_DYNAMIC_STATE_VIEWPORT_WITH_COUNT, CB_DYNAMIC_STATE_SCISSOR_WITH_COUNT, CB_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY,
+          CB_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE, CB_DYNAMIC_STATE_VERTEX_INPUT_EXT,
+          CB_DYNAMIC_STATE_TESSELLATION_DOMAIN_ORIGIN_EXT, CB_DYNAMIC_STATE_PATCH_CONTROL_POINTS_EXT}) {
+        flags.set(state);
+    }
+    const auto set_if = [&flags](bool enabled, std::initializer_list<CBDynamicState> states) {
+        if (enabled) {
+            for (const CBDynamicState state : states) {
+                flags.set(state);
+            }
+        }
+    };
+    set_if(enabled_features.depthBounds, {CB_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE});
+    set_if(IsExtEnabled(device_extensions.vk_ext_sample_locations),
+           {CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_ENABLE_EXT, CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT});
+    set_if(enabled_features.depthClipEnable, {CB_DYNAMIC_STATE_DEPTH_CLIP_ENABLE_EXT});
+    set_if(enabled_features.depthClipControl, {CB_DYNAMIC_STATE_DEPTH_CLIP_NEGATIVE_ONE_TO_ONE_EXT});
+    set_if(enabled_features.depthClampControl, {CB_DYNAMIC_STATE_DEPTH_CLAMP_RANGE_EXT});
+    set_if(enabled_features.depthClamp, {CB_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT});
+    set_if(enabled_features.alphaToOne, {CB_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT});
+    set_if(IsExtEnabled(device_extensions.vk_ext_conservative_rasterization),
+           {CB_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT, CB_DYNAMIC_STATE_EXTRA_PRIMITIVE_OVERESTIMATION_SIZE_EXT});
+    set_if(IsExtEnabled(device_extensions.vk_nv_fragment_coverage_to_color),
+           {CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_ENABLE_NV, CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_LOCATION_NV});
+    set_if(enabled_features.shadingRateImage,
+           {CB_DYNAMIC_STATE_SHADING_RATE_IMAGE_ENABLE_NV, CB_DYNAMIC_STATE_VIEWPORT_COARSE_SAMPLE_ORDER_NV,
+            CB_DYNAMIC_STATE_VIEWPORT_SHADING_RATE_PALETTE_NV});
+    set_if(enabled_features.representativeFragmentTest, {CB_DYNAMIC_STATE_REPRESENTATIVE_FRAGMENT_TEST_ENABLE_NV});
+    set_if(enabled_features.coverageReductionMode, {CB_DYNAMIC_STATE_COVERAGE_REDUCTION_MODE_NV});
+    set_if(IsExtEnabled(device_extensions.vk_nv_framebuffer_mixed_samples),
+           {CB_DYNAMIC_STATE_COVERAGE_MODULATION_MODE_NV, CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_ENABLE_NV,
+            CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_NV});
+    set_if(IsExtEnabled(device_extensions.vk_ext_discard_rectangles),
+           {CB_DYNAMIC_STATE_DISCARD_RECTANGLE_ENABLE_EXT, CB_DYNAMIC_STATE_DISCARD_RECTANGLE_MODE_EXT});
+    set_if(enabled_features.stippledRectangularLines || enabled_features.stippledBresenhamLines ||
+               enabled_features.stippledSmoothLines,
+           {CB_DYNAMIC_STATE_LINE_STIPPLE_KHR});
+    set_if(IsExtEnabled(device_extensions.vk_ext_provoking_vertex), {CB_DYNAMIC_STATE_PROVOKING_VERTEX_MODE_EXT});
+    // The logic op is only checked when logic op is enabled, which needs the feature
+    set_if(enabled_features.logicOp, {CB_DYNAMIC_STATE_LOGIC_OP_ENABLE_EXT, CB_DYNAMIC_STATE_LOGIC_OP_EXT});
+    set_if(enabled_features.pipelineFragmentShadingRate, {CB_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR});
+    set_if(enabled_features.attachmentFeedbackLoopDynamicState, {CB_DYNAMIC_STATE_ATTACHMENT_FEEDBACK_LOOP_ENABLE_EXT});
+    set_if(enabled_features.geometryStreams, {CB_DYNAMIC_STATE_RASTERIZATION_STREAM_EXT});
+    set_if(enabled_features.exclusiveScissor,
+           {CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_ENABLE_NV, CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_NV});
+    set_if(IsExtEnabled(device_extensions.vk_nv_clip_space_w_scaling),
+           {CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_ENABLE_NV, CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_NV});
+    set_if(IsExtEnabled(device_extensions.vk_nv_viewport_swizzle), {CB_DYNAMIC_STATE_VIEWPORT_SWIZZLE_NV});
+    return flags;
+}
+
+// The per state walk of ValidateGraphicsDynamicStateSetStatus(), only needed when some of the required state was not set
+bool CoreChecks::ValidateGraphicsDynamicStatesAreSet(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const {
     bool skip = false;
     const vvl::CommandBuffer& cb_state = last_bound_state.cb_state;
     const bool has_pipeline = last_bound_state.pipeline_state != nullptr;
@@ -347,15 +458,6 @@ bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bou
             if (last_bound_state.IsShadingRateImageEnable()) {
                 skip |= ValidateDynamicStateIsSet(last_bound_state, state_status_cb,
                                                   CB_DYNAMIC_STATE_VIEWPORT_SHADING_RATE_PALETTE_NV, vuid);
-
-                if (cb_state.IsDynamicStateSet(CB_DYNAMIC_STATE_VIEWPORT_SHADING_RATE_PALETTE_NV) &&
-                    cb_state.dynamic_state_value.shading_rate_palette_count < cb_state.dynamic_state_value.viewport_count) {
-                    skip |= LogError(
-                        vuid.shading_rate_palette_08637, cb_state.Handle(), vuid.loc(),
-                        "Graphics stages are bound, but viewportCount set with vkCmdSetViewportWithCount() was %" PRIu32
-                        " and viewportCount set with vkCmdSetViewportShadingRatePaletteNV() was %" PRIu32 ".",
-                        cb_state.dynamic_state_value.viewport_count, cb_state.dynamic_state_value.shading_rate_palette_count);
-                }
             }
         }
 
@@ -425,14 +527,6 @@ bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bou
         skip |= ValidateDynamicStateIsSet(last_bound_state, state_status_cb, CB_DYNAMIC_STATE_VIEWPORT_WITH_COUNT, vuid);
         skip |= ValidateDynamicStateIsSet(last_bound_state, state_status_cb, CB_DYNAMIC_STATE_SCISSOR_WITH_COUNT, vuid);
     }
-    if (has_dynamic_state(CB_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) && has_dynamic_state(CB_DYNAMIC_STATE_SCISSOR_WITH_COUNT)) {
-        if (cb_state.dynamic_state_value.viewport_count != cb_state.dynamic_state_value.scissor_count) {
-            skip |= LogError(vuid.viewport_and_scissor_with_count_03419, cb_state.Handle(), vuid.loc(),
-                             "Graphics stages are bound, but viewportCount set with vkCmdSetViewportWithCount() was %" PRIu32
-                             " and scissorCount set with vkCmdSetScissorWithCount() was %" PRIu32 ".",
-                             cb_state.dynamic_state_value.viewport_count, cb_state.dynamic_state_value.scissor_count);
-        }
-    }
 
     if (vertex_shader_bound) {
         skip |= ValidateDynamicStateIsSet(last_bound_state, state_status_cb, CB_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY, vuid);
@@ -476,14 +570,6 @@ bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bou
         if (last_bound_state.IsViewportWScalingEnable() && has_dynamic_state(CB_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) &&
             has_dynamic_state(CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_NV)) {
             skip |= ValidateDynamicStateIsSet(last_bound_state, state_status_cb, CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_NV, vuid);
-
-            if (cb_state.dynamic_state_value.viewport_w_scaling_count < cb_state.dynamic_state_value.viewport_count) {
-                skip |=
-                    LogError(vuid.viewport_w_scaling_08636, cb_state.Handle(), vuid.loc(),
-                             "Graphics stages are bound, but viewportCount set with vkCmdSetViewportWithCount() was %" PRIu32
-                             " and viewportCount set with vkCmdSetViewportWScalingNV() was %" PRIu32 ".",
-                             cb_state.dynamic_state_value.viewport_count, cb_state.dynamic_state_value.viewport_w_scaling_count);
-            }
         }
     }
 
@@ -529,6 +615,9 @@ bool CoreChecks::ValidateGraphicsDynamicStatePipelineSetStatus(const LastBound&
 
     // build the mask of what has been set in the Pipeline, but yet to be set in the Command Buffer
     const CBDynamicFlags state_status_cb = ~((cb_state.dynamic_state_status.cb ^ pipeline.dynamic_state) & pipeline.dynamic_state);
+    if (state_status_cb.all()) {
+        return skip;
+    }
 
     // VK_EXT_extended_dynamic_state3
     {
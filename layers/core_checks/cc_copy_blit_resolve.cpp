@@ -23,6 +23,7 @@
 
 #include "core_validation.h"
 #include "cc_vuid_maps.h"
+#include "containers/interval_overlap.h"
 #include "error_message/error_strings.h"
 #include <vulkan/vk_enum_string_helper.h>
 #include "generated/chassis.h"
@@ -147,6 +148,14 @@ static bool RegionIntersectsBlit(const RegionType *region0, const RegionType *re
     return result;
 }
 
+// Position of an x coordinate on the axis swept to find overlapping regions. Regions on different mip levels can never
+// intersect, so each mip level gets its own disjoint stretch of the axis (offsets plus extents fit within 33 bits).
+// Mip levels too large to be valid share the last stretch, the candidates found are always confirmed with the full check.
+static int64_t RegionSweepPosition(uint32_t mip_level, int64_t x) {
+    const int64_t mip_stretch = static_cast<int64_t>(std::min(mip_level, 1u << 28)) << 34;
+    return mip_stretch + x + (int64_t(1) << 31);
+}
+
 // Test if the extent argument has all dimensions set to 0.
 static inline bool IsExtentAllZeroes(const VkExtent3D &extent) {
     return ((extent.width == 0) && (extent.height == 0) && (extent.depth == 0));
@@ -160,8 +169,8 @@ VkExtent3D CoreChecks::GetScaledItg(const vvl::CommandBuffer &cb_state, const vv
     const auto pool = cb_state.command_pool;
     if (pool) {
         granularity = physical_device_state->queue_family_properties[pool->queueFamilyIndex].minImageTransferGranularity;
-        if (vkuFormatIsBlockedImage(image_format)) {
-            auto block_size = vkuFormatTexelBlockExtent(image_format);
+        if (image_state.format_info.is_blocked) {
+            const VkExtent3D &block_size = image_state.format_info.texel_block_extent;
             granularity.width *= block_size.width;
             granularity.height *= block_size.height;
         }
@@ -478,7 +487,7 @@ bool CoreChecks::ValidateHeterogeneousCopyData(const HandleT handle, uint32_t re
                              string_VkImageAspectFlags(region_aspect_mask).c_str(), string_VkFormat(image_format));
         }
 
-        auto block_size = vkuFormatTexelBlockExtent(image_format);
+        const VkExtent3D &block_size = image_state.format_info.texel_block_extent;
         //  BufferRowLength must be a multiple of block width
         if (SafeModulo(row_length, block_size.width) != 0) {
             const LogObjectList objlist(handle, image_state.Handle());
@@ -574,9 +583,7 @@ bool CoreChecks::ValidateHeterogeneousCopyData(const HandleT handle, uint32_t re
         // *RowLength divided by the texel block extent width and then multiplied by the texel block size of the image must be
         // less than or equal to 2^31-1
         const uint32_t element_size =
-            vkuFormatIsDepthOrStencil(image_format)
-                ? 0
-                : vkuFormatElementSizeWithAspect(image_format, static_cast<VkImageAspectFlagBits>(region_aspect_mask));
+            image_state.format_info.is_depth_or_stencil ? 0 : image_state.format_info.ElementSizeWithAspect(region_aspect_mask);
         double test_value = row_length / block_size.width;
         test_value = test_value * element_size;
         const auto two_to_31_minus_1 = static_cast<double>((1u << 31) - 1);
@@ -592,7 +599,7 @@ bool CoreChecks::ValidateHeterogeneousCopyData(const HandleT handle, uint32_t re
         }
 
         // Checks that apply only to multi-planar format images
-        if (vkuFormatIsMultiplane(image_format) && !IsOnlyOneValidPlaneAspect(image_format, region_aspect_mask)) {
+        if (image_state.format_info.is_multiplane && !IsOnlyOneValidPlaneAspect(image_format, region_aspect_mask)) {
             const LogObjectList objlist(handle, image_state.Handle());
             skip |= LogError(GetCopyBufferImageVUID(region_loc, vvl::CopyError::MultiPlaneAspectMask_07981), objlist,
                              subresource_loc.dot(Field::aspectMask), "(%s) is invalid for multi-planar format %s.",
@@ -619,12 +626,10 @@ bool CoreChecks::ValidateBufferImageCopyData(const vvl::CommandBuffer &cb_state,
         // If the the calling command's VkImage parameter's format is not a depth/stencil format,
         // then bufferOffset must be a multiple of the calling command's VkImage parameter's element size
         const uint32_t element_size =
-            vkuFormatIsDepthOrStencil(image_format)
-                ? 0
-                : vkuFormatElementSizeWithAspect(image_format, static_cast<VkImageAspectFlagBits>(region_aspect_mask));
+            image_state.format_info.is_depth_or_stencil ? 0 : image_state.format_info.ElementSizeWithAspect(region_aspect_mask);
         const VkDeviceSize bufferOffset = region.bufferOffset;
 
-        if (vkuFormatIsDepthOrStencil(image_format)) {
+        if (image_state.format_info.is_depth_or_stencil) {
             if (SafeModulo(bufferOffset, 4) != 0) {
                 const LogObjectList objlist(cb_state.Handle(), image_state.Handle());
                 skip |= LogError(GetCopyBufferImageDeviceVUID(region_loc, vvl::CopyError::BufferOffset_07978), objlist,
@@ -634,7 +639,7 @@ bool CoreChecks::ValidateBufferImageCopyData(const vvl::CommandBuffer &cb_state,
             }
         } else {
             // If not depth/stencil and not multi-plane
-            if (!vkuFormatIsMultiplane(image_format) && (SafeModulo(bufferOffset, element_size) != 0)) {
+            if (!image_state.format_info.is_multiplane && (SafeModulo(bufferOffset, element_size) != 0)) {
                 const LogObjectList objlist(cb_state.Handle(), image_state.Handle());
                 skip |= LogError(GetCopyBufferImageDeviceVUID(region_loc, vvl::CopyError::TexelBlockSize_07975), objlist,
                                  region_loc.dot(Field::bufferOffset),
@@ -644,14 +649,13 @@ bool CoreChecks::ValidateBufferImageCopyData(const vvl::CommandBuffer &cb_state,
         }
 
         // Checks that apply only to multi-planar format images
-        if (vkuFormatIsMultiplane(image_format)) {
+        if (image_state.format_info.is_multiplane) {
             // image subresource aspectMask must be VK_IMAGE_ASPECT_PLANE_*_BIT
             if (0 !=
                 (region_aspect_mask & (VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT | VK_IMAGE_ASPECT_PLANE_2_BIT))) {
                 // Know aspect mask is valid
-                const VkFormat compatible_format =
-                    vkuFindMultiplaneCompatibleFormat(image_format, static_cast<VkImageAspectFlagBits>(region_aspect_mask));
-                const uint32_t compatible_size = vkuFormatElementSize(compatible_format);
+                const VkFormat compatible_format = image_state.format_info.PlaneFormat(region_aspect_mask);
+                const uint32_t compatible_size = image_state.format_info.PlaneElementSize(region_aspect_mask);
                 if (SafeModulo(bufferOffset, compatible_size) != 0) {
                     const LogObjectList objlist(cb_state.Handle(), image_state.Handle());
                     skip |= LogError(GetCopyBufferImageDeviceVUID(region_loc, vvl::CopyError::MultiPlaneCompatible_07976), objlist,
@@ -748,24 +752,18 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
 
         // The union of the source regions, and the union of the destination regions, must not overlap in memory
         if (validate_no_memory_overlaps) {
-            // Sort copy ranges
-            {
-                MemoryRange src_buffer_memory_range(src_binding->memory_offset + region.srcOffset,
-                                                    src_binding->memory_offset + region.srcOffset + region.size);
-                auto insert_pos = std::lower_bound(src_memory_ranges.begin(), src_memory_ranges.end(), src_buffer_memory_range);
-                src_memory_ranges.insert(insert_pos, src_buffer_memory_range);
-            }
-
-            {
-                MemoryRange dst_buffer_memory_range(dst_binding->memory_offset + region.dstOffset,
-                                                    dst_binding->memory_offset + region.dstOffset + region.size);
-                auto insert_pos = std::lower_bound(dst_memory_ranges.begin(), dst_memory_ranges.end(), dst_buffer_memory_range);
-                dst_memory_ranges.insert(insert_pos, dst_buffer_memory_range);
-            }
+            src_memory_ranges.emplace_back(src_binding->memory_offset + region.srcOffset,
+                                           src_binding->memory_offset + region.srcOffset + region.size);
+            dst_memory_ranges.emplace_back(dst_binding->memory_offset + region.dstOffset,
+                                           dst_binding->memory_offset + region.dstOffset + region.size);
         }
     }
 
     if (validate_no_memory_overlaps) {
+        // Sort copy ranges once they are all known, inserting each one in place is quadratic for large region counts
+        std::sort(src_memory_ranges.begin(), src_memory_ranges.end());
+        std::sort(dst_memory_ranges.begin(), dst_memory_ranges.end());
+
         // Memory ranges are sorted, so looking for overlaps can be done in linear time
         auto src_ranges_it = src_memory_ranges.cbegin();
         auto dst_ranges_it = dst_memory_ranges.cbegin();
@@ -1011,7 +1009,7 @@ bool CoreChecks::ValidateImageCopyData(const HandleT handle, const uint32_t regi
         }
 
         {  // Used to be compressed checks, now apply to all
-            const VkExtent3D block_size = vkuFormatTexelBlockExtent(src_image_state.create_info.format);
+            const VkExtent3D &block_size = src_image_state.format_info.texel_block_extent;
             if (SafeModulo(region.srcOffset.x, block_size.width) != 0) {
                 const LogObjectList objlist(handle, src_image_state.Handle());
                 skip |= LogError(GetCopyImageVUID(region_loc, vvl::CopyError::SrcOffset_07278), objlist, region_loc,
@@ -1160,7 +1158,7 @@ bool CoreChecks::ValidateImageCopyData(const HandleT handle, const uint32_t regi
         }
 
         {
-            const VkExtent3D block_size = vkuFormatTexelBlockExtent(dst_image_state.create_info.format);
+            const VkExtent3D &block_size = dst_image_state.format_info.texel_block_extent;
             //  image offsets x must be multiple of block width
             if (SafeModulo(region.dstOffset.x, block_size.width) != 0) {
                 const LogObjectList objlist(handle, src_image_state.Handle());
@@ -1442,6 +1440,8 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
     const vvl::CommandBuffer &cb_state = *cb_state_ptr;
     const VkFormat src_format = src_image_state->create_info.format;
     const VkFormat dst_format = dst_image_state->create_info.format;
+    const vvl::ImageFormatInfo &src_format_info = src_image_state->format_info;
+    const vvl::ImageFormatInfo &dst_format_info = dst_image_state->format_info;
     const VkImageType src_image_type = src_image_state->create_info.imageType;
     const VkImageType dst_image_type = dst_image_state->create_info.imageType;
     const bool src_is_2d = (VK_IMAGE_TYPE_2D == src_image_type);
@@ -1581,7 +1581,7 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
 
         const VkImageAspectFlags src_aspect = src_subresource.aspectMask;
         const VkImageAspectFlags dst_aspect = dst_subresource.aspectMask;
-        if (!vkuFormatIsMultiplane(src_format) && !vkuFormatIsMultiplane(dst_format)) {
+        if (!src_format_info.is_multiplane && !dst_format_info.is_multiplane) {
             // If neither image is multi-plane the aspectMask member of src and dst must match
             if (src_aspect != dst_aspect) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-01551" : "VUID-vkCmdCopyImage-srcImage-01551";
@@ -1593,14 +1593,14 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         } else {
             // Source image multiplane checks
             VkImageAspectFlags aspect = src_aspect;
-            if (vkuFormatIsMultiplane(src_format) && !IsOnlyOneValidPlaneAspect(src_format, aspect)) {
+            if (src_format_info.is_multiplane && !IsOnlyOneValidPlaneAspect(src_format, aspect)) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-08713" : "VUID-vkCmdCopyImage-srcImage-08713";
                 skip |= LogError(vuid, src_objlist, src_subresource_loc.dot(Field::aspectMask),
                                  "(%s) is invalid for multi-planar format %s.", string_VkImageAspectFlags(aspect).c_str(),
                                  string_VkFormat(src_format));
             }
             // Single-plane to multi-plane
-            if (!vkuFormatIsMultiplane(src_format) && vkuFormatIsMultiplane(dst_format) && VK_IMAGE_ASPECT_COLOR_BIT != aspect) {
+            if (!src_format_info.is_multiplane && dst_format_info.is_multiplane && VK_IMAGE_ASPECT_COLOR_BIT != aspect) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-dstImage-01557" : "VUID-vkCmdCopyImage-dstImage-01557";
                 skip |=
                     LogError(vuid, all_objlist, src_subresource_loc.dot(Field::aspectMask),
@@ -1610,14 +1610,14 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
 
             // Dest image multiplane checks
             aspect = dst_aspect;
-            if (vkuFormatIsMultiplane(dst_format) && !IsOnlyOneValidPlaneAspect(dst_format, aspect)) {
+            if (dst_format_info.is_multiplane && !IsOnlyOneValidPlaneAspect(dst_format, aspect)) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-dstImage-08714" : "VUID-vkCmdCopyImage-dstImage-08714";
                 skip |= LogError(vuid, dst_objlist, dst_subresource_loc.dot(Field::aspectMask),
                                  "(%s) is invalid for multi-planar format %s.", string_VkImageAspectFlags(aspect).c_str(),
                                  string_VkFormat(dst_format));
             }
             // Multi-plane to single-plane
-            if (vkuFormatIsMultiplane(src_format) && !vkuFormatIsMultiplane(dst_format) && VK_IMAGE_ASPECT_COLOR_BIT != aspect) {
+            if (src_format_info.is_multiplane && !dst_format_info.is_multiplane && VK_IMAGE_ASPECT_COLOR_BIT != aspect) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-01556" : "VUID-vkCmdCopyImage-srcImage-01556";
                 skip |=
                     LogError(vuid, all_objlist, dst_subresource_loc.dot(Field::aspectMask),
@@ -1626,37 +1626,12 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
             }
         }
 
-        // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
-        // must not overlap in memory
-        // Validation is only performed when source image is the same as destination image.
-        // In the general case, the mapping between an image and its underlying memory is undefined,
-        // so checking for memory overlaps is not possible.
-        if (src_image_state->VkHandle() == dst_image_state->VkHandle()) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (auto intersection =
-                        GetRegionIntersection(region, pRegions[j], src_image_type, vkuFormatIsMultiplane(src_format));
-                    intersection.has_instersection) {
-                    vuid = is_2 ? "VUID-VkCopyImageInfo2-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
-                    skip |= LogError(vuid, all_objlist, loc,
-                                     "pRegion[%" PRIu32 "] copy source overlaps with pRegions[%" PRIu32
-                                     "] copy destination. Overlap info, with respect to image (%s): %s.",
-                                     i, j, FormatHandle(srcImage).c_str(), intersection.String().c_str());
-                }
-            }
-        }
-
         // Check for multi-plane format compatiblity
-        if (vkuFormatIsMultiplane(src_format) || vkuFormatIsMultiplane(dst_format)) {
-            const VkFormat src_plane_format =
-                vkuFormatIsMultiplane(src_format)
-                    ? vkuFindMultiplaneCompatibleFormat(src_format, static_cast<VkImageAspectFlagBits>(src_aspect))
-                    : src_format;
-            const VkFormat dst_plane_format =
-                vkuFormatIsMultiplane(dst_format)
-                    ? vkuFindMultiplaneCompatibleFormat(dst_format, static_cast<VkImageAspectFlagBits>(dst_aspect))
-                    : dst_format;
-            const size_t src_format_size = vkuFormatElementSize(src_plane_format);
-            const size_t dst_format_size = vkuFormatElementSize(dst_plane_format);
+        if (src_format_info.is_multiplane || dst_format_info.is_multiplane) {
+            const size_t src_format_size =
+                src_format_info.is_multiplane ? src_format_info.PlaneElementSize(src_aspect) : src_format_info.element_size;
+            const size_t dst_format_size =
+                dst_format_info.is_multiplane ? dst_format_info.PlaneElementSize(dst_aspect) : dst_format_info.element_size;
 
             // If size is still zero, then format is invalid and will be caught in another VU
             if ((src_format_size != dst_format_size) && (src_format_size != 0) && (dst_format_size != 0)) {
@@ -1704,27 +1679,27 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
     // The formats of non-multiplane src_image and dst_image must be compatible. Formats are considered compatible if their texel
     // size in bytes is the same between both formats. For example, VK_FORMAT_R8G8B8A8_UNORM is compatible with VK_FORMAT_R32_UINT
     // because because both texels are 4 bytes in size.
-    if (!vkuFormatIsMultiplane(src_format) && !vkuFormatIsMultiplane(dst_format)) {
+    if (!src_format_info.is_multiplane && !dst_format_info.is_multiplane) {
         const char *compatible_vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-01548" : "VUID-vkCmdCopyImage-srcImage-01548";
         // Depth/stencil formats must match exactly.
-        if (vkuFormatIsDepthOrStencil(src_format) || vkuFormatIsDepthOrStencil(dst_format)) {
+        if (src_format_info.is_depth_or_stencil || dst_format_info.is_depth_or_stencil) {
             if (src_format != dst_format) {
                 skip |= LogError(compatible_vuid, all_objlist, loc, "srcImage format (%s) is different from dstImage format (%s).",
                                  string_VkFormat(src_format), string_VkFormat(dst_format));
             }
         } else {
-            if (vkuFormatElementSize(src_format) != vkuFormatElementSize(dst_format)) {
+            if (src_format_info.element_size != dst_format_info.element_size) {
                 skip |= LogError(compatible_vuid, all_objlist, loc,
                                  "srcImage format %s has size of %" PRIu32 " and dstImage format %s has size of %" PRIu32 ".",
-                                 string_VkFormat(src_format), vkuFormatElementSize(src_format), string_VkFormat(dst_format),
-                                 vkuFormatElementSize(dst_format));
+                                 string_VkFormat(src_format), src_format_info.element_size, string_VkFormat(dst_format),
+                                 dst_format_info.element_size);
             }
         }
     }
 
-    if (vkuFormatIsCompressed(src_format) && vkuFormatIsCompressed(dst_format)) {
-        auto src_block_extent = vkuFormatTexelBlockExtent(src_format);
-        auto dst_block_extent = vkuFormatTexelBlockExtent(dst_format);
+    if (src_format_info.is_compressed && dst_format_info.is_compressed) {
+        const VkExtent3D &src_block_extent = src_format_info.texel_block_extent;
+        const VkExtent3D &dst_block_extent = dst_format_info.texel_block_extent;
         if (src_block_extent.width != dst_block_extent.width || src_block_extent.height != dst_block_extent.height ||
             src_block_extent.depth != dst_block_extent.depth) {
             const char *compatible_vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-09247" : "VUID-vkCmdCopyImage-srcImage-09247";
@@ -1775,6 +1750,37 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         }
     }
 
+    // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
+    // must not overlap in memory
+    // Validation is only performed when source image is the same as destination image.
+    // In the general case, the mapping between an image and its underlying memory is undefined,
+    // so checking for memory overlaps is not possible.
+    if (src_image_state->VkHandle() == dst_image_state->VkHandle()) {
+        // Only pairs whose x ranges overlap on the same mip level can intersect, sweep those out instead of testing every pair
+        std::vector<vvl::TaggedInterval> src_intervals;
+        std::vector<vvl::TaggedInterval> dst_intervals;
+        src_intervals.reserve(regionCount);
+        dst_intervals.reserve(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            const RegionType &region = pRegions[i];
+            const int64_t src_begin = RegionSweepPosition(region.srcSubresource.mipLevel, region.srcOffset.x);
+            const int64_t dst_begin = RegionSweepPosition(region.dstSubresource.mipLevel, region.dstOffset.x);
+            src_intervals.emplace_back(vvl::TaggedInterval{src_begin, src_begin + region.extent.width, i});
+            dst_intervals.emplace_back(vvl::TaggedInterval{dst_begin, dst_begin + region.extent.width, i});
+        }
+        const bool is_multiplane = src_format_info.is_multiplane;
+        vvl::ForEachIntersectingPair(src_intervals, dst_intervals, [&](uint32_t i, uint32_t j) {
+            if (auto intersection = GetRegionIntersection(pRegions[i], pRegions[j], src_image_type, is_multiplane);
+                intersection.has_instersection) {
+                vuid = is_2 ? "VUID-VkCopyImageInfo2-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
+                skip |= LogError(vuid, all_objlist, loc,
+                                 "pRegion[%" PRIu32 "] copy source overlaps with pRegions[%" PRIu32
+                                 "] copy destination. Overlap info, with respect to image (%s): %s.",
+                                 i, j, FormatHandle(srcImage).c_str(), intersection.String().c_str());
+            }
+        });
+    }
+
     // Source and dest image sample counts must match
     if (src_image_state->create_info.samples != dst_image_state->create_info.samples) {
         vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-00136" : "VUID-vkCmdCopyImage-srcImage-00136";
@@ -1994,7 +2000,6 @@ template <typename HandleT, typename RegionType>
 bool CoreChecks::ValidateImageBounds(const HandleT handle, const vvl::Image &image_state, const uint32_t regionCount,
                                      const RegionType *pRegions, const Location &loc, const char *vuid, bool is_src) const {
     bool skip = false;
-    const VkImageCreateInfo *image_info = &(image_state.create_info);
 
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
@@ -2007,8 +2012,8 @@ bool CoreChecks::ValidateImageBounds(const HandleT handle, const vvl::Image &ima
 
         // If we're using a blocked image format, valid extent is rounded up to multiple of block size (per
         // vkspec.html#_common_operation)
-        if (vkuFormatIsBlockedImage(image_info->format)) {
-            auto block_extent = vkuFormatTexelBlockExtent(image_info->format);
+        if (image_state.format_info.is_blocked) {
+            const VkExtent3D &block_extent = image_state.format_info.texel_block_extent;
             if (image_extent.width % block_extent.width) {
                 image_extent.width += (block_extent.width - (image_extent.width % block_extent.width));
             }
@@ -2620,7 +2625,7 @@ bool CoreChecks::ValidateMemoryImageCopyCommon(InfoPointer info_ptr, const Locat
             const void *mapped_end = static_cast<char *>(state->p_driver_data) + mapped_size;
             for (uint32_t i = 0; i < regionCount; i++) {
                 const auto region = info_ptr->pRegions[i];
-                auto element_size = vkuFormatElementSize(image_state->create_info.format);
+                const uint32_t element_size = image_state->format_info.element_size;
                 uint64_t copy_size;
                 if (region.memoryRowLength != 0 && region.memoryImageHeight != 0) {
                     copy_size = ((region.memoryRowLength * region.memoryImageHeight) * element_size);
@@ -2780,7 +2785,7 @@ bool CoreChecks::ValidateHostCopyMultiplane(VkImageCopy2 region, const vvl::Imag
                                             const Location &region_loc) const {
     bool skip = false;
     auto aspect_mask = is_src ? region.srcSubresource.aspectMask : region.dstSubresource.aspectMask;
-    if (vkuFormatPlaneCount(image_state.create_info.format) == 2 &&
+    if (image_state.format_info.plane_count == 2 &&
         (aspect_mask != VK_IMAGE_ASPECT_PLANE_0_BIT && aspect_mask != VK_IMAGE_ASPECT_PLANE_1_BIT)) {
         const char *vuid =
             is_src ? "VUID-VkCopyImageToImageInfoEXT-srcImage-07981" : "VUID-VkCopyImageToImageInfoEXT-dstImage-07981";
@@ -2789,7 +2794,7 @@ bool CoreChecks::ValidateHostCopyMultiplane(VkImageCopy2 region, const vvl::Imag
                          string_VkImageAspectFlags(aspect_mask).c_str(), is_src ? "srcImage" : "dstImage",
                          string_VkFormat(image_state.create_info.format));
     }
-    if (vkuFormatPlaneCount(image_state.create_info.format) == 3 &&
+    if (image_state.format_info.plane_count == 3 &&
         (aspect_mask != VK_IMAGE_ASPECT_PLANE_0_BIT && aspect_mask != VK_IMAGE_ASPECT_PLANE_1_BIT &&
          aspect_mask != VK_IMAGE_ASPECT_PLANE_2_BIT)) {
         const char *vuid =
@@ -2812,8 +2817,8 @@ bool CoreChecks::PreCallValidateCopyImageToImageEXT(VkDevice device, const VkCop
     ASSERT_AND_RETURN_SKIP(src_image_state && dst_image_state);
 
     // Formats are required to match, but check each image anyway
-    auto src_plane_count = vkuFormatPlaneCount(src_image_state->create_info.format);
-    auto dst_plane_count = vkuFormatPlaneCount(dst_image_state->create_info.format);
+    const uint32_t src_plane_count = src_image_state->format_info.plane_count;
+    const uint32_t dst_plane_count = dst_image_state->format_info.plane_count;
     bool check_multiplane = ((src_plane_count == 2 || src_plane_count == 3) || (dst_plane_count == 2 || dst_plane_count == 3));
     bool check_memcpy = (info_ptr->flags & VK_HOST_IMAGE_COPY_MEMCPY_EXT);
     auto regionCount = info_ptr->regionCount;
@@ -3229,19 +3234,32 @@ bool CoreChecks::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage src
                                  src_subresource.layerCount, dst_subresource.baseArrayLayer, dst_subresource.layerCount);
             }
         }
+    }
 
-        // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
-        // must not overlap in memory
-        if (srcImage == dstImage) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (RegionIntersectsBlit(&region, &pRegions[j], src_image_state->create_info.imageType,
-                                         vkuFormatIsMultiplane(src_format))) {
-                    vuid = is_2 ? "VUID-VkBlitImageInfo2-pRegions-00217" : "VUID-vkCmdBlitImage-pRegions-00217";
-                    skip |=
-                        LogError(vuid, all_objlist, loc, "pRegion[%" PRIu32 "] src overlaps with pRegions[%" PRIu32 "] dst.", i, j);
-                }
-            }
-        }
+    // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
+    // must not overlap in memory
+    if (srcImage == dstImage) {
+        std::vector<vvl::TaggedInterval> src_intervals;
+        std::vector<vvl::TaggedInterval> dst_intervals;
+        src_intervals.reserve(regionCount);
+        dst_intervals.reserve(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            const RegionType &region = pRegions[i];
+            // Mirrored blits have negative ranges, which RangesIntersect treats as empty as well
+            src_intervals.emplace_back(
+                vvl::TaggedInterval{RegionSweepPosition(region.srcSubresource.mipLevel, region.srcOffsets[0].x),
+                                    RegionSweepPosition(region.srcSubresource.mipLevel, region.srcOffsets[1].x), i});
+            dst_intervals.emplace_back(
+                vvl::TaggedInterval{RegionSweepPosition(region.dstSubresource.mipLevel, region.dstOffsets[0].x),
+                                    RegionSweepPosition(region.dstSubresource.mipLevel, region.dstOffsets[1].x), i});
+        }
+        const bool is_multiplane = src_image_state->format_info.is_multiplane;
+        vvl::ForEachIntersectingPair(src_intervals, dst_intervals, [&](uint32_t i, uint32_t j) {
+            if (RegionIntersectsBlit(&pRegions[i], &pRegions[j], src_image_state->create_info.imageType, is_multiplane)) {
+                vuid = is_2 ? "VUID-VkBlitImageInfo2-pRegions-00217" : "VUID-vkCmdBlitImage-pRegions-00217";
+                skip |= LogError(vuid, all_objlist, loc, "pRegion[%" PRIu32 "] src overlaps with pRegions[%" PRIu32 "] dst.", i, j);
+            }
+        });
     }
     return skip;
 }
@@ -802,7 +802,7 @@ bool CoreChecks::PreCallValidateGetDescriptorSetLayoutSupportKHR(VkDevice device
 //  that any update buffers are valid, and that any dynamic offsets are within the bounds of their buffers.
 // Return true if state is acceptable, or false and write an error message into error string
 bool CoreChecks::ValidateDrawState(const DescriptorSet &descriptor_set, uint32_t set_index, const BindingVariableMap &bindings,
-                                   const std::vector<uint32_t> &dynamic_offsets, const vvl::CommandBuffer &cb_state,
+                                   const LastBound::DynamicOffsets &dynamic_offsets, const vvl::CommandBuffer &cb_state,
                                    const Location &loc, const vvl::DrawDispatchVuid &vuids) const {
     bool result = false;
     VkFramebuffer framebuffer = cb_state.activeFramebuffer ? cb_state.activeFramebuffer->VkHandle() : VK_NULL_HANDLE;
@@ -824,11 +824,39 @@ bool CoreChecks::ValidateDrawState(const DescriptorSet &descriptor_set, uint32_t
         if (descriptor_set.SkipBinding(*binding, binding_pair.second.variable->is_dynamic_accessed)) {
             continue;
         }
+
+        // Skip the binding if nothing it is validated against changed since it last logged nothing. Images are also checked
+        // against the image layouts and attachments of the command buffer, and separate images against the samplers they are
+        // used with, which live in other bindings.
+        const bool has_images = binding->descriptor_class == vvl::DescriptorClass::ImageSampler ||
+                                binding->descriptor_class == vvl::DescriptorClass::Image ||
+                                binding->descriptor_class == vvl::DescriptorClass::Mutable;
+        const bool uses_other_bindings = has_images && !binding_pair.second.variable->samplers_used_by_image.empty();
+        vvl::CommandBuffer::ValidatedDescriptorBinding validated{
+            nullptr,
+            &binding_pair.second,
+            loc.function,
+            binding->change_count.load(),
+            uses_other_bindings ? descriptor_set.GetChangeCount() : 0,
+            has_images ? cb_state.image_layout_change_count : 0,
+            has_images ? cb_state.attachments_change_count : 0};
+        auto cached = cb_state.validated_descriptor_bindings.find(binding);
+        if (cached != cb_state.validated_descriptor_bindings.end() && cached->second.descriptor_set.get() == &descriptor_set &&
+            cached->second == validated) {
+            continue;
+        }
+        const uint64_t message_count = DebugReport::ThreadMessageCount();
+
         vvl::DescriptorBindingInfo binding_info;
         binding_info.first = binding_pair.first;
         binding_info.second.emplace_back(binding_pair.second);
 
         result |= desc_val.ValidateBinding(binding_info, *binding);
+
+        if (DebugReport::ThreadMessageCount() == message_count) {
+            validated.descriptor_set = descriptor_set.shared_from_this();
+            cb_state.validated_descriptor_bindings[binding] = std::move(validated);
+        }
     }
     return result;
 }
@@ -1818,8 +1846,8 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet &dst_set, const VkWrite
                          FormatHandle(dst_layout->Handle()).c_str());
     }
 
-    const auto *used_handle = dst_set.InUse();
-    if (used_handle && !vvl::IsBindless(dest->binding_flags)) {
+    const auto *used_handle = vvl::IsBindless(dest->binding_flags) ? nullptr : InUseAfterObservedSemaphores(dst_set, write_loc);
+    if (used_handle) {
         skip |= LogError("VUID-vkUpdateDescriptorSets-None-03047", objlist, dst_binding_loc,
                          "(%" PRIu32 ") was created with %s, but %s is in use by %s.", update.dstBinding,
                          string_VkDescriptorBindingFlags(dest->binding_flags).c_str(), FormatHandle(update.dstSet).c_str(),
@@ -2152,6 +2180,31 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
         setCount = std::min(setCount, static_cast<uint32_t>(pipeline_layout->set_layouts.size()));
     }
 
+    // The index and alignment limits don't depend on the set layouts, check them in one pass over the arrays
+    const uint32_t max_bindings = phys_dev_ext_props.descriptor_buffer_props.maxDescriptorBufferBindings;
+    const VkDeviceSize offset_alignment = phys_dev_ext_props.descriptor_buffer_props.descriptorBufferOffsetAlignment;
+    for (uint32_t i = 0; i < setCount; i++) {
+        if (pBufferIndices[i] >= max_bindings) {
+            const char *vuid = is_2 ? "VUID-VkSetDescriptorBufferOffsetsInfoEXT-pBufferIndices-08064"
+                                    : "VUID-vkCmdSetDescriptorBufferOffsetsEXT-pBufferIndices-08064";
+            skip |= LogError(vuid, cb_state.Handle(), loc.dot(Field::pBufferIndices, i),
+                             "(%" PRIu32
+                             ") "
+                             "is greater than maxDescriptorBufferBindings (%" PRIu32 ") ",
+                             pBufferIndices[i], max_bindings);
+        }
+
+        if (SafeModulo(pOffsets[i], offset_alignment) != 0) {
+            const char *vuid = is_2 ? "VUID-VkSetDescriptorBufferOffsetsInfoEXT-pOffsets-08061"
+                                    : "VUID-vkCmdSetDescriptorBufferOffsetsEXT-pOffsets-08061";
+            skip |= LogError(vuid, cb_state.Handle(), loc.dot(Field::pOffsets, i),
+                             "(%" PRIuLEAST64
+                             ") is not aligned to descriptorBufferOffsetAlignment"
+                             " (%" PRIuLEAST64 ")",
+                             pOffsets[i], offset_alignment);
+        }
+    }
+
     for (uint32_t i = 0; i < setCount; i++) {
         const auto set_layout = pipeline_layout->set_layouts[firstSet + i];
         if ((set_layout->GetCreateFlags() & VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) == 0) {
@@ -2247,26 +2300,6 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
                              "set by a previous call to vkCmdBindDescriptorBuffersEXT in commandBuffer",
                              pBufferIndices[i]);
         }
-
-        if (pBufferIndices[i] >= phys_dev_ext_props.descriptor_buffer_props.maxDescriptorBufferBindings) {
-            const char *vuid = is_2 ? "VUID-VkSetDescriptorBufferOffsetsInfoEXT-pBufferIndices-08064"
-                                    : "VUID-vkCmdSetDescriptorBufferOffsetsEXT-pBufferIndices-08064";
-            skip |= LogError(vuid, cb_state.Handle(), loc.dot(Field::pBufferIndices, i),
-                             "(%" PRIu32
-                             ") "
-                             "is greater than maxDescriptorBufferBindings (%" PRIu32 ") ",
-                             pBufferIndices[i], phys_dev_ext_props.descriptor_buffer_props.maxDescriptorBufferBindings);
-        }
-
-        if (SafeModulo(offset, phys_dev_ext_props.descriptor_buffer_props.descriptorBufferOffsetAlignment) != 0) {
-            const char *vuid = is_2 ? "VUID-VkSetDescriptorBufferOffsetsInfoEXT-pOffsets-08061"
-                                    : "VUID-vkCmdSetDescriptorBufferOffsetsEXT-pOffsets-08061";
-            skip |= LogError(vuid, cb_state.Handle(), loc.dot(Field::pOffsets, i),
-                             "(%" PRIuLEAST64
-                             ") is not aligned to descriptorBufferOffsetAlignment"
-                             " (%" PRIuLEAST64 ")",
-                             offset, phys_dev_ext_props.descriptor_buffer_props.descriptorBufferOffsetAlignment);
-        }
     }
 
     return skip;
@@ -3300,19 +3333,18 @@ bool CoreChecks::PreCallValidateAllocateDescriptorSets(VkDevice device, const Vk
                              ds_pool_state->GetAvailableSets());
         }
         // Determine whether descriptor counts are satisfiable
-        for (auto it = ds_data.required_descriptors_by_type.begin(); it != ds_data.required_descriptors_by_type.end(); ++it) {
-            auto available_count = ds_pool_state->GetAvailableCount(it->first);
+        ds_data.required_descriptors_by_type.ForEach([&](uint32_t type, uint32_t required_count) {
+            const uint32_t available_count = ds_pool_state->GetAvailableCount(type);
 
-            if (ds_data.required_descriptors_by_type.at(it->first) > available_count) {
+            if (required_count > available_count) {
                 skip |= LogError("VUID-VkDescriptorSetAllocateInfo-apiVersion-07896", ds_pool_state->Handle(), error_obj.location,
                                  "Unable to allocate %" PRIu32
                                  " descriptors of type %s from %s"
                                  ". This pool only has %" PRIu32 " descriptors of this type remaining.",
-                                 ds_data.required_descriptors_by_type.at(it->first),
-                                 string_VkDescriptorType(VkDescriptorType(it->first)), FormatHandle(*ds_pool_state).c_str(),
-                                 available_count);
+                                 required_count, string_VkDescriptorType(VkDescriptorType(type)),
+                                 FormatHandle(*ds_pool_state).c_str(), available_count);
             }
-        }
+        });
     }
 
     const auto *count_allocate_info =
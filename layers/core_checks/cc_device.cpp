@@ -449,6 +449,15 @@ bool CoreChecks::PreCallValidateCreateDevice(VkPhysicalDevice gpu, const VkDevic
     return skip;
 }
 
+// Caches are per user so they don't fight over the temp directory
+static std::string GetCacheFilePath(const char *name) {
+    std::string path = GetTempFilePath() + "/" + name;
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
+    path += "-" + std::to_string(getuid());
+#endif
+    return path + ".bin";
+}
+
 void CoreChecks::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) {
     // The state tracker sets up the device state (also if extension and/or features are enabled)
     StateTracker::PostCreateDevice(pCreateInfo, loc);
@@ -462,32 +471,44 @@ void CoreChecks::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const L
         });
 
     AdjustValidatorOptions(device_extensions, enabled_features, spirv_val_options, &spirv_val_option_hash);
+    graphics_shader_object_dynamic_states = GetGraphicsShaderObjectDynamicStates();
+
+    if (global_settings.parallel_submit_validation) {
+        submit_validation_pool = std::make_unique<vvl::ThreadPool>(vvl::ThreadPool::DefaultThreadCount());
+    }
+    if (global_settings.async_spirv_validation) {
+        spirv_validation_pool = std::make_unique<vvl::ThreadPool>(vvl::ThreadPool::DefaultThreadCount());
+    }
 
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
-        auto tmp_path = GetTempFilePath();
-        validation_cache_path = tmp_path + "/shader_validation_cache";
-#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
-        validation_cache_path += "-" + std::to_string(getuid());
-#endif
-        validation_cache_path += ".bin";
+        validation_cache_path = GetCacheFilePath("shader_validation_cache");
 
-        std::vector<char> validation_cache_data;
-        std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
+        VkValidationCacheCreateInfoEXT cacheCreateInfo = vku::InitStructHelper();
+        cacheCreateInfo.initialDataSize = 0;
+        cacheCreateInfo.pInitialData = nullptr;
+        cacheCreateInfo.flags = 0;
+        CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
 
-        if (read_file) {
-            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(validation_cache_data));
-            read_file.close();
-        } else {
+        // Mapped, not read, so a large cache file does not slow down device creation
+        if (!CastFromHandle<ValidationCache *>(core_validation_cache)->LoadFile(validation_cache_path)) {
             LogInfo("WARNING-cache-file-error", device, loc,
                     "Cannot open shader validation cache at %s for reading (it may not exist yet)", validation_cache_path.c_str());
         }
+    }
 
-        VkValidationCacheCreateInfoEXT cacheCreateInfo = vku::InitStructHelper();
-        cacheCreateInfo.initialDataSize = validation_cache_data.size();
-        cacheCreateInfo.pInitialData = validation_cache_data.data();
-        cacheCreateInfo.flags = 0;
-        CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
+    // The SPIR-V is parsed even if shader validation is disabled, only the caching setting matters here
+    if (!disabled[shader_validation_caching] && !spirv_analysis_cache) {
+        spirv_analysis_cache_path = GetCacheFilePath("shader_analysis_cache");
+        spirv_analysis_cache = std::make_unique<spirv::AnalysisCache>();
+
+        std::ifstream read_file(spirv_analysis_cache_path.c_str(), std::ios::in | std::ios::binary);
+        if (read_file) {
+            std::vector<char> analysis_cache_data;
+            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(analysis_cache_data));
+            read_file.close();
+            spirv_analysis_cache->Load(analysis_cache_data);
+        }
     }
 }
 
@@ -497,39 +518,28 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
 
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
-    if (core_validation_cache) {
-        Location loc(Func::vkDestroyDevice);
-        size_t validation_cache_size = 0;
-        void *validation_cache_data = nullptr;
-
-        CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
-
-        validation_cache_data = (char *)malloc(sizeof(char) * validation_cache_size);
-        if (!validation_cache_data) {
-            LogInfo("WARNING-cache-memory-error", device, loc, "Validation Cache Memory Error");
-            return;
-        }
-
-        VkResult result =
-            CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, validation_cache_data);
+    // Modules that were never used still get their spirv-val reported
+    ReportAllPendingSpirvValidation();
 
-        if (result != VK_SUCCESS) {
-            LogInfo("WARNING-cache-retrieval-error", device, loc, "Validation Cache Retrieval Error");
-            free(validation_cache_data);
-            return;
+    if (spirv_analysis_cache && !spirv_analysis_cache_path.empty()) {
+        const std::vector<char> analysis_cache_data = spirv_analysis_cache->Write();
+        std::ofstream write_file(spirv_analysis_cache_path.c_str(), std::ios::out | std::ios::binary);
+        if (write_file) {
+            write_file.write(analysis_cache_data.data(), analysis_cache_data.size());
+            write_file.close();
+        } else {
+            LogInfo("WARNING-cache-write-error", device, Location(Func::vkDestroyDevice),
+                    "Cannot open shader analysis cache at %s for writing", spirv_analysis_cache_path.c_str());
         }
+    }
 
+    if (core_validation_cache) {
         if (validation_cache_path.size() > 0) {
-            std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
-            if (write_file) {
-                write_file.write(static_cast<char *>(validation_cache_data), validation_cache_size);
-                write_file.close();
-            } else {
-                LogInfo("WARNING-cache-write-error", device, loc, "Cannot open shader validation cache at %s for writing",
-                        validation_cache_path.c_str());
+            if (!CastFromHandle<ValidationCache *>(core_validation_cache)->SaveFile(validation_cache_path)) {
+                LogInfo("WARNING-cache-write-error", device, Location(Func::vkDestroyDevice),
+                        "Cannot open shader validation cache at %s for writing", validation_cache_path.c_str());
             }
         }
-        free(validation_cache_data);
         CoreLayerDestroyValidationCacheEXT(device, core_validation_cache, NULL);
     }
 }
@@ -675,17 +685,22 @@ VkFormatProperties3KHR CoreChecks::GetPDFormatProperties(const VkFormat format)
 VkResult CoreChecks::CoreLayerCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT *pCreateInfo,
                                                        const VkAllocationCallbacks *pAllocator,
                                                        VkValidationCacheEXT *pValidationCache) {
-    *pValidationCache = ValidationCache::Create(pCreateInfo, spirv_val_option_hash);
+    *pValidationCache =
+        ValidationCache::Create(pCreateInfo, spirv_val_option_hash, global_settings.shader_validation_cache_max_entries);
     return *pValidationCache ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED;
 }
 
 void CoreChecks::CoreLayerDestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache,
                                                     const VkAllocationCallbacks *pAllocator) {
+    // Async spirv-val might still be using the cache
+    ReportAllPendingSpirvValidation();
     delete CastFromHandle<ValidationCache *>(validationCache);
 }
 
 VkResult CoreChecks::CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t *pDataSize,
                                                         void *pData) {
+    // Include the results of the async spirv-val that is still running
+    ReportAllPendingSpirvValidation();
     size_t in_size = *pDataSize;
     CastFromHandle<ValidationCache *>(validationCache)->Write(pDataSize, pData);
     return (pData && *pDataSize != in_size) ? VK_INCOMPLETE : VK_SUCCESS;
@@ -693,6 +708,7 @@ VkResult CoreChecks::CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValid
 
 VkResult CoreChecks::CoreLayerMergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount,
                                                        const VkValidationCacheEXT *pSrcCaches) {
+    ReportAllPendingSpirvValidation();
     bool skip = false;
     auto dst = CastFromHandle<ValidationCache *>(dstCache);
     VkResult result = VK_SUCCESS;
@@ -780,7 +796,7 @@ bool CoreChecks::PreCallValidateDestroyCommandPool(VkDevice device, VkCommandPoo
     // Verify that command buffers in pool are complete (not in-flight)
     for (auto &entry : cp_state->commandBuffers) {
         auto cb_state = entry.second;
-        if (cb_state->InUse()) {
+        if (InUseAfterObservedSemaphores(*cb_state, error_obj.location)) {
             const LogObjectList objlist(cb_state->Handle(), commandPool);
             skip |= LogError("VUID-vkDestroyCommandPool-commandPool-00041", objlist, error_obj.location, "(%s) is in use.",
                              FormatHandle(cb_state->Handle()).c_str());
@@ -797,7 +813,7 @@ bool CoreChecks::PreCallValidateResetCommandPool(VkDevice device, VkCommandPool
     // Verify that command buffers in pool are complete (not in-flight)
     for (auto &entry : cp_state->commandBuffers) {
         auto cb_state = entry.second;
-        if (cb_state->InUse()) {
+        if (InUseAfterObservedSemaphores(*cb_state, error_obj.location)) {
             const LogObjectList objlist(cb_state->Handle(), commandPool);
             skip |= LogError("VUID-vkResetCommandPool-commandPool-00040", objlist, error_obj.location, "(%s) is in use.",
                              FormatHandle(cb_state->Handle()).c_str());
@@ -814,7 +830,7 @@ bool CoreChecks::ValidateObjectNotInUse(const vvl::StateObject *obj_node, const
     auto obj_struct = obj_node->Handle();
     bool skip = false;
 
-    const auto *used_handle = obj_node->InUse();
+    const auto *used_handle = InUseAfterObservedSemaphores(*obj_node, loc);
     if (used_handle) {
         skip |= LogError(error_code, device, loc, "can't be called on %s that is currently in use by %s.",
                          FormatHandle(obj_struct).c_str(), FormatHandle(*used_handle).c_str());
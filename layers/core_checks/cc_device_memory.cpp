@@ -1371,86 +1371,94 @@ bool CoreChecks::PreCallValidateUnmapMemory2KHR(VkDevice device, const VkMemoryU
     return skip;
 }
 
-bool CoreChecks::ValidateMemoryIsMapped(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
-                                        const ErrorObject &error_obj) const {
+bool CoreChecks::ValidateMappedMemoryRanges(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
+                                            const ErrorObject &error_obj) const {
     bool skip = false;
+    // Streaming code flushes many ranges of a few persistently mapped memory objects, usually one after the other, so the
+    // memory state is only looked up when the memory changes
+    std::shared_ptr<const vvl::DeviceMemory> mem_info;
     for (uint32_t i = 0; i < mem_range_count; ++i) {
-        const Location memory_range_loc = error_obj.location.dot(Field::pMemoryRanges, i);
-        auto mem_info = Get<vvl::DeviceMemory>(mem_ranges[i].memory);
-        ASSERT_AND_CONTINUE(mem_info);
-        // Makes sure the memory is already mapped
-        if (mem_info->mapped_range.size == 0) {
-            skip |= LogError("VUID-VkMappedMemoryRange-memory-00684", mem_ranges[i].memory, memory_range_loc,
-                             "Attempting to use memory (%s) that is not currently host mapped.",
-                             FormatHandle(mem_ranges[i].memory).c_str());
-        }
-
-        if (mem_ranges[i].size == VK_WHOLE_SIZE) {
-            if (mem_info->mapped_range.offset > mem_ranges[i].offset) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-00686", mem_ranges[i].memory, memory_range_loc.dot(Field::offset),
-                                 "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is VK_WHOLE_SIZE).",
-                                 mem_ranges[i].offset, mem_info->mapped_range.offset);
-            }
-        } else {
-            if (mem_info->mapped_range.offset > mem_ranges[i].offset) {
-                skip |=
-                    LogError("VUID-VkMappedMemoryRange-size-00685", mem_ranges[i].memory, memory_range_loc.dot(Field::offset),
-                             "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is not VK_WHOLE_SIZE).",
-                             mem_ranges[i].offset, mem_info->mapped_range.offset);
-            }
-            const uint64_t data_end = (mem_info->mapped_range.size == VK_WHOLE_SIZE)
-                                          ? mem_info->allocate_info.allocationSize
-                                          : (mem_info->mapped_range.offset + mem_info->mapped_range.size);
-            if ((data_end < (mem_ranges[i].offset + mem_ranges[i].size))) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-00685", mem_ranges[i].memory, memory_range_loc,
-                                 "size (%" PRIu64 ") plus offset (%" PRIu64
-                                 ") "
-                                 "exceed the Memory Object's upper-bound (%" PRIu64 ").",
-                                 mem_ranges[i].size, mem_ranges[i].offset, data_end);
-            }
+        const VkMappedMemoryRange &mem_range = mem_ranges[i];
+        if (!mem_info || mem_info->VkHandle() != mem_range.memory) {
+            mem_info = Get<vvl::DeviceMemory>(mem_range.memory);
         }
+        ASSERT_AND_CONTINUE(mem_info);
+        const Location memory_range_loc = error_obj.location.dot(Field::pMemoryRanges, i);
+        skip |= ValidateMappedMemoryRangeDeviceLimits(mem_range, *mem_info, memory_range_loc);
+        skip |= ValidateMemoryIsMapped(mem_range, *mem_info, memory_range_loc);
     }
     return skip;
 }
 
-bool CoreChecks::ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
-                                                       const ErrorObject &error_obj) const {
+bool CoreChecks::ValidateMemoryIsMapped(const VkMappedMemoryRange &mem_range, const vvl::DeviceMemory &mem_info,
+                                        const Location &memory_range_loc) const {
     bool skip = false;
-    for (uint32_t i = 0; i < mem_range_count; ++i) {
-        const Location memory_range_loc = error_obj.location.dot(Field::pMemoryRanges, i);
-        const uint64_t atom_size = phys_dev_props.limits.nonCoherentAtomSize;
-        const VkDeviceSize offset = mem_ranges[i].offset;
-        const VkDeviceSize size = mem_ranges[i].size;
+    // Makes sure the memory is already mapped
+    if (mem_info.mapped_range.size == 0) {
+        skip |= LogError("VUID-VkMappedMemoryRange-memory-00684", mem_range.memory, memory_range_loc,
+                         "Attempting to use memory (%s) that is not currently host mapped.",
+                         FormatHandle(mem_range.memory).c_str());
+    }
 
-        if (SafeModulo(offset, atom_size) != 0) {
-            skip |= LogError("VUID-VkMappedMemoryRange-offset-00687", mem_ranges->memory, memory_range_loc.dot(Field::offset),
-                             "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64 ").",
-                             offset, atom_size);
+    if (mem_range.size == VK_WHOLE_SIZE) {
+        if (mem_info.mapped_range.offset > mem_range.offset) {
+            skip |= LogError("VUID-VkMappedMemoryRange-size-00686", mem_range.memory, memory_range_loc.dot(Field::offset),
+                             "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is VK_WHOLE_SIZE).",
+                             mem_range.offset, mem_info.mapped_range.offset);
         }
-        auto mem_info = Get<vvl::DeviceMemory>(mem_ranges[i].memory);
-        ASSERT_AND_CONTINUE(mem_info);
+    } else {
+        if (mem_info.mapped_range.offset > mem_range.offset) {
+            skip |= LogError("VUID-VkMappedMemoryRange-size-00685", mem_range.memory, memory_range_loc.dot(Field::offset),
+                             "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is not VK_WHOLE_SIZE).",
+                             mem_range.offset, mem_info.mapped_range.offset);
+        }
+        const uint64_t data_end = (mem_info.mapped_range.size == VK_WHOLE_SIZE)
+                                      ? mem_info.allocate_info.allocationSize
+                                      : (mem_info.mapped_range.offset + mem_info.mapped_range.size);
+        if ((data_end < (mem_range.offset + mem_range.size))) {
+            skip |= LogError("VUID-VkMappedMemoryRange-size-00685", mem_range.memory, memory_range_loc,
+                             "size (%" PRIu64 ") plus offset (%" PRIu64
+                             ") "
+                             "exceed the Memory Object's upper-bound (%" PRIu64 ").",
+                             mem_range.size, mem_range.offset, data_end);
+        }
+    }
+    return skip;
+}
 
-        const auto allocation_size = mem_info->allocate_info.allocationSize;
-        if (size == VK_WHOLE_SIZE) {
-            const auto mapping_offset = mem_info->mapped_range.offset;
-            const auto mapping_size = mem_info->mapped_range.size;
-            const auto mapping_end = ((mapping_size == VK_WHOLE_SIZE) ? allocation_size : mapping_offset + mapping_size);
-            if (SafeModulo(mapping_end, atom_size) != 0 && mapping_end != allocation_size) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-01389", mem_ranges->memory, memory_range_loc.dot(Field::size),
-                                 "is VK_WHOLE_SIZE and the mapping end (%" PRIu64 " = %" PRIu64 " + %" PRIu64
-                                 ") not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
-                                 ") and not equal to the end of the memory object (%" PRIu64 ").",
-                                 mapping_end, mapping_offset, mapping_size, atom_size, allocation_size);
-            }
-        } else {
-            const auto range_end = size + offset;
-            if (range_end != allocation_size && SafeModulo(size, atom_size) != 0) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-01390", mem_ranges->memory, memory_range_loc.dot(Field::size),
-                                 "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
-                                 ") and offset + size (%" PRIu64 " + %" PRIu64 " = %" PRIu64
-                                 ") not equal to the memory size (%" PRIu64 ").",
-                                 size, atom_size, offset, size, range_end, allocation_size);
-            }
+bool CoreChecks::ValidateMappedMemoryRangeDeviceLimits(const VkMappedMemoryRange &mem_range, const vvl::DeviceMemory &mem_info,
+                                                       const Location &memory_range_loc) const {
+    bool skip = false;
+    const uint64_t atom_size = phys_dev_props.limits.nonCoherentAtomSize;
+    const VkDeviceSize offset = mem_range.offset;
+    const VkDeviceSize size = mem_range.size;
+
+    if (SafeModulo(offset, atom_size) != 0) {
+        skip |= LogError("VUID-VkMappedMemoryRange-offset-00687", mem_range.memory, memory_range_loc.dot(Field::offset),
+                         "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64 ").", offset,
+                         atom_size);
+    }
+
+    const auto allocation_size = mem_info.allocate_info.allocationSize;
+    if (size == VK_WHOLE_SIZE) {
+        const auto mapping_offset = mem_info.mapped_range.offset;
+        const auto mapping_size = mem_info.mapped_range.size;
+        const auto mapping_end = ((mapping_size == VK_WHOLE_SIZE) ? allocation_size : mapping_offset + mapping_size);
+        if (SafeModulo(mapping_end, atom_size) != 0 && mapping_end != allocation_size) {
+            skip |= LogError("VUID-VkMappedMemoryRange-size-01389", mem_range.memory, memory_range_loc.dot(Field::size),
+                             "is VK_WHOLE_SIZE and the mapping end (%" PRIu64 " = %" PRIu64 " + %" PRIu64
+                             ") not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
+                             ") and not equal to the end of the memory object (%" PRIu64 ").",
+                             mapping_end, mapping_offset, mapping_size, atom_size, allocation_size);
+        }
+    } else {
+        const auto range_end = size + offset;
+        if (range_end != allocation_size && SafeModulo(size, atom_size) != 0) {
+            skip |= LogError("VUID-VkMappedMemoryRange-size-01390", mem_range.memory, memory_range_loc.dot(Field::size),
+                             "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
+                             ") and offset + size (%" PRIu64 " + %" PRIu64 " = %" PRIu64 ") not equal to the memory size (%" PRIu64
+                             ").",
+                             size, atom_size, offset, size, range_end, allocation_size);
         }
     }
     return skip;
@@ -1460,8 +1468,7 @@ bool CoreChecks::PreCallValidateFlushMappedMemoryRanges(VkDevice device, uint32_
                                                         const VkMappedMemoryRange *pMemoryRanges,
                                                         const ErrorObject &error_obj) const {
     bool skip = false;
-    skip |= ValidateMappedMemoryRangeDeviceLimits(memoryRangeCount, pMemoryRanges, error_obj);
-    skip |= ValidateMemoryIsMapped(memoryRangeCount, pMemoryRanges, error_obj);
+    skip |= ValidateMappedMemoryRanges(memoryRangeCount, pMemoryRanges, error_obj);
     return skip;
 }
 
@@ -1469,8 +1476,7 @@ bool CoreChecks::PreCallValidateInvalidateMappedMemoryRanges(VkDevice device, ui
                                                              const VkMappedMemoryRange *pMemoryRanges,
                                                              const ErrorObject &error_obj) const {
     bool skip = false;
-    skip |= ValidateMappedMemoryRangeDeviceLimits(memoryRangeCount, pMemoryRanges, error_obj);
-    skip |= ValidateMemoryIsMapped(memoryRangeCount, pMemoryRanges, error_obj);
+    skip |= ValidateMappedMemoryRanges(memoryRangeCount, pMemoryRanges, error_obj);
     return skip;
 }
 
@@ -2319,8 +2325,10 @@ bool CoreChecks::ValidateSparseImageMemoryBind(vvl::Image const *image_state, Vk
     skip |=
         ValidateImageSubresourceSparseImageMemoryBind(*image_state, bind.subresource, bind_loc, memory_loc.dot(Field::subresource));
 
-    for (auto const &requirements : image_state->sparse_requirements) {
-        VkExtent3D const &granularity = requirements.formatProperties.imageGranularity;
+    // The block size is the one of the bound aspect, DS images can have one per aspect
+    const auto *residency = image_state->GetSparseResidency();
+    if (const auto *requirements = residency ? residency->GetSparseRequirements(bind.subresource.aspectMask) : nullptr) {
+        VkExtent3D const &granularity = requirements->formatProperties.imageGranularity;
         if (SafeModulo(bind.offset.x, granularity.width) != 0) {
             skip |= LogError("VUID-VkSparseImageMemoryBind-offset-01107", image_state->Handle(),
                              bind_loc.dot(Field::offset).dot(Field::x),
@@ -1246,6 +1246,17 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
     const auto &last_bound_state = cb_state.lastBound[lv_bind_point];
     const vvl::Pipeline *pipeline = last_bound_state.pipeline_state;
 
+    // Consecutive action commands usually only have push constants changed in between. If nothing that is checked here
+    // changed since the last one that logged nothing, this one would not log anything either.
+    const LastBound::ValidatedActionState action_state{loc.function, cb_state.bound_state_generation,
+                                                       cb_state.image_layout_change_count,
+                                                       last_bound_state.GetDescriptorChangeCount()};
+    if (last_bound_state.validated_action_state == action_state) {
+        // vkCmdPushConstants doesn't bump bound_state_generation, but it can change the push constant layout
+        return ValidateActionStatePushConstant(last_bound_state, pipeline, vuid);
+    }
+    const uint64_t message_count = DebugReport::ThreadMessageCount();
+
     bool skip = false;
 
     // Quick verify that if there is no pipeine, the shade object is being used
@@ -1297,6 +1308,9 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
         skip |= ValidateActionStateProtectedMemory(last_bound_state, bind_point, pipeline, vuid);
     }
 
+    if (DebugReport::ThreadMessageCount() == message_count) {
+        last_bound_state.validated_action_state = action_state;
+    }
     return skip;
 }
 
@@ -1333,7 +1347,7 @@ bool CoreChecks::ValidateActionStateDescriptorsPipeline(const LastBound &last_bo
     if (pipeline.descriptor_buffer_mode) return skip;
 
     const auto pipeline_layout = pipeline.PipelineLayoutState();
-    if (!pipeline.active_slots.empty() && !last_bound_state.IsBoundSetCompatible(pipeline.max_active_slot, *pipeline_layout)) {
+    if (!pipeline.ActiveSlots().empty() && !last_bound_state.IsBoundSetCompatible(pipeline.MaxActiveSlot(), *pipeline_layout)) {
         LogObjectList objlist(pipeline.Handle());
         const auto layouts = pipeline.PipelineLayoutStateUnion();
         std::ostringstream pipe_layouts_log;
@@ -1349,17 +1363,17 @@ bool CoreChecks::ValidateActionStateDescriptorsPipeline(const LastBound &last_bo
         }
         objlist.add(last_bound_state.desc_set_pipeline_layout);
         std::string range =
-            pipeline.max_active_slot == 0 ? "set 0 is" : "all sets 0 to " + std::to_string(pipeline.max_active_slot) + " are";
+            pipeline.MaxActiveSlot() == 0 ? "set 0 is" : "all sets 0 to " + std::to_string(pipeline.MaxActiveSlot()) + " are";
         skip |= LogError(vuid.compatible_pipeline_08600, objlist, vuid.loc(),
                          "The %s (created with %s) statically uses descriptor set %" PRIu32
                          ", but %s not compatible with the pipeline layout bound with %s (%s)\n%s",
-                         FormatHandle(pipeline).c_str(), pipe_layouts_log.str().c_str(), pipeline.max_active_slot, range.c_str(),
+                         FormatHandle(pipeline).c_str(), pipe_layouts_log.str().c_str(), pipeline.MaxActiveSlot(), range.c_str(),
                          String(last_bound_state.desc_set_bound_command),
                          FormatHandle(last_bound_state.desc_set_pipeline_layout).c_str(),
-                         last_bound_state.DescribeNonCompatibleSet(pipeline.max_active_slot, *pipeline_layout).c_str());
+                         last_bound_state.DescribeNonCompatibleSet(pipeline.MaxActiveSlot(), *pipeline_layout).c_str());
     } else {
         // if the bound set is not compatible, the rest will just be extra redundant errors
-        for (const auto &set_binding_pair : pipeline.active_slots) {
+        for (const auto &set_binding_pair : pipeline.ActiveSlots()) {
             std::string error_string;
             uint32_t set_index = set_binding_pair.first;
             const auto set_info = last_bound_state.per_set[set_index];
@@ -892,11 +892,11 @@ bool CoreChecks::PreCallValidateCmdClearColorImage(VkCommandBuffer commandBuffer
     }
 
     const VkFormat format = image_state.create_info.format;
-    if (vkuFormatIsDepthOrStencil(format)) {
+    if (image_state.format_info.is_depth_or_stencil) {
         skip |=
             LogError("VUID-vkCmdClearColorImage-image-00007", objlist, image_loc,
                      "(%s) was created with a depth/stencil format (%s).", FormatHandle(image).c_str(), string_VkFormat(format));
-    } else if (vkuFormatIsCompressed(format)) {
+    } else if (image_state.format_info.is_compressed) {
         skip |= LogError("VUID-vkCmdClearColorImage-image-00007", objlist, image_loc,
                          "(%s) was created with a compressed format (%s).", FormatHandle(image).c_str(), string_VkFormat(format));
     }
@@ -1027,7 +1027,7 @@ bool CoreChecks::PreCallValidateCmdClearDepthStencilImage(VkCommandBuffer comman
         }
     }
 
-    if (!vkuFormatIsDepthOrStencil(image_format)) {
+    if (!image_state.format_info.is_depth_or_stencil) {
         skip |=
             LogError("VUID-vkCmdClearDepthStencilImage-image-00014", objlist, image_loc,
                      "(%s) doesn't have a depth/stencil format (%s).", FormatHandle(image).c_str(), string_VkFormat(image_format));
@@ -2392,6 +2392,15 @@ bool CoreChecks::PreCallValidateDestroyImageView(VkDevice device, VkImageView im
     return skip;
 }
 
+void CoreChecks::PreCallRecordDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks *pAllocator,
+                                               const RecordObject &record_obj) {
+    // The handle value can be given to a new image view
+    if (imageView != VK_NULL_HANDLE) {
+        rendering_attachment_validation_cache.Clear();
+    }
+    StateTracker::PreCallRecordDestroyImageView(device, imageView, pAllocator, record_obj);
+}
+
 bool CoreChecks::ValidateGetImageSubresourceLayout(const vvl::Image &image_state, const VkImageSubresource &subresource,
                                                    const Location &subresource_loc) const {
     bool skip = false;
@@ -200,14 +200,26 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
         const auto image_state = Get<vvl::Image>(image);
         if (!image_state) continue;
 
-        const auto &layout_map = layout_map_entry.second.map->GetLayoutMap();
+        const ImageSubresourceLayoutMap &subresource_map = *layout_map_entry.second.map;
+        const auto &layout_map = subresource_map.GetLayoutMap();
         // Validate the initial_uses for each subresource referenced
         if (layout_map.empty()) continue;
 
-        auto *overlay_map = GetLayoutRangeMap(overlayLayoutMap, *image_state);
         const auto *global_map = image_state->layout_range_map.get();
         ASSERT_AND_CONTINUE(global_map);
+        // When the image layouts didn't change since they last matched and no earlier command buffer of this submission changed
+        // them, the comparison would find the same thing, only the overlay has to be updated
+        const bool first_use_in_submission = overlayLayoutMap.find(image_state.get()) == overlayLayoutMap.end();
+        auto *overlay_map = GetLayoutRangeMap(overlayLayoutMap, *image_state);
+        if (first_use_in_submission && subresource_map.ValidatedGeneration() == global_map->Generation()) {
+            sparse_container::splice(*overlay_map, layout_map, GlobalLayoutUpdater());
+            continue;
+        }
+
         auto global_map_guard = global_map->ReadLock();
+        // Read under the lock, no writer can change the layouts while the comparison runs
+        const uint64_t global_generation = global_map->Generation();
+        bool layout_mismatch = false;
 
         // Note: don't know if it would matter
         // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
@@ -237,6 +249,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
                 const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
                 const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
                 if (!matches) {
+                    layout_mismatch = true;
                     // We can report all the errors for the intersected range directly
                     for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
                         const auto subresource = image_state->subresource_encoder.Decode(index);
@@ -260,6 +273,9 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
                 }
             }
         }
+        if (first_use_in_submission && !layout_mismatch) {
+            subresource_map.SetValidatedGeneration(global_generation);
+        }
         // Update all layout set operations (which will be a subset of the initial_layouts)
         sparse_container::splice(*overlay_map, layout_map, GlobalLayoutUpdater());
     }
@@ -273,7 +289,10 @@ void CoreChecks::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
         const auto image_state = Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id && layout_map_entry.second.map) {
             auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, layout_map_entry.second.map->GetLayoutMap(), GlobalLayoutUpdater());
+            if (sparse_container::splice(*image_state->layout_range_map, layout_map_entry.second.map->GetLayoutMap(),
+                                         GlobalLayoutUpdater())) {
+                image_state->layout_range_map->Touch();
+            }
         }
     }
 }
@@ -993,6 +1012,14 @@ bool CoreChecks::ValidateHostCopyCurrentLayout(const VkImageLayout expected_layo
     // RangeGenerator doesn't tolerate degenerate or invalid ranges. The error will be found and logged elsewhere
     if (!IsCompliantSubresourceRange(subres_range, image_state)) return false;
 
+    // Images that have all their subresources in one layout, such as those only ever transitioned as a whole, are checked
+    // without locking or walking the map. On a mismatch the map is still walked to find the subresource to report.
+    const VkImageLayout uniform_layout = image_state.layout_range_map->UniformLayout();
+    if (uniform_layout != VK_IMAGE_LAYOUT_MAX_ENUM &&
+        ImageLayoutMatches(subres_range.aspectMask, uniform_layout, expected_layout)) {
+        return false;
+    }
+
     Map::RangeGenerator range_gen(image_state.subresource_encoder, subres_range);
 
     struct CheckState {
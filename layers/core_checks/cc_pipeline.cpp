@@ -18,6 +18,7 @@
  * limitations under the License.
  */
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -42,6 +43,45 @@ bool CoreChecks::IsBeforeCtsVersion(uint32_t major, uint32_t minor, uint32_t sub
     return phys_dev_props_core12.conformanceVersion.subminor < subminor;
 }
 
+bool CoreChecks::ValidateInParallel(uint32_t count, const std::function<bool(uint32_t)> &validate) const {
+    bool skip = false;
+    if (!pipeline_validation_pool || count < 2) {
+        for (uint32_t i = 0; i < count; i++) {
+            skip |= validate(i);
+        }
+        return skip;
+    }
+
+    struct TaskResult {
+        bool skip = false;
+        DeferredMessages messages;
+    };
+    std::vector<TaskResult> results(count);
+    {
+        vvl::TaskGroup tasks(*pipeline_validation_pool);
+        for (uint32_t i = 0; i < count; i++) {
+            tasks.Post([&validate, &result = results[i], i]() {
+                DebugReport::SetThreadDeferredMessages(&result.messages);
+                result.skip = validate(i);
+                DebugReport::SetThreadDeferredMessages(nullptr);
+            });
+        }
+        // Shader modules are also validated as part of a pipeline, which may already be a task of the pool
+        vvl::ThreadPool::BlockingScope blocking_scope;
+        tasks.Wait();
+    }
+    for (TaskResult &result : results) {
+        skip |= result.skip;
+        skip |= debug_report->ReportDeferredMessages(result.messages);
+    }
+    return skip;
+}
+
+bool CoreChecks::ValidatePipelineCreateInfos(uint32_t count, const std::function<bool(uint32_t)> &validate) const {
+    // The checks of a pipeline only read state, the pipeline states were all created before PreCallValidate
+    return ValidateInParallel(count, validate);
+}
+
 bool CoreChecks::ValidatePipelineCacheControlFlags(VkPipelineCreateFlags2KHR flags, const Location &loc, const char *vuid) const {
     bool skip = false;
     if (enabled_features.pipelineCreationCacheControl == VK_FALSE) {
@@ -691,7 +731,18 @@ bool CoreChecks::ValidatePipelineShaderStage(const vvl::Pipeline &pipeline,
                              "pNext chain. (stage %s).",
                              string_VkShaderStageFlagBits(stage_ci.stage));
         } else {
-            skip |= ValidateShaderModuleCreateInfo(*module_create_info, loc.pNext(Struct::VkShaderModuleCreateInfo));
+            // Without libraries, the stage state of this stage was parsed from module_create_info and has its hash
+            const spirv::Module *module_state = nullptr;
+            if (!pipeline.library_create_info) {
+                for (const auto &stage_state : pipeline.stage_states) {
+                    if (stage_state.pipeline_create_info == &stage_ci && stage_state.spirv_state &&
+                        stage_state.spirv_state->words_.size() == module_create_info->codeSize / sizeof(uint32_t)) {
+                        module_state = stage_state.spirv_state.get();
+                        break;
+                    }
+                }
+            }
+            skip |= ValidateShaderModuleCreateInfo(*module_create_info, loc.pNext(Struct::VkShaderModuleCreateInfo), module_state);
         }
     }
     return skip;
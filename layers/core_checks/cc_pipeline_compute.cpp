@@ -32,9 +32,10 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
                                                                     pPipelines, error_obj, pipeline_states, chassis_state);
 
     skip |= ValidateDeviceQueueSupport(error_obj.location);
-    for (uint32_t i = 0; i < count; i++) {
+    skip |= ValidatePipelineCreateInfos(count, [&](uint32_t i) {
+        bool skip = false;
         const vvl::Pipeline *pipeline = pipeline_states[i].get();
-        ASSERT_AND_CONTINUE(pipeline);
+        ASSERT_AND_RETURN_SKIP(pipeline);
 
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
         const Location stage_info = create_info_loc.dot(Field::stage);
@@ -62,7 +63,8 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
             skip |= ValidateSpirvStateless(*chassis_state.stateless_data.pipeline_pnext_module, chassis_state.stateless_data,
                                            create_info_loc.dot(Field::stage).pNext(Struct::VkShaderModuleCreateInfo, Field::pCode));
         }
-    }
+        return skip;
+    });
     return skip;
 }
 
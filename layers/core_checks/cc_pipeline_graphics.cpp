@@ -42,9 +42,28 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                                                                      pPipelines, error_obj, pipeline_states, chassis_state);
 
     skip |= ValidateDeviceQueueSupport(error_obj.location);
-    for (uint32_t i = 0; i < count; i++) {
+    skip |= ValidatePipelineCreateInfos(count, [&](uint32_t i) {
+        bool skip = false;
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
-        skip |= ValidateGraphicsPipeline(*pipeline_states[i].get(), pCreateInfos[i].pNext, create_info_loc);
+        const vvl::Pipeline &pipeline = *pipeline_states[i].get();
+        GraphicsPipelineValidationCache::Key cache_key;
+        const bool cacheable = GraphicsPipelineValidationCache::BuildKey(pipeline, cache_key);
+        if (cacheable && graphics_pipeline_validation_cache.Contains(cache_key)) {
+            // Identical to a pipeline without errors, only the spirv-val of modules not used before is left to report
+            if (spirv_validation_pool) {
+                for (const auto &stage_state : pipeline.stage_states) {
+                    skip |= ReportPendingSpirvValidation(*stage_state.spirv_state);
+                }
+            }
+        } else {
+            // The returned skip can't tell whether the pipeline is valid, messages that are deferred, filtered out or over the
+            // duplicate limit all return false
+            const uint64_t message_count = DebugReport::ThreadMessageCount();
+            skip |= ValidateGraphicsPipeline(pipeline, pCreateInfos[i].pNext, create_info_loc);
+            if (cacheable && DebugReport::ThreadMessageCount() == message_count) {
+                graphics_pipeline_validation_cache.Insert(std::move(cache_key), pipeline);
+            }
+        }
         skip |= ValidateGraphicsPipelineDerivatives(pipeline_states, i, create_info_loc);
 
         // From dumping traces, we found almost all apps only create one pipeline at a time. To greatly simplify the logic, only
@@ -60,7 +79,8 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                 }
             }
         }
-    }
+        return skip;
+    });
     return skip;
 }
 
@@ -708,10 +728,7 @@ bool CoreChecks::ValidateGraphicsPipelineLibrary(const vvl::Pipeline &pipeline,
     if (pipeline.library_create_info) {
         skip |= ValidatePipelineLibraryCreateInfo(pipeline, *pipeline.library_create_info, create_info_loc);
 
-        for (uint32_t i = 0; i < pipeline.library_create_info->libraryCount; ++i) {
-            const auto lib = Get<vvl::Pipeline>(pipeline.library_create_info->pLibraries[i]);
-            if (!lib) continue;
-
+        for (const auto &lib : pipeline.library_states) {
             const auto &lib_ci = lib->GraphicsCreateInfo();
             if (lib->graphics_lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT) {
                 pre_raster_info.init = GPLInitType::link_libraries;
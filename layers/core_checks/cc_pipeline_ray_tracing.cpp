@@ -175,9 +175,10 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, VkP
                                                                          pPipelines, error_obj, pipeline_states, chassis_state);
 
     skip |= ValidateDeviceQueueSupport(error_obj.location);
-    for (uint32_t i = 0; i < count; i++) {
+    skip |= ValidatePipelineCreateInfos(count, [&](uint32_t i) {
+        bool skip = false;
         const vvl::Pipeline *pipeline = pipeline_states[i].get();
-        ASSERT_AND_CONTINUE(pipeline);
+        ASSERT_AND_RETURN_SKIP(pipeline);
 
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
         const auto &create_info = pipeline->RayTracingCreateInfo();
@@ -206,7 +207,8 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, VkP
         }
         skip |= ValidatePipelineCacheControlFlags(pCreateInfos[i].flags, create_info_loc.dot(Field::flags),
                                                   "VUID-VkRayTracingPipelineCreateInfoNV-pipelineCreationCacheControl-02905");
-    }
+        return skip;
+    });
     return skip;
 }
 
@@ -224,9 +226,10 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice device, Vk
     skip |= ValidateDeferredOperation(device, deferredOperation, error_obj.location.dot(Field::deferredOperation),
                                       "VUID-vkCreateRayTracingPipelinesKHR-deferredOperation-03678");
 
-    for (uint32_t i = 0; i < count; i++) {
+    skip |= ValidatePipelineCreateInfos(count, [&](uint32_t i) {
+        bool skip = false;
         const vvl::Pipeline *pipeline = pipeline_states[i].get();
-        ASSERT_AND_CONTINUE(pipeline);
+        ASSERT_AND_RETURN_SKIP(pipeline);
 
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
         const auto &create_info = pipeline->RayTracingCreateInfo();
@@ -303,7 +306,8 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice device, Vk
                 }
             }
         }
-    }
+        return skip;
+    });
 
     return skip;
 }
@@ -0,0 +1,441 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core_checks/cc_pipeline_validation_cache.h"
+
+#include <cstring>
+#include <mutex>
+
+#include "state_tracker/pipeline_state.h"
+#include "state_tracker/render_pass_state.h"
+#include "state_tracker/shader_module.h"
+#include "utils/hash_util.h"
+
+namespace {
+
+// Appends values to the key one member at a time, so padding in the Vulkan structs never ends up in it
+class KeyWriter {
+  public:
+    explicit KeyWriter(GraphicsPipelineValidationCache::Key &key) : key_(key) {}
+
+    void U32(uint32_t value) { key_.emplace_back(value); }
+    void U64(uint64_t value) {
+        U32(static_cast<uint32_t>(value));
+        U32(static_cast<uint32_t>(value >> 32));
+    }
+    void F32(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        U32(bits);
+    }
+    void Address(const void *pointer) { U64(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer))); }
+    void Bytes(const void *data, size_t size) {
+        U64(size);
+        const size_t begin = key_.size();
+        key_.resize(begin + (size + sizeof(uint32_t) - 1) / sizeof(uint32_t), 0);
+        if (size != 0) {
+            std::memcpy(key_.data() + begin, data, size);
+        }
+    }
+    void String(const char *string) { Bytes(string, string ? std::strlen(string) : 0); }
+
+    // Writes if the struct is there, the structs chained to it are not part of the key so it must have none
+    template <typename T>
+    bool Present(const T *state) {
+        U32(state != nullptr);
+        return !state || !state->pNext;
+    }
+
+  private:
+    GraphicsPipelineValidationCache::Key &key_;
+};
+
+bool WriteShaderStages(const vvl::Pipeline &pipeline, KeyWriter &writer) {
+    writer.U32(static_cast<uint32_t>(pipeline.stage_states.size()));
+    for (const auto &stage_state : pipeline.stage_states) {
+        const auto *stage_ci = stage_state.pipeline_create_info;
+        if (!stage_ci || !stage_state.spirv_state) {
+            return false;
+        }
+        for (auto *pnext = reinterpret_cast<const VkBaseInStructure *>(stage_ci->pNext); pnext; pnext = pnext->pNext) {
+            if (pnext->sType == VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO) {
+                const auto *subgroup_size = reinterpret_cast<const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo *>(pnext);
+                writer.U32(subgroup_size->requiredSubgroupSize);
+            } else if (pnext->sType != VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO) {
+                // An inline VkShaderModuleCreateInfo is already in spirv_state, anything else is unknown
+                return false;
+            }
+        }
+        writer.U32(stage_ci->flags);
+        writer.U32(stage_ci->stage);
+        writer.U64(stage_state.spirv_state->hash_.low);
+        writer.U64(stage_state.spirv_state->hash_.high);
+        writer.String(stage_ci->pName);
+        const auto *specialization = stage_ci->pSpecializationInfo;
+        writer.U32(specialization != nullptr);
+        if (specialization) {
+            writer.U32(specialization->mapEntryCount);
+            for (uint32_t i = 0; i < specialization->mapEntryCount; ++i) {
+                const VkSpecializationMapEntry &entry = specialization->pMapEntries[i];
+                writer.U32(entry.constantID);
+                writer.U32(entry.offset);
+                writer.U64(entry.size);
+            }
+            writer.Bytes(specialization->pData, specialization->dataSize);
+        }
+    }
+    return true;
+}
+
+bool WriteFixedFunctionState(const vku::safe_VkGraphicsPipelineCreateInfo &ci, KeyWriter &writer) {
+    const auto *vertex_input = ci.pVertexInputState;
+    if (!writer.Present(vertex_input)) {
+        return false;
+    }
+    if (vertex_input) {
+        writer.U32(vertex_input->flags);
+        writer.U32(vertex_input->vertexBindingDescriptionCount);
+        for (uint32_t i = 0; i < vertex_input->vertexBindingDescriptionCount; ++i) {
+            const VkVertexInputBindingDescription &binding = vertex_input->pVertexBindingDescriptions[i];
+            writer.U32(binding.binding);
+            writer.U32(binding.stride);
+            writer.U32(binding.inputRate);
+        }
+        writer.U32(vertex_input->vertexAttributeDescriptionCount);
+        for (uint32_t i = 0; i < vertex_input->vertexAttributeDescriptionCount; ++i) {
+            const VkVertexInputAttributeDescription &attribute = vertex_input->pVertexAttributeDescriptions[i];
+            writer.U32(attribute.location);
+            writer.U32(attribute.binding);
+            writer.U32(attribute.format);
+            writer.U32(attribute.offset);
+        }
+    }
+
+    const auto *input_assembly = ci.pInputAssemblyState;
+    if (!writer.Present(input_assembly)) {
+        return false;
+    }
+    if (input_assembly) {
+        writer.U32(input_assembly->flags);
+        writer.U32(input_assembly->topology);
+        writer.U32(input_assembly->primitiveRestartEnable);
+    }
+
+    const auto *tessellation = ci.pTessellationState;
+    if (!writer.Present(tessellation)) {
+        return false;
+    }
+    if (tessellation) {
+        writer.U32(tessellation->flags);
+        writer.U32(tessellation->patchControlPoints);
+    }
+
+    const auto *viewport = ci.pViewportState;
+    if (!writer.Present(viewport)) {
+        return false;
+    }
+    if (viewport) {
+        writer.U32(viewport->flags);
+        writer.U32(viewport->viewportCount);
+        writer.U32(viewport->pViewports != nullptr);
+        for (uint32_t i = 0; viewport->pViewports && i < viewport->viewportCount; ++i) {
+            const VkViewport &vp = viewport->pViewports[i];
+            writer.F32(vp.x);
+            writer.F32(vp.y);
+            writer.F32(vp.width);
+            writer.F32(vp.height);
+            writer.F32(vp.minDepth);
+            writer.F32(vp.maxDepth);
+        }
+        writer.U32(viewport->scissorCount);
+        writer.U32(viewport->pScissors != nullptr);
+        for (uint32_t i = 0; viewport->pScissors && i < viewport->scissorCount; ++i) {
+            const VkRect2D &scissor = viewport->pScissors[i];
+            writer.U32(static_cast<uint32_t>(scissor.offset.x));
+            writer.U32(static_cast<uint32_t>(scissor.offset.y));
+            writer.U32(scissor.extent.width);
+            writer.U32(scissor.extent.height);
+        }
+    }
+
+    const auto *rasterization = ci.pRasterizationState;
+    if (!writer.Present(rasterization)) {
+        return false;
+    }
+    if (rasterization) {
+        writer.U32(rasterization->flags);
+        writer.U32(rasterization->depthClampEnable);
+        writer.U32(rasterization->rasterizerDiscardEnable);
+        writer.U32(rasterization->polygonMode);
+        writer.U32(rasterization->cullMode);
+        writer.U32(rasterization->frontFace);
+        writer.U32(rasterization->depthBiasEnable);
+        writer.F32(rasterization->depthBiasConstantFactor);
+        writer.F32(rasterization->depthBiasClamp);
+        writer.F32(rasterization->depthBiasSlopeFactor);
+        writer.F32(rasterization->lineWidth);
+    }
+
+    const auto *multisample = ci.pMultisampleState;
+    if (!writer.Present(multisample)) {
+        return false;
+    }
+    if (multisample) {
+        writer.U32(multisample->flags);
+        writer.U32(multisample->rasterizationSamples);
+        writer.U32(multisample->sampleShadingEnable);
+        writer.F32(multisample->minSampleShading);
+        writer.U32(multisample->pSampleMask != nullptr);
+        if (multisample->pSampleMask) {
+            const uint32_t mask_count = (static_cast<uint32_t>(multisample->rasterizationSamples) + 31) / 32;
+            for (uint32_t i = 0; i < mask_count; ++i) {
+                writer.U32(multisample->pSampleMask[i]);
+            }
+        }
+        writer.U32(multisample->alphaToCoverageEnable);
+        writer.U32(multisample->alphaToOneEnable);
+    }
+
+    const auto *depth_stencil = ci.pDepthStencilState;
+    if (!writer.Present(depth_stencil)) {
+        return false;
+    }
+    if (depth_stencil) {
+        writer.U32(depth_stencil->flags);
+        writer.U32(depth_stencil->depthTestEnable);
+        writer.U32(depth_stencil->depthWriteEnable);
+        writer.U32(depth_stencil->depthCompareOp);
+        writer.U32(depth_stencil->depthBoundsTestEnable);
+        writer.U32(depth_stencil->stencilTestEnable);
+        for (const VkStencilOpState &op : {depth_stencil->front, depth_stencil->back}) {
+            writer.U32(op.failOp);
+            writer.U32(op.passOp);
+            writer.U32(op.depthFailOp);
+            writer.U32(op.compareOp);
+            writer.U32(op.compareMask);
+            writer.U32(op.writeMask);
+            writer.U32(op.reference);
+        }
+        writer.F32(depth_stencil->minDepthBounds);
+        writer.F32(depth_stencil->maxDepthBounds);
+    }
+
+    const auto *color_blend = ci.pColorBlendState;
+    if (!writer.Present(color_blend)) {
+        return false;
+    }
+    if (color_blend) {
+        writer.U32(color_blend->flags);
+        writer.U32(color_blend->logicOpEnable);
+        writer.U32(color_blend->logicOp);
+        writer.U32(color_blend->attachmentCount);
+        writer.U32(color_blend->pAttachments != nullptr);
+        for (uint32_t i = 0; color_blend->pAttachments && i < color_blend->attachmentCount; ++i) {
+            const VkPipelineColorBlendAttachmentState &attachment = color_blend->pAttachments[i];
+            writer.U32(attachment.blendEnable);
+            writer.U32(attachment.srcColorBlendFactor);
+            writer.U32(attachment.dstColorBlendFactor);
+            writer.U32(attachment.colorBlendOp);
+            writer.U32(attachment.srcAlphaBlendFactor);
+            writer.U32(attachment.dstAlphaBlendFactor);
+            writer.U32(attachment.alphaBlendOp);
+            writer.U32(attachment.colorWriteMask);
+        }
+        for (float constant : color_blend->blendConstants) {
+            writer.F32(constant);
+        }
+    }
+
+    const auto *dynamic = ci.pDynamicState;
+    if (!writer.Present(dynamic)) {
+        return false;
+    }
+    if (dynamic) {
+        writer.U32(dynamic->flags);
+        writer.U32(dynamic->dynamicStateCount);
+        for (uint32_t i = 0; i < dynamic->dynamicStateCount; ++i) {
+            writer.U32(dynamic->pDynamicStates[i]);
+        }
+    }
+    return true;
+}
+
+bool WriteAttachmentReference(const vku::safe_VkAttachmentReference2 *reference, KeyWriter &writer) {
+    if (!writer.Present(reference)) {
+        return false;
+    }
+    if (reference) {
+        writer.U32(reference->attachment);
+        writer.U32(reference->layout);
+        writer.U32(reference->aspectMask);
+    }
+    return true;
+}
+
+bool WriteRenderPass(const vvl::RenderPass &rp_state, KeyWriter &writer) {
+    const auto &rp_ci = rp_state.create_info;
+    if (rp_ci.pNext) {
+        return false;
+    }
+    writer.U32(rp_ci.flags);
+    writer.U32(rp_state.has_multiview_enabled);
+    writer.U32(rp_ci.attachmentCount);
+    for (uint32_t i = 0; i < rp_ci.attachmentCount; ++i) {
+        const auto &attachment = rp_ci.pAttachments[i];
+        if (attachment.pNext) {
+            return false;
+        }
+        writer.U32(attachment.flags);
+        writer.U32(attachment.format);
+        writer.U32(attachment.samples);
+        writer.U32(attachment.loadOp);
+        writer.U32(attachment.storeOp);
+        writer.U32(attachment.stencilLoadOp);
+        writer.U32(attachment.stencilStoreOp);
+        writer.U32(attachment.initialLayout);
+        writer.U32(attachment.finalLayout);
+    }
+    writer.U32(rp_ci.subpassCount);
+    for (uint32_t i = 0; i < rp_ci.subpassCount; ++i) {
+        const auto &subpass = rp_ci.pSubpasses[i];
+        if (subpass.pNext) {
+            return false;
+        }
+        writer.U32(subpass.flags);
+        writer.U32(subpass.pipelineBindPoint);
+        writer.U32(subpass.viewMask);
+        writer.U32(subpass.inputAttachmentCount);
+        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
+            if (!WriteAttachmentReference(&subpass.pInputAttachments[j], writer)) {
+                return false;
+            }
+        }
+        writer.U32(subpass.colorAttachmentCount);
+        writer.U32(subpass.pResolveAttachments != nullptr);
+        for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
+            if (!WriteAttachmentReference(&subpass.pColorAttachments[j], writer) ||
+                (subpass.pResolveAttachments && !WriteAttachmentReference(&subpass.pResolveAttachments[j], writer))) {
+                return false;
+            }
+        }
+        if (!WriteAttachmentReference(subpass.pDepthStencilAttachment, writer)) {
+            return false;
+        }
+        writer.U32(subpass.preserveAttachmentCount);
+        for (uint32_t j = 0; j < subpass.preserveAttachmentCount; ++j) {
+            writer.U32(subpass.pPreserveAttachments[j]);
+        }
+    }
+    writer.U32(rp_ci.dependencyCount);
+    for (uint32_t i = 0; i < rp_ci.dependencyCount; ++i) {
+        const auto &dependency = rp_ci.pDependencies[i];
+        if (dependency.pNext) {
+            return false;
+        }
+        writer.U32(dependency.srcSubpass);
+        writer.U32(dependency.dstSubpass);
+        writer.U32(dependency.srcStageMask);
+        writer.U32(dependency.dstStageMask);
+        writer.U32(dependency.srcAccessMask);
+        writer.U32(dependency.dstAccessMask);
+        writer.U32(dependency.dependencyFlags);
+        writer.U32(static_cast<uint32_t>(dependency.viewOffset));
+    }
+    writer.U32(rp_ci.correlatedViewMaskCount);
+    for (uint32_t i = 0; i < rp_ci.correlatedViewMaskCount; ++i) {
+        writer.U32(rp_ci.pCorrelatedViewMasks[i]);
+    }
+    return true;
+}
+
+}  // namespace
+
+bool GraphicsPipelineValidationCache::BuildKey(const vvl::Pipeline &pipeline, Key &key) {
+    // Libraries and derivatives depend on other pipelines, they are not worth describing
+    if (pipeline.library_create_info ||
+        (pipeline.create_flags & (VK_PIPELINE_CREATE_2_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_2_DERIVATIVE_BIT_KHR)) != 0) {
+        return false;
+    }
+    const auto &ci = pipeline.GraphicsCreateInfo();
+    const VkPipelineRenderingCreateInfo *rendering_ci = nullptr;
+    for (auto *pnext = reinterpret_cast<const VkBaseInStructure *>(ci.pNext); pnext; pnext = pnext->pNext) {
+        if (pnext->sType == VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO) {
+            rendering_ci = reinterpret_cast<const VkPipelineRenderingCreateInfo *>(pnext);
+        } else if (pnext->sType != VK_STRUCTURE_TYPE_PIPELINE_CREATE_FLAGS_2_CREATE_INFO_KHR) {
+            // The flags are already in create_flags
+            return false;
+        }
+    }
+    const auto layout_state = pipeline.PipelineLayoutState();
+    if (!layout_state) {
+        return false;
+    }
+    const auto rp_state = pipeline.RenderPassState();
+    if (!rp_state && ci.renderPass != VK_NULL_HANDLE) {
+        return false;
+    }
+
+    key.clear();
+    KeyWriter writer(key);
+    writer.U64(pipeline.create_flags);
+    if (!WriteShaderStages(pipeline, writer) || !WriteFixedFunctionState(ci, writer)) {
+        return false;
+    }
+
+    writer.Address(layout_state->set_compat_ids.empty() ? nullptr : layout_state->set_compat_ids.back().get());
+    writer.Address(layout_state->push_constant_ranges_layout.get());
+    writer.U32(layout_state->create_flags);
+
+    writer.U32(rendering_ci != nullptr);
+    if (rendering_ci) {
+        writer.U32(rendering_ci->viewMask);
+        writer.U32(rendering_ci->colorAttachmentCount);
+        for (uint32_t i = 0; rendering_ci->pColorAttachmentFormats && i < rendering_ci->colorAttachmentCount; ++i) {
+            writer.U32(rendering_ci->pColorAttachmentFormats[i]);
+        }
+        writer.U32(rendering_ci->depthAttachmentFormat);
+        writer.U32(rendering_ci->stencilAttachmentFormat);
+    }
+    // Dynamic rendering is described by the VkPipelineRenderingCreateInfo above
+    const bool render_pass_object = rp_state && !rp_state->UsesDynamicRendering();
+    writer.U32(render_pass_object);
+    if (render_pass_object && !WriteRenderPass(*rp_state, writer)) {
+        return false;
+    }
+    writer.U32(ci.subpass);
+    return true;
+}
+
+size_t GraphicsPipelineValidationCache::KeyHash::operator()(const Key &key) const {
+    return static_cast<size_t>(hash_util::ShaderHash64(key.data(), key.size() * sizeof(uint32_t)));
+}
+
+bool GraphicsPipelineValidationCache::Contains(const Key &key) const {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    return entries_.find(key) != entries_.end();
+}
+
+void GraphicsPipelineValidationCache::Insert(Key &&key, const vvl::Pipeline &pipeline) {
+    const auto layout_state = pipeline.PipelineLayoutState();
+    Entry entry{layout_state->set_compat_ids.empty() ? nullptr : layout_state->set_compat_ids.back(),
+                layout_state->push_constant_ranges_layout};
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    if (entries_.size() >= kMaxEntries) {
+        entries_.clear();
+    }
+    entries_.emplace(std::move(key), std::move(entry));
+}
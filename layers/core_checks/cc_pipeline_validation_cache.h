@@ -0,0 +1,61 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <shared_mutex>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "state_tracker/pipeline_layout_state.h"
+
+namespace vvl {
+class Pipeline;
+}  // namespace vvl
+
+// Remembers the graphics pipelines that ValidateGraphicsPipeline found no error in. Applications recreate identical pipelines
+// when the swapchain is rebuilt or a level is reloaded, those creates can then skip the checks.
+//
+// The key is a canonical copy of everything the checks look at: the create info with its sub-states, the hash of the SPIR-V of
+// each stage, the canonical pipeline layout and the render pass contents. Pipelines using something the key can't describe
+// (libraries, derivatives, pNext structs not listed in BuildKey) are always validated.
+class GraphicsPipelineValidationCache {
+  public:
+    using Key = std::vector<uint32_t>;
+
+    // Returns false if the pipeline can't be cached
+    static bool BuildKey(const vvl::Pipeline &pipeline, Key &key);
+
+    bool Contains(const Key &key) const;
+    void Insert(Key &&key, const vvl::Pipeline &pipeline);
+
+  private:
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+    // The key refers to the canonical layout ids by address, holding them makes sure the addresses are not reused
+    struct Entry {
+        PipelineLayoutCompatId layout_compat_id;
+        PushConstantRangesId push_constant_ranges;
+    };
+
+    // The whole cache is dropped when it gets this big, it only needs to hold the pipelines of a level or two
+    static constexpr size_t kMaxEntries = 4096;
+
+    mutable std::shared_mutex lock_;
+    vvl::unordered_map<Key, Entry, KeyHash> entries_;
+};
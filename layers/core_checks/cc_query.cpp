@@ -1532,9 +1532,7 @@ void CoreChecks::PostCallRecordGetQueryPoolResults(VkDevice device, VkQueryPool
     ASSERT_AND_RETURN(query_pool_state);
 
     if ((flags & VK_QUERY_RESULT_PARTIAL_BIT) == 0) {
-        for (uint32_t i = firstQuery; i < queryCount; ++i) {
-            query_pool_state->SetQueryState(i, 0, QUERYSTATE_AVAILABLE);
-        }
+        query_pool_state->SetQueryStates(firstQuery, queryCount, 0, QUERYSTATE_AVAILABLE);
     }
 }
 
@@ -17,6 +17,7 @@
  * limitations under the License.
  */
 
+#include <deque>
 #include <string>
 #include <vector>
 
@@ -37,8 +38,8 @@ struct CommandBufferSubmitState {
     QFOTransferCBScoreboards<QFOBufferTransferBarrier> qfo_buffer_scoreboards;
     std::vector<VkCommandBuffer> current_cmds;
     GlobalImageLayoutMap overlay_image_layout_map;
-    std::vector<std::string> cmdbuf_label_stack;
-    std::string last_closed_cmdbuf_label;
+    std::vector<uint32_t> cmdbuf_label_stack;
+    uint32_t last_closed_cmdbuf_label;
     bool found_unbalanced_cmdbuf_label;
 
     // The "local" prefix is about tracking state within a *single* queue submission
@@ -48,12 +49,26 @@ struct CommandBufferSubmitState {
     EventMap local_event_signal_info;
     vvl::unordered_map<VkVideoSessionKHR, vvl::VideoSessionDeviceState> local_video_session_state{};
 
+    // Results of the checks that were handed to the worker pool, one entry per command buffer in submission order.
+    // A deque keeps the entries in place while workers write to them.
+    struct WorkerResult {
+        bool skip = false;
+        DeferredMessages messages;
+    };
+    std::deque<WorkerResult> worker_results;
+    // Only set when parallel submit validation is enabled. Declared after worker_results so it waits for the workers first.
+    std::unique_ptr<vvl::TaskGroup> worker_tasks;
+
     CommandBufferSubmitState(const CoreChecks &c, const vvl::Queue *q) : core(c), queue_state(q) {
         // Queue label state is updated during PostRecord phase.
         // Copy state to be able to track labels during validation.
         cmdbuf_label_stack = queue_state->cmdbuf_label_stack;
         last_closed_cmdbuf_label = queue_state->last_closed_cmdbuf_label;
         found_unbalanced_cmdbuf_label = queue_state->found_unbalanced_cmdbuf_label;
+
+        if (core.submit_validation_pool) {
+            worker_tasks = std::make_unique<vvl::TaskGroup>(*core.submit_validation_pool);
+        }
     }
 
     bool Validate(const Location &loc, const vvl::CommandBuffer &cb_state, uint32_t perf_pass) {
@@ -72,19 +87,20 @@ struct CommandBufferSubmitState {
             return true;
         }
 
-        // Call submit-time functions to validate or update local mirrors of state (to preserve const-ness at validate time)
-        for (auto &function : cb_state.queue_submit_functions) {
-            skip |= function(core, *queue_state, cb_state);
-        }
-        for (auto &function : cb_state.eventUpdates) {
-            skip |= function(const_cast<vvl::CommandBuffer &>(cb_state), /*do_validate*/ true, local_event_signal_info,
-                             queue_state->VkHandle(), loc);
+        if (worker_tasks) {
+            // Everything above tracks state across the command buffers of the submission and has to stay in order.
+            // The submit-time functions only read state, so they run on the pool.
+            ValidateOnWorker(loc, cb_state);
+        } else {
+            // Call submit-time functions to validate or update local mirrors of state (to preserve const-ness at validate time)
+            for (auto &function : cb_state.queue_submit_functions) {
+                skip |= function(core, *queue_state, cb_state);
+            }
         }
+        auto &mutable_cb_state = const_cast<vvl::CommandBuffer &>(cb_state);
+        skip |= mutable_cb_state.UpdateEvents(/*do_validate*/ true, local_event_signal_info, queue_state->VkHandle(), loc);
         VkQueryPool first_perf_query_pool = VK_NULL_HANDLE;
-        for (auto &function : cb_state.queryUpdates) {
-            skip |= function(const_cast<vvl::CommandBuffer &>(cb_state), /*do_validate*/ true, first_perf_query_pool, perf_pass,
-                             &local_query_to_state_map);
-        }
+        skip |= mutable_cb_state.UpdateQueries(/*do_validate*/ true, first_perf_query_pool, perf_pass, &local_query_to_state_map);
 
         for (const auto &it : cb_state.video_session_updates) {
             auto video_session_state = core.Get<vvl::VideoSession>(it.first);
@@ -99,7 +115,40 @@ struct CommandBufferSubmitState {
         return skip;
     }
 
+    // Waits for the checks running on the pool and reports their messages in submission order
+    bool Finish() {
+        bool skip = false;
+        if (!worker_tasks) {
+            return skip;
+        }
+        worker_tasks->Wait();
+        for (WorkerResult &result : worker_results) {
+            skip |= result.skip;
+            skip |= core.debug_report->ReportDeferredMessages(result.messages);
+        }
+        worker_results.clear();
+        return skip;
+    }
+
 private:
+    void ValidateOnWorker(const Location &loc, const vvl::CommandBuffer &cb_state) {
+        WorkerResult &result = worker_results.emplace_back();
+        const vvl::EncodedLocation encoded_loc(loc);
+        worker_tasks->Post([this, &result, encoded_loc, cmd = cb_state.VkHandle()]() {
+            auto cb_state = core.GetRead<vvl::CommandBuffer>(cmd);
+            if (!cb_state) {
+                return;
+            }
+            const vvl::LocationCapture loc_capture(encoded_loc);
+            const Location &loc = loc_capture.Get();
+            DebugReport::SetThreadDeferredMessages(&result.messages);
+            for (auto &function : cb_state->queue_submit_functions) {
+                result.skip |= function(core, *queue_state, *cb_state);
+            }
+            DebugReport::SetThreadDeferredMessages(nullptr);
+        });
+    }
+
     bool ValidateCmdBufLabelMatching(const Location &loc, const vvl::CommandBuffer &cb_state) {
         bool skip = false;
         if (found_unbalanced_cmdbuf_label) {
@@ -109,7 +158,7 @@ private:
         }
         for (const auto &command : cb_state.GetLabelCommands()) {
             if (command.begin) {
-                cmdbuf_label_stack.emplace_back(command.label_name);
+                cmdbuf_label_stack.emplace_back(command.label_id);
             } else {
                 if (cmdbuf_label_stack.empty()) {
                     found_unbalanced_cmdbuf_label = true;
@@ -121,11 +170,12 @@ private:
         }
         if (found_unbalanced_cmdbuf_label) {
             std::string previous_debug_region;
-            if (last_closed_cmdbuf_label.empty()) {
+            if (last_closed_cmdbuf_label == vvl::LabelNames::kNoLabel ||
+                core.label_names.GetName(last_closed_cmdbuf_label).empty()) {
                 previous_debug_region = "There are no previous debug regions before the invalid command.";
             } else {
-                previous_debug_region =
-                    std::string("The previous debug region before the invalid command is '") + last_closed_cmdbuf_label + "'.";
+                previous_debug_region = std::string("The previous debug region before the invalid command is '") +
+                                        core.label_names.GetName(last_closed_cmdbuf_label) + "'.";
             }
             skip |= core.LogError("VUID-vkCmdEndDebugUtilsLabelEXT-commandBuffer-01912", cb_state.Handle(), loc,
                                   "(%s) contains vkCmdEndDebugUtilsLabelEXT that does not have a matching "
@@ -256,6 +306,7 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
         }
     }
 
+    skip |= cb_submit_state.Finish();
     return skip;
 }
 
@@ -389,6 +440,7 @@ bool CoreChecks::ValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const
         }
     }
 
+    skip |= cb_submit_state.Finish();
     return skip;
 }
 
@@ -572,8 +624,8 @@ bool CoreChecks::ValidateCommandBufferSimultaneousUse(const Location &loc, const
     using sync_vuid_maps::SubmitError;
 
     bool skip = false;
-    if ((cb_state.InUse() || current_submit_count > 1) &&
-        !(cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
+    if (!(cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT) &&
+        (current_submit_count > 1 || InUseAfterObservedSemaphores(cb_state, loc))) {
         const auto &vuid = sync_vuid_maps::GetQueueSubmitVUID(loc, SubmitError::kCmdNotSimultaneous);
 
         skip |= LogError(vuid, device, loc, "%s is already in use and is not marked for simultaneous use.",
@@ -145,71 +145,120 @@ bool CoreChecks::PreCallValidateGetAccelerationStructureHandleNV(VkDevice device
     return skip;
 }
 
-bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList &objlist, uint32_t infoCount,
-                                                               const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
-                                                               uint32_t info_i, const ErrorObject &error_obj) const {
-    using sparse_container::range;
-
+bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList &objlist, uint32_t info_count,
+                                                               const VkAccelerationStructureBuildGeometryInfoKHR *p_infos,
+                                                               const ErrorObject &error_obj) const {
     bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+    const Func function = error_obj.location.function;
+    const char *src_dst_vuid = function == Func::vkCmdBuildAccelerationStructuresKHR
+                                   ? "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668"
+                               : function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                   ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668"
+                                   : "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668";
+    const char *dst_other_src_vuid = function == Func::vkCmdBuildAccelerationStructuresKHR
+                                         ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701"
+                                     : function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                         ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701"
+                                         : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701";
+    const char *dst_other_dst_vuid = function == Func::vkCmdBuildAccelerationStructuresKHR
+                                         ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702"
+                                     : function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                         ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702"
+                                         : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702";
+
+    // Instead of comparing the acceleration structures of every pair of infos, the memory ranges backing the destination
+    // acceleration structures and the sources of the updates are sorted, and only the pairs found overlapping by a sweep
+    // are compared.
+    struct BoundRange {
+        VkDeviceMemory memory;
+        sparse_container::range<VkDeviceSize> range;
+        uint32_t info_i;
+        bool is_src;
+    };
+    std::vector<std::shared_ptr<const vvl::AccelerationStructureKHR>> src_as_states(info_count);
+    std::vector<std::shared_ptr<const vvl::AccelerationStructureKHR>> dst_as_states(info_count);
+    std::vector<BoundRange> bound_ranges;
+    auto add_bound_ranges = [&bound_ranges](const vvl::AccelerationStructureKHR &as_state, uint32_t info_i, bool is_src) {
+        if (!as_state.buffer_state) {
+            return;
+        }
+        // Same range as ValidateAccelStructsMemoryDoNotOverlap
+        const sparse_container::range<VkDeviceSize> range(as_state.create_info.offset, as_state.create_info.size);
+        for (const auto &[memory, memory_ranges] : as_state.buffer_state->GetBoundMemoryRange(range)) {
+            for (const auto &memory_range : memory_ranges) {
+                if (!memory_range.empty()) {
+                    bound_ranges.emplace_back(BoundRange{memory, memory_range, info_i, is_src});
+                }
+            }
+        }
+    };
 
-    const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+    for (uint32_t info_i = 0; info_i < info_count; ++info_i) {
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = p_infos[info_i];
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        src_as_states[info_i] = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
+        dst_as_states[info_i] = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+        const auto &src_as_state = src_as_states[info_i];
+        const auto &dst_as_state = dst_as_states[info_i];
+
+        const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+        if (info_in_mode_update && info.srcAccelerationStructure != info.dstAccelerationStructure && src_as_state &&
+            dst_as_state) {
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *src_as_state,
+                                                           info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
+                                                           info_i_loc.dot(Field::dstAccelerationStructure), src_dst_vuid);
+        }
 
-    if (info_in_mode_update && info.srcAccelerationStructure != info.dstAccelerationStructure && src_as_state && dst_as_state) {
-        const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668"
-                           : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668"
-                               : "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668";
-        skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *src_as_state,
-                                                       info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
-                                                       info_i_loc.dot(Field::dstAccelerationStructure), vuid);
+        if (dst_as_state) {
+            add_bound_ranges(*dst_as_state, info_i, false);
+        }
+        // Destination acceleration structures must not overlap the source of another info updating it
+        if (src_as_state && info_in_mode_update) {
+            add_bound_ranges(*src_as_state, info_i, true);
+        }
+    }
+    if (bound_ranges.size() < 2) {
+        return skip;
     }
 
-    // Loop on other acceleration structure builds info.
-    // Given that comparisons are commutative, only need to consider elements after info_i
-    assert(infoCount > info_i);
-    for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
-        // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
-        // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
-        // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
-        // overlap, an error will be logged.
-
-        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
-
-        const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(other_info->dstAccelerationStructure);
-        const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(other_info->srcAccelerationStructure);
-
-        // Validate destination acceleration structure's memory is not overlapped by another source acceleration structure's
-        // memory that is going to be updated by this cmd
-        if (dst_as_state && other_src_as_state) {
-            if (other_info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR) {
-                const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701"
-                                   : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701"
-                                       : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701";
+    std::sort(bound_ranges.begin(), bound_ranges.end(), [](const BoundRange &lhs, const BoundRange &rhs) {
+        return lhs.memory < rhs.memory || (lhs.memory == rhs.memory && lhs.range.begin < rhs.range.begin);
+    });
 
-                skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                               info_i_loc.dot(Field::dstAccelerationStructure), *other_src_as_state,
-                                                               other_info_j_loc.dot(Field::srcAccelerationStructure), vuid);
+    // A resource bound to several ranges of a memory gives several overlapping range pairs, each pair of infos is reported once
+    vvl::unordered_set<uint64_t> checked_dst_src_pairs;
+    vvl::unordered_set<uint64_t> checked_dst_dst_pairs;
+    for (size_t a = 0; a < bound_ranges.size(); ++a) {
+        const BoundRange &range_a = bound_ranges[a];
+        for (size_t b = a + 1; b < bound_ranges.size(); ++b) {
+            const BoundRange &range_b = bound_ranges[b];
+            if (range_b.memory != range_a.memory || range_b.range.begin >= range_a.range.end) {
+                break;
+            }
+            if (range_a.info_i == range_b.info_i || (range_a.is_src && range_b.is_src)) {
+                // Overlaps within one info are VUID 03668 checked above, two sources can overlap
+                continue;
+            }
+            // Each info is compared with the infos after it, the destination of an earlier info with the source of a later one
+            const BoundRange &first = range_a.info_i < range_b.info_i ? range_a : range_b;
+            const BoundRange &second = range_a.info_i < range_b.info_i ? range_b : range_a;
+            if (first.is_src) {
+                continue;
+            }
+            const uint64_t pair_key = (uint64_t(first.info_i) << 32) | second.info_i;
+            const Location first_loc = error_obj.location.dot(Field::pInfos, first.info_i);
+            const Location second_loc = error_obj.location.dot(Field::pInfos, second.info_i);
+            if (second.is_src) {
+                if (checked_dst_src_pairs.insert(pair_key).second) {
+                    skip |= ValidateAccelStructsMemoryDoNotOverlap(
+                        error_obj.location, objlist, *dst_as_states[first.info_i], first_loc.dot(Field::dstAccelerationStructure),
+                        *src_as_states[second.info_i], second_loc.dot(Field::srcAccelerationStructure), dst_other_src_vuid);
+                }
+            } else if (checked_dst_dst_pairs.insert(pair_key).second) {
+                skip |= ValidateAccelStructsMemoryDoNotOverlap(
+                    error_obj.location, objlist, *dst_as_states[first.info_i], first_loc.dot(Field::dstAccelerationStructure),
+                    *dst_as_states[second.info_i], second_loc.dot(Field::dstAccelerationStructure), dst_other_dst_vuid);
             }
-        }
-
-        // Validate that there is no destination acceleration structures' memory overlaps
-        if (dst_as_state && other_dst_as_state) {
-            const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702"
-                               : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702"
-                                   : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702";
-
-            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                           info_i_loc.dot(Field::dstAccelerationStructure), *other_dst_as_state,
-                                                           other_info_j_loc.dot(Field::dstAccelerationStructure), vuid);
         }
     }
 
@@ -217,66 +266,67 @@ bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectLi
 }
 
 bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
-    const LogObjectList &objlist, uint32_t info_count, const VkAccelerationStructureBuildGeometryInfoKHR *p_infos, uint32_t info_i,
+    const LogObjectList &objlist, uint32_t info_count, const VkAccelerationStructureBuildGeometryInfoKHR *p_infos,
     const VkAccelerationStructureBuildRangeInfoKHR *const *pp_range_infos, const ErrorObject &error_obj) const {
-    using sparse_container::range;
-
     bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR &info = p_infos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
     const rt::BuildType rt_build_type =
         error_obj.location.function == Func::vkBuildAccelerationStructuresKHR ? rt::BuildType::Host : rt::BuildType::Device;
 
-    const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
-
-    // Cannot compute scratch buffer size from the CPU with indirect calls,
-    // so cannot perform validation
-    vvl::span<vvl::Buffer *const> info_scratches = GetBuffersByAddress(info.scratchData.deviceAddress);
-    const VkDeviceSize assumed_scratch_size = rt::ComputeScratchSize(rt_build_type, device, info, pp_range_infos[info_i]);
+    // Everything a pair of infos is compared with is looked up and computed once per info
+    struct ScratchInfo {
+        std::shared_ptr<const vvl::AccelerationStructureKHR> src_as_state;
+        std::shared_ptr<const vvl::AccelerationStructureKHR> dst_as_state;
+        BuffersAtAddress scratches;
+        VkDeviceSize scratch_size;
+    };
+    std::vector<ScratchInfo> scratch_infos(info_count);
+    for (uint32_t info_i = 0; info_i < info_count; ++info_i) {
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = p_infos[info_i];
+        ScratchInfo &scratch_info = scratch_infos[info_i];
+        scratch_info.src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
+        scratch_info.dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+        scratch_info.scratches = GetBuffersByAddress(info.scratchData.deviceAddress);
+        // Cannot compute scratch buffer size from the CPU with indirect calls, so cannot perform validation
+        scratch_info.scratch_size = rt::ComputeScratchSize(rt_build_type, device, info, pp_range_infos[info_i]);
+    }
+
+    for (uint32_t info_i = 0; info_i < info_count; ++info_i) {
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = p_infos[info_i];
+        const ScratchInfo &scratch_info = scratch_infos[info_i];
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const Location scratch_address_loc = info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress);
+        const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+
+        if (scratch_info.dst_as_state) {
+            vvl::span<vvl::Buffer *const> dummy(nullptr, 0);
+            skip |= ValidateScratchMemoryNoOverlap(error_obj.location, objlist, scratch_info.scratches,
+                                                   info.scratchData.deviceAddress, scratch_info.scratch_size, scratch_address_loc,
+                                                   info_in_mode_update ? scratch_info.src_as_state.get() : nullptr,
+                                                   info_i_loc.dot(Field::srcAccelerationStructure), *scratch_info.dst_as_state,
+                                                   info_i_loc.dot(Field::dstAccelerationStructure), dummy, 0, 0, nullptr);
+        }
 
-    if (dst_as_state) {
-        vvl::span<vvl::Buffer *const> dummy(nullptr, 0);
-        skip |= ValidateScratchMemoryNoOverlap(error_obj.location, objlist, info_scratches, info.scratchData.deviceAddress,
-                                               assumed_scratch_size, info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
-                                               info_in_mode_update ? src_as_state.get() : nullptr,
-                                               info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
-                                               info_i_loc.dot(Field::dstAccelerationStructure), dummy, 0, 0, nullptr);
-    }
-
-    // Loop on other acceleration structure builds info.
-    // Given that comparisons are commutative, only need to consider elements after info_i
-    assert(info_count > info_i);
-    for (uint32_t other_info_j = info_i + 1; other_info_j < info_count; ++other_info_j) {
         // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
         // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
         // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
         // overlap, an error will be logged.
-
-        const VkAccelerationStructureBuildGeometryInfoKHR &other_info = p_infos[other_info_j];
-        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
-
-        const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(other_info.dstAccelerationStructure);
-        const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(other_info.srcAccelerationStructure);
-
-        const bool other_info_in_update_mode = other_info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
-
-        if (other_dst_as_state) {
-            auto other_info_scratches = GetBuffersByAddress(other_info.scratchData.deviceAddress);
-            const VkDeviceSize assumed_other_scratch_size =
-                rt::ComputeScratchSize(rt_build_type, device, other_info, pp_range_infos[other_info_j]);
-
-            const Location other_scratch_loc = other_info_j_loc.dot(Field::scratchData);
-            const Location other_scratch_address_loc = other_scratch_loc.dot(Field::deviceAddress);
+        // Given that comparisons are commutative, only need to consider elements after info_i
+        for (uint32_t other_info_j = info_i + 1; other_info_j < info_count; ++other_info_j) {
+            const VkAccelerationStructureBuildGeometryInfoKHR &other_info = p_infos[other_info_j];
+            const ScratchInfo &other_scratch_info = scratch_infos[other_info_j];
+            if (!other_scratch_info.dst_as_state) {
+                continue;
+            }
+            const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
+            const Location other_scratch_address_loc = other_info_j_loc.dot(Field::scratchData).dot(Field::deviceAddress);
+            const bool other_info_in_update_mode = other_info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
 
             skip |= ValidateScratchMemoryNoOverlap(
-                error_obj.location, objlist, info_scratches, info.scratchData.deviceAddress, assumed_scratch_size,
-                info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
-                other_info_in_update_mode ? other_src_as_state.get() : nullptr,
-                other_info_j_loc.dot(Field::srcAccelerationStructure), *other_dst_as_state,
-                other_info_j_loc.dot(Field::dstAccelerationStructure), other_info_scratches, other_info.scratchData.deviceAddress,
-                assumed_other_scratch_size, &other_scratch_address_loc);
+                error_obj.location, objlist, scratch_info.scratches, info.scratchData.deviceAddress, scratch_info.scratch_size,
+                scratch_address_loc, other_info_in_update_mode ? other_scratch_info.src_as_state.get() : nullptr,
+                other_info_j_loc.dot(Field::srcAccelerationStructure), *other_scratch_info.dst_as_state,
+                other_info_j_loc.dot(Field::dstAccelerationStructure), other_scratch_info.scratches,
+                other_info.scratchData.deviceAddress, other_scratch_info.scratch_size, &other_scratch_address_loc);
         }
     }
 
@@ -892,12 +942,12 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresKHR(
 
         skip |= ValidateAccelerationBuffers(commandBuffer, info_i, *info, ppBuildRangeInfos[info_i], info_loc);
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
-
-        skip |= ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i,
-                                                                                 ppBuildRangeInfos, error_obj);
     }
 
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, error_obj);
+    skip |= ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(commandBuffer, infoCount, pInfos, ppBuildRangeInfos,
+                                                                             error_obj);
+
     return skip;
 }
 
@@ -969,7 +1019,6 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(LogObjectList(), infoCount, pInfos, info_i, error_obj);
         const VkDeviceSize scratch_i_size = rt::ComputeScratchSize(rt::BuildType::Host, device, *info, ppBuildRangeInfos[info_i]);
         auto scratch_i_host_addr = reinterpret_cast<uint64_t>(info->scratchData.hostAddress);
         const sparse_container::range<uint64_t> scratch_addr_range(scratch_i_host_addr, scratch_i_host_addr + scratch_i_size);
@@ -1074,6 +1123,8 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
     }
+
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(LogObjectList(), infoCount, pInfos, error_obj);
     return skip;
 }
 
@@ -1129,12 +1180,12 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(VkComm
             }
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
-
         skip |= CommonBuildAccelerationStructureValidation(*info, info_loc, commandBuffer);
 
         skip |= ValidateAccelerationBuffers(commandBuffer, info_i, *info, nullptr, info_loc);
     }
+
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, error_obj);
     return skip;
 }
 
@@ -25,6 +25,7 @@
 #include <vulkan/vk_enum_string_helper.h>
 #include "generated/chassis.h"
 #include "core_validation.h"
+#include "state_tracker/render_pass_state.h"
 #include "sync/sync_utils.h"
 #include "utils/convert_utils.h"
 #include "error_message/error_strings.h"
@@ -1372,7 +1373,9 @@ bool CoreChecks::ValidateAttachmentReference(VkAttachmentReference2 reference, c
     return skip;
 }
 
-bool CoreChecks::ValidateRenderpassAttachmentUsage(const VkRenderPassCreateInfo2 *pCreateInfo, const ErrorObject &error_obj) const {
+bool CoreChecks::ValidateRenderpassAttachmentUsage(const VkRenderPassCreateInfo2 *pCreateInfo,
+                                                   const vvl::AttachmentUsageIndex &usage_index,
+                                                   const ErrorObject &error_obj) const {
     bool skip = false;
     const bool use_rp2 = error_obj.location.function != Func::vkCreateRenderPass;
     const Location create_info_loc = error_obj.location.dot(Field::pCreateInfo);
@@ -1391,9 +1394,6 @@ bool CoreChecks::ValidateRenderpassAttachmentUsage(const VkRenderPassCreateInfo2
         std::vector<uint8_t> attachment_uses(pCreateInfo->attachmentCount);
         std::vector<VkImageLayout> attachment_layouts(pCreateInfo->attachmentCount);
 
-        // Track if attachments are used as input as well as another type
-        vvl::unordered_set<uint32_t> input_attachments;
-
         if (subpass.pipelineBindPoint != VK_PIPELINE_BIND_POINT_GRAPHICS &&
             subpass.pipelineBindPoint != VK_PIPELINE_BIND_POINT_SUBPASS_SHADING_HUAWEI) {
             const char *vuid = use_rp2 ? "VUID-VkSubpassDescription2-pipelineBindPoint-04953"
@@ -1415,7 +1415,6 @@ bool CoreChecks::ValidateRenderpassAttachmentUsage(const VkRenderPassCreateInfo2
             const Location input_loc = subpass_loc.dot(Field::pInputAttachments, j);
             const Location attachment_loc = create_info_loc.dot(Field::pAttachments, attachment_index);
 
-            input_attachments.insert(attachment_index);
             skip |= ValidateAttachmentIndex(attachment_index, pCreateInfo->attachmentCount, input_loc);
 
             if (aspect_mask & VK_IMAGE_ASPECT_METADATA_BIT) {
@@ -1484,13 +1483,10 @@ bool CoreChecks::ValidateRenderpassAttachmentUsage(const VkRenderPassCreateInfo2
                     skip |= ValidateLayoutVsAttachmentDescription(subpass.pInputAttachments[j].layout, attachment_index,
                                                                   attachment_description, input_loc.dot(Field::layout));
 
-                    const bool used_as_depth = (subpass.pDepthStencilAttachment != NULL &&
-                                                subpass.pDepthStencilAttachment->attachment == attachment_index);
-                    bool used_as_color = false;
-                    for (uint32_t k = 0; !used_as_depth && !used_as_color && k < subpass.colorAttachmentCount; ++k) {
-                        used_as_color = (subpass.pColorAttachments[k].attachment == attachment_index);
-                    }
-                    if (!used_as_depth && !used_as_color && attachment_description.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR) {
+                    const bool used_as_color_or_depth =
+                        usage_index.UsedIn(attachment_index, i,
+                                           vvl::AttachmentUsageIndex::kColor | vvl::AttachmentUsageIndex::kDepthStencil);
+                    if (!used_as_color_or_depth && attachment_description.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR) {
                         const char *vuid =
                             use_rp2 ? "VUID-VkSubpassDescription2-loadOp-03064" : "VUID-VkSubpassDescription-loadOp-00846";
                         skip |= LogError(vuid, device, attachment_loc.dot(Field::loadOp), "is VK_ATTACHMENT_LOAD_OP_CLEAR.");
@@ -2243,12 +2239,13 @@ bool CoreChecks::ValidateRenderPassDAG(const VkRenderPassCreateInfo2 *pCreateInf
     return skip;
 }
 
-bool CoreChecks::ValidateCreateRenderPass(const VkRenderPassCreateInfo2 *pCreateInfo, const ErrorObject &error_obj) const {
+bool CoreChecks::ValidateCreateRenderPass(const VkRenderPassCreateInfo2 *pCreateInfo,
+                                          const vvl::AttachmentUsageIndex &usage_index, const ErrorObject &error_obj) const {
     bool skip = false;
     const bool use_rp2 = error_obj.location.function != Func::vkCreateRenderPass;
     const char *vuid;
 
-    skip |= ValidateRenderpassAttachmentUsage(pCreateInfo, error_obj);
+    skip |= ValidateRenderpassAttachmentUsage(pCreateInfo, usage_index, error_obj);
 
     skip |= ValidateRenderPassDAG(pCreateInfo, error_obj);
 
@@ -2457,7 +2454,8 @@ bool CoreChecks::PreCallValidateCreateRenderPass(VkDevice device, const VkRender
 
     if (!skip) {
         vku::safe_VkRenderPassCreateInfo2 create_info_2 = ConvertVkRenderPassCreateInfoToV2KHR(*pCreateInfo);
-        skip |= ValidateCreateRenderPass(create_info_2.ptr(), error_obj);
+        const vvl::AttachmentUsageIndex usage_index(*create_info_2.ptr());
+        skip |= ValidateCreateRenderPass(create_info_2.ptr(), usage_index, error_obj);
     }
 
     return skip;
@@ -2654,16 +2652,20 @@ bool CoreChecks::PreCallValidateCreateRenderPass2(VkDevice device, const VkRende
     bool skip = false;
     skip |= ValidateDeviceQueueSupport(error_obj.location);
 
+    // Built once for all the checks looking for the other uses of an attachment
+    const vvl::AttachmentUsageIndex usage_index(*pCreateInfo);
+
     skip |= ValidateDepthStencilResolve(pCreateInfo, error_obj);
-    skip |= ValidateFragmentShadingRateAttachments(pCreateInfo, error_obj);
+    skip |= ValidateFragmentShadingRateAttachments(pCreateInfo, usage_index, error_obj);
 
     vku::safe_VkRenderPassCreateInfo2 create_info_2(pCreateInfo);
-    skip |= ValidateCreateRenderPass(create_info_2.ptr(), error_obj);
+    skip |= ValidateCreateRenderPass(create_info_2.ptr(), usage_index, error_obj);
 
     return skip;
 }
 
 bool CoreChecks::ValidateFragmentShadingRateAttachments(const VkRenderPassCreateInfo2 *pCreateInfo,
+                                                        const vvl::AttachmentUsageIndex &usage_index,
                                                         const ErrorObject &error_obj) const {
     bool skip = false;
 
@@ -2671,199 +2673,175 @@ bool CoreChecks::ValidateFragmentShadingRateAttachments(const VkRenderPassCreate
         return false;
     }
 
-    for (uint32_t attachment_description = 0; attachment_description < pCreateInfo->attachmentCount; ++attachment_description) {
-        std::vector<uint32_t> used_as_fragment_shading_rate_attachment;
+    // Validate the fragment shading rate attachment structures, then look for the other uses of the attachments they reference
+    for (uint32_t subpass = 0; subpass < pCreateInfo->subpassCount; ++subpass) {
+        const auto *fragment_shading_rate_attachment =
+            vku::FindStructInPNextChain<VkFragmentShadingRateAttachmentInfoKHR>(pCreateInfo->pSubpasses[subpass].pNext);
+        if (!fragment_shading_rate_attachment || !fragment_shading_rate_attachment->pFragmentShadingRateAttachment) {
+            continue;
+        }
 
-        // Prepass to find any use as a fragment shading rate attachment structures and validate them independently
-        for (uint32_t subpass = 0; subpass < pCreateInfo->subpassCount; ++subpass) {
-            const auto *fragment_shading_rate_attachment =
-                vku::FindStructInPNextChain<VkFragmentShadingRateAttachmentInfoKHR>(pCreateInfo->pSubpasses[subpass].pNext);
-            if (!fragment_shading_rate_attachment || !fragment_shading_rate_attachment->pFragmentShadingRateAttachment) {
-                continue;
-            }
+        const Location subpass_loc = error_obj.location.dot(Field::pSubpasses, subpass);
+        const Location fragment_loc =
+            subpass_loc.pNext(Struct::VkFragmentShadingRateAttachmentInfoKHR, Field::pFragmentShadingRateAttachment);
+        const VkAttachmentReference2 &attachment_reference =
+            *(fragment_shading_rate_attachment->pFragmentShadingRateAttachment);
+        if (attachment_reference.attachment < pCreateInfo->attachmentCount &&
+            pCreateInfo->pAttachments[attachment_reference.attachment].loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR) {
+            skip |= LogError("VUID-VkRenderPassCreateInfo2-pAttachments-09387", device, fragment_loc.dot(Field::attachment),
+                             "(%" PRIu32 ") has a loadOp of VK_ATTACHMENT_LOAD_OP_CLEAR", attachment_reference.attachment);
+        }
 
-            const Location subpass_loc = error_obj.location.dot(Field::pSubpasses, subpass);
-            const Location fragment_loc =
-                subpass_loc.pNext(Struct::VkFragmentShadingRateAttachmentInfoKHR, Field::pFragmentShadingRateAttachment);
-            const VkAttachmentReference2 &attachment_reference =
-                *(fragment_shading_rate_attachment->pFragmentShadingRateAttachment);
-            if (attachment_reference.attachment == attachment_description) {
-                used_as_fragment_shading_rate_attachment.push_back(subpass);
-
-                if (pCreateInfo->pAttachments[attachment_reference.attachment].loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR) {
-                    skip |= LogError("VUID-VkRenderPassCreateInfo2-pAttachments-09387", device, fragment_loc.dot(Field::attachment),
-                                     "(%" PRIu32 ") has a loadOp of VK_ATTACHMENT_LOAD_OP_CLEAR", attachment_reference.attachment);
-                }
+        if (attachment_reference.attachment != VK_ATTACHMENT_UNUSED) {
+            if ((pCreateInfo->flags & VK_RENDER_PASS_CREATE_TRANSFORM_BIT_QCOM) != 0) {
+                skip |=
+                    LogError("VUID-VkRenderPassCreateInfo2-flags-04521", device, fragment_loc.dot(Field::attachment),
+                             "is not VK_ATTACHMENT_UNUSED, but render pass includes VK_RENDER_PASS_CREATE_TRANSFORM_BIT_QCOM");
             }
 
-            if (attachment_reference.attachment != VK_ATTACHMENT_UNUSED) {
-                if ((pCreateInfo->flags & VK_RENDER_PASS_CREATE_TRANSFORM_BIT_QCOM) != 0) {
-                    skip |=
-                        LogError("VUID-VkRenderPassCreateInfo2-flags-04521", device, fragment_loc.dot(Field::attachment),
-                                 "is not VK_ATTACHMENT_UNUSED, but render pass includes VK_RENDER_PASS_CREATE_TRANSFORM_BIT_QCOM");
-                }
-
-                const VkFormatFeatureFlags2 potential_format_features =
-                    GetPotentialFormatFeatures(pCreateInfo->pAttachments[attachment_reference.attachment].format);
-
+            // safe to dereference pCreateInfo->pAttachments[]
+            if (attachment_reference.attachment < pCreateInfo->attachmentCount) {
+                const VkFormat format = pCreateInfo->pAttachments[attachment_reference.attachment].format;
+                const VkFormatFeatureFlags2 potential_format_features = GetPotentialFormatFeatures(format);
                 if (!(potential_format_features & VK_FORMAT_FEATURE_2_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR)) {
-                    skip |=
-                        LogError("VUID-VkRenderPassCreateInfo2-pAttachments-04586", device,
-                                 error_obj.location.dot(Field::pAttachments, attachment_reference.attachment).dot(Field::format),
-                                 "is %s and used in %s as a fragment shading rate attachment, but the format does not support "
-                                 "VK_FORMAT_FEATURE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR.",
-                                 string_VkFormat(pCreateInfo->pAttachments[attachment_reference.attachment].format),
-                                 subpass_loc.Fields().c_str());
+                    const Location format_loc =
+                        error_obj.location.dot(Field::pAttachments, attachment_reference.attachment).dot(Field::format);
+                    skip |= LogError("VUID-VkRenderPassCreateInfo2-pAttachments-04586", device, format_loc,
+                                     "is %s and used in %s as a fragment shading rate attachment, but the format does not support "
+                                     "VK_FORMAT_FEATURE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR.",
+                                     string_VkFormat(format), subpass_loc.Fields().c_str());
                 }
+            }
 
-                if (attachment_reference.layout != VK_IMAGE_LAYOUT_GENERAL &&
-                    attachment_reference.layout != VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR) {
-                    skip |= LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04524", device,
-                                     fragment_loc.dot(Field::layout), "has a layout of %s.",
-                                     string_VkImageLayout(attachment_reference.layout));
-                }
+            if (attachment_reference.layout != VK_IMAGE_LAYOUT_GENERAL &&
+                attachment_reference.layout != VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR) {
+                skip |= LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04524", device,
+                                 fragment_loc.dot(Field::layout), "has a layout of %s.",
+                                 string_VkImageLayout(attachment_reference.layout));
+            }
 
-                const VkExtent2D texel_size = fragment_shading_rate_attachment->shadingRateAttachmentTexelSize;
-                const Location texel_loc =
-                    subpass_loc.pNext(Struct::VkFragmentShadingRateAttachmentInfoKHR, Field::shadingRateAttachmentTexelSize);
-                if (!IsPowerOfTwo(texel_size.width)) {
-                    skip |= LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04525", device,
-                                     texel_loc.dot(Field::width), "(%" PRIu32 ") is a non-power-of-two.", texel_size.width);
-                }
-                if (texel_size.width <
-                    phys_dev_ext_props.fragment_shading_rate_props.minFragmentShadingRateAttachmentTexelSize.width) {
-                    skip |=
-                        LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04527", device,
-                                 texel_loc.dot(Field::width),
-                                 "(%" PRIu32 ") is lower than the advertised minimum width %" PRIu32 ".", texel_size.width,
-                                 phys_dev_ext_props.fragment_shading_rate_props.minFragmentShadingRateAttachmentTexelSize.width);
-                }
-                if (texel_size.width >
-                    phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSize.width) {
-                    skip |=
-                        LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04526", device,
-                                 texel_loc.dot(Field::width),
-                                 "(%" PRIu32 ") is higher than the advertised maximum width %" PRIu32 ".", texel_size.width,
-                                 phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSize.width);
-                }
-                if (!IsPowerOfTwo(texel_size.height)) {
-                    skip |= LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04528", device,
-                                     texel_loc.dot(Field::height), "(%" PRIu32 ") is a non-power-of-two.", texel_size.height);
-                }
-                if (texel_size.height <
-                    phys_dev_ext_props.fragment_shading_rate_props.minFragmentShadingRateAttachmentTexelSize.height) {
-                    skip |=
-                        LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04530", device,
-                                 texel_loc.dot(Field::height),
-                                 "(%" PRIu32 ") is lower than the advertised minimum height %" PRIu32 ".", texel_size.height,
-                                 phys_dev_ext_props.fragment_shading_rate_props.minFragmentShadingRateAttachmentTexelSize.height);
-                }
-                if (texel_size.height >
-                    phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSize.height) {
-                    skip |=
-                        LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04529", device,
-                                 texel_loc.dot(Field::height),
-                                 "(%" PRIu32 ") is higher than the advertised maximum height %" PRIu32 ".", texel_size.height,
-                                 phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSize.height);
-                }
-                uint32_t aspect_ratio = texel_size.width / texel_size.height;
-                uint32_t inverse_aspect_ratio = texel_size.height / texel_size.width;
-                if (aspect_ratio >
-                    phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSizeAspectRatio) {
-                    skip |= LogError(
-                        "VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04531", device, texel_loc,
-                        "has a texel size of %" PRIu32 " by %" PRIu32 ", which has an aspect ratio %" PRIu32
-                        ", which is higher than the advertised maximum aspect ratio %" PRIu32 ".",
-                        texel_size.width, texel_size.height, aspect_ratio,
-                        phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSizeAspectRatio);
-                }
-                if (inverse_aspect_ratio >
-                    phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSizeAspectRatio) {
-                    skip |= LogError(
-                        "VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04532", device, texel_loc,
-                        "has a texel size of %" PRIu32 " by %" PRIu32 ", which has an inverse aspect ratio of %" PRIu32
-                        ", which is higher than the advertised maximum aspect ratio %" PRIu32 ".",
-                        texel_size.width, texel_size.height, inverse_aspect_ratio,
-                        phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSizeAspectRatio);
-                }
+            const VkExtent2D texel_size = fragment_shading_rate_attachment->shadingRateAttachmentTexelSize;
+            const Location texel_loc =
+                subpass_loc.pNext(Struct::VkFragmentShadingRateAttachmentInfoKHR, Field::shadingRateAttachmentTexelSize);
+            if (!IsPowerOfTwo(texel_size.width)) {
+                skip |= LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04525", device,
+                                 texel_loc.dot(Field::width), "(%" PRIu32 ") is a non-power-of-two.", texel_size.width);
+            }
+            if (texel_size.width <
+                phys_dev_ext_props.fragment_shading_rate_props.minFragmentShadingRateAttachmentTexelSize.width) {
+                skip |=
+                    LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04527", device,
+                             texel_loc.dot(Field::width),
+                             "(%" PRIu32 ") is lower than the advertised minimum width %" PRIu32 ".", texel_size.width,
+                             phys_dev_ext_props.fragment_shading_rate_props.minFragmentShadingRateAttachmentTexelSize.width);
+            }
+            if (texel_size.width >
+                phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSize.width) {
+                skip |=
+                    LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04526", device,
+                             texel_loc.dot(Field::width),
+                             "(%" PRIu32 ") is higher than the advertised maximum width %" PRIu32 ".", texel_size.width,
+                             phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSize.width);
+            }
+            if (!IsPowerOfTwo(texel_size.height)) {
+                skip |= LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04528", device,
+                                 texel_loc.dot(Field::height), "(%" PRIu32 ") is a non-power-of-two.", texel_size.height);
+            }
+            if (texel_size.height <
+                phys_dev_ext_props.fragment_shading_rate_props.minFragmentShadingRateAttachmentTexelSize.height) {
+                skip |=
+                    LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04530", device,
+                             texel_loc.dot(Field::height),
+                             "(%" PRIu32 ") is lower than the advertised minimum height %" PRIu32 ".", texel_size.height,
+                             phys_dev_ext_props.fragment_shading_rate_props.minFragmentShadingRateAttachmentTexelSize.height);
+            }
+            if (texel_size.height >
+                phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSize.height) {
+                skip |=
+                    LogError("VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04529", device,
+                             texel_loc.dot(Field::height),
+                             "(%" PRIu32 ") is higher than the advertised maximum height %" PRIu32 ".", texel_size.height,
+                             phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSize.height);
+            }
+            uint32_t aspect_ratio = texel_size.width / texel_size.height;
+            uint32_t inverse_aspect_ratio = texel_size.height / texel_size.width;
+            if (aspect_ratio >
+                phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSizeAspectRatio) {
+                skip |= LogError(
+                    "VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04531", device, texel_loc,
+                    "has a texel size of %" PRIu32 " by %" PRIu32 ", which has an aspect ratio %" PRIu32
+                    ", which is higher than the advertised maximum aspect ratio %" PRIu32 ".",
+                    texel_size.width, texel_size.height, aspect_ratio,
+                    phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSizeAspectRatio);
+            }
+            if (inverse_aspect_ratio >
+                phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSizeAspectRatio) {
+                skip |= LogError(
+                    "VUID-VkFragmentShadingRateAttachmentInfoKHR-pFragmentShadingRateAttachment-04532", device, texel_loc,
+                    "has a texel size of %" PRIu32 " by %" PRIu32 ", which has an inverse aspect ratio of %" PRIu32
+                    ", which is higher than the advertised maximum aspect ratio %" PRIu32 ".",
+                    texel_size.width, texel_size.height, inverse_aspect_ratio,
+                    phys_dev_ext_props.fragment_shading_rate_props.maxFragmentShadingRateAttachmentTexelSizeAspectRatio);
+            }
+        }
+    }
+
+    // Lambda function turning a vector of integers into a string
+    auto vector_to_string = [&](const std::vector<uint32_t> &vector) {
+        std::stringstream ss;
+        size_t size = vector.size();
+        for (size_t i = 0; i < size; i++) {
+            if (size == 2 && i == 1) {
+                ss << " and ";
+            } else if (size > 2 && i == size - 2) {
+                ss << ", and ";
+            } else if (i != 0) {
+                ss << ", ";
             }
+            ss << vector[i];
         }
+        return ss.str();
+    };
 
-        // Lambda function turning a vector of integers into a string
-        auto vector_to_string = [&](std::vector<uint32_t> vector) {
-            std::stringstream ss;
-            size_t size = vector.size();
-            for (size_t i = 0; i < used_as_fragment_shading_rate_attachment.size(); i++) {
-                if (size == 2 && i == 1) {
-                    ss << " and ";
-                } else if (size > 2 && i == size - 2) {
-                    ss << ", and ";
-                } else if (i != 0) {
-                    ss << ", ";
-                }
-                ss << vector[i];
+    for (uint32_t attachment_description = 0; attachment_description < pCreateInfo->attachmentCount; ++attachment_description) {
+        const auto uses = usage_index.Uses(attachment_description);
+        std::vector<uint32_t> used_as_fragment_shading_rate_attachment;
+        for (const auto &use : uses) {
+            if (use.type == vvl::AttachmentUsageIndex::kFragmentShadingRate) {
+                used_as_fragment_shading_rate_attachment.push_back(use.subpass);
             }
-            return ss.str();
-        };
+        }
+        if (used_as_fragment_shading_rate_attachment.empty()) {
+            continue;
+        }
 
-        // Search for other uses of the same attachment
-        if (!used_as_fragment_shading_rate_attachment.empty()) {
-            for (uint32_t subpass = 0; subpass < pCreateInfo->subpassCount; ++subpass) {
-                const Location subpass_loc = error_obj.location.dot(Field::pSubpasses, subpass);
-                const VkSubpassDescription2 &subpass_info = pCreateInfo->pSubpasses[subpass];
-
-                std::string fsr_attachment_subpasses_string = vector_to_string(used_as_fragment_shading_rate_attachment);
-
-                for (uint32_t attachment = 0; attachment < subpass_info.colorAttachmentCount; ++attachment) {
-                    if (subpass_info.pColorAttachments[attachment].attachment == attachment_description) {
-                        skip |= LogError("VUID-VkRenderPassCreateInfo2-pAttachments-04585", device,
-                                         subpass_loc.dot(Field::pColorAttachments, attachment).dot(Field::attachment),
-                                         "is also used in pAttachments[%" PRIu32
-                                         "] as a fragment shading rate attachment in subpass(es) %s",
-                                         attachment_description, fsr_attachment_subpasses_string.c_str());
-                    }
-                }
-                for (uint32_t attachment = 0; attachment < subpass_info.colorAttachmentCount; ++attachment) {
-                    if (subpass_info.pResolveAttachments &&
-                        subpass_info.pResolveAttachments[attachment].attachment == attachment_description) {
-                        skip |= LogError("VUID-VkRenderPassCreateInfo2-pAttachments-04585", device,
-                                         subpass_loc.dot(Field::pResolveAttachments, attachment).dot(Field::attachment),
-                                         "is also used in pAttachments[%" PRIu32
-                                         "] as a fragment shading rate attachment in subpass(es) %s",
-                                         attachment_description, fsr_attachment_subpasses_string.c_str());
-                    }
-                }
-                for (uint32_t attachment = 0; attachment < subpass_info.inputAttachmentCount; ++attachment) {
-                    if (subpass_info.pInputAttachments[attachment].attachment == attachment_description) {
-                        skip |= LogError("VUID-VkRenderPassCreateInfo2-pAttachments-04585", device,
-                                         subpass_loc.dot(Field::pInputAttachments, attachment).dot(Field::attachment),
-                                         "is also used in pAttachments[%" PRIu32
-                                         "] as a fragment shading rate attachment in subpass(es) %s",
-                                         attachment_description, fsr_attachment_subpasses_string.c_str());
-                    }
-                }
-                if (subpass_info.pDepthStencilAttachment) {
-                    if (subpass_info.pDepthStencilAttachment->attachment == attachment_description) {
-                        skip |= LogError("VUID-VkRenderPassCreateInfo2-pAttachments-04585", device,
-                                         subpass_loc.dot(Field::pDepthStencilAttachment).dot(Field::attachment),
-                                         "is also used in pAttachments[%" PRIu32
-                                         "] as a fragment shading rate attachment in subpass(es) %s",
-                                         attachment_description, fsr_attachment_subpasses_string.c_str());
-                    }
-                }
-                const auto *depth_stencil_resolve_attachment =
-                    vku::FindStructInPNextChain<VkSubpassDescriptionDepthStencilResolve>(subpass_info.pNext);
-                if (depth_stencil_resolve_attachment && depth_stencil_resolve_attachment->pDepthStencilResolveAttachment) {
-                    if (depth_stencil_resolve_attachment->pDepthStencilResolveAttachment->attachment == attachment_description) {
-                        skip |= LogError(
-                            "VUID-VkRenderPassCreateInfo2-pAttachments-04585", device,
-                            subpass_loc
-                                .pNext(Struct::VkSubpassDescriptionDepthStencilResolve, Field::pDepthStencilResolveAttachment)
-                                .dot(Field::attachment),
+        const std::string fsr_attachment_subpasses_string = vector_to_string(used_as_fragment_shading_rate_attachment);
+        auto report_other_use = [&](const Location &reference_loc) {
+            return LogError("VUID-VkRenderPassCreateInfo2-pAttachments-04585", device, reference_loc.dot(Field::attachment),
                             "is also used in pAttachments[%" PRIu32 "] as a fragment shading rate attachment in subpass(es) %s",
                             attachment_description, fsr_attachment_subpasses_string.c_str());
-                    }
-                }
+        };
+        for (const auto &use : uses) {
+            const Location subpass_loc = error_obj.location.dot(Field::pSubpasses, use.subpass);
+            switch (use.type) {
+                case vvl::AttachmentUsageIndex::kColor:
+                    skip |= report_other_use(subpass_loc.dot(Field::pColorAttachments, use.index));
+                    break;
+                case vvl::AttachmentUsageIndex::kResolve:
+                    skip |= report_other_use(subpass_loc.dot(Field::pResolveAttachments, use.index));
+                    break;
+                case vvl::AttachmentUsageIndex::kInput:
+                    skip |= report_other_use(subpass_loc.dot(Field::pInputAttachments, use.index));
+                    break;
+                case vvl::AttachmentUsageIndex::kDepthStencil:
+                    skip |= report_other_use(subpass_loc.dot(Field::pDepthStencilAttachment));
+                    break;
+                case vvl::AttachmentUsageIndex::kDepthStencilResolve:
+                    skip |= report_other_use(
+                        subpass_loc.pNext(Struct::VkSubpassDescriptionDepthStencilResolve, Field::pDepthStencilResolveAttachment));
+                    break;
+                default:
+                    break;
             }
         }
     }
@@ -2922,6 +2900,10 @@ bool CoreChecks::ValidateRenderingAttachmentInfo(VkCommandBuffer commandBuffer,
     if (attachment_info.imageView == VK_NULL_HANDLE) {
         return false;
     }
+    const auto cache_key = RenderingAttachmentValidationCache::BuildKey(*pRenderingInfo, attachment_info);
+    if (rendering_attachment_validation_cache.Contains(cache_key)) {
+        return false;
+    }
     const auto image_view_state = Get<vvl::ImageView>(attachment_info.imageView);
     ASSERT_AND_RETURN_SKIP(image_view_state);
 
@@ -3060,6 +3042,9 @@ bool CoreChecks::ValidateRenderingAttachmentInfo(VkCommandBuffer commandBuffer,
                          "is %s.", string_VkImageLayout(attachment_info.imageLayout));
     }
 
+    if (!skip) {
+        rendering_attachment_validation_cache.Insert(cache_key);
+    }
     return skip;
 }
 
@@ -4400,22 +4385,9 @@ bool CoreChecks::ValidateFrameBufferAttachments(const VkFramebufferCreateInfo &c
 
             int highest_view_bit = MostSignificantBit(subpass.viewMask);
 
-            for (uint32_t k = 0; k < rpci.pSubpasses[j].inputAttachmentCount; ++k) {
-                if (subpass.pInputAttachments[k].attachment == i) {
-                    used_as_input_color_resolve_depth_stencil_attachment = true;
-                    break;
-                }
-            }
-
-            for (uint32_t k = 0; k < rpci.pSubpasses[j].colorAttachmentCount; ++k) {
-                if (subpass.pColorAttachments[k].attachment == i ||
-                    (subpass.pResolveAttachments && subpass.pResolveAttachments[k].attachment == i)) {
-                    used_as_input_color_resolve_depth_stencil_attachment = true;
-                    break;
-                }
-            }
-
-            if (subpass.pDepthStencilAttachment && subpass.pDepthStencilAttachment->attachment == i) {
+            constexpr uint32_t attachment_use_mask = vvl::AttachmentUsageIndex::kInput | vvl::AttachmentUsageIndex::kColor |
+                                                     vvl::AttachmentUsageIndex::kResolve | vvl::AttachmentUsageIndex::kDepthStencil;
+            if (rp_state.attachment_usage_index.UsedIn(i, j, attachment_use_mask)) {
                 used_as_input_color_resolve_depth_stencil_attachment = true;
             }
 
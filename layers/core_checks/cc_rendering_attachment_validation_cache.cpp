@@ -0,0 +1,68 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core_checks/cc_rendering_attachment_validation_cache.h"
+
+#include <mutex>
+
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "utils/hash_util.h"
+
+RenderingAttachmentValidationCache::Key RenderingAttachmentValidationCache::BuildKey(
+    const VkRenderingInfo &rendering_info, const VkRenderingAttachmentInfo &attachment_info) {
+    const auto msrtss_info = vku::FindStructInPNextChain<VkMultisampledRenderToSingleSampledInfoEXT>(rendering_info.pNext);
+    Key key{};
+    key.image_view = attachment_info.imageView;
+    key.image_layout = attachment_info.imageLayout;
+    key.resolve_mode = attachment_info.resolveMode;
+    key.resolve_image_view = attachment_info.resolveImageView;
+    key.resolve_image_layout = attachment_info.resolveImageLayout;
+    key.msrtss_enabled = msrtss_info && msrtss_info->multisampledRenderToSingleSampledEnable;
+    return key;
+}
+
+bool RenderingAttachmentValidationCache::Key::operator==(const Key &other) const {
+    return image_view == other.image_view && image_layout == other.image_layout && resolve_mode == other.resolve_mode &&
+           resolve_image_view == other.resolve_image_view && resolve_image_layout == other.resolve_image_layout &&
+           msrtss_enabled == other.msrtss_enabled;
+}
+
+size_t RenderingAttachmentValidationCache::KeyHash::operator()(const Key &key) const {
+    hash_util::HashCombiner hc;
+    hc << key.image_view << key.image_layout << key.resolve_mode << key.resolve_image_view << key.resolve_image_layout
+       << key.msrtss_enabled;
+    return hc.Value();
+}
+
+bool RenderingAttachmentValidationCache::Contains(const Key &key) const {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    return entries_.find(key) != entries_.end();
+}
+
+void RenderingAttachmentValidationCache::Insert(const Key &key) {
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    if (entries_.size() >= kMaxEntries) {
+        entries_.clear();
+    }
+    entries_.emplace(key);
+}
+
+void RenderingAttachmentValidationCache::Clear() {
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    entries_.clear();
+}
@@ -0,0 +1,60 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <shared_mutex>
+
+#include <vulkan/vulkan.h>
+
+#include "containers/custom_containers.h"
+
+// Remembers the VkRenderingAttachmentInfo that passed ValidateRenderingAttachmentInfo. Those checks only depend on the members of
+// the attachment info, on the state of its image views and on whether multisampled render to single sampled is enabled, so
+// applications beginning rendering with the same attachments every frame get them checked once.
+//
+// The key holds image view handles, so the whole cache is dropped when an image view is destroyed and a handle value could be
+// reused.
+class RenderingAttachmentValidationCache {
+  public:
+    struct Key {
+        VkImageView image_view;
+        VkImageLayout image_layout;
+        VkResolveModeFlagBits resolve_mode;
+        VkImageView resolve_image_view;
+        VkImageLayout resolve_image_layout;
+        bool msrtss_enabled;
+
+        bool operator==(const Key &other) const;
+    };
+
+    static Key BuildKey(const VkRenderingInfo &rendering_info, const VkRenderingAttachmentInfo &attachment_info);
+
+    bool Contains(const Key &key) const;
+    void Insert(const Key &key);
+    void Clear();
+
+  private:
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    // The whole cache is dropped when it gets this big
+    static constexpr size_t kMaxEntries = 4096;
+
+    mutable std::shared_mutex lock_;
+    vvl::unordered_set<Key, KeyHash> entries_;
+};
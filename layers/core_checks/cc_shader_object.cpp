@@ -314,10 +314,12 @@ bool CoreChecks::PreCallValidateCreateShadersEXT(VkDevice device, uint32_t creat
         }
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
 
+        const hash_util::Hash128 hash = hash_util::ShaderHash128(create_info.pCode, create_info.codeSize);
         spv_const_binary_t binary{static_cast<const uint32_t*>(create_info.pCode), create_info.codeSize / sizeof(uint32_t)};
-        skip |= RunSpirvValidation(binary, create_info_loc, cache);
+        skip |= RunSpirvValidation(binary, hash, create_info_loc, cache);
 
-        const auto spirv = std::make_shared<spirv::Module>(create_info.codeSize, static_cast<const uint32_t*>(create_info.pCode));
+        const auto spirv = std::make_shared<spirv::Module>(create_info.codeSize, static_cast<const uint32_t*>(create_info.pCode),
+                                                           nullptr, nullptr, &hash);
         vku::safe_VkShaderCreateInfoEXT safe_create_info = vku::safe_VkShaderCreateInfoEXT(&pCreateInfos[i]);
         const ShaderStageState stage_state(nullptr, &safe_create_info, nullptr, spirv);
         skip |= ValidateShaderStage(stage_state, nullptr, create_info_loc);
@@ -413,6 +415,15 @@ bool CoreChecks::PreCallValidateDestroyShaderEXT(VkDevice device, VkShaderEXT sh
     return skip;
 }
 
+void CoreChecks::PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
+                                               const RecordObject& record_obj) {
+    // The handle value can be given to a new shader object
+    if (shader != VK_NULL_HANDLE) {
+        shader_object_validation_cache.Clear();
+    }
+    StateTracker::PreCallRecordDestroyShaderEXT(device, shader, pAllocator, record_obj);
+}
+
 bool CoreChecks::PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount,
                                                   const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders,
                                                   const ErrorObject& error_obj) const {
@@ -631,8 +642,15 @@ bool CoreChecks::ValidateDrawShaderObject(const LastBound& last_bound_state, con
                          FormatHandle(cb_state.activeRenderPass->Handle()).c_str());
     }
 
-    skip |= ValidateDrawShaderObjectLinking(last_bound_state, vuid);
-    skip |= ValidateDrawShaderObjectPushConstantAndLayout(last_bound_state, vuid);
+    const ShaderObjectValidationCache::Key cache_key = ShaderObjectValidationCache::BuildKey(last_bound_state);
+    if (!shader_object_validation_cache.Contains(cache_key)) {
+        const bool bound_shaders_skip = ValidateDrawShaderObjectLinking(last_bound_state, vuid) |
+                                        ValidateDrawShaderObjectPushConstantAndLayout(last_bound_state, vuid);
+        if (!bound_shaders_skip) {
+            shader_object_validation_cache.Insert(cache_key);
+        }
+        skip |= bound_shaders_skip;
+    }
     skip |= ValidateDrawShaderObjectMesh(last_bound_state, vuid);
 
     return skip;
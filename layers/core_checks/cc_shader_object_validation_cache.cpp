@@ -0,0 +1,55 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core_checks/cc_shader_object_validation_cache.h"
+
+#include <mutex>
+
+#include "state_tracker/pipeline_state.h"
+#include "utils/hash_util.h"
+
+ShaderObjectValidationCache::Key ShaderObjectValidationCache::BuildKey(const LastBound &last_bound_state) {
+    Key key{};
+    for (uint32_t i = 0; i < kShaderObjectStageCount; ++i) {
+        if (i != static_cast<uint32_t>(ShaderObjectStage::COMPUTE)) {
+            key[i] = last_bound_state.GetShader(static_cast<ShaderObjectStage>(i));
+        }
+    }
+    return key;
+}
+
+size_t ShaderObjectValidationCache::KeyHash::operator()(const Key &key) const {
+    return hash_util::HashCombiner().Combine(key.cbegin(), key.cend()).Value();
+}
+
+bool ShaderObjectValidationCache::Contains(const Key &key) const {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    return entries_.find(key) != entries_.end();
+}
+
+void ShaderObjectValidationCache::Insert(const Key &key) {
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    if (entries_.size() >= kMaxEntries) {
+        entries_.clear();
+    }
+    entries_.emplace(key);
+}
+
+void ShaderObjectValidationCache::Clear() {
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    entries_.clear();
+}
@@ -0,0 +1,55 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <shared_mutex>
+
+#include <vulkan/vulkan.h>
+
+#include "containers/custom_containers.h"
+#include "utils/shader_utils.h"
+
+struct LastBound;
+
+// Remembers the combinations of bound graphics shader objects that passed the draw time checks only depending on which shaders
+// are bound (linking, stage interfaces, push constant ranges and set layouts). Applications rebind a small set of combinations
+// over and over, each of them is then checked once.
+//
+// The key is the handle bound to each stage, so the whole cache is dropped when a shader object is destroyed and a handle value
+// could be reused.
+class ShaderObjectValidationCache {
+  public:
+    using Key = std::array<VkShaderEXT, kShaderObjectStageCount>;
+
+    static Key BuildKey(const LastBound &last_bound_state);
+
+    bool Contains(const Key &key) const;
+    void Insert(const Key &key);
+    void Clear();
+
+  private:
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    // The whole cache is dropped when it gets this big
+    static constexpr size_t kMaxEntries = 4096;
+
+    mutable std::shared_mutex lock_;
+    vvl::unordered_set<Key, KeyHash> entries_;
+};
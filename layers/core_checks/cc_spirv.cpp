@@ -2192,6 +2192,11 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
         return skip;  // these edge cases should be validated already
     }
 
+    if (spirv_validation_pool) {
+        // The module is used for the first time, spirv-val of it has to be reported before anything else
+        skip |= ReportPendingSpirvValidation(*stage_state.spirv_state);
+    }
+
     const spirv::Module &module_state = *stage_state.spirv_state.get();
     if (!module_state.valid_spirv) return skip;  // checked elsewhere
 
@@ -2320,7 +2325,7 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
         auto const optimized =
             optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, spirv_val_options, true);
         if (optimized) {
-            spv_context ctx = spvContextCreate(spirv_environment);
+            spv_const_context ctx = GetThreadSpirvContext(spirv_environment);
             spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
             spv_diagnostic diag = nullptr;
             auto const spv_valid = spvValidateWithOptions(ctx, spirv_val_options, &binary, &diag);
@@ -2351,7 +2356,6 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
             total_workgroup_shared_memory = spec_mod.CalculateWorkgroupSharedMemory();
 
             spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
         } else {
             // Should never get here, but better then asserting
             const char *vuid = pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
@@ -2500,9 +2504,92 @@ void CoreChecks::PreCallRecordCreateShaderModule(VkDevice device, const VkShader
                                                  const RecordObject &record_obj, chassis::CreateShaderModule &chassis_state) {
     // Normally would validate in PreCallValidate, but need a non-const function to update chassis_state
     // This is on the stack, we don't have to worry about threading hazards and this could be moved and used const_cast
+    const Location create_info_loc = record_obj.location.dot(Field::pCreateInfo);
+    const bool run_spirv_val = CanRunSpirvValidation(*pCreateInfo);
+    if (run_spirv_val) {
+        // Hashed once, the module state created below uses the same hash
+        chassis_state.spirv_hash = hash_util::ShaderHash128(pCreateInfo->pCode, pCreateInfo->codeSize);
+    }
+    // spirv-val runs before the code is parsed, the parsing is not safe with invalid SPIR-V
+    if (run_spirv_val && !IsAsyncSpirvValidation(*pCreateInfo, create_info_loc)) {
+        spv_const_binary_t binary{pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)};
+        chassis_state.skip |=
+            RunSpirvValidation(binary, *chassis_state.spirv_hash, create_info_loc, GetShaderModuleValidationCache(*pCreateInfo));
+        if (chassis_state.skip) {
+            return;
+        }
+    }
+
     ValidationStateTracker::PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj,
                                                             chassis_state);
     chassis_state.skip |= ValidateSpirvStateless(*chassis_state.module_state, chassis_state.stateless_data, record_obj.location);
+
+    if (!chassis_state.module_state || !IsAsyncSpirvValidation(*pCreateInfo, create_info_loc)) {
+        return;
+    }
+    // The original code is validated, module_state might hold the flattened version of it
+    auto pending = std::make_shared<PendingSpirvValidation>(*spirv_validation_pool);
+    pending->module_state = chassis_state.module_state;
+    std::vector<uint32_t> code(pCreateInfo->pCode, pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t));
+    ValidationCache *cache = GetShaderModuleValidationCache(*pCreateInfo);
+    const vvl::EncodedLocation encoded_loc(create_info_loc);
+    pending->task.Post([this, result = pending.get(), code = std::move(code), hash = *chassis_state.spirv_hash, cache,
+                        encoded_loc]() {
+        spv_const_binary_t binary{code.data(), code.size()};
+        const vvl::LocationCapture loc_capture(encoded_loc);
+        DebugReport::SetThreadDeferredMessages(&result->messages);
+        result->skip |= RunSpirvValidation(binary, hash, loc_capture.Get(), cache);
+        DebugReport::SetThreadDeferredMessages(nullptr);
+    });
+
+    std::lock_guard<std::mutex> guard(pending_spirv_validation_lock);
+    pending_spirv_validation[chassis_state.module_state.get()] = std::move(pending);
+}
+
+void CoreChecks::PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                                  const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
+    if (spirv_validation_pool) {
+        // Last chance to report them
+        if (auto module_state = Get<vvl::ShaderModule>(shaderModule); module_state && module_state->spirv) {
+            ReportPendingSpirvValidation(*module_state->spirv);
+        }
+    }
+    StateTracker::PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator, record_obj);
+}
+
+void CoreChecks::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordDeviceWaitIdle(device, record_obj);
+    ReportAllPendingSpirvValidation();
+}
+
+bool CoreChecks::ReportPendingSpirvValidation(const spirv::Module &module_state) const {
+    std::shared_ptr<PendingSpirvValidation> pending;
+    {
+        std::lock_guard<std::mutex> guard(pending_spirv_validation_lock);
+        auto it = pending_spirv_validation.find(&module_state);
+        if (it == pending_spirv_validation.end()) {
+            return false;
+        }
+        pending = std::move(it->second);
+        pending_spirv_validation.erase(it);
+    }
+    pending->task.Wait();
+    return pending->skip | debug_report->ReportDeferredMessages(pending->messages);
+}
+
+bool CoreChecks::ReportAllPendingSpirvValidation() const {
+    decltype(pending_spirv_validation) pending_map;
+    {
+        std::lock_guard<std::mutex> guard(pending_spirv_validation_lock);
+        pending_map.swap(pending_spirv_validation);
+    }
+    bool skip = false;
+    for (auto &entry : pending_map) {
+        entry.second->task.Wait();
+        skip |= entry.second->skip;
+        skip |= debug_report->ReportDeferredMessages(entry.second->messages);
+    }
+    return skip;
 }
 
 void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT *pCreateInfos,
@@ -2518,25 +2605,22 @@ void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createI
     }
 }
 
-bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &loc, ValidationCache *cache) const {
+bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const hash_util::Hash128 &hash, const Location &loc,
+                                    ValidationCache *cache) const {
     bool skip = false;
 
     if (global_settings.debug_disable_spirv_val) {
         return skip;
     }
 
-    uint32_t hash = 0;
-    if (cache) {
-        hash = hash_util::ShaderHash((void *)binary.code, binary.wordCount * sizeof(uint32_t));
-        if (cache->Contains(hash)) {
-            return skip;
-        }
+    if (cache && cache->Contains(hash)) {
+        return skip;
     }
 
     // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
     // the default values will be used during validation.
     spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
-    spv_context ctx = spvContextCreate(spirv_environment);
+    spv_const_context ctx = GetThreadSpirvContext(spirv_environment);
     spv_diagnostic diag = nullptr;
     const spv_result_t spv_valid = spvValidateWithOptions(ctx, spirv_val_options, &binary, &diag);
     if (spv_valid != SPV_SUCCESS) {
@@ -2557,13 +2641,12 @@ bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &
     }
 
     spvDiagnosticDestroy(diag);
-    spvContextDestroy(ctx);
 
     return skip;
 }
 
-bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &create_info,
-                                                const Location &create_info_loc) const {
+bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &create_info, const Location &create_info_loc,
+                                                const spirv::Module *module_state) const {
     bool skip = false;
 
     if (disabled[shader_validation]) {
@@ -2580,24 +2663,42 @@ bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &
     } else if (SafeModulo(create_info.codeSize, 4) != 0) {
         skip |= LogError("VUID-VkShaderModuleCreateInfo-codeSize-08735", device, create_info_loc.dot(Field::codeSize),
                          "(%zu) must be a multiple of 4.", create_info.codeSize);
-    } else {
+    } else if (create_info_loc.function != Func::vkCreateShaderModule) {
+        // vkCreateShaderModule runs spirv-val in PreCallRecord, where the hash is shared with the module state
         // if pCode is garbage, don't pass along to spirv-val
-
-        const auto validation_cache_ci = vku::FindStructInPNextChain<VkShaderModuleValidationCacheCreateInfoEXT>(create_info.pNext);
-        ValidationCache *cache =
-            validation_cache_ci ? CastFromHandle<ValidationCache *>(validation_cache_ci->validationCache) : nullptr;
-        // If app isn't using a shader validation cache, use the default one from CoreChecks
-        if (!cache) {
-            cache = CastFromHandle<ValidationCache *>(core_validation_cache);
-        }
-
+        const hash_util::Hash128 hash =
+            module_state ? module_state->hash_ : hash_util::ShaderHash128(create_info.pCode, create_info.codeSize);
         spv_const_binary_t binary{create_info.pCode, create_info.codeSize / sizeof(uint32_t)};
-        skip |= RunSpirvValidation(binary, create_info_loc, cache);
+        skip |= RunSpirvValidation(binary, hash, create_info_loc, GetShaderModuleValidationCache(create_info));
     }
 
     return skip;
 }
 
+ValidationCache *CoreChecks::GetShaderModuleValidationCache(const VkShaderModuleCreateInfo &create_info) const {
+    const auto validation_cache_ci = vku::FindStructInPNextChain<VkShaderModuleValidationCacheCreateInfoEXT>(create_info.pNext);
+    ValidationCache *cache = validation_cache_ci ? CastFromHandle<ValidationCache *>(validation_cache_ci->validationCache) : nullptr;
+    // If app isn't using a shader validation cache, use the default one from CoreChecks
+    if (!cache) {
+        cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+    }
+    return cache;
+}
+
+// Same conditions ValidateShaderModuleCreateInfo uses to decide if the code can be given to spirv-val
+bool CoreChecks::CanRunSpirvValidation(const VkShaderModuleCreateInfo &create_info) const {
+    return !disabled[shader_validation] && create_info.pCode && create_info.pCode[0] == spv::MagicNumber &&
+           SafeModulo(create_info.codeSize, 4) == 0;
+}
+
+// Only vkCreateShaderModule is deferred, a VkShaderModuleCreateInfo chained to a pipeline is needed right away
+bool CoreChecks::IsAsyncSpirvValidation(const VkShaderModuleCreateInfo &create_info, const Location &create_info_loc) const {
+    if (!spirv_validation_pool || create_info_loc.function != Func::vkCreateShaderModule) {
+        return false;
+    }
+    return CanRunSpirvValidation(create_info);
+}
+
 bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                    const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                    const ErrorObject &error_obj) const {
@@ -2930,32 +3031,50 @@ bool CoreChecks::ValidateSpirvStateless(const spirv::Module &module_state, const
     bool skip = false;
     if (!module_state.valid_spirv) return skip;
 
-    skip |= ValidateShaderClock(module_state, stateless_data, loc);
-    skip |= ValidateAtomicsTypes(module_state, stateless_data, loc);
-    skip |= ValidateVariables(module_state, loc);
+    // The module wide checks and the checks of each entry point are independent, large modules (ray tracing ones with many
+    // entry points) have them split in tasks with parallel pipeline validation. Task 0 is the module wide checks.
+    const auto &entry_points = module_state.static_data_.entry_points;
+    auto validate = [this, &module_state, &stateless_data, &entry_points, &loc](uint32_t task) {
+        bool skip = false;
+        if (task == 0) {
+            skip |= ValidateShaderClock(module_state, stateless_data, loc);
+            skip |= ValidateAtomicsTypes(module_state, stateless_data, loc);
+            skip |= ValidateVariables(module_state, loc);
+
+            if (enabled_features.transformFeedback) {
+                skip |= ValidateTransformFeedbackDecorations(module_state, loc);
+            }
 
-    if (enabled_features.transformFeedback) {
-        skip |= ValidateTransformFeedbackDecorations(module_state, loc);
-    }
+            // The following tries to limit the number of passes through the shader module.
+            // It save a good amount of memory and complex state tracking to just check these in a 2nd pass
+            for (const spirv::Instruction &insn : module_state.GetInstructions()) {
+                skip |= ValidateShaderCapabilitiesAndExtensions(insn, loc);
+                skip |= ValidateTexelOffsetLimits(module_state, insn, loc);
+                skip |= ValidateMemoryScope(module_state, insn, loc);
+                skip |= ValidateSubgroupRotateClustered(module_state, insn, loc);
+            }
+            return skip;
+        }
 
-    // The following tries to limit the number of passes through the shader module.
-    // It save a good amount of memory and complex state tracking to just check these in a 2nd pass
-    for (const spirv::Instruction &insn : module_state.GetInstructions()) {
-        skip |= ValidateShaderCapabilitiesAndExtensions(insn, loc);
-        skip |= ValidateTexelOffsetLimits(module_state, insn, loc);
-        skip |= ValidateMemoryScope(module_state, insn, loc);
-        skip |= ValidateSubgroupRotateClustered(module_state, insn, loc);
-    }
-
-    for (const auto &entry_point : module_state.static_data_.entry_points) {
-        skip |= ValidateShaderStageGroupNonUniform(module_state, stateless_data, entry_point->stage, loc);
-        skip |= ValidateShaderStageInputOutputLimits(module_state, *entry_point, stateless_data, loc);
-        skip |= ValidateShaderFloatControl(module_state, *entry_point, stateless_data, loc);
-        skip |= ValidateExecutionModes(module_state, *entry_point, stateless_data, loc);
-        skip |= ValidateConservativeRasterization(module_state, *entry_point, stateless_data, loc);
+        const spirv::EntryPoint &entry_point = *entry_points[task - 1];
+        skip |= ValidateShaderStageGroupNonUniform(module_state, stateless_data, entry_point.stage, loc);
+        skip |= ValidateShaderStageInputOutputLimits(module_state, entry_point, stateless_data, loc);
+        skip |= ValidateShaderFloatControl(module_state, entry_point, stateless_data, loc);
+        skip |= ValidateExecutionModes(module_state, entry_point, stateless_data, loc);
+        skip |= ValidateConservativeRasterization(module_state, entry_point, stateless_data, loc);
         if (enabled_features.transformFeedback) {
-            skip |= ValidateTransformFeedbackEmitStreams(module_state, *entry_point, stateless_data, loc);
+            skip |= ValidateTransformFeedbackEmitStreams(module_state, entry_point, stateless_data, loc);
+        }
+        return skip;
+    };
+    // A single entry point is not worth the task overhead
+    const uint32_t task_count = 1 + static_cast<uint32_t>(entry_points.size());
+    if (entry_points.size() < 2) {
+        for (uint32_t task = 0; task < task_count; ++task) {
+            skip |= validate(task);
         }
+        return skip;
     }
+    skip |= ValidateInParallel(task_count, validate);
     return skip;
 }
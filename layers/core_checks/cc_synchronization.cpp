@@ -198,6 +198,7 @@ bool SemaphoreSubmitState::ValidateWaitSemaphore(const Location &wait_semaphore_
             std::string where;
             TimelineMaxDiffCheck exceeds_max_diff(value, core.phys_dev_props_core12.maxTimelineSemaphoreValueDifference);
             const VkSemaphore handle = semaphore_state.VkHandle();
+            semaphore_state.WaitObservedValue(wait_semaphore_loc);
             if (CheckSemaphoreValue(semaphore_state, where, bad_value, exceeds_max_diff)) {
                 const auto &vuid = GetQueueSubmitVUID(wait_semaphore_loc, SubmitError::kTimelineSemMaxDiff);
                 skip |= core.LogError(vuid, handle, wait_semaphore_loc,
@@ -262,6 +263,7 @@ bool SemaphoreSubmitState::ValidateSignalSemaphore(const Location &signal_semaph
                 // exact value ordering cannot be determined until execution time
                 return !is_pending && value < payload;
             };
+            semaphore_state.WaitObservedValue(signal_semaphore_loc);
             if (CheckSemaphoreValue(semaphore_state, where, bad_value, must_be_greater)) {
                 const auto &vuid = GetQueueSubmitVUID(signal_semaphore_loc, SubmitError::kTimelineSemSmallValue);
                 skip |= core.LogError(
@@ -638,7 +640,12 @@ bool CoreChecks::PreCallValidateDestroyFence(VkDevice device, VkFence fence, con
     bool skip = false;
     auto fence_state = Get<vvl::Fence>(fence);
     if (fence_state && fence_state->Scope() == vvl::Fence::kInternal && fence_state->State() == vvl::Fence::kInflight) {
-        skip |= ValidateObjectNotInUse(fence_state.get(), error_obj.location.dot(Field::fence), "VUID-vkDestroyFence-fence-01120");
+        // The application may have waited for the submission through a timeline semaphore value
+        WaitObservedSemaphores(error_obj.location);
+        if (fence_state->State() == vvl::Fence::kInflight) {
+            skip |= ValidateObjectNotInUse(fence_state.get(), error_obj.location.dot(Field::fence),
+                                           "VUID-vkDestroyFence-fence-01120");
+        }
     }
     return skip;
 }
@@ -650,8 +657,12 @@ bool CoreChecks::PreCallValidateResetFences(VkDevice device, uint32_t fenceCount
         auto fence_state = Get<vvl::Fence>(pFences[i]);
         ASSERT_AND_CONTINUE(fence_state);
         if (fence_state->Scope() == vvl::Fence::kInternal && fence_state->State() == vvl::Fence::kInflight) {
-            skip |= LogError("VUID-vkResetFences-pFences-01123", pFences[i], error_obj.location.dot(Field::pFences, i),
-                             "(%s) is in use.", FormatHandle(pFences[i]).c_str());
+            // The application may have waited for the submission through a timeline semaphore value
+            WaitObservedSemaphores(error_obj.location);
+            if (fence_state->State() == vvl::Fence::kInflight) {
+                skip |= LogError("VUID-vkResetFences-pFences-01123", pFences[i], error_obj.location.dot(Field::pFences, i),
+                                 "(%s) is in use.", FormatHandle(pFences[i]).c_str());
+            }
         }
     }
     return skip;
@@ -1454,6 +1465,7 @@ bool CoreChecks::PreCallValidateSignalSemaphore(VkDevice device, const VkSemapho
         return skip;
     }
 
+    semaphore_state->WaitObservedValue(signal_loc);
     const auto current_payload = semaphore_state->CurrentPayload();
     if (current_payload >= pSignalInfo->value) {
         skip |= LogError("VUID-VkSemaphoreSignalInfo-value-03258", pSignalInfo->semaphore, signal_loc.dot(Field::value),
@@ -1931,12 +1943,13 @@ void CoreChecks::EnqueueSubmitTimeValidateImageBarrierAttachment(const Location
             const auto &sub_desc = rp_state->create_info.pSubpasses[active_subpass];
             // Secondary CB case w/o FB specified delay validation
             auto *this_ptr = this;  // Required for older compilers with c++20 compatibility
-            vvl::LocationCapture loc_capture(loc);
+            const vvl::EncodedLocation encoded_loc(loc);
             const VkRenderPass render_pass = rp_state->VkHandle();
             cb_state.cmd_execute_commands_functions.emplace_back(
-                [this_ptr, loc_capture, active_subpass, sub_desc, render_pass, barrier](
+                [this_ptr, encoded_loc, active_subpass, sub_desc, render_pass, barrier](
                     const vvl::CommandBuffer &secondary_cb, const vvl::CommandBuffer *primary_cb, const vvl::Framebuffer *fb) {
                     if (!fb) return false;
+                    const vvl::LocationCapture loc_capture(encoded_loc);
                     return this_ptr->ValidateImageBarrierAttachment(loc_capture.Get(), secondary_cb, *fb, active_subpass, sub_desc,
                                                                     render_pass, barrier, primary_cb);
                 });
@@ -1968,10 +1981,11 @@ void CoreChecks::RecordBarrierValidationInfo(const Location &loc, vvl::CommandBu
         const bool mode_concurrent = handle_state && handle_state->create_info.sharingMode == VK_SHARING_MODE_CONCURRENT;
         if (!mode_concurrent) {
             const auto typed_handle = barrier.GetTypedHandle();
-            vvl::LocationCapture loc_capture(loc);
+            const vvl::EncodedLocation encoded_loc(loc);
             cb_state.queue_submit_functions.emplace_back(
-                [loc_capture, typed_handle, src_queue_family, dst_queue_family](
+                [encoded_loc, typed_handle, src_queue_family, dst_queue_family](
                     const ValidationStateTracker &device_data, const vvl::Queue &queue_state, const vvl::CommandBuffer &cb_state) {
+                    const vvl::LocationCapture loc_capture(encoded_loc);
                     return ValidateConcurrentBarrierAtSubmit(loc_capture.Get(), device_data, queue_state, cb_state, typed_handle,
                                                              src_queue_family, dst_queue_family);
                 });
@@ -2038,14 +2052,17 @@ bool CoreChecks::ValidateQueuedQFOTransferBarriers(const vvl::CommandBuffer &cb_
     const auto &cb_barriers = cb_state.GetQFOBarrierSets(TransferBarrier());
     const char *barrier_name = TransferBarrier::BarrierName();
     const char *handle_name = TransferBarrier::HandleName();
+    // The barriers are walked in resource order so the pending releases of each resource are only looked up once
     // No release should have an extant duplicate (WARNING)
-    for (const auto &release : cb_barriers.release) {
-        // Check the global pending release barriers
-        const auto set_it = global_release_barriers.find(release.handle);
-        if (set_it != global_release_barriers.cend()) {
-            const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            const auto found = set_for_handle.find(release);
-            if (found != set_for_handle.cend()) {
+    const auto releases = SortedQFOTransferBarriers(cb_barriers.release);
+    for (auto it = releases.begin(); it != releases.end();) {
+        const auto handle = (*it)->handle;
+        const auto pending = global_release_barriers.find(handle);
+        for (; it != releases.end() && (*it)->handle == handle; ++it) {
+            const TransferBarrier &release = **it;
+            // Check the global pending release barriers
+            const TransferBarrier *found = (pending != global_release_barriers.cend()) ? pending->second.Find(release) : nullptr;
+            if (found) {
                 skip |= LogWarning(TransferBarrier::DuplicateQFOSubmitted(), cb_state.Handle(), loc,
                                    "%s releasing queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
                                    " to dstQueueFamilyIndex %" PRIu32
@@ -2053,25 +2070,27 @@ bool CoreChecks::ValidateQueuedQFOTransferBarriers(const vvl::CommandBuffer &cb_
                                    barrier_name, handle_name, FormatHandle(found->handle).c_str(), found->srcQueueFamilyIndex,
                                    found->dstQueueFamilyIndex);
             }
+            skip |= ValidateAndUpdateQFOScoreboard(cb_state, "releasing", release, &scoreboards->release, loc);
         }
-        skip |= ValidateAndUpdateQFOScoreboard(cb_state, "releasing", release, &scoreboards->release, loc);
     }
     // Each acquire must have a matching release (ERROR)
-    for (const auto &acquire : cb_barriers.acquire) {
-        const auto set_it = global_release_barriers.find(acquire.handle);
-        bool matching_release_found = false;
-        if (set_it != global_release_barriers.cend()) {
-            const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            matching_release_found = set_for_handle.find(acquire) != set_for_handle.cend();
-        }
-        if (!matching_release_found) {
-            skip |= LogError(TransferBarrier::MissingQFOReleaseInSubmit(), cb_state.Handle(), loc,
-                             "in submitted command buffer %s acquiring ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
-                             " to dstQueueFamilyIndex %" PRIu32 " has no matching release barrier queued for execution.",
-                             barrier_name, handle_name, FormatHandle(acquire.handle).c_str(), acquire.srcQueueFamilyIndex,
-                             acquire.dstQueueFamilyIndex);
-        }
-        skip |= ValidateAndUpdateQFOScoreboard(cb_state, "acquiring", acquire, &scoreboards->acquire, loc);
+    const auto acquires = SortedQFOTransferBarriers(cb_barriers.acquire);
+    for (auto it = acquires.begin(); it != acquires.end();) {
+        const auto handle = (*it)->handle;
+        const auto pending = global_release_barriers.find(handle);
+        for (; it != acquires.end() && (*it)->handle == handle; ++it) {
+            const TransferBarrier &acquire = **it;
+            const bool matching_release_found =
+                (pending != global_release_barriers.cend()) && (pending->second.Find(acquire) != nullptr);
+            if (!matching_release_found) {
+                skip |= LogError(TransferBarrier::MissingQFOReleaseInSubmit(), cb_state.Handle(), loc,
+                                 "in submitted command buffer %s acquiring ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
+                                 " to dstQueueFamilyIndex %" PRIu32 " has no matching release barrier queued for execution.",
+                                 barrier_name, handle_name, FormatHandle(acquire.handle).c_str(), acquire.srcQueueFamilyIndex,
+                                 acquire.dstQueueFamilyIndex);
+            }
+            skip |= ValidateAndUpdateQFOScoreboard(cb_state, "acquiring", acquire, &scoreboards->acquire, loc);
+        }
     }
     return skip;
 }
@@ -2091,31 +2110,41 @@ bool CoreChecks::ValidateQueuedQFOTransfers(const vvl::CommandBuffer &cb_state,
 template <typename TransferBarrier>
 void RecordQueuedQFOTransferBarriers(QFOTransferBarrierSets<TransferBarrier> &cb_barriers,
                                      GlobalQFOTransferBarrierMap<TransferBarrier> &global_release_barriers) {
+    // The pending releases of a resource are read and written back once for all the barriers of this submit that use it.
+    // NOTE: vvl::concurrent_ordered_map::find() makes a thread safe copy of the result, so we must copy back after updating.
+
     // Add release barriers from this submit to the global map
-    for (const auto &release : cb_barriers.release) {
-        // the global barrier list is mapped by resource handle to allow cleanup on resource destruction
-        // NOTE: vvl::concurrent_ordered_map::find() makes a thread safe copy of the result, so we must
-        // copy back after updating.
-        auto iter = global_release_barriers.find(release.handle);
-        iter->second.insert(release);
-        global_release_barriers.insert_or_assign(release.handle, iter->second);
+    // the global barrier list is mapped by resource handle to allow cleanup on resource destruction
+    const auto releases = SortedQFOTransferBarriers(cb_barriers.release);
+    for (auto it = releases.begin(); it != releases.end();) {
+        const auto handle = (*it)->handle;
+        auto pending = global_release_barriers.find(handle);
+        for (; it != releases.end() && (*it)->handle == handle; ++it) {
+            pending->second.Insert(**it);
+        }
+        global_release_barriers.insert_or_assign(handle, pending->second);
     }
 
     // Erase acquired barriers from this submit from the global map -- essentially marking releases as consumed
-    for (const auto &acquire : cb_barriers.acquire) {
+    const auto acquires = SortedQFOTransferBarriers(cb_barriers.acquire);
+    for (auto it = acquires.begin(); it != acquires.end();) {
+        const auto handle = (*it)->handle;
+        const auto group_end =
+            std::find_if(it, acquires.end(), [handle](const TransferBarrier *barrier) { return barrier->handle != handle; });
         // NOTE: We're not using [] because we don't want to create entries for missing releases
-        auto set_it = global_release_barriers.find(acquire.handle);
-        if (set_it != global_release_barriers.end()) {
-            QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            set_for_handle.erase(acquire);
-            if (set_for_handle.empty()) {  // Clean up empty sets
-                global_release_barriers.erase(acquire.handle);
+        auto pending = global_release_barriers.find(handle);
+        if (pending != global_release_barriers.end()) {
+            QFOTransferBarrierList<TransferBarrier> &list_for_handle = pending->second;
+            for (; it != group_end; ++it) {
+                list_for_handle.Erase(**it);
+            }
+            if (list_for_handle.empty()) {  // Clean up empty lists
+                global_release_barriers.erase(handle);
             } else {
-                // NOTE: vvl::concurrent_ordered_map::find() makes a thread safe copy of the result, so we must
-                // copy back after updating.
-                global_release_barriers.insert_or_assign(acquire.handle, set_for_handle);
+                global_release_barriers.insert_or_assign(handle, list_for_handle);
             }
         }
+        it = group_end;
     }
 }
 
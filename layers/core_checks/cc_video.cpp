@@ -3338,7 +3338,7 @@ bool CoreChecks::PreCallValidateCmdBeginVideoCodingKHR(VkCommandBuffer commandBu
                                                      "VUID-VkVideoBeginCodingInfoKHR-pPictureResource-07242",
                                                      "VUID-VkVideoBeginCodingInfoKHR-pPictureResource-07243");
                 if (reference_resource) {
-                    if (!unique_resources.emplace(reference_resource).second) {
+                    if (!unique_resources.Insert(reference_resource)) {
                         resources_unique = false;
                     }
 
@@ -3925,7 +3925,7 @@ bool CoreChecks::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuffer,
             if (pDecodeInfo->pReferenceSlots[i].pPictureResource != nullptr) {
                 auto reference_resource = vvl::VideoPictureResource(*this, *pDecodeInfo->pReferenceSlots[i].pPictureResource);
                 if (reference_resource) {
-                    if (!unique_resources.emplace(reference_resource).second) {
+                    if (!unique_resources.Insert(reference_resource)) {
                         resources_unique = false;
                     }
 
@@ -4333,7 +4333,7 @@ bool CoreChecks::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuffer,
             if (pEncodeInfo->pReferenceSlots[i].pPictureResource != nullptr) {
                 auto reference_resource = vvl::VideoPictureResource(*this, *pEncodeInfo->pReferenceSlots[i].pPictureResource);
                 if (reference_resource) {
-                    if (!unique_resources.emplace(reference_resource).second) {
+                    if (!unique_resources.Insert(reference_resource)) {
                         resources_unique = false;
                     }
 
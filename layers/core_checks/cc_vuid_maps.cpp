@@ -22,7 +22,7 @@
 namespace vvl {
 
 const std::string &GetCopyBufferImageDeviceVUID(const Location &loc, CopyError error) {
-    static const std::map<CopyError, std::array<Entry, 4>> errors{
+    static const std::map<CopyError, VuidTable> errors{
         {CopyError::TexelBlockSize_07975,
          {{
              {Key(Func::vkCmdCopyBufferToImage), "VUID-vkCmdCopyBufferToImage-dstImage-07975"},
@@ -129,7 +129,7 @@ const std::string &GetCopyBufferImageDeviceVUID(const Location &loc, CopyError e
 }
 
 const std::string &GetCopyBufferImageVUID(const Location &loc, CopyError error) {
-    static const std::map<CopyError, std::array<Entry, 6>> errors{
+    static const std::map<CopyError, VuidTable> errors{
         {CopyError::ImageOffest_07971,
          {{
              {Key(Func::vkCmdCopyBufferToImage), "VUID-vkCmdCopyBufferToImage-imageSubresource-07971"},
@@ -310,7 +310,7 @@ const std::string &GetCopyBufferImageVUID(const Location &loc, CopyError error)
 }
 
 const std::string &GetCopyImageVUID(const Location &loc, CopyError error) {
-    static const std::map<CopyError, std::array<Entry, 3>> errors{
+    static const std::map<CopyError, VuidTable> errors{
         {CopyError::SrcImage1D_00146,
          {{
              {Key(Func::vkCmdCopyImage), "VUID-vkCmdCopyImage-srcImage-00146"},
@@ -503,7 +503,7 @@ const std::string &GetCopyImageVUID(const Location &loc, CopyError error) {
 }
 
 const std::string &GetImageMipLevelVUID(const Location &loc) {
-    static const std::array<Entry, 20> errors{{
+    static const VuidTable errors{{
         {Key(Func::vkCmdCopyImage, Field::srcSubresource), "VUID-vkCmdCopyImage-srcSubresource-07967"},
         {Key(Func::vkCmdCopyImage, Field::dstSubresource), "VUID-vkCmdCopyImage-dstSubresource-07967"},
         {Key(Func::vkCmdCopyImage2, Field::srcSubresource), "VUID-VkCopyImageInfo2-srcSubresource-07967"},
@@ -536,7 +536,7 @@ const std::string &GetImageMipLevelVUID(const Location &loc) {
 }
 
 const std::string &GetImageArrayLayerRangeVUID(const Location &loc) {
-    static const std::array<Entry, 20> errors{{
+    static const VuidTable errors{{
         {Key(Func::vkCmdCopyImage, Field::srcSubresource), "VUID-vkCmdCopyImage-srcSubresource-07968"},
         {Key(Func::vkCmdCopyImage, Field::dstSubresource), "VUID-vkCmdCopyImage-dstSubresource-07968"},
         {Key(Func::vkCmdCopyImage2, Field::srcSubresource), "VUID-VkCopyImageInfo2-srcSubresource-07968"},
@@ -569,7 +569,7 @@ const std::string &GetImageArrayLayerRangeVUID(const Location &loc) {
 }
 
 const std::string &GetSubresourceRangeVUID(const Location &loc, SubresourceRangeError error) {
-    static const std::map<SubresourceRangeError, std::array<Entry, 6>> errors{
+    static const std::map<SubresourceRangeError, VuidTable> errors{
         {SubresourceRangeError::BaseMip_01486,
          {{
              {Key(Struct::VkImageMemoryBarrier), "VUID-VkImageMemoryBarrier-subresourceRange-01486"},
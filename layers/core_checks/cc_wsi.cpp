@@ -829,8 +829,15 @@ bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentIn
             const auto *image_state = swapchain_data->images[pPresentInfo->pImageIndices[i]].image_state;
             ASSERT_AND_CONTINUE(image_state);
 
+            // Images presented every frame are usually transitioned as a whole, then the layouts are checked without locking
+            // or walking the map
+            const VkImageLayout uniform_layout =
+                image_state->layout_range_map ? image_state->layout_range_map->UniformLayout() : VK_IMAGE_LAYOUT_MAX_ENUM;
+            const bool uniform_presentable = uniform_layout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR ||
+                                             (uniform_layout == VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR &&
+                                              IsExtEnabled(device_extensions.vk_khr_shared_presentable_image));
             std::vector<VkImageLayout> layouts;
-            if (FindLayouts(*image_state, layouts)) {
+            if (!uniform_presentable && FindLayouts(*image_state, layouts)) {
                 for (auto layout : layouts) {
                     if ((layout != VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) &&
                         (!IsExtEnabled(device_extensions.vk_khr_shared_presentable_image) ||
@@ -865,7 +872,7 @@ bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentIn
 
         // All physical devices and queue families are required to be able to present to any native window on Android
         if (!IsExtEnabled(instance_extensions.vk_khr_android_surface)) {
-            auto surface_state = Get<vvl::Surface>(swapchain_data->create_info.surface);
+            const auto *surface_state = swapchain_data->surface.get();
             if (surface_state && !surface_state->GetQueueSupport(physical_device, queue_state->queue_family_index)) {
                 skip |= LogError("VUID-vkQueuePresentKHR-pSwapchains-01292", pPresentInfo->pSwapchains[i], swapchain_loc,
                                  "image on queue that cannot present to this surface.");
@@ -1045,7 +1052,8 @@ bool CoreChecks::PreCallValidateReleaseSwapchainImagesEXT(VkDevice device, const
                                  release_info_loc.dot(Field::pImageIndices, i), "%" PRIu32 " was not acquired from the swapchain.",
                                  image_index);
             }
-            if (swapchain_state->images[image_index].image_state->InUse()) {
+            if (InUseAfterObservedSemaphores(*swapchain_state->images[image_index].image_state,
+                                             release_info_loc.dot(Field::pImageIndices, i))) {
                 image_in_use = true;
             }
         }
@@ -1093,7 +1101,7 @@ bool CoreChecks::ValidateAcquireNextImage(VkDevice device, VkSwapchainKHR swapch
                     version_2 ? "VUID-VkAcquireNextImageInfoKHR-semaphore-01288" : "VUID-vkAcquireNextImageKHR-semaphore-01286";
                 skip |= LogError(vuid, semaphore, loc, "Semaphore must not be currently signaled.");
             }
-            if (semaphore_state->InUse()) {
+            if (InUseAfterObservedSemaphores(*semaphore_state, loc)) {
                 const char *vuid =
                     version_2 ? "VUID-VkAcquireNextImageInfoKHR-semaphore-01781" : "VUID-vkAcquireNextImageKHR-semaphore-01779";
                 skip |= LogError(vuid, semaphore, loc, "Semaphore must not have any pending operations.");
@@ -25,12 +25,17 @@
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
 #include "containers/qfo_transfer.h"
+#include "core_checks/cc_pipeline_validation_cache.h"
+#include "core_checks/cc_rendering_attachment_validation_cache.h"
+#include "core_checks/cc_shader_object_validation_cache.h"
+#include "utils/thread_pool.h"
 #include <spirv-tools/libspirv.hpp>
 
 typedef vvl::unordered_map<const vvl::Image*, std::optional<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
 
 namespace vvl {
 struct DrawDispatchVuid;
+class AttachmentUsageIndex;
 }  // namespace vvl
 
 namespace spirv {
@@ -41,7 +46,7 @@ struct SubpassLayout;
 struct DAGNode;
 struct SemaphoreSubmitState;
 
-class CoreChecks : public ValidationStateTracker {
+class CoreChecks final : public ValidationStateTracker {
   public:
     using StateTracker = ValidationStateTracker;
     using Func = vvl::Func;
@@ -57,6 +62,8 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<QFOBufferTransferBarrier> qfo_release_buffer_barrier_map;
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
     std::string validation_cache_path;
+    // Where spirv_analysis_cache is loaded from and saved to
+    std::string spirv_analysis_cache_path;
 
     // The options are set from extensions/features only, so only need ot create once.
     // This also is needed for shader caching (You can have the same SPIR-V, but different Vulkan features making it legal/illegal
@@ -64,6 +71,37 @@ class CoreChecks : public ValidationStateTracker {
     spvtools::ValidatorOptions spirv_val_options;
     uint32_t spirv_val_option_hash;
 
+    // Every dynamic state a draw with shader objects may need set, a superset lets draw validation skip the per state checks
+    // once they were all set. Set from the features and extensions, like the pipelines' own dynamic_state at creation time.
+    CBDynamicFlags graphics_shader_object_dynamic_states;
+
+    // Only created when parallel submit validation is enabled
+    std::unique_ptr<vvl::ThreadPool> submit_validation_pool;
+
+    // Only created when async spirv-val is enabled
+    std::unique_ptr<vvl::ThreadPool> spirv_validation_pool;
+    // spirv-val of a vkCreateShaderModule call that is still running, or whose messages were not reported yet
+    struct PendingSpirvValidation {
+        explicit PendingSpirvValidation(vvl::ThreadPool& pool) : task(pool) {}
+        // Keeps the address used as the key alive, even if the module was never created
+        std::shared_ptr<const spirv::Module> module_state;
+        bool skip = false;
+        DeferredMessages messages;
+        vvl::TaskGroup task;
+    };
+    // Declared after spirv_validation_pool so the tasks are finished before the pool goes away
+    mutable std::mutex pending_spirv_validation_lock;
+    mutable vvl::unordered_map<const spirv::Module*, std::shared_ptr<PendingSpirvValidation>> pending_spirv_validation;
+
+    // Graphics pipelines that passed ValidateGraphicsPipeline, identical creates skip it
+    mutable GraphicsPipelineValidationCache graphics_pipeline_validation_cache;
+    // Bound graphics shader object combinations that passed ValidateDrawShaderObjectLinking and
+    // ValidateDrawShaderObjectPushConstantAndLayout, later draws with the same combination skip them
+    mutable ShaderObjectValidationCache shader_object_validation_cache;
+    // Dynamic rendering attachments that passed ValidateRenderingAttachmentInfo, later vkCmdBeginRendering with the same
+    // attachment skip it
+    mutable RenderingAttachmentValidationCache rendering_attachment_validation_cache;
+
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
     ReadLockGuard ReadLock() const override;
@@ -78,6 +116,11 @@ class CoreChecks : public ValidationStateTracker {
                                       const char* vuid) const;
     bool ValidateGraphicsPipelineDerivatives(PipelineStates& pipeline_states, uint32_t pipe_index, const Location& loc) const;
     bool ValidateComputePipelineDerivatives(PipelineStates& pipeline_states, uint32_t pipe_index, const Location& loc) const;
+    // Calls validate(i) for i in [0, count). With parallel pipeline validation the calls run on pipeline_validation_pool and
+    // their messages are reported in index order, so validate() must only read state.
+    bool ValidateInParallel(uint32_t count, const std::function<bool(uint32_t)>& validate) const;
+    // Calls validate(i) for each pipeline of a vkCreate*Pipelines call, see ValidateInParallel
+    bool ValidatePipelineCreateInfos(uint32_t count, const std::function<bool(uint32_t)>& validate) const;
     bool ValidateMultiViewShaders(const vvl::Pipeline& pipeline, const Location& multiview_loc, uint32_t view_mask,
                                   bool dynamic_rendering) const;
     bool ValidateDrawPipelineVertexAttribute(const vvl::CommandBuffer& cb_state, const vvl::Pipeline& pipeline,
@@ -100,6 +143,8 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateDynamicStateIsSet(const LastBound& last_bound_state, const CBDynamicFlags& state_status_cb,
                                    CBDynamicState dynamic_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
+    bool ValidateGraphicsDynamicStatesAreSet(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
+    CBDynamicFlags GetGraphicsShaderObjectDynamicStates() const;
     bool ValidateGraphicsDynamicStatePipelineSetStatus(const LastBound& last_bound_state, const vvl::Pipeline& pipeline,
                                                        const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateGraphicsDynamicStateValue(const LastBound& last_bound_state, const vvl::Pipeline& pipeline,
@@ -232,10 +277,12 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateGraphicsPipelineBindPoint(const vvl::CommandBuffer& cb_state, const vvl::Pipeline& pipeline,
                                            const Location& loc) const;
     bool ValidatePipelineBindPoint(const vvl::CommandBuffer& cb_state, VkPipelineBindPoint bind_point, const Location& loc) const;
-    bool ValidateMemoryIsMapped(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
-                                const ErrorObject& error_obj) const;
-    bool ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
-                                               const ErrorObject& error_obj) const;
+    bool ValidateMappedMemoryRanges(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
+                                    const ErrorObject& error_obj) const;
+    bool ValidateMemoryIsMapped(const VkMappedMemoryRange& mem_range, const vvl::DeviceMemory& mem_info,
+                                const Location& memory_range_loc) const;
+    bool ValidateMappedMemoryRangeDeviceLimits(const VkMappedMemoryRange& mem_range, const vvl::DeviceMemory& mem_info,
+                                               const Location& memory_range_loc) const;
     bool ValidateSecondaryCommandBufferState(const vvl::CommandBuffer& cb_state, const vvl::CommandBuffer& sub_cb_state,
                                              const Location& cb_loc) const;
     bool ValidateInheritanceInfoFramebuffer(VkCommandBuffer primaryBuffer, const vvl::CommandBuffer& cb_state,
@@ -288,11 +335,13 @@ class CoreChecks : public ValidationStateTracker {
                                               int current_submit_count) const;
     bool ValidateAttachmentReference(VkAttachmentReference2 reference, const VkFormat attachment_format, bool input,
                                      const Location& loc) const;
-    bool ValidateRenderpassAttachmentUsage(const VkRenderPassCreateInfo2* pCreateInfo, const ErrorObject& error_obj) const;
+    bool ValidateRenderpassAttachmentUsage(const VkRenderPassCreateInfo2* pCreateInfo,
+                                           const vvl::AttachmentUsageIndex& usage_index, const ErrorObject& error_obj) const;
     bool AddAttachmentUse(std::vector<uint8_t>& attachment_uses, std::vector<VkImageLayout>& attachment_layouts,
                           uint32_t attachment, uint8_t new_use, VkImageLayout new_layout, const Location loc) const;
     bool ValidateAttachmentIndex(uint32_t attachment, uint32_t attachment_count, const Location& loc) const;
-    bool ValidateCreateRenderPass(const VkRenderPassCreateInfo2* pCreateInfo, const ErrorObject& error_obj) const;
+    bool ValidateCreateRenderPass(const VkRenderPassCreateInfo2* pCreateInfo, const vvl::AttachmentUsageIndex& usage_index,
+                                  const ErrorObject& error_obj) const;
 
     bool ValidateRenderPassPipelineStage(VkRenderPass render_pass, const Location& barrier_loc,
                                          VkPipelineStageFlags2 src_stage_mask, VkPipelineStageFlags2 dst_stage_mask) const;
@@ -558,8 +607,8 @@ class CoreChecks : public ValidationStateTracker {
                                                 void* pData) override;
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
     bool ValidateDrawState(const vvl::DescriptorSet& descriptor_set, uint32_t set_index, const BindingVariableMap& bindings,
-                           const std::vector<uint32_t>& dynamic_offsets, const vvl::CommandBuffer& cb_state, const Location& loc,
-                           const vvl::DrawDispatchVuid& vuid) const;
+                           const LastBound::DynamicOffsets& dynamic_offsets, const vvl::CommandBuffer& cb_state,
+                           const Location& loc, const vvl::DrawDispatchVuid& vuid) const;
 
     bool VerifySetLayoutCompatibility(const vvl::DescriptorSetLayout& layout_dsl,
                                       const vvl::DescriptorSetLayout& bound_dsl, std::string& error_msg) const;
@@ -684,10 +733,20 @@ class CoreChecks : public ValidationStateTracker {
     void PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos,
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
-    bool RunSpirvValidation(spv_const_binary_t& binary, const Location& loc, ValidationCache* cache) const;
+    bool RunSpirvValidation(spv_const_binary_t& binary, const hash_util::Hash128& hash, const Location& loc,
+                            ValidationCache* cache) const;
+    ValidationCache* GetShaderModuleValidationCache(const VkShaderModuleCreateInfo& create_info) const;
+    bool CanRunSpirvValidation(const VkShaderModuleCreateInfo& create_info) const;
+    bool IsAsyncSpirvValidation(const VkShaderModuleCreateInfo& create_info, const Location& create_info_loc) const;
+    // Waits for the async spirv-val of module_state (if any) and reports its messages
+    bool ReportPendingSpirvValidation(const spirv::Module& module_state) const;
+    // Same for every module, used at sync points and before a validation cache is accessed
+    bool ReportAllPendingSpirvValidation() const;
     bool ValidateSpirvStateless(const spirv::Module& module_state, const spirv::StatelessData& stateless_data,
                                 const Location& loc) const;
-    bool ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo& create_info, const Location& create_info_loc) const;
+    // module_state is the parsed create_info when there is one, to reuse its hash
+    bool ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo& create_info, const Location& create_info_loc,
+                                        const spirv::Module* module_state = nullptr) const;
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                            const ErrorObject& error_obj) const override;
@@ -1128,6 +1187,8 @@ class CoreChecks : public ValidationStateTracker {
 
     bool PreCallValidateDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator,
                                          const ErrorObject& error_obj) const override;
+    void PreCallRecordDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator,
+                                       const RecordObject& record_obj) override;
 
     bool PreCallValidateDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator,
                                       const ErrorObject& error_obj) const override;
@@ -1317,6 +1378,9 @@ class CoreChecks : public ValidationStateTracker {
                                       const ErrorObject& error_obj) const override;
     bool PreCallValidateCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo,
                                                const ErrorObject& error_obj) const override;
+    void PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator,
+                                          const RecordObject& record_obj) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject& record_obj) override;
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                     const RecordObject& record_obj) override;
     bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
@@ -1476,6 +1540,8 @@ class CoreChecks : public ValidationStateTracker {
     bool PreCallValidateCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos,
                                          const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                          const ErrorObject& error_obj) const override;
+    void PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
+                                       const RecordObject& record_obj) override;
     bool PreCallValidateDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
                                          const ErrorObject& error_obj) const override;
     bool PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount, const VkShaderStageFlagBits* pStages,
@@ -1527,12 +1593,13 @@ class CoreChecks : public ValidationStateTracker {
                                      const Location& info_loc) const;
     bool CommonBuildAccelerationStructureValidation(const VkAccelerationStructureBuildGeometryInfoKHR& info,
                                                     const Location& info_loc, LogObjectList object_list) const;
-    bool ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList& objlist, uint32_t infoCount,
-                                                       const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, uint32_t info_i,
+    // Validate the memory aliasing between the acceleration structures of all the infos of a build command at once
+    bool ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList& objlist, uint32_t info_count,
+                                                       const VkAccelerationStructureBuildGeometryInfoKHR* p_infos,
                                                        const ErrorObject& error_obj) const;
     bool ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
         const LogObjectList& objlist, uint32_t info_count, const VkAccelerationStructureBuildGeometryInfoKHR* p_infos,
-        uint32_t info_i, const VkAccelerationStructureBuildRangeInfoKHR* const* pp_range_infos, const ErrorObject& error_obj) const;
+        const VkAccelerationStructureBuildRangeInfoKHR* const* pp_range_infos, const ErrorObject& error_obj) const;
     bool PreCallValidateCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                           const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
                                                           const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos,
@@ -1782,7 +1849,9 @@ class CoreChecks : public ValidationStateTracker {
                                                         const VkFramebufferCreateInfo& fbci, const VkRenderPassCreateInfo2& rpci,
                                                         uint32_t subpass, VkSampleCountFlagBits sample_count,
                                                         const Location& create_info_loc) const;
-    bool ValidateFragmentShadingRateAttachments(const VkRenderPassCreateInfo2* pCreateInfo, const ErrorObject& error_obj) const;
+    bool ValidateFragmentShadingRateAttachments(const VkRenderPassCreateInfo2* pCreateInfo,
+                                                const vvl::AttachmentUsageIndex& usage_index,
+                                                const ErrorObject& error_obj) const;
     bool PreCallValidateCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo,
                                              const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass,
                                              const ErrorObject& error_obj) const override;
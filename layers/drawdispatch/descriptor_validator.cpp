@@ -16,6 +16,10 @@
  */
 
 #include "descriptor_validator.h"
+
+#include <algorithm>
+#include <array>
+
 #include "generated/spirv_grammar_helper.h"
 #include "state_tracker/shader_stage_state.h"
 #include "error_message/error_strings.h"
@@ -49,6 +53,79 @@ static const char *GetActionType(vvl::Func command) {
     }
 }
 
+namespace {
+// What the validation of a descriptor reads from it. Descriptors of a binding with the same payload give the same result,
+// unless the shader has requirements for some array elements only (see HasPerIndexRequirements)
+struct DescriptorPayload {
+    const void *state = nullptr;
+    const void *sampler_state = nullptr;
+    uint64_t handle = 0;
+    uint64_t extra = 0;
+
+    bool operator==(const DescriptorPayload &other) const {
+        return state == other.state && sampler_state == other.sampler_state && handle == other.handle && extra == other.extra;
+    }
+};
+
+DescriptorPayload GetPayload(const vvl::BufferDescriptor &descriptor) {
+    return {descriptor.GetBufferState(), nullptr, CastToUint64(descriptor.GetBuffer()), 0};
+}
+
+DescriptorPayload GetPayload(const vvl::ImageDescriptor &descriptor) {
+    return {descriptor.GetImageViewState(), nullptr, CastToUint64(descriptor.GetImageView()), descriptor.GetImageLayout()};
+}
+
+DescriptorPayload GetPayload(const vvl::ImageSamplerDescriptor &descriptor) {
+    const uint64_t extra = (uint64_t(descriptor.IsImmutableSampler()) << 32) | descriptor.GetImageLayout();
+    return {descriptor.GetImageViewState(), descriptor.GetSamplerState(), CastToUint64(descriptor.GetImageView()), extra};
+}
+
+DescriptorPayload GetPayload(const vvl::SamplerDescriptor &descriptor) {
+    return {nullptr, descriptor.GetSamplerState(), CastToUint64(descriptor.GetSampler()), descriptor.IsImmutableSampler()};
+}
+
+DescriptorPayload GetPayload(const vvl::TexelDescriptor &descriptor) {
+    return {descriptor.GetBufferViewState(), nullptr, CastToUint64(descriptor.GetBufferView()), 0};
+}
+
+DescriptorPayload GetPayload(const vvl::AccelerationStructureDescriptor &descriptor) {
+    if (descriptor.is_khr()) {
+        return {descriptor.GetAccelerationStructureStateKHR(), nullptr, CastToUint64(descriptor.GetAccelerationStructure()), 1};
+    }
+    return {descriptor.GetAccelerationStructureStateNV(), nullptr, CastToUint64(descriptor.GetAccelerationStructureNV()), 0};
+}
+
+// Payloads of the last descriptors which passed validation. Bindless tables usually point most elements at a handful of
+// resources (a default texture...), so a few entries are enough to validate each of them once per binding.
+class PassedPayloads {
+  public:
+    bool Contains(const DescriptorPayload &payload) const {
+        return std::find(payloads_.begin(), payloads_.begin() + count_, payload) != payloads_.begin() + count_;
+    }
+    void Add(const DescriptorPayload &payload) {
+        payloads_[next_] = payload;
+        next_ = (next_ + 1) % kSize;
+        count_ = std::min(count_ + 1, kSize);
+    }
+
+  private:
+    static constexpr size_t kSize = 4;
+    std::array<DescriptorPayload, kSize> payloads_{};
+    size_t count_ = 0;
+    size_t next_ = 0;
+};
+
+// Constant indexes into an image array, and the samplers an image is used with, are tracked per array element
+bool HasPerIndexRequirements(const vvl::DescriptorBindingInfo &binding_info) {
+    for (const auto &req : binding_info.second) {
+        if (req.variable && (!req.variable->image_access_chain_indexes.empty() || !req.variable->samplers_used_by_image.empty())) {
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
 std::string vvl::DescriptorValidator::DescribeDescriptor(const DescriptorBindingInfo &binding_info, uint32_t index) const {
     std::stringstream ss;
     ss << FormatHandle(descriptor_set.Handle()) << " [Set " << set_index << ", Binding " << binding_info.first << ", Index "
@@ -79,6 +156,8 @@ vvl::DescriptorValidator::DescriptorValidator(ValidationStateTracker &dev, vvl::
 template <typename T>
 bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &binding_info, const T &binding) const {
     bool skip = false;
+    const bool dedup = !HasPerIndexRequirements(binding_info);
+    PassedPayloads passed;
     for (uint32_t index = 0; !skip && index < binding.count; index++) {
         const auto &descriptor = binding.descriptors[index];
 
@@ -89,7 +168,18 @@ bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &
                 "the descriptor %s is being used in %s but has never been updated via vkUpdateDescriptorSets() or a similar call.",
                 DescribeDescriptor(binding_info, index).c_str(), GetActionType(loc.function));
         }
+        if (!dedup) {
+            skip |= ValidateDescriptor(binding_info, index, binding.type, descriptor);
+            continue;
+        }
+        const DescriptorPayload payload = GetPayload(descriptor);
+        if (passed.Contains(payload)) {
+            continue;
+        }
         skip |= ValidateDescriptor(binding_info, index, binding.type, descriptor);
+        if (!skip) {
+            passed.Add(payload);
+        }
     }
     return skip;
 }
@@ -129,6 +219,8 @@ template <typename T>
 bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &binding_info, const T &binding,
                                                     const std::vector<uint32_t> &indices) {
     bool skip = false;
+    const bool dedup = !HasPerIndexRequirements(binding_info);
+    PassedPayloads passed;
     for (auto index : indices) {
         const auto &descriptor = binding.descriptors[index];
 
@@ -139,7 +231,19 @@ bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &
                 "the descriptor %s is being used in %s but has never been updated via vkUpdateDescriptorSets() or a similar call.",
                 DescribeDescriptor(binding_info, index).c_str(), GetActionType(loc.function));
         }
-        skip |= ValidateDescriptor(binding_info, index, binding.type, descriptor);
+        if (!dedup) {
+            skip |= ValidateDescriptor(binding_info, index, binding.type, descriptor);
+            continue;
+        }
+        const DescriptorPayload payload = GetPayload(descriptor);
+        if (passed.Contains(payload)) {
+            continue;
+        }
+        const bool descriptor_skip = ValidateDescriptor(binding_info, index, binding.type, descriptor);
+        if (!descriptor_skip) {
+            passed.Add(payload);
+        }
+        skip |= descriptor_skip;
     }
     return skip;
 }
@@ -17,6 +17,8 @@
  */
 #include "error_location.h"
 
+#include <algorithm>
+
 void Location::AppendFields(std::ostream& out) const {
     if (prev) {
         // When apply a .dot(sub_index) we duplicate the field item
@@ -56,41 +58,49 @@ std::string Location::Message() const {
 }
 
 namespace vvl {
-LocationCapture::LocationCapture(const Location& loc) { Capture(loc, 1); }
-
-LocationCapture::LocationCapture(const LocationCapture& other)
-    : capture(other.capture) {
-    if (capture.empty()) {
-        return;
-    }
-    capture[0].prev = nullptr;
-    for (CaptureStore::size_type i = 1; i < capture.size(); i++) {
-        capture[i].prev = &capture[i - 1];
+EncodedLocation::EncodedLocation(const Location& loc) : function(static_cast<uint16_t>(loc.function)), depth(0), levels{} {
+    assert(static_cast<uint32_t>(loc.function) <= UINT16_MAX);
+    uint32_t total_depth = 0;
+    for (const Location* level = &loc; level; level = level->prev) {
+        ++total_depth;
+    }
+    assert(total_depth <= kMaxDepth);
+    depth = static_cast<uint16_t>(std::min(total_depth, kMaxDepth));
+
+    // Walking from the innermost level, which goes last
+    const Location* level = &loc;
+    for (uint32_t i = depth; i-- > 0; level = level->prev) {
+        assert(static_cast<uint32_t>(level->structure) < (1u << 16) && static_cast<uint32_t>(level->field) < (1u << 15));
+        levels[i].structure = static_cast<uint32_t>(level->structure);
+        levels[i].field = static_cast<uint32_t>(level->field);
+        levels[i].is_pnext = level->isPNext ? 1 : 0;
+        levels[i].index = level->index;
     }
 }
 
-LocationCapture::LocationCapture(LocationCapture&& other)
-    : capture(std::move(other.capture)) {
-    if (capture.empty()) {
-        return;
-    }
-    capture[0].prev = nullptr;
-    for (CaptureStore::size_type i = 1; i < capture.size(); i++) {
-        capture[i].prev = &capture[i - 1];
-    }
+LocationCapture::LocationCapture(const Location& loc) : encoded(loc) { Decode(); }
+
+LocationCapture::LocationCapture(const EncodedLocation& encoded_loc) : encoded(encoded_loc) { Decode(); }
+
+LocationCapture::LocationCapture(const LocationCapture& other) : encoded(other.encoded) { Decode(); }
+
+LocationCapture& LocationCapture::operator=(const LocationCapture& other) {
+    encoded = other.encoded;
+    Decode();
+    return *this;
 }
 
-const Location* LocationCapture::Capture(const Location& loc, CaptureStore::size_type depth) {
-    const Location* prev_capture = nullptr;
-    if (loc.prev) {
-        prev_capture = Capture(*loc.prev, depth + 1);
-    } else {
-        capture.reserve(depth);
+void LocationCapture::Decode() {
+    // Location is trivially destructible, the levels can simply be overwritten
+    Location* levels = reinterpret_cast<Location*>(chain);
+    const auto function = static_cast<Func>(encoded.function);
+    const EncodedLocation::Level& root = encoded.levels[0];
+    new (&levels[0]) Location(function, static_cast<Struct>(root.structure), static_cast<Field>(root.field), root.index);
+    for (uint32_t i = 1; i < encoded.depth; ++i) {
+        const EncodedLocation::Level& level = encoded.levels[i];
+        new (&levels[i]) Location(*std::launder(&levels[i - 1]), static_cast<Struct>(level.structure),
+                                  static_cast<Field>(level.field), level.index, level.is_pnext != 0);
     }
-
-    capture.emplace_back(loc);
-    capture.back().prev = prev_capture;
-    return &(capture.back());
 }
 
 bool operator<(const Key& lhs, const Key& rhs) {
@@ -157,4 +167,77 @@ bool operator==(const Key& key, const Location& loc) {
     return false;
 }
 
+VuidTable::VuidTable(std::initializer_list<Entry> entries) : entries_(entries) {
+    index_.reserve(entries_.size());
+    for (uint32_t i = 0; i < entries_.size(); ++i) {
+        const Key& key = entries_[i].k;
+        assert(key.function != Func::Empty || key.structure != Struct::Empty);
+        // A duplicated key keeps its first entry, like the linear search did
+        index_.emplace(IndexKey(key.function, key.structure, key.field), i);
+        const uint32_t shape = (key.function != Func::Empty) | ((key.structure != Struct::Empty) << 1) |
+                               ((key.field != Field::Empty) << 2);
+        shapes_ |= 1u << shape;
+    }
+}
+
+uint64_t VuidTable::IndexKey(Func function, Struct structure, Field field) {
+    assert(static_cast<uint64_t>(function) < (1u << 21) && static_cast<uint64_t>(structure) < (1u << 21) &&
+           static_cast<uint64_t>(field) < (1u << 21));
+    return (static_cast<uint64_t>(function) << 42) | (static_cast<uint64_t>(structure) << 21) | static_cast<uint64_t>(field);
+}
+
+const std::string* VuidTable::Find(Func function, Struct structure, Field field) const {
+    const std::string* found = nullptr;
+    for (uint32_t shape = 1; shape < 8; ++shape) {
+        if ((shapes_ & (1u << shape)) == 0) {
+            continue;
+        }
+        const auto it = index_.find(IndexKey((shape & 1) ? function : Func::Empty, (shape & 2) ? structure : Struct::Empty,
+                                             (shape & 4) ? field : Field::Empty));
+        if (it != index_.end()) {
+            // consistency check: there should never be more than 1 match in a table
+            assert(!found);
+            found = &entries_[it->second].v;
+#ifdef NDEBUG
+            break;
+#endif
+        }
+    }
+    return found;
+}
+
+const std::string& FindVUID(const Location& loc, const VuidTable& table) {
+    // TODO - Remove having to squash KHR version here
+    Func f = loc.function;
+    if (f == Func::vkQueueSubmit2KHR) {
+        f = Func::vkQueueSubmit2;
+    } else if (f == Func::vkCmdPipelineBarrier2KHR) {
+        f = Func::vkCmdPipelineBarrier2;
+    } else if (f == Func::vkCmdResetEvent2KHR) {
+        f = Func::vkCmdResetEvent2;
+    } else if (f == Func::vkCmdSetEvent2KHR) {
+        f = Func::vkCmdSetEvent2;
+    } else if (f == Func::vkCmdWaitEvents2KHR) {
+        f = Func::vkCmdWaitEvents2;
+    } else if (f == Func::vkCmdWriteTimestamp2KHR) {
+        f = Func::vkCmdWriteTimestamp2;
+    } else if (f == Func::vkCmdBlitImage2KHR) {
+        f = Func::vkCmdBlitImage2;
+    } else if (f == Func::vkCmdCopyBufferToImage2KHR) {
+        f = Func::vkCmdCopyBufferToImage2;
+    } else if (f == Func::vkCmdCopyBuffer2KHR) {
+        f = Func::vkCmdCopyBuffer2;
+    } else if (f == Func::vkCmdCopyImage2KHR) {
+        f = Func::vkCmdCopyImage2;
+    } else if (f == Func::vkCmdCopyImageToBuffer2KHR) {
+        f = Func::vkCmdCopyImageToBuffer2;
+    } else if (f == Func::vkCmdResolveImage2KHR) {
+        f = Func::vkCmdResolveImage2;
+    }
+
+    static const std::string empty;
+    const std::string* vuid = table.Find(f, loc.structure, loc.field);
+    return vuid ? *vuid : empty;
+}
+
 }  // namespace vvl
@@ -18,7 +18,11 @@
 #pragma once
 
 #include <cstdint>
+#include <initializer_list>
+#include <new>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "generated/error_location_helper.h"
 #include "logging.h"
@@ -29,7 +33,7 @@
 // Holds the 'Location' of where the code is inside a function/struct/etc
 // see docs/error_object.md for more details
 struct Location {
-    static const uint32_t kNoIndex = vvl::kU32Max;
+    static constexpr uint32_t kNoIndex = vvl::kU32Max;
 
     // name of the vulkan function we're checking
     const vvl::Func function;
@@ -40,11 +44,11 @@ struct Location {
     const bool isPNext;    // will print the struct is from a 'pNext` chain
     const Location* prev;
 
-    Location(vvl::Func func, vvl::Struct s, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
+    constexpr Location(vvl::Func func, vvl::Struct s, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
         : function(func), structure(s), field(f), index(i), isPNext(false), prev(nullptr) {}
-    Location(vvl::Func func, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
+    constexpr Location(vvl::Func func, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
         : function(func), structure(vvl::Struct::Empty), field(f), index(i), isPNext(false), prev(nullptr) {}
-    Location(const Location& prev_loc, vvl::Struct s, vvl::Field f, uint32_t i, bool p)
+    constexpr Location(const Location& prev_loc, vvl::Struct s, vvl::Field f, uint32_t i, bool p)
         : function(prev_loc.function), structure(s), field(f), index(i), isPNext(p), prev(&prev_loc) {}
 
     void AppendFields(std::ostream &out) const;
@@ -53,21 +57,21 @@ struct Location {
 
     // the dot() method is for walking down into a structure that is being validated
     // eg:  loc.dot(Field::pMemoryBarriers, 5).dot(Field::srcStagemask)
-    Location dot(vvl::Struct s, vvl::Field sub_field, uint32_t sub_index = kNoIndex) const {
+    constexpr Location dot(vvl::Struct s, vvl::Field sub_field, uint32_t sub_index = kNoIndex) const {
         Location result(*this, s, sub_field, sub_index, false);
         return result;
     }
-    Location dot(vvl::Field sub_field, uint32_t sub_index = kNoIndex) const {
+    constexpr Location dot(vvl::Field sub_field, uint32_t sub_index = kNoIndex) const {
         Location result(*this, this->structure, sub_field, sub_index, false);
         return result;
     }
-    Location dot(uint32_t sub_index) const {
+    constexpr Location dot(uint32_t sub_index) const {
         Location result(*this, this->structure, this->field, sub_index, false);
         return result;
     }
 
     // same as dot() but will mark these were part of a pNext struct
-    Location pNext(vvl::Struct s, vvl::Field sub_field = vvl::Field::Empty, uint32_t sub_index = kNoIndex) const {
+    constexpr Location pNext(vvl::Struct s, vvl::Field sub_field = vvl::Field::Empty, uint32_t sub_index = kNoIndex) const {
         Location result(*this, s, sub_field, sub_index, true);
         return result;
     }
@@ -110,18 +114,44 @@ struct LocationVuidAdapter {
     LocationVuidAdapter(const Location& loc_, const Args&... args) : loc(loc_), vuid_functor(args...) {}
 };
 
+// Location chain packed in a fixed size value that does not point to anything, for the validation that is deferred to a later
+// call (queue submit, vkCmdExecuteCommands, worker threads). Copying it is a memcpy and nothing is allocated, the strings are
+// only rendered if the decoded Location ends up in a message.
+struct EncodedLocation {
+    // Deeper chains keep the function and their kMaxDepth innermost levels
+    static constexpr uint32_t kMaxDepth = 8;
+
+    struct Level {
+        uint32_t structure : 16;
+        uint32_t field : 15;
+        uint32_t is_pnext : 1;
+        uint32_t index;
+    };
+
+    uint16_t function;
+    uint16_t depth;
+    Level levels[kMaxDepth];  // levels[0] is the outermost
+
+    explicit EncodedLocation(const Location& loc);
+};
+static_assert(std::is_trivially_copyable_v<EncodedLocation>);
+
+// Owns a copy of a Location chain, Get() stays valid for the lifetime of the capture
 struct LocationCapture {
     LocationCapture(const Location& loc);
-    LocationCapture(const LocationCapture &other);
-    LocationCapture(LocationCapture &&other);
+    LocationCapture(const EncodedLocation& encoded);
+    LocationCapture(const LocationCapture& other);
+    LocationCapture& operator=(const LocationCapture& other);
 
-    const Location& Get() const { return capture.back(); }
+    const Location& Get() const { return *std::launder(reinterpret_cast<const Location*>(chain) + encoded.depth - 1); }
+    const EncodedLocation& Encoded() const { return encoded; }
 
   protected:
-    // TODO: Optimize this for "new" minimization
-    using CaptureStore = small_vector<Location, 2>;
-    const Location* Capture(const Location& loc, CaptureStore::size_type depth);
-    CaptureStore capture;
+    void Decode();
+
+    EncodedLocation encoded;
+    // Location has const members and no default constructor, the levels are constructed in place by Decode()
+    alignas(Location) unsigned char chain[EncodedLocation::kMaxDepth * sizeof(Location)];
 };
 
 // Key for use in tables of VUIDs.
@@ -166,86 +196,39 @@ struct Entry {
     std::string v;
 };
 
-// look for a matching VUID in a vector or array-ish table
-template <typename Table>
-static const std::string& FindVUID(const Location& loc, const Table& table) {
-    // TODO - Remove having to squash KHR version here
-    Func f = loc.function;
-    if (f == Func::vkQueueSubmit2KHR) {
-        f = Func::vkQueueSubmit2;
-    } else if (f == Func::vkCmdPipelineBarrier2KHR) {
-        f = Func::vkCmdPipelineBarrier2;
-    } else if (f == Func::vkCmdResetEvent2KHR) {
-        f = Func::vkCmdResetEvent2;
-    } else if (f == Func::vkCmdSetEvent2KHR) {
-        f = Func::vkCmdSetEvent2;
-    } else if (f == Func::vkCmdWaitEvents2KHR) {
-        f = Func::vkCmdWaitEvents2;
-    } else if (f == Func::vkCmdWriteTimestamp2KHR) {
-        f = Func::vkCmdWriteTimestamp2;
-    } else if (f == Func::vkCmdBlitImage2KHR) {
-        f = Func::vkCmdBlitImage2;
-    } else if (f == Func::vkCmdCopyBufferToImage2KHR) {
-        f = Func::vkCmdCopyBufferToImage2;
-    } else if (f == Func::vkCmdCopyBuffer2KHR) {
-        f = Func::vkCmdCopyBuffer2;
-    } else if (f == Func::vkCmdCopyImage2KHR) {
-        f = Func::vkCmdCopyImage2;
-    } else if (f == Func::vkCmdCopyImageToBuffer2KHR) {
-        f = Func::vkCmdCopyImageToBuffer2;
-    } else if (f == Func::vkCmdResolveImage2KHR) {
-        f = Func::vkCmdResolveImage2;
-    }
-    const Location core_loc(f, loc.structure, loc.field, loc.index);
-
-    static const std::string empty;
-    auto predicate = [&core_loc](const Entry& entry) { return entry.k == core_loc; };
+// Table of VUIDs looked up by Location.
+//
+// The entries are indexed by (function, structure, field) when the table is created, a lookup is then one hash probe per
+// combination of Empty key members used in the table instead of matching every entry. Since the Location is looked up
+// without its prev chain, Key::recurse_field can only match loc.field and does not change the lookup.
+class VuidTable {
+  public:
+    VuidTable(std::initializer_list<Entry> entries);
+
+    // Returns nullptr if no entry matches
+    const std::string* Find(Func function, Struct structure, Field field) const;
+    size_t size() const { return entries_.size(); }
+
+  private:
+    static uint64_t IndexKey(Func function, Struct structure, Field field);
+
+    std::vector<Entry> entries_;
+    vvl::unordered_map<uint64_t, uint32_t> index_;
+    // Bit (has_function | has_structure << 1 | has_field << 2) is set for each combination used by the keys
+    uint8_t shapes_ = 0;
+};
 
-    // consistency check: there should never be more than 1 match in a table
-    assert(std::count_if(table.begin(), table.end(), predicate) <= 1);
-
-    const auto pos = std::find_if(table.begin(), table.end(), predicate);
-    return (pos != table.end()) ? pos->v : empty;
-}
+// look for a matching VUID in a table
+const std::string& FindVUID(const Location& loc, const VuidTable& table);
 
 // 2-level look up where the outer container is a map where we need to find
 // different VUIDs for different values of an enum or bitfield
 template <typename OuterKey, typename Table>
 static const std::string& FindVUID(OuterKey key, const Location& loc, const Table& table) {
-    // Currently need to squash all the KHR versions to find in the table
-    // Only need for functions because they are now generated in the chassis
-    Func f = loc.function;
-    if (f == Func::vkQueueSubmit2KHR) {
-        f = Func::vkQueueSubmit2;
-    } else if (f == Func::vkCmdPipelineBarrier2KHR) {
-        f = Func::vkCmdPipelineBarrier2;
-    } else if (f == Func::vkCmdResetEvent2KHR) {
-        f = Func::vkCmdResetEvent2;
-    } else if (f == Func::vkCmdSetEvent2KHR) {
-        f = Func::vkCmdSetEvent2;
-    } else if (f == Func::vkCmdWaitEvents2KHR) {
-        f = Func::vkCmdWaitEvents2;
-    } else if (f == Func::vkCmdWriteTimestamp2KHR) {
-        f = Func::vkCmdWriteTimestamp2;
-    } else if (f == Func::vkCmdBlitImage2KHR) {
-        f = Func::vkCmdBlitImage2;
-    } else if (f == Func::vkCmdCopyBufferToImage2KHR) {
-        f = Func::vkCmdCopyBufferToImage2;
-    } else if (f == Func::vkCmdCopyBuffer2KHR) {
-        f = Func::vkCmdCopyBuffer2;
-    } else if (f == Func::vkCmdCopyImage2KHR) {
-        f = Func::vkCmdCopyImage2;
-    } else if (f == Func::vkCmdCopyImageToBuffer2KHR) {
-        f = Func::vkCmdCopyImageToBuffer2;
-    } else if (f == Func::vkCmdResolveImage2KHR) {
-        f = Func::vkCmdResolveImage2;
-    }
-    const Location core_loc(f, loc.structure, loc.field, loc.index);
-
     static const std::string empty;
     const auto entry = table.find(key);
     if (entry != table.end()) {
-        return FindVUID(core_loc, entry->second);
+        return FindVUID(loc, entry->second);
     }
     return empty;
 }
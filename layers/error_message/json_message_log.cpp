@@ -0,0 +1,139 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "json_message_log.h"
+
+#include <cinttypes>
+
+#include <vulkan/vk_enum_string_helper.h>
+#include "error_message/error_location.h"
+
+namespace vvl {
+
+JsonMessageLog::JsonMessageLog(FILE *file, VkDebugUtilsMessageSeverityFlagsEXT severities) : file_(file), severities_(severities) {
+    buffer_.reserve(kBatchSize * 2);
+}
+
+JsonMessageLog::~JsonMessageLog() {
+    Flush();
+    fclose(file_);
+}
+
+static const char *SeverityName(VkDebugUtilsMessageSeverityFlagsEXT severity) {
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) {
+        return "error";
+    } else if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) {
+        return "warning";
+    } else if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) {
+        return "info";
+    }
+    return "verbose";
+}
+
+void JsonMessageLog::AppendString(std::string &out, std::string_view value) {
+    out += '"';
+    for (const char c : value) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    out += escaped;
+                } else {
+                    out += c;
+                }
+                break;
+        }
+    }
+    out += '"';
+}
+
+void JsonMessageLog::Write(VkDebugUtilsMessageSeverityFlagsEXT severity, const char *vuid, uint32_t message_id,
+                           const Location *loc, const std::vector<VkDebugUtilsObjectNameInfoEXT> &objects,
+                           const std::vector<std::string> &object_names, std::string_view message) {
+    // Built outside of the lock, only the copy to the batch is serialized
+    std::string record;
+    record.reserve(256 + message.size());
+    char number[32];
+
+    record += "{\"severity\":\"";
+    record += SeverityName(severity);
+    record += "\",\"vuid\":";
+    AppendString(record, vuid ? vuid : "");
+    snprintf(number, sizeof(number), ",\"id\":\"0x%08" PRIx32 "\"", message_id);
+    record += number;
+    if (loc) {
+        record += ",\"function\":";
+        AppendString(record, String(loc->function));
+        record += ",\"location\":";
+        AppendString(record, loc->Fields());
+    }
+    record += ",\"objects\":[";
+    for (size_t i = 0; i < objects.size(); ++i) {
+        if (i != 0) {
+            record += ',';
+        }
+        record += "{\"type\":\"";
+        record += string_VkObjectType(objects[i].objectType);
+        snprintf(number, sizeof(number), "\",\"handle\":\"0x%" PRIx64 "\"", objects[i].objectHandle);
+        record += number;
+        if (!object_names[i].empty()) {
+            record += ",\"name\":";
+            AppendString(record, object_names[i]);
+        }
+        record += '}';
+    }
+    record += "],\"message\":";
+    AppendString(record, message);
+    record += "}\n";
+
+    std::lock_guard<std::mutex> guard(lock_);
+    buffer_ += record;
+    if (buffer_.size() >= kBatchSize) {
+        FlushLocked();
+    }
+}
+
+void JsonMessageLog::Flush() {
+    std::lock_guard<std::mutex> guard(lock_);
+    FlushLocked();
+}
+
+void JsonMessageLog::FlushLocked() {
+    if (!buffer_.empty()) {
+        fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        fflush(file_);
+        buffer_.clear();
+    }
+}
+
+}  // namespace vvl
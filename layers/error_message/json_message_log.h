@@ -0,0 +1,70 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+struct Location;
+
+namespace vvl {
+
+// Writes the reported messages to a file as newline delimited JSON, one object per message, for tools that would otherwise
+// have to parse the text output:
+//   {"severity":"error","vuid":"VUID-...","id":"0x...","function":"vkCmdDraw","location":"pInfo->x",
+//    "objects":[{"type":"VK_OBJECT_TYPE_BUFFER","handle":"0x...","name":"..."}],"message":"..."}
+// "function" and "location" are only there for the messages logged with a Location, "name" only for named objects.
+//
+// The records are batched in memory and written once kBatchSize bytes piled up, on Flush() and on destruction.
+class JsonMessageLog {
+  public:
+    static constexpr size_t kBatchSize = 64 * 1024;
+
+    // Takes ownership of file
+    JsonMessageLog(FILE *file, VkDebugUtilsMessageSeverityFlagsEXT severities);
+    ~JsonMessageLog();
+    JsonMessageLog(const JsonMessageLog &) = delete;
+    JsonMessageLog &operator=(const JsonMessageLog &) = delete;
+
+    VkDebugUtilsMessageSeverityFlagsEXT Severities() const { return severities_; }
+
+    // object_names[i] is the name of objects[i], empty if it has none
+    void Write(VkDebugUtilsMessageSeverityFlagsEXT severity, const char *vuid, uint32_t message_id, const Location *loc,
+               const std::vector<VkDebugUtilsObjectNameInfoEXT> &objects, const std::vector<std::string> &object_names,
+               std::string_view message);
+    void Flush();
+
+    // Appends value as a JSON string (with the quotes)
+    static void AppendString(std::string &out, std::string_view value);
+
+  private:
+    void FlushLocked();
+
+    FILE *file_;
+    const VkDebugUtilsMessageSeverityFlagsEXT severities_;
+    std::mutex lock_;
+    std::string buffer_;
+};
+
+}  // namespace vvl
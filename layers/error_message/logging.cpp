@@ -18,6 +18,7 @@
 
 #include <csignal>
 #include <cstring>
+#include <iterator>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include <debugapi.h>
 #endif
@@ -64,18 +65,22 @@ static inline void DebugReportFlagsToAnnotFlags(VkDebugReportFlagsEXT dr_flags,
 
 void DebugReport::SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState> &callbacks) {
     // For all callback in list, return their complete set of severities and modes
+    VkDebugUtilsMessageSeverityFlagsEXT severities = active_msg_severities.load(std::memory_order_relaxed);
+    VkDebugUtilsMessageTypeFlagsEXT types = active_msg_types.load(std::memory_order_relaxed);
     for (const auto &item : callbacks) {
         if (item.IsUtils()) {
-            active_msg_severities |= item.debug_utils_msg_flags;
-            active_msg_types |= item.debug_utils_msg_type;
+            severities |= item.debug_utils_msg_flags;
+            types |= item.debug_utils_msg_type;
         } else {
-            VkFlags severities = 0;
-            VkFlags types = 0;
-            DebugReportFlagsToAnnotFlags(item.debug_report_msg_flags, &severities, &types);
-            active_msg_severities |= severities;
-            active_msg_types |= types;
+            VkFlags report_severities = 0;
+            VkFlags report_types = 0;
+            DebugReportFlagsToAnnotFlags(item.debug_report_msg_flags, &report_severities, &report_types);
+            severities |= report_severities;
+            types |= report_types;
         }
     }
+    active_msg_severities.store(severities, std::memory_order_relaxed);
+    active_msg_types.store(types, std::memory_order_relaxed);
 }
 
 void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
@@ -94,42 +99,27 @@ void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
     SetDebugUtilsSeverityFlags(callbacks);
 }
 
-// Returns TRUE if the number of times this message has been logged is over the set limit
-bool DebugReport::UpdateLogMsgCounts(int32_t vuid_hash) const {
-    auto vuid_count_it = duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == duplicate_message_count_map.end()) {
-        duplicate_message_count_map.emplace(vuid_hash, 1);
-        return false;
-    } else {
-        if (vuid_count_it->second >= duplicate_message_limit) {
-            return true;
-        } else {
-            vuid_count_it->second++;
-            return false;
-        }
+// Same order as LoggingLabelState::Export(), the most recent label first
+static void CopyLabels(const LoggingLabelState &label_state, std::vector<LoggingLabel> &out) {
+    out.insert(out.end(), label_state.labels.rbegin(), label_state.labels.rend());
+    if (!label_state.insert_label.Empty()) {
+        out.push_back(label_state.insert_label);
     }
 }
 
-bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *msg, const char *text_vuid) const {
-    bool bail = false;
-    std::vector<VkDebugUtilsLabelEXT> queue_labels;
-    std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
-
-    // Convert the info to the VK_EXT_debug_utils format
-    VkDebugUtilsMessageTypeFlagsEXT msg_type;
-    VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
-    DebugReportFlagsToAnnotFlags(msg_flags, &msg_severity, &msg_type);
-    if (!(active_msg_severities & msg_severity) || !(active_msg_types & msg_type)) {
-        return false;  // quick check again to make sure user wants these printed
-    }
-
-    std::vector<std::string> object_labels;
-    // Ensures that push_back will not reallocate, thereby providing pointer
-    // stability for pushed strings.
-    object_labels.reserve(objects.object_list.size());
-
-    std::vector<VkDebugUtilsObjectNameInfoEXT> object_name_infos;
-    object_name_infos.reserve(objects.object_list.size());
+DebugReport::PreparedMessage DebugReport::PrepareMessage(VkFlags msg_flags, VkDebugUtilsMessageSeverityFlagsEXT msg_severity,
+                                                         VkDebugUtilsMessageTypeFlagsEXT msg_type, const LogObjectList &objects,
+                                                         const char *msg, const char *text_vuid) const {
+    PreparedMessage message;
+    message.msg_flags = msg_flags;
+    message.msg_severity = msg_severity;
+    message.msg_type = msg_type;
+    message.has_vuid = text_vuid != nullptr;
+    if (text_vuid) {
+        message.vuid = text_vuid;
+    }
+    message.objects.reserve(objects.object_list.size());
+    message.object_names.reserve(objects.object_list.size());
     for (uint32_t i = 0; i < objects.object_list.size(); i++) {
         // If only one VkDevice was created, it is just noise to print it out in the error message.
         // Also avoid printing unknown objects, likely if new function is calling error with null LogObjectList
@@ -143,50 +133,28 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
         object_name_info.objectHandle = objects.object_list[i].handle;
         object_name_info.pObjectName = nullptr;
 
-        std::string object_label = {};
         // Look for any debug utils or marker names to use for this object
-        // NOTE: the lock (debug_output_mutex) is held by the caller (LogMsg)
-        object_label = GetUtilsObjectNameNoLock(objects.object_list[i].handle);
-        if (object_label.empty()) {
-            object_label = GetMarkerObjectNameNoLock(objects.object_list[i].handle);
-        }
-        if (!object_label.empty()) {
-            object_labels.push_back(std::move(object_label));
-            object_name_info.pObjectName = object_labels.back().c_str();
-        }
+        std::string object_label = GetObjectName(objects.object_list[i].handle);
 
         // If this is a queue, add any queue labels to the callback data.
         if (VK_OBJECT_TYPE_QUEUE == object_name_info.objectType) {
             auto label_iter = debug_utils_queue_labels.find(reinterpret_cast<VkQueue>(object_name_info.objectHandle));
             if (label_iter != debug_utils_queue_labels.end()) {
-                auto found_queue_labels = label_iter->second->Export();
-                queue_labels.insert(queue_labels.end(), found_queue_labels.begin(), found_queue_labels.end());
+                CopyLabels(*label_iter->second, message.queue_labels);
             }
             // If this is a command buffer, add any command buffer labels to the callback data.
         } else if (VK_OBJECT_TYPE_COMMAND_BUFFER == object_name_info.objectType) {
             auto label_iter = debug_utils_cmd_buffer_labels.find(reinterpret_cast<VkCommandBuffer>(object_name_info.objectHandle));
             if (label_iter != debug_utils_cmd_buffer_labels.end()) {
-                auto found_cmd_buf_labels = label_iter->second->Export();
-                cmd_buf_labels.insert(cmd_buf_labels.end(), found_cmd_buf_labels.begin(), found_cmd_buf_labels.end());
+                CopyLabels(*label_iter->second, message.cmd_buf_labels);
             }
         }
 
-        object_name_infos.push_back(object_name_info);
+        message.objects.push_back(object_name_info);
+        message.object_names.push_back(std::move(object_label));
     }
 
-    const uint32_t message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
-
-    VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
-    callback_data.flags = 0;
-    callback_data.pMessageIdName = text_vuid;
-    callback_data.messageIdNumber = vvl_bit_cast<int32_t>(message_id_number);
-    callback_data.pMessage = nullptr;
-    callback_data.queueLabelCount = static_cast<uint32_t>(queue_labels.size());
-    callback_data.pQueueLabels = queue_labels.empty() ? nullptr : queue_labels.data();
-    callback_data.cmdBufLabelCount = static_cast<uint32_t>(cmd_buf_labels.size());
-    callback_data.pCmdBufLabels = cmd_buf_labels.empty() ? nullptr : cmd_buf_labels.data();
-    callback_data.objectCount = static_cast<uint32_t>(object_name_infos.size());
-    callback_data.pObjects = object_name_infos.data();
+    message.message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
 
     std::ostringstream oss;
 
@@ -213,22 +181,56 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
     if (text_vuid != nullptr) {
         oss << "[ " << text_vuid << " ] ";
     }
-    uint32_t index = 0;
-    for (const auto &src_object : object_name_infos) {
+    for (uint32_t index = 0; index < message.objects.size(); ++index) {
+        const VkDebugUtilsObjectNameInfoEXT &src_object = message.objects[index];
         if (0 != src_object.objectHandle) {
-            oss << "Object " << index++ << ": handle = 0x" << std::hex << src_object.objectHandle;
-            if (src_object.pObjectName) {
-                oss << ", name = " << src_object.pObjectName << ", type = ";
+            oss << "Object " << index << ": handle = 0x" << std::hex << src_object.objectHandle;
+            if (!message.object_names[index].empty()) {
+                oss << ", name = " << message.object_names[index] << ", type = ";
             } else {
                 oss << ", type = ";
             }
             oss << string_VkObjectType(src_object.objectType) << "; ";
         } else {
-            oss << "Object " << index++ << ": VK_NULL_HANDLE, type = " << string_VkObjectType(src_object.objectType) << "; ";
+            oss << "Object " << index << ": VK_NULL_HANDLE, type = " << string_VkObjectType(src_object.objectType) << "; ";
         }
     }
-    oss << "| MessageID = 0x" << std::hex << message_id_number << " | " << msg;
-    std::string composite = oss.str();
+    oss << "| MessageID = 0x" << std::hex << message.message_id_number << " | " << msg;
+    message.text = oss.str();
+    return message;
+}
+
+bool DebugReport::DeliverMessage(const PreparedMessage &message) const {
+    bool bail = false;
+
+    std::vector<VkDebugUtilsObjectNameInfoEXT> object_name_infos = message.objects;
+    for (size_t i = 0; i < object_name_infos.size(); ++i) {
+        if (!message.object_names[i].empty()) {
+            object_name_infos[i].pObjectName = message.object_names[i].c_str();
+        }
+    }
+    std::vector<VkDebugUtilsLabelEXT> queue_labels;
+    queue_labels.reserve(message.queue_labels.size());
+    for (const LoggingLabel &label : message.queue_labels) {
+        queue_labels.emplace_back(label.Export());
+    }
+    std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+    cmd_buf_labels.reserve(message.cmd_buf_labels.size());
+    for (const LoggingLabel &label : message.cmd_buf_labels) {
+        cmd_buf_labels.emplace_back(label.Export());
+    }
+
+    VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
+    callback_data.flags = 0;
+    callback_data.pMessageIdName = message.has_vuid ? message.vuid.c_str() : nullptr;
+    callback_data.messageIdNumber = vvl_bit_cast<int32_t>(message.message_id_number);
+    callback_data.pMessage = nullptr;
+    callback_data.queueLabelCount = static_cast<uint32_t>(queue_labels.size());
+    callback_data.pQueueLabels = queue_labels.empty() ? nullptr : queue_labels.data();
+    callback_data.cmdBufLabelCount = static_cast<uint32_t>(cmd_buf_labels.size());
+    callback_data.pCmdBufLabels = cmd_buf_labels.empty() ? nullptr : cmd_buf_labels.data();
+    callback_data.objectCount = static_cast<uint32_t>(object_name_infos.size());
+    callback_data.pObjects = object_name_infos.data();
 
     const auto callback_list = &debug_callback_list;
     // We only output to default callbacks if there are no non-default callbacks
@@ -249,15 +251,15 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
         if (current_callback.IsDefault() && !use_default_callbacks) continue;
 
         // VK_EXT_debug_utils callback
-        if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & msg_severity) &&
-            (current_callback.debug_utils_msg_type & msg_type)) {
-            callback_data.pMessage = composite.c_str();
+        if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & message.msg_severity) &&
+            (current_callback.debug_utils_msg_type & message.msg_type)) {
+            callback_data.pMessage = message.text.c_str();
             if (current_callback.debug_utils_callback_function_ptr(
-                    static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(msg_severity), msg_type, &callback_data,
+                    static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(message.msg_severity), message.msg_type, &callback_data,
                     current_callback.pUserData)) {
                 bail = true;
             }
-        } else if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & msg_flags)) {
+        } else if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & message.msg_flags)) {
             // VK_EXT_debug_report callback (deprecated)
             if (object_name_infos.empty()) {
                 VkDebugUtilsObjectNameInfoEXT null_object_name = {VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, nullptr,
@@ -266,8 +268,8 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
                 object_name_infos.emplace_back(null_object_name);
             }
             if (current_callback.debug_report_callback_function_ptr(
-                    msg_flags, ConvertCoreObjectToDebugReportObject(object_name_infos[0].objectType),
-                    object_name_infos[0].objectHandle, message_id_number, 0, layer_prefix, composite.c_str(),
+                    message.msg_flags, ConvertCoreObjectToDebugReportObject(object_name_infos[0].objectType),
+                    object_name_infos[0].objectHandle, message.message_id_number, 0, layer_prefix, message.text.c_str(),
                     current_callback.pUserData)) {
                 bail = true;
             }
@@ -276,55 +278,160 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
     return bail;
 }
 
-void DebugReport::SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    if (pNameInfo->pObjectName) {
-        debug_utils_object_name_map[pNameInfo->objectHandle] = pNameInfo->pObjectName;
-    } else {
-        debug_utils_object_name_map.erase(pNameInfo->objectHandle);
+bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *msg, const char *text_vuid,
+                              const Location *loc) const {
+    // Convert the info to the VK_EXT_debug_utils format
+    VkDebugUtilsMessageTypeFlagsEXT msg_type;
+    VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
+    DebugReportFlagsToAnnotFlags(msg_flags, &msg_severity, &msg_type);
+    if (!(active_msg_severities.load(std::memory_order_relaxed) & msg_severity) ||
+        !(active_msg_types.load(std::memory_order_relaxed) & msg_type)) {
+        return false;  // quick check again to make sure user wants these printed
+    }
+    logged_messages.fetch_add(1, std::memory_order_relaxed);
+    if (msg_flags & kErrorBit) {
+        logged_errors.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    PreparedMessage message = PrepareMessage(msg_flags, msg_severity, msg_type, objects, msg, text_vuid);
+    if (json_log && (json_log->Severities() & msg_severity)) {
+        json_log->Write(msg_severity, text_vuid, message.message_id_number, loc, message.objects, message.object_names,
+                        message.text);
     }
+    if (!delivery_thread.joinable()) {
+        return DeliverMessage(message);
+    }
+
+    if (flush_on_error && (msg_flags & kErrorBit)) {
+        // The messages logged before this one have to come out first
+        FlushMessages();
+        std::unique_lock lock(delivery_mutex);
+        return DeliverMessage(message);
+    }
+
+    // The callbacks will run later, too late to skip the call
+    const bool was_idle = pending_messages.fetch_add(1, std::memory_order_acq_rel) == 0;
+    message_queue.Push(std::move(message));
+    if (was_idle) {
+        // Taking the lock makes sure the delivery thread is either waiting or has not checked pending_messages yet
+        std::unique_lock lock(wake_mutex);
+        wake_condition.notify_one();
+    }
+    return false;
 }
 
-void DebugReport::SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    if (pNameInfo->pObjectName) {
-        debug_object_name_map[pNameInfo->object] = pNameInfo->pObjectName;
-    } else {
-        debug_object_name_map.erase(pNameInfo->object);
+void DebugReport::StartAsyncDelivery(bool flush_errors) {
+    if (delivery_thread.joinable()) {
+        return;
+    }
+    flush_on_error = flush_errors;
+    delivery_thread = std::thread(&DebugReport::AsyncDeliveryLoop, this);
+}
+
+void DebugReport::FlushMessages() const {
+    // A callback can't wait for its own thread
+    if (delivery_thread.joinable() && std::this_thread::get_id() != delivery_thread.get_id()) {
+        std::unique_lock lock(wake_mutex);
+        flushed_condition.wait(lock, [this]() { return pending_messages.load(std::memory_order_acquire) == 0; });
     }
+    if (json_log) {
+        json_log->Flush();
+    }
+}
+
+void DebugReport::StartJsonLog(FILE *file, VkDebugUtilsMessageSeverityFlagsEXT severities) {
+    std::unique_lock lock(debug_output_mutex);
+    json_log = std::make_unique<vvl::JsonMessageLog>(file, severities);
+    // The messages have to get past the severity and type checks even if no callback wants them
+    active_msg_severities.store(active_msg_severities.load(std::memory_order_relaxed) | severities, std::memory_order_relaxed);
+    active_msg_types.store(VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
+                               VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT,
+                           std::memory_order_relaxed);
 }
 
-// NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-// and it's **mandatory responsibility** of the caller to hold this lock.
-std::string DebugReport::GetUtilsObjectNameNoLock(const uint64_t object) const {
-    std::string label = "";
-    const auto utils_name_iter = debug_utils_object_name_map.find(object);
-    if (utils_name_iter != debug_utils_object_name_map.end()) {
-        label = utils_name_iter->second;
+void DebugReport::AsyncDeliveryLoop() {
+    std::vector<PreparedMessage> batch;
+    while (true) {
+        {
+            std::unique_lock lock(wake_mutex);
+            wake_condition.wait(lock,
+                                [this]() { return stop_delivery || pending_messages.load(std::memory_order_acquire) != 0; });
+            // Everything is delivered before stopping
+            if (stop_delivery && pending_messages.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+
+        while (auto message = message_queue.TryPop()) {
+            batch.emplace_back(std::move(*message));
+        }
+        if (batch.empty()) {
+            // A producer counted its message but has not finished pushing it
+            std::this_thread::yield();
+            continue;
+        }
+
+        {
+            std::unique_lock lock(delivery_mutex);
+            for (const PreparedMessage &message : batch) {
+                DeliverMessage(message);
+            }
+        }
+        const uint64_t delivered = batch.size();
+        batch.clear();
+        if (pending_messages.fetch_sub(delivered, std::memory_order_acq_rel) == delivered) {
+            std::unique_lock lock(wake_mutex);
+            flushed_condition.notify_all();
+        }
     }
-    return label;
 }
 
-// NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-// and it's **mandatory responsibility** of the caller to hold this lock.
-std::string DebugReport::GetMarkerObjectNameNoLock(const uint64_t object) const {
-    std::string label = "";
-    const auto marker_name_iter = debug_object_name_map.find(object);
-    if (marker_name_iter != debug_object_name_map.end()) {
-        label = marker_name_iter->second;
+DebugReport::~DebugReport() {
+    if (!delivery_thread.joinable()) {
+        return;
+    }
+    {
+        std::unique_lock lock(wake_mutex);
+        stop_delivery = true;
     }
-    return label;
+    wake_condition.notify_one();
+    delivery_thread.join();
+}
+
+void DebugReport::SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
+    debug_utils_object_names.Set(pNameInfo->objectHandle, pNameInfo->pObjectName);
+}
+
+void DebugReport::SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
+    debug_object_names.Set(pNameInfo->object, pNameInfo->pObjectName);
+}
+
+std::string DebugReport::GetUtilsObjectName(const uint64_t object) const {
+    const auto name = debug_utils_object_names.Get(object);
+    return name ? *name : std::string();
+}
+
+std::string DebugReport::GetMarkerObjectName(const uint64_t object) const {
+    const auto name = debug_object_names.Get(object);
+    return name ? *name : std::string();
+}
+
+std::string DebugReport::GetObjectName(const uint64_t object) const {
+    auto name = debug_utils_object_names.Get(object);
+    if (!name) {
+        name = debug_object_names.Get(object);
+    }
+    return name ? *name : std::string();
 }
 
 std::string DebugReport::FormatHandle(const char *handle_type_name, uint64_t handle) const {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    std::string handle_name = GetUtilsObjectNameNoLock(handle);
-    if (handle_name.empty()) {
-        handle_name = GetMarkerObjectNameNoLock(handle);
+    auto handle_name = debug_utils_object_names.Get(handle);
+    if (!handle_name) {
+        handle_name = debug_object_names.Get(handle);
     }
 
     std::ostringstream str;
-    str << handle_type_name << " 0x" << std::hex << handle << "[" << handle_name.c_str() << "]";
+    str << handle_type_name << " 0x" << std::hex << handle << "[" << (handle_name ? handle_name->c_str() : "") << "]";
     return str.str();
 }
 
@@ -347,7 +454,7 @@ static LoggingLabelState *GetLoggingLabelState(Map *map, typename Map::key_type
 }
 
 void DebugReport::BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock lock(debug_output_mutex);
     if (nullptr != label_info && nullptr != label_info->pLabelName) {
         auto *label_state = GetLoggingLabelState(&debug_utils_queue_labels, queue, /* insert */ true);
         assert(label_state);
@@ -359,7 +466,7 @@ void DebugReport::BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLab
 }
 
 void DebugReport::EndQueueDebugUtilsLabel(VkQueue queue) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_queue_labels, queue, /* insert */ false);
     if (label_state) {
         // Pop the normal item
@@ -373,7 +480,7 @@ void DebugReport::EndQueueDebugUtilsLabel(VkQueue queue) {
 }
 
 void DebugReport::InsertQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_queue_labels, queue, /* insert */ true);
 
     // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
@@ -381,7 +488,7 @@ void DebugReport::InsertQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLa
 }
 
 void DebugReport::BeginCmdDebugUtilsLabel(VkCommandBuffer command_buffer, const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock lock(debug_output_mutex);
     if (nullptr != label_info && nullptr != label_info->pLabelName) {
         auto *label_state = GetLoggingLabelState(&debug_utils_cmd_buffer_labels, command_buffer, /* insert */ true);
         assert(label_state);
@@ -393,7 +500,7 @@ void DebugReport::BeginCmdDebugUtilsLabel(VkCommandBuffer command_buffer, const
 }
 
 void DebugReport::EndCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_cmd_buffer_labels, command_buffer, /* insert */ false);
     if (label_state) {
         // Pop the normal item
@@ -407,7 +514,7 @@ void DebugReport::EndCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
 }
 
 void DebugReport::InsertCmdDebugUtilsLabel(VkCommandBuffer command_buffer, const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_cmd_buffer_labels, command_buffer, /* insert */ true);
     assert(label_state);
 
@@ -417,7 +524,7 @@ void DebugReport::InsertCmdDebugUtilsLabel(VkCommandBuffer command_buffer, const
 
 // Current tracking beyond a single command buffer scope is incorrect, and even when it is we need to be able to clean up
 void DebugReport::ResetCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_cmd_buffer_labels, command_buffer, /* insert */ false);
     if (label_state) {
         label_state->labels.clear();
@@ -426,7 +533,7 @@ void DebugReport::ResetCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
 }
 
 void DebugReport::EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock lock(debug_output_mutex);
     debug_utils_cmd_buffer_labels.erase(command_buffer);
 }
 
@@ -435,7 +542,8 @@ VKAPI_ATTR void LayerDebugUtilsDestroyInstance(DebugReport *debug_report) { dele
 template <typename TCreateInfo, typename TCallback>
 static void LayerCreateCallback(DebugCallbackStatusFlags callback_status, DebugReport *debug_report, const TCreateInfo *create_info,
                                 TCallback *callback) {
-    std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
+    std::unique_lock lock(debug_report->debug_output_mutex);
+    std::unique_lock delivery_lock(debug_report->delivery_mutex);
 
     debug_report->debug_callback_list.emplace_back(VkLayerDbgFunctionState());
     auto &callback_state = debug_report->debug_callback_list.back();
@@ -535,9 +643,11 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(DebugReport *debug_report) {
 
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
+// Lock free, the filter list and limit are only set when the instance is created.
 bool DebugReport::LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT msg_severity,
                                 VkDebugUtilsMessageTypeFlagsEXT msg_type) {
-    if (!(active_msg_severities & msg_severity) || !(active_msg_types & msg_type)) {
+    if (!(active_msg_severities.load(std::memory_order_relaxed) & msg_severity) ||
+        !(active_msg_types.load(std::memory_order_relaxed) & msg_type)) {
         return false;
     }
     // If message is in filter list, bail out very early
@@ -545,27 +655,90 @@ bool DebugReport::LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageS
     if (filter_message_ids.find(message_id) != filter_message_ids.end()) {
         return false;
     }
-    if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(static_cast<int32_t>(message_id))) {
+    if ((duplicate_message_limit > 0) && !duplicate_message_counts.IncrementBelow(message_id, duplicate_message_limit)) {
         // Count for this particular message is over the limit, ignore it
         return false;
     }
     return true;
 }
 
+// Set on threads whose messages must be reported later by the thread that owns the work
+static thread_local DeferredMessages *thread_deferred_messages = nullptr;
+static thread_local uint64_t thread_message_count = 0;
+
+void DebugReport::SetThreadDeferredMessages(DeferredMessages *messages) { thread_deferred_messages = messages; }
+
+uint64_t DebugReport::ThreadMessageCount() { return thread_message_count; }
+
+bool DebugReport::IsMessageReportable(VkFlags msg_flags, std::string_view vuid_text) const {
+    VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
+    VkDebugUtilsMessageTypeFlagsEXT msg_type;
+    DebugReportFlagsToAnnotFlags(msg_flags, &msg_severity, &msg_type);
+    bool reportable = (active_msg_severities.load(std::memory_order_relaxed) & msg_severity) &&
+                      (active_msg_types.load(std::memory_order_relaxed) & msg_type);
+    if (reportable) {
+        const uint32_t message_id = hash_util::VuidHash(vuid_text);
+        reportable = filter_message_ids.find(message_id) == filter_message_ids.end() &&
+                     (duplicate_message_limit == 0 || duplicate_message_counts.Get(message_id) < duplicate_message_limit);
+    }
+    if (!reportable) {
+        // The caller found an error and drops it here instead of in LogMsg()
+        ++thread_message_count;
+    }
+    return reportable;
+}
+
+bool DebugReport::ReportDeferredMessages(DeferredMessages &messages) {
+    if (thread_deferred_messages && thread_deferred_messages != &messages) {
+        // Nested worker results (spirv-val reported from a pipeline validated on a worker) keep their place in the order
+        thread_deferred_messages->insert(thread_deferred_messages->end(), std::make_move_iterator(messages.begin()),
+                                         std::make_move_iterator(messages.end()));
+        messages.clear();
+        return false;
+    }
+    bool skip = false;
+    std::unique_lock lock(debug_output_mutex);
+    for (const DeferredMessage &message : messages) {
+        VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
+        VkDebugUtilsMessageTypeFlagsEXT msg_type;
+        DebugReportFlagsToAnnotFlags(message.msg_flags, &msg_severity, &msg_type);
+        if (LogMsgEnabled(message.vuid, msg_severity, msg_type)) {
+            skip |= DebugLogMsg(message.msg_flags, message.objects, message.text.c_str(), message.vuid.c_str());
+        }
+    }
+    messages.clear();
+    return skip;
+}
+
 bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location &loc, std::string_view vuid_text,
                          const char *format, va_list argptr) {
     assert(*(vuid_text.data() + vuid_text.size()) == '\0');
+    ++thread_message_count;
+
+    if (thread_deferred_messages) {
+        // Filtering, including the duplicate message limit, is applied once the message is reported so the result does not
+        // depend on the order worker threads ran in
+        thread_deferred_messages->emplace_back(
+            DeferredMessage{msg_flags, objects, CreateMessageText(loc, vuid_text, format, argptr), std::string(vuid_text)});
+        return false;
+    }
 
     VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
     VkDebugUtilsMessageTypeFlagsEXT msg_type;
 
     DebugReportFlagsToAnnotFlags(msg_flags, &msg_severity, &msg_type);
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    // Avoid logging cost if msg is to be ignored
+    // Avoid logging cost if msg is to be ignored, the duplicate messages are dropped without taking the lock
     if (!LogMsgEnabled(vuid_text, msg_severity, msg_type)) {
         return false;
     }
+    std::unique_lock lock(debug_output_mutex);
+
+    const std::string str_plus_spec_text = CreateMessageText(loc, vuid_text, format, argptr);
+    return DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data(), &loc);
+}
 
+std::string DebugReport::CreateMessageText(const Location &loc, std::string_view vuid_text, const char *format,
+                                           va_list argptr) const {
     // Best guess at an upper bound for message length. At least some of the extra space
     // should get used to store the VUID URL and text in the common case, without additional allocations.
     std::string str_plus_spec_text(1024, '\0');
@@ -662,7 +835,7 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
         }
     }
 
-    return DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data());
+    return str_plus_spec_text;
 }
 
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
@@ -18,16 +18,24 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstdarg>
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 #include <vulkan/utility/vk_struct_helper.hpp>
 
+#include "containers/concurrent_counter_table.h"
 #include "containers/custom_containers.h"
+#include "containers/mpsc_queue.h"
+#include "error_message/json_message_log.h"
+#include "error_message/object_name_table.h"
 #include "generated/vk_object_types.h"
+#include "utils/lock_profiling.h"
 
 #if defined __ANDROID__
 #include <android/log.h>
@@ -180,14 +188,31 @@ struct MessageFormatSettings {
     std::string application_name;
 };
 
+// A message that has been formatted but not yet reported to the debug callbacks
+struct DeferredMessage {
+    VkFlags msg_flags;
+    LogObjectList objects;
+    std::string text;
+    std::string vuid;
+};
+using DeferredMessages = std::vector<DeferredMessage>;
+
 class DebugReport {
   public:
+    DebugReport() = default;
+    DebugReport(const DebugReport &) = delete;
+    DebugReport &operator=(const DebugReport &) = delete;
+    ~DebugReport();
+
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
     // We use unordered_set to use trivial hashing for filter_message_ids as we already store hashed values
     vvl::unordered_set<uint32_t> filter_message_ids{};
     // This mutex is defined as mutable since the normal usage for a debug report object is as 'const'. The mutable keyword allows
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
-    mutable std::mutex debug_output_mutex;
+    mutable vvl::ProfiledMutex<std::mutex, vvl::ProfiledLock::DebugOutput> debug_output_mutex;
+    // The delivery thread of StartAsyncDelivery() only takes this one. It guards debug_callback_list along with
+    // debug_output_mutex: changes to the callbacks take both (in that order), anything that only reads them takes either.
+    mutable std::mutex delivery_mutex;
     uint32_t duplicate_message_limit = 0;  // zero will keep printing forever
     const void *instance_pnext_chain{};
     bool force_default_log_callback{false};
@@ -196,8 +221,11 @@ class DebugReport {
 
     void SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo);
     void SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo);
-    std::string GetUtilsObjectNameNoLock(const uint64_t object) const;
-    std::string GetMarkerObjectNameNoLock(const uint64_t object) const;
+    // The names can be read without holding debug_output_mutex
+    std::string GetUtilsObjectName(const uint64_t object) const;
+    std::string GetMarkerObjectName(const uint64_t object) const;
+    // The debug utils name, or the debug marker name if the object has none
+    std::string GetObjectName(const uint64_t object) const;
 
     void SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState> &callbacks);
     void RemoveDebugUtilsCallback(uint64_t callback);
@@ -218,8 +246,36 @@ class DebugReport {
     // Formats messages to be in the proper format, handles VUID logic, and any legacy issues
     bool LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location &loc, std::string_view vuid_text,
                 const char *format, va_list argptr);
-    // Core logging that interacts with the DebugCallbacks
-    bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *msg, const char *text_vuid) const;
+    // Core logging that interacts with the DebugCallbacks, loc is only used for the JSON log
+    bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *msg, const char *text_vuid,
+                     const Location *loc = nullptr) const;
+
+    // From now on DebugLogMsg() only formats the messages, a dedicated thread calls the callbacks in batches.
+    // With flush_errors, errors are still delivered by the thread that found them, after the queued messages.
+    void StartAsyncDelivery(bool flush_errors);
+    // Waits until every queued message was delivered and writes out the batched JSON log records
+    void FlushMessages() const;
+
+    // Also writes the messages of the given severities to file (which is now owned by the DebugReport), see JsonMessageLog
+    void StartJsonLog(FILE *file, VkDebugUtilsMessageSeverityFlagsEXT severities);
+
+    // While set, messages logged from the calling thread are appended to the given list instead of being reported.
+    // This lets validation split across worker threads report in a deterministic order with ReportDeferredMessages().
+    static void SetThreadDeferredMessages(DeferredMessages *messages);
+    // Reports (in order) and clears the deferred messages, returns true if any callback asked to skip the call.
+    // On a thread that is deferring its own messages they are moved to that list instead.
+    bool ReportDeferredMessages(DeferredMessages &messages);
+    // Number of messages logged from the calling thread so far, including the ones that ended up filtered out.
+    // Comparing it before and after a check tells whether the check found anything.
+    static uint64_t ThreadMessageCount();
+    // Messages (and errors among them) that passed the severity filter, from every thread
+    uint64_t LoggedMessageCount() const { return logged_messages.load(std::memory_order_relaxed); }
+    uint64_t LoggedErrorCount() const { return logged_errors.load(std::memory_order_relaxed); }
+
+    // Lock free version of the filtering LogMsg() does (severity, message_id_filter and duplicate_message_limit), so that a
+    // check which failed can skip building the arguments of a message that would be dropped. It does not count towards the
+    // duplicate limit, but a message that is not reportable is counted by ThreadMessageCount() as if it was logged.
+    bool IsMessageReportable(VkFlags msg_flags, std::string_view vuid_text) const;
 
     void BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
     void EndQueueDebugUtilsLabel(VkQueue queue);
@@ -232,18 +288,60 @@ class DebugReport {
     void EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
 
   private:
-    bool UpdateLogMsgCounts(int32_t vuid_hash) const;
+    // Everything the callbacks are given, owning its strings so it can be delivered after DebugLogMsg() returned
+    struct PreparedMessage {
+        VkFlags msg_flags = 0;
+        VkDebugUtilsMessageSeverityFlagsEXT msg_severity = 0;
+        VkDebugUtilsMessageTypeFlagsEXT msg_type = 0;
+        uint32_t message_id_number = 0;
+        // The callbacks get a null pMessageIdName when there is no VUID
+        bool has_vuid = false;
+        std::string vuid;
+        std::string text;
+        // pObjectName is only set when the callbacks are called, it points into object_names (empty for unnamed objects)
+        std::vector<VkDebugUtilsObjectNameInfoEXT> objects;
+        std::vector<std::string> object_names;
+        std::vector<LoggingLabel> queue_labels;
+        std::vector<LoggingLabel> cmd_buf_labels;
+    };
+
+    // The caller holds debug_output_mutex, for the labels
+    PreparedMessage PrepareMessage(VkFlags msg_flags, VkDebugUtilsMessageSeverityFlagsEXT msg_severity,
+                                   VkDebugUtilsMessageTypeFlagsEXT msg_type, const LogObjectList &objects, const char *msg,
+                                   const char *text_vuid) const;
+    // Returns true if any callback asked to skip the call. The caller holds debug_output_mutex or delivery_mutex.
+    bool DeliverMessage(const PreparedMessage &message) const;
+    void AsyncDeliveryLoop();
+
+    std::string CreateMessageText(const Location &loc, std::string_view vuid_text, const char *format, va_list argptr) const;
     bool LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT msg_severity,
                        VkDebugUtilsMessageTypeFlagsEXT msg_type);
 
-    VkDebugUtilsMessageSeverityFlagsEXT active_msg_severities{0};
-    VkDebugUtilsMessageTypeFlagsEXT active_msg_types{0};
-    mutable vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
+    // Atomic so that LogMsgEnabled() can filter the messages before taking debug_output_mutex
+    std::atomic<VkDebugUtilsMessageSeverityFlagsEXT> active_msg_severities{0};
+    std::atomic<VkDebugUtilsMessageTypeFlagsEXT> active_msg_types{0};
+    mutable std::atomic<uint64_t> logged_messages{0};
+    mutable std::atomic<uint64_t> logged_errors{0};
+    // Number of times each VUID hash was reported, for duplicate_message_limit
+    vvl::ConcurrentCounterTable<> duplicate_message_counts;
 
     vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debug_utils_queue_labels;
     vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debug_utils_cmd_buffer_labels;
-    vvl::unordered_map<uint64_t, std::string> debug_object_name_map;
-    vvl::unordered_map<uint64_t, std::string> debug_utils_object_name_map;
+    vvl::ObjectNameTable debug_object_names;
+    vvl::ObjectNameTable debug_utils_object_names;
+
+    // Asynchronous delivery, only used once StartAsyncDelivery() was called
+    std::thread delivery_thread;
+    bool flush_on_error = false;
+    mutable vvl::MpscQueue<PreparedMessage> message_queue;
+    // Messages pushed but not delivered yet, the producers only wake the thread when this goes up from zero
+    mutable std::atomic<uint64_t> pending_messages{0};
+    mutable std::mutex wake_mutex;
+    mutable std::condition_variable wake_condition;
+    mutable std::condition_variable flushed_condition;
+    bool stop_delivery = false;
+
+    std::unique_ptr<vvl::JsonMessageLog> json_log;
 };
 
 template DebugReport *GetLayerDataPtr<DebugReport>(void *data_key, std::unordered_map<void *, DebugReport *> &data_map);
@@ -258,7 +356,10 @@ VKAPI_ATTR VkResult LayerCreateReportCallback(DebugReport *debug_report, bool de
 
 template <typename T>
 static inline void LayerDestroyCallback(DebugReport *debug_report, T callback) {
-    std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
+    // The queued messages were meant for this callback too
+    debug_report->FlushMessages();
+    std::unique_lock lock(debug_report->debug_output_mutex);
+    std::unique_lock delivery_lock(debug_report->delivery_mutex);
     debug_report->RemoveDebugUtilsCallback(CastToUint64(callback));
 }
 
@@ -0,0 +1,66 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "object_name_table.h"
+
+#include <algorithm>
+
+namespace vvl {
+
+void ObjectNameTable::Set(uint64_t object, const char *name) {
+    if (name && name[0] != '\0') {
+        names_.insert_or_assign(object, Intern(name));
+    } else {
+        names_.erase(object);
+    }
+}
+
+ObjectNameTable::Name ObjectNameTable::Get(uint64_t object) const {
+    auto it = names_.find(object);
+    return it != names_.end() ? it->second : nullptr;
+}
+
+ObjectNameTable::Name ObjectNameTable::Intern(std::string_view name) {
+    std::lock_guard<std::mutex> guard(intern_lock_);
+    auto it = interned_.find(name);
+    if (it != interned_.end()) {
+        return it->second;
+    }
+
+    if (interned_.size() >= prune_size_) {
+        // A name only referenced by interned_ can't be handed out anymore (names_ holds a reference to every name it returns)
+        for (auto prune_it = interned_.begin(); prune_it != interned_.end();) {
+            if (prune_it->second.use_count() == 1) {
+                prune_it = interned_.erase(prune_it);
+            } else {
+                ++prune_it;
+            }
+        }
+        prune_size_ = std::max<size_t>(64, interned_.size() * 2);
+    }
+
+    Name interned_name = std::make_shared<const std::string>(name);
+    interned_.emplace(std::string_view(*interned_name), interned_name);
+    return interned_name;
+}
+
+size_t ObjectNameTable::InternedCount() {
+    std::lock_guard<std::mutex> guard(intern_lock_);
+    return interned_.size();
+}
+
+}  // namespace vvl
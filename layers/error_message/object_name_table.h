@@ -0,0 +1,59 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+// Debug names of the objects (set with vkSetDebugUtilsObjectNameEXT or vkDebugMarkerSetObjectNameEXT).
+//
+// The names are read every time a handle is formatted, possibly by many threads at once, and rarely set. Reads only take the
+// shared lock of one bucket and copy a pointer: the names are interned immutable strings, which the objects with the same name
+// (applications often give the same name to many objects) also share.
+class ObjectNameTable {
+  public:
+    using Name = std::shared_ptr<const std::string>;
+
+    // A null or empty name removes the name of the object
+    void Set(uint64_t object, const char *name);
+    // nullptr if the object has no name
+    Name Get(uint64_t object) const;
+
+    // Number of distinct names kept alive by the table, for testing
+    size_t InternedCount();
+
+  private:
+    Name Intern(std::string_view name);
+
+    vvl::concurrent_unordered_map<uint64_t, Name, 4> names_;
+
+    std::mutex intern_lock_;
+    // The keys point into the value strings, which the map keeps alive
+    vvl::unordered_map<std::string_view, Name> interned_;
+    // Size at which the names nothing else references anymore are dropped
+    size_t prune_size_ = 64;
+};
+
+}  // namespace vvl
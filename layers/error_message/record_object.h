@@ -28,11 +28,11 @@ struct RecordObject {
 
     const chassis::HandleData* handle_data;
 
-    RecordObject(vvl::Func command_, const chassis::HandleData* handle_data_ = nullptr)
+    constexpr RecordObject(vvl::Func command_, const chassis::HandleData* handle_data_ = nullptr)
         : location(Location(command_)), handle_data(handle_data_) {}
-    RecordObject(vvl::Func command_, VkResult result_, const chassis::HandleData* handle_data_ = nullptr)
+    constexpr RecordObject(vvl::Func command_, VkResult result_, const chassis::HandleData* handle_data_ = nullptr)
         : location(Location(command_)), result(result_), handle_data(handle_data_) {}
-    RecordObject(vvl::Func command_, VkDeviceAddress device_address_, const chassis::HandleData* handle_data_ = nullptr)
+    constexpr RecordObject(vvl::Func command_, VkDeviceAddress device_address_, const chassis::HandleData* handle_data_ = nullptr)
         : location(Location(command_)), device_address(device_address_), handle_data(handle_data_) {}
 
     bool HasResult() { return result != VK_RESULT_MAX_ENUM; }
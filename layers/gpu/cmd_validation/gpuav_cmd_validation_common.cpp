@@ -46,6 +46,11 @@ void RestorablePipelineState::Create(vvl::CommandBuffer &cb_state, VkPipelineBin
     LastBound &last_bound = cb_state.lastBound[lv_bind_point];
     if (last_bound.pipeline_state) {
         pipeline_ = last_bound.pipeline_state->VkHandle();
+        const VkPipeline lazy_instrumented_pipeline = last_bound.pipeline_state->instrumentation_data.lazy_instrumented_pipeline;
+        if (lazy_instrumented_pipeline != VK_NULL_HANDLE) {
+            // What the app bound was replaced by the pipeline created on first bind
+            pipeline_ = lazy_instrumented_pipeline;
+        }
 
     } else {
         assert(shader_objects_.empty());
@@ -62,6 +67,9 @@ void RestorablePipelineState::Create(vvl::CommandBuffer &cb_state, VkPipelineBin
     desc_set_pipeline_layout_ = last_bound.desc_set_pipeline_layout;
 
     push_constants_data_ = cb_state.push_constant_data_chunks;
+    if (!push_constants_data_.empty()) {
+        push_constants_values_ = cb_state.push_constant_values;
+    }
 
     descriptor_sets_.reserve(last_bound.per_set.size());
     for (std::size_t set_i = 0; set_i < last_bound.per_set.size(); set_i++) {
@@ -71,7 +79,8 @@ void RestorablePipelineState::Create(vvl::CommandBuffer &cb_state, VkPipelineBin
             if (bound_descriptor_set->IsPushDescriptor()) {
                 push_descriptor_set_index_ = static_cast<uint32_t>(set_i);
             }
-            dynamic_offsets_.push_back(last_bound.per_set[set_i].dynamicOffsets);
+            const auto &dynamic_offsets = last_bound.per_set[set_i].dynamicOffsets;
+            dynamic_offsets_.emplace_back(dynamic_offsets.begin(), dynamic_offsets.end());
         }
     }
 
@@ -111,8 +120,8 @@ void RestorablePipelineState::Restore() const {
 
     for (const auto &push_constant_range : push_constants_data_) {
         DispatchCmdPushConstants(cmd_buffer_, push_constant_range.layout, push_constant_range.stage_flags,
-                                 push_constant_range.offset, static_cast<uint32_t>(push_constant_range.values.size()),
-                                 push_constant_range.values.data());
+                                 push_constant_range.offset, push_constant_range.size,
+                                 push_constants_values_.data() + push_constant_range.offset);
     }
 }
 
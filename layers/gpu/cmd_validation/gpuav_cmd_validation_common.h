@@ -43,6 +43,7 @@ class RestorablePipelineState {
     uint32_t push_descriptor_set_index_ = 0;
     std::vector<vku::safe_VkWriteDescriptorSet> push_descriptor_set_writes_;
     std::vector<vvl::CommandBuffer::PushConstantData> push_constants_data_;
+    std::vector<std::byte> push_constants_values_;
     std::vector<vvl::ShaderObject*> shader_objects_;
 };
 
@@ -52,7 +52,7 @@ struct SharedCopyBufferToImageValidationResources final {
         // Allocate buffer memory pool that will be used to create the buffers holding copy regions
         VkBufferCreateInfo buffer_info = vku::InitStructHelper();
         buffer_info.size = 4096;  // Dummy value
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
         VmaAllocationCreateInfo alloc_info = {};
         alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
 
@@ -165,34 +165,114 @@ void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, Co
         return;
     }
 
+    // Needs to be kept in sync with copy_buffer_to_image.comp
+    struct BufferImageCopy {
+        uint32_t src_buffer_byte_offset;
+        uint32_t start_layer;
+        uint32_t layer_count;
+        uint32_t row_extent;
+        uint32_t slice_extent;
+        uint32_t layer_extent;
+        uint32_t pad_[2];
+        int32_t image_offset[4];
+        uint32_t image_extent[4];
+    };
+    // The shader does not read the image extent, its first 3 words are the VkDispatchIndirectCommand of the dispatch
+    constexpr uint32_t uniform_block_constants_dwords_count = 4 +  // image extent
+                                                              1 +  // block size
+                                                              1 +  // gpu copy regions count
+                                                              2;   // pad
+    constexpr VkDeviceSize uniform_block_constants_byte_size = uniform_block_constants_dwords_count * sizeof(uint32_t);
+    // Enough for a frame worth of texture streaming copies in one dispatch
+    constexpr uint32_t min_batch_regions_capacity = 256;
+
+    const uint32_t block_size = image_state->create_info.format == VK_FORMAT_D32_SFLOAT ? 4 : 5;
+    small_vector<BufferImageCopy, 4> gpu_regions;
+    uint32_t max_texels_count_in_regions = 0;
+    for (const auto &cpu_region : vvl::make_span(copy_buffer_to_img_info->pRegions, copy_buffer_to_img_info->regionCount)) {
+        if (cpu_region.imageSubresource.aspectMask != VK_IMAGE_ASPECT_DEPTH_BIT) {
+            continue;
+        }
+
+        // Read offset above kU32Max cannot be indexed in the validation shader
+        if (const VkDeviceSize max_buffer_read_offset =
+                cpu_region.bufferOffset + static_cast<VkDeviceSize>(block_size) * cpu_region.imageExtent.width *
+                                              cpu_region.imageExtent.height * cpu_region.imageExtent.depth;
+            max_buffer_read_offset > static_cast<VkDeviceSize>(vvl::kU32Max)) {
+            continue;
+        }
+
+        BufferImageCopy &gpu_region = gpu_regions.emplace_back();
+        gpu_region.src_buffer_byte_offset = static_cast<uint32_t>(cpu_region.bufferOffset);
+        gpu_region.start_layer = cpu_region.imageSubresource.baseArrayLayer;
+        gpu_region.layer_count = cpu_region.imageSubresource.layerCount;
+        gpu_region.row_extent = std::max(cpu_region.bufferRowLength, image_state->create_info.extent.width * block_size);
+        gpu_region.slice_extent =
+            std::max(cpu_region.bufferImageHeight, image_state->create_info.extent.height * gpu_region.row_extent);
+        gpu_region.layer_extent = image_state->create_info.extent.depth * gpu_region.slice_extent;
+        gpu_region.pad_[0] = 0;
+        gpu_region.pad_[1] = 0;
+        gpu_region.image_offset[0] = cpu_region.imageOffset.x;
+        gpu_region.image_offset[1] = cpu_region.imageOffset.y;
+        gpu_region.image_offset[2] = cpu_region.imageOffset.z;
+        gpu_region.image_offset[3] = 0;
+        gpu_region.image_extent[0] = cpu_region.imageExtent.width;
+        gpu_region.image_extent[1] = cpu_region.imageExtent.height;
+        gpu_region.image_extent[2] = cpu_region.imageExtent.depth;
+        gpu_region.image_extent[3] = 0;
+
+        max_texels_count_in_regions =
+            std::max(max_texels_count_in_regions,
+                     cpu_region.imageExtent.width * cpu_region.imageExtent.height * cpu_region.imageExtent.depth);
+    }
+
+    if (gpu_regions.empty()) {
+        // Nothing to validate
+        return;
+    }
+    const uint32_t gpu_regions_count = static_cast<uint32_t>(gpu_regions.size());
+
+    const auto write_regions = [&](const CopyBufferToImageValidationBatch &batch, uint32_t first_region) {
+        auto gpu_regions_u32_ptr = (uint32_t *)batch.regions_block.MapMemory(loc);
+        auto gpu_regions_ptr = reinterpret_cast<BufferImageCopy *>(&gpu_regions_u32_ptr[uniform_block_constants_dwords_count]);
+        std::copy(gpu_regions.begin(), gpu_regions.end(), gpu_regions_ptr + first_region);
+
+        const uint32_t group_count_x = batch.max_texels_count / 64 + uint32_t(batch.max_texels_count % 64 > 0);
+        gpu_regions_u32_ptr[0] = group_count_x;
+        gpu_regions_u32_ptr[1] = 1;
+        gpu_regions_u32_ptr[2] = 1;
+        gpu_regions_u32_ptr[3] = 0;
+        gpu_regions_u32_ptr[4] = batch.block_size;
+        gpu_regions_u32_ptr[5] = batch.regions_count;
+        gpu_regions_u32_ptr[6] = 0;
+        gpu_regions_u32_ptr[7] = 0;
+
+        batch.regions_block.UnmapMemory();
+    };
+
+    // Copies recorded back to back read the source buffer in the same state, so the dispatch recorded before the first one
+    // can check them all. The regions are only read when the command buffer executes, after recording ended.
+    if (auto &batch = cb_state.copy_buffer_to_image_batch;
+        batch && batch->command_count + 1 == cb_state.command_count && batch->src_buffer == copy_buffer_to_img_info->srcBuffer &&
+        batch->function == loc.function && batch->block_size == block_size &&
+        batch->regions_count + gpu_regions_count <= batch->regions_capacity) {
+        const uint32_t first_region = batch->regions_count;
+        batch->regions_count += gpu_regions_count;
+        batch->max_texels_count = std::max(batch->max_texels_count, max_texels_count_in_regions);
+        batch->command_count = cb_state.command_count;
+        write_regions(*batch, first_region);
+        return;
+    }
+    cb_state.copy_buffer_to_image_batch.reset();
+
     // Allocate buffer that will be used to store pRegions
-    uint32_t max_texels_count_in_regions = copy_buffer_to_img_info->pRegions[0].imageExtent.width *
-                                           copy_buffer_to_img_info->pRegions[0].imageExtent.height *
-                                           copy_buffer_to_img_info->pRegions[0].imageExtent.depth;
     DeviceMemoryBlock copy_src_regions_mem_block(gpuav);
     {
-        // Needs to be kept in sync with copy_buffer_to_image.comp
-        struct BufferImageCopy {
-            uint32_t src_buffer_byte_offset;
-            uint32_t start_layer;
-            uint32_t layer_count;
-            uint32_t row_extent;
-            uint32_t slice_extent;
-            uint32_t layer_extent;
-            uint32_t pad_[2];
-            int32_t image_offset[4];
-            uint32_t image_extent[4];
-        };
-
         VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-        const VkDeviceSize uniform_block_constants_byte_size = (4 +  // image extent
-                                                                1 +  // block size
-                                                                1 +  // gpu copy regions count
-                                                                2    // pad
-                                                                ) *
-                                                               sizeof(uint32_t);
-        buffer_info.size = uniform_block_constants_byte_size + sizeof(BufferImageCopy) * copy_buffer_to_img_info->regionCount;
-        buffer_info.usage = VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        buffer_info.size = uniform_block_constants_byte_size +
+                           sizeof(BufferImageCopy) * std::max(gpu_regions_count, min_batch_regions_capacity);
+        buffer_info.usage = VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                            VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
         VmaAllocationCreateInfo alloc_info = {};
         alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
 
@@ -203,67 +283,16 @@ void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, Co
         copy_src_regions_mem_block.CreateBuffer(loc, &buffer_info, &alloc_info);
 
         cb_state.gpu_resources_manager.ManageDeviceMemoryBlock(copy_src_regions_mem_block);
-
-        auto gpu_regions_u32_ptr = (uint32_t *)copy_src_regions_mem_block.MapMemory(loc);
-
-        const uint32_t block_size = image_state->create_info.format == VK_FORMAT_D32_SFLOAT ? 4 : 5;
-        uint32_t gpu_regions_count = 0;
-        BufferImageCopy *gpu_regions_ptr =
-            reinterpret_cast<BufferImageCopy *>(&gpu_regions_u32_ptr[uniform_block_constants_byte_size / sizeof(uint32_t)]);
-        for (const auto &cpu_region : vvl::make_span(copy_buffer_to_img_info->pRegions, copy_buffer_to_img_info->regionCount)) {
-            if (cpu_region.imageSubresource.aspectMask != VK_IMAGE_ASPECT_DEPTH_BIT) {
-                continue;
-            }
-
-            // Read offset above kU32Max cannot be indexed in the validation shader
-            if (const VkDeviceSize max_buffer_read_offset =
-                    cpu_region.bufferOffset + static_cast<VkDeviceSize>(block_size) * cpu_region.imageExtent.width *
-                                                  cpu_region.imageExtent.height * cpu_region.imageExtent.depth;
-                max_buffer_read_offset > static_cast<VkDeviceSize>(vvl::kU32Max)) {
-                continue;
-            }
-
-            BufferImageCopy &gpu_region = gpu_regions_ptr[gpu_regions_count];
-            gpu_region.src_buffer_byte_offset = static_cast<uint32_t>(cpu_region.bufferOffset);
-            gpu_region.start_layer = cpu_region.imageSubresource.baseArrayLayer;
-            gpu_region.layer_count = cpu_region.imageSubresource.layerCount;
-            gpu_region.row_extent = std::max(cpu_region.bufferRowLength, image_state->create_info.extent.width * block_size);
-            gpu_region.slice_extent =
-                std::max(cpu_region.bufferImageHeight, image_state->create_info.extent.height * gpu_region.row_extent);
-            gpu_region.layer_extent = image_state->create_info.extent.depth * gpu_region.slice_extent;
-            gpu_region.image_offset[0] = cpu_region.imageOffset.x;
-            gpu_region.image_offset[1] = cpu_region.imageOffset.y;
-            gpu_region.image_offset[2] = cpu_region.imageOffset.z;
-            gpu_region.image_offset[3] = 0;
-            gpu_region.image_extent[0] = cpu_region.imageExtent.width;
-            gpu_region.image_extent[1] = cpu_region.imageExtent.height;
-            gpu_region.image_extent[2] = cpu_region.imageExtent.depth;
-            gpu_region.image_extent[3] = 0;
-
-            max_texels_count_in_regions =
-                std::max(max_texels_count_in_regions,
-                         cpu_region.imageExtent.width * cpu_region.imageExtent.height * cpu_region.imageExtent.depth);
-
-            ++gpu_regions_count;
-        }
-
-        if (gpu_regions_count == 0) {
-            // Nothing to validate
-            copy_src_regions_mem_block.UnmapMemory();
-            return;
-        }
-
-        gpu_regions_u32_ptr[0] = image_state->create_info.extent.width;
-        gpu_regions_u32_ptr[1] = image_state->create_info.extent.height;
-        gpu_regions_u32_ptr[2] = image_state->create_info.extent.depth;
-        gpu_regions_u32_ptr[3] = 0;
-        gpu_regions_u32_ptr[4] = block_size;
-        gpu_regions_u32_ptr[5] = gpu_regions_count;
-        gpu_regions_u32_ptr[6] = 0;
-        gpu_regions_u32_ptr[7] = 0;
-
-        copy_src_regions_mem_block.UnmapMemory();
     }
+    CopyBufferToImageValidationBatch batch(copy_src_regions_mem_block);
+    batch.src_buffer = copy_buffer_to_img_info->srcBuffer;
+    batch.function = loc.function;
+    batch.block_size = block_size;
+    batch.regions_count = gpu_regions_count;
+    batch.regions_capacity = std::max(gpu_regions_count, min_batch_regions_capacity);
+    batch.max_texels_count = max_texels_count_in_regions;
+    batch.command_count = cb_state.command_count;
+    write_regions(batch, 0);
 
     // Update descriptor set
     VkDescriptorSet validation_desc_set = VK_NULL_HANDLE;
@@ -307,9 +336,8 @@ void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, Co
     DispatchCmdBindDescriptorSets(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_COMPUTE,
                                   shared_copy_validation_resources.pipeline_layout, glsl::kDiagPerCmdDescriptorSet, 1,
                                   &validation_desc_set, 0, nullptr);
-    // correct_count == max texelsCount?
-    const uint32_t group_count_x = max_texels_count_in_regions / 64 + uint32_t(max_texels_count_in_regions % 64 > 0);
-    DispatchCmdDispatch(cb_state.VkHandle(), group_count_x, 1, 1);
+    // The group count grows with the copies added to the batch
+    DispatchCmdDispatchIndirect(cb_state.VkHandle(), copy_src_regions_mem_block.Buffer(), 0);
 
     CommandBuffer::ErrorLoggerFunc error_logger = [loc, src_buffer = copy_buffer_to_img_info->srcBuffer](
                                                       Validator &gpuav, const uint32_t *error_record,
@@ -344,6 +372,7 @@ void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, Co
     };
 
     cb_state.per_command_error_loggers.emplace_back(std::move(error_logger));
+    cb_state.copy_buffer_to_image_batch.emplace(batch);
 }
 
 }  // namespace gpuav
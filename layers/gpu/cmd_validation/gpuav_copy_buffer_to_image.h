@@ -19,12 +19,32 @@
 
 #include <vulkan/vulkan.h>
 
+#include "generated/error_location_helper.h"
+#include "gpu/resources/gpuav_resources.h"
+
 struct Location;
 
 namespace gpuav {
 class CommandBuffer;
 class Validator;
 
+// Validation dispatch of the last validated copy of a command buffer. Copies recorded right after it, with nothing in between,
+// append their regions to its buffer instead of recording a dispatch of their own: the group count and the regions count
+// are read from that buffer when the dispatch executes.
+struct CopyBufferToImageValidationBatch {
+    DeviceMemoryBlock regions_block;
+    VkBuffer src_buffer = VK_NULL_HANDLE;
+    vvl::Func function = vvl::Func::Empty;
+    uint32_t block_size = 0;
+    uint32_t regions_count = 0;
+    uint32_t regions_capacity = 0;
+    uint32_t max_texels_count = 0;
+    // vvl::CommandBuffer::command_count of the last copy of the batch
+    uint64_t command_count = 0;
+
+    explicit CopyBufferToImageValidationBatch(DeviceMemoryBlock regions_block) : regions_block(regions_block) {}
+};
+
 void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, CommandBuffer &cb_state,
                                        const VkCopyBufferToImageInfo2 *copy_buffer_to_img_info);
 
@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "gpu/core/gpuav.h"
 #include "gpu/cmd_validation/gpuav_cmd_validation_common.h"
 #include "gpu/error_message/gpuav_vuids.h"
@@ -25,9 +27,6 @@
 
 #include "state_tracker/render_pass_state.h"
 
-// See gpu/shaders/cmd_validation/draw.vert
-constexpr uint32_t kPushConstantDWords = 11u;
-
 namespace gpuav {
 
 struct SharedDrawValidationResources final {
@@ -36,6 +35,10 @@ struct SharedDrawValidationResources final {
     VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
     VkShaderEXT shader_object = VK_NULL_HANDLE;
     vvl::concurrent_unordered_map<VkRenderPass, VkPipeline> renderpass_to_pipeline;
+    // With gpuav_batch_indirect_draws_validation, the batched validation draws are recorded in this render pass without
+    // attachments, with a pipeline even if the application uses shader objects
+    VkRenderPass batch_render_pass = VK_NULL_HANDLE;
+    VkFramebuffer batch_framebuffer = VK_NULL_HANDLE;
     VkDevice device = VK_NULL_HANDLE;
 
     SharedDrawValidationResources(Validator &gpuav, VkDescriptorSetLayout error_output_desc_set_layout, bool use_shader_objects,
@@ -60,7 +63,7 @@ struct SharedDrawValidationResources final {
         VkPushConstantRange push_constant_range = {};
         push_constant_range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
         push_constant_range.offset = 0;
-        push_constant_range.size = kPushConstantDWords * sizeof(uint32_t);
+        push_constant_range.size = kDrawValidationPushConstantDWords * sizeof(uint32_t);
 
         std::array<VkDescriptorSetLayout, 2> set_layouts = {{error_output_desc_set_layout, ds_layout}};
         VkPipelineLayoutCreateInfo pipeline_layout_ci = vku::InitStructHelper();
@@ -90,7 +93,8 @@ struct SharedDrawValidationResources final {
                 gpuav.InternalError(device, loc, "Unable to create shader object.");
                 return;
             }
-        } else {
+        }
+        if (!use_shader_objects || gpuav.gpuav_settings.batch_indirect_draws_validation) {
             VkShaderModuleCreateInfo shader_module_ci = vku::InitStructHelper();
             shader_module_ci.codeSize = cmd_validation_draw_vert_size * sizeof(uint32_t);
             shader_module_ci.pCode = cmd_validation_draw_vert;
@@ -100,6 +104,30 @@ struct SharedDrawValidationResources final {
                 return;
             }
         }
+
+        if (gpuav.gpuav_settings.batch_indirect_draws_validation) {
+            VkSubpassDescription subpass = {};
+            subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+            VkRenderPassCreateInfo render_pass_ci = vku::InitStructHelper();
+            render_pass_ci.subpassCount = 1;
+            render_pass_ci.pSubpasses = &subpass;
+            result = DispatchCreateRenderPass(device, &render_pass_ci, nullptr, &batch_render_pass);
+            if (result != VK_SUCCESS) {
+                gpuav.InternalError(device, loc, "Unable to create render pass for batched indirect draws validation.");
+                return;
+            }
+
+            VkFramebufferCreateInfo framebuffer_ci = vku::InitStructHelper();
+            framebuffer_ci.renderPass = batch_render_pass;
+            framebuffer_ci.width = 1;
+            framebuffer_ci.height = 1;
+            framebuffer_ci.layers = 1;
+            result = DispatchCreateFramebuffer(device, &framebuffer_ci, nullptr, &batch_framebuffer);
+            if (result != VK_SUCCESS) {
+                gpuav.InternalError(device, loc, "Unable to create framebuffer for batched indirect draws validation.");
+                return;
+            }
+        }
     }
 
     ~SharedDrawValidationResources() {
@@ -124,6 +152,14 @@ struct SharedDrawValidationResources final {
             DispatchDestroyShaderEXT(device, shader_object, nullptr);
             shader_object = VK_NULL_HANDLE;
         }
+        if (batch_framebuffer != VK_NULL_HANDLE) {
+            DispatchDestroyFramebuffer(device, batch_framebuffer, nullptr);
+            batch_framebuffer = VK_NULL_HANDLE;
+        }
+        if (batch_render_pass != VK_NULL_HANDLE) {
+            DispatchDestroyRenderPass(device, batch_render_pass, nullptr);
+            batch_render_pass = VK_NULL_HANDLE;
+        }
     }
 
     bool IsValid() const { return shader_module != VK_NULL_HANDLE || shader_object != VK_NULL_HANDLE; }
@@ -210,8 +246,13 @@ void InsertIndirectDrawValidation(Validator &gpuav, const Location &loc, Command
         return;
     }
 
+    // Draws recorded after indirect buffer writes of this command buffer were made visible have to be validated right before
+    // them, the batched validation executes before all the commands of the command buffer
+    const bool batched = gpuav.gpuav_settings.batch_indirect_draws_validation && cb_state.IsPrimary() &&
+                         !cb_state.indirect_buffers_written;
+
     VkPipeline validation_pipeline = VK_NULL_HANDLE;
-    if (!use_shader_objects) {
+    if (!use_shader_objects && !batched) {
         validation_pipeline =
             GetDrawValidationPipeline(gpuav, shared_draw_resources, cb_state.activeRenderPass.get()->VkHandle(), loc);
         if (validation_pipeline == VK_NULL_HANDLE) {
@@ -250,9 +291,7 @@ void InsertIndirectDrawValidation(Validator &gpuav, const Location &loc, Command
     // NOTE that this validation does not attempt to abort invalid api calls as most other validation does. A crash
     // or DEVICE_LOST resulting from the invalid call will prevent preceeding validation errors from being reported.
 
-    // Save current graphics pipeline state
     const vvl::Func command = loc.function;
-    RestorablePipelineState restorable_state(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS);
     using vvl::Func;
     const bool is_mesh_call =
         (command == Func::vkCmdDrawMeshTasksIndirectCountEXT || command == Func::vkCmdDrawMeshTasksIndirectCountNV ||
@@ -263,7 +302,7 @@ void InsertIndirectDrawValidation(Validator &gpuav, const Location &loc, Command
          command == Func::vkCmdDrawIndexedIndirectCount || command == Func::vkCmdDrawIndexedIndirectCountKHR ||
          command == Func::vkCmdDrawMeshTasksIndirectCountEXT || command == Func::vkCmdDrawMeshTasksIndirectCountNV);
 
-    uint32_t push_constants[kPushConstantDWords] = {};
+    uint32_t push_constants[kDrawValidationPushConstantDWords] = {};
     VkDeviceSize indirect_buffer_size = 0;
     if (is_count_call) {
         // Validate count buffer
@@ -315,7 +354,7 @@ void InsertIndirectDrawValidation(Validator &gpuav, const Location &loc, Command
     }
 
     bool emit_task_error = false;
-    if (is_mesh_call && gpuav.phys_dev_props.limits.maxPushConstantsSize >= kPushConstantDWords * sizeof(uint32_t)) {
+    if (is_mesh_call && gpuav.phys_dev_props.limits.maxPushConstantsSize >= kDrawValidationPushConstantDWords * sizeof(uint32_t)) {
         if (!is_count_call) {
             // Select was set in count check for count call
             push_constants[0] = glsl::kPreDrawSelectMeshNoCount;
@@ -338,30 +377,41 @@ void InsertIndirectDrawValidation(Validator &gpuav, const Location &loc, Command
         }
     }
 
-    // Insert diagnostic draw
-    if (use_shader_objects) {
-        std::array<VkShaderStageFlagBits, 5> stages{{VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT,
-                                                     VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, VK_SHADER_STAGE_GEOMETRY_BIT,
-                                                     VK_SHADER_STAGE_FRAGMENT_BIT}};
-        std::array<VkShaderEXT, 5> shaders{{
-            shared_draw_resources.shader_object,
-            VK_NULL_HANDLE,
-            VK_NULL_HANDLE,
-            VK_NULL_HANDLE,
-            VK_NULL_HANDLE,
-        }};
-        DispatchCmdBindShadersEXT(cb_state.VkHandle(), static_cast<uint32_t>(stages.size()), stages.data(), shaders.data());
+    if (batched) {
+        BatchedIndirectDrawValidation &batched_validation = cb_state.batched_indirect_draw_validations.emplace_back();
+        batched_validation.desc_set = draw_validation_desc_set;
+        std::copy(std::begin(push_constants), std::end(push_constants), std::begin(batched_validation.push_constants));
+        batched_validation.draw_index = cb_state.draw_index;
+        batched_validation.error_logger_index = static_cast<uint32_t>(cb_state.per_command_error_loggers.size());
     } else {
-        DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, validation_pipeline);
+        // Save current graphics pipeline state
+        RestorablePipelineState restorable_state(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS);
+
+        // Insert diagnostic draw
+        if (use_shader_objects) {
+            std::array<VkShaderStageFlagBits, 5> stages{{VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT,
+                                                         VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, VK_SHADER_STAGE_GEOMETRY_BIT,
+                                                         VK_SHADER_STAGE_FRAGMENT_BIT}};
+            std::array<VkShaderEXT, 5> shaders{{
+                shared_draw_resources.shader_object,
+                VK_NULL_HANDLE,
+                VK_NULL_HANDLE,
+                VK_NULL_HANDLE,
+                VK_NULL_HANDLE,
+            }};
+            DispatchCmdBindShadersEXT(cb_state.VkHandle(), static_cast<uint32_t>(stages.size()), stages.data(), shaders.data());
+        } else {
+            DispatchCmdBindPipeline(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, validation_pipeline);
+        }
+        static_assert(sizeof(push_constants) <= 128, "push_constants buffer size >128, need to consider maxPushConstantsSize.");
+        DispatchCmdPushConstants(cb_state.VkHandle(), shared_draw_resources.pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                                 static_cast<uint32_t>(sizeof(push_constants)), push_constants);
+        BindValidationCmdsCommonDescSet(gpuav, cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, shared_draw_resources.pipeline_layout,
+                                        cb_state.draw_index, static_cast<uint32_t>(cb_state.per_command_error_loggers.size()));
+        DispatchCmdBindDescriptorSets(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, shared_draw_resources.pipeline_layout,
+                                      glsl::kDiagPerCmdDescriptorSet, 1, &draw_validation_desc_set, 0, nullptr);
+        DispatchCmdDraw(cb_state.VkHandle(), 3, 1, 0, 0);  // TODO: this 3 assumes triangles I think, probably could be 1?
     }
-    static_assert(sizeof(push_constants) <= 128, "push_constants buffer size >128, need to consider maxPushConstantsSize.");
-    DispatchCmdPushConstants(cb_state.VkHandle(), shared_draw_resources.pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0,
-                             static_cast<uint32_t>(sizeof(push_constants)), push_constants);
-    BindValidationCmdsCommonDescSet(gpuav, cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, shared_draw_resources.pipeline_layout,
-                                    cb_state.draw_index, static_cast<uint32_t>(cb_state.per_command_error_loggers.size()));
-    DispatchCmdBindDescriptorSets(cb_state.VkHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, shared_draw_resources.pipeline_layout,
-                                  glsl::kDiagPerCmdDescriptorSet, 1, &draw_validation_desc_set, 0, nullptr);
-    DispatchCmdDraw(cb_state.VkHandle(), 3, 1, 0, 0);  // TODO: this 3 assumes triangles I think, probably could be 1?
 
     CommandBuffer::ErrorLoggerFunc error_logger = [loc, indirect_buffer, indirect_offset, stride, indirect_buffer_size,
                                                    emit_task_error](Validator &gpuav, const uint32_t *error_record,
@@ -469,4 +519,65 @@ void InsertIndirectDrawValidation(Validator &gpuav, const Location &loc, Command
     cb_state.per_command_error_loggers.emplace_back(std::move(error_logger));
 }
 
+void RecordIndirectDrawBarrier(Validator &gpuav, CommandBuffer &cb_state, VkPipelineStageFlags2 dst_stage_mask) {
+    if (!gpuav.gpuav_settings.batch_indirect_draws_validation) {
+        return;
+    }
+    constexpr VkPipelineStageFlags2 indirect_read_stages =
+        VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    if (dst_stage_mask & indirect_read_stages) {
+        cb_state.indirect_buffers_written = true;
+    }
+}
+
+bool RecordBatchedIndirectDrawValidations(Validator &gpuav, const CommandBuffer &cb_state, VkCommandBuffer validation_cb,
+                                          const Location &loc) {
+    if (cb_state.batched_indirect_draw_validations.empty()) {
+        return false;
+    }
+    // Created by the first InsertIndirectDrawValidation() call
+    auto *shared_draw_resources = gpuav.shared_resources_manager.TryGet<SharedDrawValidationResources>();
+    if (!shared_draw_resources || shared_draw_resources->shader_module == VK_NULL_HANDLE ||
+        shared_draw_resources->batch_framebuffer == VK_NULL_HANDLE) {
+        return false;
+    }
+    const VkPipeline validation_pipeline =
+        GetDrawValidationPipeline(gpuav, *shared_draw_resources, shared_draw_resources->batch_render_pass, loc);
+    if (validation_pipeline == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    // Make the indirect buffer writes of the work submitted before visible to the validation draws
+    VkMemoryBarrier memory_barrier = vku::InitStructHelper();
+    memory_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    memory_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    DispatchCmdPipelineBarrier(validation_cb, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, 0, 1,
+                               &memory_barrier, 0, nullptr, 0, nullptr);
+
+    VkRenderPassBeginInfo render_pass_begin_info = vku::InitStructHelper();
+    render_pass_begin_info.renderPass = shared_draw_resources->batch_render_pass;
+    render_pass_begin_info.framebuffer = shared_draw_resources->batch_framebuffer;
+    render_pass_begin_info.renderArea = {{0, 0}, {1, 1}};
+    DispatchCmdBeginRenderPass(validation_cb, &render_pass_begin_info, VK_SUBPASS_CONTENTS_INLINE);
+    DispatchCmdBindPipeline(validation_cb, VK_PIPELINE_BIND_POINT_GRAPHICS, validation_pipeline);
+
+    for (const BatchedIndirectDrawValidation &batched_validation : cb_state.batched_indirect_draw_validations) {
+        DispatchCmdPushConstants(validation_cb, shared_draw_resources->pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                                 static_cast<uint32_t>(sizeof(batched_validation.push_constants)),
+                                 batched_validation.push_constants);
+        // Same as BindValidationCmdsCommonDescSet(), in a command buffer that is not the one of the draw
+        std::array<uint32_t, 2> dynamic_offsets = {{batched_validation.draw_index * gpuav.indices_buffer_alignment_,
+                                                    batched_validation.error_logger_index * gpuav.indices_buffer_alignment_}};
+        std::array<VkDescriptorSet, 2> desc_sets = {{cb_state.GetValidationCmdCommonDescriptorSet(), batched_validation.desc_set}};
+        static_assert(glsl::kDiagPerCmdDescriptorSet == glsl::kDiagCommonDescriptorSet + 1);
+        DispatchCmdBindDescriptorSets(validation_cb, VK_PIPELINE_BIND_POINT_GRAPHICS, shared_draw_resources->pipeline_layout,
+                                      glsl::kDiagCommonDescriptorSet, static_cast<uint32_t>(desc_sets.size()), desc_sets.data(),
+                                      static_cast<uint32_t>(dynamic_offsets.size()), dynamic_offsets.data());
+        DispatchCmdDraw(validation_cb, 3, 1, 0, 0);
+    }
+
+    DispatchCmdEndRenderPass(validation_cb);
+    return true;
+}
+
 }  // namespace gpuav
@@ -18,16 +18,39 @@
 #pragma once
 
 #include <vulkan/vulkan.h>
+#include <stdint.h>
 
 struct Location;
 
 namespace gpuav {
+class CommandBuffer;
 class Validator;
 
+// See gpu/shaders/cmd_validation/draw.vert
+constexpr uint32_t kDrawValidationPushConstantDWords = 11u;
+
+// With gpuav_batch_indirect_draws_validation, what is needed to record the validation draw of an indirect draw in the
+// command buffer the queue submits right before the one of the draw
+struct BatchedIndirectDrawValidation {
+    VkDescriptorSet desc_set = VK_NULL_HANDLE;
+    uint32_t push_constants[kDrawValidationPushConstantDWords] = {};
+    uint32_t draw_index = 0;
+    uint32_t error_logger_index = 0;
+};
+
 void DestroyRenderPassMappedResources(Validator &gpuav, VkRenderPass render_pass);
 
 void InsertIndirectDrawValidation(Validator &gpuav, const Location &loc, CommandBuffer &cb_state, VkBuffer indirect_buffer,
                                   VkDeviceSize indirect_offset, uint32_t draw_count, VkBuffer count_buffer,
                                   VkDeviceSize count_buffer_offset, uint32_t stride);
 
+// With gpuav_batch_indirect_draws_validation, called for the barriers of cb_state. Once a barrier may have made indirect buffer
+// writes visible to the draws recorded after it, these are validated before each of them instead.
+void RecordIndirectDrawBarrier(Validator &gpuav, CommandBuffer &cb_state, VkPipelineStageFlags2 dst_stage_mask);
+
+// Records the batched validation draws of cb_state in validation_cb, which is in the recording state. Returns false if there
+// is nothing to validate or the validation resources could not be created.
+bool RecordBatchedIndirectDrawValidations(Validator &gpuav, const CommandBuffer &cb_state, VkCommandBuffer validation_cb,
+                                          const Location &loc);
+
 }  // namespace gpuav
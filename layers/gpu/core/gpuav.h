@@ -21,7 +21,9 @@
 #include "gpu/resources/gpuav_resources.h"
 #include "gpu/instrumentation/gpuav_shader_instrumentor.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 namespace chassis {
 struct ShaderObject;
@@ -47,14 +49,14 @@ VALSTATETRACK_DERIVED_STATE_OBJECT(VkQueue, gpuav::Queue, vvl::Queue)
 
 namespace gpuav {
 
-class Validator : public GpuShaderInstrumentor {
+class Validator final : public GpuShaderInstrumentor {
     using BaseClass = GpuShaderInstrumentor;
     using Func = vvl::Func;
     using Struct = vvl::Struct;
     using Field = vvl::Field;
 
   public:
-    Validator() : indices_buffer_(*this) { container_type = LayerObjectTypeGpuAssisted; }
+    Validator() : indices_buffer_(*this), cb_memory_block_pool_(*this) { container_type = LayerObjectTypeGpuAssisted; }
 
     // gpuav_setup.cpp
     // -------------
@@ -87,15 +89,20 @@ class Validator : public GpuShaderInstrumentor {
     void PostCreateDevice(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) final;
 
     void InternalVmaError(LogObjectList objlist, const Location& loc, const char* const specific_message) const;
+    // Must be called on a thread without deferred_internal_error
+    void ReportDeferredInternalError(const DeferredInternalError& error, const Location& loc) const;
     VkDeviceAddress GetBufferDeviceAddressHelper(VkBuffer buffer) const;
 
   private:
     void InitSettings(const Location& loc);
+    void PrintDeviceMemoryReport(const Location& loc) const;
 
     // gpuav_record.cpp
     // --------------
   public:
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator, const RecordObject& record_obj) final;
+    void PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo,
+                                       const RecordObject& record_obj) final;
     void PreCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator,
                                    VkBuffer* pBuffer, const RecordObject& record_obj, chassis::CreateBuffer& chassis_state) final;
     void PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator,
@@ -418,14 +425,37 @@ class Validator : public GpuShaderInstrumentor {
 
     VmaAllocator vma_allocator_ = {};
     VmaPool output_buffer_pool_ = VK_NULL_HANDLE;
+    // Updated from const DeviceMemoryBlock methods
+    mutable DeviceMemoryStats device_memory_stats_;
     std::unique_ptr<DescriptorSetManager> desc_set_manager_;
 
     DeviceMemoryBlock indices_buffer_;
     unsigned int indices_buffer_alignment_ = 0;
 
+    // Per command buffer resources, recycled across command buffer resets and frees
+    DeviceMemoryBlockPool cb_memory_block_pool_;
+    // Debug printf output buffers start at gpuav_settings.debug_printf_buffer_size and grow each time a command writes more than
+    // fits, so recording the same work again doesn't truncate its messages again (see debug_printf::AnalyzeAndGenerateMessage)
+    std::atomic<uint32_t> debug_printf_grown_buffer_size_{0};
+    // Only created when parallel post processing is enabled, shared by the readbacks of all queues
+    std::unique_ptr<vvl::ThreadPool> post_process_pool_;
+    VkDescriptorSetLayout instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
+    VkDescriptorSetLayout validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
+
+    // Sorted buffer device address ranges, walking the state tracker address snapshot is only done once per
+    // buffer_device_address_ranges_version, then every command buffer copies the same snapshot into its BDA table
+    struct BdaRangesSnapshot {
+        uint32_t version = 0;
+        std::vector<BufferAddressRange> ranges;
+    };
+    std::shared_ptr<const BdaRangesSnapshot> GetBdaRangesSnapshot();
+
   private:
     std::string instrumented_shader_cache_path_{};
 
+    std::mutex bda_ranges_snapshot_lock_;
+    std::shared_ptr<const BdaRangesSnapshot> bda_ranges_snapshot_;
+
     // Make sure we call the right versions of any timeline semaphore functions.
     bool timeline_khr_{false};
 };
@@ -17,6 +17,7 @@
 
 #include <cmath>
 #include <fstream>
+#include <sstream>
 #include "utils/hash_util.h"
 #include "gpu/core/gpuav.h"
 #include "gpu/cmd_validation/gpuav_draw.h"
@@ -90,25 +91,20 @@ void Validator::PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass ren
 // Clean up device-related resources
 void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                            const RecordObject &record_obj) {
+    if (gpuav_settings.debug_print_memory_report && vma_allocator_) {
+        PrintDeviceMemoryReport(record_obj.location);
+    }
+
     desc_heap_.reset();
 
     shared_resources_manager.Clear();
 
     if (gpuav_settings.cache_instrumented_shaders && !instrumented_shaders_cache_.IsEmpty()) {
-        std::ofstream file_stream(instrumented_shader_cache_path_, std::ofstream::out | std::ofstream::binary);
-        if (file_stream) {
-            ShaderCacheHash shader_cache_hash(gpuav_settings.shader_instrumentation);
-            file_stream.write(reinterpret_cast<const char *>(&shader_cache_hash), sizeof(shader_cache_hash));
-            uint32_t datasize = static_cast<uint32_t>(instrumented_shaders_cache_.spirv_shaders_.size());
-            file_stream.write(reinterpret_cast<char *>(&datasize), sizeof(uint32_t));
-            for (auto &record : instrumented_shaders_cache_.spirv_shaders_) {
-                // Hash of shader
-                file_stream.write(reinterpret_cast<const char *>(&record.first), sizeof(uint32_t));
-                const size_t spirv_dwords_count = record.second.size();
-                file_stream.write(reinterpret_cast<const char *>(&spirv_dwords_count), sizeof(uint32_t));
-                file_stream.write(reinterpret_cast<const char *>(record.second.data()), spirv_dwords_count * sizeof(uint32_t));
-            }
-            file_stream.close();
+        // Other processes may share the file, what they saved is merged in
+        if (!instrumented_shaders_cache_.SaveFile(instrumented_shader_cache_path_,
+                                                  ShaderCacheHash(gpuav_settings.shader_instrumentation).Bytes())) {
+            LogInfo("WARNING-cache-write-error", device, record_obj.location, "Cannot write instrumented shader cache at %s",
+                    instrumented_shader_cache_path_.c_str());
         }
     }
 
@@ -116,6 +112,20 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
 
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
+    // The queues and their readback threads are gone, nothing can post to the pool anymore
+    post_process_pool_.reset();
+
+    // Command buffers are gone with the state tracker, their resources are all back in the pools
+    cb_memory_block_pool_.Clear();
+    if (instrumentation_desc_set_layout_ != VK_NULL_HANDLE) {
+        DispatchDestroyDescriptorSetLayout(device, instrumentation_desc_set_layout_, nullptr);
+        instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
+    }
+    if (validation_cmd_desc_set_layout_ != VK_NULL_HANDLE) {
+        DispatchDestroyDescriptorSetLayout(device, validation_cmd_desc_set_layout_, nullptr);
+        validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
+    }
+
     // State Tracker (BaseClass) can end up making vma calls through callbacks - so destroy allocator last
     if (output_buffer_pool_ != VK_NULL_HANDLE) {
         vmaDestroyPool(vma_allocator_, output_buffer_pool_);
@@ -128,6 +138,33 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
     desc_set_manager_.reset();
 }
 
+void Validator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo,
+                                              const RecordObject &record_obj) {
+    BaseClass::PostCallRecordQueuePresentKHR(queue, pPresentInfo, record_obj);
+    device_memory_stats_.EndFrame();
+}
+
+void Validator::PrintDeviceMemoryReport(const Location &loc) const {
+    std::ostringstream ss;
+    ss << device_memory_stats_.Report();
+
+    // What VMA has in its blocks, the difference with the allocated bytes is lost to fragmentation or free for reuse
+    const auto print_statistics = [&ss](const char *name, const VmaStatistics &statistics) {
+        ss << "  " << name << ": " << statistics.blockCount << " blocks of " << statistics.blockBytes << " bytes in total, "
+           << statistics.allocationCount << " allocations using " << statistics.allocationBytes << " bytes\n";
+    };
+    if (output_buffer_pool_ != VK_NULL_HANDLE) {
+        VmaStatistics output_pool_statistics = {};
+        vmaGetPoolStatistics(vma_allocator_, output_buffer_pool_, &output_pool_statistics);
+        print_statistics("Output buffers pool", output_pool_statistics);
+    }
+    VmaTotalStatistics total_statistics = {};
+    vmaCalculateStatistics(vma_allocator_, &total_statistics);
+    print_statistics("All VMA memory", total_statistics.total.statistics);
+
+    LogInfo("INFO-GPU-Assisted-Validation-Memory-Report", device, loc, "%s", ss.str().c_str());
+}
+
 void Validator::RecordCmdBeginRenderPassLayouts(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                                 const VkSubpassContents contents) {
     if (!pRenderPassBegin) {
@@ -213,6 +250,22 @@ void Validator::PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkP
         InternalError(commandBuffer, record_obj.location, "Unrecognized command buffer.");
         return;
     }
+    if (gpuav_settings.lazy_shader_instrumentation) {
+        if (auto pipeline_state = Get<vvl::Pipeline>(pipeline)) {
+            // Pipelines that already ran cleanly often enough keep the original pipeline
+            const uint32_t clean_count_limit = gpuav_settings.uninstrument_clean_pipelines_count;
+            if (clean_count_limit == 0 || pipeline_state->instrumentation_data.clean_submit_count.load() < clean_count_limit) {
+                // The original pipeline was just bound by the driver, replace it with the instrumented one
+                const VkPipeline instrumented_pipeline = GetLazyInstrumentedPipeline(*pipeline_state, record_obj.location);
+                if (instrumented_pipeline != VK_NULL_HANDLE) {
+                    DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, instrumented_pipeline);
+                    if (clean_count_limit != 0) {
+                        cb_state->lazy_instrumented_pipelines.emplace(std::move(pipeline_state));
+                    }
+                }
+            }
+        }
+    }
     descriptor::UpdateBoundPipeline(*this, *cb_state, pipelineBindPoint, pipeline, record_obj.location);
 }
 
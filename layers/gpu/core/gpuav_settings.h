@@ -24,20 +24,28 @@ struct GpuAVSettings {
     uint32_t max_bda_in_use = 10000;
     bool cache_instrumented_shaders = true;
     bool select_instrumented_shaders = false;
+    bool parallel_shader_instrumentation = true;
+    bool lazy_shader_instrumentation = false;
+    // With lazy_shader_instrumentation, number of clean submissions after which a pipeline is not instrumented anymore
+    uint32_t uninstrument_clean_pipelines_count = 0;  // zero is same as "never"
 
     // Turned off until we can fix things
     // see https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/8579
     bool validate_indirect_draws_buffers = false;
+    bool batch_indirect_draws_validation = false;
     bool validate_indirect_dispatches_buffers = false;
     bool validate_indirect_trace_rays_buffers = false;
     bool validate_buffer_copies = true;
 
     bool vma_linear_output = true;
+    uint32_t vma_output_pool_block_size = 0;  // in MiB, zero lets VMA pick
+    bool parallel_post_processing = true;
 
     bool debug_validate_instrumented_shaders = false;
     bool debug_dump_instrumented_shaders = false;
     uint32_t debug_max_instrumentations_count = 0;  // zero is same as "unlimited"
     bool debug_print_instrumentation_info = false;
+    bool debug_print_memory_report = false;
 
     // Note - even though DebugPrintf basically fits in here, from the user point of view they are different and that is reflected
     // in the settings (which are reflected in VkConfig). To make our lives easier, we just make these settings with the hierarchy
@@ -47,6 +55,8 @@ struct GpuAVSettings {
         bool buffer_device_address = true;
         bool ray_query = true;
         bool post_process_descriptor_index = true;
+        // Changes how the checks above are done, not what is checked
+        bool inline_fast_path_checks = false;
     } shader_instrumentation;
 
     bool IsShaderInstrumentationEnabled() const {
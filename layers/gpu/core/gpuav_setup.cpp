@@ -16,8 +16,6 @@
  */
 
 #include <cmath>
-#include <fstream>
-#include <cstring>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
 #include <unistd.h>
 #endif
@@ -33,24 +31,24 @@
 namespace gpuav {
 
 std::shared_ptr<vvl::Buffer> Validator::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *create_info) {
-    return std::make_shared<Buffer>(*this, handle, create_info, *desc_heap_);
+    return state_object::MakePooledState<Buffer>(*this, handle, create_info, *desc_heap_);
 }
 
 std::shared_ptr<vvl::BufferView> Validator::CreateBufferViewState(const std::shared_ptr<vvl::Buffer> &buffer, VkBufferView handle,
                                                                   const VkBufferViewCreateInfo *create_info,
                                                                   VkFormatFeatureFlags2 format_features) {
-    return std::make_shared<BufferView>(buffer, handle, create_info, format_features, *desc_heap_);
+    return state_object::MakePooledState<BufferView>(buffer, handle, create_info, format_features, *desc_heap_);
 }
 
 std::shared_ptr<vvl::ImageView> Validator::CreateImageViewState(const std::shared_ptr<vvl::Image> &image_state, VkImageView handle,
                                                                 const VkImageViewCreateInfo *create_info,
                                                                 VkFormatFeatureFlags2 format_features,
                                                                 const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) {
-    return std::make_shared<ImageView>(image_state, handle, create_info, format_features, cubic_props, *desc_heap_);
+    return state_object::MakePooledState<ImageView>(image_state, handle, create_info, format_features, cubic_props, *desc_heap_);
 }
 
 std::shared_ptr<vvl::Sampler> Validator::CreateSamplerState(VkSampler handle, const VkSamplerCreateInfo *create_info) {
-    return std::make_shared<Sampler>(handle, create_info, *desc_heap_);
+    return state_object::MakePooledState<Sampler>(handle, create_info, *desc_heap_);
 }
 
 std::shared_ptr<vvl::AccelerationStructureKHR> Validator::CreateAccelerationStructureState(
@@ -63,7 +61,7 @@ std::shared_ptr<vvl::DescriptorSet> Validator::CreateDescriptorSet(VkDescriptorS
                                                                    const std::shared_ptr<vvl::DescriptorSetLayout const> &layout,
                                                                    uint32_t variable_count) {
     return std::static_pointer_cast<vvl::DescriptorSet>(
-        std::make_shared<DescriptorSet>(handle, pool, layout, variable_count, this));
+        state_object::MakePooledState<DescriptorSet>(handle, pool, layout, variable_count, this));
 }
 
 std::shared_ptr<vvl::CommandBuffer> Validator::CreateCmdBufferState(VkCommandBuffer handle,
@@ -426,6 +424,44 @@ void Validator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
 
     desc_set_manager_ = std::make_unique<DescriptorSetManager>(device, static_cast<uint32_t>(instrumentation_bindings_.size()));
 
+    if (gpuav_settings.parallel_post_processing) {
+        post_process_pool_ = std::make_unique<vvl::ThreadPool>(vvl::ThreadPool::DefaultThreadCount());
+    }
+
+    // Descriptor set layouts used by every command buffer
+    {
+        assert(!instrumentation_bindings_.empty());
+        VkDescriptorSetLayoutCreateInfo instrumentation_desc_set_layout_ci = vku::InitStructHelper();
+        instrumentation_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(instrumentation_bindings_.size());
+        instrumentation_desc_set_layout_ci.pBindings = instrumentation_bindings_.data();
+        result = DispatchCreateDescriptorSetLayout(device, &instrumentation_desc_set_layout_ci, nullptr,
+                                                   &instrumentation_desc_set_layout_);
+        if (result != VK_SUCCESS) {
+            InternalError(device, loc, "Unable to create instrumentation descriptor set layout.");
+            return;
+        }
+
+        const std::vector<VkDescriptorSetLayoutBinding> validation_cmd_bindings = {
+            // Error output buffer
+            {glsl::kBindingDiagErrorBuffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+            // Buffer holding action command index in command buffer
+            {glsl::kBindingDiagActionIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
+            // Buffer holding a resource index from the per command buffer command resources list
+            {glsl::kBindingDiagCmdResourceIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
+            // Commands errors counts buffer
+            {glsl::kBindingDiagCmdErrorsCount, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+        };
+        VkDescriptorSetLayoutCreateInfo validation_cmd_desc_set_layout_ci = vku::InitStructHelper();
+        validation_cmd_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(validation_cmd_bindings.size());
+        validation_cmd_desc_set_layout_ci.pBindings = validation_cmd_bindings.data();
+        result = DispatchCreateDescriptorSetLayout(device, &validation_cmd_desc_set_layout_ci, nullptr,
+                                                   &validation_cmd_desc_set_layout_);
+        if (result != VK_SUCCESS) {
+            InternalError(device, loc, "Unable to create descriptor set layout used for validation commands.");
+            return;
+        }
+    }
+
     // If api version 1.1 or later, SetDeviceLoaderData will be in the loader
     {
         auto chain_info = GetChainInfo(pCreateInfo, VK_LOADER_DATA_CALLBACK);
@@ -459,7 +495,7 @@ void Validator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
     }
     VmaPoolCreateInfo vma_pool_ci = {};
     vma_pool_ci.memoryTypeIndex = mem_type_index;
-    vma_pool_ci.blockSize = 0;
+    vma_pool_ci.blockSize = VkDeviceSize(gpuav_settings.vma_output_pool_block_size) * 1024 * 1024;
     vma_pool_ci.maxBlockCount = 0;
     if (gpuav_settings.vma_linear_output) {
         vma_pool_ci.flags = VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT;
@@ -478,27 +514,8 @@ void Validator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
 #endif
         instrumented_shader_cache_path_ += ".bin";
 
-        std::ifstream file_stream(instrumented_shader_cache_path_, std::ifstream::in | std::ifstream::binary);
-        if (file_stream) {
-            ShaderCacheHash shader_cache_hash(gpuav_settings.shader_instrumentation);
-            char inst_shader_hash[sizeof(shader_cache_hash)];
-            file_stream.read(inst_shader_hash, sizeof(inst_shader_hash));
-            if (std::memcmp(inst_shader_hash, reinterpret_cast<char *>(&shader_cache_hash), sizeof(shader_cache_hash)) == 0) {
-                uint32_t num_shaders = 0;
-                file_stream.read(reinterpret_cast<char *>(&num_shaders), sizeof(uint32_t));
-                for (uint32_t i = 0; i < num_shaders; ++i) {
-                    uint32_t hash;
-                    uint32_t spirv_dwords_count;
-                    std::vector<uint32_t> shader_code;
-                    file_stream.read(reinterpret_cast<char *>(&hash), sizeof(uint32_t));
-                    file_stream.read(reinterpret_cast<char *>(&spirv_dwords_count), sizeof(uint32_t));
-                    shader_code.resize(spirv_dwords_count);
-                    file_stream.read(reinterpret_cast<char *>(shader_code.data()), 4 * spirv_dwords_count);
-                    instrumented_shaders_cache_.Add(hash, std::move(shader_code));
-                }
-            }
-            file_stream.close();
-        }
+        instrumented_shaders_cache_.LoadFile(instrumented_shader_cache_path_,
+                                             ShaderCacheHash(gpuav_settings.shader_instrumentation).Bytes());
     }
 
     // Create command indices buffer
@@ -606,6 +623,12 @@ void Validator::InitSettings(const Location &loc) {
 }
 
 void Validator::InternalVmaError(LogObjectList objlist, const Location &loc, const char *const specific_message) const {
+    if (deferred_internal_error) {
+        if (!deferred_internal_error->has_value()) {
+            *deferred_internal_error = DeferredInternalError{true, std::move(objlist), specific_message};
+        }
+        return;
+    }
     aborted_ = true;
     std::string error_message = specific_message;
 
@@ -626,6 +649,15 @@ void Validator::InternalVmaError(LogObjectList objlist, const Location &loc, con
     ReleaseDeviceDispatchObject(LayerObjectTypeGpuAssisted);
 }
 
+void Validator::ReportDeferredInternalError(const DeferredInternalError &error, const Location &loc) const {
+    assert(!deferred_internal_error);
+    if (error.vma_error) {
+        InternalVmaError(error.objlist, loc, error.message.c_str());
+    } else {
+        InternalError(error.objlist, loc, error.message.c_str());
+    }
+}
+
 VkDeviceAddress Validator::GetBufferDeviceAddressHelper(VkBuffer buffer) const {
     VkBufferDeviceAddressInfo address_info = vku::InitStructHelper();
     address_info.buffer = buffer;
@@ -637,4 +669,25 @@ VkDeviceAddress Validator::GetBufferDeviceAddressHelper(VkBuffer buffer) const {
     }
 }
 
+std::shared_ptr<const Validator::BdaRangesSnapshot> Validator::GetBdaRangesSnapshot() {
+    const auto address_snapshot = GetBufferAddressSnapshot();
+    const uint32_t version = address_snapshot ? address_snapshot->version : 0;
+    std::lock_guard<std::mutex> guard(bda_ranges_snapshot_lock_);
+    if (bda_ranges_snapshot_ && bda_ranges_snapshot_->version == version) {
+        return bda_ranges_snapshot_;
+    }
+
+    // Command buffers still copying the previous snapshot keep it alive
+    auto snapshot = std::make_shared<BdaRangesSnapshot>();
+    snapshot->version = version;
+    if (address_snapshot) {
+        snapshot->ranges.reserve(address_snapshot->entries.size());
+        for (const auto &entry : address_snapshot->entries) {
+            snapshot->ranges.emplace_back(entry.range);
+        }
+    }
+    bda_ranges_snapshot_ = std::move(snapshot);
+    return bda_ranges_snapshot_;
+}
+
 }  // namespace gpuav
@@ -18,6 +18,8 @@
 #pragma once
 // Default values for those settings should match layers/VkLayer_khronos_validation.json.in
 
+#include <vector>
+
 #include "generated/gpuav_shader_hash.h"
 #include "gpu/core/gpuav_settings.h"
 
@@ -29,5 +31,13 @@ struct ShaderCacheHash {
     // Settings that are part of shader instrumentation that would need us to invalidate the cache
     const GpuAVSettings::ShaderInstrumentation shader_instrumentation_settings;
     const char gpu_av_shader_git_hash[sizeof(GPU_AV_SHADER_GIT_HASH)] = GPU_AV_SHADER_GIT_HASH;
+    // Bump when the shader ids the cache is keyed by are computed differently (they are Hash128::Fold32() of the SPIR-V)
+    const uint32_t shader_id_version = 2;
+
+    // Tag of the cache file
+    std::vector<char> Bytes() const {
+        const char* bytes = reinterpret_cast<const char*>(this);
+        return std::vector<char>(bytes, bytes + sizeof(*this));
+    }
 };
 #pragma pack(pop)
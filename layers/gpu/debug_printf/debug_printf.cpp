@@ -29,6 +29,9 @@
 namespace gpuav {
 namespace debug_printf {
 
+// Output buffers don't grow past the max of the printf_buffer_size setting
+static constexpr uint32_t kMaxGrownOutputBufferSize = 1024 * 1024;
+
 enum NumericType {
     NumericTypeUnknown = 0,
     NumericTypeFloat = 1,
@@ -68,8 +71,33 @@ struct Substring {
     bool needs_value = false;  // if value from buffer needed to print arguments
     NumericType type = NumericTypeUnknown;
     bool is_64_bit = false;
+    bool missing_64_bit_specifier = false;  // 64-bit signed int not printed with "%ld"
 };
 
+// Swap the 64-bit specifiers of the shader for the ones of the host snprintf
+static void ReplaceSpecifier64(Substring &substring) {
+    if (substring.type == NumericTypeUint) {
+        std::array<std::string_view, 3> format_strings = {{"%ul", "%lu", "%lx"}};
+        for (const auto &ul_string : format_strings) {
+            size_t ul_pos = substring.string.find(ul_string);
+            if (ul_pos == std::string::npos) continue;
+            if (ul_string != "%lu") {
+                substring.string.replace(ul_pos + 1, 2, PRIx64);
+            } else {
+                substring.string.replace(ul_pos + 1, 2, PRIu64);
+            }
+            break;
+        }
+    } else if (substring.type == NumericTypeSint) {
+        size_t ld_pos = substring.string.find("%ld");
+        if (ld_pos != std::string::npos) {
+            substring.string.replace(ld_pos + 1, 2, PRId64);
+        } else {
+            substring.missing_64_bit_specifier = true;
+        }
+    }
+}
+
 static std::vector<Substring> ParseFormatString(const std::string &format_string) {
     const char types[] = {'d', 'i', 'o', 'u', 'x', 'X', 'a', 'A', 'e', 'E', 'f', 'F', 'g', 'G', 'v', '\0'};
     std::vector<Substring> parsed_strings;
@@ -151,20 +179,46 @@ static std::vector<Substring> ParseFormatString(const std::string &format_string
             begin = pos + 1;
         }
     }
+    for (Substring &substring : parsed_strings) {
+        if (substring.needs_value && substring.is_64_bit) {
+            ReplaceSpecifier64(substring);
+        }
+    }
     return parsed_strings;
 }
 
-static std::string FindFormatString(const std::vector<Instruction> &instructions, uint32_t string_id) {
-    std::string format_string;
-    for (const auto &insn : instructions) {
-        if (insn.Opcode() == spv::OpString && insn.Word(1) == string_id) {
-            format_string = insn.GetAsString(2);
-            break;
+// The instrumented SPIR-V of a shader with each OpString already broken into substrings, so the records it writes only need to
+// be formatted
+struct ShaderFormatStrings {
+    std::vector<uint32_t> instrumented_spirv;
+    std::vector<Instruction> instructions;  // points into instrumented_spirv
+    // keyed by the OpString result id
+    vvl::unordered_map<uint32_t, std::vector<Substring>> format_strings;
+};
+
+static std::shared_ptr<const ShaderFormatStrings> GetShaderFormatStrings(Validator &gpuav, uint32_t shader_id) {
+    auto cached = gpuav.printf_format_strings_map_.find(shader_id);
+    if (cached != gpuav.printf_format_strings_map_.end()) {
+        return cached->second;
+    }
+
+    auto it = gpuav.instrumented_shaders_map_.find(shader_id);
+    if (it == gpuav.instrumented_shaders_map_.end() || it->second.instrumented_spirv.empty()) {
+        return nullptr;
+    }
+
+    auto shader = std::make_shared<ShaderFormatStrings>();
+    shader->instrumented_spirv = it->second.instrumented_spirv;
+    spirv::GenerateInstructions(shader->instrumented_spirv, shader->instructions);
+    for (const auto &insn : shader->instructions) {
+        if (insn.Opcode() == spv::OpString) {
+            shader->format_strings.emplace(insn.Word(1), ParseFormatString(insn.GetAsString(2)));
         }
-        // if here, seen all OpString and can return early
+        // if here, seen all OpString
         if (insn.Opcode() == spv::OpFunction) break;
     }
-    return format_string;
+    gpuav.printf_format_strings_map_.insert(shader_id, shader);
+    return shader;
 }
 
 // GCC and clang don't like using variables as format strings in sprintf.
@@ -197,63 +251,47 @@ void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer,
     if (!output_buffer_dwords_counts) return;
 
     uint32_t output_record_i = gpuav::kDebugPrintfOutputBufferData;  // get first OutputRecord index
+    uint32_t shader_id = 0;
+    std::shared_ptr<const ShaderFormatStrings> shader;
     while (debug_output_buffer[output_record_i]) {
         std::stringstream shader_message;
 
         OutputRecord *debug_record = reinterpret_cast<OutputRecord *>(&debug_output_buffer[output_record_i]);
-        // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
-        // by the instrumented shader.
-        const gpuav::InstrumentedShader *instrumented_shader = nullptr;
-        auto it = gpuav.instrumented_shaders_map_.find(debug_record->shader_id);
-        if (it != gpuav.instrumented_shaders_map_.end()) {
-            instrumented_shader = &it->second;
+        // Records are mostly from the same few shaders, only look them up again when the shader changes
+        if (!shader || debug_record->shader_id != shader_id) {
+            shader_id = debug_record->shader_id;
+            shader = GetShaderFormatStrings(gpuav, shader_id);
         }
 
         // without the instrumented spirv, there is nothing valuable to print out
-        if (!instrumented_shader || instrumented_shader->instrumented_spirv.empty()) {
+        if (!shader) {
             gpuav.InternalWarning(queue, loc, "Can't find instructions from any handles in shader_map");
             return;
         }
 
-        std::vector<Instruction> instructions;
-        spirv::GenerateInstructions(instrumented_shader->instrumented_spirv, instructions);
-
-        // Search through the shader source for the printf format string for this invocation
-        const std::string format_string = FindFormatString(instructions, debug_record->format_string_id);
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
+        // The printf format string for this invocation, already broken into strings with 1 or 0 value
+        static const std::vector<Substring> kEmptyFormatString = {};
+        auto format_string = shader->format_strings.find(debug_record->format_string_id);
+        const std::vector<Substring> &format_substrings =
+            format_string != shader->format_strings.end() ? format_string->second : kEmptyFormatString;
         void *current_value = static_cast<void *>(&debug_record->values);
         // Sprintf each format substring into a temporary string then add that to the message
         for (size_t substring_i = 0; substring_i < format_substrings.size(); substring_i++) {
-            auto &substring = format_substrings[substring_i];
+            const Substring &substring = format_substrings[substring_i];
+            bool is_64_bit = substring.is_64_bit;
             std::string temp_string;
             size_t needed = 0;
 
             if (substring.needs_value) {
-                if (substring.is_64_bit) {
+                if (is_64_bit) {
                     if (substring.type == NumericTypeUint) {
-                        std::array<std::string_view, 3> format_strings = {{"%ul", "%lu", "%lx"}};
-                        for (const auto &ul_string : format_strings) {
-                            size_t ul_pos = substring.string.find(ul_string);
-                            if (ul_pos == std::string::npos) continue;
-                            if (ul_string != "%lu") {
-                                substring.string.replace(ul_pos + 1, 2, PRIx64);
-                            } else {
-                                substring.string.replace(ul_pos + 1, 2, PRIu64);
-                            }
-                            break;
-                        }
-
                         const uint64_t value = *static_cast<uint64_t *>(current_value);
                         // +1 for null terminator
                         needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
                         temp_string.resize(needed);
                         std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
                     } else if (substring.type == NumericTypeSint) {
-                        size_t ld_pos = substring.string.find("%ld");
-                        if (ld_pos != std::string::npos) {
-                            substring.string.replace(ld_pos + 1, 2, PRId64);
-                        } else {
+                        if (substring.missing_64_bit_specifier) {
                             gpuav.InternalWarning(command_buffer, loc,
                                                   "Trying to DebugPrintf a 64-bit signed int but not using \"%%ld\" to print it.");
                         }
@@ -305,7 +343,7 @@ void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer,
                         // Using the bitmask, we know if the incoming float was 64-bit or not.
                         // This is much simpler than enforcing a %lf which doesn't line up with how the CPU side works
                         if (debug_record->double_bitmask & (1 << substring_i)) {
-                            substring.is_64_bit = true;
+                            is_64_bit = true;
                             const double value = *static_cast<double *>(current_value);
                             needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
                             temp_string.resize(needed);
@@ -319,7 +357,7 @@ void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer,
                     }
                 }
 
-                const uint32_t offset = substring.is_64_bit ? 2 : 1;
+                const uint32_t offset = is_64_bit ? 2 : 1;
                 current_value = static_cast<uint32_t *>(current_value) + offset;
 
             } else {
@@ -334,8 +372,14 @@ void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer,
 
         const bool use_stdout = gpuav.gpuav_settings.debug_printf_to_stdout;
         if (gpuav.gpuav_settings.debug_printf_verbose) {
+            // The handles the shader is used with can change, so they are not cached with the format strings
+            const gpuav::InstrumentedShader *instrumented_shader = nullptr;
+            auto it = gpuav.instrumented_shaders_map_.find(debug_record->shader_id);
+            if (it != gpuav.instrumented_shaders_map_.end()) {
+                instrumented_shader = &it->second;
+            }
             std::string debug_info_message = gpuav.GenerateDebugInfoMessage(
-                command_buffer, instructions, debug_record->stage_id, debug_record->stage_info_0, debug_record->stage_info_1,
+                command_buffer, debug_record->stage_id, debug_record->stage_info_0, debug_record->stage_info_1,
                 debug_record->stage_info_2, debug_record->instruction_position, instrumented_shader, debug_record->shader_id,
                 buffer_info.pipeline_bind_point, buffer_info.action_command_index);
             if (use_stdout) {
@@ -357,9 +401,25 @@ void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer,
         output_record_i += debug_record->size;
     }
     if ((output_record_i - gpuav::kDebugPrintfOutputBufferData) < output_buffer_dwords_counts) {
+        // The shader still counts the words it could not write, grow the buffers of the next recordings to fit all of them
+        const uint64_t needed_size =
+            sizeof(uint32_t) * (uint64_t(output_buffer_dwords_counts) + gpuav::kDebugPrintfOutputBufferData);
+        uint32_t grown_size = buffer_info.buffer_size;
+        while (grown_size < needed_size && grown_size < kMaxGrownOutputBufferSize) {
+            grown_size *= 2;
+        }
+        grown_size = std::max(buffer_info.buffer_size, std::min(grown_size, kMaxGrownOutputBufferSize));
+        std::atomic<uint32_t> &shared_size = gpuav.debug_printf_grown_buffer_size_;
+        uint32_t current_size = shared_size.load();
+        while (current_size < grown_size && !shared_size.compare_exchange_weak(current_size, grown_size)) {
+        }
+
         std::stringstream message;
-        message << "Debug Printf message was truncated due to a buffer size (" << gpuav.gpuav_settings.debug_printf_buffer_size
+        message << "Debug Printf message was truncated due to a buffer size (" << buffer_info.buffer_size
                 << ") being too small for the messages. (This can be adjusted with VK_LAYER_PRINTF_BUFFER_SIZE or vkconfig)";
+        if (grown_size > buffer_info.buffer_size) {
+            message << " Command buffers recorded from now on will use a buffer size of " << OutputBufferSize(gpuav) << ".";
+        }
         gpuav.InternalWarning(command_buffer, loc, message.str().c_str());
     }
 
@@ -367,7 +427,7 @@ void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer,
     // At the same time we want to make sure we don't memset past the actual VkBuffer allocation
     uint32_t clear_size =
         sizeof(uint32_t) * (debug_output_buffer[gpuav::kDebugPrintfOutputBufferDWordsCount] + gpuav::kDebugPrintfOutputBufferData);
-    clear_size = std::min(gpuav.gpuav_settings.debug_printf_buffer_size, clear_size);
+    clear_size = std::min(buffer_info.buffer_size, clear_size);
     memset(debug_output_buffer, 0, clear_size);
 }
 
@@ -375,26 +435,30 @@ void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer,
 #pragma GCC diagnostic pop
 #endif
 
+DeviceMemoryBlockSizeClass OutputBufferSizeClass(const Validator &gpuav, uint32_t buffer_size) {
+    return {buffer_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, gpuav.output_buffer_pool_};
+}
+
+uint32_t OutputBufferSize(const Validator &gpuav) {
+    return std::max(gpuav.gpuav_settings.debug_printf_buffer_size, gpuav.debug_printf_grown_buffer_size_.load());
+}
+
 bool UpdateInstrumentationDescSet(Validator &gpuav, CommandBuffer &cb_state, VkDescriptorSet instrumentation_desc_set,
                                   VkPipelineBindPoint bind_point, const Location &loc) {
     gpuav::DeviceMemoryBlock debug_printf_output_buffer(gpuav);
+    const uint32_t buffer_size = OutputBufferSize(gpuav);
 
-    // Allocate memory for the output block that the gpu will use to return values for printf
-    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-    buffer_info.size = gpuav.gpuav_settings.debug_printf_buffer_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    alloc_info.pool = gpuav.output_buffer_pool_;
-    debug_printf_output_buffer.CreateBuffer(loc, &buffer_info, &alloc_info);
+    // Get memory for the output block that the gpu will use to return values for printf
+    gpuav.cb_memory_block_pool_.Acquire(loc, OutputBufferSizeClass(gpuav, buffer_size), debug_printf_output_buffer);
 
     // Clear the output block to zeros so that only printf values from the gpu will be present
     auto printf_output_ptr = (uint32_t *)debug_printf_output_buffer.MapMemory(loc);
-    memset(printf_output_ptr, 0, gpuav.gpuav_settings.debug_printf_buffer_size);
+    memset(printf_output_ptr, 0, buffer_size);
     debug_printf_output_buffer.UnmapMemory();
 
     VkDescriptorBufferInfo debug_printf_desc_buffer_info = {};
-    debug_printf_desc_buffer_info.range = gpuav.gpuav_settings.debug_printf_buffer_size;
+    debug_printf_desc_buffer_info.range = buffer_size;
     debug_printf_desc_buffer_info.buffer = debug_printf_output_buffer.Buffer();
     debug_printf_desc_buffer_info.offset = 0;
 
@@ -407,7 +471,8 @@ bool UpdateInstrumentationDescSet(Validator &gpuav, CommandBuffer &cb_state, VkD
 
     DispatchUpdateDescriptorSets(gpuav.device, 1, &wds, 0, nullptr);
 
-    cb_state.debug_printf_buffer_infos.emplace_back(debug_printf_output_buffer, bind_point, cb_state.action_command_count);
+    cb_state.debug_printf_buffer_infos.emplace_back(debug_printf_output_buffer, buffer_size, bind_point,
+                                                    cb_state.action_command_count);
     return true;
 }
 
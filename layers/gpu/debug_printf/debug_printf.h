@@ -22,10 +22,15 @@
 struct Location;
 namespace gpuav {
 struct DebugPrintfBufferInfo;
+struct DeviceMemoryBlockSizeClass;
 class CommandBuffer;
 class Validator;
 
 namespace debug_printf {
+// Output buffers come from Validator::cb_memory_block_pool_ and go back to it when the command buffer is reset
+DeviceMemoryBlockSizeClass OutputBufferSizeClass(const Validator& gpuav, uint32_t buffer_size);
+// Size in bytes of the output buffer for the next command recorded
+uint32_t OutputBufferSize(const Validator& gpuav);
 bool UpdateInstrumentationDescSet(Validator& gpuav, CommandBuffer& cb_state, VkDescriptorSet instrumentation_desc_set,
                                   VkPipelineBindPoint bind_point, const Location& loc);
 void AnalyzeAndGenerateMessage(Validator& gpuav, VkCommandBuffer command_buffer, VkQueue queue, DebugPrintfBufferInfo& buffer_info,
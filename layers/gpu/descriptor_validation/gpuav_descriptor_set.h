@@ -39,6 +39,8 @@ class DescriptorSet : public vvl::DescriptorSet {
     VkDeviceAddress GetTypeAddress(Validator &gpuav, const Location &loc);
     VkDeviceAddress GetPostProcessBuffer(Validator &gpuav, const Location &loc);
     bool HasPostProcessBuffer() const { return !post_process_block_.Destroyed(); }
+    // Bumped by every update of the set
+    uint32_t CurrentVersion() const { return current_version_.load(); }
 
     std::map<uint32_t, std::vector<uint32_t>> UsedDescriptors(const Location &loc, uint32_t shader_set) const;
 
@@ -43,14 +43,16 @@ void UpdateBoundPipeline(Validator &gpuav, CommandBuffer &cb_state, VkPipelineBi
     }
 
     // Update the last vkCmdBindDescriptorSet with the new pipeline
+    cb_state.descriptor_command_bindings.back().pipeline_state = last_bound.pipeline_state;
     auto &bound_descriptor_sets = cb_state.descriptor_command_bindings.back().bound_descriptor_sets;
 
     // If the user calls vkCmdBindDescriptorSet::firstSet to a non-zero value, these indexes don't line up
     size_t update_index = 0;
+    const ActiveSlotMap &active_slots = last_bound.pipeline_state->ActiveSlots();
     for (uint32_t i = 0; i < last_bound.per_set.size(); i++) {
         if (last_bound.per_set[i].bound_descriptor_set) {
-            auto slot = last_bound.pipeline_state->active_slots.find(i);
-            if (slot != last_bound.pipeline_state->active_slots.end()) {
+            auto slot = active_slots.find(i);
+            if (slot != active_slots.end()) {
                 if (update_index >= bound_descriptor_sets.size()) {
                     // TODO - Hit crash running with Dota2, this shouldn't happen, need to look into
                     continue;
@@ -78,6 +80,27 @@ void UpdateBoundDescriptors(Validator &gpuav, CommandBuffer &cb_state, VkPipelin
         return;
     }
 
+    std::vector<DescriptorCommandBinding::BoundSetKey> per_set_keys(number_of_sets);
+    for (uint32_t i = 0; i < number_of_sets; i++) {
+        if (const auto *ds_state = static_cast<const DescriptorSet *>(last_bound.per_set[i].bound_descriptor_set.get())) {
+            per_set_keys[i] = {ds_state, ds_state->CurrentVersion()};
+        } else {
+            per_set_keys[i] = {nullptr, 0};
+        }
+    }
+    // Nothing changed since the last binding, draws keep using it
+    if (!cb_state.descriptor_command_bindings.empty()) {
+        const DescriptorCommandBinding &last_binding = cb_state.descriptor_command_bindings.back();
+        const auto same_key = [](const DescriptorCommandBinding::BoundSetKey &a, const DescriptorCommandBinding::BoundSetKey &b) {
+            return a.state == b.state && a.version == b.version;
+        };
+        if (last_binding.pipeline_bind_point == pipeline_bind_point && last_binding.pipeline_state == last_bound.pipeline_state &&
+            std::equal(per_set_keys.begin(), per_set_keys.end(), last_binding.per_set_keys.begin(),
+                       last_binding.per_set_keys.end(), same_key)) {
+            return;
+        }
+    }
+
     // Figure out how much memory we need for the input block based on how many sets and bindings there are
     // and how big each of the bindings is
     VkBufferCreateInfo buffer_info = vku::InitStructHelper();
@@ -87,6 +110,9 @@ void UpdateBoundDescriptors(Validator &gpuav, CommandBuffer &cb_state, VkPipelin
     alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
     alloc_info.pool = VK_NULL_HANDLE;
     DescriptorCommandBinding descriptor_command_binding(gpuav);
+    descriptor_command_binding.pipeline_bind_point = pipeline_bind_point;
+    descriptor_command_binding.pipeline_state = last_bound.pipeline_state;
+    descriptor_command_binding.per_set_keys = std::move(per_set_keys);
 
     // Allocate buffer for device addresses of the input buffer for each descriptor set.  This is the buffer written to each
     // draw's descriptor set.
@@ -111,8 +137,9 @@ void UpdateBoundDescriptors(Validator &gpuav, CommandBuffer &cb_state, VkPipelin
         DescriptorSet &ds_state = *bound_descriptor_set.state;
         // The pipeline might not have been bound yet, so will need to update binding_req_map later
         if (last_bound.pipeline_state) {
-            auto slot = last_bound.pipeline_state->active_slots.find(i);
-            if (slot != last_bound.pipeline_state->active_slots.end()) {
+            const ActiveSlotMap &active_slots = last_bound.pipeline_state->ActiveSlots();
+            auto slot = active_slots.find(i);
+            if (slot != active_slots.end()) {
                 bound_descriptor_set.binding_req_map = slot->second;
             }
         }
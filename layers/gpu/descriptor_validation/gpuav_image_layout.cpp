@@ -21,6 +21,8 @@
 #include "gpu/core/gpuav.h"
 #include "gpu/resources/gpuav_subclasses.h"
 #include "gpu/cmd_validation/gpuav_copy_buffer_to_image.h"
+#include "gpu/cmd_validation/gpuav_draw.h"
+#include "sync/sync_utils.h"
 #include "utils/image_layout_utils.h"
 
 #include "state_tracker/render_pass_state.h"
@@ -160,11 +162,19 @@ static bool VerifyImageLayoutRange(const Validator &gpuav, const vvl::CommandBuf
     if (!subresource_map) {
         return skip;
     }
-    const auto &layout_map = subresource_map->GetLayoutMap();
     const auto *global_map = image_state.layout_range_map.get();
-    GlobalImageLayoutRangeMap empty_map(1);
     assert(global_map);
+    // The whole image is checked, not only the accessed view, so every descriptor of a bindless set using the image would find
+    // the same thing. Once it matched, it only has to be checked again when the layouts of the image change.
+    if (subresource_map->ValidatedGeneration() == global_map->Generation()) {
+        return skip;
+    }
+    const auto &layout_map = subresource_map->GetLayoutMap();
+    GlobalImageLayoutRangeMap empty_map(1);
     auto global_map_guard = global_map->ReadLock();
+    // Read under the lock, no writer can change the layouts while the comparison runs
+    const uint64_t global_generation = global_map->Generation();
+    bool layout_mismatch = false;
 
     auto pos = layout_map.begin();
     const auto end = layout_map.end();
@@ -191,6 +201,7 @@ static bool VerifyImageLayoutRange(const Validator &gpuav, const vvl::CommandBuf
             const auto aspect_mask = image_state.subresource_encoder.Decode(intersected_range.begin).aspectMask;
             const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
             if (!matches) {
+                layout_mismatch = true;
                 // We can report all the errors for the intersected range directly
                 for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
                     const auto subresource = image_state.subresource_encoder.Decode(index);
@@ -215,6 +226,9 @@ static bool VerifyImageLayoutRange(const Validator &gpuav, const vvl::CommandBuf
             }
         }
     }
+    if (!layout_mismatch) {
+        subresource_map->SetValidatedGeneration(global_generation);
+    }
     return skip;
 }
 
@@ -241,6 +255,7 @@ static void RecordCmdWaitEvents2(Validator &gpuav, VkCommandBuffer commandBuffer
     for (uint32_t i = 0; i < eventCount; i++) {
         const auto &dep_info = pDependencyInfos[i];
         TransitionImageLayouts(gpuav, *cb_state, dep_info.imageMemoryBarrierCount, dep_info.pImageMemoryBarriers);
+        RecordIndirectDrawBarrier(gpuav, static_cast<CommandBuffer &>(*cb_state), sync_utils::GetGlobalStageMasks(dep_info).dst);
     }
 }
 
@@ -254,7 +269,9 @@ void UpdateCmdBufImageLayouts(Validator &gpuav, const vvl::CommandBuffer &cb_sta
         auto image_state = gpuav.Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id) {
             auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            if (sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater())) {
+                image_state->layout_range_map->Touch();
+            }
         }
     }
 }
@@ -690,6 +707,7 @@ void Validator::PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint32
                                           pImageMemoryBarriers, record_obj);
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     TransitionImageLayouts(*this, *cb_state, imageMemoryBarrierCount, pImageMemoryBarriers, sourceStageMask, dstStageMask);
+    RecordIndirectDrawBarrier(*this, static_cast<CommandBuffer &>(*cb_state), dstStageMask);
 }
 
 void Validator::PreCallRecordCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
@@ -717,6 +735,7 @@ void Validator::PreCallRecordCmdPipelineBarrier(VkCommandBuffer commandBuffer, V
 
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     TransitionImageLayouts(*this, *cb_state, imageMemoryBarrierCount, pImageMemoryBarriers, srcStageMask, dstStageMask);
+    RecordIndirectDrawBarrier(*this, static_cast<CommandBuffer &>(*cb_state), dstStageMask);
 }
 
 void Validator::PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR *pDependencyInfo,
@@ -725,6 +744,8 @@ void Validator::PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffe
 
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     TransitionImageLayouts(*this, *cb_state, pDependencyInfo->imageMemoryBarrierCount, pDependencyInfo->pImageMemoryBarriers);
+    RecordIndirectDrawBarrier(*this, static_cast<CommandBuffer &>(*cb_state),
+                              sync_utils::GetGlobalStageMasks(*pDependencyInfo).dst);
 }
 
 void Validator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo,
@@ -733,5 +754,7 @@ void Validator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuffer,
 
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     TransitionImageLayouts(*this, *cb_state, pDependencyInfo->imageMemoryBarrierCount, pDependencyInfo->pImageMemoryBarriers);
+    RecordIndirectDrawBarrier(*this, static_cast<CommandBuffer &>(*cb_state),
+                              sync_utils::GetGlobalStageMasks(*pDependencyInfo).dst);
 }
 }  // namespace gpuav
@@ -446,7 +446,7 @@ void PostCallSetupShaderInstrumentationResources(Validator &gpuav, CommandBuffer
                 for (uint32_t set_i = 0; set_i < disturbed_bindings_count; ++set_i) {
                     const uint32_t last_bound_set_i = set_i + first_disturbed_set;
                     VkDescriptorSet desc_set = last_bound.per_set[last_bound_set_i].bound_descriptor_set->VkHandle();
-                    const std::vector<uint32_t> &dynamic_offset = last_bound.per_set[last_bound_set_i].dynamicOffsets;
+                    const auto &dynamic_offset = last_bound.per_set[last_bound_set_i].dynamicOffsets;
                     const uint32_t dynamic_offset_count = static_cast<uint32_t>(dynamic_offset.size());
                     DispatchCmdBindDescriptorSets(cb_state.VkHandle(), bind_point,
                                                   last_bound_desc_set_pipe_layout_state->VkHandle(), last_bound_set_i, 1, &desc_set,
@@ -778,13 +778,8 @@ bool LogInstrumentationError(Validator &gpuav, VkCommandBuffer cmd_buffer, const
         }
 
         // If we somehow can't find our state, we can still report our error message
-        std::vector<Instruction> instructions;
-        if (instrumented_shader && !instrumented_shader->instrumented_spirv.empty()) {
-            spirv::GenerateInstructions(instrumented_shader->instrumented_spirv, instructions);
-        }
-
         std::string debug_info_message = gpuav.GenerateDebugInfoMessage(
-            cmd_buffer, instructions, error_record[gpuav::glsl::kHeaderStageIdOffset],
+            cmd_buffer, error_record[gpuav::glsl::kHeaderStageIdOffset],
             error_record[gpuav::glsl::kHeaderStageInfoOffset_0], error_record[gpuav::glsl::kHeaderStageInfoOffset_1],
             error_record[gpuav::glsl::kHeaderStageInfoOffset_2], error_record[gpuav::glsl::kHeaderInstructionIdOffset],
             instrumented_shader, shader_id, pipeline_bind_point, operation_index);
@@ -35,22 +35,15 @@
 #include "state_tracker/shader_object_state.h"
 #include "state_tracker/shader_instruction.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <fstream>
 #include <string>
+#include <type_traits>
 
 namespace gpuav {
 
-void SpirvCache::Add(uint32_t hash, std::vector<uint32_t> spirv) { spirv_shaders_.emplace(hash, std::move(spirv)); }
-
-std::vector<uint32_t> *SpirvCache::Get(uint32_t spirv_hash) {
-    auto it = spirv_shaders_.find(spirv_hash);
-    if (it != spirv_shaders_.end()) {
-        return &it->second;
-    }
-    return nullptr;
-}
-
 ReadLockGuard GpuShaderInstrumentor::ReadLock() const {
     if (global_settings.fine_grained_locking) {
         return ReadLockGuard(validation_object_mutex, std::defer_lock);
@@ -139,6 +132,10 @@ void GpuShaderInstrumentor::PostCreateDevice(const VkDeviceCreateInfo *pCreateIn
         Cleanup();
         return;
     }
+
+    if (gpuav_settings.parallel_shader_instrumentation) {
+        shader_instrumentation_pool_ = std::make_unique<vvl::ThreadPool>(vvl::ThreadPool::DefaultThreadCount());
+    }
 }
 
 void GpuShaderInstrumentor::Cleanup() {
@@ -159,6 +156,7 @@ void GpuShaderInstrumentor::Cleanup() {
 
 void GpuShaderInstrumentor::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                                        const RecordObject &record_obj) {
+    shader_instrumentation_pool_.reset();
     Cleanup();
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 }
@@ -307,11 +305,8 @@ void GpuShaderInstrumentor::PreCallRecordShaderObjectInstrumentation(
     bool pass = false;
     std::vector<uint32_t> &instrumented_spirv = instrumentation_data.instrumented_spirv;
     if (gpuav_settings.cache_instrumented_shaders) {
-        unique_shader_id = hash_util::ShaderHash(create_info.pCode, create_info.codeSize);
-        if (const auto spirv = instrumented_shaders_cache_.Get(unique_shader_id)) {
-            instrumented_spirv = *spirv;
-            cached = true;
-        }
+        unique_shader_id = hash_util::ShaderHash128(create_info.pCode, create_info.codeSize).Fold32();
+        cached = instrumented_shaders_cache_.Get(unique_shader_id, instrumented_spirv);
     } else {
         unique_shader_id = unique_shader_module_id_++;
     }
@@ -320,7 +315,7 @@ void GpuShaderInstrumentor::PreCallRecordShaderObjectInstrumentation(
 
     if (!cached) {
         pass = InstrumentShader(
-            vvl::make_span(static_cast<const uint32_t *>(create_info.pCode), create_info.codeSize / sizeof(uint32_t)),
+            vvl::make_span(static_cast<const uint32_t *>(create_info.pCode), create_info.codeSize / sizeof(uint32_t)), nullptr,
             unique_shader_id, has_bindless_descriptors, create_info_loc, instrumented_spirv);
     }
 
@@ -414,6 +409,7 @@ void GpuShaderInstrumentor::PreCallRecordDestroyShaderEXT(VkDevice device, VkSha
         instrumented_shaders_map_.snapshot([shader](const InstrumentedShader &entry) { return entry.shader_object == shader; });
     for (const auto &entry : to_erase) {
         instrumented_shaders_map_.erase(entry.first);
+        printf_format_strings_map_.erase(entry.first);
     }
     BaseClass::PreCallRecordDestroyShaderEXT(device, shader, pAllocator, record_obj);
 }
@@ -430,6 +426,7 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    ShaderInstrumentationBatch batch;
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
 
@@ -441,17 +438,25 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
             continue;
         }
 
+        if (gpuav_settings.lazy_shader_instrumentation && pipeline_state->linking_shaders == 0 &&
+            !(pipeline_state->create_flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR)) {
+            // Created on first bind in GetLazyInstrumentedPipeline()
+            pipeline_state->instrumentation_data.lazy_instrumentation = true;
+            continue;
+        }
+
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
         if (pipeline_state->linking_shaders != 0) {
             PreCallRecordPipelineCreationShaderInstrumentationGPL(pAllocator, *pipeline_state, new_pipeline_ci, create_info_loc,
-                                                                  shader_instrumentation_metadata);
+                                                                  shader_instrumentation_metadata, batch);
         } else {
             PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, create_info_loc,
-                                                               shader_instrumentation_metadata);
+                                                               shader_instrumentation_metadata, batch);
         }
     }
+    InstrumentShaders(batch);
 
     chassis_state.pCreateInfos = reinterpret_cast<VkGraphicsPipelineCreateInfo *>(chassis_state.modified_create_infos.data());
 }
@@ -468,6 +473,7 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    ShaderInstrumentationBatch batch;
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
 
@@ -479,12 +485,19 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
             continue;
         }
 
+        if (gpuav_settings.lazy_shader_instrumentation) {
+            // Created on first bind in GetLazyInstrumentedPipeline()
+            pipeline_state->instrumentation_data.lazy_instrumentation = true;
+            continue;
+        }
+
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
         PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, create_info_loc,
-                                                           shader_instrumentation_metadata);
+                                                           shader_instrumentation_metadata, batch);
     }
+    InstrumentShaders(batch);
 
     chassis_state.pCreateInfos = reinterpret_cast<VkComputePipelineCreateInfo *>(chassis_state.modified_create_infos.data());
 }
@@ -502,6 +515,7 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesNV(VkDevice de
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    ShaderInstrumentationBatch batch;
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
 
@@ -517,8 +531,9 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesNV(VkDevice de
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
         PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, create_info_loc,
-                                                           shader_instrumentation_metadata);
+                                                           shader_instrumentation_metadata, batch);
     }
+    InstrumentShaders(batch);
 
     chassis_state.pCreateInfos = reinterpret_cast<VkRayTracingPipelineCreateInfoNV *>(chassis_state.modified_create_infos.data());
 }
@@ -534,6 +549,7 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    ShaderInstrumentationBatch batch;
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
 
@@ -549,8 +565,9 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
         PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, create_info_loc,
-                                                           shader_instrumentation_metadata);
+                                                           shader_instrumentation_metadata, batch);
     }
+    InstrumentShaders(batch);
 
     chassis_state.pCreateInfos = reinterpret_cast<VkRayTracingPipelineCreateInfoKHR *>(chassis_state.modified_create_infos.data());
 }
@@ -695,6 +712,7 @@ void GpuShaderInstrumentor::PreCallRecordDestroyPipeline(VkDevice device, VkPipe
         instrumented_shaders_map_.snapshot([pipeline](const InstrumentedShader &entry) { return entry.pipeline == pipeline; });
     for (const auto &entry : to_erase) {
         instrumented_shaders_map_.erase(entry.first);
+        printf_format_strings_map_.erase(entry.first);
     }
 
     if (auto pipeline_state = Get<vvl::Pipeline>(pipeline)) {
@@ -707,6 +725,10 @@ void GpuShaderInstrumentor::PreCallRecordDestroyPipeline(VkDevice device, VkPipe
         if (pipeline_state->instrumentation_data.frag_out_lib != VK_NULL_HANDLE) {
             DispatchDestroyPipeline(device, pipeline_state->instrumentation_data.frag_out_lib, pAllocator);
         }
+        if (pipeline_state->instrumentation_data.lazy_instrumented_pipeline != VK_NULL_HANDLE) {
+            // Created by GetLazyInstrumentedPipeline() without the user allocator
+            DispatchDestroyPipeline(device, pipeline_state->instrumentation_data.lazy_instrumented_pipeline, nullptr);
+        }
     }
 
     BaseClass::PreCallRecordDestroyPipeline(device, pipeline, pAllocator, record_obj);
@@ -780,7 +802,8 @@ bool GpuShaderInstrumentor::NeedPipelineCreationShaderInstrumentation(vvl::Pipel
 
     // If the app requests all available sets, the pipeline layout was not modified at pipeline layout creation and the
     // already instrumented shaders need to be replaced with uninstrumented shaders
-    if (pipeline_state.active_slots.find(instrumentation_desc_set_bind_index_) != pipeline_state.active_slots.end()) {
+    const ActiveSlotMap &active_slots = pipeline_state.ActiveSlots();
+    if (active_slots.find(instrumentation_desc_set_bind_index_) != active_slots.end()) {
         return false;
     }
     const auto pipeline_layout = pipeline_state.PipelineLayoutState();
@@ -822,6 +845,78 @@ bool GpuShaderInstrumentor::HasBindlessDescriptors(VkShaderCreateInfoEXT &create
     return false;
 }
 
+void GpuShaderInstrumentor::AddShaderToBatch(
+    ShaderInstrumentationBatch &batch, const std::shared_ptr<const vvl::ShaderModule> &module_state, bool has_bindless_descriptors,
+    const Location &loc, std::function<void(uint32_t unique_shader_id, const std::vector<uint32_t> &instrumented_spirv)> &&apply) {
+    ShaderInstrumentationBatch::Shader shader{module_state, 0, has_bindless_descriptors, loc, false, false, {}, std::move(apply)};
+    if (gpuav_settings.cache_instrumented_shaders) {
+        // Same id as a shader object of the same code, without hashing it again
+        shader.unique_shader_id = module_state->spirv->hash_.Fold32();
+        shader.cached = instrumented_shaders_cache_.Get(shader.unique_shader_id, shader.instrumented_spirv);
+    } else {
+        shader.unique_shader_id = unique_shader_module_id_++;
+    }
+    batch.shaders.emplace_back(std::move(shader));
+}
+
+void GpuShaderInstrumentor::InstrumentShaders(ShaderInstrumentationBatch &batch) {
+    // With the cache the id is the hash of the SPIR-V, so a shader used by several stages of the batch is instrumented once
+    std::vector<size_t> result_index(batch.shaders.size());
+    std::vector<size_t> to_instrument;
+    vvl::unordered_map<uint32_t, size_t> first_uncached;
+    for (size_t i = 0; i < batch.shaders.size(); ++i) {
+        result_index[i] = i;
+        const auto &shader = batch.shaders[i];
+        if (shader.cached) continue;
+        if (gpuav_settings.cache_instrumented_shaders) {
+            const auto [it, inserted] = first_uncached.emplace(shader.unique_shader_id, i);
+            if (!inserted) {
+                result_index[i] = it->second;
+                continue;
+            }
+        }
+        to_instrument.emplace_back(i);
+    }
+
+    // Each task only touches its own Shader, the create infos are not modified until all of them are done
+    auto instrument = [this, &batch](size_t i) {
+        auto &shader = batch.shaders[i];
+        const ::spirv::Module &spirv = *shader.module_state->spirv;
+        shader.pass = InstrumentShader(spirv.words_, &spirv, shader.unique_shader_id, shader.has_bindless_descriptors, shader.loc,
+                                       shader.instrumented_spirv, &shader.internal_error);
+    };
+    if (shader_instrumentation_pool_ && to_instrument.size() > 1) {
+        vvl::TaskGroup tasks(*shader_instrumentation_pool_);
+        for (const size_t i : to_instrument) {
+            tasks.Post([&instrument, i]() { instrument(i); });
+        }
+        tasks.Wait();
+    } else {
+        for (const size_t i : to_instrument) {
+            instrument(i);
+        }
+    }
+    for (const size_t i : to_instrument) {
+        const auto &shader = batch.shaders[i];
+        if (!shader.internal_error.empty()) {
+            InternalError(device, shader.loc, shader.internal_error.c_str());
+        }
+    }
+
+    for (size_t i = 0; i < batch.shaders.size(); ++i) {
+        auto &shader = batch.shaders[i];
+        const auto &result = batch.shaders[result_index[i]];
+        if (!result.cached && !result.pass) continue;
+        shader.apply(shader.unique_shader_id, result.instrumented_spirv);
+        if (gpuav_settings.cache_instrumented_shaders && !shader.cached && result_index[i] == i) {
+            instrumented_shaders_cache_.Add(shader.unique_shader_id, shader.instrumented_spirv);
+        }
+    }
+    for (auto &finalize : batch.finalizers) {
+        finalize();
+    }
+}
+
 // Instrument all SPIR-V that is sent through pipeline. This can be done in various ways
 // 1. VkCreateShaderModule and passed in VkShaderModule.
 //    For this we create our own VkShaderModule with instrumented shader and manage it inside the pipeline state
@@ -836,7 +931,7 @@ bool GpuShaderInstrumentor::HasBindlessDescriptors(VkShaderCreateInfoEXT &create
 template <typename SafeCreateInfo>
 void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
     const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, SafeCreateInfo &new_pipeline_ci, const Location &loc,
-    std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata) {
+    std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata, ShaderInstrumentationBatch &batch) {
     // Init here instead of in chassis so we don't pay cost when GPU-AV is not used
     const size_t total_stages = pipeline_state.stage_states.size();
     shader_instrumentation_metadata.resize(total_stages);
@@ -867,27 +962,12 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
             }
         }
 
-        uint32_t unique_shader_id = 0;
-        bool cached = false;
-        bool pass = false;
-        std::vector<uint32_t> instrumented_spirv;
-        if (gpuav_settings.cache_instrumented_shaders) {
-            unique_shader_id =
-                hash_util::ShaderHash(module_state->spirv->words_.data(), module_state->spirv->words_.size() * sizeof(uint32_t));
-            if (const auto spirv = instrumented_shaders_cache_.Get(unique_shader_id)) {
-                instrumented_spirv = *spirv;
-                cached = true;
-            }
-        } else {
-            unique_shader_id = unique_shader_module_id_++;
-        }
-        if (!cached) {
-            pass =
-                InstrumentShader(module_state->spirv->words_, unique_shader_id, has_bindless_descriptors, loc, instrumented_spirv);
-        }
-        if (cached || pass) {
+        // The stage is written back once the whole batch is instrumented, everything captured by reference lives in the
+        // pipeline state or in the chassis state until then
+        auto apply = [this, pAllocator, &pipeline_state, &new_pipeline_ci, &stage_state, &instrumentation_metadata, sm_ci, loc, i](
+                         uint32_t unique_shader_id, const std::vector<uint32_t> &instrumented_spirv) {
             instrumentation_metadata.unique_shader_id = unique_shader_id;
-            if (module_state->VkHandle() != VK_NULL_HANDLE) {
+            if (stage_state.module_state->VkHandle() != VK_NULL_HANDLE) {
                 // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
                 // shader
                 VkShaderModule instrumented_shader_module;
@@ -913,12 +993,109 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
             } else {
                 assert(false);
             }
+        };
+        AddShaderToBatch(batch, module_state, has_bindless_descriptors, loc, std::move(apply));
+    }
+}
 
-            if (gpuav_settings.cache_instrumented_shaders && !cached) {
-                instrumented_shaders_cache_.Add(unique_shader_id, instrumented_spirv);
-            }
+VkPipeline GpuShaderInstrumentor::GetLazyInstrumentedPipeline(vvl::Pipeline &pipeline_state, const Location &loc) {
+    auto &instrumentation_data = pipeline_state.instrumentation_data;
+    if (!instrumentation_data.lazy_instrumentation) return VK_NULL_HANDLE;
+
+    // The same pipeline can be bound in several command buffers at once
+    std::lock_guard<std::mutex> guard(lazy_instrumentation_lock_);
+    if (instrumentation_data.lazy_instrumentation_done) return instrumentation_data.lazy_instrumented_pipeline;
+    instrumentation_data.lazy_instrumentation_done = true;
+
+    // The app is allowed to destroy these once the pipeline is created, the original pipeline keeps working but a new one
+    // can't be made from them anymore
+    const auto layout_state = pipeline_state.PipelineLayoutState();
+    const auto rp_state = pipeline_state.RenderPassState();
+    if ((layout_state && layout_state->Destroyed()) || (rp_state && rp_state->Destroyed())) {
+        InternalWarning(pipeline_state.Handle(), loc,
+                        "The pipeline layout or render pass of the pipeline was destroyed before its first bind, the pipeline "
+                        "can't be instrumented and will not be validated.");
+        return VK_NULL_HANDLE;
+    }
+
+    // The original pipeline was created with the whole create info array, only this element is recreated here
+    const VkPipelineCreateFlags dropped_flags = VK_PIPELINE_CREATE_DERIVATIVE_BIT |
+                                                VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT |
+                                                VK_PIPELINE_CREATE_EARLY_RETURN_ON_FAILURE_BIT;
+    std::vector<chassis::ShaderInstrumentationMetadata> shader_instrumentation_metadata;
+    ShaderInstrumentationBatch batch;
+    VkPipeline instrumented_pipeline = VK_NULL_HANDLE;
+    VkResult result = VK_ERROR_UNKNOWN;
+
+    // The stages that were not instrumented (not selected, or the pass failed) still point at the shader modules of the app,
+    // which may be destroyed by now. They get a copy made from the SPIR-V of the module state, destroyed once the pipeline
+    // is created.
+    std::vector<VkShaderModule> module_copies;
+    const auto copy_app_shader_modules = [this, &pipeline_state, &module_copies](auto &new_pipeline_ci) {
+        for (const auto &stage_state : pipeline_state.stage_states) {
+            const auto &module_state = stage_state.module_state;
+            if (!module_state || module_state->VkHandle() == VK_NULL_HANDLE) continue;
+            auto &stage_ci = GetShaderStageCI<std::remove_reference_t<decltype(new_pipeline_ci)>,
+                                              vku::safe_VkPipelineShaderStageCreateInfo>(new_pipeline_ci, stage_state.GetStage());
+            if (stage_ci.module != module_state->VkHandle()) continue;
+            if (!module_state->spirv) return false;
+            VkShaderModuleCreateInfo create_info = vku::InitStructHelper();
+            create_info.pCode = module_state->spirv->words_.data();
+            create_info.codeSize = module_state->spirv->words_.size() * sizeof(uint32_t);
+            VkShaderModule module_copy = VK_NULL_HANDLE;
+            if (DispatchCreateShaderModule(device, &create_info, nullptr, &module_copy) != VK_SUCCESS) return false;
+            module_copies.emplace_back(module_copy);
+            stage_ci.module = module_copy;
         }
+        return true;
+    };
+    bool modules_copied = true;
+
+    if (pipeline_state.pipeline_type == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+        vku::safe_VkGraphicsPipelineCreateInfo new_pipeline_ci(pipeline_state.GraphicsCreateInfo());
+        new_pipeline_ci.flags &= ~dropped_flags;
+        new_pipeline_ci.basePipelineHandle = VK_NULL_HANDLE;
+        new_pipeline_ci.basePipelineIndex = -1;
+        PreCallRecordPipelineCreationShaderInstrumentation(nullptr, pipeline_state, new_pipeline_ci, loc,
+                                                           shader_instrumentation_metadata, batch);
+        InstrumentShaders(batch);
+        modules_copied = copy_app_shader_modules(new_pipeline_ci);
+        if (modules_copied) {
+            result =
+                DispatchCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, new_pipeline_ci.ptr(), nullptr, &instrumented_pipeline);
+        }
+    } else if (pipeline_state.pipeline_type == VK_PIPELINE_BIND_POINT_COMPUTE) {
+        vku::safe_VkComputePipelineCreateInfo new_pipeline_ci(pipeline_state.ComputeCreateInfo());
+        new_pipeline_ci.flags &= ~dropped_flags;
+        new_pipeline_ci.basePipelineHandle = VK_NULL_HANDLE;
+        new_pipeline_ci.basePipelineIndex = -1;
+        PreCallRecordPipelineCreationShaderInstrumentation(nullptr, pipeline_state, new_pipeline_ci, loc,
+                                                           shader_instrumentation_metadata, batch);
+        InstrumentShaders(batch);
+        modules_copied = copy_app_shader_modules(new_pipeline_ci);
+        if (modules_copied) {
+            result =
+                DispatchCreateComputePipelines(device, VK_NULL_HANDLE, 1, new_pipeline_ci.ptr(), nullptr, &instrumented_pipeline);
+        }
+    }
+    for (VkShaderModule module_copy : module_copies) {
+        DispatchDestroyShaderModule(device, module_copy, nullptr);
+    }
+
+    if (!modules_copied) {
+        InternalWarning(pipeline_state.Handle(), loc,
+                        "A shader module of the pipeline could not be copied on its first bind, the pipeline can't be "
+                        "instrumented and will not be validated.");
+        return VK_NULL_HANDLE;
     }
+    if (result != VK_SUCCESS) {
+        InternalWarning(pipeline_state.Handle(), loc,
+                        "Unable to create the instrumented pipeline on first bind, the pipeline will not be validated.");
+        return VK_NULL_HANDLE;
+    }
+    instrumentation_data.lazy_instrumented_pipeline = instrumented_pipeline;
+    PostCallRecordPipelineCreationShaderInstrumentation(pipeline_state, shader_instrumentation_metadata);
+    return instrumented_pipeline;
 }
 
 // Now that we have created the pipeline (and have its handle) build up the shader map for each shader we instrumented
@@ -962,7 +1139,8 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreationShaderInstrumentation(
 // doesn't fit in the "all pipeline" templated flow.
 void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGPL(
     const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, vku::safe_VkGraphicsPipelineCreateInfo &new_pipeline_ci,
-    const Location &loc, std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata) {
+    const Location &loc, std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata,
+    ShaderInstrumentationBatch &batch) {
     // Init here instead of in chassis so we don't pay cost when GPU-AV is not used
     const size_t total_stages = pipeline_state.stage_states.size();
     shader_instrumentation_metadata.resize(total_stages);
@@ -981,7 +1159,8 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
         if (!lib) continue;
         if (lib->stage_states.empty()) continue;
 
-        vku::safe_VkGraphicsPipelineCreateInfo new_lib_pipeline_ci(lib->GraphicsCreateInfo());
+        // Shared with the batch, the library is only created once all of its stages are instrumented
+        auto new_lib_pipeline_ci = std::make_shared<vku::safe_VkGraphicsPipelineCreateInfo>(lib->GraphicsCreateInfo());
 
         for (uint32_t stage_state_i = 0; stage_state_i < static_cast<uint32_t>(lib->stage_states.size()); ++stage_state_i) {
             const auto &stage_state = lib->stage_states[stage_state_i];
@@ -993,9 +1172,9 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
 
             vku::safe_VkPipelineShaderStageCreateInfo *stage_ci = nullptr;
             // Check pNext for inlined SPIR-V
-            for (uint32_t i = 0; i < new_lib_pipeline_ci.stageCount; ++i) {
-                if (new_lib_pipeline_ci.pStages[i].stage == stage) {
-                    stage_ci = &new_lib_pipeline_ci.pStages[i];
+            for (uint32_t i = 0; i < new_lib_pipeline_ci->stageCount; ++i) {
+                if (new_lib_pipeline_ci->pStages[i].stage == stage) {
+                    stage_ci = &new_lib_pipeline_ci->pStages[i];
                 }
             }
 
@@ -1012,27 +1191,10 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
                 }
             }
 
-            uint32_t unique_shader_id = 0;
-            bool cached = false;
-            bool pass = false;
-            std::vector<uint32_t> instrumented_spirv;
-            if (gpuav_settings.cache_instrumented_shaders) {
-                unique_shader_id = hash_util::ShaderHash(module_state->spirv->words_.data(),
-                                                         module_state->spirv->words_.size() * sizeof(uint32_t));
-                if (const auto spirv = instrumented_shaders_cache_.Get(unique_shader_id)) {
-                    instrumented_spirv = *spirv;
-                    cached = true;
-                }
-            } else {
-                unique_shader_id = unique_shader_module_id_++;
-            }
-            if (!cached) {
-                pass = InstrumentShader(module_state->spirv->words_, unique_shader_id, has_bindless_descriptors, loc,
-                                        instrumented_spirv);
-            }
-            if (cached || pass) {
+            auto apply = [this, pAllocator, lib, new_lib_pipeline_ci, &stage_state, &instrumentation_metadata, sm_ci, loc,
+                          stage_state_i](uint32_t unique_shader_id, const std::vector<uint32_t> &instrumented_spirv) {
                 instrumentation_metadata.unique_shader_id = unique_shader_id;
-                if (module_state->VkHandle() != VK_NULL_HANDLE) {
+                if (stage_state.module_state->VkHandle() != VK_NULL_HANDLE) {
                     // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
                     // shader
                     VkShaderModule instrumented_shader_module;
@@ -1041,7 +1203,7 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
                     create_info.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
                     VkResult result = DispatchCreateShaderModule(device, &create_info, pAllocator, &instrumented_shader_module);
                     if (result == VK_SUCCESS) {
-                        SetShaderModule(new_lib_pipeline_ci, *stage_state.pipeline_create_info, instrumented_shader_module,
+                        SetShaderModule(*new_lib_pipeline_ci, *stage_state.pipeline_create_info, instrumented_shader_module,
                                         stage_state_i);
                         lib->instrumentation_data.instrumented_shader_module.emplace_back(instrumented_shader_module);
                     } else {
@@ -1059,23 +1221,23 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
                 } else {
                     assert(false);
                 }
-
-                if (gpuav_settings.cache_instrumented_shaders && !cached) {
-                    instrumented_shaders_cache_.Add(unique_shader_id, instrumented_spirv);
-                }
-            }
+            };
+            AddShaderToBatch(batch, module_state, has_bindless_descriptors, loc, std::move(apply));
         }
 
-        VkPipeline new_lib_pipeline;
-        DispatchCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, new_lib_pipeline_ci.ptr(), pAllocator, &new_lib_pipeline);
+        auto create_library = [this, pAllocator, &pipeline_state, lib, new_lib_pipeline_ci, library_create_info, library_i]() {
+            VkPipeline new_lib_pipeline;
+            DispatchCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, new_lib_pipeline_ci->ptr(), pAllocator, &new_lib_pipeline);
 
-        if (lib->active_shaders & VK_SHADER_STAGE_FRAGMENT_BIT) {
-            pipeline_state.instrumentation_data.frag_out_lib = new_lib_pipeline;
-        } else {
-            pipeline_state.instrumentation_data.pre_raster_lib = new_lib_pipeline;
-        }
+            if (lib->active_shaders & VK_SHADER_STAGE_FRAGMENT_BIT) {
+                pipeline_state.instrumentation_data.frag_out_lib = new_lib_pipeline;
+            } else {
+                pipeline_state.instrumentation_data.pre_raster_lib = new_lib_pipeline;
+            }
 
-        const_cast<VkPipeline *>(library_create_info->pLibraries)[library_i] = new_lib_pipeline;
+            const_cast<VkPipeline *>(library_create_info->pLibraries)[library_i] = new_lib_pipeline;
+        };
+        batch.finalizers.emplace_back(std::move(create_library));
     }
 }
 
@@ -1126,24 +1288,49 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreationShaderInstrumentationG
 
 static bool GpuValidateShader(const std::vector<uint32_t> &input, bool SetRelaxBlockLayout, bool SetScalarBlockLayout,
                               spv_target_env target_env, std::string &error) {
+    // Options of the calling thread, one for each combination of the two layouts
+    struct ThreadOptions {
+        ThreadOptions() {
+            for (uint32_t i = 0; i < options.size(); ++i) {
+                options[i] = spvValidatorOptionsCreate();
+                spvValidatorOptionsSetRelaxBlockLayout(options[i], (i & 1) != 0);
+                spvValidatorOptionsSetScalarBlockLayout(options[i], (i & 2) != 0);
+            }
+        }
+        ~ThreadOptions() {
+            for (spv_validator_options option : options) {
+                spvValidatorOptionsDestroy(option);
+            }
+        }
+        std::array<spv_validator_options, 4> options;
+    };
+    thread_local ThreadOptions thread_options;
+
     // Use SPIRV-Tools validator to try and catch any issues with the module
-    spv_context ctx = spvContextCreate(target_env);
+    spv_const_context ctx = GetThreadSpirvContext(target_env);
     spv_const_binary_t binary{input.data(), input.size()};
     spv_diagnostic diag = nullptr;
-    spv_validator_options options = spvValidatorOptionsCreate();
-    spvValidatorOptionsSetRelaxBlockLayout(options, SetRelaxBlockLayout);
-    spvValidatorOptionsSetScalarBlockLayout(options, SetScalarBlockLayout);
-    spv_result_t result = spvValidateWithOptions(ctx, options, &binary, &diag);
+    const uint32_t options_index = (SetRelaxBlockLayout ? 1u : 0u) | (SetScalarBlockLayout ? 2u : 0u);
+    spv_result_t result = spvValidateWithOptions(ctx, thread_options.options[options_index], &binary, &diag);
     if (result != SPV_SUCCESS && diag) error = diag->error;
+    spvDiagnosticDestroy(diag);
     return (result == SPV_SUCCESS);
 }
 
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
-bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
-                                             bool has_bindless_descriptors, const Location &loc,
-                                             std::vector<uint32_t> &out_instrumented_spirv) {
+bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &input_spirv, const ::spirv::Module *parsed_module,
+                                             uint32_t unique_shader_id, bool has_bindless_descriptors, const Location &loc,
+                                             std::vector<uint32_t> &out_instrumented_spirv, std::string *out_internal_error) {
     if (input_spirv[0] != spv::MagicNumber) return false;
 
+    auto internal_error = [this, &loc, out_internal_error](const char *message) {
+        if (out_internal_error) {
+            *out_internal_error = message;
+        } else {
+            InternalError(device, loc, message);
+        }
+    };
+
     if (gpuav_settings.debug_dump_instrumented_shaders) {
         std::string file_name = "dump_" + std::to_string(unique_shader_id) + "_before.spv";
         std::ofstream debug_file(file_name, std::ios::out | std::ios::binary);
@@ -1161,25 +1348,34 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
     module_settings.support_int64 = enabled_features.shaderInt64;
     module_settings.support_memory_model_device_scope = enabled_features.vulkanMemoryModelDeviceScope;
     module_settings.has_bindless_descriptors = has_bindless_descriptors;
-
-    spirv::Module module(input_spirv, debug_report, module_settings);
+    module_settings.inline_fast_path_checks = gpuav_settings.shader_instrumentation.inline_fast_path_checks;
+
+    // The state tracker already split the binary into instructions, reuse that instead of decoding every word again
+    std::vector<spirv::ParsedInstruction> parsed_instructions;
+    if (parsed_module && parsed_module->valid_spirv) {
+        const std::vector<::spirv::Instruction> &instructions = parsed_module->GetInstructions();
+        parsed_instructions.reserve(instructions.size());
+        for (const ::spirv::Instruction &insn : instructions) {
+            parsed_instructions.emplace_back(spirv::ParsedInstruction{insn.Words(), insn.ResultIdIndex(), insn.TypeIdIndex()});
+        }
+    }
+    spirv::Module module = parsed_instructions.empty()
+                               ? spirv::Module(input_spirv, debug_report, module_settings)
+                               : spirv::Module(input_spirv, parsed_instructions, debug_report, module_settings);
 
     bool modified = false;
 
+    // All the function injection passes share a single walk over the module
+    spirv::FusedPassSelection fused_passes;
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
     if (gpuav_settings.shader_instrumentation.bindless_descriptor) {
-        modified |= module.RunPassBindlessDescriptor();
-        modified |= module.RunPassNonBindlessOOBBuffer();
-        modified |= module.RunPassNonBindlessOOBTexelBuffer();
-    }
-
-    if (gpuav_settings.shader_instrumentation.buffer_device_address) {
-        modified |= module.RunPassBufferDeviceAddress();
-    }
-
-    if (gpuav_settings.shader_instrumentation.ray_query) {
-        modified |= module.RunPassRayQuery();
+        fused_passes.bindless_descriptor = true;
+        fused_passes.non_bindless_oob_buffer = true;
+        fused_passes.non_bindless_oob_texel_buffer = true;
     }
+    fused_passes.buffer_device_address = gpuav_settings.shader_instrumentation.buffer_device_address;
+    fused_passes.ray_query = gpuav_settings.shader_instrumentation.ray_query;
+    modified |= module.RunFusedPasses(fused_passes);
 
     // Post Process instrumentation passes assume the things inside are valid, but putting at the end, things above will wrap checks
     // in a if/else, this means they will be gaurded as if they were inside the above passes
@@ -1225,7 +1421,7 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
             std::ostringstream strm;
             strm << "Instrumented shader (id " << unique_shader_id << ") is invalid, spirv-val error:\n"
                  << instrumented_error << " Proceeding with non instrumented shader.";
-            InternalError(device, loc, strm.str().c_str());
+            internal_error(strm.str().c_str());
             return false;
         }
     }
@@ -1256,8 +1452,7 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
         // Call CreateAggressiveDCEPass with preserve_interface == true
         dce_pass.RegisterPass(CreateAggressiveDCEPass(true));
         if (!dce_pass.Run(out_instrumented_spirv.data(), out_instrumented_spirv.size(), &out_instrumented_spirv, opt_options)) {
-            InternalError(device, loc,
-                          "Failure to run spirv-opt DCE on instrumented shader. Proceeding with non-instrumented shader.");
+            internal_error("Failure to run spirv-opt DCE on instrumented shader. Proceeding with non-instrumented shader.");
             return false;
         }
 
@@ -1272,7 +1467,15 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
     return true;
 }
 
+thread_local std::optional<GpuShaderInstrumentor::DeferredInternalError> *GpuShaderInstrumentor::deferred_internal_error = nullptr;
+
 void GpuShaderInstrumentor::InternalError(LogObjectList objlist, const Location &loc, const char *const specific_message) const {
+    if (deferred_internal_error) {
+        if (!deferred_internal_error->has_value()) {
+            *deferred_internal_error = DeferredInternalError{false, std::move(objlist), specific_message};
+        }
+        return;
+    }
     aborted_ = true;
     std::string error_message = specific_message;
 
@@ -1292,11 +1495,8 @@ void GpuShaderInstrumentor::InternalWarning(LogObjectList objlist, const Locatio
     LogWarning(vuid, objlist, loc, "Internal Warning: %s", specific_message);
 }
 
-// The lock (debug_output_mutex) is held by the caller,
-// because the latter has code paths that make multiple calls of this function,
-// and all such calls have to access the same debug reporting state to ensure consistency of output information.
-static std::string LookupDebugUtilsNameNoLock(const DebugReport *debug_report, const uint64_t object) {
-    auto object_label = debug_report->GetUtilsObjectNameNoLock(object);
+static std::string LookupDebugUtilsName(const DebugReport *debug_report, const uint64_t object) {
+    auto object_label = debug_report->GetUtilsObjectName(object);
     if (object_label != "") {
         object_label = "(" + object_label + ")";
     }
@@ -1399,16 +1599,15 @@ static void GenerateStageMessage(std::ostringstream &ss, uint32_t stage_id, uint
 // There are 2 ways to inject source into a shader:
 // 1. The "old" way using OpLine/OpSource
 // 2. The "new" way using NonSemantic Shader DebugInfo
-static std::string FindShaderSource(std::ostringstream &ss, const std::vector<Instruction> &instructions,
-                                    uint32_t instruction_position, bool debug_printf_only) {
-    ss << "SPIR-V Instruction Index = " << instruction_position << '\n';
+ShaderDebugInfo::ShaderDebugInfo(const std::vector<uint32_t> &spirv) : instrumented_spirv(spirv) {
+    ::spirv::GenerateInstructions(instrumented_spirv, instructions);
 
-    // Find the OpLine/DebugLine just before the failing instruction indicated by the debug info.
+    // Record where the OpLine/DebugLine in effect changes, so finding the one before an instruction is a binary search.
     // SPIR-V can only be iterated in the forward direction due to its opcode/length encoding.
-    uint32_t index = 0;
     uint32_t shader_debug_info_set_id = 0;
-    const Instruction *last_line_inst = nullptr;
-    for (const auto &insn : instructions) {
+    uint32_t last_line = kNoLine;
+    for (uint32_t index = 0; index < static_cast<uint32_t>(instructions.size()); index++) {
+        const Instruction &insn = instructions[index];
         const uint32_t opcode = insn.Opcode();
         if (opcode == spv::OpExtInstImport) {
             if (strcmp(insn.GetAsString(2), "NonSemantic.Shader.DebugInfo.100") == 0) {
@@ -1416,24 +1615,64 @@ static std::string FindShaderSource(std::ostringstream &ss, const std::vector<In
             }
         }
 
+        uint32_t line = last_line;
         if (opcode == spv::OpExtInst && insn.Word(3) == shader_debug_info_set_id &&
             insn.Word(4) == NonSemanticShaderDebugInfo100DebugLine) {
-            last_line_inst = &insn;
+            line = index;
         } else if (opcode == spv::OpLine) {
-            last_line_inst = &insn;
+            line = index;
         } else if (opcode == spv::OpFunctionEnd) {
-            last_line_inst = nullptr;  // debug lines can't cross functions boundaries
+            line = kNoLine;  // debug lines can't cross functions boundaries
         }
-
-        if (index == instruction_position) {
-            break;
+        if (line != last_line) {
+            line_changes_.emplace_back(index, line);
+            last_line = line;
         }
-        index++;
     }
+}
+
+uint32_t ShaderDebugInfo::FindLine(uint32_t instruction_position) const {
+    // Positions past the end see the line in effect after the last instruction
+    const auto before = [](uint32_t position, const std::pair<uint32_t, uint32_t> &change) { return position < change.first; };
+    auto it = std::upper_bound(line_changes_.begin(), line_changes_.end(), instruction_position, before);
+    return it == line_changes_.begin() ? kNoLine : std::prev(it)->second;
+}
+
+std::string ShaderDebugInfo::GetSourceInfo(uint32_t line_index) const {
+    std::lock_guard<std::mutex> guard(source_info_lock_);
+    auto [it, inserted] = source_info_.try_emplace(line_index);
+    if (inserted) {
+        std::ostringstream ss;
+        GetShaderSourceInfo(ss, instructions, instructions[line_index]);
+        it->second = ss.str();
+    }
+    return it->second;
+}
 
-    if (last_line_inst) {
+std::shared_ptr<const ShaderDebugInfo> GpuShaderInstrumentor::GetShaderDebugInfo(
+    uint32_t shader_id, const InstrumentedShader &instrumented_shader) const {
+    auto cached = shader_debug_info_map_.find(shader_id);
+    if (cached != shader_debug_info_map_.end()) {
+        return cached->second;
+    }
+    if (instrumented_shader.instrumented_spirv.empty()) {
+        return nullptr;
+    }
+
+    auto debug_info = std::make_shared<const ShaderDebugInfo>(instrumented_shader.instrumented_spirv);
+    shader_debug_info_map_.insert(shader_id, debug_info);
+    return debug_info;
+}
+
+static std::string FindShaderSource(std::ostringstream &ss, const ShaderDebugInfo &debug_info, uint32_t instruction_position,
+                                    bool debug_printf_only) {
+    ss << "SPIR-V Instruction Index = " << instruction_position << '\n';
+
+    // Find the OpLine/DebugLine just before the failing instruction indicated by the debug info.
+    const uint32_t line_index = debug_info.FindLine(instruction_position);
+    if (line_index != ShaderDebugInfo::kNoLine) {
         ss << (debug_printf_only ? "Debug shader printf message generated " : "Shader validation error occurred ");
-        GetShaderSourceInfo(ss, instructions, *last_line_inst);
+        ss << debug_info.GetSourceInfo(line_index);
     } else {
         ss << "Unable to source. Build shader with debug info to get source information.\n";
     }
@@ -1442,28 +1681,30 @@ static std::string FindShaderSource(std::ostringstream &ss, const std::vector<In
 }
 
 // Where we build up the error message with all the useful debug information about where the error occured
-std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(
-    VkCommandBuffer commandBuffer, const std::vector<Instruction> &instructions, uint32_t stage_id, uint32_t stage_info_0,
-    uint32_t stage_info_1, uint32_t stage_info_2, uint32_t instruction_position, const InstrumentedShader *instrumented_shader,
-    uint32_t shader_id, VkPipelineBindPoint pipeline_bind_point, uint32_t operation_index) const {
+std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(VkCommandBuffer commandBuffer, uint32_t stage_id, uint32_t stage_info_0,
+                                                            uint32_t stage_info_1, uint32_t stage_info_2,
+                                                            uint32_t instruction_position,
+                                                            const InstrumentedShader *instrumented_shader, uint32_t shader_id,
+                                                            VkPipelineBindPoint pipeline_bind_point,
+                                                            uint32_t operation_index) const {
     std::ostringstream ss;
-    if (instructions.empty() || !instrumented_shader) {
+    const std::shared_ptr<const ShaderDebugInfo> debug_info =
+        instrumented_shader ? GetShaderDebugInfo(shader_id, *instrumented_shader) : nullptr;
+    if (!debug_info || debug_info->instructions.empty()) {
         ss << "[Internal Error] - Can't get instructions from shader_map\n";
         return ss.str();
     }
 
-    GenerateStageMessage(ss, stage_id, stage_info_0, stage_info_1, stage_info_2, instructions);
+    GenerateStageMessage(ss, stage_id, stage_info_0, stage_info_1, stage_info_2, debug_info->instructions);
 
     ss << std::hex << std::showbase;
     if (instrumented_shader->shader_module == VK_NULL_HANDLE && instrumented_shader->shader_object == VK_NULL_HANDLE) {
-        std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
         ss << "[Internal Error] - Unable to locate shader/pipeline handles used in command buffer "
-           << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
+           << LookupDebugUtilsName(debug_report, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
            << ")\n";
         assert(true);
     } else {
-        std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
-        ss << "Command buffer " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(commandBuffer)) << "("
+        ss << "Command buffer " << LookupDebugUtilsName(debug_report, HandleToUint64(commandBuffer)) << "("
            << HandleToUint64(commandBuffer) << ")\n";
 
         ss << std::dec << std::noshowbase;
@@ -1482,24 +1723,24 @@ std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(
         ss << std::hex << std::noshowbase;
 
         if (instrumented_shader->shader_module == VK_NULL_HANDLE) {
-            ss << "Shader Object " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(instrumented_shader->shader_object))
+            ss << "Shader Object " << LookupDebugUtilsName(debug_report, HandleToUint64(instrumented_shader->shader_object))
                << "(" << HandleToUint64(instrumented_shader->shader_object) << ") (internal ID " << shader_id << ")\n";
         } else {
-            ss << "Pipeline " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(instrumented_shader->pipeline)) << "("
+            ss << "Pipeline " << LookupDebugUtilsName(debug_report, HandleToUint64(instrumented_shader->pipeline)) << "("
                << HandleToUint64(instrumented_shader->pipeline) << ")";
             if (instrumented_shader->shader_module == kPipelineStageInfoHandle) {
                 ss << " (internal ID " << shader_id
                    << ")\nShader Module was passed in via VkPipelineShaderStageCreateInfo::pNext\n";
             } else {
                 ss << "\nShader Module "
-                   << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(instrumented_shader->shader_module)) << "("
+                   << LookupDebugUtilsName(debug_report, HandleToUint64(instrumented_shader->shader_module)) << "("
                    << HandleToUint64(instrumented_shader->shader_module) << ") (internal ID " << shader_id << ")\n";
             }
         }
     }
     ss << std::dec << std::noshowbase;
 
-    FindShaderSource(ss, instructions, instruction_position, gpuav_settings.debug_printf_only);
+    FindShaderSource(ss, *debug_info, instruction_position, gpuav_settings.debug_printf_only);
 
     return ss.str();
 }
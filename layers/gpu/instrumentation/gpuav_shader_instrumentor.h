@@ -20,7 +20,14 @@
 #include "generated/chassis.h"
 #include "state_tracker/shader_instruction.h"
 #include "state_tracker/state_tracker.h"
+#include "utils/spirv_blob_cache.h"
+#include "utils/thread_pool.h"
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
 #include <vector>
 
 // There is a spirv::Instruction used for normal validation.
@@ -29,6 +36,10 @@
 // alias it with "Instruction" as that name shouldn't collide with anything.
 using Instruction = ::spirv::Instruction;
 
+namespace spirv {
+struct Module;
+}  // namespace spirv
+
 namespace chassis {
 struct ShaderInstrumentationMetadata;
 struct ShaderObjectInstrumentationData;
@@ -36,6 +47,9 @@ struct ShaderObjectInstrumentationData;
 
 namespace gpuav {
 class Validator;
+namespace debug_printf {
+struct ShaderFormatStrings;
+}  // namespace debug_printf
 
 // There are 3 ways to have a null VkShaderModule
 // 1. Use GPL for something like Vertex Input which won't have a shader
@@ -49,16 +63,9 @@ static const VkShaderModule kPipelineStageInfoHandle = CastFromUint64<VkShaderMo
 // We set a reasonable max because we have to pad the pipeline layout with dummy descriptor set layouts.
 static const uint32_t kMaxAdjustedBoundDescriptorSet = 33;
 
-class SpirvCache {
-  public:
-    void Add(uint32_t hash, std::vector<uint32_t> spirv);
-    std::vector<uint32_t> *Get(uint32_t spirv_hash);
-    bool IsEmpty() { return spirv_shaders_.empty(); }
-
-  private:
-    friend class Validator;
-    vvl::unordered_map<uint32_t, std::vector<uint32_t>> spirv_shaders_{};
-};
+// Instrumented SPIR-V keyed by the hash of the original SPIR-V, saved to disk between runs.
+// Pipelines can be created (and so instrumented) from several threads at once, the cache is thread safe.
+using SpirvCache = ::spirv::BlobCache;
 
 struct InstrumentedShader {
     VkPipeline pipeline;
@@ -67,6 +74,29 @@ struct InstrumentedShader {
     std::vector<uint32_t> instrumented_spirv;
 };
 
+// The instrumented SPIR-V of a shader indexed to find the source of an error or printf quickly, built the first time the shader
+// reports something
+struct ShaderDebugInfo {
+    std::vector<uint32_t> instrumented_spirv;
+    std::vector<Instruction> instructions;  // points into instrumented_spirv
+
+    // Index in instructions of the OpLine/DebugLine in effect at an instruction position, kNoLine if there is none
+    static constexpr uint32_t kNoLine = vvl::kU32Max;
+    uint32_t FindLine(uint32_t instruction_position) const;
+
+    // Source text of each line instruction, keyed by its index in instructions, filled as messages need them
+    std::string GetSourceInfo(uint32_t line_index) const;
+
+    ShaderDebugInfo(const std::vector<uint32_t> &spirv);
+
+  private:
+    // Sorted by position, the line in effect from each position until the next entry
+    std::vector<std::pair<uint32_t, uint32_t>> line_changes_;  // < instruction position, line index >
+
+    mutable std::mutex source_info_lock_;
+    mutable vvl::unordered_map<uint32_t, std::string> source_info_;
+};
+
 // Historically this was an common interface to both GPU-AV and DebugPrintf before the were merged together.
 // We still keep this as encapsulates the complex code around shader instrumentation.
 // Handles shader instrumentation (reserve a descriptor slot, create descriptor
@@ -167,17 +197,55 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
                                       const RecordObject &record_obj) override;
 
     void InternalError(LogObjectList objlist, const Location &loc, const char *const specific_message) const;
+    // An internal error raised on a worker thread, see deferred_internal_error
+    struct DeferredInternalError {
+        bool vma_error = false;
+        LogObjectList objlist;
+        std::string message;
+    };
+    // While a thread has one, InternalError and InternalVmaError keep the first error of that thread there and leave GPU-AV
+    // running. It is then up to the thread of the Vulkan call to report it, once its workers are done, as disabling GPU-AV
+    // while they still use it is not safe.
+    static thread_local std::optional<DeferredInternalError> *deferred_internal_error;
+    // aborted_, or an internal error deferred on this thread
+    bool Aborted() const { return aborted_ || (deferred_internal_error && deferred_internal_error->has_value()); }
     void InternalWarning(LogObjectList objlist, const Location &loc, const char *const specific_message) const;
 
     bool IsSelectiveInstrumentationEnabled(const void *pNext);
 
-    std::string GenerateDebugInfoMessage(VkCommandBuffer commandBuffer, const std::vector<Instruction> &instructions,
-                                         uint32_t stage_id, uint32_t stage_info_0, uint32_t stage_info_1, uint32_t stage_info_2,
-                                         uint32_t instruction_position, const InstrumentedShader *instrumented_shader,
-                                         uint32_t shader_id, VkPipelineBindPoint pipeline_bind_point,
-                                         uint32_t operation_index) const;
+    std::string GenerateDebugInfoMessage(VkCommandBuffer commandBuffer, uint32_t stage_id, uint32_t stage_info_0,
+                                         uint32_t stage_info_1, uint32_t stage_info_2, uint32_t instruction_position,
+                                         const InstrumentedShader *instrumented_shader, uint32_t shader_id,
+                                         VkPipelineBindPoint pipeline_bind_point, uint32_t operation_index) const;
+    std::shared_ptr<const ShaderDebugInfo> GetShaderDebugInfo(uint32_t shader_id,
+                                                              const InstrumentedShader &instrumented_shader) const;
 
   protected:
+    // The shaders of a single vkCreate*Pipelines call. They are gathered while walking the create infos, instrumented together
+    // (on shader_instrumentation_pool_ when there is more than one) and then written back to the create infos in order.
+    struct ShaderInstrumentationBatch {
+        struct Shader {
+            std::shared_ptr<const vvl::ShaderModule> module_state;
+            uint32_t unique_shader_id;
+            bool has_bindless_descriptors;
+            Location loc;
+            bool cached;
+            bool pass;
+            std::vector<uint32_t> instrumented_spirv;
+            // Puts the instrumented SPIR-V into the pipeline create info
+            std::function<void(uint32_t unique_shader_id, const std::vector<uint32_t> &instrumented_spirv)> apply;
+            // Set by the instrumentation task, InternalError is only called once all tasks are done
+            std::string internal_error;
+        };
+        std::vector<Shader> shaders;
+        // Run after every shader was applied (GPL uses it to create the instrumented libraries)
+        std::vector<std::function<void()>> finalizers;
+    };
+    void InstrumentShaders(ShaderInstrumentationBatch &batch);
+    void AddShaderToBatch(ShaderInstrumentationBatch &batch, const std::shared_ptr<const vvl::ShaderModule> &module_state,
+                          bool has_bindless_descriptors, const Location &loc,
+                          std::function<void(uint32_t unique_shader_id, const std::vector<uint32_t> &instrumented_spirv)> &&apply);
+
     bool NeedPipelineCreationShaderInstrumentation(vvl::Pipeline &pipeline_state);
     bool HasBindlessDescriptors(vvl::Pipeline &pipeline_state);
     bool HasBindlessDescriptors(VkShaderCreateInfoEXT &create_info);
@@ -185,23 +253,31 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     template <typename SafeCreateInfo>
     void PreCallRecordPipelineCreationShaderInstrumentation(
         const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, SafeCreateInfo &new_pipeline_ci,
-        const Location &loc, std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
+        const Location &loc, std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata,
+        ShaderInstrumentationBatch &batch);
     void PostCallRecordPipelineCreationShaderInstrumentation(
         vvl::Pipeline &pipeline_state, std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
+    // With gpuav_lazy_shader_instrumentation, the instrumented copy of the pipeline is created the first time it is bound.
+    // Returns the handle to bind in place of the pipeline, or VK_NULL_HANDLE if the original pipeline must stay bound.
+    VkPipeline GetLazyInstrumentedPipeline(vvl::Pipeline &pipeline_state, const Location &loc);
 
     // We have GPL variations for graphics as they defer instrumentation until linking
     void PreCallRecordPipelineCreationShaderInstrumentationGPL(
         const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state,
         vku::safe_VkGraphicsPipelineCreateInfo &new_pipeline_ci, const Location &loc,
-        std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
+        std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata, ShaderInstrumentationBatch &batch);
     void PostCallRecordPipelineCreationShaderInstrumentationGPL(
         vvl::Pipeline &pipeline_state, const VkAllocationCallbacks *pAllocator,
         std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
 
     // GPU-AV and DebugPrint are using the same way to do the actual shader instrumentation logic
     // Returns if shader was instrumented successfully or not
-    bool InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id, bool has_bindless_descriptors,
-                          const Location &loc, std::vector<uint32_t> &out_instrumented_spirv);
+    // |parsed_module| is the state tracker module of |input_spirv| if there is one, its instructions are reused
+    // If |out_internal_error| is given, an internal error is stored there instead of being reported. Worker threads must use it,
+    // InternalError disables GPU-AV and has to be called from the thread of the Vulkan call.
+    bool InstrumentShader(const vvl::span<const uint32_t> &input_spirv, const ::spirv::Module *parsed_module,
+                          uint32_t unique_shader_id, bool has_bindless_descriptors, const Location &loc,
+                          std::vector<uint32_t> &out_instrumented_spirv, std::string *out_internal_error = nullptr);
 
   public:
     VkDescriptorSetLayout GetInstrumentationDescriptorSetLayout() { return instrumentation_desc_layout_; }
@@ -219,8 +295,15 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     // This is a layout used to "pad" a pipeline layout to fill in any gaps to the selected bind index
     VkDescriptorSetLayout dummy_desc_layout_ = VK_NULL_HANDLE;
     vvl::concurrent_unordered_map<uint32_t, InstrumentedShader> instrumented_shaders_map_;
+    // Debug printf format strings of the shaders in instrumented_shaders_map_, parsed the first time they print something
+    vvl::concurrent_unordered_map<uint32_t, std::shared_ptr<const debug_printf::ShaderFormatStrings>> printf_format_strings_map_;
+    // Line index of the shaders in instrumented_shaders_map_, built the first time they report an error or a printf
+    mutable vvl::concurrent_unordered_map<uint32_t, std::shared_ptr<const ShaderDebugInfo>> shader_debug_info_map_;
     std::vector<VkDescriptorSetLayoutBinding> instrumentation_bindings_;
     SpirvCache instrumented_shaders_cache_;
+    // Only created when parallel shader instrumentation is enabled
+    std::unique_ptr<vvl::ThreadPool> shader_instrumentation_pool_;
+    std::mutex lazy_instrumentation_lock_;
 
   private:
     void Cleanup();
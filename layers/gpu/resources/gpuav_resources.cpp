@@ -19,8 +19,12 @@
 
 #include "gpu/core/gpuav.h"
 #include "generated/layer_chassis_dispatch.h"
+#include "utils/hash_util.h"
+#include "profiling/profiling.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
 
+#include <sstream>
+
 namespace gpuav {
 
 // Implementation for Descriptor Set Manager class
@@ -36,6 +40,16 @@ DescriptorSetManager::~DescriptorSetManager() {
 
 VkResult DescriptorSetManager::GetDescriptorSet(VkDescriptorPool *out_desc_pool, VkDescriptorSetLayout ds_layout,
                                                 VkDescriptorSet *out_desc_sets) {
+    {
+        auto guard = Lock();
+        auto reusable = reusable_sets_.find(ds_layout);
+        if (reusable != reusable_sets_.end() && !reusable->second.empty()) {
+            *out_desc_pool = reusable->second.back().first;
+            *out_desc_sets = reusable->second.back().second;
+            reusable->second.pop_back();
+            return VK_SUCCESS;
+        }
+    }
     std::vector<VkDescriptorSet> desc_sets;
     VkResult result = GetDescriptorSets(1, out_desc_pool, ds_layout, &desc_sets);
     assert(result == VK_SUCCESS);
@@ -113,7 +127,8 @@ VkResult DescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescriptorPoo
     return result;
 }
 
-void DescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set) {
+void DescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set,
+                                                VkDescriptorSetLayout reusable_layout) {
     auto guard = Lock();
 
     auto iter = desc_pool_map_.find(desc_pool);
@@ -122,6 +137,14 @@ void DescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDe
         return;
     }
 
+    if (reusable_layout != VK_NULL_HANDLE) {
+        auto &reusable = reusable_sets_[reusable_layout];
+        if (reusable.size() < kMaxReusableSetsPerLayout) {
+            reusable.emplace_back(desc_pool, desc_set);
+            return;
+        }
+    }
+
     VkResult result = DispatchFreeDescriptorSets(device, desc_pool, 1, &desc_set);
     assert(result == VK_SUCCESS);
     if (result != VK_SUCCESS) {
@@ -136,6 +159,67 @@ void DescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDe
     return;
 }
 
+size_t DeviceMemoryBlockPool::SizeClassHash::operator()(const DeviceMemoryBlockSizeClass &size_class) const {
+    hash_util::HashCombiner hc;
+    hc << size_class.size << size_class.usage << size_class.required_flags << reinterpret_cast<uintptr_t>(size_class.vma_pool);
+    return hc.Value();
+}
+
+void DeviceMemoryBlockPool::Acquire(const Location &loc, const DeviceMemoryBlockSizeClass &size_class, DeviceMemoryBlock &block) {
+    assert(block.Destroyed());
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto free_blocks = free_blocks_.find(size_class);
+        if (free_blocks != free_blocks_.end() && !free_blocks->second.empty()) {
+            const FreeBlock &free_block = free_blocks->second.back();
+            block.buffer = free_block.buffer;
+            block.allocation = free_block.allocation;
+            block.device_address = free_block.device_address;
+            free_blocks->second.pop_back();
+            return;
+        }
+    }
+
+    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+    buffer_info.size = size_class.size;
+    buffer_info.usage = size_class.usage;
+    VmaAllocationCreateInfo alloc_info = {};
+    alloc_info.requiredFlags = size_class.required_flags;
+    alloc_info.pool = size_class.vma_pool;
+    block.CreateBuffer(loc, &buffer_info, &alloc_info);
+}
+
+void DeviceMemoryBlockPool::Release(const DeviceMemoryBlockSizeClass &size_class, DeviceMemoryBlock &block) {
+    if (block.Destroyed()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto &free_blocks = free_blocks_[size_class];
+        if (free_blocks.size() < kMaxFreeBlocksPerSizeClass) {
+            free_blocks.emplace_back(FreeBlock{block.buffer, block.allocation, block.device_address});
+            block.buffer = VK_NULL_HANDLE;
+            block.allocation = VK_NULL_HANDLE;
+            block.device_address = 0;
+            return;
+        }
+    }
+    block.DestroyBuffer();
+}
+
+void DeviceMemoryBlockPool::Clear() {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto &[size_class, free_blocks] : free_blocks_) {
+        for (const FreeBlock &free_block : free_blocks) {
+            VmaAllocationInfo allocation_info = {};
+            vmaGetAllocationInfo(gpuav_.vma_allocator_, free_block.allocation, &allocation_info);
+            gpuav_.device_memory_stats_.RecordFree(allocation_info.size);
+            vmaDestroyBuffer(gpuav_.vma_allocator_, free_block.buffer, free_block.allocation);
+        }
+    }
+    free_blocks_.clear();
+}
+
 void SharedResourcesManager::Clear() {
     for (auto &[key, value] : shared_validation_resources_map_) {
         auto &[object, destructor] = value;
@@ -172,11 +256,14 @@ void DeviceMemoryBlock::InvalidateAllocation(const Location &loc, VkDeviceSize o
 
 void DeviceMemoryBlock::CreateBuffer(const Location &loc, const VkBufferCreateInfo *buffer_create_info,
                                      const VmaAllocationCreateInfo *allocation_create_info) {
+    VmaAllocationInfo allocation_info = {};
     VkResult result =
-        vmaCreateBuffer(gpuav.vma_allocator_, buffer_create_info, allocation_create_info, &buffer, &allocation, nullptr);
+        vmaCreateBuffer(gpuav.vma_allocator_, buffer_create_info, allocation_create_info, &buffer, &allocation, &allocation_info);
     if (result != VK_SUCCESS) {
         gpuav.InternalVmaError(gpuav.device, loc, "Unable to allocate device memory for internal buffer.");
+        return;
     }
+    gpuav.device_memory_stats_.RecordAllocation(allocation_info.size);
 
     if (buffer_create_info->usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) {
         // After creating the buffer, get the address right away
@@ -189,6 +276,9 @@ void DeviceMemoryBlock::CreateBuffer(const Location &loc, const VkBufferCreateIn
 
 void DeviceMemoryBlock::DestroyBuffer() {
     if (buffer != VK_NULL_HANDLE) {
+        VmaAllocationInfo allocation_info = {};
+        vmaGetAllocationInfo(gpuav.vma_allocator_, allocation, &allocation_info);
+        gpuav.device_memory_stats_.RecordFree(allocation_info.size);
         vmaDestroyBuffer(gpuav.vma_allocator_, buffer, allocation);
         buffer = VK_NULL_HANDLE;
         allocation = VK_NULL_HANDLE;
@@ -196,18 +286,64 @@ void DeviceMemoryBlock::DestroyBuffer() {
     }
 }
 
+// Raises peak to value if it is bigger, other threads can be updating it at the same time
+static void UpdatePeak(std::atomic<uint64_t> &peak, uint64_t value) {
+    uint64_t current_peak = peak.load(std::memory_order_relaxed);
+    while (value > current_peak && !peak.compare_exchange_weak(current_peak, value, std::memory_order_relaxed)) {
+    }
+}
+
+void DeviceMemoryStats::RecordAllocation(VkDeviceSize size) {
+    const uint64_t new_bytes = bytes_.fetch_add(size, std::memory_order_relaxed) + size;
+    const uint64_t new_allocations = allocations_.fetch_add(1, std::memory_order_relaxed) + 1;
+    total_allocations_.fetch_add(1, std::memory_order_relaxed);
+    frame_allocations_.fetch_add(1, std::memory_order_relaxed);
+    UpdatePeak(peak_bytes_, new_bytes);
+    UpdatePeak(peak_allocations_, new_allocations);
+    VVL_TracyPlot("GPU-AV device memory bytes", static_cast<int64_t>(new_bytes));
+}
+
+void DeviceMemoryStats::RecordFree(VkDeviceSize size) {
+    const uint64_t new_bytes = bytes_.fetch_sub(size, std::memory_order_relaxed) - size;
+    allocations_.fetch_sub(1, std::memory_order_relaxed);
+    VVL_TracyPlot("GPU-AV device memory bytes", static_cast<int64_t>(new_bytes));
+}
+
+void DeviceMemoryStats::EndFrame() {
+    const uint64_t frame_allocations = frame_allocations_.exchange(0, std::memory_order_relaxed);
+    frames_.fetch_add(1, std::memory_order_relaxed);
+    UpdatePeak(peak_frame_allocations_, frame_allocations);
+    VVL_TracyPlot("GPU-AV device memory allocations per frame", static_cast<int64_t>(frame_allocations));
+}
+
+std::string DeviceMemoryStats::Report() const {
+    std::ostringstream ss;
+    ss << "Device memory allocated by GPU-AV with VMA:\n";
+    ss << "  Current: " << bytes_.load() << " bytes in " << allocations_.load() << " allocations\n";
+    ss << "  Peak: " << peak_bytes_.load() << " bytes, " << peak_allocations_.load() << " allocations\n";
+    ss << "  Allocations: " << total_allocations_.load() << " in total";
+    const uint64_t frames = frames_.load();
+    if (frames > 0) {
+        ss << ", " << (total_allocations_.load() / frames) << " per frame on average, " << peak_frame_allocations_.load()
+           << " at most in one frame (" << frames << " frames)";
+    }
+    ss << "\n";
+    return ss.str();
+}
+
 VkDescriptorSet GpuResourcesManager::GetManagedDescriptorSet(VkDescriptorSetLayout desc_set_layout) {
-    std::pair<VkDescriptorPool, VkDescriptorSet> descriptor;
-    descriptor_set_manager_.GetDescriptorSet(&descriptor.first, desc_set_layout, &descriptor.second);
+    ManagedDescriptorSet descriptor{VK_NULL_HANDLE, VK_NULL_HANDLE, desc_set_layout};
+    descriptor_set_manager_.GetDescriptorSet(&descriptor.pool, desc_set_layout, &descriptor.set);
     descriptors_.emplace_back(descriptor);
-    return descriptor.second;
+    return descriptor.set;
 }
 
 void GpuResourcesManager::ManageDeviceMemoryBlock(DeviceMemoryBlock mem_block) { mem_blocks_.emplace_back(mem_block); }
 
 void GpuResourcesManager::DestroyResources() {
-    for (auto &[desc_pool, desc_set] : descriptors_) {
-        descriptor_set_manager_.PutBackDescriptorSet(desc_pool, desc_set);
+    for (const ManagedDescriptorSet &descriptor : descriptors_) {
+        // Layouts of the managed sets belong to the device, the sets can go to the next command buffer recording
+        descriptor_set_manager_.PutBackDescriptorSet(descriptor.pool, descriptor.set, descriptor.layout);
     }
     descriptors_.clear();
 
@@ -20,6 +20,9 @@
 #include "containers/custom_containers.h"
 #include "vma/vma.h"
 
+#include <atomic>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -35,7 +38,10 @@ class DescriptorSetManager {
     VkResult GetDescriptorSet(VkDescriptorPool *out_desc_pool, VkDescriptorSetLayout ds_layout, VkDescriptorSet *out_desc_sets);
     VkResult GetDescriptorSets(uint32_t count, VkDescriptorPool *out_pool, VkDescriptorSetLayout ds_layout,
                                std::vector<VkDescriptorSet> *out_desc_sets);
-    void PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set);
+    // If reusable_layout is given, the set is kept for the next GetDescriptorSet with that layout instead of being freed.
+    // Only pass layouts living as long as the device, sets are looked up by handle.
+    void PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set,
+                              VkDescriptorSetLayout reusable_layout = VK_NULL_HANDLE);
 
   private:
     std::unique_lock<std::mutex> Lock() const { return std::unique_lock<std::mutex>(lock_); }
@@ -47,9 +53,35 @@ class DescriptorSetManager {
     VkDevice device;
     uint32_t num_bindings_in_set;
     vvl::unordered_map<VkDescriptorPool, PoolTracker> desc_pool_map_;
+    // Sets put back for reuse, still counted as used by their pool
+    static constexpr size_t kMaxReusableSetsPerLayout = 256;
+    vvl::unordered_map<VkDescriptorSetLayout, std::vector<std::pair<VkDescriptorPool, VkDescriptorSet>>> reusable_sets_;
     mutable std::mutex lock_;
 };
 
+// Device memory GPU-AV allocated through VMA for its own buffers, to know how much validation costs on memory constrained
+// devices. Updated by DeviceMemoryBlock and DeviceMemoryBlockPool, plotted in Tracy and printed at device destruction with
+// gpuav_debug_print_memory_report.
+class DeviceMemoryStats {
+  public:
+    void RecordAllocation(VkDeviceSize size);
+    void RecordFree(VkDeviceSize size);
+    // Called at each present, a frame is what happens between two presents
+    void EndFrame();
+
+    std::string Report() const;
+
+  private:
+    std::atomic<uint64_t> bytes_{0};
+    std::atomic<uint64_t> peak_bytes_{0};
+    std::atomic<uint64_t> allocations_{0};
+    std::atomic<uint64_t> peak_allocations_{0};
+    std::atomic<uint64_t> total_allocations_{0};
+    std::atomic<uint64_t> frames_{0};
+    std::atomic<uint64_t> frame_allocations_{0};
+    std::atomic<uint64_t> peak_frame_allocations_{0};
+};
+
 // Wrapper around device memory and its corresponding allocation
 class DeviceMemoryBlock {
   public:
@@ -73,6 +105,7 @@ class DeviceMemoryBlock {
     VkDeviceAddress Address() const { return device_address; };
 
   private:
+    friend class DeviceMemoryBlockPool;
     const Validator &gpuav;
     VkBuffer buffer = VK_NULL_HANDLE;
     VmaAllocation allocation = VK_NULL_HANDLE;
@@ -80,10 +113,55 @@ class DeviceMemoryBlock {
     VkDeviceAddress device_address = 0;
 };
 
+// What a buffer is created with, buffers of the same size class are interchangeable
+struct DeviceMemoryBlockSizeClass {
+    VkDeviceSize size;
+    VkBufferUsageFlags usage;
+    VkMemoryPropertyFlags required_flags;
+    VmaPool vma_pool;
+
+    bool operator==(const DeviceMemoryBlockSizeClass &rhs) const {
+        return size == rhs.size && usage == rhs.usage && required_flags == rhs.required_flags && vma_pool == rhs.vma_pool;
+    }
+};
+
+// Device wide recycling of the buffers every command buffer allocates when it is recorded (error output, errors counts,
+// buffer device address snapshot, debug printf output). With a transient command pool per frame those are allocated again
+// every frame, this keeps the buffers of reset or freed command buffers around instead of going through VMA every time.
+// Buffers are handed back as is, users must still initialize the content.
+class DeviceMemoryBlockPool {
+  public:
+    explicit DeviceMemoryBlockPool(Validator &gpuav) : gpuav_(gpuav) {}
+
+    // Gives block a buffer of size_class, reusing one that was put back if possible
+    void Acquire(const Location &loc, const DeviceMemoryBlockSizeClass &size_class, DeviceMemoryBlock &block);
+    // Takes the buffer of block back for reuse, block is left destroyed
+    void Release(const DeviceMemoryBlockSizeClass &size_class, DeviceMemoryBlock &block);
+    // Destroys all the buffers waiting for reuse, must be called before the VMA allocator goes away
+    void Clear();
+
+  private:
+    struct SizeClassHash {
+        size_t operator()(const DeviceMemoryBlockSizeClass &size_class) const;
+    };
+    struct FreeBlock {
+        VkBuffer buffer;
+        VmaAllocation allocation;
+        VkDeviceAddress device_address;
+    };
+    // Bound the memory kept around after a burst of command buffers
+    static constexpr size_t kMaxFreeBlocksPerSizeClass = 256;
+
+    Validator &gpuav_;
+    std::mutex lock_;
+    vvl::unordered_map<DeviceMemoryBlockSizeClass, std::vector<FreeBlock>, SizeClassHash> free_blocks_;
+};
+
 class GpuResourcesManager {
   public:
     explicit GpuResourcesManager(DescriptorSetManager &descriptor_set_manager) : descriptor_set_manager_(descriptor_set_manager) {}
 
+    // desc_set_layout must live as long as the device, the set is reused by later recordings once put back
     VkDescriptorSet GetManagedDescriptorSet(VkDescriptorSetLayout desc_set_layout);
     void ManageDeviceMemoryBlock(DeviceMemoryBlock mem_block);
 
@@ -91,7 +169,12 @@ class GpuResourcesManager {
 
   private:
     DescriptorSetManager &descriptor_set_manager_;
-    std::vector<std::pair<VkDescriptorPool, VkDescriptorSet>> descriptors_;
+    struct ManagedDescriptorSet {
+        VkDescriptorPool pool;
+        VkDescriptorSet set;
+        VkDescriptorSetLayout layout;
+    };
+    std::vector<ManagedDescriptorSet> descriptors_;
     std::vector<DeviceMemoryBlock> mem_blocks_;
 };
 
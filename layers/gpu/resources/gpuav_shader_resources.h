@@ -43,6 +43,16 @@ struct DescriptorCommandBinding {
     // Note: The index here is from vkCmdBindDescriptorSets::firstSet
     std::vector<DescriptorCommandBountSet> bound_descriptor_sets;
 
+    // The bound state this binding was built from. Binding the same sets again (common before every draw) keeps using it
+    // instead of building an identical one.
+    struct BoundSetKey {
+        const DescriptorSet *state;  // null if no set is bound at this index
+        uint32_t version;
+    };
+    VkPipelineBindPoint pipeline_bind_point = VK_PIPELINE_BIND_POINT_MAX_ENUM;
+    const vvl::Pipeline *pipeline_state = nullptr;
+    std::vector<BoundSetKey> per_set_keys;
+
     DescriptorCommandBinding(Validator &gpuav) : ssbo_block(gpuav) {}
 };
 
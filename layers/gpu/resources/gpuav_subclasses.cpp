@@ -17,6 +17,8 @@
 
 #include "gpu/resources/gpuav_subclasses.h"
 
+#include <algorithm>
+
 #include "gpu/resources/gpuav_shader_resources.h"
 #include "gpu/core/gpuav.h"
 #include "gpu/core/gpuav_constants.h"
@@ -132,15 +134,24 @@ CommandBuffer::CommandBuffer(Validator &gpuav, VkCommandBuffer handle, const VkC
     AllocateResources(loc);
 }
 
+static DeviceMemoryBlockSizeClass ErrorOutputBufferSizeClass(const Validator &gpuav) {
+    return {glsl::kErrorBufferByteSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, gpuav.output_buffer_pool_};
+}
+
+static DeviceMemoryBlockSizeClass BdaRangesBufferSizeClass(const Validator &gpuav, VkDeviceSize size) {
+    // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
+    // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
+    return {size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+            VK_NULL_HANDLE};
+}
+
 static bool AllocateErrorLogsBuffer(Validator &gpuav, VkCommandBuffer command_buffer, DeviceMemoryBlock &error_output_buffer,
                                     const Location &loc) {
-    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-    buffer_info.size = glsl::kErrorBufferByteSize;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    alloc_info.pool = gpuav.output_buffer_pool_;
-    error_output_buffer.CreateBuffer(loc, &buffer_info, &alloc_info);
+    gpuav.cb_memory_block_pool_.Acquire(loc, ErrorOutputBufferSizeClass(gpuav), error_output_buffer);
+    if (error_output_buffer.Destroyed()) {
+        return false;
+    }
 
     auto output_buffer_ptr = (uint32_t *)error_output_buffer.MapMemory(loc);
 
@@ -153,24 +164,23 @@ static bool AllocateErrorLogsBuffer(Validator &gpuav, VkCommandBuffer command_bu
     return true;
 }
 
+DeviceMemoryBlockSizeClass CommandBuffer::GetCmdErrorsCountsBufferSizeClass() const {
+    auto gpuav = static_cast<const Validator *>(&dev_data);
+    return {GetCmdErrorsCountsBufferByteSize(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, gpuav->output_buffer_pool_};
+}
+
 void CommandBuffer::AllocateResources(const Location &loc) {
     auto gpuav = static_cast<Validator *>(&dev_data);
 
     VkResult result = VK_SUCCESS;
 
-    // Instrumentation descriptor set layout
-    if (instrumentation_desc_set_layout_ == VK_NULL_HANDLE) {
-        assert(!gpuav->instrumentation_bindings_.empty());
-        VkDescriptorSetLayoutCreateInfo instrumentation_desc_set_layout_ci = vku::InitStructHelper();
-        instrumentation_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(gpuav->instrumentation_bindings_.size());
-        instrumentation_desc_set_layout_ci.pBindings = gpuav->instrumentation_bindings_.data();
-        result = DispatchCreateDescriptorSetLayout(gpuav->device, &instrumentation_desc_set_layout_ci, nullptr,
-                                                   &instrumentation_desc_set_layout_);
-        if (result != VK_SUCCESS) {
-            gpuav->InternalError(gpuav->device, loc, "Unable to create instrumentation descriptor set layout.");
-            return;
-        }
+    // Descriptor set layouts are shared by all command buffers
+    if (gpuav->instrumentation_desc_set_layout_ == VK_NULL_HANDLE || gpuav->validation_cmd_desc_set_layout_ == VK_NULL_HANDLE) {
+        return;
     }
+    instrumentation_desc_set_layout_ = gpuav->instrumentation_desc_set_layout_;
+    validation_cmd_desc_set_layout_ = gpuav->validation_cmd_desc_set_layout_;
 
     // Error output buffer
     if (!AllocateErrorLogsBuffer(*gpuav, VkHandle(), error_output_buffer_, loc)) {
@@ -179,13 +189,10 @@ void CommandBuffer::AllocateResources(const Location &loc) {
 
     // Commands errors counts buffer
     {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-        buffer_info.size = GetCmdErrorsCountsBufferByteSize();
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        alloc_info.pool = gpuav->output_buffer_pool_;
-        cmd_errors_counts_buffer_.CreateBuffer(loc, &buffer_info, &alloc_info);
+        gpuav->cb_memory_block_pool_.Acquire(loc, GetCmdErrorsCountsBufferSizeClass(), cmd_errors_counts_buffer_);
+        if (cmd_errors_counts_buffer_.Destroyed()) {
+            return;
+        }
 
         ClearCmdErrorsCountsBuffer(loc);
         if (gpuav->aborted_) return;
@@ -193,41 +200,12 @@ void CommandBuffer::AllocateResources(const Location &loc) {
 
     // BDA snapshot
     if (gpuav->gpuav_settings.shader_instrumentation.buffer_device_address) {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        buffer_info.size = GetBdaRangesBufferByteSize();
-        // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
-        // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-        bda_ranges_snapshot_.CreateBuffer(loc, &buffer_info, &alloc_info);
+        gpuav->cb_memory_block_pool_.Acquire(loc, BdaRangesBufferSizeClass(*gpuav, GetBdaRangesBufferByteSize()),
+                                             bda_ranges_snapshot_);
     }
 
     // Update validation commands common descriptor set
     {
-        const std::vector<VkDescriptorSetLayoutBinding> validation_cmd_bindings = {
-            // Error output buffer
-            {glsl::kBindingDiagErrorBuffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
-            // Buffer holding action command index in command buffer
-            {glsl::kBindingDiagActionIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
-            // Buffer holding a resource index from the per command buffer command resources list
-            {glsl::kBindingDiagCmdResourceIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
-            // Commands errors counts buffer
-            {glsl::kBindingDiagCmdErrorsCount, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
-        };
-
-        if (validation_cmd_desc_set_layout_ == VK_NULL_HANDLE) {
-            VkDescriptorSetLayoutCreateInfo validation_cmd_desc_set_layout_ci = vku::InitStructHelper();
-            validation_cmd_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(validation_cmd_bindings.size());
-            validation_cmd_desc_set_layout_ci.pBindings = validation_cmd_bindings.data();
-            result = DispatchCreateDescriptorSetLayout(gpuav->device, &validation_cmd_desc_set_layout_ci, nullptr,
-                                                       &validation_cmd_desc_set_layout_);
-            if (result != VK_SUCCESS) {
-                gpuav->InternalError(gpuav->device, loc, "Unable to create descriptor set layout used for validation commands.");
-                return;
-            }
-        }
-
         assert(validation_cmd_desc_pool_ == VK_NULL_HANDLE);
         assert(validation_cmd_desc_set_ == VK_NULL_HANDLE);
         result = gpuav->desc_set_manager_->GetDescriptorSet(&validation_cmd_desc_pool_, validation_cmd_desc_set_layout_,
@@ -238,7 +216,6 @@ void CommandBuffer::AllocateResources(const Location &loc) {
         }
 
         std::array<VkWriteDescriptorSet, 4> validation_cmd_descriptor_writes = {};
-        assert(validation_cmd_bindings.size() == validation_cmd_descriptor_writes.size());
 
         VkDescriptorBufferInfo error_output_buffer_desc_info = {};
 
@@ -291,9 +268,13 @@ void CommandBuffer::AllocateResources(const Location &loc) {
 bool CommandBuffer::UpdateBdaRangesBuffer(const Location &loc) {
     auto gpuav = static_cast<Validator *>(&dev_data);
 
+    if (!gpuav->gpuav_settings.shader_instrumentation.buffer_device_address) {
+        return true;
+    }
+
     // By supplying a "date"
-    if (!gpuav->gpuav_settings.shader_instrumentation.buffer_device_address ||
-        bda_ranges_snapshot_version_ == gpuav->buffer_device_address_ranges_version) {
+    const auto snapshot = gpuav->GetBdaRangesSnapshot();
+    if (bda_ranges_snapshot_version_ == snapshot->version) {
         return true;
     }
 
@@ -313,8 +294,9 @@ bool CommandBuffer::UpdateBdaRangesBuffer(const Location &loc) {
     const size_t max_recordable_ranges =
         static_cast<size_t>((GetBdaRangesBufferByteSize() - sizeof(uint64_t)) / (2 * sizeof(VkDeviceAddress)));
     auto bda_ranges = reinterpret_cast<ValidationStateTracker::BufferAddressRange *>(bda_table_ptr + 1);
-    const auto [ranges_to_update_count, total_address_ranges_count] =
-        gpuav->GetBufferAddressRanges(bda_ranges, max_recordable_ranges);
+    const size_t total_address_ranges_count = snapshot->ranges.size();
+    const size_t ranges_to_update_count = std::min(total_address_ranges_count, max_recordable_ranges);
+    std::copy_n(snapshot->ranges.data(), ranges_to_update_count, bda_ranges);
     bda_table_ptr[0] = ranges_to_update_count;
 
     if (total_address_ranges_count > size_t(gpuav->gpuav_settings.max_bda_in_use)) {
@@ -332,7 +314,7 @@ bool CommandBuffer::UpdateBdaRangesBuffer(const Location &loc) {
     // Flush the BDA buffer before un-mapping so that the new state is visible to the GPU
     bda_ranges_snapshot_.FlushAllocation(loc);
     bda_ranges_snapshot_.UnmapMemory();
-    bda_ranges_snapshot_version_ = gpuav->buffer_device_address_ranges_version;
+    bda_ranges_snapshot_version_ = snapshot->version;
 
     return true;
 }
@@ -369,13 +351,18 @@ void CommandBuffer::ResetCBState() {
 
     // Free the device memory and descriptor set(s) associated with a command buffer.
     for (auto &buffer_info : debug_printf_buffer_infos) {
-        buffer_info.output_mem_block.DestroyBuffer();
+        gpuav->cb_memory_block_pool_.Release(debug_printf::OutputBufferSizeClass(*gpuav, buffer_info.buffer_size),
+                                             buffer_info.output_mem_block);
     }
     debug_printf_buffer_infos.clear();
 
     // Free the device memory and descriptor set(s) associated with a command buffer.
+    copy_buffer_to_image_batch.reset();
+    batched_indirect_draw_validations.clear();
+    indirect_buffers_written = false;
     gpu_resources_manager.DestroyResources();
     per_command_error_loggers.clear();
+    lazy_instrumented_pipelines.clear();
 
     for (auto &descriptor_command_binding : descriptor_command_bindings) {
         descriptor_command_binding.ssbo_block.DestroyBuffer();
@@ -383,27 +370,19 @@ void CommandBuffer::ResetCBState() {
     descriptor_command_bindings.clear();
     current_bindless_buffer = VK_NULL_HANDLE;
 
-    error_output_buffer_.DestroyBuffer();
-    cmd_errors_counts_buffer_.DestroyBuffer();
-    bda_ranges_snapshot_.DestroyBuffer();
-    bda_ranges_snapshot_version_ = 0;
+    // Give the buffers and the descriptor set back for the next command buffer recording
+    gpuav->cb_memory_block_pool_.Release(ErrorOutputBufferSizeClass(*gpuav), error_output_buffer_);
+    gpuav->cb_memory_block_pool_.Release(GetCmdErrorsCountsBufferSizeClass(), cmd_errors_counts_buffer_);
+    gpuav->cb_memory_block_pool_.Release(BdaRangesBufferSizeClass(*gpuav, GetBdaRangesBufferByteSize()), bda_ranges_snapshot_);
+    bda_ranges_snapshot_version_ = vvl::kU32Max;
 
     if (validation_cmd_desc_pool_ != VK_NULL_HANDLE && validation_cmd_desc_set_ != VK_NULL_HANDLE) {
-        gpuav->desc_set_manager_->PutBackDescriptorSet(validation_cmd_desc_pool_, validation_cmd_desc_set_);
+        gpuav->desc_set_manager_->PutBackDescriptorSet(validation_cmd_desc_pool_, validation_cmd_desc_set_,
+                                                       validation_cmd_desc_set_layout_);
         validation_cmd_desc_pool_ = VK_NULL_HANDLE;
         validation_cmd_desc_set_ = VK_NULL_HANDLE;
     }
 
-    if (instrumentation_desc_set_layout_ != VK_NULL_HANDLE) {
-        DispatchDestroyDescriptorSetLayout(gpuav->device, instrumentation_desc_set_layout_, nullptr);
-        instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
-    }
-
-    if (validation_cmd_desc_set_layout_ != VK_NULL_HANDLE) {
-        DispatchDestroyDescriptorSetLayout(gpuav->device, validation_cmd_desc_set_layout_, nullptr);
-        validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
-    }
-
     draw_index = 0;
     compute_index = 0;
     trace_rays_index = 0;
@@ -446,7 +425,7 @@ bool CommandBuffer::PreProcess(const Location &loc) {
 bool CommandBuffer::NeedsPostProcess() { return !error_output_buffer_.Destroyed(); }
 
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
-void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
+bool CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
     auto gpuav = static_cast<Validator *>(&dev_data);
 
     // For the given command buffer, map its debug data buffers and read their contents for analysis.
@@ -460,10 +439,11 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
     // so when getting here after acquiring command buffer's lock,
     // make sure there are still things to process
     if (!NeedsPostProcess()) {
-        return;
+        return false;
     }
 
     bool skip = false;
+    bool error_written = false;
     {
         auto error_output_buffer_ptr = (uint32_t *)error_output_buffer_.MapMemory(loc);
 
@@ -473,6 +453,7 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
         // we provide via the descriptor. So, we process only the number of words that can fit in the
         // buffer.
         const uint32_t total_words = error_output_buffer_ptr[cst::stream_output_size_offset];
+        error_written = total_words != 0;
 
         // A zero here means that the shader instrumentation didn't write anything.
         if (total_words != 0) {
@@ -507,7 +488,14 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
     }
 
     ClearCmdErrorsCountsBuffer(loc);
-    if (gpuav->aborted_) return;
+    if (gpuav->Aborted()) return false;
+
+    // Errors can't be traced back to a pipeline, so only a submission without any counts for its pipelines
+    if (!error_written) {
+        for (const auto &pipeline_state : lazy_instrumented_pipelines) {
+            pipeline_state->instrumentation_data.clean_submit_count.fetch_add(1);
+        }
+    }
 
     // If instrumentation found an error, skip post processing. Errors detected by instrumentation are usually
     // very serious, such as a prematurely destroyed resource and the state needed below is likely invalid.
@@ -515,10 +503,7 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
     if (!skip && gpuav->gpuav_settings.shader_instrumentation.post_process_descriptor_index) {
         gpuav_success = ValidateBindlessDescriptorSets(loc);
     }
-
-    if (gpuav_success) {
-        UpdateCmdBufImageLayouts(state_, *this);
-    }
+    return gpuav_success;
 }
 
 Queue::Queue(Validator &gpuav, VkQueue q, uint32_t family_index, uint32_t queue_index, VkDeviceQueueCreateFlags flags,
@@ -526,6 +511,14 @@ Queue::Queue(Validator &gpuav, VkQueue q, uint32_t family_index, uint32_t queue_
     : vvl::Queue(gpuav, q, family_index, queue_index, flags, queueFamilyProperties), state_(gpuav), timeline_khr_(timeline_khr) {}
 
 Queue::~Queue() {
+    {
+        std::lock_guard<std::mutex> guard(readback_lock_);
+        readback_exit_ = true;
+    }
+    readback_cond_.notify_all();
+    if (readback_thread_.joinable()) {
+        readback_thread_.join();
+    }
     if (barrier_command_buffer_) {
         DispatchFreeCommandBuffers(state_.device, barrier_command_pool_, 1, &barrier_command_buffer_);
         barrier_command_buffer_ = VK_NULL_HANDLE;
@@ -538,6 +531,11 @@ Queue::~Queue() {
         DispatchDestroySemaphore(state_.device, barrier_sem_, nullptr);
         barrier_sem_ = VK_NULL_HANDLE;
     }
+    // Also frees the draw validation command buffers
+    if (draw_validation_command_pool_) {
+        DispatchDestroyCommandPool(state_.device, draw_validation_command_pool_, nullptr);
+        draw_validation_command_pool_ = VK_NULL_HANDLE;
+    }
 }
 
 // Submit a memory barrier on graphics queues.
@@ -617,6 +615,8 @@ void Queue::SubmitBarrier(const Location &loc, uint64_t seq) {
 }
 
 vvl::PreSubmitResult Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) {
+    // A batch ends with the last submission of each call, leftovers are from a call that failed and was never submitted
+    batch_cbs_.clear();
     for (const auto &submission : submissions) {
         auto loc = submission.loc.Get();
         for (auto &cb : submission.cbs) {
@@ -628,54 +628,328 @@ vvl::PreSubmitResult Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submis
                 auto *secondary_gpu_cb = static_cast<CommandBuffer *>(secondary_cb);
                 secondary_gpu_cb->PreProcess(loc);
             }
+            batch_cbs_.emplace_back(cb);
         }
     }
+    if (state_.gpuav_settings.batch_indirect_draws_validation && !submissions.empty()) {
+        SubmitBatchedIndirectDrawValidations(submissions, submissions.front().loc.Get());
+    }
     return vvl::Queue::PreSubmit(std::move(submissions));
 }
 
+// With gpuav_batch_indirect_draws_validation, the validation draws of the indirect draws of the submitted command buffers are
+// recorded in one command buffer submitted right before them. It waits for the semaphores they wait for, so that it reads the
+// indirect buffers after the work they depend on wrote them, and signals the binary ones again for them to wait on.
+// Semaphores signaled by the submissions themselves are not waited for, that would never complete.
+void Queue::SubmitBatchedIndirectDrawValidations(const std::vector<vvl::QueueSubmission> &submissions, const Location &loc) {
+    vvl::unordered_set<const vvl::Semaphore *> signaled_semaphores;
+    for (const auto &submission : submissions) {
+        for (const auto &signal : submission.signal_semaphores) {
+            signaled_semaphores.insert(signal.semaphore.get());
+        }
+    }
+
+    std::vector<const CommandBuffer *> validated_cbs;
+    vvl::unordered_map<VkSemaphore, uint64_t> timeline_waits;
+    std::vector<VkSemaphore> binary_waits;
+    for (const auto &submission : submissions) {
+        const size_t validated_cbs_count = validated_cbs.size();
+        for (const auto &cb : submission.cbs) {
+            auto gpu_cb = static_cast<const CommandBuffer *>(cb.get());
+            auto guard = gpu_cb->ReadLock();
+            if (!gpu_cb->batched_indirect_draw_validations.empty()) {
+                validated_cbs.emplace_back(gpu_cb);
+            }
+        }
+        if (validated_cbs.size() == validated_cbs_count) {
+            continue;
+        }
+        for (const auto &wait : submission.wait_semaphores) {
+            if (!wait.semaphore || signaled_semaphores.count(wait.semaphore.get()) != 0) {
+                continue;
+            }
+            if (wait.semaphore->type == VK_SEMAPHORE_TYPE_TIMELINE) {
+                uint64_t &value = timeline_waits[wait.semaphore->VkHandle()];
+                value = std::max(value, wait.payload);
+            } else {
+                binary_waits.emplace_back(wait.semaphore->VkHandle());
+            }
+        }
+    }
+    if (validated_cbs.empty()) {
+        return;
+    }
+
+    if (draw_validation_command_pool_ == VK_NULL_HANDLE) {
+        VkCommandPoolCreateInfo pool_create_info = vku::InitStructHelper();
+        pool_create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_create_info.queueFamilyIndex = queue_family_index;
+        VkResult result = DispatchCreateCommandPool(state_.device, &pool_create_info, nullptr, &draw_validation_command_pool_);
+        if (result != VK_SUCCESS) {
+            state_.InternalError(vvl::Queue::VkHandle(), loc, "Unable to create command pool for batched draw validation.");
+            draw_validation_command_pool_ = VK_NULL_HANDLE;
+            return;
+        }
+    }
+
+    VkCommandBuffer validation_cb = VK_NULL_HANDLE;
+    {
+        std::lock_guard<std::mutex> guard(readback_lock_);
+        if (!spare_draw_validation_cbs_.empty()) {
+            validation_cb = spare_draw_validation_cbs_.back();
+            spare_draw_validation_cbs_.pop_back();
+        }
+    }
+    if (validation_cb != VK_NULL_HANDLE) {
+        DispatchResetCommandBuffer(validation_cb, 0);
+    } else {
+        VkCommandBufferAllocateInfo buffer_alloc_info = vku::InitStructHelper();
+        buffer_alloc_info.commandPool = draw_validation_command_pool_;
+        buffer_alloc_info.commandBufferCount = 1;
+        buffer_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        VkResult result = DispatchAllocateCommandBuffers(state_.device, &buffer_alloc_info, &validation_cb);
+        if (result != VK_SUCCESS) {
+            state_.InternalError(vvl::Queue::VkHandle(), loc, "Unable to create batched draw validation command buffer.");
+            return;
+        }
+        // Hook up command buffer dispatch
+        state_.vk_set_device_loader_data_(state_.device, validation_cb);
+    }
+    // Recycled with the readback of the batch, once the GPU is done with it
+    draw_validation_cbs_.emplace_back(validation_cb);
+
+    VkCommandBufferBeginInfo begin_info = vku::InitStructHelper();
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (DispatchBeginCommandBuffer(validation_cb, &begin_info, false) != VK_SUCCESS) {
+        return;
+    }
+    bool recorded = false;
+    for (const CommandBuffer *gpu_cb : validated_cbs) {
+        auto guard = gpu_cb->ReadLock();
+        recorded |= RecordBatchedIndirectDrawValidations(state_, *gpu_cb, validation_cb, loc);
+    }
+    DispatchEndCommandBuffer(validation_cb);
+    if (!recorded) {
+        return;
+    }
+
+    std::vector<VkSemaphore> wait_semaphores;
+    std::vector<uint64_t> wait_values;
+    for (const auto &[semaphore, value] : timeline_waits) {
+        wait_semaphores.emplace_back(semaphore);
+        wait_values.emplace_back(value);
+    }
+    for (VkSemaphore semaphore : binary_waits) {
+        wait_semaphores.emplace_back(semaphore);
+        wait_values.emplace_back(0);
+    }
+    const std::vector<VkPipelineStageFlags> wait_stages(wait_semaphores.size(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    const std::vector<uint64_t> signal_values(binary_waits.size(), 0);
+
+    VkTimelineSemaphoreSubmitInfo timeline_semaphore_submit_info = vku::InitStructHelper();
+    timeline_semaphore_submit_info.waitSemaphoreValueCount = static_cast<uint32_t>(wait_values.size());
+    timeline_semaphore_submit_info.pWaitSemaphoreValues = wait_values.data();
+    timeline_semaphore_submit_info.signalSemaphoreValueCount = static_cast<uint32_t>(signal_values.size());
+    timeline_semaphore_submit_info.pSignalSemaphoreValues = signal_values.data();
+
+    VkSubmitInfo submit_info = vku::InitStructHelper(timeline_waits.empty() ? nullptr : &timeline_semaphore_submit_info);
+    submit_info.waitSemaphoreCount = static_cast<uint32_t>(wait_semaphores.size());
+    submit_info.pWaitSemaphores = wait_semaphores.data();
+    submit_info.pWaitDstStageMask = wait_stages.data();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &validation_cb;
+    submit_info.signalSemaphoreCount = static_cast<uint32_t>(binary_waits.size());
+    submit_info.pSignalSemaphores = binary_waits.data();
+
+    const VkResult result = DispatchQueueSubmit(vvl::Queue::VkHandle(), 1, &submit_info, VK_NULL_HANDLE);
+    if (result != VK_SUCCESS) {
+        state_.InternalError(vvl::Queue::VkHandle(), loc, "Unable to submit batched draw validation command buffer.");
+    }
+}
+
 void Queue::PostSubmit(vvl::QueueSubmission &submission) {
     vvl::Queue::PostSubmit(submission);
     if (submission.end_batch) {
         auto loc = submission.loc.Get();
         SubmitBarrier(loc, submission.seq);
+        {
+            std::lock_guard<std::mutex> guard(readback_lock_);
+            readbacks_.push_back(Readback{submission.seq, submission.loc, std::move(batch_cbs_), std::move(draw_validation_cbs_)});
+            batch_cbs_ = std::move(spare_cbs_);
+            spare_cbs_.clear();
+            draw_validation_cbs_.clear();
+            // Without the barrier semaphore there is no way to know when the batch is done, Retire does the readback then
+            if (barrier_sem_ != VK_NULL_HANDLE && !readback_thread_.joinable()) {
+                readback_thread_ = std::thread(&Queue::ReadbackThread, this);
+            }
+        }
+        readback_cond_.notify_all();
+        batch_cbs_.clear();
     }
 }
 
-void Queue::Retire(vvl::QueueSubmission &submission) {
-    vvl::Queue::Retire(submission);
-    if (submission.loc.Get().function == vvl::Func::vkQueuePresentKHR) {
-        // Present batch does not have any GPU-AV work to post process, skip it.
-        // This is also needed for correctness. QueuePresent does not have a PostSubmit call
-        // that signals barrier_sem_. The following timeline wait must not be called.
-        return;
+VkResult Queue::WaitForBarrier(uint64_t seq, uint64_t timeout_ns) {
+    if (barrier_sem_ == VK_NULL_HANDLE) {
+        return VK_NOT_READY;
     }
-    retiring_.emplace_back(submission.cbs);
-    if (submission.end_batch) {
-        VkSemaphoreWaitInfo wait_info = vku::InitStructHelper();
-        wait_info.semaphoreCount = 1;
-        wait_info.pSemaphores = &barrier_sem_;
-        wait_info.pValues = &submission.seq;
-
-        if (timeline_khr_) {
-            DispatchWaitSemaphoresKHR(state_.device, &wait_info, 1000000000);
-        } else {
-            DispatchWaitSemaphores(state_.device, &wait_info, 1000000000);
+    VkSemaphoreWaitInfo wait_info = vku::InitStructHelper();
+    wait_info.semaphoreCount = 1;
+    wait_info.pSemaphores = &barrier_sem_;
+    wait_info.pValues = &seq;
+
+    if (timeline_khr_) {
+        return DispatchWaitSemaphoresKHR(state_.device, &wait_info, timeout_ns);
+    }
+    return DispatchWaitSemaphores(state_.device, &wait_info, timeout_ns);
+}
+
+void Queue::ProcessReadback(Readback &readback) {
+    const Location loc = readback.loc.Get();
+    // Command buffers for which PostProcess succeeded, secondaries right after their primary
+    std::vector<std::vector<CommandBuffer *>> update_layouts(readback.cbs.size());
+
+    // Each primary and its secondaries are processed in order on one thread, so the messages of a command buffer keep their order
+    auto post_process = [this, &readback, &update_layouts, &loc](size_t i) {
+        auto *gpu_cb = static_cast<CommandBuffer *>(readback.cbs[i].get());
+        auto guard = gpu_cb->WriteLock();
+        if (gpu_cb->PostProcess(VkHandle(), loc)) {
+            update_layouts[i].emplace_back(gpu_cb);
         }
+        for (auto *secondary_cb : gpu_cb->linkedCommandBuffers) {
+            auto *secondary_gpu_cb = static_cast<CommandBuffer *>(secondary_cb);
+            auto secondary_guard = secondary_gpu_cb->WriteLock();
+            if (secondary_gpu_cb->PostProcess(VkHandle(), loc)) {
+                update_layouts[i].emplace_back(secondary_gpu_cb);
+            }
+        }
+    };
+    if (state_.post_process_pool_ && readback.cbs.size() > 1) {
+        // An internal error disables GPU-AV, it is reported once no task uses it anymore
+        std::vector<std::optional<Validator::DeferredInternalError>> internal_errors(readback.cbs.size());
+        vvl::TaskGroup tasks(*state_.post_process_pool_);
+        for (size_t i = 0; i < readback.cbs.size(); ++i) {
+            tasks.Post([&post_process, &internal_errors, i]() {
+                Validator::deferred_internal_error = &internal_errors[i];
+                post_process(i);
+                Validator::deferred_internal_error = nullptr;
+            });
+        }
+        tasks.Wait();
+        for (const auto &internal_error : internal_errors) {
+            if (internal_error) {
+                state_.ReportDeferredInternalError(*internal_error, loc);
+                break;
+            }
+        }
+    } else {
+        for (size_t i = 0; i < readback.cbs.size(); ++i) {
+            post_process(i);
+        }
+    }
+
+    // The global image layouts depend on the order of the command buffers
+    for (const auto &cbs : update_layouts) {
+        for (CommandBuffer *gpu_cb : cbs) {
+            auto guard = gpu_cb->WriteLock();
+            UpdateCmdBufImageLayouts(state_, *gpu_cb);
+        }
+    }
+    readback.cbs.clear();
+}
+
+void Queue::RecycleReadback(Readback &readback) {
+    spare_draw_validation_cbs_.insert(spare_draw_validation_cbs_.end(), readback.draw_validation_cbs.begin(),
+                                      readback.draw_validation_cbs.end());
+    readback.draw_validation_cbs.clear();
+    if (readback.cbs.capacity() > spare_cbs_.capacity()) {
+        readback.cbs.clear();
+        spare_cbs_ = std::move(readback.cbs);
+    }
+}
+
+// Runs on readback_thread_
+void Queue::ReadbackThread() {
+    // Short enough for the thread to notice the queue going away while the GPU is still busy
+    constexpr uint64_t kPollTimeoutNs = 10 * 1000 * 1000;
 
-        for (auto &cbs : retiring_) {
-            for (auto &cb : cbs) {
-                auto gpu_cb = std::static_pointer_cast<CommandBuffer>(cb);
-                auto guard = gpu_cb->WriteLock();
-                auto loc = submission.loc.Get();
-                gpu_cb->PostProcess(VkHandle(), loc);
-                for (auto *secondary_cb : gpu_cb->linkedCommandBuffers) {
-                    auto *secondary_gpu_cb = static_cast<CommandBuffer *>(secondary_cb);
-                    auto secondary_guard = secondary_gpu_cb->WriteLock();
-                    secondary_gpu_cb->PostProcess(VkHandle(), loc);
-                }
+    std::unique_lock<std::mutex> guard(readback_lock_);
+    while (true) {
+        readback_cond_.wait(guard, [this] { return readback_exit_ || (!readbacks_.empty() && !readback_busy_); });
+        if (readback_exit_) {
+            break;
+        }
+        const uint64_t seq = readbacks_.front().seq;
+        guard.unlock();
+        const VkResult result = WaitForBarrier(seq, kPollTimeoutNs);
+        guard.lock();
+        if (result != VK_SUCCESS && result != VK_TIMEOUT) {
+            // Most likely a lost device, stop polling and leave the remaining readbacks to Retire
+            break;
+        }
+        // Retire may have taken the readback while the lock was released
+        if (result != VK_SUCCESS || readback_busy_ || readbacks_.empty() || readbacks_.front().seq != seq) {
+            continue;
+        }
+        Readback readback = std::move(readbacks_.front());
+        readbacks_.pop_front();
+        readback_busy_ = true;
+        readback_seq_ = seq;
+        guard.unlock();
+
+        ProcessReadback(readback);
+
+        guard.lock();
+        RecycleReadback(readback);
+        readback_busy_ = false;
+        readback_cond_.notify_all();
+    }
+}
+
+// Make sure the errors of all batches up to and including seq have been reported
+void Queue::WaitForReadback(uint64_t seq) {
+    std::unique_lock<std::mutex> guard(readback_lock_);
+    while (true) {
+        if (readback_busy_) {
+            if (readback_seq_ > seq) {
+                return;
             }
+            readback_cond_.wait(guard);
+            continue;
         }
-        retiring_.clear();
+        if (readbacks_.empty() || readbacks_.front().seq > seq) {
+            return;
+        }
+        // The readback thread did not get to it yet (or is not running), do it here
+        Readback readback = std::move(readbacks_.front());
+        readbacks_.pop_front();
+        readback_busy_ = true;
+        readback_seq_ = readback.seq;
+        guard.unlock();
+
+        WaitForBarrier(readback.seq, 1000000000);
+        ProcessReadback(readback);
+
+        guard.lock();
+        RecycleReadback(readback);
+        readback_busy_ = false;
+        readback_cond_.notify_all();
+    }
+}
+
+void Queue::RetireBatch(vvl::span<vvl::QueueSubmission *const> submissions) {
+    uint64_t last_batch_seq = 0;
+    for (vvl::QueueSubmission *submission : submissions) {
+        Retire(*submission);
+        // Present batch does not have any GPU-AV work to post process, skip it.
+        // QueuePresent does not have a PostSubmit call that queues a readback either.
+        if (submission->end_batch && submission->loc.Get().function != vvl::Func::vkQueuePresentKHR) {
+            last_batch_seq = submission->seq;
+        }
+    }
+    if (last_batch_seq != 0) {
+        // Usually a no-op, the readback thread has already processed the batches once the GPU signaled barrier_sem_.
+        // Waiting for the last one processes the ones before it.
+        WaitForReadback(last_batch_seq);
     }
 }
 
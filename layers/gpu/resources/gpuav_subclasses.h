@@ -17,9 +17,16 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <vector>
 
 #include "external/inplace_function.h"
+#include "gpu/cmd_validation/gpuav_copy_buffer_to_image.h"
+#include "gpu/cmd_validation/gpuav_draw.h"
 #include "gpu/descriptor_validation/gpuav_descriptor_set.h"
 #include "gpu/resources/gpuav_resources.h"
 
@@ -39,11 +46,13 @@ struct DescriptorCommandBinding;
 
 struct DebugPrintfBufferInfo {
     DeviceMemoryBlock output_mem_block;
+    uint32_t buffer_size;
     VkPipelineBindPoint pipeline_bind_point;
     uint32_t action_command_index;
-    DebugPrintfBufferInfo(DeviceMemoryBlock output_mem_block, VkPipelineBindPoint pipeline_bind_point,
+    DebugPrintfBufferInfo(DeviceMemoryBlock output_mem_block, uint32_t buffer_size, VkPipelineBindPoint pipeline_bind_point,
                           uint32_t action_command_index)
         : output_mem_block(output_mem_block),
+          buffer_size(buffer_size),
           pipeline_bind_point(pipeline_bind_point),
           action_command_index(action_command_index){};
 };
@@ -63,7 +72,9 @@ class CommandBuffer : public vvl::CommandBuffer {
     ~CommandBuffer();
 
     bool PreProcess(const Location &loc);
-    void PostProcess(VkQueue queue, const Location &loc);
+    // Returns true if the image layouts of the command buffer can be applied to the global image layouts, which the caller
+    // does in submission order
+    [[nodiscard]] bool PostProcess(VkQueue queue, const Location &loc);
     [[nodiscard]] bool ValidateBindlessDescriptorSets(const Location &loc);
 
     const VkDescriptorSetLayout &GetInstrumentationDescriptorSetLayout() const {
@@ -90,6 +101,7 @@ class CommandBuffer : public vvl::CommandBuffer {
     }
 
     VkDeviceSize GetCmdErrorsCountsBufferByteSize() const { return 8192 * sizeof(uint32_t); }
+    DeviceMemoryBlockSizeClass GetCmdErrorsCountsBufferSizeClass() const;
 
     const VkBuffer &GetCmdErrorsCountsBuffer() const {
         assert(cmd_errors_counts_buffer_.Buffer() != VK_NULL_HANDLE);
@@ -112,6 +124,17 @@ class CommandBuffer : public vvl::CommandBuffer {
 
     std::vector<DebugPrintfBufferInfo> debug_printf_buffer_infos;
 
+    // Set by InsertCopyBufferToImageValidation()
+    std::optional<CopyBufferToImageValidationBatch> copy_buffer_to_image_batch;
+
+    // Set by InsertIndirectDrawValidation(), recorded by the queue when the command buffer is submitted
+    std::vector<BatchedIndirectDrawValidation> batched_indirect_draw_validations;
+    // Set by a barrier that can make indirect buffer writes visible to the draws recorded after it
+    bool indirect_buffers_written = false;
+
+    // Lazily instrumented pipelines bound by this command buffer, only tracked with uninstrument_clean_pipelines_count
+    vvl::unordered_set<std::shared_ptr<vvl::Pipeline>> lazy_instrumented_pipelines;
+
   private:
     void AllocateResources(const Location &loc);
     void ResetCBState();
@@ -135,7 +158,8 @@ class CommandBuffer : public vvl::CommandBuffer {
     DeviceMemoryBlock cmd_errors_counts_buffer_;
     // Buffer storing a snapshot of buffer device address ranges
     DeviceMemoryBlock bda_ranges_snapshot_;
-    uint32_t bda_ranges_snapshot_version_ = 0;
+    // kU32Max until the snapshot was written once, a recycled memory block holds the table of another command buffer
+    uint32_t bda_ranges_snapshot_version_ = vvl::kU32Max;
 };
 
 class Queue : public vvl::Queue {
@@ -148,14 +172,53 @@ class Queue : public vvl::Queue {
     vvl::PreSubmitResult PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) override;
     void PostSubmit(vvl::QueueSubmission &) override;
     void SubmitBarrier(const Location &loc, uint64_t seq);
-    void Retire(vvl::QueueSubmission &) override;
+    void SubmitBatchedIndirectDrawValidations(const std::vector<vvl::QueueSubmission> &submissions, const Location &loc);
+    void RetireBatch(vvl::span<vvl::QueueSubmission *const> submissions) override;
+
+    // The error buffers of a submitted batch, read back once barrier_sem_ reaches seq
+    struct Readback {
+        uint64_t seq;
+        vvl::LocationCapture loc;
+        std::vector<std::shared_ptr<vvl::CommandBuffer>> cbs;
+        // Submitted before the command buffers, see SubmitBatchedIndirectDrawValidations()
+        std::vector<VkCommandBuffer> draw_validation_cbs;
+    };
+    // Readbacks are normally done by the readback thread as soon as the GPU is done with the batch, so that neither the
+    // submitting thread nor the retire pool have to wait for the post processing when the application waits on a fence.
+    void ReadbackThread();
+    VkResult WaitForBarrier(uint64_t seq, uint64_t timeout_ns);
+    void ProcessReadback(Readback &readback);
+    // Called with readback_lock_ held once a readback is processed
+    void RecycleReadback(Readback &readback);
+    void WaitForReadback(uint64_t seq);
 
     Validator &state_;
     VkCommandPool barrier_command_pool_{VK_NULL_HANDLE};
     VkCommandBuffer barrier_command_buffer_{VK_NULL_HANDLE};
     VkSemaphore barrier_sem_{VK_NULL_HANDLE};
-    std::deque<std::vector<std::shared_ptr<vvl::CommandBuffer>>> retiring_;
     const bool timeline_khr_;
+
+    // Command buffers of the submissions since the last end_batch, accessed only by the submitting thread
+    std::vector<std::shared_ptr<vvl::CommandBuffer>> batch_cbs_;
+    // Batched indirect draws validation command buffers submitted since the last end_batch, accessed only by the submitting
+    // thread like the pool they are allocated from
+    std::vector<VkCommandBuffer> draw_validation_cbs_;
+    VkCommandPool draw_validation_command_pool_{VK_NULL_HANDLE};
+
+    // All members below are accessed with readback_lock_ held
+    std::mutex readback_lock_;
+    // signaled when a readback is queued, is done or when the readback thread must exit
+    std::condition_variable readback_cond_;
+    std::deque<Readback> readbacks_;
+    // Storage of a processed readback, reused by the next batch so steady state submits don't allocate it
+    std::vector<std::shared_ptr<vvl::CommandBuffer>> spare_cbs_;
+    // Draw validation command buffers the GPU is done with, reset before being recorded again
+    std::vector<VkCommandBuffer> spare_draw_validation_cbs_;
+    // Sequence number of the last batch that has been read back, or of the one being read back when readback_busy_ is set
+    uint64_t readback_seq_{0};
+    bool readback_busy_{false};
+    bool readback_exit_{false};
+    std::thread readback_thread_;
 };
 
 class Buffer : public vvl::Buffer {
@@ -201,7 +201,7 @@ void DebugPrintfPass::CreateFunctionCall(BasicBlockIt block_it, InstructionIt* i
     BasicBlock& block = **block_it;
     Function& block_func = block.function_;
     // need to call to get the underlying 4 IDs (simpler to pass in as 4 uint then a uvec4)
-    GetStageInfo(block_func, block_it, *inst_it);
+    GetStageInfo(block_func);
 
     const uint32_t inst_position = target_instruction_->position_index_;
     auto inst_position_constant = module_.type_manager_.CreateConstantUInt32(inst_position);
@@ -364,9 +364,10 @@ void DebugPrintfPass::CreateBufferWriteFunction(uint32_t argument_count, uint32_
     }
 
     new_function->InitBlocks(3);
-    auto& check_block = new_function->blocks_[0];
-    auto& store_block = new_function->blocks_[1];
-    auto& merge_block = new_function->blocks_[2];
+    auto block_it = new_function->blocks_.begin();
+    auto& check_block = *block_it++;
+    auto& store_block = *block_it++;
+    auto& merge_block = *block_it;
 
     const Type& uint32_type = module_.type_manager_.GetTypeInt(32, false);
     const uint32_t pointer_type_id = module_.type_manager_.GetTypePointer(spv::StorageClassStorageBuffer, uint32_type).Id();
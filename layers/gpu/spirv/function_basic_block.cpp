@@ -48,7 +48,7 @@ BasicBlock::BasicBlock(Module& module, Function& function) : function_(function)
     CreateInstruction(spv::OpLabel, {new_label_id});
 }
 
-uint32_t BasicBlock::GetLabelId() { return (*(instructions_[0])).ResultId(); }
+uint32_t BasicBlock::GetLabelId() { return instructions_.front()->ResultId(); }
 
 InstructionIt BasicBlock::GetFirstInjectableInstrution() {
     InstructionIt inst_it;
@@ -118,7 +118,6 @@ BasicBlockIt Function::InsertNewBlock(BasicBlockIt it) {
 }
 
 void Function::InitBlocks(uint32_t count) {
-    blocks_.reserve(blocks_.size() + count);
     for (uint32_t i = 0; i < count; i++) {
         auto new_block = std::make_unique<BasicBlock>(module_, *this);
         blocks_.emplace_back(std::move(new_block));
@@ -15,10 +15,12 @@
 #pragma once
 
 #include <stdint.h>
+#include <list>
 #include <vector>
 #include <memory>
 #include <spirv/unified1/spirv.hpp>
 #include "containers/custom_containers.h"
+#include "instruction_arena.h"
 
 namespace gpuav {
 namespace spirv {
@@ -28,9 +30,11 @@ struct Function;
 struct Instruction;
 
 // Core data structure of module.
-// The vector acts as our linked list to iterator and make occasional insertions.
+// Instrumentation inserts instructions all over large functions, so a linked list keeps each insertion O(1) and keeps the
+// iterators of the surrounding instructions valid. Moving the tail of a block to a new block is a splice().
 // The unique_ptr allows us to create instructions outside module scope and bring them back.
-using InstructionList = std::vector<std::unique_ptr<Instruction>>;
+// The nodes come from the arena of the Module, like the instructions they hold.
+using InstructionList = std::list<std::unique_ptr<Instruction>, InstructionArenaAllocator<std::unique_ptr<Instruction>>>;
 using InstructionIt = InstructionList::iterator;
 
 // Since CFG analysis/manipulation is not a main focus, Blocks/Funcitons are just simple containers for ordering Instructions
@@ -59,7 +63,8 @@ struct BasicBlock {
     bool loop_header_ = false;
 };
 
-using BasicBlockList = std::vector<std::unique_ptr<BasicBlock>>;
+// A list for the same reasons as InstructionList, blocks are split when a check is wrapped around an instruction
+using BasicBlockList = std::list<std::unique_ptr<BasicBlock>, InstructionArenaAllocator<std::unique_ptr<BasicBlock>>>;
 using BasicBlockIt = BasicBlockList::iterator;
 
 struct Function {
@@ -68,8 +73,8 @@ struct Function {
 
     void ToBinary(std::vector<uint32_t>& out);
 
-    const Instruction& GetDef() { return *pre_block_inst_[0].get(); }
-    BasicBlock& GetFirstBlock() { return *blocks_[0]; }
+    const Instruction& GetDef() { return *pre_block_inst_.front().get(); }
+    BasicBlock& GetFirstBlock() { return *blocks_.front(); }
 
     // Adds a new block after and returns reference to it
     BasicBlockIt InsertNewBlock(BasicBlockIt it);
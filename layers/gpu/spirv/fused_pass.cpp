@@ -0,0 +1,105 @@
+/* Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fused_pass.h"
+#include "module.h"
+
+namespace gpuav {
+namespace spirv {
+
+void FusedPass::Add(InjectionPass& pass) {
+    if (!pass.Enabled()) return;
+    passes_.emplace_back(&pass);
+    splits_blocks_ |= pass.splits_blocks_;
+}
+
+bool FusedPass::Run() {
+    if (passes_.empty()) return false;
+
+    // Can safely loop function list as there is no injecting of new Functions until linking time
+    for (const auto& function : module_.functions_) {
+        for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
+            if ((*block_it)->loop_header_) {
+                continue;  // Currently can't properly handle injecting CFG logic into a loop header block
+            }
+            // |block_it| can move forward to a block split from this one, so the end is checked each time
+            for (auto inst_it = (*block_it)->instructions_.begin(); inst_it != (*block_it)->instructions_.end(); ++inst_it) {
+                InstrumentInstruction(*function, block_it, inst_it);
+            }
+        }
+    }
+
+    bool changed = false;
+    for (const InjectionPass* pass : passes_) {
+        changed |= pass->instrumentations_count_ != 0;
+    }
+    return changed;
+}
+
+// On return |block_it| and |inst_it| are where the walk goes on from
+void FusedPass::InstrumentInstruction(Function& function, BasicBlockIt& block_it, InstructionIt& inst_it) {
+    // Where the targeted instruction currently is
+    BasicBlockIt target_block_it = block_it;
+    InstructionIt target_inst_it = inst_it;
+    bool instrumented = false;
+    bool split = false;
+
+    for (InjectionPass* pass : passes_) {
+        if (module_.max_instrumentations_count_ != 0 && pass->instrumentations_count_ >= module_.max_instrumentations_count_) {
+            continue;  // hit limit
+        }
+        // Every instruction is analyzed by the specific pass and lets us know if we need to inject a function or not
+        if (!pass->RequiresInstrumentation(function, **target_inst_it)) continue;
+        pass->instrumentations_count_++;
+        instrumented = true;
+
+        // Add any debug information to pass into the function call
+        InjectionData injection_data;
+        injection_data.stage_info_id = pass->GetStageInfo(function);
+        const uint32_t inst_position = pass->target_instruction_->position_index_;
+        auto inst_position_constant = module_.type_manager_.CreateConstantUInt32(inst_position);
+        injection_data.inst_position_id = inst_position_constant.Id();
+
+        BasicBlockIt rest_block_it;
+        if (pass->InjectFunction(function, target_block_it, target_inst_it, injection_data, rest_block_it) && !split) {
+            // The rest of the block was moved to a new block by the outermost check, start from its label. The blocks in
+            // between are the checks themselves and only need to be looked at by the passes after this one.
+            split = true;
+            block_it = rest_block_it;
+            inst_it = (*block_it)->instructions_.begin();
+        }
+    }
+
+    // TODO - This should be cleaned up then having it injected here
+    // we can have a situation where the incoming SPIR-V looks like
+    // %a = OpSampledImage %type %image %sampler
+    // ... other stuff we inject a
+    // function around
+    // %b = OpImageSampleExplicitLod %type2 %a %3893 Lod %3918
+    // and we get an error "All OpSampledImage instructions must be in the same block in which their Result <id> are
+    // consumed" to get around this we inject a OpCopyObject right after the OpSampledImage
+    if (!instrumented && splits_blocks_ && (*inst_it)->Opcode() == spv::OpSampledImage) {
+        const uint32_t result_id = (*inst_it)->ResultId();
+        const uint32_t type_id = (*inst_it)->TypeId();
+        const uint32_t copy_id = module_.TakeNextId();
+        function.ReplaceAllUsesWith(result_id, copy_id);
+        inst_it++;
+        (*block_it)->CreateInstruction(spv::OpCopyObject, {type_id, copy_id, result_id}, &inst_it);
+        inst_it--;
+    }
+}
+
+}  // namespace spirv
+}  // namespace gpuav
@@ -0,0 +1,46 @@
+/* Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <vector>
+#include "pass.h"
+
+namespace gpuav {
+namespace spirv {
+
+// Runs several InjectionPass with a single walk over the module.
+// Every instruction is offered to each pass in the order they were added. When a pass wraps the instruction in a check, the
+// following passes look at it again where it was moved to, so the first pass added ends up with the outermost check, the same as
+// running the passes one after the other. The walk then goes on with the instructions after it, so each block of the original
+// module is only walked once instead of once per pass.
+class FusedPass {
+  public:
+    FusedPass(Module& module) : module_(module) {}
+
+    // Passes that are not enabled for this module are ignored
+    void Add(InjectionPass& pass);
+    // Returns true if any pass instrumented something
+    bool Run();
+
+  private:
+    void InstrumentInstruction(Function& function, BasicBlockIt& block_it, InstructionIt& inst_it);
+
+    Module& module_;
+    std::vector<InjectionPass*> passes_;
+    bool splits_blocks_ = false;
+};
+
+}  // namespace spirv
+}  // namespace gpuav
@@ -19,21 +19,24 @@
 namespace gpuav {
 namespace spirv {
 
-InjectConditionalFunctionPass::InjectConditionalFunctionPass(Module& module) : Pass(module) { module.use_bda_ = true; }
+InjectConditionalFunctionPass::InjectConditionalFunctionPass(Module& module) : InjectionPass(module, true) {
+    module.use_bda_ = true;
+}
 
-BasicBlockIt InjectConditionalFunctionPass::InjectFunction(Function* function, BasicBlockIt block_it, InstructionIt inst_it,
-                                                           const InjectionData& injection_data) {
+bool InjectConditionalFunctionPass::InjectFunction(Function& function, BasicBlockIt& block_it, InstructionIt& inst_it,
+                                                   const InjectionData& injection_data, BasicBlockIt& rest_block_it) {
     // We turn the block into 4 separate blocks
-    block_it = function->InsertNewBlock(block_it);
-    block_it = function->InsertNewBlock(block_it);
-    block_it = function->InsertNewBlock(block_it);
-    BasicBlock& original_block = **(std::prev(block_it, 3));
+    const BasicBlockIt original_block_it = block_it;
+    const BasicBlockIt valid_block_it = function.InsertNewBlock(original_block_it);
+    const BasicBlockIt invalid_block_it = function.InsertNewBlock(valid_block_it);
+    const BasicBlockIt merge_block_it = function.InsertNewBlock(invalid_block_it);
+    BasicBlock& original_block = **original_block_it;
     // Where we call targeted instruction if it is valid
-    BasicBlock& valid_block = **(std::prev(block_it, 2));
+    BasicBlock& valid_block = **valid_block_it;
     // will be an empty block, used for the Phi node, even if no result, create for simplicity
-    BasicBlock& invalid_block = **(std::prev(block_it, 1));
+    BasicBlock& invalid_block = **invalid_block_it;
     // All the remaining block instructions after targeted instruction
-    BasicBlock& merge_block = **block_it;
+    BasicBlock& merge_block = **merge_block_it;
 
     const uint32_t original_label = original_block.GetLabelId();
     const uint32_t valid_block_label = valid_block.GetLabelId();
@@ -41,11 +44,12 @@ BasicBlockIt InjectConditionalFunctionPass::InjectFunction(Function* function, B
     const uint32_t merge_block_label = merge_block.GetLabelId();
 
     // need to preserve the control-flow of how things, like a OpPhi, are accessed from a predecessor block
-    function->ReplaceAllUsesWith(original_label, merge_block_label);
+    function.ReplaceAllUsesWith(original_label, merge_block_label);
 
-    // Move the targeted instruction to a valid block
-    const Instruction& target_inst = *valid_block.instructions_.emplace_back(std::move(*inst_it));
-    inst_it = original_block.instructions_.erase(inst_it);
+    // Move the targeted instruction to a valid block, splicing keeps |inst_it| pointing at it
+    const InstructionIt remaining_inst_it = std::next(inst_it);
+    valid_block.instructions_.splice(valid_block.instructions_.end(), original_block.instructions_, inst_it);
+    const Instruction& target_inst = **inst_it;
     valid_block.CreateInstruction(spv::OpBranch, {merge_block_label});
 
     // If thre is a result, we need to create an additional BasicBlock to hold the |else| case, then after we create a Phi node to
@@ -80,7 +84,7 @@ BasicBlockIt InjectConditionalFunctionPass::InjectFunction(Function* function, B
         }
 
         // replace before creating instruction, otherwise will over-write itself
-        function->ReplaceAllUsesWith(target_inst_id, phi_id);
+        function.ReplaceAllUsesWith(target_inst_id, phi_id);
         merge_block.CreateInstruction(spv::OpPhi,
                                       {phi_type.Id(), phi_id, target_inst_id, valid_block_label, null_id, invalid_block_label});
     }
@@ -99,9 +103,8 @@ BasicBlockIt InjectConditionalFunctionPass::InjectFunction(Function* function, B
     invalid_block.CreateInstruction(spv::OpBranch, {merge_block_label});
 
     // move all remaining instructions to the newly created merge block
-    merge_block.instructions_.insert(merge_block.instructions_.end(), std::make_move_iterator(inst_it),
-                                     std::make_move_iterator(original_block.instructions_.end()));
-    original_block.instructions_.erase(inst_it, original_block.instructions_.end());
+    merge_block.instructions_.splice(merge_block.instructions_.end(), original_block.instructions_, remaining_inst_it,
+                                     original_block.instructions_.end());
 
     // Go back to original Block and add function call and branch from the bool result
     const uint32_t function_result = CreateFunctionCall(original_block, nullptr, injection_data);
@@ -111,61 +114,9 @@ BasicBlockIt InjectConditionalFunctionPass::InjectFunction(Function* function, B
 
     Reset();
 
-    return block_it;
-}
-
-bool InjectConditionalFunctionPass::Run() {
-    // Can safely loop function list as there is no injecting of new Functions until linking time
-    for (const auto& function : module_.functions_) {
-        for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
-            if ((*block_it)->loop_header_) {
-                continue;  // Currently can't properly handle injecting CFG logic into a loop header block
-            }
-            auto& block_instructions = (*block_it)->instructions_;
-            for (auto inst_it = block_instructions.begin(); inst_it != block_instructions.end(); ++inst_it) {
-                // Every instruction is analyzed by the specific pass and lets us know if we need to inject a function or not
-                if (!RequiresInstrumentation(*function, *(inst_it->get()))) {
-                    // TODO - This should be cleaned up then having it injected here
-                    // we can have a situation where the incoming SPIR-V looks like
-                    // %a = OpSampledImage %type %image %sampler
-                    // ... other stuff we inject a
-                    // function around
-                    // %b = OpImageSampleExplicitLod %type2 %a %3893 Lod %3918
-                    // and we get an error "All OpSampledImage instructions must be in the same block in which their Result <id> are
-                    // consumed" to get around this we inject a OpCopyObject right after the OpSampledImage
-                    if ((*inst_it)->Opcode() == spv::OpSampledImage) {
-                        const uint32_t result_id = (*inst_it)->ResultId();
-                        const uint32_t type_id = (*inst_it)->TypeId();
-                        const uint32_t copy_id = module_.TakeNextId();
-                        function->ReplaceAllUsesWith(result_id, copy_id);
-                        inst_it++;
-                        (*block_it)->CreateInstruction(spv::OpCopyObject, {type_id, copy_id, result_id}, &inst_it);
-                        inst_it--;
-                    }
-                    continue;
-                }
-
-                if (module_.max_instrumentations_count_ != 0 && instrumentations_count_ >= module_.max_instrumentations_count_) {
-                    return true;  // hit limit
-                }
-                instrumentations_count_++;
-
-                // Add any debug information to pass into the function call
-                InjectionData injection_data;
-                injection_data.stage_info_id = GetStageInfo(*function, block_it, inst_it);
-                const uint32_t inst_position = target_instruction_->position_index_;
-                auto inst_position_constant = module_.type_manager_.CreateConstantUInt32(inst_position);
-                injection_data.inst_position_id = inst_position_constant.Id();
-
-                block_it = InjectFunction(function.get(), block_it, inst_it, injection_data);
-                // will start searching again from newly split merge block
-                block_it--;
-                break;
-            }
-        }
-    }
-
-    return instrumentations_count_ != 0;
+    block_it = valid_block_it;
+    rest_block_it = merge_block_it;
+    return true;
 }
 
 }  // namespace spirv
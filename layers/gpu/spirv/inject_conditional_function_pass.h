@@ -44,22 +44,12 @@ namespace spirv {
 //    } else {
 //         int Y = 0;
 //    }
-class InjectConditionalFunctionPass : public Pass {
-  public:
-    bool Run();
-
+class InjectConditionalFunctionPass : public InjectionPass {
   protected:
     InjectConditionalFunctionPass(Module& module);
 
-    BasicBlockIt InjectFunction(Function* function, BasicBlockIt block_it, InstructionIt inst_it,
-                                const InjectionData& injection_data);
-
-    // Each pass decides if the instruction should needs to have its function check injected
-    virtual bool RequiresInstrumentation(const Function& function, const Instruction& inst) = 0;
-    // A callback from the function injection logic.
-    // Each pass creates a OpFunctionCall and returns its result id.
-    // If |inst_it| is not null, it will update it to instruction post OpFunctionCall
-    virtual uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InjectionData& injection_data) = 0;
+    bool InjectFunction(Function& function, BasicBlockIt& block_it, InstructionIt& inst_it, const InjectionData& injection_data,
+                        BasicBlockIt& rest_block_it) final;
 };
 
 }  // namespace spirv
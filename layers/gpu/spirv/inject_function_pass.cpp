@@ -19,40 +19,61 @@
 namespace gpuav {
 namespace spirv {
 
-InjectFunctionPass::InjectFunctionPass(Module& module) : Pass(module) { module.use_bda_ = true; }
-
-bool InjectFunctionPass::Run() {
-    // Can safely loop function list as there is no injecting of new Functions until linking time
-    for (const auto& function : module_.functions_) {
-        for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
-            if ((*block_it)->loop_header_) {
-                continue;  // Currently can't properly handle injecting CFG logic into a loop header block
-            }
-            auto& block_instructions = (*block_it)->instructions_;
-            for (auto inst_it = block_instructions.begin(); inst_it != block_instructions.end(); ++inst_it) {
-                // Every instruction is analyzed by the specific pass and lets us know if we need to inject a function or not
-                if (!RequiresInstrumentation(*function, *(inst_it->get()))) continue;
-
-                if (module_.max_instrumentations_count_ != 0 && instrumentations_count_ >= module_.max_instrumentations_count_) {
-                    return true;  // hit limit
-                }
-                instrumentations_count_++;
-
-                // Add any debug information to pass into the function call
-                InjectionData injection_data;
-                injection_data.stage_info_id = GetStageInfo(*function, block_it, inst_it);
-                const uint32_t inst_position = target_instruction_->position_index_;
-                auto inst_position_constant = module_.type_manager_.CreateConstantUInt32(inst_position);
-                injection_data.inst_position_id = inst_position_constant.Id();
-
-                // inst_it is updated to the instruction after the new function call, it will not add/remove any Blocks
-                CreateFunctionCall(**block_it, &inst_it, injection_data);
-                Reset();
-            }
-        }
+InjectFunctionPass::InjectFunctionPass(Module& module, bool has_fast_path)
+    : InjectionPass(module, has_fast_path), has_fast_path_(has_fast_path) {
+    module.use_bda_ = true;
+}
+
+bool InjectFunctionPass::InjectFunction(Function& function, BasicBlockIt& block_it, InstructionIt& inst_it,
+                                        const InjectionData& injection_data, BasicBlockIt& rest_block_it) {
+    const uint32_t fast_path_result = has_fast_path_ ? CreateFastPathCheck(**block_it, &inst_it) : 0;
+    if (fast_path_result == 0) {
+        // inst_it is updated to the instruction after the new function call, it will not add/remove any Blocks
+        CreateFunctionCall(**block_it, &inst_it, injection_data);
+        Reset();
+        return false;
     }
 
-    return instrumentations_count_ != 0;
+    // We turn the block into 4 separate blocks, the targeted instruction is always executed as without a fast path
+    const BasicBlockIt original_block_it = block_it;
+    const BasicBlockIt call_block_it = function.InsertNewBlock(original_block_it);
+    const BasicBlockIt target_block_it = function.InsertNewBlock(call_block_it);
+    const BasicBlockIt remaining_block_it = function.InsertNewBlock(target_block_it);
+    BasicBlock& original_block = **original_block_it;
+    // Only reached if the fast path check fails
+    BasicBlock& call_block = **call_block_it;
+    // Holds the targeted instruction, merges the fast path selection
+    BasicBlock& target_block = **target_block_it;
+    // All the remaining block instructions after targeted instruction
+    BasicBlock& remaining_block = **remaining_block_it;
+
+    const uint32_t original_label = original_block.GetLabelId();
+    const uint32_t call_block_label = call_block.GetLabelId();
+    const uint32_t target_block_label = target_block.GetLabelId();
+    const uint32_t remaining_block_label = remaining_block.GetLabelId();
+
+    // need to preserve the control-flow of how things, like a OpPhi, are accessed from a predecessor block
+    function.ReplaceAllUsesWith(original_label, remaining_block_label);
+
+    // Move the targeted instruction to its own block, splicing keeps |inst_it| pointing at it
+    const InstructionIt remaining_inst_it = std::next(inst_it);
+    target_block.instructions_.splice(target_block.instructions_.end(), original_block.instructions_, inst_it);
+    target_block.CreateInstruction(spv::OpBranch, {remaining_block_label});
+    remaining_block.instructions_.splice(remaining_block.instructions_.end(), original_block.instructions_, remaining_inst_it,
+                                         original_block.instructions_.end());
+
+    // Go back to original Block and branch to the function call only if the fast path check failed
+    original_block.CreateInstruction(spv::OpSelectionMerge, {target_block_label, spv::SelectionControlMaskNone});
+    original_block.CreateInstruction(spv::OpBranchConditional, {fast_path_result, target_block_label, call_block_label});
+
+    CreateFunctionCall(call_block, nullptr, injection_data);
+    call_block.CreateInstruction(spv::OpBranch, {target_block_label});
+
+    Reset();
+
+    block_it = target_block_it;
+    rest_block_it = remaining_block_it;
+    return true;
 }
 
 }  // namespace spirv
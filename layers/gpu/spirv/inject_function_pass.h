@@ -23,19 +23,25 @@ namespace spirv {
 // We assume through other means (such as robustness) we won't crash on bad values and go
 //     PassFunction(original_value)
 //     value = original_value;
-class InjectFunctionPass : public Pass {
-  public:
-    bool Run();
-
+//
+// Passes with a fast path can instead check in the shader first and only call the function if it fails
+//     if (!FastPathCheck()) {
+//         PassFunction(original_value)
+//     }
+//     value = original_value;
+class InjectFunctionPass : public InjectionPass {
   protected:
-    InjectFunctionPass(Module& module);
+    InjectFunctionPass(Module& module, bool has_fast_path = false);
+
+    bool InjectFunction(Function& function, BasicBlockIt& block_it, InstructionIt& inst_it, const InjectionData& injection_data,
+                        BasicBlockIt& rest_block_it) final;
+
+    // Adds the instructions before |inst_it| and returns the id of a bool that is true if the targeted instruction is known to
+    // be valid. Returns 0, without adding anything, if there is no fast path for it and the function is called unconditionally.
+    virtual uint32_t CreateFastPathCheck(BasicBlock&, InstructionIt*) { return 0; }
 
-    // Each pass decides if the instruction should needs to have its function check injected
-    virtual bool RequiresInstrumentation(const Function& function, const Instruction& inst) = 0;
-    // A callback from the function injection logic.
-    // Each pass creates a OpFunctionCall and returns its result id.
-    // If |inst_it| is not null, it will update it to instruction post OpFunctionCall
-    virtual uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InjectionData& injection_data) = 0;
+  private:
+    const bool has_fast_path_;
 };
 
 }  // namespace spirv
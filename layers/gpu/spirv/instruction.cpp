@@ -59,6 +59,21 @@ Instruction::Instruction(spirv_iterator it, uint32_t position)
     UpdateDebugInfo();
 }
 
+Instruction::Instruction(const ParsedInstruction& parsed, uint32_t position)
+    : result_id_index_(parsed.result_id_index),
+      type_id_index_(parsed.type_id_index),
+      operand_index_(1 + (parsed.result_id_index != 0 ? 1 : 0) + (parsed.type_id_index != 0 ? 1 : 0)),
+      position_index_(position),
+      operand_info_(GetOperandInfo(parsed.words[0] & 0x0ffffu)) {
+    const uint32_t length = parsed.words[0] >> 16;
+    words_.reserve(length);
+    for (uint32_t i = 0; i < length; i++) {
+        words_.emplace_back(parsed.words[i]);
+    }
+
+    UpdateDebugInfo();
+}
+
 Instruction::Instruction(uint32_t length, spv::Op opcode) : operand_info_(GetOperandInfo(opcode)) {
     words_.reserve(length);
     uint32_t first_word = (length << 16) | opcode;
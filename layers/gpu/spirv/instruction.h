@@ -18,6 +18,7 @@
 #include <stddef.h>
 #include <vector>
 #include "containers/custom_containers.h"
+#include "instruction_arena.h"
 #include <spirv/unified1/spirv.hpp>
 
 struct OperandInfo;
@@ -32,14 +33,28 @@ static constexpr uint32_t kLinkedInstruction = std::numeric_limits<uint32_t>::ma
 
 class Module;
 
+// An instruction already split out of the binary by another parser (the state tracker spirv::Module).
+// The Result and Result Type word indices are 0 when the opcode has none.
+struct ParsedInstruction {
+    const uint32_t* words;
+    uint32_t result_id_index;
+    uint32_t type_id_index;
+};
+
 // Represents a single Spv::Op instruction
 struct Instruction {
     Instruction(spirv_iterator it, uint32_t position);
+    // Reuses the indices found by the other parser instead of looking up the grammar again
+    Instruction(const ParsedInstruction& parsed, uint32_t position);
 
     // Assumes caller will fill remaining words
     Instruction(uint32_t length, spv::Op opcode);
     void Fill(const std::vector<uint32_t>& words);
 
+    // Allocated from the arena of the Module being built or instrumented on this thread
+    static void* operator new(size_t size) { return InstructionArena::Allocate(size); }
+    static void operator delete(void* ptr) { InstructionArena::Deallocate(ptr); }
+
     void SetResultTypeIndex();
 
     // The word used to define the Instruction
@@ -0,0 +1,82 @@
+/* Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "instruction_arena.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <new>
+
+namespace gpuav {
+namespace spirv {
+
+thread_local InstructionArena* InstructionArena::current_ = nullptr;
+
+namespace {
+// Every allocation is prefixed with where it came from, so Deallocate() knows if it has to free anything
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+constexpr uint8_t kFromHeap = 0;
+constexpr uint8_t kFromArena = 1;
+
+size_t AlignUp(size_t size) { return (size + kHeaderSize - 1) & ~(kHeaderSize - 1); }
+}  // namespace
+
+InstructionArena::InstructionArena() : previous_(current_) { current_ = this; }
+
+InstructionArena::~InstructionArena() {
+    // Arenas are destroyed in the reverse order they were created on a thread
+    assert(current_ == this);
+    current_ = previous_;
+}
+
+void* InstructionArena::Allocate(size_t size) {
+    uint8_t* header = nullptr;
+    if (current_) {
+        header = static_cast<uint8_t*>(current_->AllocateFromBlocks(kHeaderSize + AlignUp(size)));
+        header[0] = kFromArena;
+    } else {
+        header = static_cast<uint8_t*>(::operator new(kHeaderSize + size));
+        header[0] = kFromHeap;
+    }
+    return header + kHeaderSize;
+}
+
+void InstructionArena::Deallocate(void* ptr) {
+    if (!ptr) return;
+    uint8_t* header = static_cast<uint8_t*>(ptr) - kHeaderSize;
+    if (header[0] == kFromHeap) {
+        ::operator delete(header);
+    }
+}
+
+void* InstructionArena::AllocateFromBlocks(size_t size) {
+    if (static_cast<size_t>(end_ - cursor_) < size) {
+        // Larger than a block (a huge OpConstantComposite...) gets a block of its own, the current block keeps being used
+        if (size > next_block_size_ / 4) {
+            blocks_.emplace_back(new uint8_t[size]);
+            return blocks_.back().get();
+        }
+        blocks_.emplace_back(new uint8_t[next_block_size_]);
+        cursor_ = blocks_.back().get();
+        end_ = cursor_ + next_block_size_;
+        next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+    }
+    void* result = cursor_;
+    cursor_ += size;
+    return result;
+}
+
+}  // namespace spirv
+}  // namespace gpuav
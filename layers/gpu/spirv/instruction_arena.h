@@ -0,0 +1,82 @@
+/* Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+namespace gpuav {
+namespace spirv {
+
+// Bump allocator for the Instruction objects of a Module and the list nodes holding them.
+//
+// Loading a large shader creates an Instruction per word group, and instrumenting it creates many more, so allocating each one
+// from the heap is a noticeable part of the instrumentation time. A Module owns an arena for its whole lifetime and makes it
+// current on the thread the Module is created on, the allocations done on that thread then come from it. Nothing is freed
+// until the arena is destroyed with the Module, deleting a single object is a no-op.
+//
+// Instructions must not be moved from one Module to another. Allocations made while no arena is current use the heap.
+class InstructionArena {
+  public:
+    InstructionArena();
+    ~InstructionArena();
+    InstructionArena(const InstructionArena&) = delete;
+    InstructionArena& operator=(const InstructionArena&) = delete;
+
+    static void* Allocate(size_t size);
+    static void Deallocate(void* ptr);
+
+  private:
+    void* AllocateFromBlocks(size_t size);
+
+    static constexpr size_t kFirstBlockSize = 64 * 1024;
+    static constexpr size_t kMaxBlockSize = 4 * 1024 * 1024;
+
+    std::vector<std::unique_ptr<uint8_t[]>> blocks_;
+    uint8_t* cursor_ = nullptr;
+    uint8_t* end_ = nullptr;
+    size_t next_block_size_ = kFirstBlockSize;
+    // Restored when this arena is destroyed
+    InstructionArena* previous_ = nullptr;
+
+    static thread_local InstructionArena* current_;
+};
+
+// Allocator for containers of instructions, see InstructionArena. It holds no state, so every list can splice into any other.
+template <typename T>
+struct InstructionArenaAllocator {
+    using value_type = T;
+
+    InstructionArenaAllocator() = default;
+    template <typename U>
+    InstructionArenaAllocator(const InstructionArenaAllocator<U>&) {}
+
+    T* allocate(size_t count) { return static_cast<T*>(InstructionArena::Allocate(count * sizeof(T))); }
+    void deallocate(T* ptr, size_t) { InstructionArena::Deallocate(ptr); }
+
+    template <typename U>
+    bool operator==(const InstructionArenaAllocator<U>&) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const InstructionArenaAllocator<U>&) const {
+        return false;
+    }
+};
+
+}  // namespace spirv
+}  // namespace gpuav
@@ -26,13 +26,15 @@
 #include "ray_query_pass.h"
 #include "debug_printf_pass.h"
 #include "post_process_descriptor_indexing.h"
+#include "fused_pass.h"
 
 #include <iostream>
+#include <optional>
 
 namespace gpuav {
 namespace spirv {
 
-Module::Module(vvl::span<const uint32_t> words, DebugReport* debug_report, const Settings& settings)
+Module::Module(DebugReport* debug_report, const Settings& settings)
     : type_manager_(*this),
       max_instrumentations_count_(settings.max_instrumentations_count),
       shader_id_(settings.shader_id),
@@ -40,171 +42,184 @@ Module::Module(vvl::span<const uint32_t> words, DebugReport* debug_report, const
       support_non_semantic_info_(settings.support_non_semantic_info),
       support_int64_(settings.support_int64),
       support_memory_model_device_scope_(settings.support_memory_model_device_scope),
+      inline_fast_path_checks_(settings.inline_fast_path_checks),
       has_bindless_descriptors_(settings.has_bindless_descriptors),
       print_debug_info_(settings.print_debug_info),
-      debug_report_(debug_report) {
+      debug_report_(debug_report) {}
+
+Module::Module(vvl::span<const uint32_t> words, DebugReport* debug_report, const Settings& settings)
+    : Module(debug_report, settings) {
+    ParseHeader(words);
+    ParseState state;
     uint32_t instruction_count = 0;
-    spirv_iterator it = words.begin();
-    header_.magic_number = *it++;
-    header_.version = *it++;
-    header_.generator = *it++;
-    header_.bound = *it++;
-    header_.schema = *it++;
-    // Parse everything up until the first function and sort into seperate lists
+    spirv_iterator it = words.begin() + 5;
     while (it != words.end()) {
-        const uint32_t opcode = *it & 0x0ffffu;
         const uint32_t length = *it >> 16;
-        if (opcode == spv::OpFunction) {
-            break;
-        }
-        auto new_inst = std::make_unique<Instruction>(it, instruction_count++);
+        AddParsedInstruction(std::make_unique<Instruction>(it, instruction_count++), state);
+        it += length;
+    }
+}
 
-        switch (opcode) {
-            case spv::OpCapability:
-                capabilities_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpExtension:
-                extensions_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpExtInstImport:
-                ext_inst_imports_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpMemoryModel:
-                memory_model_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpEntryPoint:
-                entry_points_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpExecutionMode:
-            case spv::OpExecutionModeId:
-                execution_modes_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpString:
-            case spv::OpSourceExtension:
-            case spv::OpSource:
-            case spv::OpSourceContinued:
-                debug_source_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpName:
-            case spv::OpMemberName:
-                debug_name_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpModuleProcessed:
-                debug_module_processed_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpLine:
-            case spv::OpNoLine:
-                // OpLine must not be groupped in between other debug operations
-                // https://github.com/KhronosGroup/SPIRV-Tools/issues/5513
-                types_values_constants_.emplace_back(std::move(new_inst));
-                break;
-            case spv::OpDecorate:
-            case spv::OpMemberDecorate:
-            case spv::OpDecorationGroup:
-            case spv::OpGroupDecorate:
-            case spv::OpGroupMemberDecorate:
-            case spv::OpDecorateId:
-            case spv::OpDecorateString:
-            case spv::OpMemberDecorateString:
-                annotations_.emplace_back(std::move(new_inst));
-                break;
-
-            case spv::OpConstantTrue:
-            case spv::OpConstantFalse: {
-                const Type& type = type_manager_.GetTypeBool();
-                type_manager_.AddConstant(std::move(new_inst), type);
-                break;
-            }
-            case spv::OpConstant:
-            case spv::OpConstantNull:
-            case spv::OpConstantComposite: {
-                const Type* type = type_manager_.FindTypeById(new_inst->TypeId());
-                type_manager_.AddConstant(std::move(new_inst), *type);
-                break;
-            }
-            case spv::OpVariable: {
-                const Type* type = type_manager_.FindTypeById(new_inst->TypeId());
-                const Variable& new_var = type_manager_.AddVariable(std::move(new_inst), *type);
-
-                // While adding the global variables, detect if descriptors is bindless or not
-                spv::StorageClass storage_class = new_var.StorageClass();
-                // These are the only storage classes that interface with a descriptor
-                // see vkspec.html#interfaces-resources-descset
-                if (storage_class == spv::StorageClassUniform || storage_class == spv::StorageClassUniformConstant ||
-                    storage_class == spv::StorageClassStorageBuffer) {
-                    const Type* ptr_type = new_var.PointerType(type_manager_);
-                    // The shader will also have OpCapability RuntimeDescriptorArray
-                    if (ptr_type->spv_type_ == SpvType::kRuntimeArray) {
-                        // TODO - This might not actually need to be marked as bindless
-                        has_bindless_descriptors_ = true;
-                    }
-                }
+Module::Module(vvl::span<const uint32_t> words, vvl::span<const ParsedInstruction> instructions, DebugReport* debug_report,
+               const Settings& settings)
+    : Module(debug_report, settings) {
+    ParseHeader(words);
+    ParseState state;
+    uint32_t instruction_count = 0;
+    for (const ParsedInstruction& parsed : instructions) {
+        AddParsedInstruction(std::make_unique<Instruction>(parsed, instruction_count++), state);
+    }
+}
 
-                break;
-            }
-            default: {
-                SpvType spv_type = GetSpvType(new_inst->Opcode());
-                if (spv_type != SpvType::Empty) {
-                    type_manager_.AddType(std::move(new_inst), spv_type);
-                } else {
-                    // unknown instruction, try and just keep in last section to not just crash
-                    // example: OpSpecConstant
-                    types_values_constants_.emplace_back(std::move(new_inst));
-                }
-                break;
-            }
-        }
+void Module::ParseHeader(vvl::span<const uint32_t> words) {
+    header_.magic_number = words[0];
+    header_.version = words[1];
+    header_.generator = words[2];
+    header_.bound = words[3];
+    header_.schema = words[4];
+}
 
-        it += length;
+void Module::AddParsedInstruction(std::unique_ptr<Instruction> new_inst, ParseState& state) {
+    const uint32_t opcode = new_inst->Opcode();
+    // Everything up until the first function is sorted into seperate lists
+    if (!state.current_function && opcode != spv::OpFunction) {
+        AddGlobalInstruction(std::move(new_inst));
+        return;
     }
 
     // each function is broken up to 3 stage, pre/during/post basic_blocks
-    BasicBlock* current_block = nullptr;
-    Function* current_function = nullptr;
-    bool block_found = false;
-    bool function_end_found = false;
-    while (it != words.end()) {
-        const uint32_t opcode = *it & 0x0ffffu;
-        const uint32_t length = *it >> 16;
-        auto new_inst = std::make_unique<Instruction>(it, instruction_count++);
+    if (opcode == spv::OpFunction) {
+        auto new_function = std::make_unique<Function>(*this, std::move(new_inst));
+        auto& added_function = functions_.emplace_back(std::move(new_function));
+        state.current_function = &(*added_function);
+        state.block_found = false;
+        state.function_end_found = false;
+        return;
+    }
 
-        if (opcode == spv::OpFunction) {
-            auto new_function = std::make_unique<Function>(*this, std::move(new_inst));
-            auto& added_function = functions_.emplace_back(std::move(new_function));
-            current_function = &(*added_function);
-            block_found = false;
-            function_end_found = false;
-            it += length;
-            continue;
-        }
+    const uint32_t result_id = new_inst->ResultId();
+    if (result_id != 0) {
+        state.current_function->inst_map_[result_id] = new_inst.get();
+    }
 
-        const uint32_t result_id = new_inst->ResultId();
-        if (result_id != 0) {
-            current_function->inst_map_[result_id] = new_inst.get();
-        }
+    if (opcode == spv::OpFunctionEnd) {
+        state.function_end_found = true;
+    }
 
-        if (opcode == spv::OpFunctionEnd) {
-            function_end_found = true;
-        }
+    if (opcode == spv::OpLoopMerge) {
+        state.current_block->loop_header_ = true;
+    }
 
-        if (opcode == spv::OpLoopMerge) {
-            current_block->loop_header_ = true;
-        }
+    if (opcode == spv::OpLabel) {
+        state.block_found = true;
+        auto new_block = std::make_unique<BasicBlock>(std::move(new_inst), *state.current_function);
+        auto& added_block = state.current_function->blocks_.emplace_back(std::move(new_block));
+        state.current_block = &(*added_block);
+    } else if (state.function_end_found) {
+        state.current_function->post_block_inst_.emplace_back(std::move(new_inst));
+    } else if (state.block_found) {
+        state.current_block->instructions_.emplace_back(std::move(new_inst));
+    } else {
+        state.current_function->pre_block_inst_.emplace_back(std::move(new_inst));
+    }
+}
 
-        if (opcode == spv::OpLabel) {
-            block_found = true;
-            auto new_block = std::make_unique<BasicBlock>(std::move(new_inst), *current_function);
-            auto& added_block = current_function->blocks_.emplace_back(std::move(new_block));
-            current_block = &(*added_block);
-        } else if (function_end_found) {
-            current_function->post_block_inst_.emplace_back(std::move(new_inst));
-        } else if (block_found) {
-            current_block->instructions_.emplace_back(std::move(new_inst));
-        } else {
-            current_function->pre_block_inst_.emplace_back(std::move(new_inst));
+void Module::AddGlobalInstruction(std::unique_ptr<Instruction> new_inst) {
+    const uint32_t opcode = new_inst->Opcode();
+    switch (opcode) {
+        case spv::OpCapability:
+            capabilities_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpExtension:
+            extensions_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpExtInstImport:
+            ext_inst_imports_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpMemoryModel:
+            memory_model_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpEntryPoint:
+            entry_points_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpExecutionMode:
+        case spv::OpExecutionModeId:
+            execution_modes_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpString:
+        case spv::OpSourceExtension:
+        case spv::OpSource:
+        case spv::OpSourceContinued:
+            debug_source_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpName:
+        case spv::OpMemberName:
+            debug_name_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpModuleProcessed:
+            debug_module_processed_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpLine:
+        case spv::OpNoLine:
+            // OpLine must not be groupped in between other debug operations
+            // https://github.com/KhronosGroup/SPIRV-Tools/issues/5513
+            types_values_constants_.emplace_back(std::move(new_inst));
+            break;
+        case spv::OpDecorate:
+        case spv::OpMemberDecorate:
+        case spv::OpDecorationGroup:
+        case spv::OpGroupDecorate:
+        case spv::OpGroupMemberDecorate:
+        case spv::OpDecorateId:
+        case spv::OpDecorateString:
+        case spv::OpMemberDecorateString:
+            annotations_.emplace_back(std::move(new_inst));
+            break;
+
+        case spv::OpConstantTrue:
+        case spv::OpConstantFalse: {
+            const Type& type = type_manager_.GetTypeBool();
+            type_manager_.AddConstant(std::move(new_inst), type);
+            break;
         }
+        case spv::OpConstant:
+        case spv::OpConstantNull:
+        case spv::OpConstantComposite: {
+            const Type* type = type_manager_.FindTypeById(new_inst->TypeId());
+            type_manager_.AddConstant(std::move(new_inst), *type);
+            break;
+        }
+        case spv::OpVariable: {
+            const Type* type = type_manager_.FindTypeById(new_inst->TypeId());
+            const Variable& new_var = type_manager_.AddVariable(std::move(new_inst), *type);
+
+            // While adding the global variables, detect if descriptors is bindless or not
+            spv::StorageClass storage_class = new_var.StorageClass();
+            // These are the only storage classes that interface with a descriptor
+            // see vkspec.html#interfaces-resources-descset
+            if (storage_class == spv::StorageClassUniform || storage_class == spv::StorageClassUniformConstant ||
+                storage_class == spv::StorageClassStorageBuffer) {
+                const Type* ptr_type = new_var.PointerType(type_manager_);
+                // The shader will also have OpCapability RuntimeDescriptorArray
+                if (ptr_type->spv_type_ == SpvType::kRuntimeArray) {
+                    // TODO - This might not actually need to be marked as bindless
+                    has_bindless_descriptors_ = true;
+                }
+            }
 
-        it += length;
+            break;
+        }
+        default: {
+            SpvType spv_type = GetSpvType(new_inst->Opcode());
+            if (spv_type != SpvType::Empty) {
+                type_manager_.AddType(std::move(new_inst), spv_type);
+            } else {
+                // unknown instruction, try and just keep in last section to not just crash
+                // example: OpSpecConstant
+                types_values_constants_.emplace_back(std::move(new_inst));
+            }
+            break;
+        }
     }
 }
 
@@ -343,6 +358,32 @@ bool Module::RunPassPostProcessDescriptorIndexing() {
     return changed;
 }
 
+bool Module::RunFusedPasses(const FusedPassSelection& selection) {
+    // Only construct what is selected, the passes change the module settings when created
+    std::optional<BindlessDescriptorPass> bindless_descriptor_pass;
+    std::optional<NonBindlessOOBBufferPass> non_bindless_oob_buffer_pass;
+    std::optional<NonBindlessOOBTexelBufferPass> non_bindless_oob_texel_buffer_pass;
+    std::optional<BufferDeviceAddressPass> buffer_device_address_pass;
+    std::optional<RayQueryPass> ray_query_pass;
+
+    FusedPass fused_pass(*this);
+    if (selection.bindless_descriptor) fused_pass.Add(bindless_descriptor_pass.emplace(*this));
+    if (selection.non_bindless_oob_buffer) fused_pass.Add(non_bindless_oob_buffer_pass.emplace(*this));
+    if (selection.non_bindless_oob_texel_buffer) fused_pass.Add(non_bindless_oob_texel_buffer_pass.emplace(*this));
+    if (selection.buffer_device_address) fused_pass.Add(buffer_device_address_pass.emplace(*this));
+    if (selection.ray_query) fused_pass.Add(ray_query_pass.emplace(*this));
+    const bool changed = fused_pass.Run();
+
+    if (print_debug_info_) {
+        if (bindless_descriptor_pass) bindless_descriptor_pass->PrintDebugInfo();
+        if (non_bindless_oob_buffer_pass) non_bindless_oob_buffer_pass->PrintDebugInfo();
+        if (non_bindless_oob_texel_buffer_pass) non_bindless_oob_texel_buffer_pass->PrintDebugInfo();
+        if (buffer_device_address_pass) buffer_device_address_pass->PrintDebugInfo();
+        if (ray_query_pass) ray_query_pass->PrintDebugInfo();
+    }
+    return changed;
+}
+
 uint32_t Module::TakeNextId() {
     // SPIR-V limit.
     assert(header_.bound < 0x3FFFFF);
@@ -695,7 +736,7 @@ void Module::PostProcess() {
     if (use_bda_) {
         // Adjust the original addressing model to be PhysicalStorageBuffer64 if not already.
         // A module can only have one OpMemoryModel
-        memory_model_[0]->words_[1] = spv::AddressingModelPhysicalStorageBuffer64;
+        memory_model_.front()->words_[1] = spv::AddressingModelPhysicalStorageBuffer64;
         if (!HasCapability(spv::CapabilityPhysicalStorageBufferAddresses)) {
             AddCapability(spv::CapabilityPhysicalStorageBufferAddresses);
             AddExtension("SPV_KHR_physical_storage_buffer");
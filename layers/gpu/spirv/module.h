@@ -43,6 +43,18 @@ struct Settings {
     bool support_int64;
     bool support_memory_model_device_scope;
     bool has_bindless_descriptors;
+    // Passes which can tell most valid accesses apart with a compare in the shader do that first, and only call the linked
+    // check function when it fails
+    bool inline_fast_path_checks;
+};
+
+// The passes Module::RunFusedPasses() runs together
+struct FusedPassSelection {
+    bool bindless_descriptor = false;
+    bool non_bindless_oob_buffer = false;
+    bool non_bindless_oob_texel_buffer = false;
+    bool buffer_device_address = false;
+    bool ray_query = false;
 };
 
 // This is the "brain" of SPIR-V logic, it stores the memory of all the Instructions and is the main context.
@@ -50,6 +62,13 @@ struct Settings {
 class Module {
   public:
     Module(vvl::span<const uint32_t> words, DebugReport* debug_report, const Settings& settings);
+    // Builds from instructions another parser already split out of |words|, to not walk and decode the binary a second time
+    Module(vvl::span<const uint32_t> words, vvl::span<const ParsedInstruction> instructions, DebugReport* debug_report,
+           const Settings& settings);
+
+    // Holds the Instructions (and the lists of them) created on this thread while the Module is alive.
+    // Declared first so it is destroyed after everything allocated from it.
+    InstructionArena arena_;
 
     // Memory that holds all the actual SPIR-V data, replicate the "Logical Layout of a Module" of SPIR-V.
     // Divided into sections to make easier to modify each part at different times, but still keeps it simple to write out all the
@@ -91,6 +110,9 @@ class Module {
     bool RunPassRayQuery();
     bool RunPassDebugPrintf(uint32_t binding_slot);
     bool RunPassPostProcessDescriptorIndexing();
+    // Runs the selected passes with a single walk over the module (see FusedPass). Instruments the same as calling
+    // RunPassBindlessDescriptor() through RunPassRayQuery() one after the other, in that order.
+    bool RunFusedPasses(const FusedPassSelection& selection);
 
     void AddInterfaceVariables(uint32_t id, spv::StorageClass storage_class);
 
@@ -113,6 +135,7 @@ class Module {
     const bool support_non_semantic_info_;
     const bool support_int64_;
     const bool support_memory_model_device_scope_;
+    const bool inline_fast_path_checks_;
 
     // TODO - To make things simple to start, decide if the whole shader has anything bindless or not. The next step will be a
     // system to pass in the information from the descriptor set layout to build a LUT of which OpVariable point to bindless
@@ -128,6 +151,20 @@ class Module {
     DebugReport* debug_report_ = nullptr;
     void InternalWarning(const char* tag, const char* message);
     void InternalError(const char* tag, const char* message);
+
+  private:
+    Module(DebugReport* debug_report, const Settings& settings);
+
+    // Where in the function being parsed the next instruction goes
+    struct ParseState {
+        BasicBlock* current_block = nullptr;
+        Function* current_function = nullptr;
+        bool block_found = false;
+        bool function_end_found = false;
+    };
+    void ParseHeader(vvl::span<const uint32_t> words);
+    void AddParsedInstruction(std::unique_ptr<Instruction> new_inst, ParseState& state);
+    void AddGlobalInstruction(std::unique_ptr<Instruction> new_inst);
 };
 
 }  // namespace spirv
@@ -24,7 +24,9 @@
 namespace gpuav {
 namespace spirv {
 
-NonBindlessOOBBufferPass::NonBindlessOOBBufferPass(Module& module) : Pass(module) { module.use_bda_ = true; }
+NonBindlessOOBBufferPass::NonBindlessOOBBufferPass(Module& module) : InjectFunctionPass(module, module.inline_fast_path_checks_) {}
+
+bool NonBindlessOOBBufferPass::Enabled() const { return !module_.has_bindless_descriptors_; }
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t NonBindlessOOBBufferPass::GetLinkFunctionId() {
@@ -70,6 +72,71 @@ uint32_t NonBindlessOOBBufferPass::CreateFunctionCall(BasicBlock& block, Instruc
     return function_result;
 }
 
+// For an element of a runtime array at the end of a non-arrayed block, OpArrayLength gives how many elements fit in the bound
+// range, so comparing the index to it is enough to know the access is in bounds, without loading the size from the descriptor
+// state buffer like the function does
+uint32_t NonBindlessOOBBufferPass::CreateFastPathCheck(BasicBlock& block, InstructionIt* inst_it) {
+    assert(access_chain_inst_ && var_inst_);
+    const TypeManager& type_manager = module_.type_manager_;
+    const Type* pointer_type = type_manager.FindTypeById(var_inst_->TypeId());
+    const Type* block_type = type_manager.FindTypeById(pointer_type->inst_.Word(3));
+    // The member and the element index
+    if (block_type->spv_type_ != SpvType::kStruct || access_chain_inst_->Length() < 6) {
+        return 0;
+    }
+
+    uint32_t member_index = 0;
+    const uint32_t member_count = block_type->inst_.Length() - 2;
+    if (!GetConstantUint32Value(access_chain_inst_->Word(4), member_index) || member_index != member_count - 1) {
+        return 0;
+    }
+    const Type* runtime_array_type = type_manager.FindTypeById(block_type->inst_.Operand(member_index));
+    if (runtime_array_type->spv_type_ != SpvType::kRuntimeArray) {
+        return 0;
+    }
+
+    // Any index past the element has to stay inside of it, which is only known for constants
+    uint32_t current_type_id = runtime_array_type->inst_.Operand(0);
+    for (uint32_t ac_word_index = 6; ac_word_index < access_chain_inst_->Length(); ac_word_index++) {
+        const Type* current_type = type_manager.FindTypeById(current_type_id);
+        uint32_t index_value = 0;
+        if (!GetConstantUint32Value(access_chain_inst_->Word(ac_word_index), index_value)) {
+            return 0;
+        }
+        uint32_t element_count = 0;
+        switch (current_type->spv_type_) {
+            case SpvType::kStruct:
+                element_count = current_type->inst_.Length() - 2;
+                break;
+            case SpvType::kVector:
+            case SpvType::kMatrix:
+                element_count = current_type->inst_.Operand(1);
+                break;
+            case SpvType::kArray:
+                if (!GetConstantUint32Value(current_type->inst_.Operand(1), element_count)) {
+                    return 0;  // Spec constant
+                }
+                break;
+            default:
+                return 0;
+        }
+        if (index_value >= element_count) {
+            return 0;
+        }
+        current_type_id = current_type->inst_.Operand(current_type->spv_type_ == SpvType::kStruct ? index_value : 0);
+    }
+
+    const uint32_t uint32_type_id = module_.type_manager_.GetTypeInt(32, false).Id();
+    const uint32_t bool_type_id = module_.type_manager_.GetTypeBool().Id();
+    const uint32_t element_index_id = CastToUint32(access_chain_inst_->Word(5), block, inst_it);
+
+    const uint32_t array_length_id = module_.TakeNextId();
+    block.CreateInstruction(spv::OpArrayLength, {uint32_type_id, array_length_id, var_inst_->ResultId(), member_index}, inst_it);
+    const uint32_t in_bounds_id = module_.TakeNextId();
+    block.CreateInstruction(spv::OpULessThan, {bool_type_id, in_bounds_id, element_index_id, array_length_id}, inst_it);
+    return in_bounds_id;
+}
+
 void NonBindlessOOBBufferPass::Reset() {
     access_chain_inst_ = nullptr;
     var_inst_ = nullptr;
@@ -172,41 +239,5 @@ void NonBindlessOOBBufferPass::PrintDebugInfo() {
     std::cout << "NonBindlessOOBBufferPass instrumentation count: " << instrumentations_count_ << '\n';
 }
 
-// Created own Run() because need to control finding the largest offset in a given block
-bool NonBindlessOOBBufferPass::Run() {
-    if (module_.has_bindless_descriptors_) return false;
-    // Can safely loop function list as there is no injecting of new Functions until linking time
-    for (const auto& function : module_.functions_) {
-        for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
-            if ((*block_it)->loop_header_) {
-                continue;  // Currently can't properly handle injecting CFG logic into a loop header block
-            }
-            auto& block_instructions = (*block_it)->instructions_;
-            for (auto inst_it = block_instructions.begin(); inst_it != block_instructions.end(); ++inst_it) {
-                // Every instruction is analyzed by the specific pass and lets us know if we need to inject a function or not
-                if (!RequiresInstrumentation(*function, *(inst_it->get()))) continue;
-
-                if (module_.max_instrumentations_count_ != 0 && instrumentations_count_ >= module_.max_instrumentations_count_) {
-                    return true;  // hit limit
-                }
-                instrumentations_count_++;
-
-                // Add any debug information to pass into the function call
-                InjectionData injection_data;
-                injection_data.stage_info_id = GetStageInfo(*function, block_it, inst_it);
-                const uint32_t inst_position = target_instruction_->position_index_;
-                auto inst_position_constant = module_.type_manager_.CreateConstantUInt32(inst_position);
-                injection_data.inst_position_id = inst_position_constant.Id();
-
-                // inst_it is updated to the instruction after the new function call, it will not add/remove any Blocks
-                CreateFunctionCall(**block_it, &inst_it, injection_data);
-                Reset();
-            }
-        }
-    }
-
-    return instrumentations_count_ != 0;
-}
-
 }  // namespace spirv
 }  // namespace gpuav
\ No newline at end of file
@@ -24,7 +24,7 @@
 namespace gpuav {
 namespace spirv {
 
-NonBindlessOOBTexelBufferPass::NonBindlessOOBTexelBufferPass(Module& module) : Pass(module) { module.use_bda_ = true; }
+bool NonBindlessOOBTexelBufferPass::Enabled() const { return !module_.has_bindless_descriptors_; }
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t NonBindlessOOBTexelBufferPass::GetLinkFunctionId() {
@@ -193,41 +193,5 @@ void NonBindlessOOBTexelBufferPass::PrintDebugInfo() {
     std::cout << "NonBindlessOOBTexelBufferPass instrumentation count: " << instrumentations_count_ << '\n';
 }
 
-// Created own Run() because need to control finding the largest offset in a given block
-bool NonBindlessOOBTexelBufferPass::Run() {
-    if (module_.has_bindless_descriptors_) return false;
-    // Can safely loop function list as there is no injecting of new Functions until linking time
-    for (const auto& function : module_.functions_) {
-        for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
-            if ((*block_it)->loop_header_) {
-                continue;  // Currently can't properly handle injecting CFG logic into a loop header block
-            }
-            auto& block_instructions = (*block_it)->instructions_;
-            for (auto inst_it = block_instructions.begin(); inst_it != block_instructions.end(); ++inst_it) {
-                // Every instruction is analyzed by the specific pass and lets us know if we need to inject a function or not
-                if (!RequiresInstrumentation(*function, *(inst_it->get()))) continue;
-
-                if (module_.max_instrumentations_count_ != 0 && instrumentations_count_ >= module_.max_instrumentations_count_) {
-                    return true;  // hit limit
-                }
-                instrumentations_count_++;
-
-                // Add any debug information to pass into the function call
-                InjectionData injection_data;
-                injection_data.stage_info_id = GetStageInfo(*function, block_it, inst_it);
-                const uint32_t inst_position = target_instruction_->position_index_;
-                auto inst_position_constant = module_.type_manager_.CreateConstantUInt32(inst_position);
-                injection_data.inst_position_id = inst_position_constant.Id();
-
-                // inst_it is updated to the instruction after the new function call, it will not add/remove any Blocks
-                CreateFunctionCall(**block_it, &inst_it, injection_data);
-                Reset();
-            }
-        }
-    }
-
-    return instrumentations_count_ != 0;
-}
-
 }  // namespace spirv
 }  // namespace gpuav
\ No newline at end of file
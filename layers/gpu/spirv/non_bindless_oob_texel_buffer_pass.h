@@ -15,23 +15,23 @@
 #pragma once
 
 #include <stdint.h>
-#include "pass.h"
+#include "inject_function_pass.h"
 
 namespace gpuav {
 namespace spirv {
 
 // Will make sure Texel Buffers that are non bindless are not OOB Uses robustBufferAccess to ensure if we
 // are OOB that it won't crash and we will return the error safely
-class NonBindlessOOBTexelBufferPass : public Pass {
+class NonBindlessOOBTexelBufferPass : public InjectFunctionPass {
   public:
-    NonBindlessOOBTexelBufferPass(Module& module);
+    NonBindlessOOBTexelBufferPass(Module& module) : InjectFunctionPass(module) {}
     void PrintDebugInfo();
     const char* Name() const final { return "NonBindlessOOBTexelBufferPass"; }
-    bool Run();
 
   private:
-    bool RequiresInstrumentation(const Function& function, const Instruction& inst);
-    uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InjectionData& injection_data);
+    bool Enabled() const final;
+    bool RequiresInstrumentation(const Function& function, const Instruction& inst) final;
+    uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InjectionData& injection_data) final;
     void Reset() final;
 
     uint32_t link_function_id = 0;
@@ -14,6 +14,7 @@
  */
 
 #include "pass.h"
+#include "fused_pass.h"
 #include "module.h"
 #include "gpu/shaders/gpuav_error_codes.h"
 
@@ -53,7 +54,7 @@ const Variable& Pass::GetBuiltinVariable(uint32_t built_in) {
 
 // To reduce having to load this information everytime we do a OpFunctionCall, instead just create it once per Function block and
 // reference it each time
-uint32_t Pass::GetStageInfo(Function& function, BasicBlockIt target_block_it, InstructionIt& target_inst_it) {
+uint32_t Pass::GetStageInfo(Function& function) {
     // Cached so only need to compute this once
     if (function.stage_info_id_ != 0) {
         return function.stage_info_id_;
@@ -176,12 +177,6 @@ uint32_t Pass::GetStageInfo(Function& function, BasicBlockIt target_block_it, In
     function.stage_info_z_id_ = stage_info[2];
     function.stage_info_w_id_ = stage_info[3];
 
-    // because we are injecting things in the first block, there is a chance we just destroyed the iterator if the target
-    // instruction was also in the first block, so need to regain it for the caller
-    if ((*target_block_it)->GetLabelId() == block.GetLabelId()) {
-        target_inst_it = FindTargetInstruction(block);
-    }
-
     return function.stage_info_id_;
 }
 
@@ -205,6 +200,25 @@ const Instruction* Pass::GetMemeberDecoration(uint32_t id, uint32_t member_index
     return nullptr;
 }
 
+// Value of an integer OpConstant truncated to 32 bits, as ConvertTo32() does. Returns false for runtime values and spec constants,
+// which are not known until the pipeline is created.
+bool Pass::GetConstantUint32Value(uint32_t id, uint32_t& out_value) const {
+    const Constant* constant = module_.type_manager_.FindConstantById(id);
+    if (!constant || constant->type_.spv_type_ != SpvType::kInt) {
+        return false;
+    }
+    if (constant->inst_.Opcode() == spv::OpConstantNull) {
+        out_value = 0;
+        return true;
+    }
+    if (constant->inst_.Opcode() != spv::OpConstant) {
+        return false;
+    }
+    // The low-order word comes first for 64-bit constants
+    out_value = constant->inst_.Operand(0);
+    return true;
+}
+
 // Find outermost buffer type and its access chain index.
 // Because access chains indexes can be runtime values, we need to build arithmetic logic in the SPIR-V to get the runtime value of
 // the indexing
@@ -228,12 +242,14 @@ uint32_t Pass::GetLastByte(const Instruction& var_inst, const Instruction& acces
 
     const Type& uint32_type = module_.type_manager_.GetTypeInt(32, false);
 
-    // instruction that will have calculated the sum of the byte offset
+    // instruction that will have calculated the sum of the runtime parts of the byte offset
     uint32_t sum_id = 0;
+    // The parts of the byte offset coming from constant indexes are folded here, so an access chain with only constant indexes
+    // ends up as a single constant and no instruction is added for it. uint32_t wraps like OpIMul/OpIAdd would.
+    uint32_t constant_offset = 0;
 
     uint32_t matrix_stride = 0;
     bool col_major = false;
-    uint32_t matrix_stride_id = 0;
     bool in_matrix = false;
 
     while (ac_word_index < access_chain_inst.Length()) {
@@ -246,11 +262,17 @@ uint32_t Pass::GetLastByte(const Instruction& var_inst, const Instruction& acces
             case SpvType::kRuntimeArray: {
                 // Get array stride and multiply by current index
                 uint32_t arr_stride = GetDecoration(current_type_id, spv::DecorationArrayStride)->Word(3);
-                const uint32_t arr_stride_id = module_.type_manager_.GetConstantUInt32(arr_stride).Id();
-                const uint32_t ac_index_id_32 = ConvertTo32(ac_index_id, block, inst_it);
+                uint32_t index_value = 0;
+                if (GetConstantUint32Value(ac_index_id, index_value)) {
+                    constant_offset += arr_stride * index_value;
+                } else {
+                    const uint32_t arr_stride_id = module_.type_manager_.GetConstantUInt32(arr_stride).Id();
+                    const uint32_t ac_index_id_32 = ConvertTo32(ac_index_id, block, inst_it);
 
-                current_offset_id = module_.TakeNextId();
-                block.CreateInstruction(spv::OpIMul, {uint32_type.Id(), current_offset_id, arr_stride_id, ac_index_id_32}, inst_it);
+                    current_offset_id = module_.TakeNextId();
+                    block.CreateInstruction(spv::OpIMul, {uint32_type.Id(), current_offset_id, arr_stride_id, ac_index_id_32},
+                                            inst_it);
+                }
 
                 // Get element type for next step
                 current_type_id = current_type->inst_.Operand(0);
@@ -259,23 +281,28 @@ uint32_t Pass::GetLastByte(const Instruction& var_inst, const Instruction& acces
                 if (matrix_stride == 0) {
                     module_.InternalError(Name(), "GetLastByte is missing matrix stride");
                 }
-                matrix_stride_id = module_.type_manager_.GetConstantUInt32(matrix_stride).Id();
                 uint32_t vec_type_id = current_type->inst_.Operand(0);
 
                 // If column major, multiply column index by matrix stride, otherwise by vector component size and save matrix
                 // stride for vector (row) index
-                uint32_t col_stride_id = 0;
+                uint32_t col_stride = 0;
                 if (col_major) {
-                    col_stride_id = matrix_stride_id;
+                    col_stride = matrix_stride;
                 } else {
                     const uint32_t component_type_id = module_.type_manager_.FindTypeById(vec_type_id)->inst_.Operand(0);
-                    const uint32_t col_stride = module_.type_manager_.FindTypeByteSize(component_type_id);
-                    col_stride_id = module_.type_manager_.GetConstantUInt32(col_stride).Id();
+                    col_stride = module_.type_manager_.FindTypeByteSize(component_type_id);
                 }
 
-                const uint32_t ac_index_id_32 = ConvertTo32(ac_index_id, block, inst_it);
-                current_offset_id = module_.TakeNextId();
-                block.CreateInstruction(spv::OpIMul, {uint32_type.Id(), current_offset_id, col_stride_id, ac_index_id_32}, inst_it);
+                uint32_t index_value = 0;
+                if (GetConstantUint32Value(ac_index_id, index_value)) {
+                    constant_offset += col_stride * index_value;
+                } else {
+                    const uint32_t col_stride_id = module_.type_manager_.GetConstantUInt32(col_stride).Id();
+                    const uint32_t ac_index_id_32 = ConvertTo32(ac_index_id, block, inst_it);
+                    current_offset_id = module_.TakeNextId();
+                    block.CreateInstruction(spv::OpIMul, {uint32_type.Id(), current_offset_id, col_stride_id, ac_index_id_32},
+                                            inst_it);
+                }
 
                 // Get element type for next step
                 current_type_id = vec_type_id;
@@ -285,17 +312,19 @@ uint32_t Pass::GetLastByte(const Instruction& var_inst, const Instruction& acces
                 // If inside a row major matrix type, multiply index by matrix stride,
                 // else multiply by component size
                 const uint32_t component_type_id = current_type->inst_.Operand(0);
-                const uint32_t ac_index_id_32 = ConvertTo32(ac_index_id, block, inst_it);
-                if (in_matrix && !col_major) {
-                    current_offset_id = module_.TakeNextId();
-                    block.CreateInstruction(spv::OpIMul, {uint32_type.Id(), current_offset_id, matrix_stride_id, ac_index_id_32},
-                                            inst_it);
+                const uint32_t component_stride = (in_matrix && !col_major)
+                                                      ? matrix_stride
+                                                      : module_.type_manager_.FindTypeByteSize(component_type_id);
+                uint32_t index_value = 0;
+                if (GetConstantUint32Value(ac_index_id, index_value)) {
+                    constant_offset += component_stride * index_value;
                 } else {
-                    const uint32_t component_type_size = module_.type_manager_.FindTypeByteSize(component_type_id);
-                    const uint32_t size_id = module_.type_manager_.GetConstantUInt32(component_type_size).Id();
+                    const uint32_t component_stride_id = module_.type_manager_.GetConstantUInt32(component_stride).Id();
+                    const uint32_t ac_index_id_32 = ConvertTo32(ac_index_id, block, inst_it);
 
                     current_offset_id = module_.TakeNextId();
-                    block.CreateInstruction(spv::OpIMul, {uint32_type.Id(), current_offset_id, size_id, ac_index_id_32}, inst_it);
+                    block.CreateInstruction(spv::OpIMul,
+                                            {uint32_type.Id(), current_offset_id, component_stride_id, ac_index_id_32}, inst_it);
                 }
                 // Get element type for next step
                 current_type_id = component_type_id;
@@ -305,7 +334,7 @@ uint32_t Pass::GetLastByte(const Instruction& var_inst, const Instruction& acces
                 const Constant* member_constant = module_.type_manager_.FindConstantById(ac_index_id);
                 uint32_t member_index = member_constant->inst_.Operand(0);
                 uint32_t member_offset = GetMemeberDecoration(current_type_id, member_index, spv::DecorationOffset)->Word(4);
-                current_offset_id = module_.type_manager_.GetConstantUInt32(member_offset).Id();
+                constant_offset += member_offset;
 
                 // Look for matrix stride for this member if there is one. The matrix
                 // stride is not on the matrix type, but in a OpMemberDecorate on the
@@ -327,12 +356,15 @@ uint32_t Pass::GetLastByte(const Instruction& var_inst, const Instruction& acces
             } break;
         }
 
-        if (sum_id == 0) {
-            sum_id = current_offset_id;
-        } else {
-            const uint32_t new_sum_id = module_.TakeNextId();
-            block.CreateInstruction(spv::OpIAdd, {uint32_type.Id(), new_sum_id, sum_id, current_offset_id}, inst_it);
-            sum_id = new_sum_id;
+        // Zero when the offset was folded in constant_offset
+        if (current_offset_id != 0) {
+            if (sum_id == 0) {
+                sum_id = current_offset_id;
+            } else {
+                const uint32_t new_sum_id = module_.TakeNextId();
+                block.CreateInstruction(spv::OpIAdd, {uint32_type.Id(), new_sum_id, sum_id, current_offset_id}, inst_it);
+                sum_id = new_sum_id;
+            }
         }
         ac_word_index++;
     }
@@ -341,7 +373,10 @@ uint32_t Pass::GetLastByte(const Instruction& var_inst, const Instruction& acces
     uint32_t bsize = module_.type_manager_.FindTypeByteSize(current_type_id, matrix_stride, col_major, in_matrix);
     uint32_t last = bsize - 1;
 
-    const uint32_t last_id = module_.type_manager_.GetConstantUInt32(last).Id();
+    const uint32_t last_id = module_.type_manager_.GetConstantUInt32(constant_offset + last).Id();
+    if (sum_id == 0) {
+        return last_id;
+    }
 
     const uint32_t new_sum_id = module_.TakeNextId();
     block.CreateInstruction(spv::OpIAdd, {uint32_type.Id(), new_sum_id, sum_id, last_id}, inst_it);
@@ -382,6 +417,12 @@ uint32_t Pass::ConvertTo32(uint32_t id, BasicBlock& block, InstructionIt* inst_i
 
 // Generate code to cast integer it to 32bit unsigned, if needed.
 uint32_t Pass::CastToUint32(uint32_t id, BasicBlock& block, InstructionIt* inst_it) {
+    // Constant indexes (the common case for descriptor indexes) don't need any instruction
+    uint32_t constant_value = 0;
+    if (GetConstantUint32Value(id, constant_value)) {
+        return module_.type_manager_.GetConstantUInt32(constant_value).Id();
+    }
+
     // Convert value to 32-bit if necessary
     uint32_t int32_id = ConvertTo32(id, block, inst_it);
 
@@ -410,20 +451,10 @@ uint32_t Pass::CastToUint32(uint32_t id, BasicBlock& block, InstructionIt* inst_
     return new_id;  // Return an id to the Uint equivalent.
 }
 
-InstructionIt Pass::FindTargetInstruction(BasicBlock& block) const {
-    const uint32_t target_id = target_instruction_->ResultId();
-    for (auto inst_it = block.instructions_.begin(); inst_it != block.instructions_.end(); ++inst_it) {
-        // This has to re-loop the entire block to find the instruction, using the ResultID, we can quickly compare
-        if ((*inst_it)->ResultId() == target_id) {
-            // Things like OpStore will have a result id of zero, so need to do deep instruction comparison
-            if (*(*inst_it) == *target_instruction_) {
-                return inst_it;
-            }
-        }
-    }
-
-    module_.InternalError(Name(), "failed to find instruction");
-    return block.instructions_.end();
+bool InjectionPass::Run() {
+    FusedPass fused_pass(module_);
+    fused_pass.Add(*this);
+    return fused_pass.Run();
 }
 
 }  // namespace spirv
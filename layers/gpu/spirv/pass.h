@@ -40,7 +40,7 @@ class Pass {
     const Variable& GetBuiltinVariable(uint32_t built_in);
 
     // Returns the ID for OpCompositeConstruct it creates
-    uint32_t GetStageInfo(Function& function, BasicBlockIt target_block_it, InstructionIt& target_inst_it);
+    uint32_t GetStageInfo(Function& function);
 
     const Instruction* GetDecoration(uint32_t id, spv::Decoration decoration);
     const Instruction* GetMemeberDecoration(uint32_t id, uint32_t member_index, spv::Decoration decoration);
@@ -51,6 +51,7 @@ class Pass {
     // If no inst_it is passed in, any new instructions will be added to end of the Block
     uint32_t ConvertTo32(uint32_t id, BasicBlock& block, InstructionIt* inst_it);
     uint32_t CastToUint32(uint32_t id, BasicBlock& block, InstructionIt* inst_it);
+    bool GetConstantUint32Value(uint32_t id, uint32_t& out_value) const;
 
   protected:
     Pass(Module& module) : module_(module) {}
@@ -59,13 +60,42 @@ class Pass {
     // clear values between instrumented instructions
     virtual void Reset() = 0;
 
-    // As various things are modifiying the instruction streams, we need to get back to where we were.
-    // (normally set in the RequiresInstrumentation call)
+    // The instruction being instrumented (normally set in the RequiresInstrumentation call)
     const Instruction* target_instruction_ = nullptr;
-    InstructionIt FindTargetInstruction(BasicBlock& block) const;
 
     uint32_t instrumentations_count_ = 0;
 };
 
+// Base of the passes that inject a call to a linked function for the instructions they target.
+// Run() walks the module for this pass only, FusedPass walks it once for several of them.
+class InjectionPass : public Pass {
+  public:
+    bool Run();
+
+  protected:
+    InjectionPass(Module& module, bool splits_blocks) : Pass(module), splits_blocks_(splits_blocks) {}
+
+    // Some passes only apply to some modules
+    virtual bool Enabled() const { return true; }
+
+    // Each pass decides if the instruction should needs to have its function check injected
+    virtual bool RequiresInstrumentation(const Function& function, const Instruction& inst) = 0;
+    // A callback from the function injection logic.
+    // Each pass creates a OpFunctionCall and returns its result id.
+    // If |inst_it| is not null, it will update it to instruction post OpFunctionCall
+    virtual uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InjectionData& injection_data) = 0;
+
+    // Injects the check for the instruction at |inst_it|. On return |block_it| and |inst_it| point to the targeted instruction
+    // again, which might have been moved to a new block. Returns true if the instructions after it were moved to a new block,
+    // which |rest_block_it| is then set to.
+    virtual bool InjectFunction(Function& function, BasicBlockIt& block_it, InstructionIt& inst_it,
+                                const InjectionData& injection_data, BasicBlockIt& rest_block_it) = 0;
+
+    // If InjectFunction() can wrap the instruction in new blocks
+    const bool splits_blocks_;
+
+    friend class FusedPass;
+};
+
 }  // namespace spirv
 }  // namespace gpuav
\ No newline at end of file
@@ -48,6 +48,10 @@ const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType
 
     id_to_type_[inst->ResultId()] = std::make_unique<Type>(spv_type, *inst);
     const Type* new_type = id_to_type_[inst->ResultId()].get();
+    // Two structs with the same members can still be decorated differently
+    if (spv_type != SpvType::kStruct && spv_type != SpvType::kForwardPointer) {
+        type_index_.emplace(MakeKey(*inst), new_type);
+    }
 
     switch (spv_type) {
         case SpvType::kVoid:
@@ -65,38 +69,22 @@ const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType
         case SpvType::kAccelerationStructureKHR:
             acceleration_structure_type = new_type;
             break;
-        case SpvType::kInt:
-            int_types_.push_back(new_type);
+        case SpvType::kImage:
+            image_types_.push_back(new_type);
             break;
-        case SpvType::kFloat:
-            float_types_.push_back(new_type);
+        case SpvType::kForwardPointer:
+            forward_pointer_types_.push_back(new_type);
             break;
+        case SpvType::kInt:
+        case SpvType::kFloat:
         case SpvType::kVector:
-            vector_types_.push_back(new_type);
-            break;
         case SpvType::kMatrix:
-            matrix_types_.push_back(new_type);
-            break;
-        case SpvType::kImage:
-            image_types_.push_back(new_type);
-            break;
         case SpvType::kSampledImage:
-            sampled_image_types_.push_back(new_type);
-            break;
         case SpvType::kArray:
-            array_types_.push_back(new_type);
-            break;
         case SpvType::kRuntimeArray:
-            runtime_array_types_.push_back(new_type);
-            break;
         case SpvType::kPointer:
-            pointer_types_.push_back(new_type);
-            break;
-        case SpvType::kForwardPointer:
-            forward_pointer_types_.push_back(new_type);
-            break;
         case SpvType::kFunction:
-            function_types_.push_back(new_type);
+            // found with FindType()
             break;
         case SpvType::kStruct:
             break;  // don't track structs currently
@@ -113,27 +101,29 @@ const Type* TypeManager::FindTypeById(uint32_t id) const {
     return (type == id_to_type_.end()) ? nullptr : type->second.get();
 }
 
-const Type* TypeManager::FindFunctionType(const Instruction& inst) const {
-    const uint32_t inst_length = inst.Length();
-    for (const auto& type : function_types_) {
-        if (type->inst_.Length() != inst_length) {
-            continue;
-        }
-        // Start at the Result Type ID (skip ResultID and the base word)
-        bool found = true;
-        for (uint32_t i = 2; i < inst_length; i++) {
-            if (type->inst_.Word(i) != inst.Word(i)) {
-                found = false;
-                break;
-            }
-        }
-        if (found) {
-            return type;
+StructuralKey TypeManager::MakeKey(const Instruction& inst) {
+    StructuralKey key;
+    key.reserve(inst.Length());
+    for (uint32_t i = 0; i < inst.Length(); i++) {
+        if (inst.result_id_index_ == 0 || i != inst.result_id_index_) {
+            key.emplace_back(inst.Word(i));
         }
     }
-    return nullptr;
+    return key;
+}
+
+const Type* TypeManager::FindType(const StructuralKey& key) const {
+    auto type = type_index_.find(key);
+    return (type == type_index_.end()) ? nullptr : type->second;
 }
 
+const Constant* TypeManager::FindConstant(const StructuralKey& key) const {
+    auto constant = constant_index_.find(key);
+    return (constant == constant_index_.end()) ? nullptr : constant->second;
+}
+
+const Type* TypeManager::FindFunctionType(const Instruction& inst) const { return FindType(MakeKey(inst)); }
+
 const Type& TypeManager::GetTypeVoid() {
     if (void_type) {
         return *void_type;
@@ -190,12 +180,8 @@ const Type& TypeManager::GetTypeAccelerationStructure() {
 }
 
 const Type& TypeManager::GetTypeInt(uint32_t bit_width, bool is_signed) {
-    for (const auto type : int_types_) {
-        const auto& words = type->inst_.words_;
-        const bool int_is_signed = words[3] != 0;
-        if (words[2] == bit_width && int_is_signed == is_signed) {
-            return *type;
-        }
+    if (const Type* type = FindType({(4u << 16) | spv::OpTypeInt, bit_width, is_signed ? 1u : 0u})) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -206,11 +192,8 @@ const Type& TypeManager::GetTypeInt(uint32_t bit_width, bool is_signed) {
 }
 
 const Type& TypeManager::GetTypeFloat(uint32_t bit_width) {
-    for (const auto type : float_types_) {
-        const auto& words = type->inst_.words_;
-        if ((words[2] == bit_width)) {
-            return *type;
-        }
+    if (const Type* type = FindType({(3u << 16) | spv::OpTypeFloat, bit_width})) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -220,13 +203,8 @@ const Type& TypeManager::GetTypeFloat(uint32_t bit_width) {
 }
 
 const Type& TypeManager::GetTypeArray(const Type& element_type, const Constant& length) {
-    for (const auto type : array_types_) {
-        const Type* this_element_type = FindTypeById(type->inst_.Word(2));
-        if (this_element_type && (*this_element_type == element_type)) {
-            if (type->inst_.Word(3) == length.Id()) {
-                return *type;
-            }
-        }
+    if (const Type* type = FindType({(4u << 16) | spv::OpTypeArray, element_type.Id(), length.Id()})) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -236,11 +214,8 @@ const Type& TypeManager::GetTypeArray(const Type& element_type, const Constant&
 }
 
 const Type& TypeManager::GetTypeRuntimeArray(const Type& element_type) {
-    for (const auto type : runtime_array_types_) {
-        const Type* this_element_type = FindTypeById(type->inst_.Word(2));
-        if (this_element_type && (*this_element_type == element_type)) {
-            return *type;
-        }
+    if (const Type* type = FindType({(3u << 16) | spv::OpTypeRuntimeArray, element_type.Id()})) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -250,16 +225,8 @@ const Type& TypeManager::GetTypeRuntimeArray(const Type& element_type) {
 }
 
 const Type& TypeManager::GetTypeVector(const Type& component_type, uint32_t component_count) {
-    for (const auto type : vector_types_) {
-        const auto& words = type->inst_.words_;
-        if (words[3] != component_count) {
-            continue;
-        }
-
-        const Type* vector_component_type = FindTypeById(words[2]);
-        if (vector_component_type && (*vector_component_type == component_type)) {
-            return *type;
-        }
+    if (const Type* type = FindType({(4u << 16) | spv::OpTypeVector, component_type.Id(), component_count})) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -269,16 +236,8 @@ const Type& TypeManager::GetTypeVector(const Type& component_type, uint32_t comp
 }
 
 const Type& TypeManager::GetTypeMatrix(const Type& column_type, uint32_t column_count) {
-    for (const auto type : matrix_types_) {
-        const auto& words = type->inst_.words_;
-        if (words[3] != column_count) {
-            continue;
-        }
-
-        const Type* matrix_column_type = FindTypeById(words[2]);
-        if (matrix_column_type && (*matrix_column_type == column_type)) {
-            return *type;
-        }
+    if (const Type* type = FindType({(4u << 16) | spv::OpTypeMatrix, column_type.Id(), column_count})) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -288,12 +247,8 @@ const Type& TypeManager::GetTypeMatrix(const Type& column_type, uint32_t column_
 }
 
 const Type& TypeManager::GetTypeSampledImage(const Type& image_type) {
-    for (const auto type : sampled_image_types_) {
-        const auto& words = type->inst_.words_;
-        const Type* this_image_type = FindTypeById(words[2]);
-        if (this_image_type && (*this_image_type == image_type)) {
-            return *type;
-        }
+    if (const Type* type = FindType({(3u << 16) | spv::OpTypeSampledImage, image_type.Id()})) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -303,16 +258,8 @@ const Type& TypeManager::GetTypeSampledImage(const Type& image_type) {
 }
 
 const Type& TypeManager::GetTypePointer(spv::StorageClass storage_class, const Type& pointer_type) {
-    for (const auto type : pointer_types_) {
-        const auto& words = type->inst_.words_;
-        if (words[2] != storage_class) {
-            continue;
-        }
-
-        const Type* this_pointer_type = FindTypeById(words[3]);
-        if (this_pointer_type && (*this_pointer_type == pointer_type)) {
-            return *type;
-        }
+    if (const Type* type = FindType({(4u << 16) | spv::OpTypePointer, uint32_t(storage_class), pointer_type.Id()})) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -419,35 +366,17 @@ const Constant& TypeManager::AddConstant(std::unique_ptr<Instruction> new_inst,
     id_to_constant_[inst->ResultId()] = std::make_unique<Constant>(type, *inst);
     const Constant* new_constant = id_to_constant_[inst->ResultId()].get();
 
-    if (inst->Opcode() == spv::OpConstant) {
-        if (type.inst_.Opcode() == spv::OpTypeInt && type.inst_.Word(2) == 32) {
-            int_32bit_constants_.push_back(new_constant);
-        } else if (type.inst_.Opcode() == spv::OpTypeFloat && type.inst_.Word(2) == 32) {
-            float_32bit_constants_.push_back(new_constant);
-        }
-    } else if (inst->Opcode() == spv::OpConstantNull) {
-        null_constants_.push_back(new_constant);
-    }
+    constant_index_.emplace(MakeKey(*inst), new_constant);
 
     return *new_constant;
 }
 
 const Constant* TypeManager::FindConstantInt32(uint32_t type_id, uint32_t value) const {
-    for (const auto constant : int_32bit_constants_) {
-        if (constant->type_.Id() == type_id && value == constant->inst_.Word(3)) {
-            return constant;
-        }
-    }
-    return nullptr;
+    return FindConstant({(4u << 16) | spv::OpConstant, type_id, value});
 }
 
 const Constant* TypeManager::FindConstantFloat32(uint32_t type_id, uint32_t value) const {
-    for (const auto constant : float_32bit_constants_) {
-        if (constant->type_.Id() == type_id && value == constant->inst_.Word(3)) {
-            return constant;
-        }
-    }
-    return nullptr;
+    return FindConstant({(4u << 16) | spv::OpConstant, type_id, value});
 }
 
 const Constant* TypeManager::FindConstantById(uint32_t id) const {
@@ -515,10 +444,8 @@ const Constant& TypeManager::GetConstantZeroVec3() {
 }
 
 const Constant& TypeManager::GetConstantNull(const Type& type) {
-    for (const auto& constant : null_constants_) {
-        if (constant->type_.Id() == type.Id()) {
-            return *constant;
-        }
+    if (const Constant* constant = FindConstant({(3u << 16) | spv::OpConstantNull, type.Id()})) {
+        return *constant;
     }
 
     const uint32_t constant_id = module_.TakeNextId();
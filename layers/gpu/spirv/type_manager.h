@@ -17,6 +17,7 @@
 #include <vector>
 #include "instruction.h"
 #include "generated/spirv_grammar_helper.h"
+#include "utils/hash_util.h"
 
 namespace gpuav {
 namespace spirv {
@@ -81,6 +82,13 @@ struct Variable {
     const Instruction& inst_;
 };
 
+// The words of an instruction besides the Result ID (the first word keeps the opcode and length).
+// Two types or constants with the same key are the same thing, which lets Get*() find them with a single hash lookup.
+using StructuralKey = small_vector<uint32_t, Instruction::word_vector_length, uint32_t>;
+struct StructuralKeyHash {
+    size_t operator()(const StructuralKey& key) const { return hash_util::HashCombiner().Combine(key.begin(), key.end()).Value(); }
+};
+
 // In charge of tracking all Types, Constants, and Variable in the module.
 // Since both Variable and Constant both rely on Types, the Types are the core thing we track
 //
@@ -145,23 +153,18 @@ class TypeManager {
     const Type* sampler_type = nullptr;
     const Type* ray_query_type = nullptr;
     const Type* acceleration_structure_type = nullptr;
-    std::vector<const Type*> int_types_;
-    std::vector<const Type*> float_types_;
-    std::vector<const Type*> vector_types_;
-    std::vector<const Type*> matrix_types_;
     std::vector<const Type*> image_types_;
-    std::vector<const Type*> sampled_image_types_;
-    std::vector<const Type*> array_types_;
-    std::vector<const Type*> runtime_array_types_;
-    std::vector<const Type*> pointer_types_;
     std::vector<const Type*> forward_pointer_types_;
-    std::vector<const Type*> function_types_;
 
-    std::vector<const Constant*> int_32bit_constants_;
-    std::vector<const Constant*> float_32bit_constants_;
+    // Everything else is found by its words, the first one added wins if the original SPIR-V has duplicates
+    static StructuralKey MakeKey(const Instruction& inst);
+    const Type* FindType(const StructuralKey& key) const;
+    const Constant* FindConstant(const StructuralKey& key) const;
+    vvl::unordered_map<StructuralKey, const Type*, StructuralKeyHash> type_index_;
+    vvl::unordered_map<StructuralKey, const Constant*, StructuralKeyHash> constant_index_;
+
     const Constant* uint_32bit_zero_constants_ = nullptr;
     const Constant* float_32bit_zero_constants_ = nullptr;
-    std::vector<const Constant*> null_constants_;
 
     std::vector<const Variable*> input_variables_;
     std::vector<const Variable*> output_variables_;
@@ -20,6 +20,10 @@
 #include "error_message/log_message_type.h"
 #include "generated/error_location_helper.h"
 #include "utils/hash_util.h"
+#include "utils/lock_profiling.h"
+#include "chassis/frame_profiling.h"
+#include "chassis/intercept_timing.h"
+#include "chassis/validation_sampling.h"
 #include <string>
 #include <vector>
 #include <vulkan/layer/vk_layer_settings.hpp>
@@ -149,6 +153,7 @@ const char *VK_LAYER_OBJECT_LIFETIME = "object_lifetime";
 const char *VK_LAYER_VALIDATE_CORE = "validate_core";
 const char *VK_LAYER_UNIQUE_HANDLES = "unique_handles";
 const char *VK_LAYER_CHECK_SHADERS_CACHING = "check_shaders_caching";
+const char *VK_LAYER_CHECK_SHADERS_CACHING_MAX_ENTRIES = "check_shaders_caching_max_entries";
 
 // Additional checks exposed in vkconfig, but not in VkValidationFeatureDisableEXT
 // ---
@@ -166,6 +171,23 @@ const char *VK_LAYER_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
 // GloablSettings
 // ---
 const char *VK_LAYER_FINE_GRAINED_LOCKING = "fine_grained_locking";
+const char *VK_LAYER_PARALLEL_SUBMIT_VALIDATION = "parallel_submit_validation";
+const char *VK_LAYER_PARALLEL_PIPELINE_VALIDATION = "parallel_pipeline_validation";
+const char *VK_LAYER_QUEUE_RETIRE_THREADS = "queue_retire_threads";
+const char *VK_LAYER_ASYNC_SPIRV_VALIDATION = "async_spirv_validation";
+const char *VK_LAYER_THREAD_SAFETY_COMMAND_BUFFER_OWNERSHIP = "thread_safety_command_buffer_ownership";
+const char *VK_LAYER_THREAD_SAFETY_ADAPTIVE = "thread_safety_adaptive";
+const char *VK_LAYER_LAZY_OBJECT_BINDINGS = "lazy_object_bindings";
+const char *VK_LAYER_HANDLE_PASSTHROUGH = "handle_passthrough";
+const char *VK_LAYER_LOCK_PROFILING = "lock_profiling";
+const char *VK_LAYER_INTERCEPT_TIMING = "intercept_timing";
+const char *VK_LAYER_INTERCEPT_TIMING_REPORT_FRAMES = "intercept_timing_report_frames";
+const char *VK_LAYER_FRAME_PROFILING = "frame_profiling";
+const char *VK_LAYER_FRAME_PROFILING_FILENAME = "frame_profiling_filename";
+const char *VK_LAYER_MEMORY_ACCOUNTING = "memory_accounting";
+const char *VK_LAYER_VALIDATION_SAMPLING_RATE = "validation_sampling_rate";
+const char *VK_LAYER_BEST_PRACTICES_REPORT_INTERVAL = "best_practices_report_interval";
+const char *VK_LAYER_BEST_PRACTICES_GPU_TIMING = "best_practices_gpu_timing";
 // Debug settings used for internal development
 const char *VK_LAYER_DEBUG_DISABLE_SPIRV_VAL = "debug_disable_spirv_val";
 
@@ -191,32 +213,44 @@ const char *VK_LAYER_GPUAV_VALIDATE_RAY_QUERY = "gpuav_validate_ray_query";
 // Post Process are designed to allow the user to "assume" the access is valid and want to know after the GPU executes what
 // happened. These are much lighter checks and can be used while the rest of GPU-AV is turned off
 const char *VK_LAYER_GPUAV_POST_PROCESS_DESCRIPTOR_INDEXING = "gpuav_post_process_descriptor_indexing";
+const char *VK_LAYER_GPUAV_INLINE_FAST_PATH_CHECKS = "gpuav_inline_fast_path_checks";
 const char *VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS = "gpuav_cache_instrumented_shaders";
 const char *VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS = "gpuav_select_instrumented_shaders";
+const char *VK_LAYER_GPUAV_PARALLEL_SHADER_INSTRUMENTATION = "gpuav_parallel_shader_instrumentation";
+const char *VK_LAYER_GPUAV_LAZY_SHADER_INSTRUMENTATION = "gpuav_lazy_shader_instrumentation";
+const char *VK_LAYER_GPUAV_UNINSTRUMENT_CLEAN_PIPELINES_COUNT = "gpuav_uninstrument_clean_pipelines_count";
 
 const char *VK_LAYER_GPUAV_BUFFERS_VALIDATION = "gpuav_buffers_validation";
 const char *VK_LAYER_GPUAV_INDIRECT_DRAWS_BUFFERS = "gpuav_indirect_draws_buffers";
+const char *VK_LAYER_GPUAV_BATCH_INDIRECT_DRAWS_VALIDATION = "gpuav_batch_indirect_draws_validation";
 const char *VK_LAYER_GPUAV_INDIRECT_DISPATCHES_BUFFERS = "gpuav_indirect_dispatches_buffers";
 const char *VK_LAYER_GPUAV_INDIRECT_TRACE_RAYS_BUFFERS = "gpuav_indirect_trace_rays_buffers";
 const char *VK_LAYER_GPUAV_BUFFER_COPIES = "gpuav_buffer_copies";
 
 const char *VK_LAYER_GPUAV_RESERVE_BINDING_SLOT = "gpuav_reserve_binding_slot";
 const char *VK_LAYER_GPUAV_VMA_LINEAR_OUTPUT = "gpuav_vma_linear_output";
+const char *VK_LAYER_GPUAV_VMA_OUTPUT_POOL_BLOCK_SIZE = "gpuav_vma_output_pool_block_size";
+const char *VK_LAYER_GPUAV_PARALLEL_POST_PROCESSING = "gpuav_parallel_post_processing";
 
 const char *VK_LAYER_GPUAV_DEBUG_DISABLE_ALL = "gpuav_debug_disable_all";
 const char *VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS = "gpuav_debug_validate_instrumented_shaders";
 const char *VK_LAYER_GPUAV_DEBUG_DUMP_INSTRUMENTED_SHADERS = "gpuav_debug_dump_instrumented_shaders";
 const char *VK_LAYER_GPUAV_DEBUG_MAX_INSTRUMENTATIONS_COUNT = "gpuav_debug_max_instrumentations_count";
 const char *VK_LAYER_GPUAV_DEBUG_PRINT_INSTRUMENTATION_INFO = "gpuav_debug_print_instrumentation_info";
+const char *VK_LAYER_GPUAV_DEBUG_PRINT_MEMORY_REPORT = "gpuav_debug_print_memory_report";
 
 // SyncVal
 // ---
 const char *VK_LAYER_SYNCVAL_SUBMIT_TIME_VALIDATION = "syncval_submit_time_validation";
 const char *VK_LAYER_SYNCVAL_SHADER_ACCESSES_HEURISTIC = "syncval_shader_accesses_heuristic";
+const char *VK_LAYER_SYNCVAL_PARALLEL_SUBMIT_VALIDATION = "syncval_parallel_submit_validation";
+const char *VK_LAYER_SYNCVAL_BATCH_LOG_MEMORY_LIMIT = "syncval_batch_log_memory_limit";
 
 // Message Formatting
 // ---
 const char *VK_LAYER_MESSAGE_FORMAT_DISPLAY_APPLICATION_NAME = "message_format_display_application_name";
+const char *VK_LAYER_ASYNC_MESSAGE_DELIVERY = "async_message_delivery";
+const char *VK_LAYER_LOG_JSON_FILENAME = "log_json_filename";
 // Until post 1.3.290 SDK release, these were not possible to set via environment variables
 const char *VK_LAYER_LOG_FILENAME = "log_filename";
 const char *VK_LAYER_DEBUG_ACTION = "debug_action";
@@ -732,6 +766,29 @@ static void ProcessDebugReportSettings(ConfigAndEnvSettings *settings_data, VkuL
         dbg_create_info.pUserData = nullptr;
         LayerCreateMessengerCallback(debug_report, default_layer_callback, &dbg_create_info, &messenger);
     }
+
+    bool async_message_delivery = false;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ASYNC_MESSAGE_DELIVERY)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ASYNC_MESSAGE_DELIVERY, async_message_delivery);
+    }
+    if (async_message_delivery) {
+        // Breaking long after the error was found would be useless, so errors stay synchronous
+        debug_report->StartAsyncDelivery((debug_action & VK_DBG_LAYER_ACTION_BREAK) != 0);
+    }
+
+    std::string log_json_filename;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_LOG_JSON_FILENAME)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_LOG_JSON_FILENAME, log_json_filename);
+    }
+    if (!log_json_filename.empty()) {
+        FILE *json_output = fopen(log_json_filename.c_str(), "w");
+        if (json_output) {
+            debug_report->StartJsonLog(json_output, dbg_create_info.messageSeverity);
+        } else {
+            setting_warnings.emplace_back("log_json_filename (" + log_json_filename +
+                                          ") could not be opened, falling back to the default outputs only.");
+        }
+    }
 }
 
 static const char *GetDefaultPrefix() {
@@ -808,6 +865,103 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FINE_GRAINED_LOCKING, global_settings.fine_grained_locking);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PARALLEL_SUBMIT_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PARALLEL_SUBMIT_VALIDATION, global_settings.parallel_submit_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PARALLEL_PIPELINE_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PARALLEL_PIPELINE_VALIDATION,
+                                global_settings.parallel_pipeline_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_QUEUE_RETIRE_THREADS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_QUEUE_RETIRE_THREADS, global_settings.queue_retire_threads);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ASYNC_SPIRV_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ASYNC_SPIRV_VALIDATION, global_settings.async_spirv_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_THREAD_SAFETY_COMMAND_BUFFER_OWNERSHIP)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_THREAD_SAFETY_COMMAND_BUFFER_OWNERSHIP,
+                                global_settings.thread_safety_command_buffer_ownership);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_THREAD_SAFETY_ADAPTIVE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_THREAD_SAFETY_ADAPTIVE, global_settings.thread_safety_adaptive);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_LAZY_OBJECT_BINDINGS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_LAZY_OBJECT_BINDINGS, global_settings.lazy_object_bindings);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_HANDLE_PASSTHROUGH)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_HANDLE_PASSTHROUGH, global_settings.handle_passthrough);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_LOCK_PROFILING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_LOCK_PROFILING, global_settings.lock_profiling);
+        if (global_settings.lock_profiling) {
+            vvl::lock_profiling::Enable();
+        }
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_INTERCEPT_TIMING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_INTERCEPT_TIMING, global_settings.intercept_timing);
+        if (global_settings.intercept_timing) {
+            vvl::intercept_timing::Enable();
+        }
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_INTERCEPT_TIMING_REPORT_FRAMES)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_INTERCEPT_TIMING_REPORT_FRAMES,
+                                global_settings.intercept_timing_report_frames);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_FRAME_PROFILING_FILENAME)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FRAME_PROFILING_FILENAME, global_settings.frame_profiling_filename);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_FRAME_PROFILING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FRAME_PROFILING, global_settings.frame_profiling);
+        if (global_settings.frame_profiling) {
+            FILE *csv_file = nullptr;
+            if (!global_settings.frame_profiling_filename.empty()) {
+                csv_file = fopen(global_settings.frame_profiling_filename.c_str(), "w");
+                if (!csv_file) {
+                    setting_warnings.emplace_back(std::string(VK_LAYER_FRAME_PROFILING_FILENAME) + " (" +
+                                                  global_settings.frame_profiling_filename +
+                                                  ") could not be opened, the frames are only plotted in Tracy.");
+                }
+            }
+            vvl::frame_profiling::Enable(csv_file);
+        }
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MEMORY_ACCOUNTING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MEMORY_ACCOUNTING, global_settings.memory_accounting);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_VALIDATION_SAMPLING_RATE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_VALIDATION_SAMPLING_RATE, global_settings.validation_sampling_rate);
+    }
+    // Always set so an instance created without sampling does not keep the rate of a previous one
+    vvl::validation_sampling::SetRate(global_settings.validation_sampling_rate);
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CHECK_SHADERS_CACHING_MAX_ENTRIES)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_CHECK_SHADERS_CACHING_MAX_ENTRIES,
+                                global_settings.shader_validation_cache_max_entries);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_BEST_PRACTICES_REPORT_INTERVAL)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_BEST_PRACTICES_REPORT_INTERVAL,
+                                global_settings.best_practices_report_interval);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_BEST_PRACTICES_GPU_TIMING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_BEST_PRACTICES_GPU_TIMING, global_settings.best_practices_gpu_timing);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DEBUG_DISABLE_SPIRV_VAL)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DEBUG_DISABLE_SPIRV_VAL, global_settings.debug_disable_spirv_val);
     }
@@ -833,6 +987,10 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
             vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_POST_PROCESS_DESCRIPTOR_INDEXING,
                                     gpuav_settings.shader_instrumentation.post_process_descriptor_index);
         }
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_INLINE_FAST_PATH_CHECKS)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_INLINE_FAST_PATH_CHECKS,
+                                    gpuav_settings.shader_instrumentation.inline_fast_path_checks);
+        }
 
         if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_WARN_ON_ROBUST_OOB)) {
             vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_WARN_ON_ROBUST_OOB, gpuav_settings.warn_on_robust_oob);
@@ -884,6 +1042,21 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                           " instead.");
         }
 
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_SHADER_INSTRUMENTATION)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_SHADER_INSTRUMENTATION,
+                                    gpuav_settings.parallel_shader_instrumentation);
+        }
+
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_LAZY_SHADER_INSTRUMENTATION)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_LAZY_SHADER_INSTRUMENTATION,
+                                    gpuav_settings.lazy_shader_instrumentation);
+        }
+
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_UNINSTRUMENT_CLEAN_PIPELINES_COUNT)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_UNINSTRUMENT_CLEAN_PIPELINES_COUNT,
+                                    gpuav_settings.uninstrument_clean_pipelines_count);
+        }
+
         // No need to enable shader instrumentation options is no instrumentation is done
         if (!gpuav_settings.IsShaderInstrumentationEnabled()) {
             gpuav_settings.DisableShaderInstrumentationAndOptions();
@@ -901,6 +1074,10 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
             vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_INDIRECT_DRAWS_BUFFERS,
                                     gpuav_settings.validate_indirect_draws_buffers);
         }
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_BATCH_INDIRECT_DRAWS_VALIDATION)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_BATCH_INDIRECT_DRAWS_VALIDATION,
+                                    gpuav_settings.batch_indirect_draws_validation);
+        }
         if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_INDIRECT_DISPATCHES_BUFFERS)) {
             vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_INDIRECT_DISPATCHES_BUFFERS,
                                     gpuav_settings.validate_indirect_dispatches_buffers);
@@ -937,6 +1114,16 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                       std::string(VK_LAYER_GPUAV_VMA_LINEAR_OUTPUT) + " instead.");
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_VMA_OUTPUT_POOL_BLOCK_SIZE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_VMA_OUTPUT_POOL_BLOCK_SIZE,
+                                gpuav_settings.vma_output_pool_block_size);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_POST_PROCESSING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_POST_PROCESSING,
+                                gpuav_settings.parallel_post_processing);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS,
                                 gpuav_settings.debug_validate_instrumented_shaders);
@@ -967,6 +1154,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                 gpuav_settings.debug_print_instrumentation_info);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_DEBUG_PRINT_MEMORY_REPORT)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_DEBUG_PRINT_MEMORY_REPORT,
+                                gpuav_settings.debug_print_memory_report);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_TO_STDOUT)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_TO_STDOUT, gpuav_settings.debug_printf_to_stdout);
     }
@@ -1010,6 +1202,16 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                 syncval_settings.shader_accesses_heuristic);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_PARALLEL_SUBMIT_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_PARALLEL_SUBMIT_VALIDATION,
+                                syncval_settings.parallel_submit_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_BATCH_LOG_MEMORY_LIMIT)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_BATCH_LOG_MEMORY_LIMIT,
+                                syncval_settings.batch_log_memory_limit);
+    }
+
     const auto *validation_features_ext = vku::FindStructInPNextChain<VkValidationFeaturesEXT>(settings_data->create_info);
     if (validation_features_ext) {
         SetValidationFeatures(settings_data->disables, settings_data->enables, validation_features_ext);
@@ -1066,6 +1268,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         SetValidationSetting(layer_setting_set, settings_data->disables, shader_validation_caching, VK_LAYER_CHECK_SHADERS_CACHING);
     }
 
+    // Passthrough uses the handles of the driver, whatever the other settings ask for
+    if (global_settings.handle_passthrough) {
+        settings_data->disables[handle_wrapping] = true;
+    }
+
     // This is the "original" way to use DebugPrintf before you could use it with GPU-AV
     // In this case, we want to emulate supporting only for DebugPrintf with GPU-AV disabled
     if (settings_data->enables[debug_printf_validation]) {
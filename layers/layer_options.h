@@ -81,6 +81,43 @@ using CHECK_ENABLED = std::array<bool, kMaxEnableFlags>;
 // General settings to be used by all parts of the Validation Layers
 struct GlobalSettings {
     bool fine_grained_locking = true;
+    // Validate the command buffers of a queue submission on worker threads
+    bool parallel_submit_validation = false;
+    // Validate the pipelines of a vkCreate*Pipelines call on worker threads
+    bool parallel_pipeline_validation = false;
+    // Number of threads retiring queue submissions for all queues, 0 picks one based on the CPU count
+    uint32_t queue_retire_threads = 0;
+    // Run spirv-val for vkCreateShaderModule on worker threads, results are reported when the module is first used
+    bool async_spirv_validation = false;
+    // Thread safety skips its checks for a command buffer recorded by the thread that claimed its command pool
+    bool thread_safety_command_buffer_ownership = false;
+    // Thread safety skips its checks for a device or instance until a second thread calls into it
+    bool thread_safety_adaptive = false;
+    // Command buffers do not link themselves to the objects they bind, the links are searched for when an object is destroyed
+    bool lazy_object_bindings = false;
+    // Handle wrapping is off, the driver is checked to return distinct handles and Object Lifetimes watches for collisions
+    bool handle_passthrough = false;
+    // Time the waits on the main layer locks, the contention is reported when a device is destroyed
+    bool lock_profiling = false;
+    // Count the BestPractices performance warnings and report each one once every this many frames, 0 reports every occurrence
+    uint32_t best_practices_report_interval = 0;
+    // Time the render passes and dispatches of primary command buffers, the slowest ones are reported with their warnings
+    bool best_practices_gpu_timing = false;
+    // Time every call of each validation object, the time per entry point is reported when a device is destroyed
+    bool intercept_timing = false;
+    // With intercept_timing, also report every this many presents, 0 only reports when a device is destroyed
+    uint32_t intercept_timing_report_frames = 0;
+    // Add up the time of the validation objects and the messages of each frame, see frame_profiling
+    bool frame_profiling = false;
+    // With frame_profiling, also write one CSV line per frame to this file
+    std::string frame_profiling_filename;
+    // Report the memory of each vvl::MemoryTag when a device is destroyed
+    bool memory_accounting = false;
+    // Run the PreCallValidate of the command buffer recording calls for 1 in this many calls of each entry point, 0 and 1
+    // validate every call. State tracking still sees every call.
+    uint32_t validation_sampling_rate = 0;
+    // Most shader hashes kept in a shader validation cache, the least recently used are dropped when it is written
+    uint32_t shader_validation_cache_max_entries = 1 << 20;
 
     bool debug_disable_spirv_val = false;
 };
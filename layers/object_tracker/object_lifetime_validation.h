@@ -16,6 +16,8 @@
  * limitations under the License.
  */
 
+#include "containers/counting_bloom_filter.h"
+
 extern uint64_t object_track_index;
 
 // Object Status -- used to track state of individual objects
@@ -25,20 +27,86 @@ enum ObjectStatusFlagBits {
     OBJSTATUS_CUSTOM_ALLOCATOR = 0x00000002,  // Allocated with custom allocator
 };
 
+// Child objects of a VkDescriptorPool or VkCommandPool, locked on their own so allocations from different pools do not
+// contend. They are kept contiguous so resetting or destroying the pool drops all of them at once.
+struct ObjTrackChildren {
+    std::mutex lock;
+    std::vector<uint64_t> handles;
+};
+
 // Object and state information structure
 struct ObjTrackState {
-    uint64_t handle;                                               // Object handle (new)
-    VulkanObjectType object_type;                                  // Object type identifier
-    ObjectStatusFlags status;                                      // Object state
-    uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    uint64_t handle = 0;                                      // Object handle (new)
+    VulkanObjectType object_type = kVulkanObjectTypeUnknown;  // Object type identifier
+    ObjectStatusFlags status = OBJSTATUS_NONE;                // Object state
+    uint64_t parent_object = 0;                               // Parent object
+    uint32_t child_index = 0;                                 // Index in the child_objects of the parent
+    std::unique_ptr<ObjTrackChildren> child_objects;          // Child objects (used for VkDescriptorPool and VkCommandPool)
+};
+
+struct ObjTrackSlot {
+    // Wrapped handle of the object using the slot, 0 if none
+    std::atomic<uint64_t> handle{0};
+    // ObjectTrackMap the object belongs to
+    uint32_t map_index = 0;
+    ObjTrackState state;
+};
+
+// The objects of one type tracked by an ObjectLifetimes.
+//
+// With handle wrapping on, a non-dispatchable handle is a unique_id_mapping id, so its ObjTrackState is stored in place in
+// a slab shared by all the maps of the ObjectLifetimes, at the slot index of the id. A lookup is then a bounds check and a
+// compare of the whole id, which carries the generation of the slot, so a stale handle never matches the object reusing its
+// slot. The other handles (dispatchable ones, or all of them with wrapping off) are kept in a hash map, and added to the
+// live handles filter if the map has one.
+class ObjectTrackMap {
+  public:
+    void Init(vvl::HandleSlotArray<ObjTrackSlot> *slots, uint32_t map_index) {
+        slots_ = slots;
+        map_index_ = map_index;
+    }
+    // Set before the first object is inserted
+    void TrackLiveHandles(vvl::CountingBloomFilter<> *live_handles) { live_handles_ = live_handles; }
+
+    bool contains(uint64_t handle) const { return FindSlot(handle) || object_table_.contains(handle); }
+
+    // Returns nullptr if handle is not tracked. Objects of the slab come through a non owning shared_ptr, their slot is not
+    // reused before the dispatch layer releases the handle.
+    std::shared_ptr<ObjTrackState> find(uint64_t handle) const {
+        if (ObjTrackSlot *slot = FindSlot(handle)) {
+            return std::shared_ptr<ObjTrackState>(std::shared_ptr<ObjTrackState>(), &slot->state);
+        }
+        auto iter = object_table_.find(handle);
+        return (iter != object_table_.end()) ? iter->second : nullptr;
+    }
+
+    // Returns false if handle is already tracked
+    bool insert(uint64_t handle, ObjTrackState &&state);
+    // Returns false if handle is not tracked
+    bool erase(uint64_t handle);
+    // Drops all the objects in one pass, nothing may race with it
+    void clear();
+    std::vector<std::shared_ptr<ObjTrackState>> snapshot(std::function<bool(const ObjTrackState &)> filter = nullptr) const;
+
+  private:
+    ObjTrackSlot *FindSlot(uint64_t handle) const {
+        ObjTrackSlot *slot = slots_->Find(handle);
+        if (slot && slot->handle.load(std::memory_order_acquire) == handle && slot->map_index == map_index_) {
+            return slot;
+        }
+        return nullptr;
+    }
+
+    vvl::HandleSlotArray<ObjTrackSlot> *slots_ = nullptr;
+    uint32_t map_index_ = 0;
+    vvl::CountingBloomFilter<> *live_handles_ = nullptr;
+    vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_table_;
 };
 
-typedef vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
 // Used for GPL and we know there are at most only 4 libraries that should be used
-typedef vvl::concurrent_unordered_map<uint64_t, small_vector<std::shared_ptr<ObjTrackState>, 4>, 6> object_list_map_type;
+typedef vvl::concurrent_unordered_map<uint64_t, small_vector<uint64_t, 4>, 6> object_list_map_type;
 
-class ObjectLifetimes : public ValidationObject {
+class ObjectLifetimes final : public ValidationObject {
     using Func = vvl::Func;
     using Struct = vvl::Struct;
     using Field = vvl::Field;
@@ -50,16 +118,25 @@ class ObjectLifetimes : public ValidationObject {
     ReadLockGuard ReadLock() const override;
     WriteLockGuard WriteLock() override;
 
-    mutable std::shared_mutex object_lifetime_mutex;
-    WriteLockGuard WriteSharedLock() { return WriteLockGuard(object_lifetime_mutex); }
-    ReadLockGuard ReadSharedLock() const { return ReadLockGuard(object_lifetime_mutex); }
+    // Serializes the creation of objects that can be retrieved several times (queues, swapchain images)
+    mutable vvl::ProfiledSharedMutex<vvl::ProfiledLock::ObjectLifetime> object_lifetime_mutex;
+    auto WriteSharedLock() { return std::unique_lock(object_lifetime_mutex); }
+    auto ReadSharedLock() const { return std::shared_lock(object_lifetime_mutex); }
 
     std::atomic<uint64_t> num_objects[kVulkanObjectTypeMax + 1];
     std::atomic<uint64_t> num_total_objects;
-    // Vector of unordered_maps per object type to hold ObjTrackState info
-    object_map_type object_map[kVulkanObjectTypeMax + 1];
+    // With handle_passthrough, the handles of all the objects created by the driver, the ones of the hash maps of
+    // object_map and swapchain_image_map. Spares an exact lookup in every map for each new handle.
+    std::unique_ptr<vvl::CountingBloomFilter<>> live_handles;
+    // Set once a handle collision has been reported, see CheckHandleCollision
+    std::atomic<bool> handle_collision_reported{false};
+    // Storage of the wrapped handles of all the maps below
+    vvl::HandleSlotArray<ObjTrackSlot> object_slots;
+    // Per object type ObjTrackState info
+    ObjectTrackMap object_map[kVulkanObjectTypeMax + 1];
     // Special-case map for swapchain images
-    object_map_type swapchain_image_map;
+    ObjectTrackMap swapchain_image_map;
+    // Library handles of each linked graphics pipeline
     object_list_map_type linked_graphics_pipeline_map;
 
     bool null_descriptor_enabled;
@@ -67,14 +144,17 @@ class ObjectLifetimes : public ValidationObject {
     // Constructor for object lifetime tracking
     ObjectLifetimes() : num_objects{}, num_total_objects(0), null_descriptor_enabled(false) {
         container_type = LayerObjectTypeObjectTracker;
+        for (uint32_t i = 0; i <= kVulkanObjectTypeMax; ++i) {
+            object_map[i].Init(&object_slots, i);
+        }
+        swapchain_image_map.Init(&object_slots, kVulkanObjectTypeMax + 1);
     }
     ~ObjectLifetimes() {}
 
     template <typename T1>
-    void InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, const Location &loc,
-                      std::shared_ptr<ObjTrackState> pNode) {
+    void InsertObject(ObjectTrackMap &map, T1 object, VulkanObjectType object_type, const Location &loc, ObjTrackState &&state) {
         uint64_t object_handle = HandleToUint64(object);
-        const bool inserted = map.insert(object_handle, pNode);
+        const bool inserted = map.insert(object_handle, std::move(state));
         if (!inserted) {
             // The object should not already exist. If we couldn't add it to the map, there was probably
             // a race condition in the app. Report an error and move on.
@@ -121,6 +201,24 @@ class ObjectLifetimes : public ValidationObject {
                              const char *wrong_parent_vuid, const Location &loc, VulkanObjectType parent_type) const;
     bool CheckPipelineObjectValidity(uint64_t object_handle, const char *invalid_handle_vuid, const Location &loc) const;
 
+    // A handle parameter of a command. The generated functions with several of them describe them in a constexpr table walked
+    // by ValidateObjects(), rather than repeating a ValidateObject() call and its arguments for each.
+    struct HandleParam {
+        VulkanObjectType object_type;
+        bool null_allowed;
+        Field field;
+        // nullptr for kVUIDUndefined, which is not a constant expression
+        const char *invalid_handle_vuid;
+        const char *wrong_parent_vuid;
+    };
+    template <size_t N>
+    bool ValidateObjects(const HandleParam (&params)[N], const std::array<uint64_t, N> &handles, const Location &loc,
+                         VulkanObjectType parent_type = kVulkanObjectTypeDevice) const {
+        return ValidateObjects(params, handles.data(), static_cast<uint32_t>(N), loc, parent_type);
+    }
+    bool ValidateObjects(const HandleParam *params, const uint64_t *handles, uint32_t count, const Location &loc,
+                         VulkanObjectType parent_type) const;
+
     template <typename T1>
     bool ValidateObject(T1 object, VulkanObjectType object_type, bool null_allowed, const char *invalid_handle_vuid,
                         const char *wrong_parent_vuid, const Location &loc,
@@ -135,23 +233,37 @@ class ObjectLifetimes : public ValidationObject {
     void CreateObject(T1 object, VulkanObjectType object_type, const VkAllocationCallbacks *pAllocator, const Location &loc) {
         uint64_t object_handle = HandleToUint64(object);
         const bool custom_allocator = (pAllocator != nullptr);
+        if (live_handles) {
+            CheckHandleCollision(object_handle, object_type, loc);
+        }
         if (!object_map[object_type].contains(object_handle)) {
-            auto pNewObjNode = std::make_shared<ObjTrackState>();
-            pNewObjNode->object_type = object_type;
-            pNewObjNode->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
-            pNewObjNode->handle = object_handle;
+            ObjTrackState new_obj_node;
+            new_obj_node.object_type = object_type;
+            new_obj_node.status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
+            new_obj_node.handle = object_handle;
+            if (object_type == kVulkanObjectTypeDescriptorPool || object_type == kVulkanObjectTypeCommandPool) {
+                new_obj_node.child_objects = std::make_unique<ObjTrackChildren>();
+            }
 
-            InsertObject(object_map[object_type], object, object_type, loc, pNewObjNode);
+            InsertObject(object_map[object_type], object, object_type, loc, std::move(new_obj_node));
             num_objects[object_type]++;
             num_total_objects++;
-
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
-                pNewObjNode->child_objects.reset(new vvl::unordered_set<uint64_t>);
-            }
         }
     }
+    // With handle_passthrough the handles are the ones of the driver, which may return a handle that is still alive
+    void EnableHandleCollisionChecks();
+    // Must be called before the new object is inserted
+    void CheckHandleCollision(uint64_t object_handle, VulkanObjectType object_type, const Location &loc);
+    void ReportHandleCollision(uint64_t object_handle, VulkanObjectType object_type, const Location &loc);
+    // Checks at vkCreateDevice that the driver returns distinct handles for a few live objects
+    void VerifyDriverHandles(const Location &loc);
 
     void DestroyObjectSilently(uint64_t object, VulkanObjectType object_type);
+    void InsertChildObject(VulkanObjectType parent_type, ObjTrackState &child_node);
+    // Must be called before the child is destroyed
+    void EraseChildObject(VulkanObjectType parent_type, VulkanObjectType child_type, uint64_t child);
+    // Destroys all the children of a pool, in one pass and without the per object parent lookups
+    void DestroyChildObjects(ObjTrackState &parent_node, VulkanObjectType child_type);
 
     template <typename T1>
     void RecordDestroyObject(T1 object_handle, VulkanObjectType object_type) {
@@ -173,9 +285,8 @@ class ObjectLifetimes : public ValidationObject {
 
         if ((expected_custom_allocator_code != kVUIDUndefined || expected_default_allocator_code != kVUIDUndefined) &&
             object != HandleToUint64(VK_NULL_HANDLE)) {
-            auto item = object_map[object_type].find(object);
-            if (item != object_map[object_type].end()) {
-                auto allocated_with_custom = (item->second->status & OBJSTATUS_CUSTOM_ALLOCATOR) ? true : false;
+            if (auto node = object_map[object_type].find(object)) {
+                auto allocated_with_custom = (node->status & OBJSTATUS_CUSTOM_ALLOCATOR) ? true : false;
                 if (allocated_with_custom && !custom_allocator && expected_custom_allocator_code != kVUIDUndefined) {
                     // This check only verifies that custom allocation callbacks were provided to both Create and Destroy calls,
                     // it cannot verify that these allocation callbacks are compatible with each other.
@@ -16,6 +16,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 #include "generated/chassis.h"
 
 #include "object_lifetime_validation.h"
@@ -23,6 +27,70 @@
 
 uint64_t object_track_index = 0;
 
+bool ObjectTrackMap::insert(uint64_t handle, ObjTrackState &&state) {
+    if (IsWrappedHandle(handle)) {
+        ObjTrackSlot &slot = slots_->Get(handle);
+        if (slot.handle.load(std::memory_order_acquire) == handle) {
+            return false;
+        }
+        slot.map_index = map_index_;
+        slot.state = std::move(state);
+        slot.handle.store(handle, std::memory_order_release);
+        return true;
+    }
+    if (!object_table_.insert(handle, std::make_shared<ObjTrackState>(std::move(state)))) {
+        return false;
+    }
+    if (live_handles_) {
+        live_handles_->Add(handle);
+    }
+    return true;
+}
+
+bool ObjectTrackMap::erase(uint64_t handle) {
+    if (ObjTrackSlot *slot = FindSlot(handle)) {
+        // The state is left as is, a thread racing with the destroy can still read it
+        return slot->handle.compare_exchange_strong(handle, 0, std::memory_order_acq_rel);
+    }
+    if (object_table_.pop(handle) == object_table_.end()) {
+        return false;
+    }
+    if (live_handles_) {
+        live_handles_->Remove(handle);
+    }
+    return true;
+}
+
+void ObjectTrackMap::clear() {
+    slots_->ForEach([this](ObjTrackSlot &slot) {
+        if (slot.map_index == map_index_) {
+            slot.handle.store(0, std::memory_order_release);
+        }
+    });
+    if (live_handles_) {
+        for (const auto &item : object_table_.snapshot()) {
+            live_handles_->Remove(item.first);
+        }
+    }
+    object_table_.clear();
+}
+
+std::vector<std::shared_ptr<ObjTrackState>> ObjectTrackMap::snapshot(std::function<bool(const ObjTrackState &)> filter) const {
+    std::vector<std::shared_ptr<ObjTrackState>> objects;
+    slots_->ForEach([this, &filter, &objects](ObjTrackSlot &slot) {
+        const uint64_t handle = slot.handle.load(std::memory_order_acquire);
+        if (handle != 0 && slot.map_index == map_index_ && (!filter || filter(slot.state))) {
+            objects.emplace_back(std::shared_ptr<ObjTrackState>(), &slot.state);
+        }
+    });
+    for (const auto &item : object_table_.snapshot()) {
+        if (!filter || filter(*item.second)) {
+            objects.emplace_back(item.second);
+        }
+    }
+    return objects;
+}
+
 VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
     // TODO: Unify Typed Handle representation (i.e. VulkanTypedHandle everywhere there are handle/type pairs)
     VulkanTypedHandle typed_handle;
@@ -31,13 +99,118 @@ VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
     return typed_handle;
 }
 
+// Handles the driver creates. The dispatchable ones are pointers to live objects, which can't be returned twice, and displays
+// and their modes are the same objects each time they are enumerated.
+static bool IsCreatedHandleType(VulkanObjectType object_type) {
+    switch (object_type) {
+        case kVulkanObjectTypeUnknown:
+        case kVulkanObjectTypeInstance:
+        case kVulkanObjectTypePhysicalDevice:
+        case kVulkanObjectTypeDevice:
+        case kVulkanObjectTypeQueue:
+        case kVulkanObjectTypeCommandBuffer:
+        case kVulkanObjectTypeDisplayKHR:
+        case kVulkanObjectTypeDisplayModeKHR:
+            return false;
+        default:
+            return true;
+    }
+}
+
+void ObjectLifetimes::EnableHandleCollisionChecks() {
+    live_handles = std::make_unique<vvl::CountingBloomFilter<>>();
+    for (uint32_t object_type = 0; object_type < kVulkanObjectTypeMax; ++object_type) {
+        if (IsCreatedHandleType(static_cast<VulkanObjectType>(object_type))) {
+            object_map[object_type].TrackLiveHandles(live_handles.get());
+        }
+    }
+    swapchain_image_map.TrackLiveHandles(live_handles.get());
+}
+
+void ObjectLifetimes::CheckHandleCollision(uint64_t object_handle, VulkanObjectType object_type, const Location &loc) {
+    if (!IsCreatedHandleType(object_type) || !live_handles->MayContain(object_handle)) {
+        return;
+    }
+    // The filter can be wrong about a handle being alive, not about it being gone
+    bool alive = swapchain_image_map.contains(object_handle);
+    for (uint32_t type = 0; !alive && type < kVulkanObjectTypeMax; ++type) {
+        alive = IsCreatedHandleType(static_cast<VulkanObjectType>(type)) && object_map[type].contains(object_handle);
+    }
+    if (alive) {
+        ReportHandleCollision(object_handle, object_type, loc);
+    }
+}
+
+void ObjectLifetimes::ReportHandleCollision(uint64_t object_handle, VulkanObjectType object_type, const Location &loc) {
+    // The first collision is enough to know the driver handles can't be used as they are, no need to flood the output
+    if (handle_collision_reported.exchange(true)) {
+        return;
+    }
+    // Surfaces and debug messengers are tracked by the instance object, which has no device
+    LogObjectList objlist;
+    if (device != VK_NULL_HANDLE) {
+        objlist.add(device);
+    } else {
+        objlist.add(instance);
+    }
+    (void)LogWarning("WARNING-ObjectTracker-HandleCollision", objlist, loc,
+                     "the driver returned %s 0x%" PRIxLEAST64
+                     " while an object with the same handle is still alive. With handle_passthrough the handles of the driver "
+                     "are used as they are, so validation can no longer tell these objects apart and may report wrong errors. "
+                     "Turn handle_passthrough off for this driver.",
+                     string_VulkanObjectType(object_type), object_handle);
+}
+
+void ObjectLifetimes::VerifyDriverHandles(const Location &loc) {
+    // A few objects of two types, enough to catch a driver handing out the same handle for objects that are all alive
+    constexpr uint32_t kObjectCount = 4;
+    VkSamplerCreateInfo sampler_ci = vku::InitStructHelper();
+    VkBufferCreateInfo buffer_ci = vku::InitStructHelper();
+    buffer_ci.size = 1;
+    buffer_ci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    std::array<VkSampler, kObjectCount> samplers{};
+    std::array<VkBuffer, kObjectCount> buffers{};
+    std::vector<uint64_t> handles;
+    for (uint32_t i = 0; i < kObjectCount; ++i) {
+        if (DispatchCreateSampler(device, &sampler_ci, nullptr, &samplers[i]) == VK_SUCCESS) {
+            handles.emplace_back(HandleToUint64(samplers[i]));
+        }
+        if (DispatchCreateBuffer(device, &buffer_ci, nullptr, &buffers[i]) == VK_SUCCESS) {
+            handles.emplace_back(HandleToUint64(buffers[i]));
+        }
+    }
+    for (uint32_t i = 0; i < kObjectCount; ++i) {
+        if (samplers[i] != VK_NULL_HANDLE) {
+            DispatchDestroySampler(device, samplers[i], nullptr);
+        }
+        if (buffers[i] != VK_NULL_HANDLE) {
+            DispatchDestroyBuffer(device, buffers[i], nullptr);
+        }
+    }
+
+    // An object that couldn't be created says nothing about the driver
+    std::sort(handles.begin(), handles.end());
+    const auto duplicate = std::adjacent_find(handles.begin(), handles.end());
+    const bool null_handle = !handles.empty() && handles.front() == 0;
+    if (duplicate == handles.end() && !null_handle) {
+        return;
+    }
+    handle_collision_reported = true;
+    (void)LogWarning("WARNING-ObjectTracker-HandleCollision", device, loc,
+                     "the driver returned the handle 0x%" PRIxLEAST64
+                     " for two live objects, or a null handle, while checking that its handles are unique. With "
+                     "handle_passthrough the handles of the driver are used as they are, so validation can't tell such objects "
+                     "apart and may report wrong errors. Turn handle_passthrough off for this driver.",
+                     null_handle ? uint64_t(0) : *duplicate);
+}
+
 bool ObjectLifetimes::TracksObject(uint64_t object_handle, VulkanObjectType object_type) const {
     // Look for object in object map
     if (object_map[object_type].contains(object_handle)) {
         return true;
     }
     // If object is an image, also look for it in the swapchain image map
-    if (object_type == kVulkanObjectTypeImage && swapchain_image_map.find(object_handle) != swapchain_image_map.end()) {
+    if (object_type == kVulkanObjectTypeImage && swapchain_image_map.contains(object_handle)) {
         return true;
     }
     return false;
@@ -65,9 +238,8 @@ bool ObjectLifetimes::CheckObjectValidity(uint64_t object_handle, VulkanObjectTy
 
             // Sometimes (calls such as vkRegisterDisplayEventEXT) interact with both the device and physical device
             if (parent_type == kVulkanObjectTypePhysicalDevice) {
-                auto iter = other_lifetimes->object_map[object_type].find(object_handle);
-                if (iter != other_lifetimes->object_map[object_type].end()) {
-                    if (iter->second->parent_object == HandleToUint64(physical_device)) {
+                if (auto node = other_lifetimes->object_map[object_type].find(object_handle)) {
+                    if (node->parent_object == HandleToUint64(physical_device)) {
                         return skip;
                     }
                 }
@@ -120,18 +292,18 @@ bool ObjectLifetimes::CheckPipelineObjectValidity(uint64_t object_handle, const
     if (itr == linked_graphics_pipeline_map.end()) {
         return skip;  // no-linked
     }
-    for (const auto &pipeline : itr->second) {
-        if (!TracksObject(pipeline->handle, kVulkanObjectTypePipeline)) {
+    for (const uint64_t library : itr->second) {
+        if (!TracksObject(library, kVulkanObjectTypePipeline)) {
             skip |= LogError(invalid_handle_vuid, instance, loc,
                              "Invalid VkPipeline Object 0x%" PRIxLEAST64
                              " as it was created with VkPipelineLibraryCreateInfoKHR::pLibraries 0x%" PRIxLEAST64
                              " that doesn't exist anymore. The application must maintain the lifetime of a pipeline library based "
                              "on the pipelines that link with it.",
-                             object_handle, pipeline->handle);
+                             object_handle, library);
             break;
         } else {
             // Libaries pipeline can have their own nested libraries
-            skip |= CheckPipelineObjectValidity(pipeline->handle, invalid_handle_vuid, loc);
+            skip |= CheckPipelineObjectValidity(library, invalid_handle_vuid, loc);
         }
     }
     return skip;
@@ -140,8 +312,7 @@ bool ObjectLifetimes::CheckPipelineObjectValidity(uint64_t object_handle, const
 void ObjectLifetimes::DestroyObjectSilently(uint64_t object, VulkanObjectType object_type) {
     assert(object != HandleToUint64(VK_NULL_HANDLE));
 
-    auto item = object_map[object_type].pop(object);
-    if (item == object_map[object_type].end()) {
+    if (!object_map[object_type].erase(object)) {
         // We've already checked that the object exists. If we couldn't find and atomically remove it
         // from the map, there must have been a race condition in the app. Report an error and move on.
         const Location loc(Func::vkDestroyDevice);
@@ -155,9 +326,59 @@ void ObjectLifetimes::DestroyObjectSilently(uint64_t object, VulkanObjectType ob
     assert(num_total_objects > 0);
 
     num_total_objects--;
-    assert(num_objects[item->second->object_type] > 0);
+    assert(num_objects[object_type] > 0);
+
+    num_objects[object_type]--;
+}
 
-    num_objects[item->second->object_type]--;
+void ObjectLifetimes::InsertChildObject(VulkanObjectType parent_type, ObjTrackState &child_node) {
+    auto parent_node = object_map[parent_type].find(child_node.parent_object);
+    if (!parent_node) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(parent_node->child_objects->lock);
+    child_node.child_index = static_cast<uint32_t>(parent_node->child_objects->handles.size());
+    parent_node->child_objects->handles.emplace_back(child_node.handle);
+}
+
+void ObjectLifetimes::EraseChildObject(VulkanObjectType parent_type, VulkanObjectType child_type, uint64_t child) {
+    auto child_node = object_map[child_type].find(child);
+    if (!child_node) {
+        return;
+    }
+    auto parent_node = object_map[parent_type].find(child_node->parent_object);
+    if (!parent_node) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(parent_node->child_objects->lock);
+    auto &handles = parent_node->child_objects->handles;
+    const uint32_t index = child_node->child_index;
+    if (index >= handles.size() || handles[index] != child) {
+        return;
+    }
+    // Move the last child into the hole
+    if (index + 1 != handles.size()) {
+        handles[index] = handles.back();
+        if (auto moved_node = object_map[child_type].find(handles[index])) {
+            moved_node->child_index = index;
+        }
+    }
+    handles.pop_back();
+}
+
+void ObjectLifetimes::DestroyChildObjects(ObjTrackState &parent_node, VulkanObjectType child_type) {
+    std::vector<uint64_t> handles;
+    {
+        std::lock_guard<std::mutex> guard(parent_node.child_objects->lock);
+        handles.swap(parent_node.child_objects->handles);
+    }
+    uint64_t destroyed_count = 0;
+    for (const uint64_t handle : handles) {
+        destroyed_count += object_map[child_type].erase(handle) ? 1 : 0;
+    }
+    assert(num_objects[child_type] >= destroyed_count);
+    num_objects[child_type] -= destroyed_count;
+    num_total_objects -= destroyed_count;
 }
 
 // Destroy memRef lists and free all memory
@@ -165,21 +386,40 @@ void ObjectLifetimes::DestroyQueueDataStructures() {
     // Destroy the items in the queue map
     auto snapshot = object_map[kVulkanObjectTypeQueue].snapshot();
     for (const auto &queue : snapshot) {
-        uint32_t obj_index = queue.second->object_type;
+        uint32_t obj_index = queue->object_type;
         assert(num_total_objects > 0);
         num_total_objects--;
         assert(num_objects[obj_index] > 0);
         num_objects[obj_index]--;
-        object_map[kVulkanObjectTypeQueue].erase(queue.first);
+        object_map[kVulkanObjectTypeQueue].erase(queue->handle);
     }
 }
 
+// Only called while the instance or device is destroyed, no other thread can use its objects, so they are dropped all at once
 void ObjectLifetimes::DestroyUndestroyedObjects(VulkanObjectType object_type) {
-    auto snapshot = object_map[object_type].snapshot();
-    for (const auto &item : snapshot) {
-        auto object_info = item.second;
-        DestroyObjectSilently(object_info->handle, object_type);
+    const uint64_t count = num_objects[object_type].exchange(0);
+    if (count == 0) {
+        return;
     }
+    object_map[object_type].clear();
+    assert(num_total_objects >= count);
+    num_total_objects -= count;
+}
+
+bool ObjectLifetimes::ValidateObjects(const HandleParam *params, const uint64_t *handles, uint32_t count, const Location &loc,
+                                      VulkanObjectType parent_type) const {
+    bool skip = false;
+    for (uint32_t i = 0; i < count; ++i) {
+        const HandleParam &param = params[i];
+        if (param.null_allowed && handles[i] == 0) {
+            continue;
+        }
+        const char *invalid_handle_vuid = param.invalid_handle_vuid ? param.invalid_handle_vuid : kVUIDUndefined;
+        const char *wrong_parent_vuid = param.wrong_parent_vuid ? param.wrong_parent_vuid : kVUIDUndefined;
+        skip |= CheckObjectValidity(handles[i], param.object_type, invalid_handle_vuid, wrong_parent_vuid, loc.dot(param.field),
+                                    parent_type);
+    }
+    return skip;
 }
 
 bool ObjectLifetimes::ValidateAnonymousObject(uint64_t object, VkObjectType core_object_type, const char *invalid_handle_vuid,
@@ -190,23 +430,25 @@ bool ObjectLifetimes::ValidateAnonymousObject(uint64_t object, VkObjectType core
 
 void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer,
                                             VkCommandBufferLevel level, const Location &loc) {
-    auto new_obj_node = std::make_shared<ObjTrackState>();
-    new_obj_node->object_type = kVulkanObjectTypeCommandBuffer;
-    new_obj_node->handle = HandleToUint64(command_buffer);
-    new_obj_node->parent_object = HandleToUint64(command_pool);
+    ObjTrackState new_obj_node;
+    new_obj_node.object_type = kVulkanObjectTypeCommandBuffer;
+    new_obj_node.handle = HandleToUint64(command_buffer);
+    new_obj_node.parent_object = HandleToUint64(command_pool);
 
-    InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, loc, new_obj_node);
+    InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, loc,
+                 std::move(new_obj_node));
     num_objects[kVulkanObjectTypeCommandBuffer]++;
     num_total_objects++;
+
+    if (auto node = object_map[kVulkanObjectTypeCommandBuffer].find(HandleToUint64(command_buffer))) {
+        InsertChildObject(kVulkanObjectTypeCommandPool, *node);
+    }
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer, const Location &loc) const {
     bool skip = false;
     uint64_t object_handle = HandleToUint64(command_buffer);
-    auto iter = object_map[kVulkanObjectTypeCommandBuffer].find(object_handle);
-    if (iter != object_map[kVulkanObjectTypeCommandBuffer].end()) {
-        auto node = iter->second;
-
+    if (auto node = object_map[kVulkanObjectTypeCommandBuffer].find(object_handle)) {
         if (node->parent_object != HandleToUint64(command_pool)) {
             // We know that the parent *must* be a command pool
             const auto parent_pool = CastFromUint64<VkCommandPool>(node->parent_object);
@@ -223,18 +465,21 @@ bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkComman
 }
 
 void ObjectLifetimes::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set, const Location &loc) {
-    auto new_obj_node = std::make_shared<ObjTrackState>();
-    new_obj_node->object_type = kVulkanObjectTypeDescriptorSet;
-    new_obj_node->status = OBJSTATUS_NONE;
-    new_obj_node->handle = HandleToUint64(descriptor_set);
-    new_obj_node->parent_object = HandleToUint64(descriptor_pool);
-    InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet, loc, new_obj_node);
+    ObjTrackState new_obj_node;
+    new_obj_node.object_type = kVulkanObjectTypeDescriptorSet;
+    new_obj_node.status = OBJSTATUS_NONE;
+    new_obj_node.handle = HandleToUint64(descriptor_set);
+    new_obj_node.parent_object = HandleToUint64(descriptor_pool);
+    if (live_handles) {
+        CheckHandleCollision(new_obj_node.handle, kVulkanObjectTypeDescriptorSet, loc);
+    }
+    InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet, loc,
+                 std::move(new_obj_node));
     num_objects[kVulkanObjectTypeDescriptorSet]++;
     num_total_objects++;
 
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        itr->second->child_objects->insert(HandleToUint64(descriptor_set));
+    if (auto node = object_map[kVulkanObjectTypeDescriptorSet].find(HandleToUint64(descriptor_set))) {
+        InsertChildObject(kVulkanObjectTypeDescriptorPool, *node);
     }
 }
 
@@ -242,11 +487,10 @@ bool ObjectLifetimes::ValidateDescriptorSet(VkDescriptorPool descriptor_pool, Vk
                                             const Location &loc) const {
     bool skip = false;
     uint64_t object_handle = HandleToUint64(descriptor_set);
-    auto ds_item = object_map[kVulkanObjectTypeDescriptorSet].find(object_handle);
-    if (ds_item != object_map[kVulkanObjectTypeDescriptorSet].end()) {
-        if (ds_item->second->parent_object != HandleToUint64(descriptor_pool)) {
+    if (auto ds_node = object_map[kVulkanObjectTypeDescriptorSet].find(object_handle)) {
+        if (ds_node->parent_object != HandleToUint64(descriptor_pool)) {
             // We know that the parent *must* be a descriptor pool
-            const auto parent_pool = CastFromUint64<VkDescriptorPool>(ds_item->second->parent_object);
+            const auto parent_pool = CastFromUint64<VkDescriptorPool>(ds_node->parent_object);
             const LogObjectList objlist(descriptor_set, parent_pool, descriptor_pool);
             skip |= LogError("VUID-vkFreeDescriptorSets-pDescriptorSets-parent", objlist, loc,
                              "attempting to free %s"
@@ -397,39 +641,41 @@ bool ObjectLifetimes::PreCallValidateCmdPushDescriptorSet2KHR(VkCommandBuffer co
 }
 
 void ObjectLifetimes::CreateQueue(VkQueue vkObj, const Location &loc) {
-    std::shared_ptr<ObjTrackState> p_obj_node = NULL;
-    auto queue_item = object_map[kVulkanObjectTypeQueue].find(HandleToUint64(vkObj));
-    if (queue_item == object_map[kVulkanObjectTypeQueue].end()) {
-        p_obj_node = std::make_shared<ObjTrackState>();
-        InsertObject(object_map[kVulkanObjectTypeQueue], vkObj, kVulkanObjectTypeQueue, loc, p_obj_node);
+    if (!object_map[kVulkanObjectTypeQueue].contains(HandleToUint64(vkObj))) {
+        ObjTrackState new_obj_node;
+        new_obj_node.object_type = kVulkanObjectTypeQueue;
+        new_obj_node.status = OBJSTATUS_NONE;
+        new_obj_node.handle = HandleToUint64(vkObj);
+        InsertObject(object_map[kVulkanObjectTypeQueue], vkObj, kVulkanObjectTypeQueue, loc, std::move(new_obj_node));
         num_objects[kVulkanObjectTypeQueue]++;
         num_total_objects++;
-    } else {
-        p_obj_node = queue_item->second;
     }
-    p_obj_node->object_type = kVulkanObjectTypeQueue;
-    p_obj_node->status = OBJSTATUS_NONE;
-    p_obj_node->handle = HandleToUint64(vkObj);
 }
 
 void ObjectLifetimes::CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain, const Location &loc) {
     if (!swapchain_image_map.contains(HandleToUint64(swapchain_image))) {
-        auto new_obj_node = std::make_shared<ObjTrackState>();
-        new_obj_node->object_type = kVulkanObjectTypeImage;
-        new_obj_node->status = OBJSTATUS_NONE;
-        new_obj_node->handle = HandleToUint64(swapchain_image);
-        new_obj_node->parent_object = HandleToUint64(swapchain);
-        InsertObject(swapchain_image_map, swapchain_image, kVulkanObjectTypeImage, loc, new_obj_node);
+        ObjTrackState new_obj_node;
+        new_obj_node.object_type = kVulkanObjectTypeImage;
+        new_obj_node.status = OBJSTATUS_NONE;
+        new_obj_node.handle = HandleToUint64(swapchain_image);
+        new_obj_node.parent_object = HandleToUint64(swapchain);
+        if (live_handles) {
+            CheckHandleCollision(new_obj_node.handle, kVulkanObjectTypeImage, loc);
+        }
+        InsertObject(swapchain_image_map, swapchain_image, kVulkanObjectTypeImage, loc, std::move(new_obj_node));
     }
 }
 
 bool ObjectLifetimes::ReportLeakedInstanceObjects(VkInstance instance, VulkanObjectType object_type, const std::string &error_code,
                                                   const Location &loc) const {
     bool skip = false;
+    // Saves a walk of all the objects for each type nothing leaked of
+    if (num_objects[object_type] == 0) {
+        return skip;
+    }
 
     auto snapshot = object_map[object_type].snapshot();
-    for (const auto &item : snapshot) {
-        const auto object_info = item.second;
+    for (const auto &object_info : snapshot) {
         const LogObjectList objlist(instance, ObjTrackStateTypedHandle(*object_info));
         skip |= LogError(error_code, objlist, loc, "OBJ ERROR : For %s, %s has not been destroyed.", FormatHandle(instance).c_str(),
                          FormatHandle(ObjTrackStateTypedHandle(*object_info)).c_str());
@@ -440,10 +686,12 @@ bool ObjectLifetimes::ReportLeakedInstanceObjects(VkInstance instance, VulkanObj
 bool ObjectLifetimes::ReportLeakedDeviceObjects(VkDevice device, VulkanObjectType object_type, const std::string &error_code,
                                                 const Location &loc) const {
     bool skip = false;
+    if (num_objects[object_type] == 0) {
+        return skip;
+    }
 
     auto snapshot = object_map[object_type].snapshot();
-    for (const auto &item : snapshot) {
-        const auto object_info = item.second;
+    for (const auto &object_info : snapshot) {
         const LogObjectList objlist(device, ObjTrackStateTypedHandle(*object_info));
         skip |= LogError(error_code, objlist, loc, "OBJ ERROR : For %s, %s has not been destroyed.", FormatHandle(device).c_str(),
                          FormatHandle(ObjTrackStateTypedHandle(*object_info)).c_str());
@@ -458,9 +706,7 @@ bool ObjectLifetimes::PreCallValidateDestroyInstance(VkInstance instance, const
     // Checked by chassis: instance: "VUID-vkDestroyInstance-instance-parameter"
 
     auto snapshot = object_map[kVulkanObjectTypeDevice].snapshot();
-    for (const auto &iit : snapshot) {
-        auto node = iit.second;
-
+    for (const auto &node : snapshot) {
         VkDevice device = reinterpret_cast<VkDevice>(node->handle);
         VkDebugReportObjectTypeEXT debug_object_type = GetDebugReport(node->object_type);
 
@@ -490,16 +736,14 @@ void ObjectLifetimes::PreCallRecordDestroyInstance(VkInstance instance, const Vk
                                                    const RecordObject &record_obj) {
     // Destroy physical devices
     auto snapshot = object_map[kVulkanObjectTypePhysicalDevice].snapshot();
-    for (const auto &iit : snapshot) {
-        auto node = iit.second;
+    for (const auto &node : snapshot) {
         VkPhysicalDevice physical_device = reinterpret_cast<VkPhysicalDevice>(node->handle);
         RecordDestroyObject(physical_device, kVulkanObjectTypePhysicalDevice);
     }
 
     // Destroy child devices
     auto snapshot2 = object_map[kVulkanObjectTypeDevice].snapshot();
-    for (const auto &iit : snapshot2) {
-        auto node = iit.second;
+    for (const auto &node : snapshot2) {
         VkDevice device = reinterpret_cast<VkDevice>(node->handle);
         DestroyLeakedInstanceObjects();
 
@@ -586,36 +830,20 @@ bool ObjectLifetimes::PreCallValidateUpdateDescriptorSets(VkDevice device, uint3
 bool ObjectLifetimes::PreCallValidateResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                          VkDescriptorPoolResetFlags flags, const ErrorObject &error_obj) const {
     bool skip = false;
-    auto lock = ReadSharedLock();
     // Checked by chassis: device: "VUID-vkResetDescriptorPool-device-parameter"
 
     skip |= ValidateObject(descriptorPool, kVulkanObjectTypeDescriptorPool, false,
                            "VUID-vkResetDescriptorPool-descriptorPool-parameter",
                            "VUID-vkResetDescriptorPool-descriptorPool-parent", error_obj.location.dot(Field::descriptorPool));
-
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined, error_obj.location);
-        }
-    }
     return skip;
 }
 
 void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                        VkDescriptorPoolResetFlags flags, const RecordObject &record_obj) {
-    auto lock = WriteSharedLock();
     // A DescriptorPool's descriptor sets are implicitly deleted when the pool is reset. Remove this pool's descriptor sets from
     // our descriptorSet map.
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+    if (auto pool_node = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool))) {
+        DestroyChildObjects(*pool_node, kVulkanObjectTypeDescriptorSet);
     }
 }
 
@@ -625,9 +853,7 @@ bool ObjectLifetimes::PreCallValidateBeginCommandBuffer(VkCommandBuffer commandB
     // Checked by chassis: commandBuffer: "VUID-vkBeginCommandBuffer-commandBuffer-parameter"
 
     if (begin_info) {
-        auto iter = object_map[kVulkanObjectTypeCommandBuffer].find(HandleToUint64(commandBuffer));
-        if (iter != object_map[kVulkanObjectTypeCommandBuffer].end()) {
-            auto node = iter->second;
+        if (auto node = object_map[kVulkanObjectTypeCommandBuffer].find(HandleToUint64(commandBuffer))) {
             if ((begin_info->pInheritanceInfo) && error_obj.handle_data->command_buffer.is_secondary &&
                 (begin_info->flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
                 const Location begin_info_loc = error_obj.location.dot(Field::pBeginInfo);
@@ -719,6 +945,9 @@ void ObjectLifetimes::PostCallRecordGetPhysicalDeviceQueueFamilyProperties(VkPhy
 void ObjectLifetimes::PostCallRecordCreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
                                                    VkInstance *pInstance, const RecordObject &record_obj) {
     if (record_obj.result < VK_SUCCESS) return;
+    if (global_settings.handle_passthrough) {
+        EnableHandleCollisionChecks();
+    }
     CreateObject(*pInstance, kVulkanObjectTypeInstance, pAllocator, record_obj.location);
 }
 
@@ -741,6 +970,11 @@ void ObjectLifetimes::PostCallRecordCreateDevice(VkPhysicalDevice physicalDevice
 
     const auto *robustness2_features = vku::FindStructInPNextChain<VkPhysicalDeviceRobustness2FeaturesEXT>(pCreateInfo->pNext);
     object_tracking->null_descriptor_enabled = robustness2_features && robustness2_features->nullDescriptor;
+
+    if (global_settings.handle_passthrough) {
+        object_tracking->EnableHandleCollisionChecks();
+        object_tracking->VerifyDriverHandles(record_obj.location);
+    }
 }
 
 bool ObjectLifetimes::PreCallValidateAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
@@ -766,7 +1000,6 @@ void ObjectLifetimes::PostCallRecordAllocateCommandBuffers(VkDevice device, cons
 bool ObjectLifetimes::PreCallValidateAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
                                                             VkDescriptorSet *pDescriptorSets, const ErrorObject &error_obj) const {
     bool skip = false;
-    auto lock = ReadSharedLock();
     // Checked by chassis: device: "VUID-vkAllocateDescriptorSets-device-parameter"
 
     const Location allocate_info = error_obj.location.dot(Field::pAllocateInfo);
@@ -784,7 +1017,6 @@ bool ObjectLifetimes::PreCallValidateAllocateDescriptorSets(VkDevice device, con
 void ObjectLifetimes::PostCallRecordAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
                                                            VkDescriptorSet *pDescriptorSets, const RecordObject &record_obj) {
     if (record_obj.result < VK_SUCCESS) return;
-    auto lock = WriteSharedLock();
     for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++) {
         AllocateDescriptorSet(pAllocateInfo->descriptorPool, pDescriptorSets[i],
                               record_obj.location.dot(Field::pDescriptorSets, i));
@@ -813,6 +1045,7 @@ bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkComma
 void ObjectLifetimes::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
     for (uint32_t i = 0; i < commandBufferCount; i++) {
+        EraseChildObject(kVulkanObjectTypeCommandPool, kVulkanObjectTypeCommandBuffer, HandleToUint64(pCommandBuffers[i]));
         RecordDestroyObject(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer);
     }
 }
@@ -822,16 +1055,15 @@ void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapch
     RecordDestroyObject(swapchain, kVulkanObjectTypeSwapchainKHR);
 
     auto snapshot = swapchain_image_map.snapshot(
-        [swapchain](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
-    for (const auto &itr : snapshot) {
-        swapchain_image_map.erase(itr.first);
+        [swapchain](const ObjTrackState &node) { return node.parent_object == HandleToUint64(swapchain); });
+    for (const auto &node : snapshot) {
+        swapchain_image_map.erase(node->handle);
     }
 }
 
 bool ObjectLifetimes::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool,
                                                         uint32_t descriptorSetCount, const VkDescriptorSet *pDescriptorSets,
                                                         const ErrorObject &error_obj) const {
-    auto lock = ReadSharedLock();
     bool skip = false;
     // Checked by chassis: device: "VUID-vkFreeDescriptorSets-device-parameter"
 
@@ -850,24 +1082,15 @@ bool ObjectLifetimes::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescr
 }
 void ObjectLifetimes::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                                       const VkDescriptorSet *pDescriptorSets, const RecordObject &record_obj) {
-    auto lock = WriteSharedLock();
-    std::shared_ptr<ObjTrackState> pool_node = nullptr;
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        pool_node = itr->second;
-    }
     for (uint32_t i = 0; i < descriptorSetCount; i++) {
+        EraseChildObject(kVulkanObjectTypeDescriptorPool, kVulkanObjectTypeDescriptorSet, HandleToUint64(pDescriptorSets[i]));
         RecordDestroyObject(pDescriptorSets[i], kVulkanObjectTypeDescriptorSet);
-        if (pool_node) {
-            pool_node->child_objects->erase(HandleToUint64(pDescriptorSets[i]));
-        }
     }
 }
 
 bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                            const VkAllocationCallbacks *pAllocator,
                                                            const ErrorObject &error_obj) const {
-    auto lock = ReadSharedLock();
     bool skip = false;
     // Checked by chassis: device: "VUID-vkDestroyDescriptorPool-device-parameter"
 
@@ -875,15 +1098,6 @@ bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDe
     skip |= ValidateObject(descriptorPool, kVulkanObjectTypeDescriptorPool, true,
                            "VUID-vkDestroyDescriptorPool-descriptorPool-parameter",
                            "VUID-vkDestroyDescriptorPool-descriptorPool-parent", descriptor_pool_loc);
-
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined, error_obj.location);
-        }
-    }
     skip |= ValidateDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool, pAllocator,
                                   "VUID-vkDestroyDescriptorPool-descriptorPool-00304",
                                   "VUID-vkDestroyDescriptorPool-descriptorPool-00305", descriptor_pool_loc);
@@ -891,14 +1105,8 @@ bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDe
 }
 void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                          const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
-    auto lock = WriteSharedLock();
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+    if (auto pool_node = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool))) {
+        DestroyChildObjects(*pool_node, kVulkanObjectTypeDescriptorSet);
     }
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool);
 }
@@ -912,15 +1120,6 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
     const Location command_pool_loc = error_obj.location.dot(Field::commandPool);
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent", command_pool_loc);
-
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto &itr : snapshot) {
-        auto node = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first), command_pool_loc);
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
-                                      kVUIDUndefined, kVUIDUndefined, error_obj.location);
-    }
     skip |=
         ValidateDestroyObject(commandPool, kVulkanObjectTypeCommandPool, pAllocator, "VUID-vkDestroyCommandPool-commandPool-00042",
                               "VUID-vkDestroyCommandPool-commandPool-00043", command_pool_loc);
@@ -929,11 +1128,9 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto &itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
+    if (auto pool_node = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool))) {
+        DestroyChildObjects(*pool_node, kVulkanObjectTypeCommandBuffer);
     }
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool);
 }
@@ -966,14 +1163,13 @@ void ObjectLifetimes::PostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(V
                                                                                const RecordObject &record_obj) {}
 
 void ObjectLifetimes::AllocateDisplayKHR(VkPhysicalDevice physical_device, VkDisplayKHR display, const Location &loc) {
-    auto iter = object_map[kVulkanObjectTypeDisplayKHR].find(HandleToUint64(display));
-    if (iter == object_map[kVulkanObjectTypeDisplayKHR].end()) {
-        auto new_obj_node = std::make_shared<ObjTrackState>();
-        new_obj_node->status = OBJSTATUS_NONE;
-        new_obj_node->object_type = kVulkanObjectTypeDisplayKHR;
-        new_obj_node->handle = HandleToUint64(display);
-        new_obj_node->parent_object = HandleToUint64(physical_device);
-        InsertObject(object_map[kVulkanObjectTypeDisplayKHR], display, kVulkanObjectTypeDisplayKHR, loc, new_obj_node);
+    if (!object_map[kVulkanObjectTypeDisplayKHR].contains(HandleToUint64(display))) {
+        ObjTrackState new_obj_node;
+        new_obj_node.status = OBJSTATUS_NONE;
+        new_obj_node.object_type = kVulkanObjectTypeDisplayKHR;
+        new_obj_node.handle = HandleToUint64(display);
+        new_obj_node.parent_object = HandleToUint64(physical_device);
+        InsertObject(object_map[kVulkanObjectTypeDisplayKHR], display, kVulkanObjectTypeDisplayKHR, loc, std::move(new_obj_node));
         num_objects[kVulkanObjectTypeDisplayKHR]++;
         num_total_objects++;
     }
@@ -1514,11 +1710,9 @@ void ObjectLifetimes::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkP
             if (auto pNext = vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(pCreateInfos[index].pNext)) {
                 if ((pNext->libraryCount > 0) && (pNext->pLibraries)) {
                     const uint64_t linked_handle = HandleToUint64(pPipelines[index]);
-                    small_vector<std::shared_ptr<ObjTrackState>, 4> libraries;
+                    object_list_map_type libraries;
                     for (uint32_t index2 = 0; index2 < pNext->libraryCount; ++index2) {
-                        const uint64_t library_handle = HandleToUint64(pNext->pLibraries[index2]);
-                        const auto &linked_pipeline = object_map[kVulkanObjectTypePipeline].find(library_handle);
-                        libraries.emplace_back(linked_pipeline->second);
+                        libraries.emplace_back(HandleToUint64(pNext->pLibraries[index2]));
                     }
                     linked_graphics_pipeline_map.insert(linked_handle, libraries);
                 }
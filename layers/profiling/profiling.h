@@ -21,14 +21,20 @@
 #include "tracy/Tracy.hpp"
 #include "tracy/TracyC.h"
 #include "tracy/../client/TracyProfiler.hpp"
+#include <cstring>
 
 // Define CPU zones
 #define VVL_ZoneScoped ZoneScoped
 #define VVL_ZoneScopedN(name) ZoneScopedN(name)
+// Attaches a null terminated string to the current zone
+#define VVL_ZoneText(text) ZoneText(text, std::strlen(text))
 #define VVL_TracyCZone(zone_name, active) TracyCZone(zone_name, active)
 #define VVL_TracyCZoneEnd(zone_name) TracyCZoneEnd(zone_name)
 #define VVL_TracyCFrameMark TracyCFrameMark
 
+// Plot a value over time
+#define VVL_TracyPlot(name, value) TracyPlot(name, value)
+
 // Print messages
 #define VVL_TracyMessage TracyMessage
 #define VVL_TracyMessageStream(message)                \
@@ -59,9 +65,11 @@
 #else
 #define VVL_ZoneScoped
 #define VVL_ZoneScopedN(name)
+#define VVL_ZoneText(text)
 #define VVL_TracyCZone(zone_name, active)
 #define VVL_TracyCZoneEnd(zone_name)
 #define VVL_TracyCFrameMark
+#define VVL_TracyPlot(name, value)
 #define VVL_TracyMessage
 #define VVL_TracyMessageStream(message)
 #define VVL_TracyMessageMap(map, key_printer, value_printer)
@@ -97,6 +97,23 @@ bool Buffer::CompareCreateInfo(const Buffer &other) const {
            valid_queue_family;
 }
 
+std::optional<VkFormatFeatureFlags2KHR> Buffer::FindViewFormatFeatures(VkFormat format) const {
+    std::lock_guard<std::mutex> guard(view_format_features_lock_);
+    for (const auto &[entry_format, features] : view_format_features_) {
+        if (entry_format == format) {
+            return features;
+        }
+    }
+    return {};
+}
+
+void Buffer::AddViewFormatFeatures(VkFormat format, VkFormatFeatureFlags2KHR features) {
+    std::lock_guard<std::mutex> guard(view_format_features_lock_);
+    if (view_format_features_.size() < kMaxViewFormatFeatures) {
+        view_format_features_.emplace_back(format, features);
+    }
+}
+
 BufferView::BufferView(const std::shared_ptr<vvl::Buffer> &bf, VkBufferView handle, const VkBufferViewCreateInfo *pCreateInfo,
                        VkFormatFeatureFlags2KHR format_features)
     : StateObject(handle, kVulkanObjectTypeBufferView),
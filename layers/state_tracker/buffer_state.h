@@ -18,6 +18,8 @@
  * limitations under the License.
  */
 #pragma once
+#include <mutex>
+#include <optional>
 #include <variant>
 #include "state_tracker/device_memory_state.h"
 #include "containers/range_vector.h"
@@ -72,8 +74,18 @@ class Buffer : public Bindable {
     // This function is only used for comparing Imported External Dedicated Memory
     bool CompareCreateInfo(const Buffer &other) const;
 
+    // Buffer features of the formats of the views of this buffer, which are created and destroyed over and over with the same
+    // create info, only the first one queries the driver
+    std::optional<VkFormatFeatureFlags2KHR> FindViewFormatFeatures(VkFormat format) const;
+    void AddViewFormatFeatures(VkFormat format, VkFormatFeatureFlags2KHR features);
+
   private:
     std::variant<std::monostate, BindableLinearMemoryTracker, BindableSparseMemoryTracker> tracker_;
+
+    // Views of a given buffer rarely use more than a couple of formats
+    static constexpr size_t kMaxViewFormatFeatures = 8;
+    mutable std::mutex view_format_features_lock_;
+    small_vector<std::pair<VkFormat, VkFormatFeatureFlags2KHR>, 2> view_format_features_;
 };
 
 class BufferView : public StateObject {
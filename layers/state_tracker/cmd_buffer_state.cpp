@@ -18,6 +18,10 @@
  * limitations under the License.
  */
 #include "state_tracker/cmd_buffer_state.h"
+
+#include <algorithm>
+#include <cstring>
+
 #include "state_tracker/descriptor_sets.h"
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/pipeline_state.h"
@@ -145,10 +149,22 @@ void CommandPool::Free(uint32_t count, const VkCommandBuffer *command_buffers) {
 }
 
 void CommandPool::Reset(const Location &loc) {
+    // The command buffers of a pool usually bind the same objects. Their links are dropped once per child instead of once
+    // per command buffer and child, the storage of each command buffer is cleared in place and reused.
+    CommandBuffer::ReleasedChildren released;
     for (auto &entry : commandBuffers) {
         auto guard = entry.second->WriteLock();
+        entry.second->ReleaseChildren(released);
         entry.second->Reset(loc);
     }
+    for (auto &[child, release] : released) {
+        if (!release.parents.empty()) {
+            child->RemoveParents(release.parents);
+        }
+        if (release.lazy_parent_count != 0) {
+            child->RemoveLazyParents(release.lazy_parent_count);
+        }
+    }
 }
 
 void CommandPool::Destroy() {
@@ -172,10 +188,17 @@ CommandBuffer::CommandBuffer(ValidationStateTracker &dev, VkCommandBuffer handle
       command_pool(pool),
       dev_data(dev),
       unprotected(pool->unprotected),
-      lastBound({*this, *this, *this}) {
+      lastBound({*this, *this, *this}),
+      lazy_bindings_(dev.global_settings.lazy_object_bindings) {
     ResetCBState();
 }
 
+void CommandBuffer::LinkChildNodes() {
+    if (lazy_bindings_) {
+        RegisterLazyParent(shared_from_this());
+    }
+}
+
 // Get the image viewstate for a given framebuffer attachment
 vvl::ImageView *CommandBuffer::GetActiveAttachmentImageViewState(uint32_t index) {
     assert(!active_attachments.empty() && index != VK_ATTACHMENT_UNUSED && (index < active_attachments.size()));
@@ -192,23 +215,57 @@ const vvl::ImageView *CommandBuffer::GetActiveAttachmentImageViewState(uint32_t
 
 void CommandBuffer::AddChild(std::shared_ptr<StateObject> &child_node) {
     assert(child_node);
-    if (child_node->AddParent(this)) {
+    if (IsLazyChild(*child_node)) {
+        if (object_bindings.insert(child_node).second) {
+            child_node->AddLazyParent();
+        }
+    } else if (child_node->AddParent(this)) {
         object_bindings.insert(child_node);
     }
 }
 
 void CommandBuffer::RemoveChild(std::shared_ptr<StateObject> &child_node) {
     assert(child_node);
-    child_node->RemoveParent(this);
-    object_bindings.erase(child_node);
+    if (object_bindings.erase(child_node)) {
+        UnlinkChild(*child_node);
+    } else if (!IsLazyChild(*child_node)) {
+        child_node->RemoveParent(this);
+    }
+}
+
+void CommandBuffer::ReleaseChildren(ReleasedChildren &released) {
+    for (const auto &child_node : object_bindings) {
+        ReleasedChild &release = released[child_node];
+        if (IsLazyChild(*child_node)) {
+            ++release.lazy_parent_count;
+        } else {
+            release.parents.emplace_back(this);
+        }
+    }
+    object_bindings.clear();
+}
+
+void CommandBuffer::UnlinkChild(StateObject &child_node) {
+    if (IsLazyChild(child_node)) {
+        child_node.RemoveLazyParent();
+    } else {
+        child_node.RemoveParent(this);
+    }
+}
+
+bool CommandBuffer::HasLazyChild(const std::shared_ptr<StateObject> &child_node) const {
+    auto guard = ReadLock();
+    return object_bindings.find(child_node) != object_bindings.end();
 }
 
 // Reset the command buffer state
 // Maintain the createInfo and set state to CB_NEW, but clear all other state
 void CommandBuffer::ResetCBState() {
-    // Remove object bindings
-    for (const auto &obj : object_bindings) {
-        obj->RemoveParent(this);
+    // Remove object bindings, the children go away with the command buffer during a device teardown
+    if (!InTeardown()) {
+        for (const auto &obj : object_bindings) {
+            UnlinkChild(*obj);
+        }
     }
     object_bindings.clear();
     broken_bindings.clear();
@@ -257,6 +314,7 @@ void CommandBuffer::ResetCBState() {
     attachment_source = AttachmentSource::Empty;
     active_attachments.clear();
     active_subpasses.clear();
+    validated_descriptor_bindings.clear();
     active_color_attachments_index.clear();
     has_render_pass_striped = false;
     striped_count = 0;
@@ -279,6 +337,8 @@ void CommandBuffer::ResetCBState() {
     cmd_execute_commands_functions.clear();
     eventUpdates.clear();
     queryUpdates.clear();
+    event_state_records_.clear();
+    query_state_records_.clear();
 
     for (auto &item : lastBound) {
         item.Reset();
@@ -309,7 +369,7 @@ void CommandBuffer::ResetCBState() {
     // Clean up the label data
     dev_data.debug_report->ResetCmdDebugUtilsLabel(VkHandle());
 
-    push_constant_data_chunks.clear();
+    ClearPushConstants();
     push_constant_latest_used_layout.fill(VK_NULL_HANDLE);
     push_constant_ranges_layout = nullptr;
 }
@@ -346,7 +406,46 @@ void CommandBuffer::ResetPushConstantRangesLayoutIfIncompatible(const vvl::Pipel
     }
 
     push_constant_ranges_layout = pipeline_layout_state.push_constant_ranges_layout;
+    ClearPushConstants();
+}
+
+void CommandBuffer::RecordPushConstants(VkPipelineLayout layout, VkShaderStageFlags stage_flags, uint32_t offset, uint32_t size,
+                                        const void *values) {
+    const uint32_t end = offset + size;
+    if (push_constant_values.size() < end) {
+        // Sized once per command buffer, larger only when an invalid call went through
+        push_constant_values.resize(std::max(end, dev_data.phys_dev_props.limits.maxPushConstantsSize));
+        push_constant_set_words.resize((push_constant_values.size() / 4 + 63) / 64);
+    }
+    std::memcpy(push_constant_values.data() + offset, values, size);
+    for (uint32_t word = offset / 4; word < (end + 3) / 4; ++word) {
+        push_constant_set_words[word / 64] |= uint64_t(1) << (word % 64);
+    }
+
+    // Replaying the remaining calls in order still sets the current values, as they all read them from push_constant_values
+    vvl::erase_if(push_constant_data_chunks, [&](const PushConstantData &chunk) {
+        return chunk.layout == layout && chunk.stage_flags == stage_flags && chunk.offset >= offset &&
+               chunk.offset + chunk.size <= end;
+    });
+    push_constant_data_chunks.emplace_back(PushConstantData{layout, stage_flags, offset, size});
+}
+
+void CommandBuffer::ClearPushConstants() {
     push_constant_data_chunks.clear();
+    std::fill(push_constant_set_words.begin(), push_constant_set_words.end(), 0);
+}
+
+uint32_t CommandBuffer::PushConstantBytesNotSet(uint32_t offset, uint32_t size) const {
+    uint32_t not_set = 0;
+    const uint32_t end = offset + size;
+    for (uint32_t word = offset / 4; word < (end + 3) / 4; ++word) {
+        const bool set = (word / 64) < push_constant_set_words.size() &&
+                         (push_constant_set_words[word / 64] & (uint64_t(1) << (word % 64))) != 0;
+        if (!set) {
+            not_set += std::min(end, (word + 1) * 4) - std::max(offset, word * 4);
+        }
+    }
+    return not_set;
 }
 
 void CommandBuffer::Destroy() {
@@ -356,6 +455,9 @@ void CommandBuffer::Destroy() {
         auto guard = WriteLock();
         ResetCBState();
     }
+    if (lazy_bindings_) {
+        UnregisterLazyParent(this);
+    }
     StateObject::Destroy();
 }
 
@@ -375,7 +477,7 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
             // being tracked by the command buffer. This is to try to avoid race conditions
             // caused by separate CommandBuffer and StateObject::parent_nodes locking.
             if (object_bindings.erase(obj)) {
-                obj->RemoveParent(this);
+                UnlinkChild(*obj);
                 found_invalid = true;
             }
             switch (obj->Type()) {
@@ -458,19 +560,65 @@ std::shared_ptr<ImageSubresourceLayoutMap> CommandBuffer::GetImageSubresourceLay
     return layout_map;
 }
 
-static bool SetQueryState(const QueryObject &object, QueryState value, QueryMap *localQueryToStateMap) {
-    (*localQueryToStateMap)[object] = value;
-    return false;
+bool CommandBuffer::UpdateQueries(bool do_validate, VkQueryPool &first_perf_query_pool, uint32_t perf_query_pass,
+                                  QueryMap *local_query_to_state_map) {
+    bool skip = false;
+    size_t callback_index = 0;
+    auto run_callbacks = [&](size_t callback_end) {
+        for (; callback_index < callback_end; ++callback_index) {
+            skip |= queryUpdates[callback_index](*this, do_validate, first_perf_query_pool, perf_query_pass,
+                                                 local_query_to_state_map);
+        }
+    };
+    for (const QueryStateRecord &record : query_state_records_) {
+        run_callbacks(record.callbacks_before);
+        if (record.secondary != VK_NULL_HANDLE) {
+            if (auto sub_cb_state = dev_data.GetWrite<CommandBuffer>(record.secondary)) {
+                skip |= sub_cb_state->UpdateQueries(do_validate, first_perf_query_pool, perf_query_pass, local_query_to_state_map);
+            }
+            continue;
+        }
+        for (uint32_t i = 0; i < record.query_count; ++i) {
+            const QueryObject query_obj(record.pool, record.first_query + i, 0, perf_query_pass);
+            (*local_query_to_state_map)[query_obj] = record.state;
+        }
+    }
+    run_callbacks(queryUpdates.size());
+    return skip;
+}
+
+void CommandBuffer::ForEachQueryStateRecord(const std::function<void(const QueryStateRecord &record)> &func) {
+    for (const QueryStateRecord &record : query_state_records_) {
+        if (record.secondary == VK_NULL_HANDLE) {
+            func(record);
+        } else if (auto sub_cb_state = dev_data.GetWrite<CommandBuffer>(record.secondary)) {
+            sub_cb_state->ForEachQueryStateRecord(func);
+        }
+    }
+}
+
+bool CommandBuffer::UpdateEvents(bool do_validate, EventMap &local_event_signal_info, VkQueue waiting_queue,
+                                 const Location &loc) {
+    bool skip = false;
+    size_t callback_index = 0;
+    auto run_callbacks = [&](size_t callback_end) {
+        for (; callback_index < callback_end; ++callback_index) {
+            skip |= eventUpdates[callback_index](*this, do_validate, local_event_signal_info, waiting_queue, loc);
+        }
+    };
+    for (const EventStateRecord &record : event_state_records_) {
+        run_callbacks(record.callbacks_before);
+        local_event_signal_info[record.event] = EventInfo{record.src_stage_mask, record.signal};
+    }
+    run_callbacks(eventUpdates.size());
+    return skip;
 }
 
 void CommandBuffer::BeginQuery(const QueryObject &query_obj) {
     activeQueries.insert(query_obj);
     startedQueries.insert(query_obj);
-    queryUpdates.emplace_back([query_obj](CommandBuffer &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                          uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_RUNNING, localQueryToStateMap);
-        return false;
-    });
+    query_state_records_.emplace_back(
+        QueryStateRecord{query_obj.pool, query_obj.slot, 1, QUERYSTATE_RUNNING, static_cast<uint32_t>(queryUpdates.size())});
     updatedQueries.insert(query_obj);
     if (query_obj.inside_render_pass) {
         renderPassQueries.insert(query_obj);
@@ -479,10 +627,8 @@ void CommandBuffer::BeginQuery(const QueryObject &query_obj) {
 
 void CommandBuffer::EndQuery(const QueryObject &query_obj) {
     activeQueries.erase(query_obj);
-    queryUpdates.emplace_back([query_obj](CommandBuffer &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                          uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        return SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_ENDED, localQueryToStateMap);
-    });
+    query_state_records_.emplace_back(
+        QueryStateRecord{query_obj.pool, query_obj.slot, 1, QUERYSTATE_ENDED, static_cast<uint32_t>(queryUpdates.size())});
     updatedQueries.insert(query_obj);
     if (query_obj.inside_render_pass) {
         renderPassQueries.erase(query_obj);
@@ -501,26 +647,14 @@ bool CommandBuffer::UpdatesQuery(const QueryObject &query_obj) const {
     return updatedQueries.find(key) != updatedQueries.end();
 }
 
-static bool SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, uint32_t perfPass, QueryState value,
-                               QueryMap *localQueryToStateMap) {
-    for (uint32_t i = 0; i < queryCount; i++) {
-        QueryObject query_obj = {queryPool, firstQuery + i, perfPass};
-        (*localQueryToStateMap)[query_obj] = value;
-    }
-    return false;
-}
-
 void CommandBuffer::EndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     for (uint32_t slot = firstQuery; slot < (firstQuery + queryCount); slot++) {
         QueryObject query_obj = {queryPool, slot};
         activeQueries.erase(query_obj);
         updatedQueries.insert(query_obj);
     }
-    queryUpdates.emplace_back([queryPool, firstQuery, queryCount](CommandBuffer &cb_state_arg, bool do_validate,
-                                                                  VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                                  QueryMap *localQueryToStateMap) {
-        return SetQueryStateMulti(queryPool, firstQuery, queryCount, perfQueryPass, QUERYSTATE_ENDED, localQueryToStateMap);
-    });
+    query_state_records_.emplace_back(
+        QueryStateRecord{queryPool, firstQuery, queryCount, QUERYSTATE_ENDED, static_cast<uint32_t>(queryUpdates.size())});
 }
 
 void CommandBuffer::ResetQueryPool(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
@@ -529,11 +663,8 @@ void CommandBuffer::ResetQueryPool(VkQueryPool queryPool, uint32_t firstQuery, u
         updatedQueries.insert(query_obj);
     }
 
-    queryUpdates.emplace_back([queryPool, firstQuery, queryCount](CommandBuffer &cb_state_arg, bool do_validate,
-                                                                  VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                                  QueryMap *localQueryToStateMap) {
-        return SetQueryStateMulti(queryPool, firstQuery, queryCount, perfQueryPass, QUERYSTATE_RESET, localQueryToStateMap);
-    });
+    query_state_records_.emplace_back(
+        QueryStateRecord{queryPool, firstQuery, queryCount, QUERYSTATE_RESET, static_cast<uint32_t>(queryUpdates.size())});
 }
 
 void CommandBuffer::UpdateSubpassAttachments() {
@@ -607,6 +738,7 @@ void CommandBuffer::UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPa
 
 void CommandBuffer::BeginRenderPass(Func command, const VkRenderPassBeginInfo *pRenderPassBegin, const VkSubpassContents contents) {
     RecordCmd(command);
+    attachments_change_count++;
     activeFramebuffer = dev_data.Get<vvl::Framebuffer>(pRenderPassBegin->framebuffer);
     activeRenderPass = dev_data.Get<vvl::RenderPass>(pRenderPassBegin->renderPass);
     active_render_pass_begin_info = vku::safe_VkRenderPassBeginInfo(pRenderPassBegin);
@@ -653,6 +785,7 @@ void CommandBuffer::BeginRenderPass(Func command, const VkRenderPassBeginInfo *p
 
 void CommandBuffer::NextSubpass(Func command, VkSubpassContents contents) {
     RecordCmd(command);
+    attachments_change_count++;
     SetActiveSubpass(GetActiveSubpass() + 1);
     activeSubpassContents = contents;
 
@@ -673,6 +806,7 @@ void CommandBuffer::NextSubpass(Func command, VkSubpassContents contents) {
 
 void CommandBuffer::EndRenderPass(Func command) {
     RecordCmd(command);
+    attachments_change_count++;
     activeRenderPass = nullptr;
     attachment_source = AttachmentSource::Empty;
     active_attachments.clear();
@@ -684,6 +818,7 @@ void CommandBuffer::EndRenderPass(Func command) {
 
 void CommandBuffer::BeginRendering(Func command, const VkRenderingInfo *pRenderingInfo) {
     RecordCmd(command);
+    attachments_change_count++;
     activeRenderPass = std::make_shared<vvl::RenderPass>(pRenderingInfo, true);
     renderPassQueries.clear();
 
@@ -771,6 +906,7 @@ void CommandBuffer::BeginRendering(Func command, const VkRenderingInfo *pRenderi
 
 void CommandBuffer::EndRendering(Func command) {
     RecordCmd(command);
+    attachments_change_count++;
     activeRenderPass = nullptr;
     active_color_attachments_index.clear();
 }
@@ -898,13 +1034,8 @@ void CommandBuffer::ControlVideoCoding(const VkVideoCodingControlInfoKHR *pContr
 }
 
 void vvl::CommandBuffer::EnqueueUpdateVideoInlineQueries(const VkVideoInlineQueryInfoKHR &query_info) {
-    queryUpdates.emplace_back([query_info](vvl::CommandBuffer &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                           uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        for (uint32_t i = 0; i < query_info.queryCount; i++) {
-            SetQueryState(QueryObject(query_info.queryPool, query_info.firstQuery + i), QUERYSTATE_ENDED, localQueryToStateMap);
-        }
-        return false;
-    });
+    query_state_records_.emplace_back(QueryStateRecord{query_info.queryPool, query_info.firstQuery, query_info.queryCount,
+                                                       QUERYSTATE_ENDED, static_cast<uint32_t>(queryUpdates.size())});
     for (uint32_t i = 0; i < query_info.queryCount; i++) {
         updatedQueries.insert(QueryObject(query_info.queryPool, query_info.firstQuery + i));
     }
@@ -1059,6 +1190,12 @@ void CommandBuffer::End(VkResult result) {
     if (VK_SUCCESS == result) {
         state = CbState::Recorded;
     }
+    // The layout maps are read from other threads once recorded (queue submissions), build them now so these reads never write
+    for (const auto &entry : image_layout_map) {
+        if (entry.second.map) {
+            entry.second.map->BuildLayoutMap();
+        }
+    }
 }
 
 void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers) {
@@ -1095,24 +1232,36 @@ void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_c
         // Add a query update that runs all the query updates that happen in the sub command buffer.
         // This avoids locking ambiguity because primary command buffers are locked when these
         // callbacks run, but secondary command buffers are not.
-        queryUpdates.emplace_back([sub_command_buffer](CommandBuffer &cb_state_arg, bool do_validate,
-                                                       VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                       QueryMap *localQueryToStateMap) {
-            bool skip = false;
-            auto sub_cb_state_arg = cb_state_arg.dev_data.GetWrite<CommandBuffer>(sub_command_buffer);
-            for (auto &function : sub_cb_state_arg->queryUpdates) {
-                skip |= function(*sub_cb_state_arg, do_validate, firstPerfQueryPool, perfQueryPass, localQueryToStateMap);
-            }
-            return skip;
-        });
-        for (auto &function : sub_cb_state->eventUpdates) {
-            eventUpdates.push_back(function);
-        }
-        for (auto &event : sub_cb_state->events) {
-            events.push_back(event);
-        }
-        for (auto &function : sub_cb_state->queue_submit_functions) {
-            queue_submit_functions.push_back(function);
+        query_state_records_.emplace_back(QueryStateRecord{VK_NULL_HANDLE, 0, 0, QUERYSTATE_UNKNOWN,
+                                                           static_cast<uint32_t>(queryUpdates.size()), sub_command_buffer});
+        // The event updates and submit time functions of the secondary are not copied either, they are run from its own
+        // lists, like the query updates. The secondary can't be re-recorded without invalidating this command buffer.
+        if (!sub_cb_state->eventUpdates.empty() || !sub_cb_state->event_state_records_.empty()) {
+            eventUpdates.emplace_back([sub_command_buffer](CommandBuffer &cb_state_arg, bool do_validate,
+                                                           EventMap &local_event_signal_info, VkQueue waiting_queue,
+                                                           const Location &loc) {
+                auto sub_cb_state_arg = cb_state_arg.dev_data.GetWrite<CommandBuffer>(sub_command_buffer);
+                if (!sub_cb_state_arg) {
+                    return false;
+                }
+                return sub_cb_state_arg->UpdateEvents(do_validate, local_event_signal_info, waiting_queue, loc);
+            });
+        }
+        events.insert(events.end(), sub_cb_state->events.begin(), sub_cb_state->events.end());
+        if (!sub_cb_state->queue_submit_functions.empty()) {
+            queue_submit_functions.emplace_back([sub_command_buffer](const ValidationStateTracker &device_data,
+                                                                     const vvl::Queue &queue_state,
+                                                                     const CommandBuffer &cb_state_arg) {
+                bool skip = false;
+                auto sub_cb_state_arg = device_data.GetRead<CommandBuffer>(sub_command_buffer);
+                if (!sub_cb_state_arg) {
+                    return skip;
+                }
+                for (const auto &function : sub_cb_state_arg->queue_submit_functions) {
+                    skip |= function(device_data, queue_state, cb_state_arg);
+                }
+                return skip;
+            });
         }
 
         // State is trashed after executing secondary command buffers.
@@ -1193,7 +1342,8 @@ void CommandBuffer::UpdateTraceRayCmd(Func command) {
 
 // Generic function to handle state update for all Provoking functions calls (draw/dispatch/traceray/etc)
 void CommandBuffer::UpdatePipelineState(Func command, const VkPipelineBindPoint bind_point) {
-    RecordCmd(command);
+    // Not RecordCmd(), action commands only consume the bound state so they leave bound_state_generation alone
+    command_count++;
 
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     auto &last_bound = lastBound[lv_bind_point];
@@ -1215,7 +1365,7 @@ void CommandBuffer::UpdatePipelineState(Func command, const VkPipelineBindPoint
     }
 
     if (last_bound.desc_set_pipeline_layout != VK_NULL_HANDLE) {
-        for (const auto &set_binding_pair : pipe->active_slots) {
+        for (const auto &set_binding_pair : pipe->ActiveSlots()) {
             uint32_t set_index = set_binding_pair.first;
             if (set_index >= last_bound.per_set.size()) {
                 continue;
@@ -1343,9 +1493,8 @@ void CommandBuffer::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipeline_b
             auto set_dynamic_descriptor_count = descriptor_set->GetDynamicDescriptorCount();
             // TODO: Add logic for tracking push_descriptor offsets (here or in caller)
             if (set_dynamic_descriptor_count && input_dynamic_offsets) {
-                const uint32_t *end_offset = input_dynamic_offsets + set_dynamic_descriptor_count;
-                set_info.dynamicOffsets = std::vector<uint32_t>(input_dynamic_offsets, end_offset);
-                input_dynamic_offsets = end_offset;
+                set_info.dynamicOffsets.PushBackFrom(vvl::make_span(input_dynamic_offsets, set_dynamic_descriptor_count));
+                input_dynamic_offsets += set_dynamic_descriptor_count;
                 assert(input_dynamic_offsets <= (p_dynamic_offsets + dynamic_offset_count));
             } else {
                 set_info.dynamicOffsets.clear();
@@ -1365,8 +1514,29 @@ void CommandBuffer::UpdateLastBoundDescriptorBuffers(VkPipelineBindPoint pipelin
     // Some useful shorthand
     const auto lv_bind_point = ConvertToLvlBindPoint(pipeline_bind_point);
     auto &last_bound = lastBound[lv_bind_point];
-    last_bound.desc_set_pipeline_layout = pipeline_layout.VkHandle();
     auto &pipe_compat_ids = pipeline_layout.set_compat_ids;
+
+    // Action command validation only looks at which sets have a descriptor buffer and at their compatibility, not at the
+    // buffer index and offset. Moving already bound sets to other offsets (usually done once per draw) leaves the result of
+    // that validation alone, so only other updates bump bound_state_generation.
+    bool offsets_only =
+        last_bound.desc_set_pipeline_layout == pipeline_layout.VkHandle() && required_size <= last_bound.per_set.size();
+    for (uint32_t set_idx = 0; offsets_only && set_idx < required_size; ++set_idx) {
+        const auto &set_info = last_bound.per_set[set_idx];
+        if (set_info.bound_descriptor_set) {
+            offsets_only = false;
+        } else if (set_idx < first_set) {
+            // Reset below
+            offsets_only = !set_info.bound_descriptor_buffer.has_value();
+        } else {
+            offsets_only = set_info.bound_descriptor_buffer.has_value() && set_info.compat_id_for_set == pipe_compat_ids[set_idx];
+        }
+    }
+    if (!offsets_only) {
+        bound_state_generation++;
+    }
+
+    last_bound.desc_set_pipeline_layout = pipeline_layout.VkHandle();
     // Resize binding arrays
     if (last_binding_index >= last_bound.per_set.size()) {
         last_bound.per_set.resize(required_size);
@@ -1477,7 +1647,15 @@ void CommandBuffer::SetImageViewLayout(const vvl::ImageView &view_state, VkImage
     }
 }
 
-void CommandBuffer::RecordCmd(Func command) { command_count++; }
+void CommandBuffer::RecordCmd(Func command) {
+    command_count++;
+    // Push constant values are never looked at by action command validation, and UpdateLastBoundDescriptorBuffers() decides
+    // for descriptor buffer offsets
+    if (command != Func::vkCmdPushConstants && command != Func::vkCmdPushConstants2KHR &&
+        command != Func::vkCmdSetDescriptorBufferOffsetsEXT && command != Func::vkCmdSetDescriptorBufferOffsets2EXT) {
+        bound_state_generation++;
+    }
+}
 
 void CommandBuffer::RecordStateCmd(Func command, CBDynamicState state) {
     RecordCmd(command);
@@ -1517,11 +1695,7 @@ void CommandBuffer::RecordSetEvent(Func command, VkEvent event, VkPipelineStageF
     if (!waitedEvents.count(event)) {
         writeEventsBeforeWait.push_back(event);
     }
-    eventUpdates.emplace_back(
-        [event, stageMask](CommandBuffer &, bool do_validate, EventMap &local_event_signal_info, VkQueue, const Location &loc) {
-            local_event_signal_info[event] = EventInfo{stageMask, true};
-            return false;  // skip
-        });
+    event_state_records_.emplace_back(EventStateRecord{event, stageMask, true, static_cast<uint32_t>(eventUpdates.size())});
 }
 
 void CommandBuffer::RecordResetEvent(Func command, VkEvent event, VkPipelineStageFlags2KHR stageMask) {
@@ -1536,12 +1710,8 @@ void CommandBuffer::RecordResetEvent(Func command, VkEvent event, VkPipelineStag
     if (!waitedEvents.count(event)) {
         writeEventsBeforeWait.push_back(event);
     }
-
-    eventUpdates.emplace_back(
-        [event](CommandBuffer &, bool do_validate, EventMap &local_event_signal_info, VkQueue, const Location &loc) {
-            local_event_signal_info[event] = EventInfo{VK_PIPELINE_STAGE_2_NONE, false};
-            return false;  // skip
-        });
+    event_state_records_.emplace_back(
+        EventStateRecord{event, VK_PIPELINE_STAGE_2_NONE, false, static_cast<uint32_t>(eventUpdates.size())});
 }
 
 void CommandBuffer::RecordWaitEvents(Func command, uint32_t eventCount, const VkEvent *pEvents,
@@ -1611,27 +1781,25 @@ void CommandBuffer::RecordWriteTimestamp(Func command, VkPipelineStageFlags2KHR
 void CommandBuffer::Submit(VkQueue queue, uint32_t perf_submit_pass, const Location &loc) {
     // Update vvl::QueryPool with a query state at the end of the command buffer.
     // Ultimately, it tracks the final query state for the entire submission.
+    // The records are applied in order, so the state of each query is the last one recorded.
     {
-        VkQueryPool first_pool = VK_NULL_HANDLE;
-        QueryMap local_query_to_state_map;
-        for (auto &function : queryUpdates) {
-            function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
-        }
-        for (const auto &query_state_pair : local_query_to_state_map) {
-            auto query_pool_state = dev_data.Get<vvl::QueryPool>(query_state_pair.first.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass, query_state_pair.second);
-        }
+        std::shared_ptr<vvl::QueryPool> query_pool_state;
+        ForEachQueryStateRecord([this, perf_submit_pass, &query_pool_state](const QueryStateRecord &record) {
+            if (!query_pool_state || query_pool_state->VkHandle() != record.pool) {
+                query_pool_state = dev_data.Get<vvl::QueryPool>(record.pool);
+            }
+            if (query_pool_state) {
+                query_pool_state->SetQueryStates(record.first_query, record.query_count, perf_submit_pass, record.state);
+            }
+        });
     }
 
     // Update vvl::Event with src_stage from the last recorded SetEvent.
     // Ultimately, it tracks the last SetEvent for the entire submission.
     {
         EventMap local_event_signal_info;
-        for (const auto &function : eventUpdates) {
-            function(*this, /*do_validate*/ false, local_event_signal_info,
+        UpdateEvents(/*do_validate*/ false, local_event_signal_info,
                      VK_NULL_HANDLE /* when do_validate is false then wait handler is inactive */, loc);
-        }
         for (const auto &[event, info] : local_event_signal_info) {
             auto event_state = dev_data.Get<vvl::Event>(event);
             event_state->signaled = info.signal;
@@ -1657,17 +1825,23 @@ void CommandBuffer::Retire(uint32_t perf_submit_pass, const std::function<bool(c
             event_state->write_in_use--;
         }
     }
-    QueryMap local_query_to_state_map;
-    VkQueryPool first_pool = VK_NULL_HANDLE;
-    for (auto &function : queryUpdates) {
-        function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
-    }
+    // Ranges of the final query states of this command buffer, per pool
+    vvl::unordered_map<VkQueryPool, sparse_container::range_map<uint32_t, QueryState>> final_query_states;
+    ForEachQueryStateRecord([&final_query_states](const QueryStateRecord &record) {
+        const sparse_container::range<uint32_t> range(record.first_query, record.first_query + record.query_count);
+        final_query_states[record.pool].overwrite_range(std::make_pair(range, record.state));
+    });
 
-    for (const auto &query_state_pair : local_query_to_state_map) {
-        if (query_state_pair.second == QUERYSTATE_ENDED && !is_query_updated_after(query_state_pair.first)) {
-            auto query_pool_state = dev_data.Get<vvl::QueryPool>(query_state_pair.first.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass, QUERYSTATE_AVAILABLE);
+    for (const auto &[pool, query_states] : final_query_states) {
+        auto query_pool_state = dev_data.Get<vvl::QueryPool>(pool);
+        if (!query_pool_state) continue;
+        for (const auto &[range, state] : query_states) {
+            if (state != QUERYSTATE_ENDED) continue;
+            for (uint32_t slot = range.begin; slot < range.end; ++slot) {
+                if (!is_query_updated_after(QueryObject(pool, slot, 0, perf_submit_pass))) {
+                    query_pool_state->SetQueryState(slot, perf_submit_pass, QUERYSTATE_AVAILABLE);
+                }
+            }
         }
     }
 }
@@ -1728,7 +1902,7 @@ void CommandBuffer::UnbindResources() {
     current_vertex_buffer_binding_info.clear();
 
     // Push constants
-    push_constant_data_chunks.clear();
+    ClearPushConstants();
     push_constant_latest_used_layout.fill(VK_NULL_HANDLE);
     push_constant_ranges_layout.reset();
 
@@ -1812,19 +1986,18 @@ void CommandBuffer::GetCurrentPipelineAndDesriptorSets(VkPipelineBindPoint pipel
 
 void CommandBuffer::BeginLabel(const char *label_name) {
     ++label_stack_depth_;
-    label_commands_.emplace_back(LabelCommand{true, label_name});
+    label_commands_.emplace_back(LabelCommand{true, dev_data.label_names.GetId(label_name)});
 }
 
 void CommandBuffer::EndLabel() {
     --label_stack_depth_;
-    label_commands_.emplace_back(LabelCommand{false, std::string()});
+    label_commands_.emplace_back(LabelCommand{false, LabelNames::kNoLabel});
 }
 
-void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands,
-                                        std::vector<std::string> &label_stack) {
+void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, std::vector<uint32_t> &label_stack) {
     for (const LabelCommand &command : label_commands) {
         if (command.begin) {
-            label_stack.emplace_back(command.label_name.empty() ? "(empty label)" : command.label_name);
+            label_stack.emplace_back(command.label_id);
         } else if (!label_stack.empty()) {
             // The above condition is needed for several reasons. On the primary command buffer level
             // the labels are not necessary balanced. And if the empty stack is detected in the context
@@ -1835,8 +2008,8 @@ void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &lab
     }
 }
 
-std::string CommandBuffer::GetDebugRegionName(const std::vector<LabelCommand> &label_commands, uint32_t label_command_index,
-                                              const std::vector<std::string> &initial_label_stack) {
+std::string CommandBuffer::GetDebugRegionName(const LabelNames &label_names, const std::vector<LabelCommand> &label_commands,
+                                              uint32_t label_command_index, const std::vector<uint32_t> &initial_label_stack) {
     assert(label_command_index < label_commands.size());
 
     auto commands_to_replay = vvl::make_span(label_commands.data(), label_command_index + 1);
@@ -1844,11 +2017,12 @@ std::string CommandBuffer::GetDebugRegionName(const std::vector<LabelCommand> &l
     vvl::CommandBuffer::ReplayLabelCommands(commands_to_replay, label_stack);
 
     std::string debug_region;
-    for (const std::string &label_name : label_stack) {
+    for (const uint32_t label_id : label_stack) {
         if (!debug_region.empty()) {
             debug_region += "::";
         }
-        debug_region += label_name;
+        const std::string &label_name = label_names.GetName(label_id);
+        debug_region += label_name.empty() ? "(empty label)" : label_name;
     }
     return debug_region;
 }
@@ -20,6 +20,7 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "state_tracker/image_layout_map.h"
+#include "state_tracker/label_names.h"
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/query_state.h"
 #include "state_tracker/vertex_index_buffer_state.h"
@@ -33,6 +34,8 @@ class ValidationStateTracker;
 namespace vvl {
 class Bindable;
 class Buffer;
+class DescriptorBinding;
+class DescriptorSet;
 class Framebuffer;
 class RenderPass;
 class VideoSession;
@@ -180,6 +183,9 @@ class CommandBuffer : public RefcountedStateObject {
 
     CbState state;           // Track cmd buffer update state
     uint64_t command_count;  // Number of commands recorded. Currently only used with VK_KHR_performance_query
+    // Bumped by every recorded command that can change the outcome of action command validation (not by the action commands
+    // themselves, nor by push constant updates). Never reset, so it can't repeat within the lifetime of the command buffer.
+    uint64_t bound_state_generation = 1;
     uint64_t submitCount;    // Number of times CB has been submitted
     typedef uint64_t ImageLayoutUpdateCount;
     ImageLayoutUpdateCount image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
@@ -286,7 +292,7 @@ class CommandBuffer : public RefcountedStateObject {
         std::vector<VkColorComponentFlags> color_write_masks;        // VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT
 
         // VK_DYNAMIC_STATE_VERTEX_INPUT_EXT, key is binding number
-        vvl::unordered_map<uint32_t, VertexBindingState> vertex_bindings;
+        vvl::IndexMap<VertexBindingState> vertex_bindings;
 
         // VK_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT
         VkConservativeRasterizationModeEXT conservative_rasterization_mode;
@@ -433,6 +439,34 @@ class CommandBuffer : public RefcountedStateObject {
     // only when not using dynamic rendering
     vku::safe_VkRenderPassBeginInfo active_render_pass_begin_info;
     std::vector<SubpassInfo> active_subpasses;
+    // Bumped whenever active_attachments or active_subpasses change (for cached validation)
+    uint64_t attachments_change_count = 0;
+
+    // Descriptor bindings whose draw time validation logged nothing. A later action command using the same, unchanged, binding
+    // with the same shader requirements can skip validating it again. See CoreChecks::ValidateDrawState.
+    struct ValidatedDescriptorBinding {
+        // Keeps the set, and so the binding used as the key, alive. Otherwise a new set could get the address of a freed one
+        // and match its entries.
+        std::shared_ptr<const DescriptorSet> descriptor_set;
+        const DescriptorRequirement *requirement = nullptr;
+        Func command = Func::Empty;
+        uint64_t binding_change_count = 0;
+        // Only set for images that are sampled with samplers from other bindings of the set
+        uint64_t set_change_count = 0;
+        // Only set for bindings that can hold images
+        uint64_t image_layout_change_count = 0;
+        uint64_t attachments_change_count = 0;
+
+        bool operator==(const ValidatedDescriptorBinding &other) const {
+            // The set is compared by the caller, without taking a reference to it
+            return requirement == other.requirement && command == other.command &&
+                   binding_change_count == other.binding_change_count && set_change_count == other.set_change_count &&
+                   image_layout_change_count == other.image_layout_change_count &&
+                   attachments_change_count == other.attachments_change_count;
+        }
+    };
+    // Written during validation, which already requires the command buffer to be externally synchronized
+    mutable vvl::unordered_map<const DescriptorBinding *, ValidatedDescriptorBinding> validated_descriptor_bindings;
 
     VkSubpassContents activeSubpassContents;
     uint32_t GetActiveSubpass() const { return active_subpass_; }
@@ -502,6 +536,11 @@ class CommandBuffer : public RefcountedStateObject {
     std::vector<std::function<bool(CommandBuffer &cb_state, bool do_validate, VkQueryPool &firstPerfQueryPool,
                                    uint32_t perfQueryPass, QueryMap *localQueryToStateMap)>>
         queryUpdates;
+    // Run the event and query state changes recorded by this command buffer and the eventUpdates/queryUpdates callbacks,
+    // in recording order
+    bool UpdateEvents(bool do_validate, EventMap &local_event_signal_info, VkQueue waiting_queue, const Location &loc);
+    bool UpdateQueries(bool do_validate, VkQueryPool &first_perf_query_pool, uint32_t perf_query_pass,
+                       QueryMap *local_query_to_state_map);
     bool performance_lock_acquired = false;
     bool performance_lock_released = false;
 
@@ -512,9 +551,23 @@ class CommandBuffer : public RefcountedStateObject {
         VkPipelineLayout layout = VK_NULL_HANDLE;
         VkShaderStageFlags stage_flags = 0;
         uint32_t offset = 0;
-        std::vector<std::byte> values{};
+        uint32_t size = 0;
     };
+    // The vkCmdPushConstants calls that set the current values, in order. A call replaces the earlier ones for the same layout
+    // and stages that it covers, so updating the same range before each draw keeps a single entry.
     std::vector<PushConstantData> push_constant_data_chunks;
+    // Latest values, maxPushConstantsSize bytes once something is pushed, and one bit per 4 bytes set since the push constant
+    // ranges layout last changed (offsets and sizes are multiples of 4). The storage is kept when the command buffer is reset.
+    std::vector<std::byte> push_constant_values;
+    std::vector<uint64_t> push_constant_set_words;
+    void RecordPushConstants(VkPipelineLayout layout, VkShaderStageFlags stage_flags, uint32_t offset, uint32_t size,
+                             const void *values);
+    void ClearPushConstants();
+    // Number of bytes of [offset, offset + size) that no vkCmdPushConstants set
+    uint32_t PushConstantBytesNotSet(uint32_t offset, uint32_t size) const;
+    vvl::span<const std::byte> PushConstantValues(const PushConstantData &chunk) const {
+        return {push_constant_values.data() + chunk.offset, chunk.size};
+    }
     std::array<VkPipelineLayout, BindPoint_Count> push_constant_latest_used_layout{};
     PushConstantRangesId push_constant_ranges_layout;
 
@@ -546,6 +599,7 @@ class CommandBuffer : public RefcountedStateObject {
 
     virtual ~CommandBuffer() { Destroy(); }
 
+    void LinkChildNodes() override;
     void Destroy() override;
 
     VkCommandBuffer VkHandle() const { return handle_.Cast<VkCommandBuffer>(); }
@@ -568,6 +622,15 @@ class CommandBuffer : public RefcountedStateObject {
     }
 
     virtual void Reset(const Location &loc);
+    // The children of a command buffer being reset, gathered over the command buffers of a pool by CommandPool::Reset()
+    struct ReleasedChild {
+        small_vector<StateObject *, 4> parents;
+        uint32_t lazy_parent_count = 0;
+    };
+    using ReleasedChildren = vvl::unordered_map<std::shared_ptr<StateObject>, ReleasedChild>;
+    // Moves the children out of object_bindings without unlinking them, the caller unlinks them once for all the
+    // command buffers that released them. Must be called with the write lock held, right before Reset().
+    void ReleaseChildren(ReleasedChildren &released);
 
     void IncrementResources();
 
@@ -700,17 +763,17 @@ class CommandBuffer : public RefcountedStateObject {
     int LabelStackDepth() const { return label_stack_depth_; }
 
     struct LabelCommand {
-        bool begin = false;      // vkCmdBeginDebugUtilsLabelEXT or vkCmdEndDebugUtilsLabelEXT
-        std::string label_name;  // used when begin == true
+        bool begin = false;                      // vkCmdBeginDebugUtilsLabelEXT or vkCmdEndDebugUtilsLabelEXT
+        uint32_t label_id = LabelNames::kNoLabel;  // id in ValidationStateTracker::label_names, used when begin == true
     };
     const std::vector<LabelCommand> &GetLabelCommands() const { return label_commands_; }
 
-    // Applies label commands to the label_stack: for "begin label" command it pushes
+    // Applies label commands to the label_stack of label ids: for "begin label" command it pushes
     // a label on the stack, and for the "end label" command it removes the top label.
-    static void ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, std::vector<std::string> &label_stack);
+    static void ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, std::vector<uint32_t> &label_stack);
     // Computes debug region by replaying given commands on top initial label stack.
-    static std::string GetDebugRegionName(const std::vector<LabelCommand> &label_commands, uint32_t label_command_index,
-                                          const std::vector<std::string> &initial_label_stack = {});
+    static std::string GetDebugRegionName(const LabelNames &label_names, const std::vector<LabelCommand> &label_commands,
+                                          uint32_t label_command_index, const std::vector<uint32_t> &initial_label_stack = {});
 
   private:
     void ResetCBState();
@@ -722,6 +785,29 @@ class CommandBuffer : public RefcountedStateObject {
     // Used during sumbit time validation.
     std::vector<LabelCommand> label_commands_;
 
+    // The state changes of the query and event commands are plain records instead of queryUpdates/eventUpdates callbacks.
+    // callbacks_before is the number of callbacks recorded before the record, to keep the recording order.
+    // A record of ExecuteCommands only names the secondary, whose own records are applied in its place.
+    struct QueryStateRecord {
+        VkQueryPool pool;
+        uint32_t first_query;
+        uint32_t query_count;
+        QueryState state;
+        uint32_t callbacks_before;
+        VkCommandBuffer secondary = VK_NULL_HANDLE;
+    };
+    struct EventStateRecord {
+        VkEvent event;
+        VkPipelineStageFlags2 src_stage_mask;
+        bool signal;
+        uint32_t callbacks_before;
+    };
+    std::vector<QueryStateRecord> query_state_records_;
+    std::vector<EventStateRecord> event_state_records_;
+    // Visits the query records of this command buffer and of its executed secondaries in order, without the callbacks.
+    // Only the validation done by the callbacks is skipped, their state changes are records too.
+    void ForEachQueryStateRecord(const std::function<void(const QueryStateRecord &record)> &func);
+
     uint32_t active_subpass_;
     // Stores rasterization samples count obtained from the first pipeline with a pMultisampleState in the active subpass,
     // or std::nullopt
@@ -729,9 +815,20 @@ class CommandBuffer : public RefcountedStateObject {
 
   protected:
     void NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) override;
+    bool HasLazyChild(const std::shared_ptr<StateObject> &child_node) const override;
     void UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPassBegin);
     void EnqueueUpdateVideoInlineQueries(const VkVideoInlineQueryInfoKHR &query_info);
     void UnbindResources();
+
+  private:
+    // With the lazy_object_bindings setting, children are not linked back to the command buffer (see
+    // StateObject::AddLazyParent()). Secondary command buffers are always linked, their invalidation is not searched for.
+    bool IsLazyChild(const StateObject &child_node) const {
+        return lazy_bindings_ && child_node.Type() != kVulkanObjectTypeCommandBuffer;
+    }
+    void UnlinkChild(StateObject &child_node);
+
+    const bool lazy_bindings_;
 };
 
 // specializations for barriers that cannot do queue family ownership transfers
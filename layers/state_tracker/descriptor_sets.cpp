@@ -17,6 +17,9 @@
  */
 
 #include "state_tracker/descriptor_sets.h"
+
+#include <algorithm>
+
 #include "state_tracker/image_state.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/cmd_buffer_state.h"
@@ -24,8 +27,8 @@
 #include "state_tracker/sampler_state.h"
 #include "state_tracker/shader_module.h"
 
-static vvl::DescriptorPool::TypeCountMap GetMaxTypeCounts(const VkDescriptorPoolCreateInfo *create_info) {
-    vvl::DescriptorPool::TypeCountMap counts;
+static vvl::DescriptorTypeCounts GetMaxTypeCounts(const VkDescriptorPoolCreateInfo *create_info) {
+    vvl::DescriptorTypeCounts counts;
     // Collect maximums per descriptor type.
     for (uint32_t i = 0; i < create_info->poolSizeCount; ++i) {
         const auto &pool_size = create_info->pPoolSizes[i];
@@ -52,9 +55,8 @@ void vvl::DescriptorPool::Allocate(const VkDescriptorSetAllocateInfo *alloc_info
     auto guard = WriteLock();
     // Account for sets and individual descriptors allocated from pool
     available_sets_ -= alloc_info->descriptorSetCount;
-    for (auto it = ds_data.required_descriptors_by_type.begin(); it != ds_data.required_descriptors_by_type.end(); ++it) {
-        available_counts_[it->first] -= ds_data.required_descriptors_by_type.at(it->first);
-    }
+    ds_data.required_descriptors_by_type.ForEach(
+        [this](uint32_t type, uint32_t required_count) { available_counts_[type] -= required_count; });
 
     const auto *variable_count_info = vku::FindStructInPNextChain<VkDescriptorSetVariableDescriptorCountAllocateInfo>(alloc_info->pNext);
     const bool variable_count_valid =
@@ -321,11 +323,24 @@ vvl::DescriptorSetLayoutDef::DescriptorSetLayoutDef(const VkDescriptorSetLayoutC
     binding_count_ = static_cast<uint32_t>(sorted_bindings.size());
     bindings_.reserve(binding_count_);
     binding_flags_.reserve(binding_count_);
-    binding_to_index_map_.reserve(binding_count_);
+    // The bindings are sorted, the last one has the highest number
+    if (!sorted_bindings.empty()) {
+        const uint32_t max_binding = sorted_bindings.rbegin()->layout_binding->binding;
+        sparse_bindings_ = max_binding >= std::max(kMaxDenseBindingTableSize, 2 * binding_count_);
+        if (sparse_bindings_) {
+            binding_to_index_map_.reserve(binding_count_);
+        } else {
+            dense_binding_to_index_.resize(max_binding + 1, binding_count_);
+        }
+    }
     for (const auto &input_binding : sorted_bindings) {
         // Add to binding and map, s.t. it is robust to invalid duplication of binding_num
         const auto binding_num = input_binding.layout_binding->binding;
-        binding_to_index_map_[binding_num] = index++;
+        if (sparse_bindings_) {
+            binding_to_index_map_[binding_num] = index++;
+        } else {
+            dense_binding_to_index_[binding_num] = index++;
+        }
         bindings_.emplace_back(input_binding.layout_binding);
         auto &binding_info = bindings_.back();
         binding_flags_.emplace_back(input_binding.binding_flags);
@@ -371,8 +386,8 @@ size_t vvl::DescriptorSetLayoutDef::hash() const {
 
 // Return valid index or "end" i.e. binding_count_;
 // The asserts in "Get" are reduced to the set where no valid answer(like null or 0) could be given
-// Common code for all binding lookups.
-uint32_t vvl::DescriptorSetLayoutDef::GetIndexFromBinding(uint32_t binding) const {
+// Lookup of GetIndexFromBinding() for the layouts without a dense table.
+uint32_t vvl::DescriptorSetLayoutDef::GetIndexFromSparseBinding(uint32_t binding) const {
     const auto &bi_itr = binding_to_index_map_.find(binding);
     if (bi_itr != binding_to_index_map_.cend()) return bi_itr->second;
     return GetBindingCount();
@@ -587,6 +602,7 @@ void vvl::DescriptorSet::NotifyInvalidate(const NodeList &invalid_nodes, bool un
     BaseClass::NotifyInvalidate(invalid_nodes, unlink);
     for (auto &binding : bindings_) {
         binding->NotifyInvalidate(invalid_nodes, unlink);
+        ++binding->change_count;
     }
 }
 
@@ -606,8 +622,10 @@ uint32_t vvl::DescriptorSet::GetDynamicOffsetIndexFromBinding(uint32_t dynamic_b
 }
 
 void vvl::DescriptorSet::Destroy() {
-    for (auto &binding : bindings_) {
-        binding->RemoveParent(this);
+    if (!InTeardown()) {
+        for (auto &binding : bindings_) {
+            binding->RemoveParent(this);
+        }
     }
     StateObject::Destroy();
 }
@@ -632,14 +650,16 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
     auto iter = FindDescriptor(update.dstBinding, update.dstArrayElement);
     ASSERT_AND_RETURN(!iter.AtEnd());
     auto &orig_binding = iter.CurrentBinding();
+    DescriptorWriteResolver resolver(*state_data_);
 
     // Verify next consecutive binding matches type, stage flags & immutable sampler use and if AtEnd
     for (uint32_t i = 0; i < descriptors_remaining; ++i, ++iter) {
         if (iter.AtEnd() || !orig_binding.IsConsistent(iter.CurrentBinding())) {
             break;
         }
-        iter->WriteUpdate(*this, *state_data_, update, i, IsBindless(iter.CurrentBinding().binding_flags));
+        iter->WriteUpdate(*this, resolver, update, i, IsBindless(iter.CurrentBinding().binding_flags));
         iter.updated(true);
+        ++iter.CurrentBinding().change_count;
     }
     if (update.descriptorCount) {
         some_update_ = true;
@@ -672,6 +692,7 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
         } else {
             dst_iter.updated(false);
         }
+        ++dst_iter.CurrentBinding().change_count;
     }
 
     if (!(layout_->GetDescriptorBindingFlagsFromBinding(update.dstBinding) &
@@ -737,6 +758,14 @@ void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vv
 // src and dst are shared pointers.
 template <typename T>
 static void ReplaceStatePtr(DescriptorSet &set_state, T &dst, const T &src, bool is_bindless) {
+    // Rewriting a descriptor with the object it already has is common, skip the removal and the reference count changes. The
+    // parent is still added, another descriptor of the set may have removed it when it stopped using the same object.
+    if (dst == src) {
+        if (dst && !is_bindless) {
+            dst->AddParent(&set_state);
+        }
+        return;
+    }
     if (dst && !is_bindless) {
         dst->RemoveParent(&set_state);
     }
@@ -748,10 +777,30 @@ static void ReplaceStatePtr(DescriptorSet &set_state, T &dst, const T &src, bool
     }
 }
 
-void vvl::SamplerDescriptor::WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data,
+template <typename State, typename Handle>
+const std::shared_ptr<State> &vvl::DescriptorWriteResolver::Resolve(LastState<Handle, State> &last, Handle handle) {
+    if (handle != last.handle) {
+        last.handle = handle;
+        last.state = dev_data.GetConstCastShared<State>(handle);
+    }
+    return last.state;
+}
+
+const std::shared_ptr<vvl::Sampler> &vvl::DescriptorWriteResolver::GetSampler(VkSampler sampler) {
+    return Resolve(sampler_, sampler);
+}
+const std::shared_ptr<vvl::ImageView> &vvl::DescriptorWriteResolver::GetImageView(VkImageView image_view) {
+    return Resolve(image_view_, image_view);
+}
+const std::shared_ptr<vvl::Buffer> &vvl::DescriptorWriteResolver::GetBuffer(VkBuffer buffer) { return Resolve(buffer_, buffer); }
+const std::shared_ptr<vvl::BufferView> &vvl::DescriptorWriteResolver::GetBufferView(VkBufferView buffer_view) {
+    return Resolve(buffer_view_, buffer_view);
+}
+
+void vvl::SamplerDescriptor::WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver,
                                                      const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
     if (!immutable_) {
-        ReplaceStatePtr(set_state, sampler_state_, dev_data.GetConstCastShared<vvl::Sampler>(update.pImageInfo[index].sampler),
+        ReplaceStatePtr(set_state, sampler_state_, resolver.GetSampler(update.pImageInfo[index].sampler),
                         is_bindless);
     }
 }
@@ -793,15 +842,15 @@ void vvl::SamplerDescriptor::RemoveParent(StateObject *state_object) {
 }
 bool vvl::SamplerDescriptor::Invalid() const { return !sampler_state_ || sampler_state_->Invalid(); }
 
-void vvl::ImageSamplerDescriptor::WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data,
+void vvl::ImageSamplerDescriptor::WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver,
                                                           const VkWriteDescriptorSet &update, const uint32_t index,
                                                           bool is_bindless) {
     const auto &image_info = update.pImageInfo[index];
     if (!immutable_) {
-        ReplaceStatePtr(set_state, sampler_state_, dev_data.GetConstCastShared<vvl::Sampler>(image_info.sampler), is_bindless);
+        ReplaceStatePtr(set_state, sampler_state_, resolver.GetSampler(image_info.sampler), is_bindless);
     }
     image_layout_ = image_info.imageLayout;
-    ReplaceStatePtr(set_state, image_view_state_, dev_data.GetConstCastShared<vvl::ImageView>(image_info.imageView), is_bindless);
+    ReplaceStatePtr(set_state, image_view_state_, resolver.GetImageView(image_info.imageView), is_bindless);
     UpdateKnownValidView(is_bindless);
 }
 
@@ -848,11 +897,11 @@ bool vvl::ImageSamplerDescriptor::Invalid() const {
     return ImageDescriptor::Invalid() || !sampler_state_ || sampler_state_->Invalid();
 }
 
-void vvl::ImageDescriptor::WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data,
+void vvl::ImageDescriptor::WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver,
                                                    const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
     const auto &image_info = update.pImageInfo[index];
     image_layout_ = image_info.imageLayout;
-    ReplaceStatePtr(set_state, image_view_state_, dev_data.GetConstCastShared<vvl::ImageView>(image_info.imageView), is_bindless);
+    ReplaceStatePtr(set_state, image_view_state_, resolver.GetImageView(image_info.imageView), is_bindless);
     UpdateKnownValidView(is_bindless);
 }
 
@@ -910,12 +959,12 @@ bool vvl::ImageDescriptor::Invalid() const { return !known_valid_view_ && Comput
 bool vvl::ImageDescriptor::ComputeInvalid() const { return !image_view_state_ || image_view_state_->Invalid(); }
 void vvl::ImageDescriptor::UpdateKnownValidView(bool is_bindless) { known_valid_view_ = !is_bindless && !ComputeInvalid(); }
 
-void vvl::BufferDescriptor::WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data,
+void vvl::BufferDescriptor::WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver,
                                                     const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
     const auto &buffer_info = update.pBufferInfo[index];
     offset_ = buffer_info.offset;
     range_ = buffer_info.range;
-    auto buffer_state = dev_data.GetConstCastShared<vvl::Buffer>(buffer_info.buffer);
+    const auto &buffer_state = resolver.GetBuffer(buffer_info.buffer);
     ReplaceStatePtr(set_state, buffer_state_, buffer_state, is_bindless);
 }
 
@@ -961,9 +1010,9 @@ VkDeviceSize vvl::BufferDescriptor::GetEffectiveRange() const {
     }
 }
 
-void vvl::TexelDescriptor::WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data,
+void vvl::TexelDescriptor::WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver,
                                                    const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
-    auto buffer_view = dev_data.GetConstCastShared<vvl::BufferView>(update.pTexelBufferView[index]);
+    const auto &buffer_view = resolver.GetBufferView(update.pTexelBufferView[index]);
     ReplaceStatePtr(set_state, buffer_view_state_, buffer_view, is_bindless);
 }
 
@@ -996,7 +1045,7 @@ void vvl::TexelDescriptor::RemoveParent(StateObject *state_object) {
 
 bool vvl::TexelDescriptor::Invalid() const { return !buffer_view_state_ || buffer_view_state_->Invalid(); }
 
-void vvl::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data,
+void vvl::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver,
                                                                    const VkWriteDescriptorSet &update, const uint32_t index,
                                                                    bool is_bindless) {
     const auto *acc_info = vku::FindStructInPNextChain<VkWriteDescriptorSetAccelerationStructureKHR>(update.pNext);
@@ -1005,10 +1054,12 @@ void vvl::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet &set_state,
     is_khr_ = (acc_info != NULL);
     if (is_khr_) {
         acc_ = acc_info->pAccelerationStructures[index];
-        ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_), is_bindless);
+        ReplaceStatePtr(set_state, acc_state_, resolver.dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_),
+                        is_bindless);
     } else {
         acc_nv_ = acc_info_nv->pAccelerationStructures[index];
-        ReplaceStatePtr(set_state, acc_state_nv_, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_), is_bindless);
+        ReplaceStatePtr(set_state, acc_state_nv_, resolver.dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
+                        is_bindless);
     }
 }
 
@@ -1065,43 +1116,69 @@ bool vvl::AccelerationStructureDescriptor::Invalid() const {
     }
 }
 
-vvl::MutableDescriptor::MutableDescriptor()
-    : Descriptor(),
-      buffer_size_(0),
-      active_descriptor_type_(VK_DESCRIPTOR_TYPE_MUTABLE_EXT),
-      immutable_(false),
-      image_layout_(VK_IMAGE_LAYOUT_UNDEFINED),
-      offset_(0),
-      range_(0),
-      is_khr_(false),
-      acc_(VK_NULL_HANDLE) {}
+vvl::MutableDescriptor::MutableDescriptor() : Descriptor() {}
+
+void vvl::MutableDescriptor::ReplaceResourceState(DescriptorSet &set_state, std::shared_ptr<StateObject> &&state,
+                                                  ResourceKind kind, bool is_bindless) {
+    ReplaceStatePtr(set_state, resource_state_, state, is_bindless);
+    resource_kind_ = resource_state_ ? kind : ResourceKind::None;
+}
+
+vvl::Buffer *vvl::MutableDescriptor::BufferState() const {
+    return resource_kind_ == ResourceKind::Buffer ? static_cast<vvl::Buffer *>(resource_state_.get()) : nullptr;
+}
+vvl::BufferView *vvl::MutableDescriptor::BufferViewState() const {
+    return resource_kind_ == ResourceKind::BufferView ? static_cast<vvl::BufferView *>(resource_state_.get()) : nullptr;
+}
+std::shared_ptr<vvl::Buffer> vvl::MutableDescriptor::GetSharedBufferState() const {
+    return resource_kind_ == ResourceKind::Buffer ? std::static_pointer_cast<vvl::Buffer>(resource_state_) : nullptr;
+}
+std::shared_ptr<vvl::BufferView> vvl::MutableDescriptor::GetSharedBufferViewState() const {
+    return resource_kind_ == ResourceKind::BufferView ? std::static_pointer_cast<vvl::BufferView>(resource_state_) : nullptr;
+}
+const vvl::AccelerationStructureKHR *vvl::MutableDescriptor::GetAccelerationStructureStateKHR() const {
+    return resource_kind_ == ResourceKind::AccelerationStructureKHR
+               ? static_cast<const vvl::AccelerationStructureKHR *>(resource_state_.get())
+               : nullptr;
+}
+vvl::AccelerationStructureKHR *vvl::MutableDescriptor::GetAccelerationStructureStateKHR() {
+    return resource_kind_ == ResourceKind::AccelerationStructureKHR
+               ? static_cast<vvl::AccelerationStructureKHR *>(resource_state_.get())
+               : nullptr;
+}
+const vvl::AccelerationStructureNV *vvl::MutableDescriptor::GetAccelerationStructureStateNV() const {
+    return resource_kind_ == ResourceKind::AccelerationStructureNV
+               ? static_cast<const vvl::AccelerationStructureNV *>(resource_state_.get())
+               : nullptr;
+}
+vvl::AccelerationStructureNV *vvl::MutableDescriptor::GetAccelerationStructureStateNV() {
+    return resource_kind_ == ResourceKind::AccelerationStructureNV
+               ? static_cast<vvl::AccelerationStructureNV *>(resource_state_.get())
+               : nullptr;
+}
 
-void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data,
+void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver,
                                                      const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
     VkDeviceSize buffer_size = 0;
     switch (DescriptorTypeToClass(update.descriptorType)) {
         case DescriptorClass::PlainSampler:
             if (!immutable_) {
-                ReplaceStatePtr(set_state, sampler_state_,
-                                dev_data.GetConstCastShared<vvl::Sampler>(update.pImageInfo[index].sampler), is_bindless);
+                ReplaceStatePtr(set_state, sampler_state_, resolver.GetSampler(update.pImageInfo[index].sampler), is_bindless);
             }
             break;
         case DescriptorClass::ImageSampler: {
             const auto &image_info = update.pImageInfo[index];
             if (!immutable_) {
-                ReplaceStatePtr(set_state, sampler_state_, dev_data.GetConstCastShared<vvl::Sampler>(image_info.sampler),
-                                is_bindless);
+                ReplaceStatePtr(set_state, sampler_state_, resolver.GetSampler(image_info.sampler), is_bindless);
             }
             image_layout_ = image_info.imageLayout;
-            ReplaceStatePtr(set_state, image_view_state_, dev_data.GetConstCastShared<vvl::ImageView>(image_info.imageView),
-                            is_bindless);
+            ReplaceStatePtr(set_state, image_view_state_, resolver.GetImageView(image_info.imageView), is_bindless);
             break;
         }
         case DescriptorClass::Image: {
             const auto &image_info = update.pImageInfo[index];
             image_layout_ = image_info.imageLayout;
-            ReplaceStatePtr(set_state, image_view_state_, dev_data.GetConstCastShared<vvl::ImageView>(image_info.imageView),
-                            is_bindless);
+            ReplaceStatePtr(set_state, image_view_state_, resolver.GetImageView(image_info.imageView), is_bindless);
             break;
         }
         case DescriptorClass::GeneralBuffer: {
@@ -1109,20 +1186,20 @@ void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, const Validat
             offset_ = buffer_info.offset;
             range_ = buffer_info.range;
             // can be null if using nullDescriptors
-            const auto buffer_state = dev_data.GetConstCastShared<vvl::Buffer>(update.pBufferInfo->buffer);
+            const auto &buffer_state = resolver.GetBuffer(update.pBufferInfo->buffer);
             if (buffer_state) {
                 buffer_size = buffer_state->create_info.size;
             }
-            ReplaceStatePtr(set_state, buffer_state_, buffer_state, is_bindless);
+            ReplaceResourceState(set_state, buffer_state, ResourceKind::Buffer, is_bindless);
             break;
         }
         case DescriptorClass::TexelBuffer: {
             // can be null if using nullDescriptors
-            const auto buffer_view = dev_data.GetConstCastShared<vvl::BufferView>(update.pTexelBufferView[index]);
+            const auto &buffer_view = resolver.GetBufferView(update.pTexelBufferView[index]);
             if (buffer_view) {
                 buffer_size = buffer_view->buffer_state->create_info.size;
             }
-            ReplaceStatePtr(set_state, buffer_view_state_, buffer_view, is_bindless);
+            ReplaceResourceState(set_state, buffer_view, ResourceKind::BufferView, is_bindless);
             break;
         }
         case DescriptorClass::AccelerationStructure: {
@@ -1132,12 +1209,12 @@ void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, const Validat
             is_khr_ = (acc_info != NULL);
             if (is_khr_) {
                 acc_ = acc_info->pAccelerationStructures[index];
-                ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_),
-                                is_bindless);
+                ReplaceResourceState(set_state, resolver.dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_),
+                                     ResourceKind::AccelerationStructureKHR, is_bindless);
             } else {
                 acc_nv_ = acc_info_nv->pAccelerationStructures[index];
-                ReplaceStatePtr(set_state, acc_state_nv_, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
-                                is_bindless);
+                ReplaceResourceState(set_state, resolver.dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
+                                     ResourceKind::AccelerationStructureNV, is_bindless);
             }
             break;
         }
@@ -1169,24 +1246,26 @@ void vvl::MutableDescriptor::CopyUpdate(DescriptorSet &set_state, const Validati
         image_layout_ = image_src.GetImageLayout();
         ReplaceStatePtr(set_state, image_view_state_, image_src.GetSharedImageViewState(), is_bindless);
     } else if (src.GetClass() == DescriptorClass::TexelBuffer) {
-        ReplaceStatePtr(set_state, buffer_view_state_, static_cast<const TexelDescriptor &>(src).GetSharedBufferViewState(),
-                        is_bindless);
-        src_size = buffer_view_state_ ? buffer_view_state_->Size() : vvl::kU32Max;
+        ReplaceResourceState(set_state, static_cast<const TexelDescriptor &>(src).GetSharedBufferViewState(),
+                             ResourceKind::BufferView, is_bindless);
+        const vvl::BufferView *buffer_view_state = BufferViewState();
+        src_size = buffer_view_state ? buffer_view_state->Size() : vvl::kU32Max;
     } else if (src.GetClass() == DescriptorClass::GeneralBuffer) {
-        const auto buff_desc = static_cast<const BufferDescriptor &>(src);
+        const auto &buff_desc = static_cast<const BufferDescriptor &>(src);
         offset_ = buff_desc.GetOffset();
         range_ = buff_desc.GetRange();
-        ReplaceStatePtr(set_state, buffer_state_, buff_desc.GetSharedBufferState(), is_bindless);
+        ReplaceResourceState(set_state, buff_desc.GetSharedBufferState(), ResourceKind::Buffer, is_bindless);
         src_size = range_;
     } else if (src.GetClass() == DescriptorClass::AccelerationStructure) {
         auto &acc_desc = static_cast<const AccelerationStructureDescriptor &>(src);
         if (is_khr_) {
             acc_ = acc_desc.GetAccelerationStructure();
-            ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_), is_bindless);
+            ReplaceResourceState(set_state, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_),
+                                 ResourceKind::AccelerationStructureKHR, is_bindless);
         } else {
             acc_nv_ = acc_desc.GetAccelerationStructureNV();
-            ReplaceStatePtr(set_state, acc_state_nv_, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
-                            is_bindless);
+            ReplaceResourceState(set_state, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
+                                 ResourceKind::AccelerationStructureNV, is_bindless);
         }
     } else if (src.GetClass() == DescriptorClass::Mutable) {
         const auto &mutable_src = static_cast<const MutableDescriptor &>(src);
@@ -1212,20 +1291,20 @@ void vvl::MutableDescriptor::CopyUpdate(DescriptorSet &set_state, const Validati
             case DescriptorClass::GeneralBuffer: {
                 offset_ = mutable_src.GetOffset();
                 range_ = mutable_src.GetRange();
-                ReplaceStatePtr(set_state, buffer_state_, mutable_src.GetSharedBufferState(), is_bindless);
+                ReplaceResourceState(set_state, mutable_src.GetSharedBufferState(), ResourceKind::Buffer, is_bindless);
             } break;
             case DescriptorClass::TexelBuffer: {
-                ReplaceStatePtr(set_state, buffer_view_state_, mutable_src.GetSharedBufferViewState(), is_bindless);
+                ReplaceResourceState(set_state, mutable_src.GetSharedBufferViewState(), ResourceKind::BufferView, is_bindless);
             } break;
             case DescriptorClass::AccelerationStructure: {
                 if (mutable_src.is_khr()) {
                     acc_ = mutable_src.GetAccelerationStructureKHR();
-                    ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_),
-                                    is_bindless);
+                    ReplaceResourceState(set_state, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_),
+                                         ResourceKind::AccelerationStructureKHR, is_bindless);
                 } else {
                     acc_nv_ = mutable_src.GetAccelerationStructureNV();
-                    ReplaceStatePtr(set_state, acc_state_nv_, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
-                                    is_bindless);
+                    ReplaceResourceState(set_state, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
+                                         ResourceKind::AccelerationStructureNV, is_bindless);
                 }
 
             } break;
@@ -1269,10 +1348,11 @@ void vvl::MutableDescriptor::SetDescriptorType(VkDescriptorType src_type, const
 
 VkDeviceSize vvl::MutableDescriptor::GetEffectiveRange() const {
     // The buffer can be null if using nullDescriptors, if that is the case, the size/range will not be accessed
-    if (range_ == VK_WHOLE_SIZE && buffer_state_) {
+    const vvl::Buffer *buffer_state = BufferState();
+    if (range_ == VK_WHOLE_SIZE && buffer_state) {
         // When range is VK_WHOLE_SIZE the effective range is calculated at vkUpdateDescriptorSets is by taking the size of buffer
         // minus the offset.
-        return buffer_state_->create_info.size - offset_;
+        return buffer_state->create_info.size - offset_;
     } else {
         return range_;
     }
@@ -1304,27 +1384,16 @@ bool vvl::MutableDescriptor::AddParent(StateObject *state_object) {
                 result = image_view_state_->AddParent(state_object);
             }
             break;
-        case DescriptorClass::TexelBuffer:
-            if (buffer_view_state_) {
-                result = buffer_view_state_->AddParent(state_object);
-            }
-            break;
         case DescriptorClass::Image:
             if (image_view_state_) {
                 result = image_view_state_->AddParent(state_object);
             }
             break;
+        case DescriptorClass::TexelBuffer:
         case DescriptorClass::GeneralBuffer:
-            if (buffer_state_) {
-                result = buffer_state_->AddParent(state_object);
-            }
-            break;
         case DescriptorClass::AccelerationStructure:
-            if (acc_state_) {
-                result |= acc_state_->AddParent(state_object);
-            }
-            if (acc_state_nv_) {
-                result |= acc_state_nv_->AddParent(state_object);
+            if (resource_state_) {
+                result = resource_state_->AddParent(state_object);
             }
             break;
         default:
@@ -1339,17 +1408,8 @@ void vvl::MutableDescriptor::RemoveParent(StateObject *state_object) {
     if (image_view_state_) {
         image_view_state_->RemoveParent(state_object);
     }
-    if (buffer_view_state_) {
-        buffer_view_state_->RemoveParent(state_object);
-    }
-    if (buffer_state_) {
-        buffer_state_->RemoveParent(state_object);
-    }
-    if (acc_state_) {
-        acc_state_->RemoveParent(state_object);
-    }
-    if (acc_state_nv_) {
-        acc_state_nv_->RemoveParent(state_object);
+    if (resource_state_) {
+        resource_state_->RemoveParent(state_object);
     }
 }
 
@@ -1362,19 +1422,19 @@ bool vvl::MutableDescriptor::Invalid() const {
             return !sampler_state_ || sampler_state_->Invalid() || !image_view_state_ || image_view_state_->Invalid();
 
         case DescriptorClass::TexelBuffer:
-            return !buffer_view_state_ || buffer_view_state_->Invalid();
+            return !BufferViewState() || resource_state_->Invalid();
 
         case DescriptorClass::Image:
             return !image_view_state_ || image_view_state_->Invalid();
 
         case DescriptorClass::GeneralBuffer:
-            return !buffer_state_ || buffer_state_->Invalid();
+            return !BufferState() || resource_state_->Invalid();
 
         case DescriptorClass::AccelerationStructure:
             if (is_khr_) {
-                return !acc_state_ || acc_state_->Invalid();
+                return !GetAccelerationStructureStateKHR() || resource_state_->Invalid();
             } else {
-                return !acc_state_nv_ || acc_state_nv_->Invalid();
+                return !GetAccelerationStructureStateNV() || resource_state_->Invalid();
             }
         default:
             return false;
@@ -19,12 +19,14 @@
 #pragma once
 
 #include "state_tracker/state_object.h"
+#include "containers/custom_containers.h"
 #include "utils/hash_util.h"
 #include "utils/vk_layer_utils.h"
 #include "state_tracker/shader_stage_state.h"
 #include "generated/vk_object_types.h"
 #include "generated/error_location_helper.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <array>
 #include <map>
 #include <set>
 #include <vector>
@@ -53,6 +55,59 @@ static inline bool IsBindless(VkDescriptorBindingFlags flags) {
     return (flags & (VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT)) != 0;
 }
 
+// Number of descriptors per descriptor type. The core types index a fixed array, the few extension types a pool can use are
+// kept in a small side table, so counting never has to hash.
+class DescriptorTypeCounts {
+  public:
+    // Also marks the type as present
+    uint32_t &operator[](uint32_t type) {
+        if (type < kCoreTypeCount) {
+            core_present_ |= 1u << type;
+            return core_counts_[type];
+        }
+        for (auto &entry : extension_counts_) {
+            if (entry.first == type) {
+                return entry.second;
+            }
+        }
+        extension_counts_.emplace_back(type, 0);
+        return extension_counts_.back().second;
+    }
+
+    const uint32_t *Find(uint32_t type) const {
+        if (type < kCoreTypeCount) {
+            return (core_present_ & (1u << type)) != 0 ? &core_counts_[type] : nullptr;
+        }
+        for (const auto &entry : extension_counts_) {
+            if (entry.first == type) {
+                return &entry.second;
+            }
+        }
+        return nullptr;
+    }
+
+    // Calls fn(type, count) for every present type
+    template <typename Fn>
+    void ForEach(Fn &&fn) const {
+        for (uint32_t type = 0; type < kCoreTypeCount; ++type) {
+            if ((core_present_ & (1u << type)) != 0) {
+                fn(type, core_counts_[type]);
+            }
+        }
+        for (const auto &entry : extension_counts_) {
+            fn(entry.first, entry.second);
+        }
+    }
+
+  private:
+    static constexpr uint32_t kCoreTypeCount = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT + 1;
+    static_assert(kCoreTypeCount <= 32, "core_present_ needs a bit per core descriptor type");
+
+    std::array<uint32_t, kCoreTypeCount> core_counts_{};
+    uint32_t core_present_ = 0;
+    small_vector<std::pair<uint32_t, uint32_t>, 2> extension_counts_;
+};
+
 class DescriptorPool : public StateObject {
   public:
     DescriptorPool(ValidationStateTracker &dev, const VkDescriptorPool handle, const VkDescriptorPoolCreateInfo *pCreateInfo);
@@ -69,15 +124,15 @@ class DescriptorPool : public StateObject {
     const VulkanTypedHandle *InUse() const override;
     uint32_t GetAvailableCount(uint32_t type) const {
         auto guard = ReadLock();
-        auto iter = available_counts_.find(type);
-        return iter != available_counts_.end() ? iter->second : 0;
+        const uint32_t *count = available_counts_.Find(type);
+        return count ? *count : 0;
     }
 
     // The type map is only created once so can guarantee this will find if type was used
     // Unlike GetAvailableCount, this won't give a false positive that it just ran out of an available count
     bool IsAvailableType(uint32_t type) const {
         auto guard = ReadLock();
-        return available_counts_.find(type) != available_counts_.end();
+        return available_counts_.Find(type) != nullptr;
     }
 
     uint32_t GetAvailableSets() const {
@@ -89,14 +144,13 @@ class DescriptorPool : public StateObject {
     const VkDescriptorPoolCreateInfo &create_info;
 
     const uint32_t maxSets;  // Max descriptor sets allowed in this pool
-    using TypeCountMap = vvl::unordered_map<uint32_t, uint32_t>;
-    const TypeCountMap maxDescriptorTypeCount;  // Max # of descriptors of each type in this pool
+    const DescriptorTypeCounts maxDescriptorTypeCount;  // Max # of descriptors of each type in this pool
 
   protected:
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
     uint32_t available_sets_;        // Available descriptor sets in this pool
-    TypeCountMap available_counts_;  // Available # of descriptors of each type in this pool
+    DescriptorTypeCounts available_counts_;  // Available # of descriptors of each type in this pool
     vvl::unordered_map<VkDescriptorSet, vvl::DescriptorSet *> sets_;  // Collection of all sets in this pool
     ValidationStateTracker &dev_data_;
     mutable std::shared_mutex lock_;
@@ -172,9 +226,14 @@ class DescriptorSetLayoutDef {
     // For a given binding, return the number of descriptors in that binding and all successive bindings
     uint32_t GetBindingCount() const { return binding_count_; };
     // Return true if given binding is present in this layout
-    bool HasBinding(const uint32_t binding) const { return binding_to_index_map_.count(binding) > 0; };
+    bool HasBinding(const uint32_t binding) const { return GetIndexFromBinding(binding) < binding_count_; };
     // Return true if binding 1 beyond given exists and has same type, stageFlags & immutable sampler use
-    uint32_t GetIndexFromBinding(uint32_t binding) const;
+    uint32_t GetIndexFromBinding(uint32_t binding) const {
+        if (!sparse_bindings_) {
+            return binding < dense_binding_to_index_.size() ? dense_binding_to_index_[binding] : binding_count_;
+        }
+        return GetIndexFromSparseBinding(binding);
+    }
     // Various Get functions that can either be passed a binding#, which will
     //  be automatically translated into the appropriate index, or the index# can be passed in directly
     uint32_t GetMaxBinding() const {
@@ -234,6 +293,12 @@ class DescriptorSetLayoutDef {
 
     // Convenience data structures for rapid lookup of various descriptor set layout properties
     std::set<uint32_t> non_empty_bindings_;  // Containing non-emtpy bindings in numerical order
+    // Binding numbers are usually small and dense, then the index of a binding is found in a table indexed by binding number, with
+    // binding_count_ for the holes. Layouts with far apart binding numbers use the map instead.
+    static constexpr uint32_t kMaxDenseBindingTableSize = 64;
+    uint32_t GetIndexFromSparseBinding(uint32_t binding) const;
+    bool sparse_bindings_ = false;
+    std::vector<uint32_t> dense_binding_to_index_;
     vvl::unordered_map<uint32_t, uint32_t> binding_to_index_map_;
     // The following map allows an non-iterative lookup of a binding from a global index...
     std::vector<IndexRange> global_index_range_;  // range is exclusive of .end
@@ -382,6 +447,36 @@ DescriptorClass DescriptorTypeToClass(VkDescriptorType type);
 
 class DescriptorSet;
 
+// Resolves the handles of one descriptor write to their state objects. The descriptors of a write often repeat a handle (one
+// sampler for a whole array, the same buffer at several offsets), the last state of each type is kept so that a run of equal
+// handles costs a single state map lookup.
+class DescriptorWriteResolver {
+  public:
+    explicit DescriptorWriteResolver(const ValidationStateTracker &dev_data_) : dev_data(dev_data_) {}
+
+    const std::shared_ptr<Sampler> &GetSampler(VkSampler sampler);
+    const std::shared_ptr<ImageView> &GetImageView(VkImageView image_view);
+    const std::shared_ptr<Buffer> &GetBuffer(VkBuffer buffer);
+    const std::shared_ptr<BufferView> &GetBufferView(VkBufferView buffer_view);
+
+    const ValidationStateTracker &dev_data;
+
+  private:
+    template <typename Handle, typename State>
+    struct LastState {
+        // VK_NULL_HANDLE never has a state, so the empty slot is a valid entry
+        Handle handle = VK_NULL_HANDLE;
+        std::shared_ptr<State> state;
+    };
+    template <typename State, typename Handle>
+    const std::shared_ptr<State> &Resolve(LastState<Handle, State> &last, Handle handle);
+
+    LastState<VkSampler, Sampler> sampler_;
+    LastState<VkImageView, ImageView> image_view_;
+    LastState<VkBuffer, Buffer> buffer_;
+    LastState<VkBufferView, BufferView> buffer_view_;
+};
+
 class Descriptor {
   public:
     static bool SupportsNotifyInvalidate() { return false; }
@@ -390,7 +485,7 @@ class Descriptor {
 
     Descriptor() {}
     virtual ~Descriptor() {}
-    virtual void WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const VkWriteDescriptorSet &,
+    virtual void WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver, const VkWriteDescriptorSet &,
                              const uint32_t, bool is_bindless) = 0;
     virtual void CopyUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const Descriptor &, bool is_bindless,
                             VkDescriptorType type) = 0;
@@ -418,7 +513,7 @@ class SamplerDescriptor : public Descriptor {
   public:
     SamplerDescriptor() = default;
     DescriptorClass GetClass() const override { return DescriptorClass::PlainSampler; }
-    void WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const VkWriteDescriptorSet &, const uint32_t,
+    void WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver, const VkWriteDescriptorSet &, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const Descriptor &, bool is_bindless,
                     VkDescriptorType type) override;
@@ -447,7 +542,7 @@ class ImageDescriptor : public Descriptor {
     }
     ImageDescriptor() = default;
     DescriptorClass GetClass() const override { return DescriptorClass::Image; }
-    void WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const VkWriteDescriptorSet &, const uint32_t,
+    void WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver, const VkWriteDescriptorSet &, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const Descriptor &, bool is_bindless,
                     VkDescriptorType type) override;
@@ -476,7 +571,7 @@ class ImageSamplerDescriptor : public ImageDescriptor {
   public:
     ImageSamplerDescriptor() = default;
     DescriptorClass GetClass() const override { return DescriptorClass::ImageSampler; }
-    void WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const VkWriteDescriptorSet &, const uint32_t,
+    void WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver, const VkWriteDescriptorSet &, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const Descriptor &, bool is_bindless,
                     VkDescriptorType type) override;
@@ -500,7 +595,7 @@ class TexelDescriptor : public Descriptor {
   public:
     TexelDescriptor() = default;
     DescriptorClass GetClass() const override { return DescriptorClass::TexelBuffer; }
-    void WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const VkWriteDescriptorSet &, const uint32_t,
+    void WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver, const VkWriteDescriptorSet &, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const Descriptor &, bool is_bindless,
                     VkDescriptorType type) override;
@@ -521,7 +616,7 @@ class BufferDescriptor : public Descriptor {
   public:
     BufferDescriptor() = default;
     DescriptorClass GetClass() const override { return DescriptorClass::GeneralBuffer; }
-    void WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const VkWriteDescriptorSet &, const uint32_t,
+    void WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver, const VkWriteDescriptorSet &, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const Descriptor &, bool is_bindless,
                     VkDescriptorType type) override;
@@ -547,7 +642,7 @@ class InlineUniformDescriptor : public Descriptor {
   public:
     InlineUniformDescriptor() = default;
     DescriptorClass GetClass() const override { return DescriptorClass::InlineUniform; }
-    void WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const VkWriteDescriptorSet &, const uint32_t,
+    void WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver, const VkWriteDescriptorSet &, const uint32_t,
                      bool is_bindless) override {}
     void CopyUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const Descriptor &, bool is_bindless,
                     VkDescriptorType type) override {}
@@ -557,7 +652,7 @@ class AccelerationStructureDescriptor : public Descriptor {
   public:
     AccelerationStructureDescriptor() = default;
     DescriptorClass GetClass() const override { return DescriptorClass::AccelerationStructure; }
-    void WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const VkWriteDescriptorSet &, const uint32_t,
+    void WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver, const VkWriteDescriptorSet &, const uint32_t,
                      bool is_bindless) override;
     VkAccelerationStructureKHR GetAccelerationStructure() const { return acc_; }
     const vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR() const { return acc_state_.get(); }
@@ -585,7 +680,7 @@ class MutableDescriptor : public Descriptor {
   public:
     MutableDescriptor();
     DescriptorClass GetClass() const override { return DescriptorClass::Mutable; }
-    void WriteUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const VkWriteDescriptorSet &, const uint32_t,
+    void WriteUpdate(DescriptorSet &set_state, DescriptorWriteResolver &resolver, const VkWriteDescriptorSet &, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const Descriptor &, bool is_bindless,
                     VkDescriptorType type) override;
@@ -597,17 +692,17 @@ class MutableDescriptor : public Descriptor {
     std::shared_ptr<vvl::Sampler> GetSharedSamplerState() const { return sampler_state_; }
     std::shared_ptr<vvl::ImageView> GetSharedImageViewState() const { return image_view_state_; }
     VkImageLayout GetImageLayout() const { return image_layout_; }
-    std::shared_ptr<vvl::Buffer> GetSharedBufferState() const { return buffer_state_; }
+    std::shared_ptr<vvl::Buffer> GetSharedBufferState() const;
     VkDeviceSize GetOffset() const { return offset_; }
     VkDeviceSize GetRange() const { return range_; }
     VkDeviceSize GetEffectiveRange() const;
-    std::shared_ptr<vvl::BufferView> GetSharedBufferViewState() const { return buffer_view_state_; }
+    std::shared_ptr<vvl::BufferView> GetSharedBufferViewState() const;
     VkAccelerationStructureKHR GetAccelerationStructureKHR() const { return acc_; }
-    const vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR() const { return acc_state_.get(); }
-    vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR() { return acc_state_.get(); }
+    const vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR() const;
+    vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR();
     VkAccelerationStructureNV GetAccelerationStructureNV() const { return acc_nv_; }
-    const vvl::AccelerationStructureNV *GetAccelerationStructureStateNV() const { return acc_state_nv_.get(); }
-    vvl::AccelerationStructureNV *GetAccelerationStructureStateNV() { return acc_state_nv_.get(); }
+    const vvl::AccelerationStructureNV *GetAccelerationStructureStateNV() const;
+    vvl::AccelerationStructureNV *GetAccelerationStructureStateNV();
     // Returns true if there is a stored KHR acceleration structure and false if there is a stored NV acceleration structure.
     // Asserts that there is only one of the two.
     bool IsAccelerationStructureKHR() const {
@@ -628,32 +723,36 @@ class MutableDescriptor : public Descriptor {
     DescriptorClass ActiveClass() const { return DescriptorTypeToClass(active_descriptor_type_); }
 
   private:
-    VkDeviceSize buffer_size_{0};
-    VkDescriptorType active_descriptor_type_{VK_DESCRIPTOR_TYPE_MUTABLE_EXT};
+    // A mutable descriptor holds one buffer, buffer view or acceleration structure at a time, they share one state pointer.
+    // Large bindless heaps are mostly mutable descriptors, so the members are also ordered to avoid padding.
+    enum class ResourceKind : uint8_t { None, Buffer, BufferView, AccelerationStructureKHR, AccelerationStructureNV };
+    void ReplaceResourceState(DescriptorSet &set_state, std::shared_ptr<StateObject> &&state, ResourceKind kind, bool is_bindless);
+    vvl::Buffer *BufferState() const;
+    vvl::BufferView *BufferViewState() const;
 
-    // Sampler and ImageSampler Descriptor
-    bool immutable_{false};
-    std::shared_ptr<vvl::Sampler> sampler_state_;
-    // Image Descriptor
-    std::shared_ptr<vvl::ImageView> image_view_state_;
-    VkImageLayout image_layout_{VK_IMAGE_LAYOUT_UNDEFINED};
-    // Texel Descriptor
-    std::shared_ptr<vvl::BufferView> buffer_view_state_;
+    VkDeviceSize buffer_size_{0};
     // Buffer Descriptor
     VkDeviceSize offset_{0};
     VkDeviceSize range_{0};
-    std::shared_ptr<vvl::Buffer> buffer_state_;
     // Acceleration Structure Descriptor
-    bool is_khr_{false};
     VkAccelerationStructureKHR acc_{VK_NULL_HANDLE};
-    std::shared_ptr<vvl::AccelerationStructureKHR> acc_state_;
     VkAccelerationStructureNV acc_nv_{VK_NULL_HANDLE};
-    std::shared_ptr<vvl::AccelerationStructureNV> acc_state_nv_;
+    // Sampler and ImageSampler Descriptor
+    std::shared_ptr<vvl::Sampler> sampler_state_;
+    // Image Descriptor
+    std::shared_ptr<vvl::ImageView> image_view_state_;
+    // Buffer, Texel and Acceleration Structure Descriptor, resource_kind_ tells which
+    std::shared_ptr<StateObject> resource_state_;
+    VkDescriptorType active_descriptor_type_{VK_DESCRIPTOR_TYPE_MUTABLE_EXT};
+    VkImageLayout image_layout_{VK_IMAGE_LAYOUT_UNDEFINED};
+    ResourceKind resource_kind_{ResourceKind::None};
+    bool immutable_{false};
+    bool is_khr_{false};
 };
 
 // Structs to contain common elements that need to be shared between Validate* and Perform* calls below
 struct AllocateDescriptorSetsData {
-    std::map<uint32_t, uint32_t> required_descriptors_by_type;
+    DescriptorTypeCounts required_descriptors_by_type;
     std::vector<std::shared_ptr<DescriptorSetLayout const>> layout_nodes;
     void Init(uint32_t);
     AllocateDescriptorSetsData(){};
@@ -703,6 +802,8 @@ class DescriptorBinding {
     const uint32_t count;
     const bool has_immutable_samplers;
     small_vector<bool, 1, uint32_t> updated;
+    // Bumped by every write or copy into this binding, and when an object it uses is invalidated (for cached validation)
+    std::atomic<uint64_t> change_count{0};
 };
 
 template <typename T>
@@ -828,6 +929,8 @@ class DescriptorSet : public StateObject {
     const std::shared_ptr<DescriptorSetLayout const> &GetLayout() const { return layout_; };
     VkDescriptorSetLayout GetDescriptorSetLayout() const { return layout_->VkHandle(); }
     VkDescriptorSet VkHandle() const { return handle_.Cast<VkDescriptorSet>(); };
+    std::shared_ptr<const DescriptorSet> shared_from_this() const { return SharedFromThisImpl(this); }
+    std::shared_ptr<DescriptorSet> shared_from_this() { return SharedFromThisImpl(this); }
     // Bind given cmd_buffer to this descriptor set and
     // update CB image layout map with image/imagesampler descriptor image layouts
     void UpdateDrawState(ValidationStateTracker *, vvl::CommandBuffer *cb_state, vvl::Func command, const vvl::Pipeline *,
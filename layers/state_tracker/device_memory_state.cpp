@@ -107,16 +107,74 @@ DeviceMemory::DeviceMemory(VkDeviceMemory handle, const VkMemoryAllocateInfo *al
       p_driver_data(nullptr),
       fake_base_address(fake_address) {
 }
+
+void DeviceMemory::Destroy() {
+    decltype(bound_resources_) bound_resources;
+    {
+        auto guard = std::unique_lock(bound_resources_lock_);
+        bound_resources = std::move(bound_resources_);
+        bound_resources_.clear();
+    }
+    if (!bound_resources.empty() && !InTeardown()) {
+        NodeList invalid_nodes;
+        invalid_nodes.emplace_back(shared_from_this());
+        for (auto &[offset, bound_resource] : bound_resources) {
+            auto node = bound_resource.node.lock();
+            if (node && !node->Destroyed()) {
+                NotifyParentInvalidate(*node, invalid_nodes, true);
+            }
+        }
+    }
+    StateObject::Destroy();
+}
+
+const VulkanTypedHandle *DeviceMemory::InUse() const {
+    if (const VulkanTypedHandle *in_use = StateObject::InUse()) {
+        return in_use;
+    }
+    auto guard = std::shared_lock(bound_resources_lock_);
+    for (const auto &[offset, bound_resource] : bound_resources_) {
+        auto node = bound_resource.node.lock();
+        if (node && node->InUse()) {
+            return &node->Handle();
+        }
+    }
+    return nullptr;
+}
+
+void DeviceMemory::AddBoundResource(StateObject &resource, VkDeviceSize offset, VkDeviceSize size) {
+    auto guard = std::unique_lock(bound_resources_lock_);
+    bound_resources_.emplace(offset, BoundResource{offset + size, resource.Handle(), resource.shared_from_this()});
+    max_bound_size_ = std::max(max_bound_size_, size);
+}
+
+void DeviceMemory::RemoveBoundResource(const StateObject &resource, VkDeviceSize offset) {
+    auto guard = std::unique_lock(bound_resources_lock_);
+    auto [begin, end] = bound_resources_.equal_range(offset);
+    for (auto it = begin; it != end; ++it) {
+        if (it->second.handle == resource.Handle()) {
+            bound_resources_.erase(it);
+            return;
+        }
+    }
+}
 }  // namespace vvl
 
 void vvl::BindableLinearMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
                                              VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
     ASSERT_AND_RETURN(mem_state);
 
-    mem_state->AddParent(parent);
+    UnlinkMemory(parent);
+    mem_state->AddBoundResource(*parent, memory_offset, size);
     binding_ = {mem_state, memory_offset, 0u};
 }
 
+void vvl::BindableLinearMemoryTracker::UnlinkMemory(StateObject *parent) {
+    if (binding_.memory_state) {
+        binding_.memory_state->RemoveBoundResource(*parent, binding_.memory_offset);
+    }
+}
+
 DeviceMemoryState vvl::BindableLinearMemoryTracker::GetBoundMemoryStates() const {
     return binding_.memory_state ? DeviceMemoryState{binding_.memory_state} : DeviceMemoryState{};
 }
@@ -195,6 +253,58 @@ void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shar
     }
 }
 
+void vvl::BindableSparseMemoryTracker::BindMemoryBatch(StateObject *parent, std::vector<MemoryBind> &binds) {
+    std::vector<const MemoryBind *> sorted_binds;
+    sorted_binds.reserve(binds.size());
+    for (const MemoryBind &bind : binds) {
+        if (bind.size != 0) {
+            sorted_binds.emplace_back(&bind);
+        }
+    }
+    std::sort(sorted_binds.begin(), sorted_binds.end(),
+              [](const MemoryBind *lhs, const MemoryBind *rhs) { return lhs->resource_offset < rhs->resource_offset; });
+
+    // Where binds overlap the last one in the bind info wins, which only binding them in their original order gets right
+    bool overlapping = false;
+    for (size_t i = 1; i < sorted_binds.size() && !overlapping; ++i) {
+        overlapping = sorted_binds[i]->resource_offset < sorted_binds[i - 1]->resource_offset + sorted_binds[i - 1]->size;
+    }
+
+    auto guard = WriteLockGuard{binding_lock_};
+
+    // Since we don't know which ranges will be removed, we need to unbind everything and rebind later
+    for (auto &value_pair : binding_map_) {
+        if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
+    }
+
+    if (overlapping) {
+        for (const MemoryBind &bind : binds) {
+            if (bind.size != 0) {
+                MEM_BINDING memory_data{bind.memory_state, bind.memory_offset, bind.resource_offset};
+                binding_map_.overwrite_range(
+                    BindingMap::value_type{{bind.resource_offset, bind.resource_offset + bind.size}, memory_data});
+            }
+        }
+    } else if (!sorted_binds.empty()) {
+        // Each bind starts at or after the end of the previous one, so the lower bound of the next bind is found by walking
+        // forward from the range just inserted. That walk is no longer than the rebind below.
+        auto lower = binding_map_.lower_bound(
+            BindingMap::key_type{sorted_binds[0]->resource_offset, sorted_binds[0]->resource_offset + sorted_binds[0]->size});
+        for (const MemoryBind *bind : sorted_binds) {
+            BindingMap::value_type item{{bind->resource_offset, bind->resource_offset + bind->size},
+                                        MEM_BINDING{bind->memory_state, bind->memory_offset, bind->resource_offset}};
+            while (lower != binding_map_.end() && lower->first.end <= item.first.begin) {
+                ++lower;
+            }
+            lower = binding_map_.overwrite_range(lower, item);
+        }
+    }
+
+    for (auto &value_pair : binding_map_) {
+        if (value_pair.second.memory_state) value_pair.second.memory_state->AddParent(parent);
+    }
+}
+
 BoundMemoryRange vvl::BindableSparseMemoryTracker::GetBoundMemoryRange(const MemoryRange &range) const {
     BoundMemoryRange mem_ranges;
     auto guard = ReadLockGuard{binding_lock_};
@@ -282,6 +392,219 @@ DeviceMemoryState vvl::BindableSparseMemoryTracker::GetBoundMemoryStates() const
 }
 
 
+static uint32_t DivideRoundingUp(uint32_t value, uint32_t divisor) { return (value / divisor) + ((value % divisor) != 0 ? 1 : 0); }
+
+vvl::BindableSparseImageMemoryTracker::BindableSparseImageMemoryTracker(
+    const VkMemoryRequirements *requirements, const VkImageCreateInfo &create_info,
+    const std::vector<VkSparseImageMemoryRequirements> &sparse_requirements)
+    : BindableSparseMemoryTracker(requirements, true), array_layers_(create_info.arrayLayers) {
+    uint32_t block_count = 0;
+    for (const VkSparseImageMemoryRequirements &requirements : sparse_requirements) {
+        const VkExtent3D &granularity = requirements.formatProperties.imageGranularity;
+        if (granularity.width == 0 || granularity.height == 0 || granularity.depth == 0) {
+            continue;
+        }
+        const uint32_t mip_count = std::min(create_info.mipLevels, requirements.imageMipTailFirstLod);
+        // The metadata aspect can only be bound with opaque binds. Aspects sharing requirements are still bound separately.
+        const VkImageAspectFlags aspect_mask = requirements.formatProperties.aspectMask & ~VK_IMAGE_ASPECT_METADATA_BIT;
+        for (uint32_t aspect_bit = 0; aspect_bit < 32; ++aspect_bit) {
+            const VkImageAspectFlags aspect = 1u << aspect_bit;
+            if ((aspect_mask & aspect) == 0) {
+                continue;
+            }
+            aspects_.emplace_back(AspectBlocks{aspect, requirements, static_cast<uint32_t>(subresources_.size()), mip_count});
+            for (uint32_t mip = 0; mip < mip_count; ++mip) {
+                VkExtent3D mip_extent = GetEffectiveExtent(create_info, aspect, mip);
+                if (create_info.imageType != VK_IMAGE_TYPE_3D) {
+                    mip_extent.depth = 1;
+                }
+                const VkExtent3D mip_block_count = {DivideRoundingUp(mip_extent.width, granularity.width),
+                                                    DivideRoundingUp(mip_extent.height, granularity.height),
+                                                    DivideRoundingUp(mip_extent.depth, granularity.depth)};
+                for (uint32_t layer = 0; layer < array_layers_; ++layer) {
+                    subresources_.emplace_back(SubresourceBlocks{block_count, mip_block_count});
+                    block_count += mip_block_count.width * mip_block_count.height * mip_block_count.depth;
+                }
+            }
+        }
+    }
+    blocks_.resize(block_count, 0u);
+}
+
+unsigned vvl::BindableSparseImageMemoryTracker::CountDeviceMemory(VkDeviceMemory memory) const {
+    unsigned count = BindableSparseMemoryTracker::CountDeviceMemory(memory);
+    auto guard = ReadLockGuard{residency_lock_};
+    for (const BlockMemory &block_memory : memories_) {
+        count += (block_memory.memory_state && block_memory.memory_state->VkHandle() == memory) ? block_memory.block_count : 0;
+    }
+    return count;
+}
+
+void vvl::BindableSparseImageMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
+                                                       VkDeviceSize memory_offset, VkDeviceSize resource_offset,
+                                                       VkDeviceSize size) {
+    BindableSparseMemoryTracker::BindMemory(parent, mem_state, memory_offset, resource_offset, size);
+    // The opaque binds unlink the memory they no longer reference, even if some blocks are still bound to it
+    auto guard = ReadLockGuard{residency_lock_};
+    for (const BlockMemory &block_memory : memories_) {
+        if (block_memory.memory_state) block_memory.memory_state->AddParent(parent);
+    }
+}
+
+void vvl::BindableSparseImageMemoryTracker::BindMemoryBatch(StateObject *parent, std::vector<MemoryBind> &binds) {
+    BindableSparseMemoryTracker::BindMemoryBatch(parent, binds);
+    auto guard = ReadLockGuard{residency_lock_};
+    for (const BlockMemory &block_memory : memories_) {
+        if (block_memory.memory_state) block_memory.memory_state->AddParent(parent);
+    }
+}
+
+DeviceMemoryState vvl::BindableSparseImageMemoryTracker::GetBoundMemoryStates() const {
+    DeviceMemoryState dev_mem_states = BindableSparseMemoryTracker::GetBoundMemoryStates();
+    auto guard = ReadLockGuard{residency_lock_};
+    for (const BlockMemory &block_memory : memories_) {
+        if (block_memory.memory_state) dev_mem_states.emplace(block_memory.memory_state);
+    }
+    return dev_mem_states;
+}
+
+const vvl::BindableSparseImageMemoryTracker::SubresourceBlocks *vvl::BindableSparseImageMemoryTracker::FindSubresource(
+    const VkImageSubresource &subresource, VkExtent3D &granularity) const {
+    for (const AspectBlocks &aspect_blocks : aspects_) {
+        if (aspect_blocks.aspect == subresource.aspectMask) {
+            if (subresource.mipLevel >= aspect_blocks.mip_count || subresource.arrayLayer >= array_layers_) {
+                return nullptr;
+            }
+            granularity = aspect_blocks.requirements.formatProperties.imageGranularity;
+            return &subresources_[aspect_blocks.first_subresource + subresource.mipLevel * array_layers_ + subresource.arrayLayer];
+        }
+    }
+    return nullptr;
+}
+
+bool vvl::BindableSparseImageMemoryTracker::GetBlockRange(const SubresourceBlocks &blocks, const VkExtent3D &granularity,
+                                                          const VkOffset3D &offset, const VkExtent3D &extent, VkOffset3D &begin,
+                                                          VkOffset3D &end) {
+    if (offset.x < 0 || offset.y < 0 || offset.z < 0) {
+        return false;
+    }
+    // A partial block at the end of the region is the last block of the subresource
+    begin = {static_cast<int32_t>(static_cast<uint32_t>(offset.x) / granularity.width),
+             static_cast<int32_t>(static_cast<uint32_t>(offset.y) / granularity.height),
+             static_cast<int32_t>(static_cast<uint32_t>(offset.z) / granularity.depth)};
+    end = {static_cast<int32_t>(std::min(blocks.block_count.width,
+                                         DivideRoundingUp(static_cast<uint32_t>(offset.x) + extent.width, granularity.width))),
+           static_cast<int32_t>(std::min(blocks.block_count.height,
+                                         DivideRoundingUp(static_cast<uint32_t>(offset.y) + extent.height, granularity.height))),
+           static_cast<int32_t>(std::min(blocks.block_count.depth,
+                                         DivideRoundingUp(static_cast<uint32_t>(offset.z) + extent.depth, granularity.depth)))};
+    return begin.x < end.x && begin.y < end.y && begin.z < end.z;
+}
+
+void vvl::BindableSparseImageMemoryTracker::BindImageMemoryBatch(StateObject *parent, const std::vector<ImageMemoryBind> &binds) {
+    std::vector<std::shared_ptr<vvl::DeviceMemory>> linked_memories;
+    std::vector<std::shared_ptr<vvl::DeviceMemory>> unlinked_memories;
+    {
+        auto guard = WriteLockGuard{residency_lock_};
+        for (const ImageMemoryBind &bind : binds) {
+            VkExtent3D granularity;
+            const SubresourceBlocks *subresource_blocks = FindSubresource(bind.subresource, granularity);
+            VkOffset3D begin, end;
+            if (!subresource_blocks || !GetBlockRange(*subresource_blocks, granularity, bind.offset, bind.extent, begin, end)) {
+                continue;
+            }
+
+            uint32_t slot = 0;
+            if (bind.memory_state && bind.memory_state->VkHandle() != VK_NULL_HANDLE) {
+                auto [slot_it, inserted] = memory_slots_.emplace(bind.memory_state.get(), 0u);
+                if (inserted) {
+                    if (free_memory_slots_.empty()) {
+                        slot_it->second = static_cast<uint32_t>(memories_.size());
+                        memories_.emplace_back(BlockMemory{bind.memory_state, 0u});
+                    } else {
+                        slot_it->second = free_memory_slots_.back();
+                        free_memory_slots_.pop_back();
+                        memories_[slot_it->second] = BlockMemory{bind.memory_state, 0u};
+                    }
+                    linked_memories.emplace_back(bind.memory_state);
+                }
+                slot = slot_it->second + 1;
+            }
+
+            const VkExtent3D &block_count = subresource_blocks->block_count;
+            for (int32_t z = begin.z; z < end.z; ++z) {
+                for (int32_t y = begin.y; y < end.y; ++y) {
+                    const uint32_t row = subresource_blocks->first_block + (z * block_count.height + y) * block_count.width;
+                    for (int32_t x = begin.x; x < end.x; ++x) {
+                        uint32_t &block = blocks_[row + x];
+                        if (block != 0) {
+                            --memories_[block - 1].block_count;
+                        }
+                        if (slot != 0) {
+                            ++memories_[slot - 1].block_count;
+                        }
+                        block = slot;
+                    }
+                }
+            }
+        }
+
+        for (uint32_t slot = 0; slot < memories_.size(); ++slot) {
+            BlockMemory &block_memory = memories_[slot];
+            if (block_memory.memory_state && block_memory.block_count == 0) {
+                memory_slots_.erase(block_memory.memory_state.get());
+                free_memory_slots_.emplace_back(slot);
+                unlinked_memories.emplace_back(std::move(block_memory.memory_state));
+            }
+        }
+    }
+
+    for (auto &memory_state : linked_memories) {
+        memory_state->AddParent(parent);
+    }
+    for (auto &memory_state : unlinked_memories) {
+        // The memory can still be bound to the mip tail
+        if (BindableSparseMemoryTracker::CountDeviceMemory(memory_state->VkHandle()) == 0) {
+            memory_state->RemoveParent(parent);
+        }
+    }
+}
+
+bool vvl::BindableSparseImageMemoryTracker::IsResident(const VkImageSubresource &subresource, const VkOffset3D &offset,
+                                                       const VkExtent3D &extent) const {
+    VkExtent3D granularity;
+    const SubresourceBlocks *subresource_blocks = FindSubresource(subresource, granularity);
+    VkOffset3D begin, end;
+    if (!subresource_blocks || !GetBlockRange(*subresource_blocks, granularity, offset, extent, begin, end)) {
+        return false;
+    }
+
+    auto guard = ReadLockGuard{residency_lock_};
+    const VkExtent3D &block_count = subresource_blocks->block_count;
+    for (int32_t z = begin.z; z < end.z; ++z) {
+        for (int32_t y = begin.y; y < end.y; ++y) {
+            const uint32_t row = subresource_blocks->first_block + (z * block_count.height + y) * block_count.width;
+            for (int32_t x = begin.x; x < end.x; ++x) {
+                const uint32_t block = blocks_[row + x];
+                if (block == 0 || memories_[block - 1].memory_state->Invalid()) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+const VkSparseImageMemoryRequirements *vvl::BindableSparseImageMemoryTracker::GetSparseRequirements(
+    VkImageAspectFlags aspect) const {
+    for (const AspectBlocks &aspect_blocks : aspects_) {
+        if (aspect_blocks.aspect == aspect) {
+            return &aspect_blocks.requirements;
+        }
+    }
+    return nullptr;
+}
+
 vvl::BindableMultiplanarMemoryTracker::BindableMultiplanarMemoryTracker(const VkMemoryRequirements *requirements, uint32_t num_planes)
     : planes_(num_planes) {
     for (unsigned i = 0; i < num_planes; ++i) {
@@ -314,8 +637,20 @@ void vvl::BindableMultiplanarMemoryTracker::BindMemory(StateObject *parent, std:
     ASSERT_AND_RETURN(mem_state);
 
     assert(resource_offset < planes_.size());
-    mem_state->AddParent(parent);
-    planes_[static_cast<size_t>(resource_offset)].binding = {mem_state, memory_offset, 0u};
+    MEM_BINDING &binding = planes_[static_cast<size_t>(resource_offset)].binding;
+    if (binding.memory_state) {
+        binding.memory_state->RemoveBoundResource(*parent, binding.memory_offset);
+    }
+    mem_state->AddBoundResource(*parent, memory_offset, size);
+    binding = {mem_state, memory_offset, 0u};
+}
+
+void vvl::BindableMultiplanarMemoryTracker::UnlinkMemory(StateObject *parent) {
+    for (const Plane &plane : planes_) {
+        if (plane.binding.memory_state) {
+            plane.binding.memory_state->RemoveBoundResource(*parent, plane.binding.memory_offset);
+        }
+    }
 }
 
 // range needs to be between [0, planes_[0].size + planes_[1].size + planes_[2].size)
@@ -21,6 +21,9 @@
 #include "containers/range_vector.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 
+#include <map>
+#include <shared_mutex>
+
 namespace vvl {
 struct MemRange {
     VkDeviceSize offset = 0;
@@ -84,6 +87,47 @@ class DeviceMemory : public StateObject {
     bool IsDedicatedImage() const { return GetDedicatedImage() != VK_NULL_HANDLE; }
 
     VkDeviceMemory VkHandle() const { return handle_.Cast<VkDeviceMemory>(); }
+
+    void Destroy() override;
+    const VulkanTypedHandle *InUse() const override;
+
+    // Resources bound to a single range of the memory (non sparse buffers, images and image planes) are kept sorted by offset
+    // instead of as parents of the memory, so finding the resources bound to a range does not walk every binding. They are
+    // still invalidated when the memory is freed.
+    void AddBoundResource(StateObject &resource, VkDeviceSize offset, VkDeviceSize size);
+    void RemoveBoundResource(const StateObject &resource, VkDeviceSize offset);
+    // Calls pred on the bound resources intersecting [begin, end) until it returns true
+    template <typename UnaryPredicate>
+    bool AnyBoundResource(VkDeviceSize begin, VkDeviceSize end, const UnaryPredicate &pred) const {
+        small_vector<std::shared_ptr<StateObject>, 4> resources;
+        {
+            auto guard = std::shared_lock(bound_resources_lock_);
+            // A resource starting up to max_bound_size_ before begin can still reach it
+            auto it = bound_resources_.lower_bound(begin > max_bound_size_ ? begin - max_bound_size_ : 0);
+            for (; it != bound_resources_.end() && it->first < end; ++it) {
+                if (it->second.end > begin) {
+                    if (auto resource = it->second.node.lock()) {
+                        resources.emplace_back(std::move(resource));
+                    }
+                }
+            }
+        }
+        for (const auto &resource : resources) {
+            if (pred(*resource)) return true;
+        }
+        return false;
+    }
+
+  private:
+    struct BoundResource {
+        VkDeviceSize end;
+        VulkanTypedHandle handle;
+        std::weak_ptr<StateObject> node;
+    };
+    // Keyed by the offset of the binding
+    std::multimap<VkDeviceSize, BoundResource> bound_resources_;
+    VkDeviceSize max_bound_size_ = 0;
+    mutable std::shared_mutex bound_resources_lock_;
 };
 
 // Generic memory binding struct to track objects bound to objects
@@ -105,6 +149,13 @@ class BindableMemoryTracker {
     using BoundMemoryRange = std::map<VkDeviceMemory, std::vector<MemoryRange>>;
     using BoundRanges = vvl::unordered_map<VkDeviceMemory, std::vector<std::pair<MemoryRange, BufferRange>>>;
     using DeviceMemoryState = unordered_set<std::shared_ptr<vvl::DeviceMemory>>;
+    // One VkSparseMemoryBind, in resource space
+    struct MemoryBind {
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+        VkDeviceSize memory_offset;
+        VkDeviceSize resource_offset;
+        VkDeviceSize size;
+    };
 
     virtual ~BindableMemoryTracker() {}
     // kept for backwards compatibility, only useful with the Linear tracker
@@ -113,6 +164,18 @@ class BindableMemoryTracker {
     virtual bool HasFullRangeBound() const = 0;
 
     virtual void BindMemory(StateObject *, std::shared_ptr<vvl::DeviceMemory> &, VkDeviceSize, VkDeviceSize, VkDeviceSize) = 0;
+    // Unlinks the resource from all of its memory when it is destroyed
+    virtual void UnlinkMemory(StateObject *parent) {
+        for (auto &state : GetBoundMemoryStates()) {
+            state->RemoveParent(parent);
+        }
+    }
+    // Applies the binds of one sparse bind info as if bound one after the other, binds may be reordered
+    virtual void BindMemoryBatch(StateObject *parent, std::vector<MemoryBind> &binds) {
+        for (MemoryBind &bind : binds) {
+            BindMemory(parent, bind.memory_state, bind.memory_offset, bind.resource_offset, bind.size);
+        }
+    }
 
     virtual BoundMemoryRange GetBoundMemoryRange(const MemoryRange &) const = 0;
     virtual BoundRanges GetBoundRanges(const BufferRange &ranges_bounds, const std::vector<BufferRange> &ranges) const = 0;
@@ -153,6 +216,7 @@ class BindableLinearMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    void UnlinkMemory(StateObject *parent) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
     // No need to have this overload for linear memory
@@ -178,6 +242,8 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    // Sorts the binds and, unless they overlap, applies them in one pass over the binding map under a single lock
+    void BindMemoryBatch(StateObject *parent, std::vector<MemoryBind> &binds) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
     // With a list of (VALID) buffer ranges as input, and `ranges_bounds` being a range that contains all of those buffer ranges,
@@ -199,6 +265,70 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
     bool is_resident_;
 };
 
+// Sparse tracker of images created with VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT. Opaque binds (mip tail and metadata) are kept in
+// the range map of BindableSparseMemoryTracker, while VkSparseImageMemoryBind go to a flat table with one entry per sparse image
+// block of each aspect, mip level before the mip tail and array layer, so binding a block and looking it up are O(1).
+class BindableSparseImageMemoryTracker : public BindableSparseMemoryTracker {
+  public:
+    struct ImageMemoryBind {
+        VkImageSubresource subresource;
+        VkOffset3D offset;
+        VkExtent3D extent;
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+    };
+
+    BindableSparseImageMemoryTracker(const VkMemoryRequirements *requirements, const VkImageCreateInfo &create_info,
+                                     const std::vector<VkSparseImageMemoryRequirements> &sparse_requirements);
+
+    unsigned CountDeviceMemory(VkDeviceMemory memory) const override;
+
+    void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
+                    VkDeviceSize resource_offset, VkDeviceSize size) override;
+    void BindMemoryBatch(StateObject *parent, std::vector<MemoryBind> &binds) override;
+
+    DeviceMemoryState GetBoundMemoryStates() const override;
+
+    // Binds that are not within the block table (invalid or in the mip tail) are ignored
+    void BindImageMemoryBatch(StateObject *parent, const std::vector<ImageMemoryBind> &binds);
+    // True if every block of the region is bound to memory that was not freed
+    bool IsResident(const VkImageSubresource &subresource, const VkOffset3D &offset, const VkExtent3D &extent) const;
+    // nullptr if the image has no sparse requirements for the aspect
+    const VkSparseImageMemoryRequirements *GetSparseRequirements(VkImageAspectFlags aspect) const;
+
+  private:
+    struct AspectBlocks {
+        VkImageAspectFlags aspect;
+        VkSparseImageMemoryRequirements requirements;
+        // Index in subresources_ of mip level 0, array layer 0
+        uint32_t first_subresource;
+        uint32_t mip_count;
+    };
+    struct SubresourceBlocks {
+        uint32_t first_block;
+        VkExtent3D block_count;
+    };
+    struct BlockMemory {
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+        uint32_t block_count;
+    };
+
+    const SubresourceBlocks *FindSubresource(const VkImageSubresource &subresource, VkExtent3D &granularity) const;
+    // The blocks [begin, end) of a subresource that a region covers, false if the region is empty or out of the subresource
+    static bool GetBlockRange(const SubresourceBlocks &blocks, const VkExtent3D &granularity, const VkOffset3D &offset,
+                              const VkExtent3D &extent, VkOffset3D &begin, VkOffset3D &end);
+
+    const uint32_t array_layers_;
+    std::vector<AspectBlocks> aspects_;
+    std::vector<SubresourceBlocks> subresources_;
+
+    mutable std::shared_mutex residency_lock_;
+    // Index + 1 in memories_ of the memory bound to each block, 0 if the block is not resident
+    std::vector<uint32_t> blocks_;
+    std::vector<BlockMemory> memories_;
+    std::vector<uint32_t> free_memory_slots_;
+    vvl::unordered_map<const vvl::DeviceMemory *, uint32_t> memory_slots_;
+};
+
 // Non sparse multi planar bindable memory tracker
 class BindableMultiplanarMemoryTracker : public BindableMemoryTracker {
   public:
@@ -212,6 +342,7 @@ class BindableMultiplanarMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    void UnlinkMemory(StateObject *parent) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
     // No reason to have this function for multi planar memory
@@ -248,9 +379,7 @@ class Bindable : public StateObject {
     }
 
     void Destroy() override {
-        for (auto &state : memory_tracker_->GetBoundMemoryStates()) {
-            state->RemoveParent(this);
-        }
+        memory_tracker_->UnlinkMemory(this);
 
         StateObject::Destroy();
     }
@@ -297,6 +426,9 @@ class Bindable : public StateObject {
                     const VkDeviceSize resource_offset, const VkDeviceSize mem_size) {
         memory_tracker_->BindMemory(parent, mem, memory_offset, resource_offset, mem_size);
     }
+    void BindMemoryBatch(StateObject *parent, std::vector<BindableMemoryTracker::MemoryBind> &binds) {
+        memory_tracker_->BindMemoryBatch(parent, binds);
+    }
 
     bool HasFullRangeBound() const { return memory_tracker_->HasFullRangeBound(); }
 
@@ -48,6 +48,10 @@ bool vvl::Fence::EnqueueSignal(vvl::Queue *queue_state, uint64_t next_seq) {
 
 // Called from a non-queue operation, such as vkWaitForFences()|
 void vvl::Fence::NotifyAndWait(const Location &loc) {
+    // The queue thread already retired the fence (or it was never submitted), as for every poll after the first success
+    if (state_.load(std::memory_order_acquire) != kInflight) {
+        return;
+    }
     std::shared_future<void> waiter;
     AcquireFenceSync acquire_fence_sync;
     {
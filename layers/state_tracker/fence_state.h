@@ -21,6 +21,7 @@
 
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
+#include <atomic>
 #include <future>
 
 class ValidationStateTracker;
@@ -66,17 +67,17 @@ class Fence : public RefcountedStateObject {
     Fence(ValidationStateTracker &dev, VkFence handle, const VkFenceCreateInfo *pCreateInfo);
 
     VkFence VkHandle() const { return handle_.Cast<VkFence>(); }
-    // TODO: apply ReadLock as Semaphore does, or consider reading enums without lock.
+    // The state is read without the lock, fences polled after they signaled are seen as retired without locking.
     // Consider if more high-level operation should be exposed, because
     // (State() == a && Scope() == b) can be racey, but this could be fine if the
     // goal is not to crash and validity is based on external synchronization.
-    enum State State() const { return state_; }
+    enum State State() const { return state_.load(std::memory_order_acquire); }
     enum Scope Scope() const { return scope_; }
 
     bool EnqueueSignal(Queue *queue_state, uint64_t next_seq);
 
     // Notify the queue that the fence has signalled and then wait for the queue
-    // to update state.
+    // to update state. Does nothing, without locking, if the fence is not in flight.
     void NotifyAndWait(const Location &loc);
 
     // Update state of the completed fence. This should only be called by Queue.
@@ -101,7 +102,8 @@ class Fence : public RefcountedStateObject {
 
     Queue *queue_{nullptr};
     uint64_t seq_{0};
-    enum State state_;
+    // Only written with the lock held
+    std::atomic<enum State> state_;
     enum Scope scope_{kInternal};
     std::optional<VkExternalFenceHandleTypeFlagBits> imported_handle_type_;  // has value when scope is not kInternal
     mutable std::shared_mutex lock_;
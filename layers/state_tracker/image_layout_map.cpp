@@ -94,6 +94,47 @@ ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const vvl::Image& image_sta
       layouts_(encoder_.SubresourceCount()),
       initial_layout_states_() {}
 
+// Entering the uniform state is the same as filling the empty range map with new_entry, after that every update of the whole
+// image updates the single entry the way UpdateLayoutStateImpl updates each range
+bool ImageSubresourceLayoutMap::UpdateUniform(LayoutEntry& new_entry, const vvl::CommandBuffer& cb_state,
+                                              const vvl::ImageView* view_state) {
+    if (!uniform_) {
+        assert(layouts_.empty());
+        initial_layout_states_.emplace_back(cb_state, view_state);
+        new_entry.state = &initial_layout_states_.back();
+        uniform_entry_ = new_entry;
+        uniform_ = true;
+        uniform_layouts_built_ = false;
+        return true;
+    }
+    if (!uniform_entry_.CurrentWillChange(new_entry.current_layout)) {
+        return false;
+    }
+    uniform_layouts_built_ = false;
+    return uniform_entry_.Update(new_entry);
+}
+
+void ImageSubresourceLayoutMap::BuildLayoutMap() const {
+    if (!uniform_ || uniform_layouts_built_) {
+        return;
+    }
+    if (layouts_.empty()) {
+        layouts_.insert(layouts_.end(), std::make_pair(RangeType(0, encoder_.SubresourceCount()), uniform_entry_));
+    } else {
+        // Built before, it is still one range covering every subresource
+        assert(layouts_.size() == 1);
+        layouts_.begin()->second = uniform_entry_;
+    }
+    uniform_layouts_built_ = true;
+}
+
+void ImageSubresourceLayoutMap::LeaveUniform() {
+    if (uniform_) {
+        BuildLayoutMap();
+        uniform_ = false;
+    }
+}
+
 // Use the unwrapped maps from the BothMap in the actual implementation
 template <typename LayoutMap>
 static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states, RangeGenerator& range_gen,
@@ -101,7 +142,10 @@ static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutState
     bool updated = false;
     LayoutEntry entry(expected_layout, layout);
     for (; range_gen->non_empty(); ++range_gen) {
-        updated |= UpdateLayoutStateImpl(layouts, initial_layout_states, *range_gen, entry, cb_state, nullptr);
+        if (UpdateLayoutStateImpl(layouts, initial_layout_states, *range_gen, entry, cb_state, nullptr)) {
+            sparse_container::consolidate(layouts, *range_gen);
+            updated = true;
+        }
     }
     return updated;
 }
@@ -115,6 +159,11 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const vvl::CommandBuff
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
 
     RangeGenerator range_gen(encoder_, range);
+    if (IsWholeImage(range_gen) && (uniform_ || layouts_.empty())) {
+        LayoutEntry entry(expected_layout, layout);
+        return UpdateUniform(entry, cb_state, nullptr);
+    }
+    LeaveUniform();
     if (layouts_.SmallMode()) {
         return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
                                              expected_layout);
@@ -132,7 +181,9 @@ static void SetSubresourceRangeInitialLayoutImpl(LayoutMap& layouts, InitialLayo
                                                  VkImageLayout layout, const vvl::ImageView* view_state) {
     LayoutEntry entry(layout);
     for (; range_gen->non_empty(); ++range_gen) {
-        UpdateLayoutStateImpl(layouts, initial_layout_states, *range_gen, entry, cb_state, view_state);
+        if (UpdateLayoutStateImpl(layouts, initial_layout_states, *range_gen, entry, cb_state, view_state)) {
+            sparse_container::consolidate(layouts, *range_gen);
+        }
     }
 }
 
@@ -142,6 +193,12 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
 
     RangeGenerator range_gen(encoder_, range);
+    if (IsWholeImage(range_gen) && (uniform_ || layouts_.empty())) {
+        LayoutEntry entry(layout);
+        UpdateUniform(entry, cb_state, nullptr);
+        return;
+    }
+    LeaveUniform();
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
     } else {
@@ -154,6 +211,12 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state, VkImageLayout layout,
                                                                  const vvl::ImageView& view_state) {
     RangeGenerator range_gen(view_state.range_generator);
+    if (IsWholeImage(range_gen) && (uniform_ || layouts_.empty())) {
+        LayoutEntry entry(layout);
+        UpdateUniform(entry, cb_state, &view_state);
+        return;
+    }
+    LeaveUniform();
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
                                              &view_state);
@@ -178,7 +241,18 @@ bool ImageSubresourceLayoutMap::UpdateFrom(const ImageSubresourceLayoutMap& othe
     //         currently this function is only used to import from secondary command buffers, destruction of which
     //         invalidate the referencing primary command buffer, meaning that the dangling pointer will either be
     //         cleaned up in invalidation, on not referenced by validation code.
-    return sparse_container::splice(layouts_, other.layouts_, LayoutEntry::Updater());
+    if (other.uniform_ && (uniform_ || layouts_.empty())) {
+        if (!uniform_) {
+            uniform_entry_ = other.uniform_entry_;
+            uniform_ = true;
+            uniform_layouts_built_ = false;
+            return true;
+        }
+        uniform_layouts_built_ = false;
+        return uniform_entry_.Update(other.uniform_entry_);
+    }
+    LeaveUniform();
+    return sparse_container::splice(layouts_, other.GetLayoutMap(), LayoutEntry::Updater());
 }
 
 }  // namespace image_layout_map
@@ -20,7 +20,9 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <utility>
 
 #include "containers/range_vector.h"
 #include "containers/subresource_adapter.h"
@@ -53,6 +55,11 @@ struct InitialLayoutState {
     InitialLayoutState() : image_view(VK_NULL_HANDLE), aspect_mask(0), label() {}
 };
 
+// Layouts of the subresources of an image used by a command buffer.
+//
+// Most barriers and render pass transitions cover the whole image, so as long as every update does, the map only keeps the
+// single entry shared by all the subresources (the "uniform" state) and does no range map operation. The first update of a
+// part of the image splits it into the range map.
 class ImageSubresourceLayoutMap {
   public:
     typedef std::function<bool(const VkImageSubresource&, VkImageLayout, VkImageLayout)> Callback;
@@ -78,6 +85,7 @@ class ImageSubresourceLayoutMap {
                     InitialLayoutState* s = nullptr)
             : initial_layout(initial_), current_layout(current_), state(s) {}
 
+        bool operator==(const LayoutEntry& rhs) const { return !(*this != rhs); }
         bool operator!=(const LayoutEntry& rhs) const {
             return initial_layout != rhs.initial_layout || current_layout != rhs.current_layout || state != rhs.state;
         }
@@ -120,7 +128,20 @@ class ImageSubresourceLayoutMap {
                                           const vvl::ImageView& view_state);
     bool UpdateFrom(const ImageSubresourceLayoutMap& from);
     uintptr_t CompatibilityKey() const;
-    const LayoutMap& GetLayoutMap() const { return layouts_; }
+    // Builds the range map from the uniform entry first when needed. Only call it from the thread recording the command buffer
+    // until recording ends, CommandBuffer::End() builds the maps of every image so that later readers never write.
+    const LayoutMap& GetLayoutMap() const {
+        BuildLayoutMap();
+        return layouts_;
+    }
+    void BuildLayoutMap() const;
+    bool IsUniform() const { return uniform_; }
+
+    // Generation of the global layout map of the image the last time the initial layouts of this map matched it at submit time
+    uint64_t ValidatedGeneration() const { return validated_generation_.load(std::memory_order_relaxed); }
+    void SetValidatedGeneration(uint64_t generation) const {
+        validated_generation_.store(generation, std::memory_order_relaxed);
+    }
     ImageSubresourceLayoutMap(const vvl::Image& image_state);
     ~ImageSubresourceLayoutMap() {}
     const vvl::Image* GetImageView() const { return &image_state_; };
@@ -139,19 +160,27 @@ class ImageSubresourceLayoutMap {
         return RangeGenerator();
     }
 
-    bool AnyInRange(const VkImageSubresourceRange& normalized_range,
-                    std::function<bool(const RangeType& range, const LayoutEntry& state)>&& func) const {
-        return AnyInRange(RangeGen(normalized_range), std::move(func));
+    // The visitor is called as bool(const RangeType& range, const LayoutEntry& state) and stops the walk by returning true.
+    // Taking it as a template parameter lets the compiler inline it into the loop, these run for every subresource range a
+    // command touches.
+    template <typename Visitor>
+    bool AnyInRange(const VkImageSubresourceRange& normalized_range, Visitor&& visitor) const {
+        return AnyInRange(RangeGen(normalized_range), std::forward<Visitor>(visitor));
     }
 
-    bool AnyInRange(const RangeGenerator& gen, std::function<bool(const RangeType& range, const LayoutEntry& state)>&& func) const {
-        return AnyInRange(RangeGenerator(gen), std::move(func));
+    template <typename Visitor>
+    bool AnyInRange(const RangeGenerator& gen, Visitor&& visitor) const {
+        return AnyInRange(RangeGenerator(gen), std::forward<Visitor>(visitor));
     }
 
-    bool AnyInRange(RangeGenerator&& gen, std::function<bool(const RangeType& range, const LayoutEntry& state)>&& func) const {
+    template <typename Visitor>
+    bool AnyInRange(RangeGenerator&& gen, Visitor&& visitor) const {
+        if (uniform_) {
+            return gen->non_empty() && visitor(RangeType(0, encoder_.SubresourceCount()), uniform_entry_);
+        }
         for (; gen->non_empty(); ++gen) {
             for (auto pos = layouts_.lower_bound(*gen); (pos != layouts_.end()) && (gen->intersects(pos->first)); ++pos) {
-                if (func(pos->first, pos->second)) {
+                if (visitor(pos->first, pos->second)) {
                     return true;
                 }
             }
@@ -159,15 +188,39 @@ class ImageSubresourceLayoutMap {
         return false;
     }
 
+    // Kept for callers that already hold a std::function
+    using RangeVisitor = std::function<bool(const RangeType& range, const LayoutEntry& state)>;
+    bool AnyInRange(const VkImageSubresourceRange& normalized_range, RangeVisitor&& func) const {
+        return AnyInRange<RangeVisitor&>(RangeGen(normalized_range), func);
+    }
+    bool AnyInRange(const RangeGenerator& gen, RangeVisitor&& func) const {
+        return AnyInRange<RangeVisitor&>(RangeGenerator(gen), func);
+    }
+    bool AnyInRange(RangeGenerator&& gen, RangeVisitor&& func) const {
+        return AnyInRange<RangeVisitor&>(std::move(gen), func);
+    }
+
   protected:
     bool InRange(const VkImageSubresource& subres) const { return encoder_.InRange(subres); }
     bool InRange(const VkImageSubresourceRange& range) const { return encoder_.InRange(range); }
 
   private:
+    bool IsWholeImage(const RangeGenerator& range_gen) const {
+        return range_gen->begin == 0 && range_gen->end == encoder_.SubresourceCount();
+    }
+    bool UpdateUniform(LayoutEntry& new_entry, const vvl::CommandBuffer& cb_state, const vvl::ImageView* view_state);
+    void LeaveUniform();
+
     const vvl::Image& image_state_;
     const Encoder& encoder_;
-    LayoutMap layouts_;
+    // Out of date while uniform_layouts_built_ is false in the uniform state
+    mutable LayoutMap layouts_;
     InitialLayoutStates initial_layout_states_;
+    bool uniform_ = false;
+    mutable bool uniform_layouts_built_ = false;
+    LayoutEntry uniform_entry_;
+    // Written by the submit time validation, which can run for the same command buffer on several queues at once
+    mutable std::atomic<uint64_t> validated_generation_{0};
 };
 }  // namespace image_layout_map
 
@@ -176,12 +229,45 @@ class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkIma
     using RangeGenerator = image_layout_map::RangeGenerator;
     using RangeType = key_type;
 
-    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index) {}
+    GlobalImageLayoutRangeMap(index_type index)
+        : BothRangeMap<VkImageLayout, 16>(index), subresource_count_(index), generation_(NextGeneration()) {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
+    // Same contract as ImageSubresourceLayoutMap::AnyInRange, the caller holds the read lock
+    template <typename Visitor>
+    bool AnyInRange(RangeGenerator& gen, Visitor&& visitor) const {
+        for (; gen->non_empty(); ++gen) {
+            for (auto pos = lower_bound(*gen); (pos != end()) && (gen->intersects(pos->first)); ++pos) {
+                if (visitor(pos->first, pos->second)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
     bool AnyInRange(RangeGenerator& gen, std::function<bool(const key_type& range, const mapped_type& state)>&& func) const;
 
+    // Changes every time the layouts change and is never the same for two maps, so checks that only depend on the layouts can be
+    // skipped when the generation they last ran against is still current. Called with the write lock held.
+    void Touch() {
+        // The updates leave neighbor ranges in the same layout, merge them so the map does not fragment over the image lifetime
+        sparse_container::consolidate(*this);
+        UpdateUniformLayout();
+        generation_.store(NextGeneration(), std::memory_order_release);
+    }
+    uint64_t Generation() const { return generation_.load(std::memory_order_acquire); }
+
+    // The layout all the subresources are in, or VK_IMAGE_LAYOUT_MAX_ENUM if they are not all in the same one.
+    // Can be read without holding the lock, host image copies check it before walking the map.
+    VkImageLayout UniformLayout() const { return uniform_layout_.load(std::memory_order_acquire); }
+
   private:
+    static uint64_t NextGeneration();
+    void UpdateUniformLayout();
+
     mutable std::shared_mutex lock_;
+    const index_type subresource_count_;
+    std::atomic<uint64_t> generation_;
+    std::atomic<VkImageLayout> uniform_layout_{VK_IMAGE_LAYOUT_MAX_ENUM};
 };
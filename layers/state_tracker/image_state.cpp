@@ -172,6 +172,25 @@ static bool GetMetalExport(const VkImageCreateInfo *info, VkExportMetalObjectTyp
 
 namespace vvl {
 
+ImageFormatInfo::ImageFormatInfo(VkFormat format)
+    : texel_block_extent(vkuFormatTexelBlockExtent(format)),
+      element_size(vkuFormatElementSize(format)),
+      plane_count(vkuFormatPlaneCount(format)),
+      is_multiplane(vkuFormatIsMultiplane(format)),
+      is_depth_or_stencil(vkuFormatIsDepthOrStencil(format)),
+      is_compressed(vkuFormatIsCompressed(format)),
+      is_blocked(vkuFormatIsBlockedImage(format)),
+      format_(format) {
+    if (is_multiplane) {
+        const VkImageAspectFlagBits plane_aspects[kMaxPlanes] = {VK_IMAGE_ASPECT_PLANE_0_BIT, VK_IMAGE_ASPECT_PLANE_1_BIT,
+                                                                 VK_IMAGE_ASPECT_PLANE_2_BIT};
+        for (uint32_t plane = 0; plane < plane_count && plane < kMaxPlanes; ++plane) {
+            plane_formats[plane] = vkuFindMultiplaneCompatibleFormat(format, plane_aspects[plane]);
+            plane_element_sizes[plane] = vkuFormatElementSize(plane_formats[plane]);
+        }
+    }
+}
+
 Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageCreateInfo *pCreateInfo, VkFormatFeatureFlags2KHR ff)
     : Bindable(img, kVulkanObjectTypeImage, (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) != 0,
                (pCreateInfo->flags & VK_IMAGE_CREATE_PROTECTED_BIT) == 0, GetExternalHandleTypes(pCreateInfo)),
@@ -181,6 +200,7 @@ Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageC
       layout_locked(false),
       ahb_format(GetExternalFormat(pCreateInfo->pNext)),
       full_range{MakeImageFullRange(*pCreateInfo)},
+      format_info(pCreateInfo->format),
       create_from_swapchain(GetSwapchain(pCreateInfo)),
       owned_by_swapchain(false),
       swapchain_image_index(0),
@@ -201,9 +221,11 @@ Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageC
       store_device_as_workaround(dev_data.device),  // TODO REMOVE WHEN encoder can be const
       supported_video_profiles(dev_data.video_profile_cache_.Get(
           dev_data.physical_device, vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(pCreateInfo->pNext))) {
-    if (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) {
-        bool is_resident = (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT) != 0;
-        tracker_.emplace<BindableSparseMemoryTracker>(requirements.data(), is_resident);
+    if (sparse_residency) {
+        tracker_.emplace<BindableSparseImageMemoryTracker>(requirements.data(), create_info, sparse_requirements);
+        SetMemoryTracker(&std::get<BindableSparseImageMemoryTracker>(tracker_));
+    } else if (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) {
+        tracker_.emplace<BindableSparseMemoryTracker>(requirements.data(), false);
         SetMemoryTracker(&std::get<BindableSparseMemoryTracker>(tracker_));
     } else if (pCreateInfo->flags & VK_IMAGE_CREATE_DISJOINT_BIT) {
         tracker_.emplace<BindableMultiplanarMemoryTracker>(requirements.data(), vkuFormatPlaneCount(pCreateInfo->format));
@@ -224,6 +246,7 @@ Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageC
       layout_locked(false),
       ahb_format(GetExternalFormat(pCreateInfo->pNext)),
       full_range{MakeImageFullRange(*pCreateInfo)},
+      format_info(pCreateInfo->format),
       create_from_swapchain(swapchain),
       owned_by_swapchain(true),
       swapchain_image_index(swapchain_index),
@@ -244,8 +267,7 @@ Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageC
       store_device_as_workaround(dev_data.device),  // TODO REMOVE WHEN encoder can be const
       supported_video_profiles(dev_data.video_profile_cache_.Get(
           dev_data.physical_device, vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(pCreateInfo->pNext))) {
-    fragment_encoder =
-        std::unique_ptr<const subresource_adapter::ImageRangeEncoder>(new subresource_adapter::ImageRangeEncoder(*this));
+    fragment_encoder = dev_data.image_range_encoder_cache_.Get(*this);
 
     tracker_.emplace<BindableNoMemoryTracker>(requirements.data());
     SetMemoryTracker(&std::get<BindableNoMemoryTracker>(tracker_));
@@ -349,6 +371,7 @@ void Image::SetInitialLayoutMap() {
         for (; range_gen->non_empty(); ++range_gen) {
             layout_map->insert(layout_map->end(), std::make_pair(*range_gen, create_info.initialLayout));
         }
+        layout_map->Touch();
     }
     // And store in the object
     layout_range_map = std::move(layout_map);
@@ -357,10 +380,19 @@ void Image::SetInitialLayoutMap() {
 void Image::SetImageLayout(const VkImageSubresourceRange &range, VkImageLayout layout) {
     using sparse_container::update_range_value;
     using sparse_container::value_precedence;
-    GlobalImageLayoutRangeMap::RangeGenerator range_gen(subresource_encoder, NormalizeSubresourceRange(range));
+    using subresource_adapter::RangeGenerator;
+    const VkImageSubresourceRange normalized_range = NormalizeSubresourceRange(range);
+    small_vector<subresource_adapter::IndexRange, 16, uint32_t> ranges;
+    ranges.resize(RangeGenerator::MaxRangeCount(subresource_encoder, normalized_range));
+    ranges.resize(RangeGenerator::GenerateRanges(subresource_encoder, normalized_range, ranges.data()));
+
     auto guard = layout_range_map->WriteLock();
-    for (; range_gen->non_empty(); ++range_gen) {
-        update_range_value(*layout_range_map, *range_gen, layout, value_precedence::prefer_source);
+    bool updated = false;
+    for (const auto &index_range : ranges) {
+        updated |= update_range_value(*layout_range_map, index_range, layout, value_precedence::prefer_source);
+    }
+    if (updated) {
+        layout_range_map->Touch();
     }
 }
 
@@ -399,6 +431,23 @@ bool Image::CompareCreateInfo(const Image &other) const {
            (create_info.initialLayout == other.create_info.initialLayout) && valid_queue_family && valid_external;
 }
 
+std::optional<Image::ViewFormatProperties> Image::FindViewFormatProperties(const ViewFormatKey &key) const {
+    std::lock_guard<std::mutex> guard(view_format_properties_lock_);
+    for (const auto &[entry_key, properties] : view_format_properties_) {
+        if (entry_key == key) {
+            return properties;
+        }
+    }
+    return {};
+}
+
+void Image::AddViewFormatProperties(const ViewFormatKey &key, const ViewFormatProperties &properties) {
+    std::lock_guard<std::mutex> guard(view_format_properties_lock_);
+    if (view_format_properties_.size() < kMaxViewFormatProperties) {
+        view_format_properties_.emplace_back(key, properties);
+    }
+}
+
 }  // namespace vvl
 
 static VkSamplerYcbcrConversion GetSamplerConversion(const VkImageViewCreateInfo *ci) {
@@ -654,6 +703,12 @@ void Surface::RemoveParent(StateObject *parent_node) {
     StateObject::RemoveParent(parent_node);
 }
 
+void Surface::RemoveParents(vvl::span<StateObject *const> parent_nodes) {
+    for (StateObject *parent_node : parent_nodes) {
+        RemoveParent(parent_node);
+    }
+}
+
 void Surface::SetQueueSupport(VkPhysicalDevice phys_dev, uint32_t qfi, bool supported) {
     auto guard = Lock();
     assert(phys_dev);
@@ -885,14 +940,32 @@ std::vector<VkPresentModeKHR> Surface::GetCompatibleModes(VkPhysicalDevice phys_
 
 }  // namespace vvl
 
-bool GlobalImageLayoutRangeMap::AnyInRange(RangeGenerator &gen,
-                                           std::function<bool(const key_type &range, const mapped_type &state)> &&func) const {
-    for (; gen->non_empty(); ++gen) {
-        for (auto pos = lower_bound(*gen); (pos != end()) && (gen->intersects(pos->first)); ++pos) {
-            if (func(pos->first, pos->second)) {
-                return true;
-            }
+uint64_t GlobalImageLayoutRangeMap::NextGeneration() {
+    // 0 is never used, it can mean "not validated yet"
+    static std::atomic<uint64_t> generation{0};
+    return generation.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void GlobalImageLayoutRangeMap::UpdateUniformLayout() {
+    // Uniform only if the entries cover every subresource without gaps, all with the same layout
+    VkImageLayout uniform_layout = VK_IMAGE_LAYOUT_MAX_ENUM;
+    index_type next_begin = 0;
+    for (const auto &[range, layout] : *this) {
+        if (range.begin != next_begin || (next_begin != 0 && layout != uniform_layout)) {
+            uniform_layout = VK_IMAGE_LAYOUT_MAX_ENUM;
+            next_begin = 0;
+            break;
         }
+        uniform_layout = layout;
+        next_begin = range.end;
     }
-    return false;
+    if (next_begin != subresource_count_) {
+        uniform_layout = VK_IMAGE_LAYOUT_MAX_ENUM;
+    }
+    uniform_layout_.store(uniform_layout, std::memory_order_release);
+}
+
+bool GlobalImageLayoutRangeMap::AnyInRange(RangeGenerator &gen,
+                                           std::function<bool(const key_type &range, const mapped_type &state)> &&func) const {
+    return AnyInRange<decltype(func) &>(gen, func);
 }
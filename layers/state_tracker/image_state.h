@@ -19,6 +19,8 @@
  */
 #pragma once
 
+#include <mutex>
+#include <optional>
 #include <variant>
 
 #include "state_tracker/device_memory_state.h"
@@ -66,6 +68,66 @@ static inline VkImageSubresourceRange RangeFromLayers(const VkImageSubresourceLa
 
 namespace vvl {
 
+// Properties of an image format that copy, blit and clear validation need for every region, resolved once when the image is
+// created instead of being looked up again per region and per aspect
+struct ImageFormatInfo {
+    static constexpr uint32_t kMaxPlanes = 3;
+
+    VkExtent3D texel_block_extent;
+    uint32_t element_size;
+    uint32_t plane_count;
+    bool is_multiplane;
+    bool is_depth_or_stencil;
+    bool is_compressed;
+    bool is_blocked;
+    // Single plane compatible format and its element size, for each plane of a multi-planar format
+    std::array<VkFormat, kMaxPlanes> plane_formats = {};
+    std::array<uint32_t, kMaxPlanes> plane_element_sizes = {};
+
+    explicit ImageFormatInfo(VkFormat format);
+
+    // Same result as vkuFormatElementSizeWithAspect for the image format
+    uint32_t ElementSizeWithAspect(VkImageAspectFlags aspect) const {
+        if (is_multiplane) {
+            const uint32_t plane = PlaneIndex(aspect);
+            if (plane < plane_count) {
+                return plane_element_sizes[plane];
+            }
+        } else if ((aspect & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) == 0) {
+            return element_size;
+        }
+        return vkuFormatElementSizeWithAspect(format_, static_cast<VkImageAspectFlagBits>(aspect));
+    }
+
+    // Same result as vkuFindMultiplaneCompatibleFormat for the image format
+    VkFormat PlaneFormat(VkImageAspectFlags aspect) const {
+        const uint32_t plane = PlaneIndex(aspect);
+        return (is_multiplane && plane < plane_count) ? plane_formats[plane] : VK_FORMAT_UNDEFINED;
+    }
+
+    // Element size of PlaneFormat(aspect), zero if the aspect is not a plane of the format
+    uint32_t PlaneElementSize(VkImageAspectFlags aspect) const {
+        const uint32_t plane = PlaneIndex(aspect);
+        return (is_multiplane && plane < plane_count) ? plane_element_sizes[plane] : 0;
+    }
+
+  private:
+    static uint32_t PlaneIndex(VkImageAspectFlags aspect) {
+        switch (aspect) {
+            case VK_IMAGE_ASPECT_PLANE_0_BIT:
+                return 0;
+            case VK_IMAGE_ASPECT_PLANE_1_BIT:
+                return 1;
+            case VK_IMAGE_ASPECT_PLANE_2_BIT:
+                return 2;
+            default:
+                return kMaxPlanes;
+        }
+    }
+
+    VkFormat format_;
+};
+
 // State for VkImage objects.
 // Parent -> child relationships in the object usage tree:
 // 1. Normal images:
@@ -92,6 +154,7 @@ class Image : public Bindable {
     bool layout_locked;                        // A front-buffered image that has been presented can never have layout transitioned
     const uint64_t ahb_format;                 // External Android format, if provided
     const VkImageSubresourceRange full_range;  // The normalized ISR for all levels, layers, and aspects
+    const ImageFormatInfo format_info;
     const VkSwapchainKHR create_from_swapchain;
     const bool owned_by_swapchain;
     std::shared_ptr<vvl::Swapchain> bind_swapchain;
@@ -118,7 +181,7 @@ class Image : public Bindable {
 #endif  // VK_USE_PLATFORM_METAL
 
     const image_layout_map::Encoder subresource_encoder;                             // Subresource resolution encoder
-    std::unique_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;  // Fragment resolution encoder
+    std::shared_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;  // Fragment resolution encoder, shared
     const VkDevice store_device_as_workaround;                                       // TODO REMOVE WHEN encoder can be const
 
     std::shared_ptr<GlobalImageLayoutRangeMap> layout_range_map;
@@ -215,12 +278,36 @@ class Image : public Bindable {
         return ::NormalizeSubresourceRange(create_info, range);
     }
 
+    // Tracks the VkSparseImageMemoryBind of images created with VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT, nullptr otherwise
+    BindableSparseImageMemoryTracker *GetSparseResidency() { return std::get_if<BindableSparseImageMemoryTracker>(&tracker_); }
+    const BindableSparseImageMemoryTracker *GetSparseResidency() const {
+        return std::get_if<BindableSparseImageMemoryTracker>(&tracker_);
+    }
+
     void SetInitialLayoutMap();
     void SetImageLayout(const VkImageSubresourceRange &range, VkImageLayout layout);
 
     // This function is only used for comparing Imported External Dedicated Memory
     bool CompareCreateInfo(const Image &other) const;
 
+    // What the driver reports for a view of this image, which only depends on these view create info fields
+    struct ViewFormatKey {
+        VkFormat format;
+        VkImageViewType view_type;
+        VkImageUsageFlags usage;
+
+        bool operator==(const ViewFormatKey &other) const {
+            return format == other.format && view_type == other.view_type && usage == other.usage;
+        }
+    };
+    struct ViewFormatProperties {
+        VkFormatFeatureFlags2KHR format_features;
+        VkFilterCubicImageViewImageFormatPropertiesEXT filter_cubic_props;
+    };
+    // Views are often created and destroyed over and over with the same create info, only the first one queries the driver
+    std::optional<ViewFormatProperties> FindViewFormatProperties(const ViewFormatKey &key) const;
+    void AddViewFormatProperties(const ViewFormatKey &key, const ViewFormatProperties &properties);
+
   protected:
     void NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) override;
 
@@ -242,20 +329,30 @@ class Image : public Bindable {
 
     template <typename UnaryPredicate>
     bool AnyImageAliasOf(const UnaryPredicate &pred) const {
-        // Look for another aliasing image and
-        // ObjectBindings() is thread safe since returns by value, and once
-        // the weak_ptr is successfully locked, the other image state won't
-        // be freed out from under us.
-        for (auto const &memory_state : GetBoundMemoryStates()) {
-            if (AnyAliasBindingOf(memory_state->ObjectBindings(), pred)) return true;
+        // Memory aliases are bound at the same offset of the same memory, see IsCompatibleAliasing()
+        const MEM_BINDING *binding = Binding();
+        if (!binding) {
+            return false;
         }
-        return false;
+        const VkDeviceSize offset = binding->memory_offset;
+        return binding->memory_state->AnyBoundResource(offset, offset + 1, [this, &pred](StateObject &state_object) {
+            if (state_object.Type() != kVulkanObjectTypeImage) {
+                return false;
+            }
+            auto other_image = static_cast<Image *>(&state_object);
+            return (other_image != this) && other_image->IsCompatibleAliasing(this) && pred(*other_image);
+        });
     }
 
   private:
     std::variant<std::monostate, BindableNoMemoryTracker, BindableLinearMemoryTracker, BindableSparseMemoryTracker,
-                 BindableMultiplanarMemoryTracker>
+                 BindableSparseImageMemoryTracker, BindableMultiplanarMemoryTracker>
         tracker_;
+
+    // Views of a given image rarely use more than a couple of create infos
+    static constexpr size_t kMaxViewFormatProperties = 8;
+    mutable std::mutex view_format_properties_lock_;
+    small_vector<std::pair<ViewFormatKey, ViewFormatProperties>, 2> view_format_properties_;
 };
 
 // State for VkImageView objects.
@@ -404,6 +501,7 @@ class Surface : public StateObject {
     void Destroy() override;
 
     void RemoveParent(StateObject *parent_node) override;
+    void RemoveParents(vvl::span<StateObject *const> parent_nodes) override;
 
     void SetQueueSupport(VkPhysicalDevice phys_dev, uint32_t qfi, bool supported);
     bool GetQueueSupport(VkPhysicalDevice phys_dev, uint32_t qfi) const;
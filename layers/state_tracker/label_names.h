@@ -0,0 +1,68 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+// Names of the debug utils labels of a device. Command buffers and queues track labels by id, a name is only looked up when
+// a message reports it. A name keeps its id as long as the device exists.
+class LabelNames {
+  public:
+    // Not the id of any name
+    static constexpr uint32_t kNoLabel = ~uint32_t(0);
+
+    uint32_t GetId(const char *name) {
+        const std::string_view key(name ? name : "");
+        {
+            std::shared_lock<std::shared_mutex> guard(lock_);
+            if (auto it = ids_.find(key); it != ids_.end()) {
+                return it->second;
+            }
+        }
+        std::unique_lock<std::shared_mutex> guard(lock_);
+        if (auto it = ids_.find(key); it != ids_.end()) {
+            return it->second;
+        }
+        const uint32_t id = static_cast<uint32_t>(names_.size());
+        // The deque never moves its strings, the keys can point into them
+        const std::string &stored = names_.emplace_back(key);
+        ids_.emplace(std::string_view(stored), id);
+        return id;
+    }
+
+    const std::string &GetName(uint32_t id) const {
+        std::shared_lock<std::shared_mutex> guard(lock_);
+        return names_[id];
+    }
+
+  private:
+    mutable std::shared_mutex lock_;
+    std::deque<std::string> names_;
+    vvl::unordered_map<std::string_view, uint32_t, std::hash<std::string_view>> ids_;
+};
+
+}  // namespace vvl
@@ -187,19 +187,29 @@ static uint32_t GetCreateInfoShaders(const Pipeline &pipe_state) {
     return result;
 }
 
-static uint32_t GetLinkingShaders(const VkPipelineLibraryCreateInfoKHR *link_info, const ValidationStateTracker &state_data) {
-    uint32_t result = 0;
+static std::vector<std::shared_ptr<const vvl::Pipeline>> GetLibraryStates(const VkPipelineLibraryCreateInfoKHR *link_info,
+                                                                            const ValidationStateTracker &state_data) {
+    std::vector<std::shared_ptr<const vvl::Pipeline>> result;
     if (link_info) {
+        result.reserve(link_info->libraryCount);
         for (uint32_t i = 0; i < link_info->libraryCount; ++i) {
-            const auto &state = state_data.Get<vvl::Pipeline>(link_info->pLibraries[i]);
+            auto state = state_data.Get<vvl::Pipeline>(link_info->pLibraries[i]);
             if (state) {
-                result |= state->active_shaders;
+                result.emplace_back(std::move(state));
             }
         }
     }
     return result;
 }
 
+static uint32_t GetLinkingShaders(const std::vector<std::shared_ptr<const vvl::Pipeline>> &library_states) {
+    uint32_t result = 0;
+    for (const auto &state : library_states) {
+        result |= state->active_shaders;
+    }
+    return result;
+}
+
 static CBDynamicFlags GetGraphicsDynamicState(Pipeline &pipe_state) {
     CBDynamicFlags flags = 0;
 
@@ -436,13 +446,10 @@ static bool UsesPipelineVertexRobustness(const void *pNext, const Pipeline &pipe
     return result;
 }
 
-static bool IgnoreColorAttachments(const ValidationStateTracker &state_data, Pipeline &pipe_state) {
+static bool IgnoreColorAttachments(Pipeline &pipe_state) {
     // If the libraries used to create this pipeline are ignoring color attachments, this pipeline should as well
-    if (pipe_state.library_create_info) {
-        for (uint32_t i = 0; i < pipe_state.library_create_info->libraryCount; i++) {
-            const auto lib = state_data.Get<vvl::Pipeline>(pipe_state.library_create_info->pLibraries[i]);
-            if (lib->ignore_color_attachments) return true;
-        }
+    for (const auto &lib : pipe_state.library_states) {
+        if (lib->ignore_color_attachments) return true;
     }
     // According to the spec, pAttachments is to be ignored if the pipeline is created with
     // VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT, VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT, VK_DYNAMIC_STATE_COLOR_BLEND_ADVANCED_EXT
@@ -526,7 +533,7 @@ std::shared_ptr<VertexInputState> Pipeline::CreateVertexInputState(const Pipelin
     }
 
     if (p.library_create_info) {
-        auto ss = GetLibSubState<VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT>(state, *p.library_create_info);
+        auto ss = GetLibSubState<VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT>(p.library_states);
         if (ss) {
             return ss;
         }
@@ -550,7 +557,7 @@ std::shared_ptr<PreRasterState> Pipeline::CreatePreRasterState(
     }
 
     if (p.library_create_info) {
-        auto ss = GetLibSubState<VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT>(state, *p.library_create_info);
+        auto ss = GetLibSubState<VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT>(p.library_states);
         if (ss) {
             return ss;
         }
@@ -576,7 +583,7 @@ std::shared_ptr<FragmentShaderState> Pipeline::CreateFragmentShaderState(
     }
 
     if (p.library_create_info) {
-        auto ss = GetLibSubState<VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT>(state, *p.library_create_info);
+        auto ss = GetLibSubState<VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT>(p.library_states);
         if (ss && EnablesRasterizationStates(p.pre_raster_state)) {
             return ss;
         }
@@ -608,7 +615,7 @@ std::shared_ptr<FragmentOutputState> Pipeline::CreateFragmentOutputState(
     }
 
     if (p.library_create_info) {
-        auto ss = GetLibSubState<VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT>(state, *p.library_create_info);
+        auto ss = GetLibSubState<VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT>(p.library_states);
         // If this pipeline is linking in a library that contains FO state, check to see if the FO state is valid before creating it
         // for this pipeline
         if (ss && EnablesRasterizationStates(p.pre_raster_state)) {
@@ -696,6 +703,7 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkGraphicsPip
       pipeline_cache(std::move(pipe_cache)),
       rendering_create_info(vku::FindStructInPNextChain<VkPipelineRenderingCreateInfo>(GraphicsCreateInfo().pNext)),
       library_create_info(vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(GraphicsCreateInfo().pNext)),
+      library_states(GetLibraryStates(library_create_info, state_data)),
       graphics_lib_type(GetGraphicsLibType(GraphicsCreateInfo())),
       pipeline_type(VK_PIPELINE_BIND_POINT_GRAPHICS),
       create_flags(GetPipelineCreateFlags(GraphicsCreateInfo().pNext, GraphicsCreateInfo().flags)),
@@ -708,17 +716,16 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkGraphicsPip
       fragment_output_state(CreateFragmentOutputState(*this, state_data, *pCreateInfo, GraphicsCreateInfo(), rpstate)),
       stage_states(GetStageStates(state_data, *this, stateless_data)),
       create_info_shaders(GetCreateInfoShaders(*this)),
-      linking_shaders(GetLinkingShaders(library_create_info, state_data)),
+      linking_shaders(GetLinkingShaders(library_states)),
       active_shaders(create_info_shaders | linking_shaders),
       fragmentShader_writable_output_location_list(GetFSOutputLocations(stage_states)),
-      active_slots(GetActiveSlots(stage_states)),
-      max_active_slot(GetMaxActiveSlot(active_slots)),
       dynamic_state(GetGraphicsDynamicState(*this)),
       topology_at_rasterizer(GetTopologyAtRasterizer(*this)),
       descriptor_buffer_mode((create_flags & VK_PIPELINE_CREATE_2_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(GraphicsCreateInfo().pNext, *this)),
       uses_pipeline_vertex_robustness(UsesPipelineVertexRobustness(GraphicsCreateInfo().pNext, *this)),
-      ignore_color_attachments(IgnoreColorAttachments(state_data, *this)) {
+      ignore_color_attachments(IgnoreColorAttachments(*this)),
+      active_slot_map_cache_(state_data.active_slot_map_cache_) {
     if (library_create_info) {
         const auto &exe_layout_state = state_data.Get<vvl::PipelineLayout>(GraphicsCreateInfo().layout);
         const auto *exe_layout = exe_layout_state.get();
@@ -733,13 +740,8 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkGraphicsPip
         layouts[2] = pre_raster_layout;
         merged_graphics_layout = std::make_shared<vvl::PipelineLayout>(layouts);
 
-        // TODO Could store the graphics_lib_type in the sub-state rather than searching for it again here.
-        //      Or, could store a pointer back to the owning Pipeline.
-        for (uint32_t i = 0; i < library_create_info->libraryCount; ++i) {
-            const auto &state = state_data.Get<vvl::Pipeline>(library_create_info->pLibraries[i]);
-            if (state) {
-                graphics_lib_type |= state->graphics_lib_type;
-            }
+        for (const auto &state : library_states) {
+            graphics_lib_type |= state->graphics_lib_type;
         }
     }
 }
@@ -757,14 +759,13 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkComputePipe
       stage_states(GetStageStates(state_data, *this, stateless_data)),
       create_info_shaders(GetCreateInfoShaders(*this)),
       active_shaders(create_info_shaders),  // compute has no linking shaders
-      active_slots(GetActiveSlots(stage_states)),
-      max_active_slot(GetMaxActiveSlot(active_slots)),
       dynamic_state(0),  // compute has no dynamic state
       descriptor_buffer_mode((create_flags & VK_PIPELINE_CREATE_2_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(ComputeCreateInfo().pNext, *this)),
       uses_pipeline_vertex_robustness(false),
-      ignore_color_attachments(IgnoreColorAttachments(state_data, *this)),
-      merged_graphics_layout(layout) {
+      ignore_color_attachments(IgnoreColorAttachments(*this)),
+      merged_graphics_layout(layout),
+      active_slot_map_cache_(state_data.active_slot_map_cache_) {
     assert(active_shaders == VK_SHADER_STAGE_COMPUTE_BIT);
 }
 
@@ -782,14 +783,13 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkRayTracingP
       stage_states(GetStageStates(state_data, *this, stateless_data)),
       create_info_shaders(GetCreateInfoShaders(*this)),
       active_shaders(create_info_shaders),  // RTX has no linking shaders
-      active_slots(GetActiveSlots(stage_states)),
-      max_active_slot(GetMaxActiveSlot(active_slots)),
       dynamic_state(GetRayTracingDynamicState(*this)),
       descriptor_buffer_mode((RayTracingCreateInfo().flags & VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(RayTracingCreateInfo().pNext, *this)),
       uses_pipeline_vertex_robustness(false),
-      ignore_color_attachments(IgnoreColorAttachments(state_data, *this)),
-      merged_graphics_layout(std::move(layout)) {
+      ignore_color_attachments(IgnoreColorAttachments(*this)),
+      merged_graphics_layout(std::move(layout)),
+      active_slot_map_cache_(state_data.active_slot_map_cache_) {
     assert(0 == (active_shaders & ~(kShaderStageAllRayTracing)));
 }
 
@@ -807,17 +807,49 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkRayTracingP
       stage_states(GetStageStates(state_data, *this, stateless_data)),
       create_info_shaders(GetCreateInfoShaders(*this)),
       active_shaders(create_info_shaders),  // RTX has no linking shaders
-      active_slots(GetActiveSlots(stage_states)),
-      max_active_slot(GetMaxActiveSlot(active_slots)),
       dynamic_state(GetRayTracingDynamicState(*this)),
       descriptor_buffer_mode((RayTracingCreateInfo().flags & VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(RayTracingCreateInfo().pNext, *this)),
       uses_pipeline_vertex_robustness(false),
-      ignore_color_attachments(IgnoreColorAttachments(state_data, *this)),
-      merged_graphics_layout(std::move(layout)) {
+      ignore_color_attachments(IgnoreColorAttachments(*this)),
+      merged_graphics_layout(std::move(layout)),
+      active_slot_map_cache_(state_data.active_slot_map_cache_) {
     assert(0 == (active_shaders & ~(kShaderStageAllRayTracing)));
 }
 
+const ActiveSlotMap &Pipeline::ActiveSlots() const {
+    std::call_once(active_slots_once_, [this]() {
+        active_slots_ = active_slot_map_cache_.Get(stage_states);
+        max_active_slot_ = GetMaxActiveSlot(*active_slots_);
+    });
+    return *active_slots_;
+}
+
+uint32_t Pipeline::MaxActiveSlot() const {
+    ActiveSlots();
+    return max_active_slot_;
+}
+
+const std::vector<Pipeline::ResourceAccess> &Pipeline::AccessedResources() const {
+    std::call_once(accessed_resources_once_, [this]() {
+        for (const auto &stage_state : stage_states) {
+            if (!stage_state.entrypoint) {
+                continue;
+            }
+            const VkShaderStageFlagBits stage = stage_state.GetStage();
+            if (stage == VK_SHADER_STAGE_FRAGMENT_BIT && RasterizationDisabled()) {
+                continue;
+            }
+            for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
+                if (variable.IsAccessed()) {
+                    accessed_resources_.emplace_back(ResourceAccess{stage, &variable});
+                }
+            }
+        }
+    });
+    return accessed_resources_;
+}
+
 }  // namespace vvl
 
 void LastBound::UnbindAndResetPushDescriptorSet(std::shared_ptr<vvl::DescriptorSet> &&ds) {
@@ -842,6 +874,17 @@ void LastBound::Reset() {
     }
     push_descriptor_set.reset();
     per_set.clear();
+    validated_action_state = {};
+}
+
+uint64_t LastBound::GetDescriptorChangeCount() const {
+    uint64_t change_count = 0;
+    for (const auto &set_info : per_set) {
+        if (set_info.bound_descriptor_set) {
+            change_count += set_info.bound_descriptor_set->GetChangeCount();
+        }
+    }
+    return change_count;
 }
 
 bool LastBound::IsDepthTestEnable() const {
@@ -17,6 +17,8 @@
  * limitations under the License.
  */
 #pragma once
+#include <atomic>
+#include <mutex>
 #include <variant>
 
 #include <vulkan/utility/vk_safe_struct.hpp>
@@ -87,6 +89,9 @@ class Pipeline : public StateObject {
     // Create Info values saved for fast access later
     const VkPipelineRenderingCreateInfo *rendering_create_info = nullptr;
     const VkPipelineLibraryCreateInfoKHR *library_create_info = nullptr;
+    // The pipelines of library_create_info, looked up once when linking. Their sub-states are shared, not copied, and holding
+    // them keeps the sub-states' parent alive if the application destroys a library after linking it.
+    const std::vector<std::shared_ptr<const vvl::Pipeline>> library_states;
     VkGraphicsPipelineLibraryFlagsEXT graphics_lib_type = static_cast<VkGraphicsPipelineLibraryFlagsEXT>(0);
     VkPipelineBindPoint pipeline_type;
     VkPipelineCreateFlags2KHR create_flags;
@@ -116,11 +121,18 @@ class Pipeline : public StateObject {
 
     const vvl::unordered_set<uint32_t> fragmentShader_writable_output_location_list;
 
-    // NOTE: this map is 'almost' const and used in performance critical code paths.
-    // The values of existing entries in the samplers_used_by_image map
-    // are updated at various times. Locking requirements are TBD.
-    const ActiveSlotMap active_slots;
-    const uint32_t max_active_slot = 0;  // the highest set number in active_slots for pipeline layout compatibility checks
+    // Built the first time it is needed, many pipelines are created and never bound. Pipelines with the same entry points share it.
+    const ActiveSlotMap &ActiveSlots() const;
+    uint32_t MaxActiveSlot() const;  // the highest set number in ActiveSlots() for pipeline layout compatibility checks
+
+    // A descriptor variable the shader of a stage statically accesses
+    struct ResourceAccess {
+        VkShaderStageFlagBits stage;
+        const spirv::ResourceInterfaceVariable *variable;
+    };
+    // The accessed descriptor variables of all stages, for the checks done at each draw or dispatch. Variables that are never
+    // accessed, and the fragment shader when rasterization is disabled, are left out. Built the first time it is needed.
+    const std::vector<ResourceAccess> &AccessedResources() const;
 
     // Which state is dynamic from pipeline creation, factors in GPL sub state as well
     CBDynamicFlags dynamic_state;
@@ -144,6 +156,12 @@ class Pipeline : public StateObject {
         // When we instrument GPL at link time, we need to hold the new libraries until they are done
         VkPipeline pre_raster_lib = VK_NULL_HANDLE;
         VkPipeline frag_out_lib = VK_NULL_HANDLE;
+        // With lazy instrumentation the instrumented copy of the pipeline is only created the first time the pipeline is bound
+        bool lazy_instrumentation = false;
+        bool lazy_instrumentation_done = false;
+        VkPipeline lazy_instrumented_pipeline = VK_NULL_HANDLE;
+        // Number of submitted command buffers binding the lazily instrumented pipeline that found no error
+        std::atomic<uint32_t> clean_submit_count{0};
     } instrumentation_data;
 
     // Executable or legacy pipeline
@@ -213,11 +231,10 @@ class Pipeline : public StateObject {
     std::shared_ptr<const vvl::ShaderModule> GetSubStateShader(VkShaderStageFlagBits state) const;
 
     template <VkGraphicsPipelineLibraryFlagBitsEXT type_flag>
-    static inline typename SubStateTraits<type_flag>::type GetLibSubState(const ValidationStateTracker &state,
-                                                                          const VkPipelineLibraryCreateInfoKHR &link_info) {
-        for (uint32_t i = 0; i < link_info.libraryCount; ++i) {
-            const auto lib_state = state.Get<vvl::Pipeline>(link_info.pLibraries[i]);
-            if (lib_state && ((lib_state->graphics_lib_type & type_flag) != 0)) {
+    static inline typename SubStateTraits<type_flag>::type GetLibSubState(
+        const std::vector<std::shared_ptr<const vvl::Pipeline>> &library_states) {
+        for (const auto &lib_state : library_states) {
+            if ((lib_state->graphics_lib_type & type_flag) != 0) {
                 return GetSubState<type_flag>(*lib_state);
             }
         }
@@ -607,6 +624,14 @@ class Pipeline : public StateObject {
 
     // Merged layouts
     std::shared_ptr<const vvl::PipelineLayout> merged_graphics_layout;
+
+  private:
+    ActiveSlotMapCache &active_slot_map_cache_;
+    mutable std::once_flag active_slots_once_;
+    mutable std::shared_ptr<const ActiveSlotMap> active_slots_;
+    mutable uint32_t max_active_slot_ = 0;
+    mutable std::once_flag accessed_resources_once_;
+    mutable std::vector<ResourceAccess> accessed_resources_;
 };
 
 template <>
@@ -678,13 +703,14 @@ struct LastBound {
         uint32_t index = 0;
         VkDeviceSize offset = 0;
     };
+    using DynamicOffsets = small_vector<uint32_t, 4>;
     // Ordered bound set tracking where index is set# that given set is bound to
     struct PER_SET {
         std::shared_ptr<vvl::DescriptorSet> bound_descriptor_set;
         std::optional<DescriptorBufferBinding> bound_descriptor_buffer;
 
-        // one dynamic offset per dynamic descriptor bound to this CB
-        std::vector<uint32_t> dynamicOffsets;
+        // one dynamic offset per dynamic descriptor bound to this CB, sets rarely have more than a few dynamic descriptors
+        DynamicOffsets dynamicOffsets;
         PipelineLayoutCompatId compat_id_for_set{0};
 
         // Cache most recently validated descriptor state for ValidateActionState/UpdateDrawState
@@ -701,6 +727,23 @@ struct LastBound {
 
     std::vector<PER_SET> per_set;
 
+    // The last action command that was validated without logging anything. A later action command of the same kind can skip
+    // ValidateActionState if none of these changed, since that would report nothing again.
+    struct ValidatedActionState {
+        vvl::Func command = vvl::Func::Empty;
+        uint64_t bound_state_generation = 0;
+        uint64_t image_layout_change_count = 0;
+        uint64_t descriptor_change_count = 0;
+
+        bool operator==(const ValidatedActionState &other) const {
+            return command == other.command && bound_state_generation == other.bound_state_generation &&
+                   image_layout_change_count == other.image_layout_change_count &&
+                   descriptor_change_count == other.descriptor_change_count;
+        }
+    };
+    // Written during validation, which already requires the command buffer to be externally synchronized
+    mutable ValidatedActionState validated_action_state;
+
     void Reset();
 
     void UnbindAndResetPushDescriptorSet(std::shared_ptr<vvl::DescriptorSet> &&ds);
@@ -749,6 +792,8 @@ struct LastBound {
     bool IsBoundSetCompatible(uint32_t set, const vvl::ShaderObject &shader_object_state) const;
     std::string DescribeNonCompatibleSet(uint32_t set, const vvl::PipelineLayout &pipeline_layout) const;
     std::string DescribeNonCompatibleSet(uint32_t set, const vvl::ShaderObject &shader_object_state) const;
+    // Sum of the change counts of the bound descriptor sets, changes whenever one of them is updated
+    uint64_t GetDescriptorChangeCount() const;
 
     const spirv::EntryPoint *GetFragmentEntryPoint() const;
 };
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "containers/index_map.h"
 #include "state_tracker/pipeline_layout_state.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include <vulkan/utility/vk_struct_helper.hpp>
@@ -81,7 +82,7 @@ struct VertexBindingState {
     uint32_t index;
     vku::safe_VkVertexInputBindingDescription2EXT desc;
     // Attributes for this binding, key is the location
-    vvl::unordered_map<uint32_t, VertexAttrState> locations;
+    vvl::IndexMap<VertexAttrState> locations;
 };
 
 struct VertexInputState : public PipelineSubState {
@@ -91,7 +92,7 @@ struct VertexInputState : public PipelineSubState {
     vku::safe_VkPipelineInputAssemblyStateCreateInfo *input_assembly_state = nullptr;
 
     // key is binding number
-    vvl::unordered_map<uint32_t, VertexBindingState> bindings;
+    vvl::IndexMap<VertexBindingState> bindings;
 
     std::shared_ptr<VertexInputState> FromCreateInfo(const ValidationStateTracker &state,
                                                      const vku::safe_VkGraphicsPipelineCreateInfo &create_info);
@@ -18,6 +18,7 @@
  * limitations under the License.
  */
 #pragma once
+#include <algorithm>
 #include "state_tracker/state_object.h"
 
 enum QueryState {
@@ -47,35 +48,34 @@ class QueryPool : public StateObject {
           perf_counter_queue_family_index(perf_queue_family_index),
           supported_video_profile(std::move(supp_video_profile)),
           video_encode_feedback_flags(enabled_video_encode_feedback_flags),
-          query_states_(pCreateInfo->queryCount) {
-        for (uint32_t i = 0; i < pCreateInfo->queryCount; ++i) {
-            auto perf_size = n_perf_pass > 0 ? n_perf_pass : 1;
-            query_states_[i].reserve(perf_size);
-            for (uint32_t p = 0; p < perf_size; p++) {
-                query_states_[i].emplace_back(QUERYSTATE_UNKNOWN);
-            }
-        }
-    }
+          perf_pass_count_(n_perf_pass > 0 ? n_perf_pass : 1),
+          query_states_(size_t(pCreateInfo->queryCount) * perf_pass_count_, QUERYSTATE_UNKNOWN) {}
 
     VkQueryPool VkHandle() const { return handle_.Cast<VkQueryPool>(); }
 
-    void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) {
+    void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) { SetQueryStates(query, 1, perf_pass, state); }
+    // Resetting a query resets it for every pass. The range is clamped to the pool.
+    void SetQueryStates(uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) {
         auto guard = WriteLock();
-        assert(query < query_states_.size());
-        assert((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes));
+        assert(perf_pass < perf_pass_count_);
+        if (first_query >= create_info.queryCount || perf_pass >= perf_pass_count_) {
+            return;
+        }
+        query_count = std::min(query_count, create_info.queryCount - first_query);
+        auto first = query_states_.begin() + size_t(first_query) * perf_pass_count_;
         if (state == QUERYSTATE_RESET) {
-            for (auto &state : query_states_[query]) {
-                state = QUERYSTATE_RESET;
-            }
+            std::fill(first, first + size_t(query_count) * perf_pass_count_, QUERYSTATE_RESET);
         } else {
-            query_states_[query][perf_pass] = state;
+            for (uint32_t i = 0; i < query_count; ++i) {
+                first[size_t(i) * perf_pass_count_ + perf_pass] = state;
+            }
         }
     }
     QueryState GetQueryState(uint32_t query, uint32_t perf_pass) const {
         auto guard = ReadLock();
         // this method can get called with invalid arguments during validation
-        if (query < query_states_.size() && ((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes))) {
-            return query_states_[query][perf_pass];
+        if (query < create_info.queryCount && perf_pass < perf_pass_count_) {
+            return query_states_[size_t(query) * perf_pass_count_ + perf_pass];
         }
         return QUERYSTATE_UNKNOWN;
     }
@@ -96,7 +96,9 @@ class QueryPool : public StateObject {
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
-    std::vector<small_vector<QueryState, 1, uint32_t>> query_states_;
+    const uint32_t perf_pass_count_;
+    // The states of all the passes of a query are next to each other
+    std::vector<QueryState> query_states_;
     mutable std::shared_mutex lock_;
 };
 }  // namespace vvl
@@ -18,6 +18,8 @@
  */
 #include "state_tracker/queue_state.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "state_tracker/state_tracker.h"
+#include "utils/thread_pool.h"
 
 void vvl::QueueSubmission::BeginUse() {
     for (auto &wait : wait_semaphores) {
@@ -87,9 +89,10 @@ vvl::PreSubmitResult vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&s
         {
             auto guard = Lock();
             submissions_.emplace_back(std::move(submission));
-            if (!thread_) {
-                thread_ = std::make_unique<std::thread>(&Queue::ThreadFunc, this);
+            if (!retire_pool_) {
+                retire_pool_ = dev_data_.queue_retire_pool;
             }
+            ScheduleRetire();
         }
     }
     return result;
@@ -103,7 +106,7 @@ void vvl::Queue::Notify(uint64_t until_seq) {
     if (request_seq_ < until_seq) {
         request_seq_ = until_seq;
     }
-    cond_.notify_one();
+    ScheduleRetire();
 }
 
 void vvl::Queue::Wait(const Location &loc, uint64_t until_seq) {
@@ -160,16 +163,11 @@ std::optional<vvl::SemaphoreInfo> vvl::Queue::FindTimelineWaitWithoutResolvingSi
 }
 
 void vvl::Queue::Destroy() {
-    std::unique_ptr<std::thread> dead_thread;
     {
         auto guard = Lock();
-        exit_thread_ = true;
-        cond_.notify_all();
-        dead_thread = std::move(thread_);
-    }
-    if (dead_thread && dead_thread->joinable()) {
-        dead_thread->join();
-        dead_thread.reset();
+        exit_ = true;
+        // The retire task stops at the next submission, it must not touch this queue after Destroy returns
+        cond_.wait(guard, [this] { return !retire_scheduled_; });
     }
     StateObject::Destroy();
 }
@@ -181,31 +179,43 @@ void vvl::Queue::PostSubmit() {
     }
 }
 
-vvl::QueueSubmission *vvl::Queue::NextSubmission() {
-    QueueSubmission *result = nullptr;
-    // Find if the next submission is ready so that the thread function doesn't need to worry
+// Must be called with lock_ held
+void vvl::Queue::ScheduleRetire() {
+    if (retire_scheduled_ || exit_ || submissions_.empty() || request_seq_ < submissions_.front().seq) {
+        return;
+    }
+    retire_scheduled_ = true;
+    retire_pool_->Post([this]() { RetireReadySubmissions(); });
+}
+
+bool vvl::Queue::NextSubmissions(std::vector<QueueSubmission *> &ready) {
+    // Collect all the submissions that are ready so that the retire task doesn't need to worry
     // about locking.
+    ready.clear();
     auto guard = Lock();
-    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front().seq)) {
-        // The queue thread must wait forever if nothing is happening, until we tell it to exit
-        cond_.wait(guard);
+    if (exit_ || submissions_.empty() || request_seq_ < submissions_.front().seq) {
+        // Nothing to do until the next Notify(), which posts a new retire task
+        retire_scheduled_ = false;
+        cond_.notify_all();
+        return false;
     }
-    if (!exit_thread_) {
-        result = &submissions_.front();
-        // NOTE: the submission must remain on the dequeue until we're done processing it so that
-        // anyone waiting for it can find the correct waiter
+    // NOTE: the submissions must remain on the dequeue until we're done processing them so that
+    // anyone waiting for them can find the correct waiter. Submitting more does not move them.
+    for (QueueSubmission &submission : submissions_) {
+        if (submission.seq > request_seq_) {
+            break;
+        }
+        ready.emplace_back(&submission);
     }
-    return result;
+    return true;
 }
 
 void vvl::Queue::Retire(QueueSubmission &submission) {
-    auto is_query_updated_after = [this](const QueryObject &query_object) {
+    auto is_query_updated_after = [this, retired_seq = submission.seq](const QueryObject &query_object) {
         auto guard = this->Lock();
-        bool first = true;
         for (const auto &submission : this->submissions_) {
-            // The current submission is still on the deque, so skip it
-            if (first) {
-                first = false;
+            // The submissions of the batch being retired are still on the deque, so skip them
+            if (submission.seq <= retired_seq) {
                 continue;
             }
             for (const auto &next_cb_state : submission.cbs) {
@@ -240,25 +250,31 @@ void vvl::Queue::Retire(QueueSubmission &submission) {
     }
 }
 
-void vvl::Queue::ThreadFunc() {
-    QueueSubmission *submission = nullptr;
-
-    // Roll this queue forward, one submission at a time.
-    while (true) {
-        submission = NextSubmission();
-        if (submission == nullptr) {
-            break;
-        }
+void vvl::Queue::RetireBatch(vvl::span<QueueSubmission *const> submissions) {
+    for (QueueSubmission *submission : submissions) {
         Retire(*submission);
-        // wake up anyone waiting for this submission to be retired
+    }
+}
+
+// Runs on the retire pool
+void vvl::Queue::RetireReadySubmissions() {
+    std::vector<QueueSubmission *> ready;
+    std::vector<std::promise<void>> completed;
+
+    // Roll this queue forward, all the ready submissions at a time.
+    while (NextSubmissions(ready)) {
+        RetireBatch(ready);
+        // wake up anyone waiting for these submissions to be retired
+        completed.clear();
         {
-            std::promise<void> completed;
-            {
-                auto guard = Lock();
-                completed = std::move(submission->completed);
+            auto guard = Lock();
+            for (size_t i = 0; i < ready.size(); ++i) {
+                completed.emplace_back(std::move(submissions_.front().completed));
                 submissions_.pop_front();
             }
-            completed.set_value();
+        }
+        for (std::promise<void> &promise : completed) {
+            promise.set_value();
         }
     }
 }
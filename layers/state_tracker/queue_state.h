@@ -19,6 +19,7 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "state_tracker/fence_state.h"
+#include "state_tracker/label_names.h"
 #include "state_tracker/semaphore_state.h"
 #include <condition_variable>
 #include <deque>
@@ -31,6 +32,7 @@ class ValidationStateTracker;
 
 namespace vvl {
 
+class ThreadPool;
 class CommandBuffer;
 class Queue;
 
@@ -38,9 +40,10 @@ struct QueueSubmission {
     QueueSubmission(const Location &loc_) : loc(loc_), completed(), waiter(completed.get_future()) {}
 
     bool end_batch{false};
-    std::vector<std::shared_ptr<vvl::CommandBuffer>> cbs;
-    std::vector<SemaphoreInfo> wait_semaphores;
-    std::vector<SemaphoreInfo> signal_semaphores;
+    // Most submissions have a few command buffers and semaphores, inline storage avoids allocating them on every submit
+    small_vector<std::shared_ptr<vvl::CommandBuffer>, 4> cbs;
+    small_vector<SemaphoreInfo, 2> wait_semaphores;
+    small_vector<SemaphoreInfo, 2> signal_semaphores;
     std::shared_ptr<Fence> fence;
     LocationCapture loc;
     uint64_t seq{0};
@@ -99,11 +102,11 @@ class Queue : public StateObject {
     // called from the various PostCallRecordQueueSubmit() methods
     void PostSubmit();
 
-    // Tell the queue thread that submissions up to and including the submission with
+    // Tell the retire pool that submissions up to and including the submission with
     // sequence number until_seq have finished. kU64Max means to finish all submissions.
     void Notify(uint64_t until_seq = kU64Max);
 
-    // Wait for the queue thread to finish processing submissions with sequence numbers
+    // Wait for the retire pool to finish processing submissions with sequence numbers
     // up to and including until_seq. kU64Max means to finish all submissions.
     void Wait(const Location &loc, uint64_t until_seq = kU64Max);
 
@@ -124,13 +127,13 @@ class Queue : public StateObject {
     const VkDeviceQueueCreateFlags create_flags;
     const VkQueueFamilyProperties queue_family_properties;
 
-    // Track command buffer label stack accross all command buffers submitted to this queue.
-    // Access to this variable relies on external queue synchronization.
-    std::vector<std::string> cmdbuf_label_stack;
+    // Track command buffer label stack accross all command buffers submitted to this queue, as ids in
+    // ValidationStateTracker::label_names. Access to this variable relies on external queue synchronization.
+    std::vector<uint32_t> cmdbuf_label_stack;
 
     // Track the last closed label. It is used in the error messages to help locate unbalanced vkCmdEndDebugUtilsLabelEXT command.
     // Access to this variable relies on external queue synchronization.
-    std::string last_closed_cmdbuf_label;
+    uint32_t last_closed_cmdbuf_label = LabelNames::kNoLabel;
 
     // Stop per-queue label tracking after the first label mismatch error.
     // Access to this variable relies on external queue synchronization.
@@ -139,29 +142,35 @@ class Queue : public StateObject {
   protected:
     // called from the various PostCallRecordQueueSubmit() methods
     virtual void PostSubmit(QueueSubmission &submission) {}
-    // called when the worker thread decides a submissions has finished executing
+    // called when the retire pool decides a submissions has finished executing
     virtual void Retire(QueueSubmission &submission);
+    // called with all the submissions that finished since the last call, in order. The default retires them one by one,
+    // overrides can do what only depends on the last one once.
+    virtual void RetireBatch(vvl::span<QueueSubmission *const> submissions);
 
   private:
     uint32_t timeline_wait_count_ = 0;
 
   private:
     using LockGuard = std::unique_lock<std::mutex>;
-    void ThreadFunc();
-    QueueSubmission *NextSubmission();
+    void ScheduleRetire();
+    void RetireReadySubmissions();
+    bool NextSubmissions(std::vector<QueueSubmission *> &ready);
     LockGuard Lock() const { return LockGuard(lock_); }
 
     ValidationStateTracker &dev_data_;
 
     // state related to submitting to the queue, all data members must
     // be accessed with lock_ held
-    std::unique_ptr<std::thread> thread_;
+    std::shared_ptr<ThreadPool> retire_pool_;
     std::deque<QueueSubmission> submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
-    bool exit_thread_{false};
+    // At most one retire task per queue is on the pool at a time, which keeps the submissions retiring in order
+    bool retire_scheduled_{false};
+    bool exit_{false};
     mutable std::mutex lock_;
-    // condition to wake up the queue's thread
+    // signaled when the retire task of this queue returns
     std::condition_variable cond_;
 };
 }  // namespace vvl
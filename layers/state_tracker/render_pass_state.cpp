@@ -267,14 +267,90 @@ static void InitRenderPassState(vvl::RenderPass *render_pass) {
     attachment_tracker.FinalTransitions();
 }
 
+// Calls func(attachment, subpass, index, type) for every attachment reference, in the order of AttachmentUsageIndex::Uses()
+template <typename Func>
+static void ForEachAttachmentReference(const VkRenderPassCreateInfo2 &create_info, Func &&func) {
+    using Type = vvl::AttachmentUsageIndex::Type;
+    for (uint32_t subpass_index = 0; subpass_index < create_info.subpassCount; ++subpass_index) {
+        const VkSubpassDescription2 &subpass = create_info.pSubpasses[subpass_index];
+        for (uint32_t i = 0; i < subpass.colorAttachmentCount; ++i) {
+            func(subpass.pColorAttachments[i].attachment, subpass_index, i, Type::kColor);
+        }
+        if (subpass.pResolveAttachments) {
+            for (uint32_t i = 0; i < subpass.colorAttachmentCount; ++i) {
+                func(subpass.pResolveAttachments[i].attachment, subpass_index, i, Type::kResolve);
+            }
+        }
+        for (uint32_t i = 0; i < subpass.inputAttachmentCount; ++i) {
+            func(subpass.pInputAttachments[i].attachment, subpass_index, i, Type::kInput);
+        }
+        if (subpass.pDepthStencilAttachment) {
+            func(subpass.pDepthStencilAttachment->attachment, subpass_index, 0, Type::kDepthStencil);
+        }
+        const auto *ds_resolve = vku::FindStructInPNextChain<VkSubpassDescriptionDepthStencilResolve>(subpass.pNext);
+        if (ds_resolve && ds_resolve->pDepthStencilResolveAttachment) {
+            func(ds_resolve->pDepthStencilResolveAttachment->attachment, subpass_index, 0, Type::kDepthStencilResolve);
+        }
+        for (uint32_t i = 0; i < subpass.preserveAttachmentCount; ++i) {
+            func(subpass.pPreserveAttachments[i], subpass_index, i, Type::kPreserve);
+        }
+        const auto *fsr = vku::FindStructInPNextChain<VkFragmentShadingRateAttachmentInfoKHR>(subpass.pNext);
+        if (fsr && fsr->pFragmentShadingRateAttachment) {
+            func(fsr->pFragmentShadingRateAttachment->attachment, subpass_index, 0, Type::kFragmentShadingRate);
+        }
+    }
+}
+
 namespace vvl {
 
+AttachmentUsageIndex::AttachmentUsageIndex(const VkRenderPassCreateInfo2 &create_info)
+    : offsets_(create_info.attachmentCount + 1, 0) {
+    const uint32_t attachment_count = create_info.attachmentCount;
+    // Count the uses of each attachment first, so they can be stored next to each other without a container per attachment
+    ForEachAttachmentReference(create_info, [&](uint32_t attachment, uint32_t, uint32_t, Type) {
+        if (attachment < attachment_count) {
+            ++offsets_[attachment + 1];
+        }
+    });
+    for (uint32_t i = 0; i < attachment_count; ++i) {
+        offsets_[i + 1] += offsets_[i];
+    }
+    uses_.resize(offsets_[attachment_count]);
+
+    std::vector<uint32_t> next_use(offsets_.begin(), offsets_.end() - 1);
+    ForEachAttachmentReference(create_info, [&](uint32_t attachment, uint32_t subpass, uint32_t index, Type type) {
+        if (attachment < attachment_count) {
+            uses_[next_use[attachment]++] = Use{subpass, index, type};
+        }
+    });
+}
+
+vvl::span<const AttachmentUsageIndex::Use> AttachmentUsageIndex::Uses(uint32_t attachment) const {
+    if (static_cast<size_t>(attachment) + 1 >= offsets_.size()) {
+        return {};
+    }
+    return vvl::make_span(uses_.data() + offsets_[attachment], offsets_[attachment + 1] - offsets_[attachment]);
+}
+
+bool AttachmentUsageIndex::UsedIn(uint32_t attachment, uint32_t subpass, uint32_t type_mask) const {
+    for (const Use &use : Uses(attachment)) {
+        if (use.subpass > subpass) {
+            break;
+        }
+        if (use.subpass == subpass && (use.type & type_mask) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo2 const *pCreateInfo)
     : StateObject(handle, kVulkanObjectTypeRenderPass),
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(false),
       has_multiview_enabled(false),
-      create_info(pCreateInfo) {
+      create_info(pCreateInfo),
+      attachment_usage_index(*create_info.ptr()) {
     InitRenderPassState(this);
 }
 
@@ -288,7 +364,8 @@ RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo const *pCreat
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(false),
       has_multiview_enabled(false),
-      create_info(ConvertCreateInfo(*pCreateInfo)) {
+      create_info(ConvertCreateInfo(*pCreateInfo)),
+      attachment_usage_index(*create_info.ptr()) {
     InitRenderPassState(this);
 }
 
@@ -61,6 +61,41 @@ struct SubpassLayout {
 
 namespace vvl {
 
+// The references to each attachment from the subpasses of a render pass, gathered in one pass over the create info, so looking
+// for the other uses of an attachment doesn't scan every subpass again.
+class AttachmentUsageIndex {
+  public:
+    enum Type : uint8_t {
+        kColor = 1 << 0,
+        kResolve = 1 << 1,
+        kInput = 1 << 2,
+        kDepthStencil = 1 << 3,
+        kDepthStencilResolve = 1 << 4,
+        kPreserve = 1 << 5,
+        kFragmentShadingRate = 1 << 6,
+    };
+    struct Use {
+        uint32_t subpass;
+        // Index in the subpass array of this type of reference, 0 for the single references
+        uint32_t index;
+        Type type;
+    };
+
+    AttachmentUsageIndex() = default;
+    explicit AttachmentUsageIndex(const VkRenderPassCreateInfo2 &create_info);
+
+    // Ordered by subpass, then by type in the order of the enum. References to VK_ATTACHMENT_UNUSED or out of range
+    // attachments are not in the index.
+    vvl::span<const Use> Uses(uint32_t attachment) const;
+    // type_mask is a combination of Type
+    bool UsedIn(uint32_t attachment, uint32_t subpass, uint32_t type_mask) const;
+
+  private:
+    // The uses of attachment i are uses_[offsets_[i]] up to uses_[offsets_[i + 1]]
+    std::vector<uint32_t> offsets_;
+    std::vector<Use> uses_;
+};
+
 class RenderPass : public StateObject {
   public:
     struct AttachmentTransition {
@@ -94,6 +129,8 @@ class RenderPass : public StateObject {
     const SubpassGraphVec subpass_dependencies;
     using TransitionVec = std::vector<std::vector<AttachmentTransition>>;
     const TransitionVec subpass_transitions;
+    // Empty for dynamic rendering
+    const AttachmentUsageIndex attachment_usage_index;
 
     RenderPass(VkRenderPass handle, VkRenderPassCreateInfo2 const *pCreateInfo);
     RenderPass(VkRenderPass handle, VkRenderPassCreateInfo const *pCreateInfo);
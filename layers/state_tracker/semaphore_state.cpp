@@ -17,6 +17,9 @@
  * limitations under the License.
  */
 #include "state_tracker/semaphore_state.h"
+
+#include <algorithm>
+
 #include "state_tracker/queue_state.h"
 #include "state_tracker/state_tracker.h"
 
@@ -54,6 +57,33 @@ vvl::Semaphore::Semaphore(ValidationStateTracker &dev, VkSemaphore handle, const
       dev_data_(dev) {
 }
 
+std::deque<vvl::Semaphore::TimePoint>::iterator vvl::Semaphore::LowerBound(uint64_t payload) {
+    return std::lower_bound(timeline_.begin(), timeline_.end(), payload,
+                            [](const TimePoint &timepoint, uint64_t value) { return timepoint.payload < value; });
+}
+
+std::deque<vvl::Semaphore::TimePoint>::const_iterator vvl::Semaphore::LowerBound(uint64_t payload) const {
+    return std::lower_bound(timeline_.begin(), timeline_.end(), payload,
+                            [](const TimePoint &timepoint, uint64_t value) { return timepoint.payload < value; });
+}
+
+vvl::Semaphore::TimePoint *vvl::Semaphore::FindTimePoint(uint64_t payload) {
+    auto it = LowerBound(payload);
+    return (it != timeline_.end() && it->payload == payload) ? &*it : nullptr;
+}
+
+vvl::Semaphore::TimePoint &vvl::Semaphore::GetTimePoint(uint64_t payload) {
+    // Signals come in increasing order, check the back before searching
+    if (timeline_.empty() || timeline_.back().payload < payload) {
+        return timeline_.emplace_back(payload);
+    }
+    auto it = LowerBound(payload);
+    if (it == timeline_.end() || it->payload != payload) {
+        it = timeline_.emplace(it, payload);
+    }
+    return *it;
+}
+
 enum vvl::Semaphore::Scope vvl::Semaphore::Scope() const {
     auto guard = ReadLock();
     return scope_;
@@ -65,9 +95,9 @@ void vvl::Semaphore::EnqueueSignal(const SubmissionReference &signal_submit, uin
         payload = next_payload_++;
     }
     // Check there is no existing signal, validation should enforce this
-    assert(timeline_.find(payload) == timeline_.end() || !timeline_.find(payload)->second.signal_submit.has_value());
+    assert(!FindTimePoint(payload) || !FindTimePoint(payload)->signal_submit.has_value());
 
-    timeline_[payload].signal_submit.emplace(signal_submit);
+    GetTimePoint(payload).signal_submit.emplace(signal_submit);
 }
 
 void vvl::Semaphore::EnqueueWait(const SubmissionReference &wait_submit, uint64_t &payload) {
@@ -80,22 +110,22 @@ void vvl::Semaphore::EnqueueWait(const SubmissionReference &wait_submit, uint64_
             completed_ = SemOp(kWait, wait_submit, 0);
             return;
         }
-        assert(timeline_.rbegin()->second.HasSignaler());
-        payload = timeline_.rbegin()->first;
+        assert(timeline_.back().HasSignaler());
+        payload = timeline_.back().payload;
     } else {
         if (payload <= completed_.payload) {
             return;
         }
     }
-    timeline_[payload].wait_submits.emplace_back(wait_submit);
+    GetTimePoint(payload).wait_submits.emplace_back(wait_submit);
 }
 
 void vvl::Semaphore::EnqueueAcquire(vvl::Func acquire_command) {
     assert(type == VK_SEMAPHORE_TYPE_BINARY);
     auto guard = WriteLock();
     auto payload = next_payload_++;
-    assert(timeline_.find(payload) == timeline_.end());
-    timeline_[payload].acquire_command.emplace(acquire_command);
+    assert(!FindTimePoint(payload));
+    GetTimePoint(payload).acquire_command.emplace(acquire_command);
 }
 
 std::optional<vvl::Semaphore::SemOp> vvl::Semaphore::LastOp(const std::function<bool(OpType, uint64_t, bool)> &filter) const {
@@ -103,8 +133,8 @@ std::optional<vvl::Semaphore::SemOp> vvl::Semaphore::LastOp(const std::function<
     std::optional<SemOp> result;
 
     for (auto pos = timeline_.rbegin(); pos != timeline_.rend(); ++pos) {
-        uint64_t payload = pos->first;
-        auto &timepoint = pos->second;
+        auto &timepoint = *pos;
+        uint64_t payload = timepoint.payload;
         for (auto &op : timepoint.wait_submits) {
             if (!filter || filter(kWait, payload, true)) {
                 result.emplace(SemOp(kWait, op, payload));
@@ -137,7 +167,7 @@ std::optional<vvl::SubmissionReference> vvl::Semaphore::GetPendingBinarySignalSu
     if (timeline_.empty()) {
         return {};
     }
-    const auto &timepoint = timeline_.rbegin()->second;
+    const auto &timepoint = timeline_.back();
     const auto &signal_submit = timepoint.signal_submit;
 
     // Skip signals that are not associated with a queue
@@ -153,7 +183,7 @@ std::optional<vvl::SubmissionReference> vvl::Semaphore::GetPendingBinaryWaitSubm
     if (timeline_.empty()) {
         return {};
     }
-    const auto &timepoint = timeline_.rbegin()->second;
+    const auto &timepoint = timeline_.back();
     assert(timepoint.wait_submits.empty() || timepoint.wait_submits.size() == 1);
 
     // No waits
@@ -173,7 +203,7 @@ std::optional<vvl::SemaphoreInfo> vvl::Semaphore::GetPendingBinarySignalTimeline
     if (timeline_.empty()) {
         return {};
     }
-    const TimePoint &timepoint = timeline_.rbegin()->second;
+    const TimePoint &timepoint = timeline_.back();
     assert(timepoint.HasSignaler());
     const auto &signal_submit = timepoint.signal_submit;
 
@@ -199,9 +229,9 @@ bool vvl::Semaphore::CanBinaryBeSignaled() const {
     }
     // Every timeline slot of binary semaphore should contain at least a signal.
     // Wait before signal is not allowed.
-    assert(timeline_.rbegin()->second.HasSignaler());
+    assert(timeline_.back().HasSignaler());
 
-    return timeline_.rbegin()->second.HasWaiters();
+    return timeline_.back().HasWaiters();
 }
 
 bool vvl::Semaphore::CanBinaryBeWaited() const {
@@ -211,7 +241,7 @@ bool vvl::Semaphore::CanBinaryBeWaited() const {
         return CanWaitBinarySemaphoreAfterOperation(completed_.op_type);
     }
 
-    const TimePoint &timepoint = timeline_.rbegin()->second;
+    const TimePoint &timepoint = timeline_.back();
 
     assert(scope_ == vvl::Semaphore::kInternal);  // Ensured by all calling sites
 
@@ -236,7 +266,7 @@ void vvl::Semaphore::GetLastBinarySignalSource(VkQueue &queue, vvl::Func &acquir
             acquire_command = *completed_.acquire_command;
         }
     } else {
-        const TimePoint &timepoint = timeline_.rbegin()->second;
+        const TimePoint &timepoint = timeline_.back();
         if (timepoint.signal_submit.has_value() && timepoint.signal_submit->queue) {
             queue = timepoint.signal_submit->queue->VkHandle();
         } else if (timepoint.acquire_command.has_value()) {
@@ -248,11 +278,11 @@ void vvl::Semaphore::GetLastBinarySignalSource(VkQueue &queue, vvl::Func &acquir
 bool vvl::Semaphore::HasResolvingTimelineSignal(uint64_t wait_payload) const {
     assert(type == VK_SEMAPHORE_TYPE_TIMELINE);
     auto guard = ReadLock();
-    auto it = timeline_.find(wait_payload);
-    assert(it != timeline_.end());  // for each registered wait there is a timepoint
+    auto it = LowerBound(wait_payload);
+    assert(it != timeline_.end() && it->payload == wait_payload);  // for each registered wait there is a timepoint
     while (it != timeline_.end()) {
-        if (it->second.signal_submit.has_value()) {
-            assert(it->first >= wait_payload);  // timepoints are ordered in increasing order
+        if (it->signal_submit.has_value()) {
+            assert(it->payload >= wait_payload);  // timepoints are ordered in increasing order
             return true;
         }
         ++it;
@@ -282,10 +312,10 @@ bool vvl::Semaphore::CanRetireTimelineWait(const vvl::Queue *current_queue, uint
 
     // In the correct program the resolving signal is the next signal on the timeline,
     // otherwise this violates the rule of strictly increasing signal values.
-    auto it = timeline_.find(payload);
-    assert(it != timeline_.end());
+    auto it = LowerBound(payload);
+    assert(it != timeline_.end() && it->payload == payload);
     for (; it != timeline_.end(); ++it) {
-        const TimePoint &t = it->second;
+        const TimePoint &t = *it;
         if (!t.signal_submit.has_value()) {
             continue;
         }
@@ -306,7 +336,7 @@ bool vvl::Semaphore::CanRetireTimelineWait(const vvl::Queue *current_queue, uint
     }
 
     // Found host signal that finishes this wait
-    const TimePoint &t = it->second;
+    const TimePoint &t = *it;
     if (t.signal_submit->queue == nullptr) {
         return true;
     }
@@ -316,50 +346,79 @@ bool vvl::Semaphore::CanRetireTimelineWait(const vvl::Queue *current_queue, uint
     return false;
 }
 
+bool vvl::Semaphore::TryRetireWait(vvl::Queue *current_queue, uint64_t payload) {
+    if (payload <= completed_.payload) {
+        return true;
+    }
+    if (scope_ != kInternal) {
+        // GetSemaphoreCounterValue for external semaphore might not have a registered timepoint.
+        // Add timepoint so we can retire timeline up to that point.
+        assert(type == VK_SEMAPHORE_TYPE_TIMELINE || FindTimePoint(payload));
+        GetTimePoint(payload);
+        if (scope_ == kExternalTemporary) {
+            scope_ = kInternal;
+            imported_handle_type_.reset();
+        }
+    }
+    TimePoint *timepoint_ptr = FindTimePoint(payload);
+    assert(timepoint_ptr);
+    TimePoint &timepoint = *timepoint_ptr;
+
+    bool retire = false;
+    if (timepoint.acquire_command) {
+        retire = true;  // There is resolving acquire signal, timepoint can be retired
+    } else if (type == VK_SEMAPHORE_TYPE_BINARY) {
+        retire = CanRetireBinaryWait(timepoint);
+    } else {
+        retire = CanRetireTimelineWait(current_queue, payload);
+    }
+    if (retire) {
+        // SemOp::submit is used only by the binary semaphores.
+        // Binary semaphores can have at most one wait per timepoint.
+        const auto submit_ref = (type == VK_SEMAPHORE_TYPE_BINARY) ? timepoint.wait_submits[0] : SubmissionReference{};
+
+        RetireTimePoint(payload, kWait, submit_ref);
+        return true;
+    }
+    return false;
+}
+
 void vvl::Semaphore::RetireWait(vvl::Queue *current_queue, uint64_t payload, const Location &loc, bool queue_thread) {
-    std::shared_future<void> waiter;
     {
         auto guard = WriteLock();
-        if (payload <= completed_.payload) {
+        if (TryRetireWait(current_queue, payload)) {
             return;
         }
-        if (scope_ != kInternal) {
-            if (!vvl::Find(timeline_, payload)) {
-                // GetSemaphoreCounterValue for external semaphore might not have a registered timepoint.
-                // Add timepoint so we can retire timeline up to that point.
-                assert(type == VK_SEMAPHORE_TYPE_TIMELINE);
-                timeline_[payload] = TimePoint{};
-            }
-            if (scope_ == kExternalTemporary) {
-                scope_ = kInternal;
-                imported_handle_type_.reset();
-            }
-        }
-        TimePoint &timepoint = vvl::FindExisting(timeline_, payload);
+    }
+    // Wait for some other queue or a host operation to retire
+    WaitTimePoint(payload, !queue_thread, loc);
+}
 
-        bool retire = false;
-        if (timepoint.acquire_command) {
-            retire = true;  // There is resolving acquire signal, timepoint can be retired
-        } else if (type == VK_SEMAPHORE_TYPE_BINARY) {
-            retire = CanRetireBinaryWait(timepoint);
-        } else {
-            retire = CanRetireTimelineWait(current_queue, payload);
-        }
-        if (retire) {
-            // SemOp::submit is used only by the binary semaphores.
-            // Binary semaphores can have at most one wait per timepoint.
-            const auto submit_ref = (type == VK_SEMAPHORE_TYPE_BINARY) ? timepoint.wait_submits[0] : SubmissionReference{};
+bool vvl::Semaphore::ObserveValue(uint64_t payload) {
+    auto guard = WriteLock();
+    if (TryRetireWait(nullptr, payload)) {
+        return false;
+    }
+    // The resolving signal queue was notified, its queue thread retires the timeline
+    observed_payload_ = std::max(observed_payload_, payload);
+    return true;
+}
+
+bool vvl::Semaphore::HasPendingObservation() const {
+    auto guard = ReadLock();
+    return observed_payload_ > completed_.payload;
+}
 
-            RetireTimePoint(payload, kWait, submit_ref);
+void vvl::Semaphore::WaitObservedValue(const Location &loc) const {
+    uint64_t payload = 0;
+    {
+        auto guard = ReadLock();
+        if (observed_payload_ <= completed_.payload) {
             return;
         }
-
-        // Wait for some other queue or a host operation to retire
-        assert(timepoint.waiter.valid());
-        // the current timepoint should get destroyed while we're waiting, so copy out the waiter.
-        waiter = timepoint.waiter;
+        payload = observed_payload_;
     }
-    WaitTimePoint(std::move(waiter), payload, !queue_thread, loc);
+    WaitTimePoint(payload, true, loc);
 }
 
 void vvl::Semaphore::RetireSignal(uint64_t payload) {
@@ -367,8 +426,9 @@ void vvl::Semaphore::RetireSignal(uint64_t payload) {
     if (payload <= completed_.payload) {
         return;
     }
-    TimePoint &timepoint = vvl::FindExisting(timeline_, payload);
-    assert(timepoint.signal_submit.has_value());
+    TimePoint *timepoint_ptr = FindTimePoint(payload);
+    assert(timepoint_ptr && timepoint_ptr->signal_submit.has_value());
+    TimePoint &timepoint = *timepoint_ptr;
 
     OpType completed_op = kSignal;
     SubmissionReference completed_submit = *timepoint.signal_submit;
@@ -387,33 +447,42 @@ void vvl::Semaphore::RetireSignal(uint64_t payload) {
 }
 
 void vvl::Semaphore::RetireTimePoint(uint64_t payload, OpType completed_op, SubmissionReference completed_submit) {
-    auto it = timeline_.begin();
-    while (it != timeline_.end() && it->first <= payload) {
-        assert(it->first > completed_.payload);
-        it->second.completed.set_value();
-        ++it;
+    while (!timeline_.empty() && timeline_.front().payload <= payload) {
+        assert(timeline_.front().payload > completed_.payload);
+        timeline_.pop_front();
     }
-    timeline_.erase(timeline_.begin(), it);
     completed_ = SemOp(completed_op, completed_submit, payload);
+    if (waiter_count_ > 0) {
+        retired_.notify_all();
+    }
 }
 
-void vvl::Semaphore::WaitTimePoint(std::shared_future<void> &&waiter, uint64_t payload, bool unblock_validation_object,
-                                   const Location &loc) {
+void vvl::Semaphore::WaitTimePoint(uint64_t payload, bool unblock_validation_object, const Location &loc) const {
     if (unblock_validation_object) {
         dev_data_.BeginBlockingOperation();
     }
 
-    auto result = waiter.wait_until(GetCondWaitTimeout());
+    bool retired = false;
+    uint64_t completed_payload = 0;
+    {
+        // On the queue retire pool the signal being waited for may have to be retired by another task of the pool
+        vvl::ThreadPool::BlockingScope blocking_scope;
+        WriteLockGuard guard(lock_);
+        ++waiter_count_;
+        retired = retired_.wait_until(guard, GetCondWaitTimeout(), [this, payload] { return completed_.payload >= payload; });
+        --waiter_count_;
+        completed_payload = completed_.payload;
+    }
 
     if (unblock_validation_object) {
         dev_data_.EndBlockingOperation();
     }
 
-    if (result != std::future_status::ready) {
+    if (!retired) {
         dev_data_.LogError("INTERNAL-ERROR-VkSemaphore-state-timeout", Handle(), loc,
                            "The Validation Layers hit a timeout waiting for timeline semaphore state to update (this is most "
                            "likely a validation bug). completed_.payload=%" PRIu64 " wait_payload=%" PRIu64,
-                           completed_.payload, payload);
+                           completed_payload, payload);
     }
 }
 
@@ -19,8 +19,8 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
-#include <future>
-#include <map>
+#include <condition_variable>
+#include <deque>
 #include <shared_mutex>
 #include "containers/custom_containers.h"
 #include "error_message/error_location.h"
@@ -65,13 +65,12 @@ class Semaphore : public RefcountedStateObject {
     };
 
     struct TimePoint {
+        uint64_t payload;
         std::optional<SubmissionReference> signal_submit;
         small_vector<SubmissionReference, 1, uint32_t> wait_submits;
         std::optional<Func> acquire_command;
-        std::promise<void> completed;
-        std::shared_future<void> waiter;
 
-        TimePoint() : completed(), waiter(completed.get_future()) {}
+        explicit TimePoint(uint64_t payload) : payload(payload) {}
         bool HasSignaler() const { return signal_submit.has_value() || acquire_command.has_value(); }
         bool HasWaiters() const { return !wait_submits.empty(); }
         void Notify() const;
@@ -100,6 +99,15 @@ class Semaphore : public RefcountedStateObject {
     // (validation object has to use {Begin/End}BlockingOperation() when waiting for the timepoint)
     void RetireWait(Queue *current_queue, uint64_t payload, const Location &loc, bool queue_thread = false);
 
+    // Publish a payload observed on the host (vkGetSemaphoreCounterValue, vkWaitSemaphores) without waiting for the queue
+    // threads. Timepoints that can be retired right away are retired, otherwise the resolving signal is retired by its queue
+    // thread. Returns true if the observation is still pending then.
+    bool ObserveValue(uint64_t payload);
+    bool HasPendingObservation() const;
+    // Waits until the timeline is retired up to the last observed payload. Used by the validation that needs the state the
+    // application already observed.
+    void WaitObservedValue(const Location &loc) const;
+
     // Process signal by retiring timeline timepoints up to the specified payload
     void RetireSignal(uint64_t payload);
 
@@ -157,9 +165,19 @@ class Semaphore : public RefcountedStateObject {
     // Mark timepoints up to and including payload as completed (notify waiters) and remove them from timeline
     void RetireTimePoint(uint64_t payload, OpType completed_op, SubmissionReference completed_submit);
 
-    // Waits for the waiter. Unblock parameter must be true if the caller is a validation object and false otherwise.
-    // (validation object has to use {Begin/End}BlockingOperation() when waiting for the timepoint)
-    void WaitTimePoint(std::shared_future<void> &&waiter, uint64_t payload, bool unblock_validation_object, const Location &loc);
+    // Waits until the timepoint is retired. Unblock parameter must be true if the caller is a validation object and false
+    // otherwise. (validation object has to use {Begin/End}BlockingOperation() when waiting for the timepoint)
+    void WaitTimePoint(uint64_t payload, bool unblock_validation_object, const Location &loc) const;
+
+    // Retires the timepoints up to payload if nothing has to be waited for, lock_ must be held
+    bool TryRetireWait(Queue *current_queue, uint64_t payload);
+
+    // First timepoint with a payload not less than payload
+    std::deque<TimePoint>::iterator LowerBound(uint64_t payload);
+    std::deque<TimePoint>::const_iterator LowerBound(uint64_t payload) const;
+    TimePoint *FindTimePoint(uint64_t payload);
+    // Adds the timepoint if there is none for payload yet
+    TimePoint &GetTimePoint(uint64_t payload);
 
   private:
     enum Scope scope_ { kInternal };
@@ -170,11 +188,16 @@ class Semaphore : public RefcountedStateObject {
     // next payload value for binary semaphore operations
     uint64_t next_payload_;
 
-    // Set of pending operations ordered by payload.
-    // Timeline operations can be added in any order and multiple wait operations
-    // can use the same payload value.
-    std::map<uint64_t, TimePoint> timeline_;
+    // Pending operations sorted by payload.
+    // Signals are added in increasing order, so timepoints are almost always appended. Waits can use any payload
+    // and multiple wait operations can use the same payload value.
+    std::deque<TimePoint> timeline_;
     mutable std::shared_mutex lock_;
+    // Notified when timepoints are retired, if there are waiters
+    mutable std::condition_variable_any retired_;
+    mutable uint32_t waiter_count_ = 0;
+    // Highest payload reported to the host that is not retired yet
+    uint64_t observed_payload_ = 0;
     ValidationStateTracker &dev_data_;
 };
 
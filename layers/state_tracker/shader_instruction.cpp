@@ -19,24 +19,7 @@
 
 namespace spirv {
 
-Instruction::Instruction(std::vector<uint32_t>::const_iterator it) {
-    words_.emplace_back(*it++);
-    words_.reserve(Length());
-    for (uint32_t i = 1; i < Length(); i++) {
-        words_.emplace_back(*it++);
-    }
-    SetResultTypeIndex();
-    UpdateDebugInfo();
-}
-
-Instruction::Instruction(const uint32_t* it) {
-    words_.emplace_back(*it);
-    it++;
-    words_.reserve(Length());
-    for (uint32_t i = 1; i < Length(); i++) {
-        words_.emplace_back(*it);
-        it++;
-    }
+Instruction::Instruction(const uint32_t* it) : words_(it) {
     SetResultTypeIndex();
     UpdateDebugInfo();
 }
@@ -189,17 +172,28 @@ spv::StorageClass Instruction::StorageClass() const {
 // When logging from things such as GPU-AV, we need to do some SPIR-V processing, but is just to inspect single instructions without
 // knowledge of the rest of the module. This function just turns the saved vector of uint32_t into the Instruction class to make it
 // easier to use.
-void GenerateInstructions(const vvl::span<const uint32_t>& spirv, std::vector<Instruction>& instructions) {
-    // Need to use until we have native std::span in c++20
-    using spirv_iterator = vvl::enumeration<const uint32_t, const uint32_t*>::iterator;
+uint32_t CountInstructions(const vvl::span<const uint32_t>& spirv) {
+    uint32_t count = 0;
+    size_t offset = 5;  // skip first 5 word of header
+    while (offset < spirv.size()) {
+        const uint32_t length = spirv[offset] >> 16;
+        if (length == 0 || length > spirv.size() - offset) {
+            break;
+        }
+        offset += length;
+        count++;
+    }
+    return count;
+}
 
+void GenerateInstructions(const vvl::span<const uint32_t>& spirv, std::vector<Instruction>& instructions) {
     assert(instructions.empty());
-    spirv_iterator it = spirv.begin();
-    it += 5;  // skip first 5 word of header
-    instructions.reserve(spirv.size() * 4);
+    const uint32_t count = CountInstructions(spirv);
+    instructions.reserve(count);
 
-    while (it != spirv.end()) {
-        auto new_insn = instructions.emplace_back(it);
+    const uint32_t* it = spirv.data() + 5;  // skip first 5 word of header
+    for (uint32_t i = 0; i < count; i++) {
+        const Instruction& new_insn = instructions.emplace_back(it);
         it += new_insn.Length();
     }
 }
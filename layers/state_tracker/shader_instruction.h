@@ -16,6 +16,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <string>
@@ -31,9 +32,12 @@ namespace spirv {
 //
 // For more information of the physical module layout to help understand this struct:
 // https://github.com/KhronosGroup/SPIRV-Guide/blob/main/chapters/parsing_instructions.md
+//
+// The words are not copied, the Instruction points into the SPIR-V it was created from. Whoever owns the instructions has to keep
+// that SPIR-V alive and unchanged (spirv::Module does it by holding both).
 class Instruction {
   public:
-    Instruction(std::vector<uint32_t>::const_iterator it);
+    Instruction(std::vector<uint32_t>::const_iterator it) : Instruction(&*it) {}
     Instruction(const uint32_t* it);
     ~Instruction() = default;
 
@@ -48,6 +52,11 @@ class Instruction {
     uint32_t ResultId() const { return (result_id_index_ == 0) ? 0 : words_[result_id_index_]; }
     // operand id, return 0 if no type
     uint32_t TypeId() const { return (type_id_index_ == 0) ? 0 : words_[type_id_index_]; }
+    // Word index of the result / type id, 0 if there is none
+    uint32_t ResultIdIndex() const { return result_id_index_; }
+    uint32_t TypeIdIndex() const { return type_id_index_; }
+    // First word of the instruction, inside the SPIR-V binary
+    const uint32_t* Words() const { return words_; }
 
     // Used when need to print information for an error message
     std::string Describe() const;
@@ -74,22 +83,17 @@ class Instruction {
     // Auto-generated helper functions
     spv::StorageClass StorageClass() const;
 
-    bool operator==(Instruction const& other) const { return words_ == other.words_; }
-    bool operator!=(Instruction const& other) const { return words_ != other.words_; }
+    bool operator==(Instruction const& other) const {
+        return words_ == other.words_ || std::equal(words_, words_ + Length(), other.words_, other.words_ + other.Length());
+    }
+    bool operator!=(Instruction const& other) const { return !(*this == other); }
 
   private:
     void SetResultTypeIndex();
     void UpdateDebugInfo();
 
-    // When this class was created, for SPIR-V Instructions that could be used in Vulkan,
-    //   414 of 423 had 6 or less operands
-    //   361 of 423 had 5 or less operands
-    //   287 of 423 had 4 or less operands
-    // An extra word is still needed because each insturction has one word prior to the operands
-    static constexpr uint32_t word_vector_length = 7;
-
-    // Max capacity needs to be uint32_t because an instruction can have a string operand that is (2^16)-1 bytes long
-    small_vector<uint32_t, word_vector_length, uint32_t> words_;
+    // First word of the instruction, inside the SPIR-V binary
+    const uint32_t* words_;
     uint32_t result_id_index_ = 0;
     uint32_t type_id_index_ = 0;
 
@@ -104,6 +108,9 @@ class Instruction {
 #endif
 };
 
+// Number of instructions after the header, stops at the first instruction that has a length of zero or runs past the end
+uint32_t CountInstructions(const vvl::span<const uint32_t>& spirv);
+
 void GenerateInstructions(const vvl::span<const uint32_t>& spirv, std::vector<Instruction>& instructions);
 
 }  // namespace spirv
@@ -15,6 +15,7 @@
 
 #include "state_tracker/shader_module.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <queue>
@@ -774,15 +775,16 @@ ImageAccess::ImageAccess(const Module& module_state, const Instruction& image_in
 
 EntryPoint::EntryPoint(const Module& module_state, const Instruction& entrypoint_insn, const ImageAccessMap& image_access_map,
                        const AccessChainVariableMap& access_chain_map, const VariableAccessMap& variable_access_map,
-                       const DebugNameMap& debug_name_map)
+                       const DebugNameMap& debug_name_map, const AnalysisResult::EntryPoint* cached)
     : entrypoint_insn(entrypoint_insn),
       execution_model(spv::ExecutionModel(entrypoint_insn.Word(1))),
       stage(static_cast<VkShaderStageFlagBits>(ExecutionModelToShaderStageFlagBits(execution_model))),
       id(entrypoint_insn.Word(2)),
       name(entrypoint_insn.GetAsString(3)),
       execution_mode(module_state.GetExecutionModeSet(id)),
-      emit_vertex_geometry(false),
-      accessible_ids(GetAccessibleIds(module_state, *this)),
+      emit_vertex_geometry(cached ? cached->emit_vertex_geometry : false),
+      accessible_ids(cached ? vvl::unordered_set<uint32_t>(cached->accessible_ids.begin(), cached->accessible_ids.end())
+                            : GetAccessibleIds(module_state, *this)),
       resource_interface_variables(GetResourceInterfaceVariables(module_state, *this, image_access_map, access_chain_map,
                                                                  variable_access_map, debug_name_map)),
       stage_interface_variables(GetStageInterfaceVariables(module_state, *this, variable_access_map, debug_name_map)) {
@@ -861,16 +863,18 @@ std::optional<VkPrimitiveTopology> Module::GetTopology(const EntryPoint& entrypo
     return result;
 }
 
-Module::StaticData::StaticData(const Module& module_state, StatelessData* stateless_data) {
+Module::StaticData::StaticData(const Module& module_state, StatelessData* stateless_data, AnalysisCache* analysis_cache) {
     if (!module_state.valid_spirv) return;
 
     // Parse the words first so we have instruction class objects to use
+    // The instructions point into module_state.words_, counting them first means the vector is allocated exactly once
     {
-        std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
-        it += 5;  // skip first 5 word of header
-        instructions.reserve(module_state.words_.size() * 4);
-        while (it != module_state.words_.cend()) {
-            auto new_insn = instructions.emplace_back(it);
+        const vvl::span<const uint32_t> words(module_state.words_.data(), module_state.words_.size());
+        const uint32_t count = CountInstructions(words);
+        instructions.reserve(count);
+        const uint32_t* it = words.data() + 5;  // skip first 5 word of header
+        for (uint32_t i = 0; i < count; i++) {
+            const Instruction& new_insn = instructions.emplace_back(it);
             const uint32_t opcode = new_insn.Opcode();
 
             // Check for opcodes that would require reparsing of the words
@@ -884,7 +888,6 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
 
             it += new_insn.Length();
         }
-        instructions.shrink_to_fit();
     }
 
     // These have their own object class, but need entire module parsed first
@@ -1141,20 +1144,42 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
         }
     }
 
+    // The walks below only depend on the words, a module seen before (possibly in a previous run) reuses their results
+    std::shared_ptr<const AnalysisResult> cached_analysis;
+    std::shared_ptr<AnalysisResult> new_analysis;
+    if (analysis_cache) {
+        cached_analysis = analysis_cache->Find(module_state.hash_);
+        if (cached_analysis && cached_analysis->entry_points.size() != entry_point_instructions.size()) {
+            cached_analysis = nullptr;  // not the same module after all
+        }
+        if (!cached_analysis) {
+            new_analysis = std::make_shared<AnalysisResult>();
+        }
+    }
+
     FuncParameterMap func_parameter_map;
-    const uint32_t first_arg_word = 4;
-    for (const auto& func_def : func_parameter_list) {
-        const uint32_t func_id = func_def.first;
-        for (const Instruction* func_call : func_call_instructions) {
-            if (func_call->Word(3) != func_id) {
-                continue;
-            }
-            // guaranteed number of args/params is same
-            const uint32_t arg_count = (func_call->Length() - first_arg_word);
-            for (uint32_t i = 0; i < arg_count; i++) {
-                const uint32_t arg = func_call->Word(first_arg_word + i);
-                const uint32_t param = func_def.second[i];
-                func_parameter_map[param].push_back(arg);
+    if (cached_analysis) {
+        for (const auto& [param, arg] : cached_analysis->function_arguments) {
+            func_parameter_map[param].push_back(arg);
+        }
+    } else {
+        const uint32_t first_arg_word = 4;
+        for (const auto& func_def : func_parameter_list) {
+            const uint32_t func_id = func_def.first;
+            for (const Instruction* func_call : func_call_instructions) {
+                if (func_call->Word(3) != func_id) {
+                    continue;
+                }
+                // guaranteed number of args/params is same
+                const uint32_t arg_count = (func_call->Length() - first_arg_word);
+                for (uint32_t i = 0; i < arg_count; i++) {
+                    const uint32_t arg = func_call->Word(first_arg_word + i);
+                    const uint32_t param = func_def.second[i];
+                    func_parameter_map[param].push_back(arg);
+                    if (new_analysis) {
+                        new_analysis->function_arguments.emplace_back(param, arg);
+                    }
+                }
             }
         }
     }
@@ -1228,9 +1253,20 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
     }
 
     // Need to build the definitions table for FindDef before looking for which instructions each entry point uses
-    for (const auto& insn : entry_point_instructions) {
-        entry_points.emplace_back(std::make_shared<EntryPoint>(module_state, *insn, image_access_map, access_chain_map,
-                                                               variable_access_map, debug_name_map));
+    for (size_t i = 0; i < entry_point_instructions.size(); ++i) {
+        const AnalysisResult::EntryPoint* cached = cached_analysis ? &cached_analysis->entry_points[i] : nullptr;
+        const auto& entry_point =
+            entry_points.emplace_back(std::make_shared<EntryPoint>(module_state, *entry_point_instructions[i], image_access_map,
+                                                                   access_chain_map, variable_access_map, debug_name_map, cached));
+        if (new_analysis) {
+            auto& result = new_analysis->entry_points.emplace_back();
+            result.emit_vertex_geometry = entry_point->emit_vertex_geometry;
+            result.accessible_ids.assign(entry_point->accessible_ids.begin(), entry_point->accessible_ids.end());
+        }
+    }
+
+    if (new_analysis) {
+        analysis_cache->Insert(module_state.hash_, std::move(new_analysis));
     }
 }
 
@@ -2411,4 +2447,65 @@ AtomicInstructionInfo Module::GetAtomicInfo(const Instruction& insn) const {
     return info;
 }
 
+std::shared_ptr<Module> SharedModuleCache::Get(size_t code_size, const uint32_t* code, StatelessData* stateless_data,
+                                               AnalysisCache* analysis_cache, const hash_util::Hash128* hash) {
+    // Invalid SPIR-V is not worth sharing, it won't get past validation
+    if (!code || code[0] != spv::MagicNumber || (code_size % 4) != 0) {
+        return std::make_shared<Module>(code_size, code, stateless_data, analysis_cache, hash);
+    }
+    const hash_util::Hash128 key = hash ? *hash : hash_util::ShaderHash128(code, code_size);
+    const auto fill_stateless_data = [stateless_data](const StatelessData& parsed) {
+        if (stateless_data) {
+            std::shared_ptr<Module> pipeline_pnext_module = std::move(stateless_data->pipeline_pnext_module);
+            *stateless_data = parsed;
+            stateless_data->pipeline_pnext_module = std::move(pipeline_pnext_module);
+        }
+    };
+
+    Shard &shard = GetShard(key);
+    {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        auto it = shard.entries.find(key);
+        if (it != shard.entries.end()) {
+            // 128 bits make comparing the words not worth it
+            if (std::shared_ptr<const Module> shared_module = it->second.module.lock()) {
+                fill_stateless_data(it->second.stateless_data);
+                return std::make_shared<Module>(std::move(shared_module));
+            }
+        }
+    }
+
+    // Parsed without the lock, finding the same words being parsed by another thread only costs the duplicate work
+    Entry entry;
+    auto parsed_module = std::make_shared<const Module>(code_size, code, &entry.stateless_data, analysis_cache, &key);
+    fill_stateless_data(entry.stateless_data);
+    entry.module = parsed_module;
+
+    std::lock_guard<std::mutex> guard(shard.lock);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        shard.entries.emplace(key, std::move(entry));
+    } else if (it->second.module.expired()) {
+        it->second = std::move(entry);
+    }
+    if (shard.entries.size() >= shard.sweep_size) {
+        for (auto expired = shard.entries.begin(); expired != shard.entries.end();) {
+            expired = expired->second.module.expired() ? shard.entries.erase(expired) : std::next(expired);
+        }
+        shard.sweep_size = std::max<size_t>(64, shard.entries.size() * 2);
+    }
+    return std::make_shared<Module>(std::move(parsed_module));
+}
+
+size_t SharedModuleCache::Size() const {
+    size_t size = 0;
+    for (const Shard& shard : shards_) {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        for (const auto& entry : shard.entries) {
+            size += entry.second.module.expired() ? 0 : 1;
+        }
+    }
+    return size;
+}
+
 }  // namespace spirv
@@ -17,14 +17,20 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "state_tracker/shader_instruction.h"
 #include "state_tracker/state_object.h"
 #include "state_tracker/sampler_state.h"
+#include "utils/hash_util.h"
+#include "utils/memory_accounting.h"
+#include "utils/spirv_analysis_cache.h"
 #include <spirv/unified1/spirv.hpp>
 
 namespace vvl {
@@ -535,9 +541,10 @@ struct EntryPoint {
     bool has_passthrough{false};
     bool has_alpha_to_coverage_variable{false};  // only for Fragment shaders
 
+    // If cached is set, the call tree is not walked again
     EntryPoint(const Module &module_state, const Instruction &entrypoint_insn, const ImageAccessMap &image_access_map,
                const AccessChainVariableMap &access_chain_map, const VariableAccessMap &variable_access_map,
-               const DebugNameMap &debug_name_map);
+               const DebugNameMap &debug_name_map, const AnalysisResult::EntryPoint *cached = nullptr);
 
     bool HasBuiltIn(spv::BuiltIn built_in) const;
 
@@ -584,7 +591,7 @@ struct Module {
     // The goal of this struct is to move everything that is ready only into here
     struct StaticData {
         StaticData() = default;
-        StaticData(const Module &module_state, StatelessData *stateless_data = nullptr);
+        StaticData(const Module &module_state, StatelessData *stateless_data = nullptr, AnalysisCache *analysis_cache = nullptr);
         StaticData &operator=(StaticData &&) = default;
         StaticData(StaticData &&) = default;
 
@@ -652,23 +659,69 @@ struct Module {
     // underlying spirv is not worth validating further
     const bool valid_spirv;
 
+  private:
+    // Storage of words_ and static_data_ when this module parsed the SPIR-V itself, empty when it shares the parsed data of
+    // an identical module (see SharedModuleCache)
+    const std::vector<uint32_t> own_words_;
+    // Keeps the module the parsed data is shared with alive
+    const std::shared_ptr<const Module> shared_module_;
+
+  public:
+    // XXH3-128 of words_, every cache keyed on the SPIR-V uses it instead of hashing the code again
+    const hash_util::Hash128 hash_;
+
     // This is the SPIR-V module data content
-    const std::vector<uint32_t> words_;
+    const std::vector<uint32_t> &words_;
 
-    const StaticData static_data_;
+    const StaticData &static_data_;
+
+  private:
+    // Declared after static_data_ as building it already looks things up through static_data_
+    const StaticData own_static_data_;
+
+  public:
+    // Counts the words and the parsed instructions, the other parsed data is much smaller. Shared parsed data is only
+    // counted by the module that parsed it.
+    const vvl::AccountedMemory accounted_memory_;
+    size_t MemoryBytes() const {
+        return own_words_.capacity() * sizeof(uint32_t) + own_static_data_.instructions.capacity() * sizeof(Instruction);
+    }
 
     // Hold a handle so error message can know where the SPIR-V was from (VkShaderModule or VkShaderEXT)
     VulkanTypedHandle handle_;                            // Will be updated once its known its valid SPIR-V
     VulkanTypedHandle handle() const { return handle_; }  // matches normal convention to get handle
 
     // Used for when modifying the SPIR-V (spirv-opt, GPU-AV instrumentation, etc) and need reparse it for VVL validation
-    Module(vvl::span<const uint32_t> code) : valid_spirv(true), words_(code.begin(), code.end()), static_data_(*this) {}
+    Module(vvl::span<const uint32_t> code)
+        : valid_spirv(true),
+          own_words_(code.begin(), code.end()),
+          hash_(hash_util::ShaderHash128(own_words_.data(), own_words_.size() * sizeof(uint32_t))),
+          words_(own_words_),
+          static_data_(own_static_data_),
+          own_static_data_(*this),
+          accounted_memory_(vvl::MemoryTag::SpirvModules, MemoryBytes()) {}
 
     // StatelessData is a pointer as we have cases were we don't need it and simpler to just null check the few cases that use it
-    Module(size_t codeSize, const uint32_t *pCode, StatelessData *stateless_data = nullptr)
+    // With an AnalysisCache, the module wide walks of a previously seen module are skipped
+    // hash is passed by callers that already hashed the code
+    Module(size_t codeSize, const uint32_t *pCode, StatelessData *stateless_data = nullptr, AnalysisCache *analysis_cache = nullptr,
+           const hash_util::Hash128 *hash = nullptr)
         : valid_spirv(pCode && pCode[0] == spv::MagicNumber && ((codeSize % 4) == 0)),
-          words_(pCode, pCode + codeSize / sizeof(uint32_t)),
-          static_data_(*this, stateless_data) {}
+          own_words_(pCode, pCode + codeSize / sizeof(uint32_t)),
+          hash_(hash ? *hash : hash_util::ShaderHash128(own_words_.data(), own_words_.size() * sizeof(uint32_t))),
+          words_(own_words_),
+          static_data_(own_static_data_),
+          own_static_data_(*this, stateless_data, analysis_cache),
+          accounted_memory_(vvl::MemoryTag::SpirvModules, MemoryBytes()) {}
+
+    // Uses the words and parsed data of shared_module, only the handle is its own
+    explicit Module(std::shared_ptr<const Module> shared_module)
+        : valid_spirv(shared_module->valid_spirv),
+          shared_module_(shared_module),
+          hash_(shared_module->hash_),
+          words_(shared_module->words_),
+          static_data_(shared_module->static_data_),
+          accounted_memory_(vvl::MemoryTag::SpirvModules, MemoryBytes()) {}
 
     const Instruction *FindDef(uint32_t id) const {
         auto it = static_data_.definitions.find(id);
@@ -754,6 +807,39 @@ struct Module {
     }
 };
 
+// Parsed SPIR-V shared by all the devices of an instance, so the same shader created on several devices, or several times,
+// is only parsed once. Entries don't keep the parsed data alive, it is released with the last module using it.
+// Thread safe
+class SharedModuleCache {
+  public:
+    // Returns a new module, so the caller can set its own handle, and fills stateless_data as if the module was parsed here
+    // hash is passed by callers that already hashed the code
+    std::shared_ptr<Module> Get(size_t code_size, const uint32_t *code, StatelessData *stateless_data,
+                                AnalysisCache *analysis_cache, const hash_util::Hash128 *hash = nullptr);
+    // Entries of modules still alive
+    size_t Size() const;
+
+  private:
+    struct Entry {
+        std::weak_ptr<const Module> module;
+        // What parsing filled, the instruction pointers remain valid as long as module does
+        StatelessData stateless_data;
+    };
+
+    // Split by hash, so threads creating different modules at the same time rarely wait on each other
+    struct alignas(vku::concurrent::get_hardware_destructive_interference_size()) Shard {
+        mutable std::mutex lock;
+        vvl::unordered_map<hash_util::Hash128, Entry, hash_util::Hash128::Hasher> entries;
+        // Expired entries are removed once the map grows past this
+        size_t sweep_size = 64;
+    };
+    static constexpr size_t kShardCount = 16;
+    // Hasher uses low, so the shard is picked from the other half
+    Shard &GetShard(const hash_util::Hash128 &hash) { return shards_[hash.high % kShardCount]; }
+
+    std::array<Shard, kShardCount> shards_;
+};
+
 }  // namespace spirv
 
 // Represents a VkShaderModule handle
@@ -19,6 +19,7 @@
 #include "shader_stage_state.h"
 
 #include "state_tracker/shader_module.h"
+#include "utils/hash_util.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 
 void GetActiveSlots(ActiveSlotMap &active_slots, const std::shared_ptr<const spirv::EntryPoint> &entrypoint) {
@@ -58,6 +59,33 @@ uint32_t GetMaxActiveSlot(const ActiveSlotMap &active_slots) {
     return max_active_slot;
 }
 
+size_t ActiveSlotMapCache::KeyHash::operator()(const Key &key) const {
+    return hash_util::HashCombiner().Combine(key).Value();
+}
+
+std::shared_ptr<const ActiveSlotMap> ActiveSlotMapCache::Get(const std::vector<ShaderStageState> &stage_states) {
+    Key key;
+    key.reserve(stage_states.size());
+    for (const auto &stage : stage_states) {
+        key.emplace_back(stage.entrypoint.get());
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto &entry = entries_[key];
+    if (auto active_slots = entry.lock()) {
+        return active_slots;
+    }
+    auto active_slots = std::make_shared<const ActiveSlotMap>(GetActiveSlots(stage_states));
+    entry = active_slots;
+    // Drop the entries of the maps nobody uses anymore once in a while, so the map doesn't grow with every pipeline ever made
+    if (entries_.size() > 2 * live_entries_hint_) {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            it = it->second.expired() ? entries_.erase(it) : std::next(it);
+        }
+        live_entries_hint_ = std::max<size_t>(entries_.size(), kMinPruneSize);
+    }
+    return active_slots;
+}
+
 const char *ShaderStageState::GetPName() const {
     return (pipeline_create_info) ? pipeline_create_info->pName : shader_object_create_info->pName;
 }
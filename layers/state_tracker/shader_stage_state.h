@@ -18,6 +18,9 @@
 
 #pragma once
 #include <vulkan/vulkan.h>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "containers/custom_containers.h"
 
 namespace vku {
@@ -87,3 +90,24 @@ ActiveSlotMap GetActiveSlots(const std::vector<ShaderStageState> &stage_states);
 ActiveSlotMap GetActiveSlots(const std::shared_ptr<const spirv::EntryPoint> &entrypoint);
 
 uint32_t GetMaxActiveSlot(const ActiveSlotMap &active_slots);
+
+// Pipelines made of the same shader entry points have the same active slots, this hands out one map for all of them.
+// Only weak references are kept, a map lives as long as one of its pipelines does.
+class ActiveSlotMapCache {
+  public:
+    std::shared_ptr<const ActiveSlotMap> Get(const std::vector<ShaderStageState> &stage_states);
+
+  private:
+    // The entry points of a live map can't be freed, its pipelines hold them, so the pointers are not reused while it exists
+    using Key = std::vector<const spirv::EntryPoint *>;
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    static constexpr size_t kMinPruneSize = 64;
+
+    std::mutex mutex_;
+    vvl::unordered_map<Key, std::weak_ptr<const ActiveSlotMap>, KeyHash> entries_;
+    // Number of entries left by the last pruning, the next one happens when the map gets twice as big
+    size_t live_entries_hint_ = kMinPruneSize;
+};
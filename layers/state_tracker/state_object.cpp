@@ -18,24 +18,78 @@
  */
 #include "state_tracker/state_object.h"
 
+#include <mutex>
+
+namespace {
+struct LazyParentRegistry {
+    std::mutex lock;
+    vvl::unordered_map<const vvl::StateObject*, std::weak_ptr<vvl::StateObject>> parents;
+};
+
+LazyParentRegistry& GetLazyParentRegistry() {
+    static LazyParentRegistry registry;
+    return registry;
+}
+
+// Copied out so that the lazy parents are notified without the registry lock held
+std::vector<std::shared_ptr<vvl::StateObject>> GetLazyParents() {
+    std::vector<std::shared_ptr<vvl::StateObject>> result;
+    auto& registry = GetLazyParentRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    result.reserve(registry.parents.size());
+    for (const auto& entry : registry.parents) {
+        if (auto parent = entry.second.lock()) {
+            result.emplace_back(std::move(parent));
+        }
+    }
+    return result;
+}
+}  // namespace
+
+void vvl::StateObject::RegisterLazyParent(const std::shared_ptr<StateObject>& parent_node) {
+    auto& registry = GetLazyParentRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.parents.emplace(parent_node.get(), parent_node);
+}
+
+void vvl::StateObject::UnregisterLazyParent(const StateObject* parent_node) {
+    auto& registry = GetLazyParentRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.parents.erase(parent_node);
+}
+
+thread_local uint32_t vvl::StateObject::teardown_depth_ = 0;
+
 vvl::StateObject::~StateObject() { Destroy(); }
 
 void vvl::StateObject::Destroy() {
-    Invalidate();
+    if (!InTeardown()) {
+        Invalidate();
+    }
     destroyed_ = true;
 }
 
 const VulkanTypedHandle* vvl::StateObject::InUse() const {
-    // NOTE: for performance reasons, this method calls up the tree
-    // with the read lock held.
-    auto guard = ReadLockTree();
-    for (auto& item : parent_nodes_) {
-        auto node = item.second.lock();
-        if (!node) {
-            continue;
+    {
+        // NOTE: for performance reasons, this method calls up the tree
+        // with the read lock held.
+        auto guard = ReadLockTree();
+        for (auto& item : parent_nodes_) {
+            auto node = item.second.lock();
+            if (!node) {
+                continue;
+            }
+            if (node->InUse()) {
+                return &node->Handle();
+            }
         }
-        if (node->InUse()) {
-            return &node->Handle();
+    }
+    if (lazy_parent_count_.load(std::memory_order_relaxed) > 0) {
+        const auto self = std::const_pointer_cast<StateObject>(shared_from_this());
+        for (const auto& node : GetLazyParents()) {
+            if (node.get() != this && node->HasLazyChild(self) && node->InUse()) {
+                return &node->Handle();
+            }
         }
     }
     return nullptr;
@@ -53,6 +107,14 @@ void vvl::StateObject::RemoveParent(StateObject* parent_node) {
     parent_nodes_.erase(parent_node->Handle());
 }
 
+void vvl::StateObject::RemoveParents(vvl::span<StateObject* const> parent_nodes) {
+    auto guard = WriteLockTree();
+    for (StateObject* parent_node : parent_nodes) {
+        assert(parent_node);
+        parent_nodes_.erase(parent_node->Handle());
+    }
+}
+
 // copy the current set of parents so that we don't need to hold the lock
 // while calling NotifyInvalidate on them, as that would lead to recursive locking.
 vvl::StateObject::NodeMap vvl::StateObject::GetParentsForInvalidate(bool unlink) {
@@ -84,7 +146,9 @@ void vvl::StateObject::Invalidate(bool unlink) {
 
 void vvl::StateObject::NotifyInvalidate(const NodeList& invalid_nodes, bool unlink) {
     auto current_parents = GetParentsForInvalidate(unlink);
-    if (current_parents.empty()) {
+    // Lazy parents hold a reference, so an object that has some is not being destroyed and shared_from_this() is safe
+    const bool has_lazy_parents = lazy_parent_count_.load(std::memory_order_relaxed) > 0;
+    if (current_parents.empty() && !has_lazy_parents) {
         return;
     }
 
@@ -96,4 +160,12 @@ void vvl::StateObject::NotifyInvalidate(const NodeList& invalid_nodes, bool unli
             node->NotifyInvalidate(up_nodes, unlink);
         }
     }
+    if (has_lazy_parents) {
+        // The parent links were never made, find the parents holding this object now
+        for (const auto& node : GetLazyParents()) {
+            if (node.get() != this && !node->Destroyed() && node->HasLazyChild(up_nodes.back())) {
+                node->NotifyInvalidate(up_nodes, unlink);
+            }
+        }
+    }
 }
@@ -21,6 +21,7 @@
 #include "vulkan/vulkan.h"
 #include "containers/custom_containers.h"
 #include "utils/vk_layer_utils.h"
+#include "utils/lock_profiling.h"
 #include "generated/vk_object_types.h"
 #include "error_message/logging.h"
 
@@ -69,6 +70,17 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
 
     bool Destroyed() const { return destroyed_; }
 
+    // Alive on the thread destroying a device. Every object a destroyed object could notify or unlink from is destroyed as
+    // well, so Destroy() skips the parent notifications and the links are freed with the objects.
+    class TeardownScope {
+      public:
+        TeardownScope() { ++teardown_depth_; }
+        ~TeardownScope() { --teardown_depth_; }
+        TeardownScope(const TeardownScope &) = delete;
+        TeardownScope &operator=(const TeardownScope &) = delete;
+    };
+    static bool InTeardown() { return teardown_depth_ != 0; }
+
     // Some drivers may reuse vulkan handles, which can confuse some parts of validation that cache state.
     // Add a unique id to help detect this condition. SetId() should only be called by the state tracker during
     // object creation.
@@ -90,6 +102,17 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
 
     virtual bool AddParent(StateObject *parent_node);
     virtual void RemoveParent(StateObject *parent_node);
+    // Same as RemoveParent() for each of parent_nodes, under one lock. Overrides of RemoveParent() must override it too.
+    virtual void RemoveParents(vvl::span<StateObject *const> parent_nodes);
+
+    // A lazy parent (like a command buffer with the lazy_object_bindings setting) keeps its children without adding
+    // itself to their parent_nodes_, binding is then only a counter increment on the child. Lazy parents register once,
+    // and are looked up with HasLazyChild() when a child with lazy parents is invalidated or checked for InUse().
+    void AddLazyParent() { lazy_parent_count_.fetch_add(1, std::memory_order_relaxed); }
+    void RemoveLazyParent() { lazy_parent_count_.fetch_sub(1, std::memory_order_relaxed); }
+    void RemoveLazyParents(uint32_t count) { lazy_parent_count_.fetch_sub(count, std::memory_order_relaxed); }
+    static void RegisterLazyParent(const std::shared_ptr<StateObject> &parent_node);
+    static void UnregisterLazyParent(const StateObject *parent_node);
 
     // Invalidate is called on a state object to inform its parents that it
     // is being destroyed (unlink == true) or otherwise becoming invalid (unlink == false)
@@ -108,6 +131,13 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
 
     // Called recursively for every parent object of something that has become invalid
     virtual void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink);
+    // For objects that keep some of their parents outside of parent_nodes_
+    static void NotifyParentInvalidate(StateObject &parent_node, const NodeList &invalid_nodes, bool unlink) {
+        parent_node.NotifyInvalidate(invalid_nodes, unlink);
+    }
+
+    // Implemented by lazy parents, returns true if child_node is one of their children
+    virtual bool HasLazyChild(const std::shared_ptr<StateObject> &child_node) const { return false; }
 
     // returns a copy of the current set of parents so that they can be walked
     // without the tree lock held. If unlink == true, parent_nodes_ is also cleared.
@@ -118,14 +148,18 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     std::atomic<bool> destroyed_;
     IdType id_;
   private:
-    ReadLockGuard ReadLockTree() const { return ReadLockGuard(tree_lock_); }
-    WriteLockGuard WriteLockTree() { return WriteLockGuard(tree_lock_); }
+    auto ReadLockTree() const { return std::shared_lock(tree_lock_); }
+    auto WriteLockTree() { return std::unique_lock(tree_lock_); }
 
     // Set of immediate parent nodes for this object. For an in-use object, the
     // parent nodes should form a tree with the root being a command buffer.
     NodeMap parent_nodes_;
     // Lock guarding parent_nodes_, this lock MUST NOT be used for other purposes.
-    mutable std::shared_mutex tree_lock_;
+    mutable vvl::ProfiledSharedMutex<vvl::ProfiledLock::StateObjectTree> tree_lock_;
+    // Number of lazy parents holding this object, they are not in parent_nodes_
+    std::atomic<uint32_t> lazy_parent_count_{0};
+
+    static thread_local uint32_t teardown_depth_;
 };
 
 class RefcountedStateObject : public StateObject {
@@ -370,8 +370,43 @@ struct BufferAddressInfillUpdateOps {
     const Mapped &insert_value;
 };
 
+const ValidationStateTracker::BufferAddressSnapshot::Entry *ValidationStateTracker::BufferAddressSnapshot::Find(
+    VkDeviceAddress address) const {
+    auto it = std::upper_bound(entries.begin(), entries.end(), address,
+                               [](VkDeviceAddress value, const Entry &entry) { return value < entry.range.begin; });
+    if (it == entries.begin()) {
+        return nullptr;
+    }
+    --it;
+    return it->range.includes(address) ? &*it : nullptr;
+}
+
+void ValidationStateTracker::PublishBufferAddressSnapshot() const {
+    auto snapshot = std::make_shared<BufferAddressSnapshot>();
+    snapshot->version = buffer_device_address_ranges_version;
+    snapshot->entries.reserve(buffer_address_map_.size());
+    for (const auto &[address_range, buffers] : buffer_address_map_) {
+        snapshot->entries.emplace_back(BufferAddressSnapshot::Entry{address_range, buffers});
+    }
+    // Readers still using the previous snapshot keep it alive
+    std::atomic_store_explicit(&buffer_address_snapshot_, std::shared_ptr<const BufferAddressSnapshot>(std::move(snapshot)),
+                               std::memory_order_release);
+}
+
+std::shared_ptr<const ValidationStateTracker::BufferAddressSnapshot> ValidationStateTracker::GetBufferAddressSnapshot() const {
+    if (buffer_address_snapshot_dirty_.load(std::memory_order_acquire)) {
+        // Creating or destroying many buffers in a row only pays for one copy of the map, here
+        std::unique_lock guard(buffer_address_lock_);
+        if (buffer_address_snapshot_dirty_.load(std::memory_order_relaxed)) {
+            PublishBufferAddressSnapshot();
+            buffer_address_snapshot_dirty_.store(false, std::memory_order_release);
+        }
+    }
+    return std::atomic_load_explicit(&buffer_address_snapshot_, std::memory_order_acquire);
+}
+
 std::shared_ptr<vvl::Buffer> ValidationStateTracker::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *create_info) {
-    return std::make_shared<vvl::Buffer>(*this, handle, create_info);
+    return state_object::MakePooledState<vvl::Buffer>(*this, handle, create_info);
 }
 
 void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
@@ -384,13 +419,15 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
     if (pCreateInfo) {
         const auto *opaque_capture_address = vku::FindStructInPNextChain<VkBufferOpaqueCaptureAddressCreateInfo>(pCreateInfo->pNext);
         if (opaque_capture_address && (opaque_capture_address->opaqueCaptureAddress != 0)) {
-            WriteLockGuard guard(buffer_address_lock_);
+            std::unique_lock guard(buffer_address_lock_);
             // address is used for GPU-AV and ray tracing buffer validation
             buffer_state->deviceAddress = opaque_capture_address->opaqueCaptureAddress;
             const auto address_range = buffer_state->DeviceAddressRange();
 
             BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
             sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+            buffer_device_address_ranges_version++;
+            buffer_address_snapshot_dirty_.store(true, std::memory_order_release);
         }
 
         const VkBufferUsageFlags descriptor_buffer_usages =
@@ -415,7 +452,7 @@ std::shared_ptr<vvl::BufferView> ValidationStateTracker::CreateBufferViewState(c
                                                                                VkBufferView handle,
                                                                                const VkBufferViewCreateInfo *create_info,
                                                                                VkFormatFeatureFlags2KHR format_features) {
-    return std::make_shared<vvl::BufferView>(buffer, handle, create_info, format_features);
+    return state_object::MakePooledState<vvl::BufferView>(buffer, handle, create_info, format_features);
 }
 
 void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
@@ -425,8 +462,14 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
 
     auto buffer_state = Get<vvl::Buffer>(pCreateInfo->buffer);
 
+    std::optional<VkFormatFeatureFlags2KHR> cached_features;
+    if (buffer_state) {
+        cached_features = buffer_state->FindViewFormatFeatures(pCreateInfo->format);
+    }
     VkFormatFeatureFlags2KHR buffer_features;
-    if (has_format_feature2) {
+    if (cached_features) {
+        buffer_features = *cached_features;
+    } else if (has_format_feature2) {
         VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
         VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
         DispatchGetPhysicalDeviceFormatProperties2Helper(physical_device, pCreateInfo->format, &fmt_props_2);
@@ -436,6 +479,9 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
         DispatchGetPhysicalDeviceFormatProperties(physical_device, pCreateInfo->format, &format_properties);
         buffer_features = format_properties.bufferFeatures;
     }
+    if (buffer_state && !cached_features) {
+        buffer_state->AddViewFormatFeatures(pCreateInfo->format, buffer_features);
+    }
 
     Add(CreateBufferViewState(buffer_state, *pView, pCreateInfo, buffer_features));
 }
@@ -443,7 +489,7 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
 std::shared_ptr<vvl::ImageView> ValidationStateTracker::CreateImageViewState(
     const std::shared_ptr<vvl::Image> &image_state, VkImageView handle, const VkImageViewCreateInfo *create_info,
     VkFormatFeatureFlags2KHR format_features, const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) {
-    return std::make_shared<vvl::ImageView>(image_state, handle, create_info, format_features, cubic_props);
+    return state_object::MakePooledState<vvl::ImageView>(image_state, handle, create_info, format_features, cubic_props);
 }
 
 void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
@@ -453,6 +499,14 @@ void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, cons
     auto image_state = Get<vvl::Image>(pCreateInfo->image);
     ASSERT_AND_RETURN(image_state);
 
+    auto usage_create_info = vku::FindStructInPNextChain<VkImageViewUsageCreateInfo>(pCreateInfo->pNext);
+    const VkImageUsageFlags usage = usage_create_info ? usage_create_info->usage : image_state->create_info.usage;
+    const vvl::Image::ViewFormatKey view_format_key{pCreateInfo->format, pCreateInfo->viewType, usage};
+    if (auto properties = image_state->FindViewFormatProperties(view_format_key)) {
+        Add(CreateImageViewState(image_state, *pView, pCreateInfo, properties->format_features, properties->filter_cubic_props));
+        return;
+    }
+
     VkFormatFeatureFlags2KHR format_features = 0;
     if (image_state->HasAHBFormat() == true) {
         // The ImageView uses same Image's format feature since they share same AHB
@@ -472,14 +526,14 @@ void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, cons
         image_format_info.type = image_state->create_info.imageType;
         image_format_info.format = image_state->create_info.format;
         image_format_info.tiling = image_state->create_info.tiling;
-        auto usage_create_info = vku::FindStructInPNextChain<VkImageViewUsageCreateInfo>(pCreateInfo->pNext);
-        image_format_info.usage = usage_create_info ? usage_create_info->usage : image_state->create_info.usage;
+        image_format_info.usage = usage;
         image_format_info.flags = image_state->create_info.flags;
 
         VkImageFormatProperties2 image_format_properties = vku::InitStructHelper(&filter_cubic_props);
 
         DispatchGetPhysicalDeviceImageFormatProperties2Helper(physical_device, &image_format_info, &image_format_properties);
     }
+    image_state->AddViewFormatProperties(view_format_key, {format_features, filter_cubic_props});
 
     Add(CreateImageViewState(image_state, *pView, pCreateInfo, format_features, filter_cubic_props));
 }
@@ -517,7 +571,7 @@ void ValidationStateTracker::PreCallRecordDestroyImageView(VkDevice device, VkIm
 void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator,
                                                         const RecordObject &record_obj) {
     if (auto buffer_state = Get<vvl::Buffer>(buffer)) {
-        WriteLockGuard guard(buffer_address_lock_);
+        std::unique_lock guard(buffer_address_lock_);
 
         const VkBufferUsageFlags descriptor_buffer_usages =
             VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
@@ -558,6 +612,8 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
 
                 return false;
             });
+            buffer_device_address_ranges_version++;
+            buffer_address_snapshot_dirty_.store(true, std::memory_order_release);
         }
     }
     Destroy<vvl::Buffer>(buffer);
@@ -697,6 +753,7 @@ void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, co
     ValidationStateTracker *device_state = static_cast<ValidationStateTracker *>(validation_data);
 
     device_state->instance_state = this;
+    device_state->shared_spirv_modules = shared_spirv_modules;
     // Save local link to this device's physical device state
     device_state->physical_device_state = Get<vvl::PhysicalDevice>(gpu).get();
     // finish setup in the object representing the device
@@ -709,9 +766,44 @@ std::shared_ptr<vvl::Queue> ValidationStateTracker::CreateQueue(VkQueue handle,
     return std::make_shared<vvl::Queue>(*this, handle, family_index, queue_index, flags, queueFamilyProperties);
 }
 
+// A single pool retires the submissions of all queues, instead of one thread per queue.
+// It is created with the first device and released when the last device using it is destroyed.
+static std::shared_ptr<vvl::ThreadPool> GetQueueRetirePool(uint32_t thread_count) {
+    static std::mutex pool_lock;
+    static std::weak_ptr<vvl::ThreadPool> shared_pool;
+
+    std::unique_lock<std::mutex> guard(pool_lock);
+    std::shared_ptr<vvl::ThreadPool> pool = shared_pool.lock();
+    if (!pool) {
+        pool = std::make_shared<vvl::ThreadPool>(thread_count != 0 ? thread_count : vvl::ThreadPool::DefaultThreadCount());
+        shared_pool = pool;
+    }
+    return pool;
+}
+
+// Core checks, best practices, GPU-AV and sync validation all derive from ValidationStateTracker, they share a single pipeline
+// validation pool instead of starting one each. It is released when the last validation object using it is destroyed.
+static std::shared_ptr<vvl::ThreadPool> GetPipelineValidationPool() {
+    static std::mutex pool_lock;
+    static std::weak_ptr<vvl::ThreadPool> shared_pool;
+
+    std::unique_lock<std::mutex> guard(pool_lock);
+    std::shared_ptr<vvl::ThreadPool> pool = shared_pool.lock();
+    if (!pool) {
+        pool = std::make_shared<vvl::ThreadPool>(vvl::ThreadPool::DefaultThreadCount());
+        shared_pool = pool;
+    }
+    return pool;
+}
+
 void ValidationStateTracker::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) {
     GetEnabledDeviceFeatures(pCreateInfo, &enabled_features, api_version);
 
+    queue_retire_pool = GetQueueRetirePool(global_settings.queue_retire_threads);
+    if (global_settings.parallel_pipeline_validation) {
+        pipeline_validation_pool = GetPipelineValidationPool();
+    }
+
     const auto *device_group_ci = vku::FindStructInPNextChain<VkDeviceGroupDeviceCreateInfo>(pCreateInfo->pNext);
     if (device_group_ci) {
         physical_device_count = device_group_ci->physicalDeviceCount;
@@ -1133,10 +1225,36 @@ void ValidationStateTracker::PostCreateDevice(const VkDeviceCreateInfo *pCreateI
     disable_internal_pipeline_cache = cache_control && cache_control->disableInternalCache;
 }
 
+ValidationStateTracker::~ValidationStateTracker() {
+    // What PreCallRecordDestroyDevice did not free, mostly the objects the application leaked
+    vvl::StateObject::TeardownScope teardown;
+    command_buffer_map_.clear();
+    descriptor_set_map_.clear();
+    frame_buffer_map_.clear();
+    pipeline_layout_map_.clear();
+    pipeline_cache_map_.clear();
+    shader_module_map_.clear();
+    sampler_map_.clear();
+    sampler_ycbcr_conversion_map_.clear();
+    acceleration_structure_nv_map_.clear();
+    acceleration_structure_khr_map_.clear();
+    indirect_execution_set_ext_map_.clear();
+    indirect_commands_layout_ext_map_.clear();
+    video_session_parameters_map_.clear();
+    video_session_map_.clear();
+    query_pool_map_.clear();
+    event_map_.clear();
+    fence_map_.clear();
+    semaphore_map_.clear();
+    mem_obj_map_.clear();
+}
+
 void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                                         const RecordObject &record_obj) {
     if (!device) return;
 
+    // The objects go away all together, none of them has to notify or unlink from the others
+    vvl::StateObject::TeardownScope teardown;
     command_pool_map_.clear();
     assert(command_buffer_map_.empty());
     pipeline_map_.clear();
@@ -1152,18 +1270,14 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
     // Because swapchains are associated with Surfaces, which are at instance level,
     // they need to be explicitly destroyed here to avoid continued references to
     // the device we're destroying.
-    for (auto &entry : swapchain_map_.snapshot()) {
-        entry.second->Destroy();
-    }
+    swapchain_map_.ForEach([](const std::shared_ptr<vvl::Swapchain> &swapchain) { swapchain->Destroy(); });
     swapchain_map_.clear();
     image_view_map_.clear();
     image_map_.clear();
     buffer_view_map_.clear();
     buffer_map_.clear();
     // Queues persist until device is destroyed
-    for (auto &entry : queue_map_.snapshot()) {
-        entry.second->Destroy();
-    }
+    queue_map_.ForEach([](const std::shared_ptr<vvl::Queue> &queue) { queue->Destroy(); });
     queue_map_.clear();
 }
 
@@ -1226,7 +1340,7 @@ static void UpdateCmdBufLabelStack(const vvl::CommandBuffer &cb_state, vvl::Queu
     if (queue_state.found_unbalanced_cmdbuf_label) return;
     for (const auto &command : cb_state.GetLabelCommands()) {
         if (command.begin) {
-            queue_state.cmdbuf_label_stack.push_back(command.label_name);
+            queue_state.cmdbuf_label_stack.push_back(command.label_id);
         } else {
             if (queue_state.cmdbuf_label_stack.empty()) {
                 queue_state.found_unbalanced_cmdbuf_label = true;
@@ -1349,7 +1463,6 @@ void ValidationStateTracker::PostCallRecordAllocateMemory(VkDevice device, const
         // Stop tracking handle at this point. It can not be used for import operations anymore.
         // The map's erase is a no-op for externally created handles that are not tracked here.
         // NOTE: In contrast, the successful import does not transfer ownership of a Win32 handle.
-        WriteLockGuard guard(fd_handle_map_lock_);
         fd_handle_map_.erase(import_memory_fd_info->fd);
     }
     Add(CreateDeviceMemoryState(*pMemory, pAllocateInfo, fake_address, memory_type, memory_heap, std::move(dedicated_binding),
@@ -1371,52 +1484,80 @@ void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_
 
     std::vector<vvl::QueueSubmission> submissions;
     submissions.reserve(bindInfoCount);
+    // The binds of each buffer or image bind info are applied to the resource at once
+    std::vector<vvl::BindableMemoryTracker::MemoryBind> memory_binds;
+    std::vector<vvl::BindableSparseImageMemoryTracker::ImageMemoryBind> image_memory_binds;
+    // Consecutive binds usually come from the same allocation
+    VkDeviceMemory last_memory = VK_NULL_HANDLE;
+    std::shared_ptr<vvl::DeviceMemory> last_mem_state;
+    auto get_memory = [this, &last_memory, &last_mem_state](VkDeviceMemory memory) {
+        if (memory != last_memory || !last_mem_state) {
+            last_memory = memory;
+            last_mem_state = Get<vvl::DeviceMemory>(memory);
+        }
+        return last_mem_state;
+    };
     for (uint32_t bind_idx = 0; bind_idx < bindInfoCount; ++bind_idx) {
         const VkBindSparseInfo &bind_info = pBindInfo[bind_idx];
         // Track objects tied to memory
         for (uint32_t j = 0; j < bind_info.bufferBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pBufferBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pBufferBinds[j].pBinds[k];
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (auto buffer_state = Get<vvl::Buffer>(bind_info.pBufferBinds[j].buffer)) {
-                    buffer_state->BindMemory(buffer_state.get(), mem_state, sparse_binding.memoryOffset,
-                                             sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            const VkSparseBufferMemoryBindInfo &buffer_bind_info = bind_info.pBufferBinds[j];
+            auto buffer_state = Get<vvl::Buffer>(buffer_bind_info.buffer);
+            if (!buffer_state) {
+                continue;
+            }
+            memory_binds.clear();
+            memory_binds.reserve(buffer_bind_info.bindCount);
+            for (uint32_t k = 0; k < buffer_bind_info.bindCount; k++) {
+                const VkSparseMemoryBind &sparse_binding = buffer_bind_info.pBinds[k];
+                memory_binds.emplace_back(vvl::BindableMemoryTracker::MemoryBind{
+                    get_memory(sparse_binding.memory), sparse_binding.memoryOffset, sparse_binding.resourceOffset,
+                    sparse_binding.size});
             }
+            buffer_state->BindMemoryBatch(buffer_state.get(), memory_binds);
         }
         for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageOpaqueBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageOpaqueBinds[j].pBinds[k];
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (auto image_state = Get<vvl::Image>(bind_info.pImageOpaqueBinds[j].image)) {
-                    // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
-                    // See: VUID-vkGetImageSubresourceLayout-image-09432
-                    if (!image_state->fragment_encoder) {
-                        image_state->fragment_encoder =
-                            std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
-                    }
-                    image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset,
-                                            sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            const VkSparseImageOpaqueMemoryBindInfo &image_opaque_bind_info = bind_info.pImageOpaqueBinds[j];
+            auto image_state = Get<vvl::Image>(image_opaque_bind_info.image);
+            if (!image_state) {
+                continue;
+            }
+            // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
+            // See: VUID-vkGetImageSubresourceLayout-image-09432
+            if (!image_state->fragment_encoder && image_opaque_bind_info.bindCount != 0) {
+                image_state->fragment_encoder = image_range_encoder_cache_.Get(*image_state);
             }
+            memory_binds.clear();
+            memory_binds.reserve(image_opaque_bind_info.bindCount);
+            for (uint32_t k = 0; k < image_opaque_bind_info.bindCount; k++) {
+                const VkSparseMemoryBind &sparse_binding = image_opaque_bind_info.pBinds[k];
+                memory_binds.emplace_back(vvl::BindableMemoryTracker::MemoryBind{
+                    get_memory(sparse_binding.memory), sparse_binding.memoryOffset, sparse_binding.resourceOffset,
+                    sparse_binding.size});
+            }
+            image_state->BindMemoryBatch(image_state.get(), memory_binds);
         }
         for (uint32_t j = 0; j < bind_info.imageBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageBinds[j].pBinds[k];
-                // TODO: This size is broken for non-opaque bindings, need to update to comprehend full sparse binding data
-                VkDeviceSize size = sparse_binding.extent.depth * sparse_binding.extent.height * sparse_binding.extent.width * 4;
-                VkDeviceSize offset = sparse_binding.offset.z * sparse_binding.offset.y * sparse_binding.offset.x * 4;
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (auto image_state = Get<vvl::Image>(bind_info.pImageBinds[j].image)) {
-                    // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
-                    // See: VUID-vkGetImageSubresourceLayout-image-09432
-                    if (!image_state->fragment_encoder) {
-                        image_state->fragment_encoder =
-                            std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
-                    }
-                    image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset, offset, size);
-                }
+            const VkSparseImageMemoryBindInfo &image_bind_info = bind_info.pImageBinds[j];
+            auto image_state = Get<vvl::Image>(image_bind_info.image);
+            // Only images created with VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT can have image binds
+            vvl::BindableSparseImageMemoryTracker *residency = image_state ? image_state->GetSparseResidency() : nullptr;
+            if (!residency) {
+                continue;
+            }
+            // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
+            // See: VUID-vkGetImageSubresourceLayout-image-09432
+            if (!image_state->fragment_encoder && image_bind_info.bindCount != 0) {
+                image_state->fragment_encoder = image_range_encoder_cache_.Get(*image_state);
+            }
+            image_memory_binds.clear();
+            image_memory_binds.reserve(image_bind_info.bindCount);
+            for (uint32_t k = 0; k < image_bind_info.bindCount; k++) {
+                const VkSparseImageMemoryBind &sparse_binding = image_bind_info.pBinds[k];
+                image_memory_binds.emplace_back(vvl::BindableSparseImageMemoryTracker::ImageMemoryBind{
+                    sparse_binding.subresource, sparse_binding.offset, sparse_binding.extent, get_memory(sparse_binding.memory)});
             }
+            residency->BindImageMemoryBatch(image_state.get(), image_memory_binds);
         }
         auto timeline_info = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
         Location submit_loc = record_obj.location.dot(vvl::Struct::VkBindSparseInfo, vvl::Field::pBindInfo, bind_idx);
@@ -1530,11 +1671,9 @@ void ValidationStateTracker::PostCallRecordWaitSemaphores(VkDevice device, const
     // Same logic as vkWaitForFences(). If some semaphores are not signaled, we will get their status when
     // the application calls vkGetSemaphoreCounterValue() on each of them.
     if ((pWaitInfo->flags & VK_SEMAPHORE_WAIT_ANY_BIT) == 0 || pWaitInfo->semaphoreCount == 1) {
-        const Location wait_info_loc = record_obj.location.dot(vvl::Field::pWaitInfo);
         for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; i++) {
             if (auto semaphore_state = Get<vvl::Semaphore>(pWaitInfo->pSemaphores[i])) {
-                Location wait_value_loc = wait_info_loc.dot(vvl::Field::pValues, i);
-                semaphore_state->RetireWait(nullptr, pWaitInfo->pValues[i], wait_value_loc);
+                ObserveSemaphoreValue(std::move(semaphore_state), pWaitInfo->pValues[i]);
             }
         }
     }
@@ -1549,7 +1688,7 @@ void ValidationStateTracker::PostCallRecordGetSemaphoreCounterValue(VkDevice dev
                                                                     const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
     if (auto semaphore_state = Get<vvl::Semaphore>(semaphore)) {
-        semaphore_state->RetireWait(nullptr, *pValue, record_obj.location);
+        ObserveSemaphoreValue(std::move(semaphore_state), *pValue);
     }
 }
 
@@ -1558,6 +1697,51 @@ void ValidationStateTracker::PostCallRecordGetSemaphoreCounterValueKHR(VkDevice
     PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, record_obj);
 }
 
+void ValidationStateTracker::ObserveSemaphoreValue(std::shared_ptr<vvl::Semaphore> &&semaphore_state, uint64_t payload) {
+    // Polling must not wait for the queue threads, the observation is only published
+    if (!semaphore_state->ObserveValue(payload)) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(observed_semaphores_lock_);
+    auto retired = [](const std::shared_ptr<vvl::Semaphore> &observed) { return !observed->HasPendingObservation(); };
+    observed_semaphores_.erase(std::remove_if(observed_semaphores_.begin(), observed_semaphores_.end(), retired),
+                               observed_semaphores_.end());
+    if (std::find(observed_semaphores_.begin(), observed_semaphores_.end(), semaphore_state) == observed_semaphores_.end()) {
+        observed_semaphores_.emplace_back(std::move(semaphore_state));
+    }
+    has_observed_semaphores_.store(true);
+}
+
+void ValidationStateTracker::WaitObservedSemaphores(const Location &loc) const {
+    if (!has_observed_semaphores_.load()) {
+        return;
+    }
+    std::vector<std::shared_ptr<vvl::Semaphore>> observed;
+    {
+        std::lock_guard<std::mutex> guard(observed_semaphores_lock_);
+        observed = observed_semaphores_;
+    }
+    for (const auto &semaphore_state : observed) {
+        semaphore_state->WaitObservedValue(loc);
+    }
+    // Another thread may have published an observation in the meantime, only drop the retired ones
+    std::lock_guard<std::mutex> guard(observed_semaphores_lock_);
+    auto retired = [](const std::shared_ptr<vvl::Semaphore> &semaphore_state) { return !semaphore_state->HasPendingObservation(); };
+    observed_semaphores_.erase(std::remove_if(observed_semaphores_.begin(), observed_semaphores_.end(), retired),
+                               observed_semaphores_.end());
+    has_observed_semaphores_.store(!observed_semaphores_.empty());
+}
+
+const VulkanTypedHandle *ValidationStateTracker::InUseAfterObservedSemaphores(const vvl::StateObject &obj,
+                                                                              const Location &loc) const {
+    const VulkanTypedHandle *used_handle = obj.InUse();
+    if (used_handle && has_observed_semaphores_.load()) {
+        WaitObservedSemaphores(loc);
+        used_handle = obj.InUse();
+    }
+    return used_handle;
+}
+
 void ValidationStateTracker::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
     if (auto fence_state = Get<vvl::Fence>(fence)) {
@@ -1600,9 +1784,7 @@ void ValidationStateTracker::PostCallRecordDeviceWaitIdle(VkDevice device, const
     // types of bugs in the queue thread.
     std::vector<std::shared_ptr<vvl::Queue>> queues;
     queues.reserve(queue_map_.size());
-    for (const auto &entry : queue_map_.snapshot()) {
-        queues.push_back(entry.second);
-    }
+    queue_map_.ForEach([&queues](const std::shared_ptr<vvl::Queue> &queue) { queues.push_back(queue); });
     std::sort(queues.begin(), queues.end(), [](const auto &q1, const auto &q2) { return q1->GetId() < q2->GetId(); });
 
     // Notify all queues before waiting.
@@ -1762,6 +1944,7 @@ void ValidationStateTracker::PostCallRecordCmdBindShadersEXT(VkCommandBuffer com
                                                              const VkShaderStageFlagBits *pStages, const VkShaderEXT *pShaders,
                                                              const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
     for (uint32_t i = 0; i < stageCount; ++i) {
         vvl::ShaderObject *shader_object_state = nullptr;
         if (pShaders && pShaders[i] != VK_NULL_HANDLE) {
@@ -2071,12 +2254,25 @@ bool ValidationStateTracker::PreCallValidateCreateRayTracingPipelinesKHR(
     VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t count,
     const VkRayTracingPipelineCreateInfoKHR *pCreateInfos, const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
     const ErrorObject &error_obj, PipelineStates &pipeline_states, chassis::CreateRayTracingPipelinesKHR &chassis_state) const {
-    pipeline_states.reserve(count);
+    pipeline_states.resize(count);
     auto pipeline_cache = Get<vvl::PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
-        // Create and initialize internal tracking data structure
-        pipeline_states.push_back(CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache,
-                                                                Get<vvl::PipelineLayout>(pCreateInfos[i].layout), nullptr));
+    // Create and initialize internal tracking data structure
+    auto create_state = [&](uint32_t i) {
+        pipeline_states[i] = CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache,
+                                                           Get<vvl::PipelineLayout>(pCreateInfos[i].layout), nullptr);
+    };
+    // Ray tracing pipelines are often created many at a time (and with a deferred operation the application expects the work
+    // to be spread over threads), copying the create info and the stage states of each of them is independent of the others
+    if (pipeline_validation_pool && count > 1) {
+        vvl::TaskGroup tasks(*pipeline_validation_pool);
+        for (uint32_t i = 0; i < count; i++) {
+            tasks.Post([&create_state, i]() { create_state(i); });
+        }
+        tasks.Wait();
+    } else {
+        for (uint32_t i = 0; i < count; i++) {
+            create_state(i);
+        }
     }
     return false;
 }
@@ -2127,7 +2323,7 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesKHR(
 }
 
 std::shared_ptr<vvl::Sampler> ValidationStateTracker::CreateSamplerState(VkSampler handle, const VkSamplerCreateInfo *create_info) {
-    return std::make_shared<vvl::Sampler>(handle, create_info);
+    return state_object::MakePooledState<vvl::Sampler>(handle, create_info);
 }
 
 void ValidationStateTracker::PostCallRecordCreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo,
@@ -2172,7 +2368,7 @@ std::shared_ptr<vvl::DescriptorPool> ValidationStateTracker::CreateDescriptorPoo
 std::shared_ptr<vvl::DescriptorSet> ValidationStateTracker::CreateDescriptorSet(
     VkDescriptorSet handle, vvl::DescriptorPool *pool, const std::shared_ptr<vvl::DescriptorSetLayout const> &layout,
     uint32_t variable_count) {
-    return std::make_shared<vvl::DescriptorSet>(handle, pool, layout, variable_count, this);
+    return state_object::MakePooledState<vvl::DescriptorSet>(handle, pool, layout, variable_count, this);
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo,
@@ -2826,6 +3022,7 @@ void ValidationStateTracker::PreCallRecordCmdPushDescriptorSetKHR(VkCommandBuffe
                                                                   const VkWriteDescriptorSet *pDescriptorWrites,
                                                                   const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
     auto pipeline_layout = Get<vvl::PipelineLayout>(layout);
     ASSERT_AND_RETURN(pipeline_layout);
     cb_state->PushDescriptorSetState(pipelineBindPoint, *pipeline_layout, record_obj.location.function, set, descriptorWriteCount,
@@ -2836,6 +3033,7 @@ void ValidationStateTracker::PreCallRecordCmdPushDescriptorSet2KHR(VkCommandBuff
                                                                    const VkPushDescriptorSetInfoKHR *pPushDescriptorSetInfo,
                                                                    const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
     auto pipeline_layout = Get<vvl::PipelineLayout>(pPushDescriptorSetInfo->layout);
     ASSERT_AND_RETURN(pipeline_layout);
     if (IsStageInPipelineBindPoint(pPushDescriptorSetInfo->stageFlags, VK_PIPELINE_BIND_POINT_GRAPHICS)) {
@@ -2859,6 +3057,7 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorBuffersEXT(VkCommandB
                                                                       const VkDescriptorBufferBindingInfoEXT *pBindingInfos,
                                                                       const RecordObject &record_obj) {
     auto cb_state = Get<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
 
     cb_state->descriptor_buffer_binding_info.resize(bufferCount);
 
@@ -2869,6 +3068,7 @@ void ValidationStateTracker::PreCallRecordCmdSetDescriptorBufferOffsetsEXT(
     VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet,
     uint32_t setCount, const uint32_t *pBufferIndices, const VkDeviceSize *pOffsets, const RecordObject &record_obj) {
     auto cb_state = Get<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
     auto pipeline_layout = Get<vvl::PipelineLayout>(layout);
     ASSERT_AND_RETURN(pipeline_layout);
 
@@ -2879,6 +3079,7 @@ void ValidationStateTracker::PreCallRecordCmdSetDescriptorBufferOffsets2EXT(
     VkCommandBuffer commandBuffer, const VkSetDescriptorBufferOffsetsInfoEXT *pSetDescriptorBufferOffsetsInfo,
     const RecordObject &record_obj) {
     auto cb_state = Get<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
     auto pipeline_layout = Get<vvl::PipelineLayout>(pSetDescriptorBufferOffsetsInfo->layout);
     ASSERT_AND_RETURN(pipeline_layout);
 
@@ -2925,20 +3126,7 @@ void ValidationStateTracker::PostCallRecordCmdPushConstants(VkCommandBuffer comm
     auto layout_state = Get<vvl::PipelineLayout>(layout);
     cb_state->ResetPushConstantRangesLayoutIfIncompatible(*layout_state);
 
-    vvl::CommandBuffer::PushConstantData push_constant_data;
-    push_constant_data.layout = layout;
-    push_constant_data.stage_flags = stageFlags;
-    push_constant_data.offset = offset;
-    push_constant_data.values.resize(size);
-    auto byte_values = static_cast<const std::byte *>(pValues);
-    std::copy(byte_values, byte_values + size, push_constant_data.values.data());
-    // Always add submitted push constant values, even if the same data is already stored.
-    // Storing duplicated data, or data submitted by one vkCmdPushConstants call
-    // and overridden by a subsequent one is not a problem.
-    // push_constant_data_chunks is intended to be parsed from 0 to N,
-    // thus going through the history in order, so even though it is
-    // possibly suboptimal push constant data is correct.
-    cb_state->push_constant_data_chunks.emplace_back(push_constant_data);
+    cb_state->RecordPushConstants(layout, stageFlags, offset, size, pValues);
 }
 
 void ValidationStateTracker::PostCallRecordCmdPushConstants2KHR(VkCommandBuffer commandBuffer,
@@ -2954,6 +3142,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer com
         return;  // allowed in maintenance6
     }
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
 
     auto buffer_state = Get<vvl::Buffer>(buffer);
     // Being able to set the size was added in VK_KHR_maintenance5 via vkCmdBindIndexBuffer2KHR
@@ -2974,6 +3163,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer2KHR(VkCommandBuffer
         return;  // allowed in maintenance6
     }
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
 
     auto buffer_state = Get<vvl::Buffer>(buffer);
     VkDeviceSize buffer_size = vvl::Buffer::ComputeSize(buffer_state, offset, size);
@@ -3514,8 +3704,7 @@ void ValidationStateTracker::UpdateBindImageMemoryState(const VkBindImageMemoryI
     if (auto image_state = Get<vvl::Image>(bindInfo.image)) {
         // An Android sepcial image cannot get VkSubresourceLayout until the image binds a memory.
         // See: VUID-vkGetImageSubresourceLayout-image-09432
-        image_state->fragment_encoder =
-            std::unique_ptr<const subresource_adapter::ImageRangeEncoder>(new subresource_adapter::ImageRangeEncoder(*image_state));
+        image_state->fragment_encoder = image_range_encoder_cache_.Get(*image_state);
         const auto swapchain_info = vku::FindStructInPNextChain<VkBindImageMemorySwapchainInfoKHR>(bindInfo.pNext);
         if (swapchain_info) {
             if (auto swapchain = Get<vvl::Swapchain>(swapchain_info->swapchain)) {
@@ -3625,14 +3814,12 @@ void ValidationStateTracker::PostCallRecordGetSemaphoreFdKHR(VkDevice device, co
                                                              const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
     if (auto semaphore_state = Get<vvl::Semaphore>(pGetFdInfo->semaphore)) {
-        // Record before locking with the WriteLockGuard
         RecordGetExternalSemaphoreState(*semaphore_state, pGetFdInfo->handleType);
 
         ExternalOpaqueInfo external_info = {};
         external_info.semaphore_flags = semaphore_state->flags;
         external_info.semaphore_type = semaphore_state->type;
 
-        WriteLockGuard guard(fd_handle_map_lock_);
         fd_handle_map_.insert_or_assign(*pFd, external_info);
     }
 }
@@ -3658,7 +3845,6 @@ void ValidationStateTracker::PostCallRecordGetMemoryWin32HandleKHR(VkDevice devi
         external_info.dedicated_buffer = memory_state->GetDedicatedBuffer();
         external_info.dedicated_image = memory_state->GetDedicatedImage();
 
-        WriteLockGuard guard(win32_handle_map_lock_);
         // `insert_or_assign` ensures that information is updated when the system decides to re-use
         // closed handle value for a new handle. The validation layer does not track handle close operation
         // which is performed by 'CloseHandle' system call.
@@ -3679,7 +3865,6 @@ void ValidationStateTracker::PostCallRecordGetMemoryFdKHR(VkDevice device, const
         external_info.dedicated_buffer = memory_state->GetDedicatedBuffer();
         external_info.dedicated_image = memory_state->GetDedicatedImage();
 
-        WriteLockGuard guard(fd_handle_map_lock_);
         // `insert_or_assign` ensures that information is updated when the system decides to re-use
         // closed handle value for a new handle. The fd handle created inside Vulkan _can_ be closed
         // using the 'close' system call, which is not tracked by the validation layer.
@@ -3961,6 +4146,7 @@ void ValidationStateTracker::PostCallRecordCreateInstance(const VkInstanceCreate
     atexit(ApplicationAtExit);
 
     instance_state = this;
+    shared_spirv_modules = std::make_shared<spirv::SharedModuleCache>();
     uint32_t count = 0;
     // this can fail if the allocator fails
     VkResult result = DispatchEnumeratePhysicalDevices(*pInstance, &count, nullptr);
@@ -4336,9 +4522,8 @@ void ValidationStateTracker::PostCallRecordAcquireProfilingLockKHR(VkDevice devi
 
 void ValidationStateTracker::PostCallRecordReleaseProfilingLockKHR(VkDevice device, const RecordObject &record_obj) {
     performance_lock_acquired = false;
-    for (auto &cmd_buffer : command_buffer_map_.snapshot()) {
-        cmd_buffer.second->performance_lock_released = true;
-    }
+    command_buffer_map_.ForEach(
+        [](const std::shared_ptr<vvl::CommandBuffer> &cb_state) { cb_state->performance_lock_released = true; });
 }
 
 void ValidationStateTracker::PreCallRecordDestroyDescriptorUpdateTemplate(VkDevice device,
@@ -4567,16 +4752,8 @@ void ValidationStateTracker::PostCallRecordResetQueryPool(VkDevice device, VkQue
     ASSERT_AND_RETURN(query_pool_state);
 
     // Reset the state of existing entries.
-    const uint32_t max_query_count = std::min(queryCount, query_pool_state->create_info.queryCount - firstQuery);
-    for (uint32_t i = 0; i < max_query_count; ++i) {
-        auto query_index = firstQuery + i;
-        query_pool_state->SetQueryState(query_index, 0, QUERYSTATE_RESET);
-        if (query_pool_state->create_info.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
-            for (uint32_t pass_index = 0; pass_index < query_pool_state->n_performance_passes; pass_index++) {
-                query_pool_state->SetQueryState(query_index, pass_index, QUERYSTATE_RESET);
-            }
-        }
-    }
+    // Resetting sets every pass of the queries
+    query_pool_state->SetQueryStates(firstQuery, queryCount, 0, QUERYSTATE_RESET);
 }
 
 void ValidationStateTracker::PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
@@ -4855,12 +5032,17 @@ void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, co
                                                              const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                              const RecordObject &record_obj,
                                                              chassis::CreateShaderModule &chassis_state) {
-    if (pCreateInfo->codeSize == 0 || !pCreateInfo->pCode) {
+    // Set when the SPIR-V failed validation, it is not safe to parse
+    if (chassis_state.skip || pCreateInfo->codeSize == 0 || !pCreateInfo->pCode) {
         return;
     }
 
+    if (!chassis_state.spirv_hash) {
+        chassis_state.spirv_hash = hash_util::ShaderHash128(pCreateInfo->pCode, pCreateInfo->codeSize);
+    }
     chassis_state.module_state =
-        std::make_shared<spirv::Module>(pCreateInfo->codeSize, pCreateInfo->pCode, &chassis_state.stateless_data);
+        shared_spirv_modules->Get(pCreateInfo->codeSize, pCreateInfo->pCode, &chassis_state.stateless_data,
+                                  spirv_analysis_cache.get(), &*chassis_state.spirv_hash);
     if (chassis_state.module_state && chassis_state.stateless_data.has_group_decoration) {
         spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         spvtools::Optimizer optimizer(spirv_environment);
@@ -4874,8 +5056,9 @@ void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, co
             // Easier to just re-create the ShaderModule as StaticData uses itself when building itself up
             // It is really rare this will get here as Group Decorations have been deprecated and before this was added no one ever
             // raised an issue for a bug that would crash the layers that was around for many releases
-            chassis_state.module_state = std::make_shared<spirv::Module>(optimized_binary.size() * sizeof(uint32_t),
-                                                                         optimized_binary.data(), &chassis_state.stateless_data);
+            chassis_state.module_state =
+                shared_spirv_modules->Get(optimized_binary.size() * sizeof(uint32_t), optimized_binary.data(),
+                                          &chassis_state.stateless_data, spirv_analysis_cache.get());
         }
     }
 }
@@ -4890,8 +5073,9 @@ void ValidationStateTracker::PreCallRecordCreateShadersEXT(VkDevice device, uint
         }
         // don't need to worry about GroupDecoration with VK_EXT_shader_object
         if (pCreateInfos[i].codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT) {
-            chassis_state.module_states[i] = std::make_shared<spirv::Module>(
-                pCreateInfos[i].codeSize, static_cast<const uint32_t *>(pCreateInfos[i].pCode), &chassis_state.stateless_data[i]);
+            chassis_state.module_states[i] = shared_spirv_modules->Get(
+                pCreateInfos[i].codeSize, static_cast<const uint32_t *>(pCreateInfos[i].pCode), &chassis_state.stateless_data[i],
+                spirv_analysis_cache.get());
         }
     }
 }
@@ -5275,6 +5459,7 @@ void ValidationStateTracker::PostCallRecordCmdSetFragmentShadingRateKHR(VkComman
 void ValidationStateTracker::PostCallRecordCmdSetRenderingAttachmentLocationsKHR(
     VkCommandBuffer commandBuffer, const VkRenderingAttachmentLocationInfoKHR *pLocationInfo, const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
 
     cb_state->rendering_attachments.set_color_locations = true;
     cb_state->rendering_attachments.color_locations.resize(pLocationInfo->colorAttachmentCount);
@@ -5286,6 +5471,7 @@ void ValidationStateTracker::PostCallRecordCmdSetRenderingAttachmentLocationsKHR
 void ValidationStateTracker::PostCallRecordCmdSetRenderingInputAttachmentIndicesKHR(VkCommandBuffer commandBuffer,
     const VkRenderingInputAttachmentIndexInfoKHR* pLocationInfo, const RecordObject& record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
 
     cb_state->rendering_attachments.set_color_indexes = true;
     cb_state->rendering_attachments.color_indexes.resize(pLocationInfo->colorAttachmentCount);
@@ -5691,7 +5877,11 @@ void ValidationStateTracker::PostCallRecordGetBufferDeviceAddress(VkDevice devic
                                                                   const RecordObject &record_obj) {
     if (record_obj.device_address == 0) return;
     if (auto buffer_state = Get<vvl::Buffer>(pInfo->buffer)) {
-        WriteLockGuard guard(buffer_address_lock_);
+        std::unique_lock guard(buffer_address_lock_);
+        if (buffer_state->deviceAddress == record_obj.device_address) {
+            // Applications query the address again and again, the buffer is already in the map
+            return;
+        }
         // address is used for GPU-AV and ray tracing buffer validation
         buffer_state->deviceAddress = record_obj.device_address;
         const auto address_range = buffer_state->DeviceAddressRange();
@@ -5699,6 +5889,7 @@ void ValidationStateTracker::PostCallRecordGetBufferDeviceAddress(VkDevice devic
         BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
         sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
         buffer_device_address_ranges_version++;
+        buffer_address_snapshot_dirty_.store(true, std::memory_order_release);
     }
 }
 
@@ -5736,6 +5927,7 @@ void ValidationStateTracker::PostCallRecordCmdBindTransformFeedbackBuffersEXT(Vk
                                                                               const VkDeviceSize *pSizes,
                                                                               const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function);
     cb_state->transform_feedback_buffers_bound = bindingCount;
 }
 
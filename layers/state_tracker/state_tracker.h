@@ -21,17 +21,25 @@
 #pragma once
 #include "generated/chassis.h"
 #include "utils/hash_vk_types.h"
+#include "state_tracker/label_names.h"
 #include "state_tracker/video_session_state.h"
+#include "state_tracker/shader_stage_state.h"
 #include "generated/layer_chassis_dispatch.h"
 #include "generated/device_features.h"
 #include "error_message/logging.h"
 #include "containers/custom_containers.h"
+#include "containers/concurrent_state_map.h"
+#include "containers/node_pool_allocator.h"
 #include "utils/android_ndk_types.h"
 #include "containers/range_vector.h"
+#include "utils/thread_pool.h"
+#include "utils/spirv_analysis_cache.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace vvl {
@@ -79,21 +87,25 @@ struct CreateShaderModule;
 
 namespace spirv {
 struct StatelessData;
+class SharedModuleCache;
 }  // namespace spirv
 
-#define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope)        \
-    vvl::concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member;               \
-    template <typename Dummy>                                                                         \
-    struct MapTraits<state_type, Dummy> {                                                             \
-        static constexpr bool kInstanceScope = instance_scope;                                        \
-        using MapType = decltype(map_member);                                                         \
-        static MapType ValidationStateTracker::*Map() { return &ValidationStateTracker::map_member; } \
+#define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope, buckets_log2) \
+    vvl::ConcurrentStateMap<handle_type, std::shared_ptr<state_type>, buckets_log2> map_member;              \
+    template <typename Dummy>                                                                                \
+    struct MapTraits<state_type, Dummy> {                                                                    \
+        static constexpr bool kInstanceScope = instance_scope;                                               \
+        using MapType = decltype(map_member);                                                                \
+        static MapType ValidationStateTracker::*Map() { return &ValidationStateTracker::map_member; }        \
     };
 
 #define VALSTATETRACK_MAP_AND_TRAITS(handle_type, state_type, map_member) \
-    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, false)
+    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, false, 2)
 #define VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(handle_type, state_type, map_member) \
-    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, true)
+    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, true, 2)
+// For the objects applications create from many threads at once, like shader modules at startup
+#define VALSTATETRACK_MAP_AND_TRAITS_MANY_BUCKETS(handle_type, state_type, map_member) \
+    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, false, 4)
 
 namespace state_object {
 // Traits for State function resolution.  Specializations defined in the macros below.
@@ -115,6 +127,13 @@ struct TraitsBase {
     using ReadLockedType = LockedSharedPtr<const StateType, ReadLockGuard>;
     using WriteLockedType = LockedSharedPtr<StateType, WriteLockGuard>;
 };
+
+// For the state types created and destroyed every frame (buffer and image views, descriptor sets...), takes the object and its
+// control block from a pool of that type instead of the general purpose allocator.
+template <typename State, typename... Args>
+std::shared_ptr<State> MakePooledState(Args &&...args) {
+    return std::allocate_shared<State>(vvl::TypedPoolAllocator<State>(), std::forward<Args>(args)...);
+}
 }  // namespace state_object
 
 #define VALSTATETRACK_STATE_OBJECT(handle_type, state_type)                    \
@@ -277,6 +296,8 @@ class ValidationStateTracker : public ValidationObject {
     }
 
   public:
+    ~ValidationStateTracker() override;
+
     static VkBindImageMemoryInfo ConvertImageMemoryInfo(VkDevice device, VkImage image, VkDeviceMemory mem,
                                                         VkDeviceSize memoryOffset);
 
@@ -308,28 +329,19 @@ class ValidationStateTracker : public ValidationObject {
     template <typename State, typename Fn>
     void ForEachShared(Fn&& fn) const {
         const auto& map = GetStateMap<State>();
-        for (const auto& entry : map.snapshot()) {
-            fn(entry.second);
-        }
+        map.ForEach([&fn](const auto& state) { fn(std::static_pointer_cast<State>(state)); });
     }
 
     template <typename State>
     void ForEach(std::function<void(const State& s)> fn) const {
         const auto& map = GetStateMap<State>();
-        for (const auto& entry : map.snapshot()) {
-            fn(*entry.second);
-        }
+        map.ForEach([&fn](const auto& state) { fn(static_cast<const State&>(*state)); });
     }
 
     template <typename State>
     bool AnyOf(std::function<bool(const State& s)> fn) const {
         const auto& map = GetStateMap<State>();
-        for (const auto& entry : map.snapshot()) {
-            if (fn(*entry.second)) {
-                return true;
-            }
-        }
-        return false;
+        return map.AnyOf([&fn](const auto& state) { return fn(static_cast<const State&>(*state)); });
     }
 
     template <typename State, typename Traits = typename state_object::Traits<State>>
@@ -404,37 +416,69 @@ class ValidationStateTracker : public ValidationObject {
     // more efficient to store them using raw pointers. It is safe to do so (at time of writing) because those raw pointers come
     // from shared ones created when the buffer is first recorded, and they are removed from buffer_address_map_ at BufferDestroy
     // time
-    vvl::span<vvl::Buffer*> GetBuffersByAddress(VkDeviceAddress address) {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer*>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+    using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
+    using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
+    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
+
+    // Immutable copy of buffer_address_map_. Changes to the map only mark the snapshot out of date, the first lookup after a
+    // change rebuilds it. Other lookups load the current one and binary search it, without taking buffer_address_lock_.
+    struct BufferAddressSnapshot {
+        struct Entry {
+            BufferAddressRange range;
+            BufferAddressMapStore buffers;
+        };
+        // buffer_device_address_ranges_version the snapshot was made at
+        uint32_t version = 0;
+        // Sorted and not overlapping, buffers sharing addresses are in the same entries
+        std::vector<Entry> entries;
+
+        const Entry* Find(VkDeviceAddress address) const;
+    };
+    std::shared_ptr<const BufferAddressSnapshot> GetBufferAddressSnapshot() const;
+
+    // Buffers found at an address. Holds on to the snapshot the array comes from, so the array stays readable while the map
+    // changes, but the vvl::Buffer pointers are raw: like the buffer_address_map_ entries, they are only valid until the
+    // application destroys those buffers.
+    class BuffersAtAddress {
+      public:
+        BuffersAtAddress() = default;
+        BuffersAtAddress(std::shared_ptr<const BufferAddressSnapshot>&& snapshot, const BufferAddressMapStore& buffers)
+            : snapshot_(std::move(snapshot)), data_(buffers.data()), size_(buffers.size()) {}
+
+        vvl::Buffer* const* data() const { return data_; }
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        vvl::Buffer* const* begin() const { return data_; }
+        vvl::Buffer* const* end() const { return data_ + size_; }
+        vvl::Buffer* operator[](size_t i) const { return data_[i]; }
+        vvl::Buffer* front() const { return data_[0]; }
 
-    vvl::span<vvl::Buffer* const> GetBuffersByAddress(VkDeviceAddress address) const {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer* const>(nullptr, static_cast<size_t>(0));
+      private:
+        std::shared_ptr<const BufferAddressSnapshot> snapshot_;
+        vvl::Buffer* const* data_ = nullptr;
+        size_t size_ = 0;
+    };
+
+    BuffersAtAddress GetBuffersByAddress(VkDeviceAddress address) const {
+        auto snapshot = GetBufferAddressSnapshot();
+        const BufferAddressSnapshot::Entry* entry = snapshot ? snapshot->Find(address) : nullptr;
+        if (!entry) {
+            return {};
         }
-        return found_it->second;
+        return BuffersAtAddress(std::move(snapshot), entry->buffers);
     }
 
     // Return a count pair, {written addresses count, total address ranges count}
-    using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
     [[nodiscard]] std::pair<size_t, size_t> GetBufferAddressRanges(BufferAddressRange* ranges, size_t ranges_size) const {
-        ReadLockGuard guard(buffer_address_lock_);
-
-        size_t written_count = 0;
-        for (const auto& [address_range, buffers] : buffer_address_map_) {
-            if (written_count == ranges_size) {
-                break;
-            }
-            ranges[written_count++] = address_range;
+        const auto snapshot = GetBufferAddressSnapshot();
+        if (!snapshot) {
+            return {0, 0};
+        }
+        const size_t written_count = std::min(ranges_size, snapshot->entries.size());
+        for (size_t i = 0; i < written_count; ++i) {
+            ranges[i] = snapshot->entries[i].range;
         }
-        return {written_count, buffer_address_map_.size()};
+        return {written_count, snapshot->entries.size()};
     }
 
     using SetImageViewInitialLayoutCallback = std::function<void(vvl::CommandBuffer*, const vvl::ImageView&, VkImageLayout)>;
@@ -1743,8 +1787,7 @@ class ValidationStateTracker : public ValidationObject {
     };
 
     inline std::optional<ExternalOpaqueInfo> GetOpaqueInfoFromFdHandle(int fd) const {
-        ReadLockGuard guard(fd_handle_map_lock_);
-        if (const auto itr = fd_handle_map_.find(fd); itr != fd_handle_map_.cend()) {
+        if (const auto itr = fd_handle_map_.find(fd); itr != fd_handle_map_.end()) {
             return itr->second;
         }
         return {};
@@ -1752,8 +1795,7 @@ class ValidationStateTracker : public ValidationObject {
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     inline std::optional<ExternalOpaqueInfo> GetOpaqueInfoFromWin32Handle(HANDLE handle) const {
-        ReadLockGuard guard(win32_handle_map_lock_);
-        if (const auto itr = win32_handle_map_.find(handle); itr != win32_handle_map_.cend()) {
+        if (const auto itr = win32_handle_map_.find(handle); itr != win32_handle_map_.end()) {
             return itr->second;
         }
         return {};
@@ -1782,6 +1824,13 @@ class ValidationStateTracker : public ValidationObject {
         return false;
     }
 
+    // The host observed timeline semaphore values are retired by the queue threads (see vvl::Semaphore::ObserveValue()).
+    // Validation that needs the state the application observed waits for them first.
+    void ObserveSemaphoreValue(std::shared_ptr<vvl::Semaphore>&& semaphore_state, uint64_t payload);
+    void WaitObservedSemaphores(const Location& loc) const;
+    // InUse() of the object once the observed semaphore values are retired, only waits if the object looks in use
+    const VulkanTypedHandle* InUseAfterObservedSemaphores(const vvl::StateObject& obj, const Location& loc) const;
+
     // Link to the device's physical-device data
     vvl::PhysicalDevice* physical_device_state;
 
@@ -1790,6 +1839,21 @@ class ValidationStateTracker : public ValidationObject {
 
     std::unique_ptr<SetImageViewInitialLayoutCallback> set_image_view_initial_layout_callback;
 
+    // Workers that retire queue submissions, shared by the queues of every device (see GetQueueRetirePool())
+    std::shared_ptr<vvl::ThreadPool> queue_retire_pool;
+    // Only set when parallel pipeline validation is enabled, shared by the validation objects of every device (see
+    // GetPipelineValidationPool()). The pipelines of a create call are validated on it, and the state of ray tracing pipelines is
+    // built on it.
+    std::shared_ptr<vvl::ThreadPool> pipeline_validation_pool;
+
+    // Analysis of the SPIR-V of shader modules and shader objects seen before, only set if a derived class loads one
+    std::unique_ptr<spirv::AnalysisCache> spirv_analysis_cache;
+    // Parsed SPIR-V of the shader modules and shader objects, created with the instance and shared by all its devices
+    std::shared_ptr<spirv::SharedModuleCache> shared_spirv_modules;
+
+    // Names of the labels of vkCmdBeginDebugUtilsLabelEXT, command buffers and queues refer to them by id
+    vvl::LabelNames label_names;
+
     DeviceFeatures enabled_features = {};
     // Device specific data
     VkPhysicalDeviceMemoryProperties phys_dev_mem_props = {};
@@ -1880,9 +1944,8 @@ class ValidationStateTracker : public ValidationObject {
     uint32_t buffer_device_address_ranges_version = 0;
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
-
-    using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
-    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
+    mutable subresource_adapter::ImageRangeEncoderCache image_range_encoder_cache_;
+    mutable ActiveSlotMapCache active_slot_map_cache_;
 
   protected:
     // tracks which queue family index were used when creating the device for quick lookup
@@ -1896,8 +1959,15 @@ class ValidationStateTracker : public ValidationObject {
     };
     std::vector<DeviceQueueInfo> device_queue_info_list;
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
+    // Only written, and read to make the snapshots, with buffer_address_lock_ held. Lookups go through the snapshot.
     BufferAddressRangeMap buffer_address_map_;
-    mutable std::shared_mutex buffer_address_lock_;
+    mutable vvl::ProfiledSharedMutex<vvl::ProfiledLock::BufferAddress> buffer_address_lock_;
+    // Published with an atomic store, nullptr until an address is looked up after one is recorded
+    mutable std::shared_ptr<const BufferAddressSnapshot> buffer_address_snapshot_;
+    // Set with buffer_address_lock_ held for writing, after each change of buffer_address_map_
+    mutable std::atomic<bool> buffer_address_snapshot_dirty_{false};
+    // Called with buffer_address_lock_ held for writing, by the first lookup after a change
+    void PublishBufferAddressSnapshot() const;
 
     // < external format, features >
     vvl::concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
@@ -1912,14 +1982,13 @@ class ValidationStateTracker : public ValidationObject {
     vvl::unordered_map<VkShaderModuleIdentifierEXT, std::shared_ptr<vvl::ShaderModule>> shader_identifier_map_;
     mutable std::shared_mutex shader_identifier_map_lock_;
 
-    // If vkGetMemoryFdKHR is called, keep track of fd handle -> allocation info
-    vvl::unordered_map<int, ExternalOpaqueInfo> fd_handle_map_;
-    mutable std::shared_mutex fd_handle_map_lock_;
+    // If vkGetMemoryFdKHR is called, keep track of fd handle -> allocation info.
+    // Sharded, interop code exports and imports handles from many threads at once.
+    vvl::concurrent_unordered_map<int, ExternalOpaqueInfo, 4> fd_handle_map_;
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     // If vkGetMemoryWin32HandleKHR is called, keep track of HANDLE -> allocation info
-    vvl::unordered_map<HANDLE, ExternalOpaqueInfo> win32_handle_map_;
-    mutable std::shared_mutex win32_handle_map_lock_;
+    vvl::concurrent_unordered_map<HANDLE, ExternalOpaqueInfo, 4> win32_handle_map_;
 #endif
 
   private:
@@ -1934,10 +2003,10 @@ class ValidationStateTracker : public ValidationObject {
     VALSTATETRACK_MAP_AND_TRAITS(VkBuffer, vvl::Buffer, buffer_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkPipelineCache, vvl::PipelineCache, pipeline_cache_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkPipeline, vvl::Pipeline, pipeline_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkShaderEXT, vvl::ShaderObject, shader_object_map_)
+    VALSTATETRACK_MAP_AND_TRAITS_MANY_BUCKETS(VkShaderEXT, vvl::ShaderObject, shader_object_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDeviceMemory, vvl::DeviceMemory, mem_obj_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkFramebuffer, vvl::Framebuffer, frame_buffer_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkShaderModule, vvl::ShaderModule, shader_module_map_)
+    VALSTATETRACK_MAP_AND_TRAITS_MANY_BUCKETS(VkShaderModule, vvl::ShaderModule, shader_module_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorUpdateTemplate, vvl::DescriptorUpdateTemplate, desc_template_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkSwapchainKHR, vvl::Swapchain, swapchain_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorPool, vvl::DescriptorPool, descriptor_pool_map_)
@@ -1961,6 +2030,11 @@ class ValidationStateTracker : public ValidationObject {
 
     std::atomic<vvl::StateObject::IdType> object_id_{1}; // 0 is an invalid id
 
+    // Semaphores with a pending host observation, checked without the lock by InUseAfterObservedSemaphores()
+    mutable std::mutex observed_semaphores_lock_;
+    mutable std::vector<std::shared_ptr<vvl::Semaphore>> observed_semaphores_;
+    mutable std::atomic<bool> has_observed_semaphores_{false};
+
     // Simple base address allocator allow allow VkDeviceMemory allocations to appear to exist in a common address space.
     // At 256GB allocated/sec  ( > 8GB at 30Hz), will overflow in just over 2 years
     class FakeAllocator {
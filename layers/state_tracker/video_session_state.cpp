@@ -27,9 +27,11 @@ VideoProfileDesc::VideoProfileDesc(VkPhysicalDevice physical_device, VkVideoProf
       physical_device_(physical_device),
       profile_(),
       capabilities_(),
+      hash_(0),
       cache_(nullptr) {
+    // The capabilities are only queried by the cache, for the profiles it has not seen yet
     if (InitProfile(profile)) {
-        InitCapabilities(physical_device);
+        hash_ = ComputeHash();
     }
 }
 
@@ -201,29 +203,48 @@ void VideoProfileDesc::InitCapabilities(VkPhysicalDevice physical_device) {
     }
 }
 
+std::shared_ptr<const VideoProfileDesc> VideoProfileDesc::Cache::Find(const VideoProfileDesc &key) {
+    auto set_it = entries_.find(key.physical_device_);
+    if (set_it == entries_.end()) {
+        return nullptr;
+    }
+    auto it = set_it->second.find(&key);
+    if (it == set_it->second.end()) {
+        return nullptr;
+    }
+    // The entry can be in the middle of being destroyed, in which case it is replaced
+    return (*it)->weak_from_this().lock();
+}
+
 std::shared_ptr<const VideoProfileDesc> VideoProfileDesc::Cache::GetOrCreate(VkPhysicalDevice physical_device,
                                                                              VkVideoProfileInfoKHR const *profile) {
-    VideoProfileDesc desc(physical_device, profile);
-    if (desc.GetProfile().valid) {
-        auto &set = entries_[physical_device];
-        auto it = set.find(&desc);
-        if (it != set.end()) {
-            return (*it)->shared_from_this();
-        } else {
-            auto desc_ptr = std::make_shared<VideoProfileDesc>(desc);
-            desc_ptr->cache_ = this;
-            set.emplace(desc_ptr.get());
-            return desc_ptr;
-        }
-    } else {
+    VideoProfileDesc key(physical_device, profile);
+    if (!key.GetProfile().valid) {
         return nullptr;
     }
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (auto desc = Find(key)) {
+            return desc;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (auto desc = Find(key)) {
+        return desc;
+    }
+    auto desc_ptr = std::make_shared<VideoProfileDesc>(physical_device, profile);
+    desc_ptr->InitCapabilities(physical_device);
+    desc_ptr->cache_ = this;
+    auto &set = entries_[physical_device];
+    set.erase(desc_ptr.get());
+    set.emplace(desc_ptr.get());
+    return desc_ptr;
 }
 
 std::shared_ptr<const VideoProfileDesc> VideoProfileDesc::Cache::Get(VkPhysicalDevice physical_device,
                                                                      VkVideoProfileInfoKHR const *profile) {
     if (profile) {
-        std::unique_lock<std::mutex> lock(mutex_);
         return GetOrCreate(physical_device, profile);
     } else {
         return nullptr;
@@ -234,7 +255,6 @@ SupportedVideoProfiles VideoProfileDesc::Cache::Get(VkPhysicalDevice physical_de
                                                     VkVideoProfileListInfoKHR const *profile_list) {
     SupportedVideoProfiles supported_profiles{};
     if (profile_list) {
-        std::unique_lock<std::mutex> lock(mutex_);
         for (uint32_t i = 0; i < profile_list->profileCount; ++i) {
             auto profile_desc = GetOrCreate(physical_device, &profile_list->pProfiles[i]);
             if (profile_desc) {
@@ -246,8 +266,13 @@ SupportedVideoProfiles VideoProfileDesc::Cache::Get(VkPhysicalDevice physical_de
 }
 
 void VideoProfileDesc::Cache::Release(VideoProfileDesc const *desc) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    entries_[desc->physical_device_].erase(desc);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto &set = entries_[desc->physical_device_];
+    // An equal profile created while this one was being destroyed replaced it already
+    auto it = set.find(desc);
+    if (it != set.end() && *it == desc) {
+        set.erase(it);
+    }
 }
 
 VideoPictureResource::VideoPictureResource()
@@ -327,10 +352,8 @@ VideoPictureID::VideoPictureID(VideoProfileDesc const &profile, VkVideoReference
 
 void VideoSessionDeviceState::Reset() {
     initialized_ = true;
-    for (size_t i = 0; i < is_active_.size(); ++i) {
-        is_active_[i] = false;
-        all_pictures_[i].clear();
-        pictures_per_id_[i].clear();
+    for (Slot &slot : slots_) {
+        slot.Clear();
     }
     encode_.quality_level = 0;
     encode_.rate_control_state = VideoEncodeRateControlState();
@@ -339,74 +362,53 @@ void VideoSessionDeviceState::Reset() {
 void VideoSessionDeviceState::Activate(int32_t slot_index, const VideoPictureID &picture_id, const VideoPictureResource &res) {
     assert(!picture_id.IsBothFields());
 
-    if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= is_active_.size()) {
-        // Out-of-bounds slot index
+    Slot *slot = GetSlot(slot_index);
+    if (!slot) {
         return;
     }
 
-    is_active_[slot_index] = true;
-
     if (picture_id.IsFrame()) {
         // If slot is activated with a frame then it overrides all previous pictures
-        all_pictures_[slot_index].clear();
-        pictures_per_id_[slot_index].clear();
-    }
-
-    auto prev_res_it = pictures_per_id_[slot_index].find(picture_id);
-    if (prev_res_it != pictures_per_id_[slot_index].end()) {
-        // If we replace an existing picture then remove it
-        all_pictures_[slot_index].erase(prev_res_it->second);
+        slot->Clear();
     }
 
-    all_pictures_[slot_index].insert(res);
-    pictures_per_id_[slot_index][picture_id] = res;
+    // This replaces any existing picture with the same id
+    const uint32_t kind = PictureKind(picture_id);
+    slot->active = true;
+    slot->picture_mask |= 1u << kind;
+    slot->pictures[kind] = res;
 }
 
 void VideoSessionDeviceState::Invalidate(int32_t slot_index, const VideoPictureID &picture_id) {
     assert(!picture_id.IsBothFields());
 
-    if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= is_active_.size()) {
-        // Out-of-bounds slot index
+    Slot *slot = GetSlot(slot_index);
+    if (!slot) {
         return;
     }
 
-    bool previous_is_frame = pictures_per_id_[slot_index].find(VideoPictureID::Frame()) != pictures_per_id_[slot_index].end();
-    if (picture_id.IsFrame() || previous_is_frame) {
+    const uint32_t frame_kind = PictureKind(VideoPictureID::Frame());
+    if (picture_id.IsFrame() || slot->HasPicture(frame_kind)) {
         // If invalidation happens due to a non-reference setup frame then it invalidates all previous pictures
         // Also invalidate all if the previous picture reference was a frame (e.g. a field invalidates a previous frame)
-        all_pictures_[slot_index].clear();
-        pictures_per_id_[slot_index].clear();
+        slot->Clear();
     } else {
         // Invalidate any existing picture reference with the specified id by removing it
-        auto prev_res_it = pictures_per_id_[slot_index].find(picture_id);
-        if (prev_res_it != pictures_per_id_[slot_index].end()) {
-            VideoPictureResource res = prev_res_it->second;
-            pictures_per_id_[slot_index].erase(picture_id);
-            // Check if there are any more references to the previous resource
-            auto other_ref_it = std::find_if(std::begin(pictures_per_id_[slot_index]), std::end(pictures_per_id_[slot_index]),
-                                             [&res](const auto &it) { return it.second == res; });
-            if (other_ref_it == pictures_per_id_[slot_index].end()) {
-                // If there are no remaining references to the resource, remove it
-                all_pictures_[slot_index].erase(res);
-            }
-        }
+        const uint32_t kind = PictureKind(picture_id);
+        slot->picture_mask &= ~(1u << kind);
+        slot->pictures[kind] = VideoPictureResource();
     }
 
     // If there are no remaining picture references then deactivate the slot
-    if (pictures_per_id_[slot_index].empty()) {
-        is_active_[slot_index] = false;
+    if (slot->picture_mask == 0) {
+        slot->active = false;
     }
 }
 
 void VideoSessionDeviceState::Deactivate(int32_t slot_index) {
-    if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= is_active_.size()) {
-        // Out-of-bounds slot index
-        return;
+    if (Slot *slot = GetSlot(slot_index)) {
+        slot->Clear();
     }
-
-    is_active_[slot_index] = false;
-    all_pictures_[slot_index].clear();
-    pictures_per_id_[slot_index].clear();
 }
 
 class RateControlStateMismatchRecorder {
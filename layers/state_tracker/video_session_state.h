@@ -18,8 +18,12 @@
 #include "state_tracker/state_object.h"
 #include "utils/hash_util.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <utility>
 #include <vector>
 #include <functional>
 
@@ -105,6 +109,9 @@ class VideoProfileDesc : public std::enable_shared_from_this<VideoProfileDesc> {
     struct compare {
       public:
         bool operator()(VideoProfileDesc const *lhs, VideoProfileDesc const *rhs) const {
+            if (lhs->hash_ != rhs->hash_) {
+                return false;
+            }
             bool match = lhs->profile_.base.videoCodecOperation == rhs->profile_.base.videoCodecOperation &&
                          lhs->profile_.base.chromaSubsampling == rhs->profile_.base.chromaSubsampling &&
                          lhs->profile_.base.lumaBitDepth == rhs->profile_.base.lumaBitDepth &&
@@ -155,46 +162,7 @@ class VideoProfileDesc : public std::enable_shared_from_this<VideoProfileDesc> {
 
     struct hash {
       public:
-        std::size_t operator()(VideoProfileDesc const *desc) const {
-            hash_util::HashCombiner hc;
-            hc << desc->profile_.base.videoCodecOperation << desc->profile_.base.chromaSubsampling
-               << desc->profile_.base.lumaBitDepth << desc->profile_.base.chromaBitDepth;
-
-            if (desc->profile_.is_decode) {
-                hc << desc->profile_.decode_usage.videoUsageHints;
-            }
-
-            if (desc->profile_.is_encode) {
-                hc << desc->profile_.encode_usage.videoUsageHints << desc->profile_.encode_usage.videoContentHints
-                   << desc->profile_.encode_usage.tuningMode;
-            }
-
-            switch (desc->profile_.base.videoCodecOperation) {
-                case VK_VIDEO_CODEC_OPERATION_DECODE_H264_BIT_KHR: {
-                    hc << desc->profile_.decode_h264.stdProfileIdc << desc->profile_.decode_h264.pictureLayout;
-                    break;
-                }
-                case VK_VIDEO_CODEC_OPERATION_DECODE_H265_BIT_KHR: {
-                    hc << desc->profile_.decode_h265.stdProfileIdc;
-                    break;
-                }
-                case VK_VIDEO_CODEC_OPERATION_DECODE_AV1_BIT_KHR: {
-                    hc << desc->profile_.decode_av1.stdProfile << desc->profile_.decode_av1.filmGrainSupport;
-                    break;
-                }
-                case VK_VIDEO_CODEC_OPERATION_ENCODE_H264_BIT_KHR: {
-                    hc << desc->profile_.encode_h264.stdProfileIdc;
-                    break;
-                }
-                case VK_VIDEO_CODEC_OPERATION_ENCODE_H265_BIT_KHR: {
-                    hc << desc->profile_.encode_h265.stdProfileIdc;
-                    break;
-                }
-                default:
-                    break;
-            }
-            return hc.Value();
-        }
+        std::size_t operator()(VideoProfileDesc const *desc) const { return desc->hash_; }
     };
 
     // The cache maintains non-owning references to all VideoProfileDesc objects that are referred to by shared
@@ -204,6 +172,8 @@ class VideoProfileDesc : public std::enable_shared_from_this<VideoProfileDesc> {
     // deep compare of the structure chains.
     // Once all shared pointers to a VideoProfileDesc go away the destructor will call Release() to remove the
     // non-owning reference to the to-be-deleted object.
+    // Lookups are done under a shared lock, only a profile seen for the first time takes the lock exclusively and queries
+    // its capabilities.
     class Cache {
       public:
         std::shared_ptr<const VideoProfileDesc> Get(VkPhysicalDevice physical_device, VkVideoProfileInfoKHR const *profile);
@@ -214,16 +184,61 @@ class VideoProfileDesc : public std::enable_shared_from_this<VideoProfileDesc> {
         using PerDeviceVideoProfileDescSet =
             unordered_set<VideoProfileDesc const *, VideoProfileDesc::hash, VideoProfileDesc::compare>;
 
-        std::mutex mutex_;
+        std::shared_mutex mutex_;
         unordered_map<VkPhysicalDevice, PerDeviceVideoProfileDescSet> entries_;
 
+        // Returns nullptr if the profile is not in the cache, must be called with mutex_ held
+        std::shared_ptr<const VideoProfileDesc> Find(const VideoProfileDesc &key);
         std::shared_ptr<const VideoProfileDesc> GetOrCreate(VkPhysicalDevice physical_device, VkVideoProfileInfoKHR const *profile);
     };
 
   private:
+    std::size_t ComputeHash() const {
+        hash_util::HashCombiner hc;
+        hc << profile_.base.videoCodecOperation << profile_.base.chromaSubsampling << profile_.base.lumaBitDepth
+           << profile_.base.chromaBitDepth;
+
+        if (profile_.is_decode) {
+            hc << profile_.decode_usage.videoUsageHints;
+        }
+
+        if (profile_.is_encode) {
+            hc << profile_.encode_usage.videoUsageHints << profile_.encode_usage.videoContentHints
+               << profile_.encode_usage.tuningMode;
+        }
+
+        switch (profile_.base.videoCodecOperation) {
+            case VK_VIDEO_CODEC_OPERATION_DECODE_H264_BIT_KHR: {
+                hc << profile_.decode_h264.stdProfileIdc << profile_.decode_h264.pictureLayout;
+                break;
+            }
+            case VK_VIDEO_CODEC_OPERATION_DECODE_H265_BIT_KHR: {
+                hc << profile_.decode_h265.stdProfileIdc;
+                break;
+            }
+            case VK_VIDEO_CODEC_OPERATION_DECODE_AV1_BIT_KHR: {
+                hc << profile_.decode_av1.stdProfile << profile_.decode_av1.filmGrainSupport;
+                break;
+            }
+            case VK_VIDEO_CODEC_OPERATION_ENCODE_H264_BIT_KHR: {
+                hc << profile_.encode_h264.stdProfileIdc;
+                break;
+            }
+            case VK_VIDEO_CODEC_OPERATION_ENCODE_H265_BIT_KHR: {
+                hc << profile_.encode_h265.stdProfileIdc;
+                break;
+            }
+            default:
+                break;
+        }
+        return hc.Value();
+    }
+
     VkPhysicalDevice physical_device_;
     Profile profile_;
     Capabilities capabilities_;
+    // Hash of the profile, computed once as the cache compares profiles by hash first
+    std::size_t hash_;
     Cache *cache_;
 
     bool InitProfile(VkVideoProfileInfoKHR const *profile);
@@ -275,8 +290,59 @@ class VideoPictureResource {
     VkImageSubresourceRange GetImageSubresourceRange(ImageView const *image_view_state, uint32_t layer);
 };
 
-using VideoPictureResources = unordered_set<VideoPictureResource, VideoPictureResource::hash>;
-using BoundVideoPictureResources = unordered_map<VideoPictureResource, int32_t, VideoPictureResource::hash>;
+// A video coding command only refers to a few picture resources (at most the DPB slots of the session), so these are kept in
+// small arrays searched linearly instead of hashed
+class VideoPictureResources {
+  public:
+    // Returns false if the resource was added before
+    bool Insert(const VideoPictureResource &res) {
+        if (std::find(resources_.begin(), resources_.end(), res) != resources_.end()) {
+            return false;
+        }
+        resources_.emplace_back(res);
+        return true;
+    }
+
+  private:
+    small_vector<VideoPictureResource, 8, uint32_t> resources_;
+};
+
+// The picture resources bound by vkCmdBeginVideoCodingKHR and the DPB slot index each is associated with (-1 if none)
+class BoundVideoPictureResources {
+  public:
+    using value_type = std::pair<VideoPictureResource, int32_t>;
+    using Resources = small_vector<value_type, 8, uint32_t>;
+    using iterator = Resources::iterator;
+    using const_iterator = Resources::const_iterator;
+
+    iterator begin() { return resources_.begin(); }
+    iterator end() { return resources_.end(); }
+    const_iterator begin() const { return resources_.begin(); }
+    const_iterator end() const { return resources_.end(); }
+
+    iterator find(const VideoPictureResource &res) {
+        return std::find_if(resources_.begin(), resources_.end(), [&res](const value_type &entry) { return entry.first == res; });
+    }
+    const_iterator find(const VideoPictureResource &res) const { return const_cast<BoundVideoPictureResources *>(this)->find(res); }
+    // Does not replace the slot index of a resource that is bound already
+    void emplace(value_type &&entry) {
+        if (find(entry.first) == end()) {
+            resources_.emplace_back(std::move(entry));
+        }
+    }
+    int32_t &operator[](const VideoPictureResource &res) {
+        auto it = find(res);
+        if (it != resources_.end()) {
+            return it->second;
+        }
+        resources_.emplace_back(res, 0);
+        return resources_.back().second;
+    }
+    void clear() { resources_.clear(); }
+
+  private:
+    Resources resources_;
+};
 
 struct VideoPictureID {
     // Used by H.264 to indicate it's a top field picture
@@ -419,37 +485,31 @@ struct VideoEncodeRateControlState {
 
 class VideoSessionDeviceState {
   public:
-    VideoSessionDeviceState(uint32_t reference_slot_count = 0)
-        : initialized_(false),
-          is_active_(reference_slot_count, false),
-          all_pictures_(reference_slot_count),
-          pictures_per_id_(reference_slot_count),
-          encode_() {}
+    VideoSessionDeviceState(uint32_t reference_slot_count = 0) : initialized_(false), slots_(reference_slot_count), encode_() {}
 
     bool IsInitialized() const { return initialized_; }
     bool IsSlotActive(int32_t slot_index) const {
-        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= is_active_.size()) {
-            // Out-of-bounds slot index
-            return false;
-        }
-        return is_active_[slot_index];
+        const Slot *slot = GetSlot(slot_index);
+        return slot && slot->active;
     }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureResource &res) const {
-        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= all_pictures_.size()) {
-            // Out-of-bounds slot index
+        const Slot *slot = GetSlot(slot_index);
+        if (!slot) {
             return false;
         }
-        return all_pictures_[slot_index].find(res) != all_pictures_[slot_index].end();
+        for (uint32_t kind = 0; kind < kPictureKindCount; ++kind) {
+            if (slot->HasPicture(kind) && slot->pictures[kind] == res) {
+                return true;
+            }
+        }
+        return false;
     }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureID &picture_id, const VideoPictureResource &res) const {
-        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= pictures_per_id_.size()) {
-            // Out-of-bounds slot index
-            return false;
-        }
-        auto it = pictures_per_id_[slot_index].find(picture_id);
-        return it != pictures_per_id_[slot_index].end() && it->second == res;
+        const Slot *slot = GetSlot(slot_index);
+        const uint32_t kind = PictureKind(picture_id);
+        return slot && slot->HasPicture(kind) && slot->pictures[kind] == res;
     }
 
     uint32_t GetEncodeQualityLevel() const { return encode_.quality_level; }
@@ -469,10 +529,38 @@ class VideoSessionDeviceState {
                                   const vku::safe_VkVideoBeginCodingInfoKHR &begin_info, const Location &loc) const;
 
   private:
+    // A DPB slot holds at most a frame, a top field and a bottom field picture
+    static constexpr uint32_t kPictureKindCount = 3;
+    static uint32_t PictureKind(const VideoPictureID &picture_id) {
+        return picture_id.IsTopField() ? 1 : (picture_id.IsBottomField() ? 2 : 0);
+    }
+
+    struct Slot {
+        bool active = false;
+        // Bit i is set if pictures[i] is a valid picture reference
+        uint8_t picture_mask = 0;
+        std::array<VideoPictureResource, kPictureKindCount> pictures;
+
+        bool HasPicture(uint32_t kind) const { return (picture_mask & (1u << kind)) != 0; }
+        void Clear() {
+            active = false;
+            picture_mask = 0;
+            pictures.fill(VideoPictureResource());
+        }
+    };
+
+    const Slot *GetSlot(int32_t slot_index) const {
+        if (slot_index < 0 || static_cast<uint32_t>(slot_index) >= slots_.size()) {
+            // Out-of-bounds slot index
+            return nullptr;
+        }
+        return &slots_[slot_index];
+    }
+    Slot *GetSlot(int32_t slot_index) { return const_cast<Slot *>(std::as_const(*this).GetSlot(slot_index)); }
+
     bool initialized_;
-    std::vector<bool> is_active_;
-    std::vector<VideoPictureResources> all_pictures_;
-    std::vector<unordered_map<VideoPictureID, VideoPictureResource, VideoPictureID::hash>> pictures_per_id_;
+    // Indexed by the DPB slot index
+    std::vector<Slot> slots_;
 
     struct {
         uint32_t quality_level{0};
@@ -0,0 +1,210 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stateless/sl_create_info_cache.h"
+
+#include <mutex>
+#include <type_traits>
+
+#include "error_message/logging.h"
+
+// A chain longer than this is not worth caching (and could be a cycle, which validation reports)
+static constexpr uint32_t kMaxCachedPnextCount = 8;
+
+// Appends the bytes of one field. Fields are appended one at a time so the padding between them (after sType, before a
+// handle...) never ends up in the key
+template <typename T>
+static void AppendField(const T &value, std::string &key) {
+    static_assert(std::is_trivially_copyable_v<T> && (std::is_scalar_v<T> || std::has_unique_object_representations_v<T>),
+                  "Only fields without padding can be appended as a whole");
+    key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+static void AppendField(const VkClearColorValue &value, std::string &key) {
+    for (uint32_t component : value.uint32) {
+        AppendField(component, key);
+    }
+}
+
+// Only structs made of plain values can be part of the key, the ones with pointers are left out (return false)
+static bool AppendSamplerPnext(const VkBaseInStructure &next, std::string &key) {
+    switch (next.sType) {
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO: {
+            const auto &info = reinterpret_cast<const VkSamplerReductionModeCreateInfo &>(next);
+            AppendField(info.reductionMode, key);
+            return true;
+        }
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO: {
+            const auto &info = reinterpret_cast<const VkSamplerYcbcrConversionInfo &>(next);
+            AppendField(info.conversion, key);
+            return true;
+        }
+        case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT: {
+            const auto &info = reinterpret_cast<const VkSamplerCustomBorderColorCreateInfoEXT &>(next);
+            AppendField(info.customBorderColor, key);
+            AppendField(info.format, key);
+            return true;
+        }
+        case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT: {
+            const auto &info = reinterpret_cast<const VkSamplerBorderColorComponentMappingCreateInfoEXT &>(next);
+            AppendField(info.components, key);
+            AppendField(info.srgb, key);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+static bool AppendImageViewPnext(const VkBaseInStructure &next, std::string &key) {
+    switch (next.sType) {
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO: {
+            const auto &info = reinterpret_cast<const VkImageViewUsageCreateInfo &>(next);
+            AppendField(info.usage, key);
+            return true;
+        }
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO: {
+            const auto &info = reinterpret_cast<const VkSamplerYcbcrConversionInfo &>(next);
+            AppendField(info.conversion, key);
+            return true;
+        }
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT: {
+            const auto &info = reinterpret_cast<const VkImageViewASTCDecodeModeEXT &>(next);
+            AppendField(info.decodeMode, key);
+            return true;
+        }
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT: {
+            const auto &info = reinterpret_cast<const VkImageViewMinLodCreateInfoEXT &>(next);
+            AppendField(info.minLod, key);
+            return true;
+        }
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_SLICED_CREATE_INFO_EXT: {
+            const auto &info = reinterpret_cast<const VkImageViewSlicedCreateInfoEXT &>(next);
+            AppendField(info.sliceOffset, key);
+            AppendField(info.sliceCount, key);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+static bool AppendBufferViewPnext(const VkBaseInStructure &next, std::string &key) {
+    switch (next.sType) {
+        case VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR: {
+            const auto &info = reinterpret_cast<const VkBufferUsageFlags2CreateInfoKHR &>(next);
+            AppendField(info.usage, key);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+static void AppendCreateInfo(const VkSamplerCreateInfo &info, std::string &key) {
+    AppendField(info.flags, key);
+    AppendField(info.magFilter, key);
+    AppendField(info.minFilter, key);
+    AppendField(info.mipmapMode, key);
+    AppendField(info.addressModeU, key);
+    AppendField(info.addressModeV, key);
+    AppendField(info.addressModeW, key);
+    AppendField(info.mipLodBias, key);
+    AppendField(info.anisotropyEnable, key);
+    AppendField(info.maxAnisotropy, key);
+    AppendField(info.compareEnable, key);
+    AppendField(info.compareOp, key);
+    AppendField(info.minLod, key);
+    AppendField(info.maxLod, key);
+    AppendField(info.borderColor, key);
+    AppendField(info.unnormalizedCoordinates, key);
+}
+
+static void AppendCreateInfo(const VkImageViewCreateInfo &info, std::string &key) {
+    AppendField(info.flags, key);
+    AppendField(info.image, key);
+    AppendField(info.viewType, key);
+    AppendField(info.format, key);
+    AppendField(info.components, key);
+    AppendField(info.subresourceRange, key);
+}
+
+static void AppendCreateInfo(const VkBufferViewCreateInfo &info, std::string &key) {
+    AppendField(info.flags, key);
+    AppendField(info.buffer, key);
+    AppendField(info.format, key);
+    AppendField(info.offset, key);
+    AppendField(info.range, key);
+}
+
+template <typename CreateInfo>
+StatelessCreateInfoCache::Lookup StatelessCreateInfoCache::Find(const CreateInfo *create_info, PnextAppendFunc append_pnext,
+                                                                const VkAllocationCallbacks *allocator, const void *handle) const {
+    Lookup lookup;
+    // Null pointers and the allocation callbacks are checked too, only the common case is cached
+    if (!create_info || allocator || !handle) {
+        return lookup;
+    }
+    AppendCreateInfo(*create_info, lookup.key);
+    uint32_t pnext_count = 0;
+    for (auto *next = static_cast<const VkBaseInStructure *>(create_info->pNext); next; next = next->pNext) {
+        if (++pnext_count > kMaxCachedPnextCount) {
+            return Lookup{};
+        }
+        // The sType tells apart structs whose fields happen to have the same bytes
+        AppendField(next->sType, lookup.key);
+        if (!append_pnext(*next, lookup.key)) {
+            return Lookup{};
+        }
+    }
+
+    lookup.cacheable = true;
+    lookup.message_count = DebugReport::ThreadMessageCount();
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    lookup.validated = entries_.find(lookup.key) != entries_.end();
+    return lookup;
+}
+
+StatelessCreateInfoCache::Lookup StatelessCreateInfoCache::Find(const VkSamplerCreateInfo *create_info,
+                                                                const VkAllocationCallbacks *allocator,
+                                                                const VkSampler *sampler) const {
+    return Find(create_info, AppendSamplerPnext, allocator, sampler);
+}
+
+StatelessCreateInfoCache::Lookup StatelessCreateInfoCache::Find(const VkImageViewCreateInfo *create_info,
+                                                                const VkAllocationCallbacks *allocator,
+                                                                const VkImageView *view) const {
+    return Find(create_info, AppendImageViewPnext, allocator, view);
+}
+
+StatelessCreateInfoCache::Lookup StatelessCreateInfoCache::Find(const VkBufferViewCreateInfo *create_info,
+                                                                const VkAllocationCallbacks *allocator,
+                                                                const VkBufferView *view) const {
+    return Find(create_info, AppendBufferViewPnext, allocator, view);
+}
+
+void StatelessCreateInfoCache::Insert(Lookup &lookup, bool skip) {
+    // Anything logged, even a warning, has to be logged again for the next identical create
+    if (!lookup.cacheable || lookup.validated || skip || DebugReport::ThreadMessageCount() != lookup.message_count) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    if (entries_.size() >= kMaxEntries) {
+        entries_.clear();
+    }
+    entries_.emplace(std::move(lookup.key));
+}
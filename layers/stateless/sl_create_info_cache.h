@@ -0,0 +1,64 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+
+#include <vulkan/vulkan_core.h>
+
+#include "containers/custom_containers.h"
+
+// Remembers the create infos of vkCreateSampler, vkCreateImageView and vkCreateBufferView that passed stateless validation
+// without logging anything. The checks only depend on the create info and the device, so an identical create can skip them.
+//
+// The key holds the fields of the create info, then the sType and the fields of each pNext struct, appended one by one so the
+// struct padding is never part of it. Creates using allocation callbacks or a pNext struct not listed in sl_create_info_cache.cpp
+// (such as the ones holding pointers) are always validated.
+class StatelessCreateInfoCache {
+  public:
+    struct Lookup {
+        std::string key;
+        bool cacheable = false;
+        // The create info passed before, the checks can be skipped
+        bool validated = false;
+        // Messages logged by the calling thread before the checks ran
+        uint64_t message_count = 0;
+    };
+
+    Lookup Find(const VkSamplerCreateInfo *create_info, const VkAllocationCallbacks *allocator, const VkSampler *sampler) const;
+    Lookup Find(const VkImageViewCreateInfo *create_info, const VkAllocationCallbacks *allocator, const VkImageView *view) const;
+    Lookup Find(const VkBufferViewCreateInfo *create_info, const VkAllocationCallbacks *allocator, const VkBufferView *view) const;
+
+    // Remembers the create info of the lookup if its checks did not skip the call and logged nothing
+    void Insert(Lookup &lookup, bool skip);
+
+  private:
+    // Appends the fields of a pNext struct to the key, returns false if the struct can't be part of a key
+    using PnextAppendFunc = bool (*)(const VkBaseInStructure &, std::string &);
+    template <typename CreateInfo>
+    Lookup Find(const CreateInfo *create_info, PnextAppendFunc append_pnext, const VkAllocationCallbacks *allocator,
+                const void *handle) const;
+
+    // The whole cache is dropped when it gets this big, streaming usually recreates the same few samplers and views
+    static constexpr size_t kMaxEntries = 1024;
+
+    mutable std::shared_mutex lock_;
+    vvl::unordered_set<std::string> entries_;
+};
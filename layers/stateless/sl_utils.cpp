@@ -18,12 +18,14 @@
 
 #include "stateless/stateless_validation.h"
 
+#include <cstring>
+
 #include "generated/chassis.h"
 
 bool StatelessValidation::CheckPromotedApiAgainstVulkanVersion(VkInstance instance, const Location &loc,
                                                                const uint32_t promoted_version) const {
     bool skip = false;
-    if (api_version < promoted_version) {
+    if (api_version < promoted_version && IsErrorReportable("UNASSIGNED-API-Version-Violation")) {
         skip |= LogError("UNASSIGNED-API-Version-Violation", instance, loc,
                          "Attempted to call with an effective API version of %s"
                          "but this API was not promoted until version %s.",
@@ -38,7 +40,7 @@ bool StatelessValidation::CheckPromotedApiAgainstVulkanVersion(VkPhysicalDevice
     const auto &target_pdev = physical_device_properties_map.find(pdev);
     if (target_pdev != physical_device_properties_map.end()) {
         auto effective_api_version = std::min(APIVersion(target_pdev->second->apiVersion), api_version);
-        if (effective_api_version < promoted_version) {
+        if (effective_api_version < promoted_version && IsErrorReportable("UNASSIGNED-API-Version-Violation")) {
             skip |= LogError(
                 "UNASSIGNED-API-Version-Violation", instance, loc,
                 "Attempted to call with an effective API version of %s, "
@@ -52,6 +54,9 @@ bool StatelessValidation::CheckPromotedApiAgainstVulkanVersion(VkPhysicalDevice
 }
 
 bool StatelessValidation::OutputExtensionError(const Location &loc, const vvl::Extensions &exentsions) const {
+    if (!IsErrorReportable("UNASSIGNED-GeneralParameterError-ExtensionNotEnabled")) {
+        return false;
+    }
     return LogError("UNASSIGNED-GeneralParameterError-ExtensionNotEnabled", instance, loc,
                     "function required extension %s which has not been enabled.\n", String(exentsions).c_str());
 }
@@ -70,6 +75,70 @@ bool StatelessValidation::SupportedByPdev(const VkPhysicalDevice physical_device
     return false;
 }
 
+bool StatelessValidation::LogCountZero(const char *vuid, const Location &loc) const {
+    return LogError(vuid, device, loc, "must be greater than 0.");
+}
+
+bool StatelessValidation::LogNull(const char *vuid, const Location &loc) const { return LogError(vuid, device, loc, "is NULL."); }
+
+bool StatelessValidation::LogNullHandle(const Location &loc) const {
+    return LogError("UNASSIGNED-GeneralParameterError-RequiredHandle", device, loc, "is VK_NULL_HANDLE.");
+}
+
+bool StatelessValidation::LogNullHandleArray(const Location &array_loc, uint32_t index) const {
+    return LogError("UNASSIGNED-GeneralParameterError-RequiredHandleArray", device, array_loc.dot(index), "is VK_NULL_HANDLE.");
+}
+
+bool StatelessValidation::LogWrongSType(const char *vuid, const Location &loc, VkStructureType sType) const {
+    return LogError(vuid, device, loc.dot(Field::sType), "must be %s.", string_VkStructureType(sType));
+}
+
+bool StatelessValidation::LogWrongSTypeArray(const char *vuid, const Location &array_loc, uint32_t index,
+                                             VkStructureType sType) const {
+    return LogError(vuid, device, array_loc.dot(index).dot(Field::sType), "must be %s", string_VkStructureType(sType));
+}
+
+bool StatelessValidation::LogEnumNotFound(const char *vuid, const Location &loc, uint32_t value, vvl::Enum name) const {
+    return LogError(vuid, device, loc,
+                    "(%" PRIu32
+                    ") does not fall within the begin..end range of the %s enumeration tokens and is "
+                    "not an extension added token.",
+                    value, String(name));
+}
+
+bool StatelessValidation::LogEnumNoExtension(const char *vuid, const Location &loc, const char *description,
+                                             const vvl::Extensions &extensions) const {
+    return LogError(vuid, device, loc, "(%s) requires the extensions %s.", description, String(extensions).c_str());
+}
+
+bool StatelessValidation::LogPnextExtensionNotEnabled(const char *vuid, const Location &loc, const char *stype_name,
+                                                      const char *extension_names) const {
+    return LogError(vuid, instance, loc.dot(Field::pNext),
+                    "includes a pointer to a VkStructureType (%s), but its parent extension %s has not been enabled.", stype_name,
+                    extension_names);
+}
+
+bool StatelessValidation::LogPnextFeatureExtensionNotEnabled(const char *vuid, const Location &pnext_loc, const char *struct_name,
+                                                             const char *extension_names) const {
+    return LogError(vuid, instance, pnext_loc,
+                    "includes a pointer to a %s, but when creating VkDevice, the parent extension (%s) was not included in "
+                    "ppEnabledExtensionNames.",
+                    struct_name, extension_names);
+}
+
+bool StatelessValidation::LogPnextExtensionsRequired(const char *vuid, const Location &pnext_loc,
+                                                     const char *extension_names) const {
+    return LogError(vuid, instance, pnext_loc, "extended struct requires the extensions %s", extension_names);
+}
+
+bool StatelessValidation::LogPnextApiVersionTooLow(const char *vuid, const Location &loc, const char *stype_name,
+                                                   const char *version_name, uint32_t device_api_version) const {
+    return LogError(vuid, instance, loc.dot(Field::pNext),
+                    "includes a pointer to a VkStructureType (%s) which was added in %s but the current effective API version is "
+                    "%s.",
+                    stype_name, version_name, StringAPIVersion(APIVersion(device_api_version)).c_str());
+}
+
 static const uint8_t kUtF8OneByteCode = 0xC0;
 static const uint8_t kUtF8OneByteMask = 0xE0;
 static const uint8_t kUtF8TwoByteCode = 0xE0;
@@ -244,8 +313,6 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
     bool skip = false;
 
     if (next != nullptr) {
-        vvl::unordered_set<const void *> cycle_check;
-        vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
         const char *disclaimer =
             "This error is based on the Valid Usage documentation for version %" PRIu32
             " of the Vulkan header.  It is possible that "
@@ -254,6 +321,9 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
 
         const Location pNext_loc = loc.dot(Field::pNext);
         if ((allowed_type_count == 0) && (GetCustomStypeInfo().empty())) {
+            if (!IsErrorReportable(pnext_vuid)) {
+                return skip;
+            }
             std::string message = "must be NULL. ";
             message += disclaimer;
             skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), header_version, pNext_loc.Fields().c_str());
@@ -261,17 +331,19 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
             const VkStructureType *start = allowed_types;
             const VkStructureType *end = allowed_types + allowed_type_count;
             const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
+            // Chains are only a few structs long, searching the types seen so far is cheaper than hashing them
+            small_vector<VkStructureType, 8> unique_stypes;
 
             while (current != nullptr) {
                 if ((loc.function != Func::vkCreateInstance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
                     (loc.function != Func::vkCreateDevice || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                    std::string type_name = string_VkStructureType(current->sType);
-                    if (unique_stype_check.find(current->sType) != unique_stype_check.end() && !IsDuplicatePnext(current->sType)) {
+                    if (std::find(unique_stypes.begin(), unique_stypes.end(), current->sType) == unique_stypes.end()) {
+                        unique_stypes.emplace_back(current->sType);
+                    } else if (!IsDuplicatePnext(current->sType)) {
                         // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                         skip |= LogError(stype_vuid, device, pNext_loc,
-                                         "chain contains duplicate structure types: %s appears multiple times.", type_name.c_str());
-                    } else {
-                        unique_stype_check.insert(current->sType);
+                                         "chain contains duplicate structure types: %s appears multiple times.",
+                                         string_VkStructureType(current->sType));
                     }
 
                     // Search custom stype list -- if sType found, skip this entirely
@@ -283,9 +355,10 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                         }
                     }
                     if (!custom) {
-                        if (std::find(start, end, current->sType) == end) {
+                        if (std::find(start, end, current->sType) == end && IsErrorReportable(pnext_vuid)) {
+                            const char *type_name = string_VkStructureType(current->sType);
                             // String returned by string_VkStructureType for an unrecognized type.
-                            if (type_name.compare("Unhandled VkStructureType") == 0) {
+                            if (strcmp(type_name, "Unhandled VkStructureType") == 0) {
                                 std::string message = "chain includes a structure with unknown VkStructureType (%" PRIu32 "). ";
                                 message += disclaimer;
                                 skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), current->sType, header_version,
@@ -293,7 +366,7 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                             } else {
                                 std::string message = "chain includes a structure with unexpected VkStructureType %s. ";
                                 message += disclaimer;
-                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name.c_str(), header_version,
+                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name, header_version,
                                                  pNext_loc.Fields().c_str());
                             }
                         }
@@ -453,7 +526,7 @@ bool StatelessValidation::ValidateFlags(const Location &loc, vvl::FlagBitmask fl
 
     if (!skip && value != 0) {
         vvl::Extensions required = IsValidFlagValue(flag_bitmask, value, device_extensions);
-        if (!required.empty() && device != VK_NULL_HANDLE) {
+        if (!required.empty() && device != VK_NULL_HANDLE && IsErrorReportable(vuid)) {
             // If called from an instance function, there is no device to base extension support off of
             skip |= LogError(vuid, device, loc, "has %s values (%s) that requires the extensions %s.", String(flag_bitmask),
                              DescribeFlagBitmaskValue(flag_bitmask, value).c_str(), String(required).c_str());
@@ -494,7 +567,7 @@ bool StatelessValidation::ValidateFlags(const Location &loc, vvl::FlagBitmask fl
 
     if (!skip && value != 0) {
         vvl::Extensions required = IsValidFlag64Value(flag_bitmask, value, device_extensions);
-        if (!required.empty() && device != VK_NULL_HANDLE) {
+        if (!required.empty() && device != VK_NULL_HANDLE && IsErrorReportable(vuid)) {
             // If called from an instance function, there is no device to base extension support off of
             skip |= LogError(vuid, device, loc, "has %s values (%s) that requires the extensions %s.", String(flag_bitmask),
                              DescribeFlagBitmaskValue64(flag_bitmask, value).c_str(), String(required).c_str());
@@ -528,7 +601,15 @@ bool StatelessValidation::ValidateFlagsArray(const Location &count_loc, const Lo
         // Flag arrays always need to have a valid array
         skip |= ValidateArray(count_loc, array_loc, count, &array, count_required, true, count_required_vuid, array_required_vuid);
     } else {
-        // Verify that all VkFlags values in the array
+        // Verify that all VkFlags values in the array. OR-ing them together first is a loop the compiler vectorizes, the
+        // elements only need to be looked at one by one to report the ones with unknown bits.
+        VkFlags used_flags = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            used_flags |= array[i];
+        }
+        if ((used_flags & (~all_flags)) == 0) {
+            return skip;
+        }
         for (uint32_t i = 0; i < count; ++i) {
             if ((array[i] & (~all_flags)) != 0) {
                 skip |= LogError(array_required_vuid, device, array_loc.dot(i),
@@ -21,7 +21,7 @@
 namespace vvl {
 
 const std::string &GetPipelineBinaryInfoVUID(const Location &loc, PipelineBinaryInfoError error) {
-    static const std::map<PipelineBinaryInfoError, std::array<Entry, 5>> errors{
+    static const std::map<PipelineBinaryInfoError, VuidTable> errors{
         {PipelineBinaryInfoError::PNext_09616,
          {{
              {Key(Func::vkCreateGraphicsPipelines), "VUID-vkCreateGraphicsPipelines-pNext-09616"},
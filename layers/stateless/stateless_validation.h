@@ -25,8 +25,9 @@
 #include "utils/vk_layer_utils.h"
 #include "generated/chassis.h"
 #include "generated/device_features.h"
+#include "stateless/sl_create_info_cache.h"
 
-class StatelessValidation : public ValidationObject {
+class StatelessValidation final : public ValidationObject {
     using Func = vvl::Func;
     using Struct = vvl::Struct;
     using Field = vvl::Field;
@@ -67,6 +68,9 @@ class StatelessValidation : public ValidationObject {
     };
     DeviceExtensionProperties phys_dev_ext_props = {};
 
+    // Create infos of vkCreateSampler, vkCreateImageView and vkCreateBufferView that passed validation before
+    mutable StatelessCreateInfoCache create_info_cache;
+
     struct SubpassesUsageStates {
         vvl::unordered_set<uint32_t> subpasses_using_color_attachment;
         vvl::unordered_set<uint32_t> subpasses_using_depthstencil_attachment;
@@ -82,6 +86,25 @@ class StatelessValidation : public ValidationObject {
     StatelessValidation() { container_type = LayerObjectTypeParameterValidation; }
     ~StatelessValidation() {}
 
+    // Error reporting of the checks below, kept out of line so the inlined checks stay small
+    VVL_COLD bool LogCountZero(const char *vuid, const Location &loc) const;
+    VVL_COLD bool LogNull(const char *vuid, const Location &loc) const;
+    VVL_COLD bool LogNullHandle(const Location &loc) const;
+    VVL_COLD bool LogNullHandleArray(const Location &array_loc, uint32_t index) const;
+    VVL_COLD bool LogWrongSType(const char *vuid, const Location &loc, VkStructureType sType) const;
+    VVL_COLD bool LogWrongSTypeArray(const char *vuid, const Location &array_loc, uint32_t index, VkStructureType sType) const;
+    VVL_COLD bool LogEnumNotFound(const char *vuid, const Location &loc, uint32_t value, vvl::Enum name) const;
+    VVL_COLD bool LogEnumNoExtension(const char *vuid, const Location &loc, const char *description,
+                                     const vvl::Extensions &extensions) const;
+    // Used by the generated pNext checks, the extension names are already joined
+    VVL_COLD bool LogPnextExtensionNotEnabled(const char *vuid, const Location &loc, const char *stype_name,
+                                              const char *extension_names) const;
+    VVL_COLD bool LogPnextFeatureExtensionNotEnabled(const char *vuid, const Location &pnext_loc, const char *struct_name,
+                                                     const char *extension_names) const;
+    VVL_COLD bool LogPnextExtensionsRequired(const char *vuid, const Location &pnext_loc, const char *extension_names) const;
+    VVL_COLD bool LogPnextApiVersionTooLow(const char *vuid, const Location &loc, const char *stype_name, const char *version_name,
+                                           uint32_t device_api_version) const;
+
     bool ValidateNotZero(bool is_zero, const std::string &vuid, const Location &loc) const;
 
     bool ValidateRequiredPointer(const Location &loc, const void *value, const std::string &vuid) const;
@@ -95,12 +118,12 @@ class StatelessValidation : public ValidationObject {
 
         // Count parameters not tagged as optional cannot be 0
         if (countRequired && (count == 0)) {
-            skip |= LogError(count_required_vuid, device, count_loc, "must be greater than 0.");
+            skip |= LogCountZero(count_required_vuid, count_loc);
         }
 
         // Array parameters not tagged as optional cannot be NULL, unless the count is 0
         if (arrayRequired && (count != 0) && (*array == nullptr)) {
-            skip |= LogError(array_required_vuid, device, array_loc, "is NULL.");
+            skip |= LogNull(array_required_vuid, array_loc);
         }
 
         return skip;
@@ -136,7 +159,7 @@ class StatelessValidation : public ValidationObject {
 
         if (count == nullptr) {
             if (countPtrRequired) {
-                skip |= LogError(count_ptr_required_vuid, device, count_loc, "is NULL.");
+                skip |= LogNull(count_ptr_required_vuid, count_loc);
             }
         } else {
             skip |= ValidateArray(count_loc, array_loc, *array ? (*count) : 0, &array, countValueRequired, arrayRequired,
@@ -166,10 +189,10 @@ class StatelessValidation : public ValidationObject {
 
         if (value == nullptr) {
             if (required) {
-                skip |= LogError(struct_vuid, device, loc, "is NULL.");
+                skip |= LogNull(struct_vuid, loc);
             }
         } else if (value->sType != sType) {
-            skip |= LogError(stype_vuid, device, loc.dot(Field::sType), "must be %s.", string_VkStructureType(sType));
+            skip |= LogWrongSType(stype_vuid, loc, sType);
         }
 
         return skip;
@@ -204,8 +227,7 @@ class StatelessValidation : public ValidationObject {
             // Verify that all structs in the array have the correct type
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i].sType != sType) {
-                    skip |= LogError(stype_vuid, device, array_loc.dot(i).dot(Field::sType), "must be %s",
-                                     string_VkStructureType(sType));
+                    skip |= LogWrongSTypeArray(stype_vuid, array_loc, i, sType);
                 }
             }
         }
@@ -242,8 +264,7 @@ class StatelessValidation : public ValidationObject {
             // Verify that all structs in the array have the correct type
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i]->sType != sType) {
-                    skip |= LogError(stype_vuid, device, array_loc.dot(i).dot(Field::sType), "must be %s",
-                                     string_VkStructureType(sType));
+                    skip |= LogWrongSTypeArray(stype_vuid, array_loc, i, sType);
                 }
             }
         }
@@ -278,7 +299,7 @@ class StatelessValidation : public ValidationObject {
 
         if (count == nullptr) {
             if (countPtrRequired) {
-                skip |= LogError(count_ptr_required_vuid, device, count_loc, "is NULL.");
+                skip |= LogNull(count_ptr_required_vuid, count_loc);
             }
         } else {
             skip |= ValidateStructTypeArray(count_loc, array_loc, (*count), array, sType, countValueRequired && (array != nullptr),
@@ -302,7 +323,7 @@ class StatelessValidation : public ValidationObject {
         bool skip = false;
 
         if (value == VK_NULL_HANDLE) {
-            skip |= LogError("UNASSIGNED-GeneralParameterError-RequiredHandle", device, loc, "is VK_NULL_HANDLE.");
+            skip |= LogNullHandle(loc);
         }
         return skip;
     }
@@ -340,8 +361,7 @@ class StatelessValidation : public ValidationObject {
             // Verify that no handles in the array are VK_NULL_HANDLE
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i] == VK_NULL_HANDLE) {
-                    skip |= LogError("UNASSIGNED-GeneralParameterError-RequiredHandleArray", device, array_loc.dot(i),
-                                     "is VK_NULL_HANDLE.");
+                    skip |= LogNullHandleArray(array_loc, i);
                 }
             }
         }
@@ -400,16 +420,11 @@ class StatelessValidation : public ValidationObject {
         ValidValue result = IsValidEnumValue(value);
 
         if (result == ValidValue::NotFound) {
-            skip |= LogError(vuid, device, loc,
-                             "(%" PRIu32
-                             ") does not fall within the begin..end range of the %s enumeration tokens and is "
-                             "not an extension added token.",
-                             value, String(name));
-        } else if (result == ValidValue::NoExtension && device != VK_NULL_HANDLE) {
+            skip |= LogEnumNotFound(vuid, loc, static_cast<uint32_t>(value), name);
+        } else if (result == ValidValue::NoExtension && device != VK_NULL_HANDLE && IsErrorReportable(vuid)) {
             // If called from an instance function, there is no device to base extension support off of
             auto extensions = GetEnumExtensions(value);
-            skip |=
-                LogError(vuid, device, loc, "(%s) requires the extensions %s.", DescribeEnum(value), String(extensions).c_str());
+            skip |= LogEnumNoExtension(vuid, loc, DescribeEnum(value), extensions);
         }
 
         return skip;
@@ -446,19 +461,24 @@ class StatelessValidation : public ValidationObject {
             skip |= ValidateArray(count_loc, array_loc, count, &array, countRequired, arrayRequired, count_required_vuid,
                                   array_required_vuid);
         } else {
+            // Arrays such as descriptor types or formats often repeat a value, the result for it is already known
+            const T *last_valid = nullptr;
             for (uint32_t i = 0; i < count; ++i) {
+                if (last_valid && array[i] == *last_valid) {
+                    continue;
+                }
                 ValidValue result = IsValidEnumValue(array[i]);
+                if (result == ValidValue::Valid) {
+                    last_valid = &array[i];
+                    continue;
+                }
                 if (result == ValidValue::NotFound) {
-                    skip |= LogError(array_required_vuid, device, array_loc.dot(i),
-                                     "(%" PRIu32
-                                     ") does not fall within the begin..end range of the %s enumeration tokens and is "
-                                     "not an extension added token.",
-                                     array[i], String(name));
-                } else if (result == ValidValue::NoExtension && device != VK_NULL_HANDLE) {
+                    skip |= LogEnumNotFound(array_required_vuid, array_loc.dot(i), static_cast<uint32_t>(array[i]), name);
+                } else if (result == ValidValue::NoExtension && device != VK_NULL_HANDLE &&
+                           IsErrorReportable(array_required_vuid)) {
                     // If called from an instance function, there is no device to base extension support off of
                     auto extensions = GetEnumExtensions(array[i]);
-                    skip |= LogError(array_required_vuid, device, array_loc.dot(i), "(%s) requires the extensions %s.",
-                                     DescribeEnum(array[i]), String(extensions).c_str());
+                    skip |= LogEnumNoExtension(array_required_vuid, array_loc.dot(i), DescribeEnum(array[i]), extensions);
                 }
             }
         }
@@ -20,6 +20,7 @@
 #include "state_tracker/render_pass_state.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_image.h"
+#include "utils/thread_pool.h"
 
 bool SimpleBinding(const vvl::Bindable &bindable) { return !bindable.sparse && bindable.Binding(); }
 VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer) { return buffer.GetFakeBaseAddress(); }
@@ -70,35 +71,59 @@ class HazardDetectFirstUse {
     const ResourceUsageRange &tag_range_;
 };
 
-AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
-                             const std::vector<SubpassDependencyGraphNode> &dependencies,
+RenderPassBarrierSchedule::RenderPassBarrierSchedule(VkQueueFlags queue_flags_,
+                                                     const std::vector<SubpassDependencyGraphNode> &dependencies)
+    : queue_flags(queue_flags_) {
+    auto make_barriers = [this](const std::vector<const VkSubpassDependency2 *> &subpass_dependencies) {
+        std::vector<SyncBarrier> barriers;
+        barriers.reserve(subpass_dependencies.size());
+        for (const VkSubpassDependency2 *dependency : subpass_dependencies) {
+            assert(dependency);
+            barriers.emplace_back(queue_flags, *dependency);
+        }
+        return barriers;
+    };
+
+    subpasses.resize(dependencies.size());
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+        const SubpassDependencyGraphNode &subpass_dep = dependencies[i];
+        Subpass &subpass = subpasses[i];
+        subpass.prev.reserve(subpass_dep.prev.size());
+        for (const auto &prev_dep : subpass_dep.prev) {
+            assert(prev_dep.second.size());
+            subpass.prev.emplace_back(prev_dep.first->pass, make_barriers(prev_dep.second));
+        }
+        subpass.async = subpass_dep.async;
+        subpass.from_external = make_barriers(subpass_dep.barrier_from_external);
+        subpass.to_external = make_barriers(subpass_dep.barrier_to_external);
+    }
+}
+
+AccessContext::AccessContext(uint32_t subpass, const RenderPassBarrierSchedule &barrier_schedule,
                              const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
     Reset();
-    const auto &subpass_dep = dependencies[subpass];
-    const bool has_barrier_from_external = subpass_dep.barrier_from_external.size() > 0U;
-    prev_.reserve(subpass_dep.prev.size() + (has_barrier_from_external ? 1U : 0U));
+    const auto &subpass_barriers = barrier_schedule.subpasses[subpass];
+    const bool has_barrier_from_external = subpass_barriers.from_external.size() > 0U;
+    prev_.reserve(subpass_barriers.prev.size() + (has_barrier_from_external ? 1U : 0U));
     prev_by_subpass_.resize(subpass, nullptr);  // Can't be more prevs than the subpass we're on
-    for (const auto &prev_dep : subpass_dep.prev) {
-        const auto prev_pass = prev_dep.first->pass;
-        const auto &prev_barriers = prev_dep.second;
-        assert(prev_dep.second.size());
-        prev_.emplace_back(&contexts[prev_pass], queue_flags, prev_barriers);
+    for (const auto &[prev_pass, prev_barriers] : subpass_barriers.prev) {
+        prev_.emplace_back(&contexts[prev_pass], prev_barriers);
         prev_by_subpass_[prev_pass] = &prev_.back();
     }
 
-    async_.reserve(subpass_dep.async.size());
-    for (const auto async_subpass : subpass_dep.async) {
+    async_.reserve(subpass_barriers.async.size());
+    for (const auto async_subpass : subpass_barriers.async) {
         // Start tags are not known at creation time (as it's done at BeginRenderpass)
         async_.emplace_back(contexts[async_subpass], kInvalidTag, kQueueIdInvalid);
     }
 
     if (has_barrier_from_external) {
         // Store the barrier from external with the reat, but save pointer for "by subpass" lookups.
-        prev_.emplace_back(external_context, queue_flags, subpass_dep.barrier_from_external);
+        prev_.emplace_back(external_context, subpass_barriers.from_external);
         src_external_ = &prev_.back();
     }
-    if (subpass_dep.barrier_to_external.size()) {
-        dst_external_ = TrackBack(this, queue_flags, subpass_dep.barrier_to_external);
+    if (subpass_barriers.to_external.size()) {
+        dst_external_ = TrackBack(this, subpass_barriers.to_external);
     }
 }
 
@@ -121,6 +146,11 @@ void AccessContext::TrimAndClearFirstAccess() {
     Trim(normalize);
 }
 
+void AccessContext::Consolidate() {
+    FlushGlobalBarriers();
+    sparse_container::consolidate(access_state_map_);
+}
+
 void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
     auto gather = [&used](const ResourceAccessRangeMap::value_type &access) { access.second.GatherReferencedTags(used); };
     ConstForAll(gather);
@@ -128,6 +158,7 @@ void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
 
 template <typename Action>
 void AccessContext::ForAll(Action &&action) {
+    FlushGlobalBarriers();
     for (auto &access : access_state_map_) {
         action(access);
     }
@@ -135,12 +166,22 @@ void AccessContext::ForAll(Action &&action) {
 
 template <typename Action>
 void AccessContext::ConstForAll(Action &&action) const {
+    FlushGlobalBarriers();
     for (auto &access : access_state_map_) {
         action(access);
     }
 }
 
 void AccessContext::ResolveFromContext(const AccessContext &from) {
+    if (access_state_map_.empty() && from.prev_.empty()) {
+        // Nothing to resolve against and no previous contexts to infill from, so the result is a copy of the accesses.
+        // This is the common case of a queue batch starting from the state of the previous batch, and copying the map
+        // avoids the lookups, splits and merges of the parallel walk. The pending global barriers of from come along.
+        access_state_map_ = from.access_state_map_;
+        pending_global_barriers_ = from.pending_global_barriers_;
+        return;
+    }
+    FlushGlobalBarriers();
     const NoopBarrierAction noop_barrier;
     from.ResolveAccessRange(kFullRange, noop_barrier, &access_state_map_, nullptr);
 }
@@ -175,6 +216,7 @@ void AccessContext::ResolvePreviousAccesses() {
     ResourceAccessState default_state;
     if (!prev_.size()) return;  // If no previous contexts, nothing to do
 
+    FlushGlobalBarriers();
     ResolvePreviousAccess(kFullRange, &access_state_map_, &default_state);
 }
 
@@ -188,7 +230,52 @@ void AccessContext::UpdateAccessState(const vvl::Buffer &buffer, SyncStageAccess
     }
     const auto base_address = ResourceBaseAddress(buffer);
     UpdateMemoryAccessStateFunctor action(*this, current_usage, ordering_rule, tag_ex);
-    UpdateMemoryAccessRangeState(access_state_map_, action, range + base_address);
+    UpdateMemoryAccessRangeState(action, range + base_address);
+}
+
+void BufferAccessBatch::Add(const vvl::Buffer &buffer, SyncStageAccessIndex usage, SyncOrdering ordering_rule,
+                            const ResourceAccessRange &range, ResourceUsageTagEx tag_ex) {
+    if (usage == SYNC_ACCESS_INDEX_NONE || range.empty() || !SimpleBinding(buffer)) {
+        return;
+    }
+    const uint32_t index = static_cast<uint32_t>(accesses_.size());
+    accesses_.emplace_back(Access{range + ResourceBaseAddress(buffer), usage, ordering_rule, tag_ex, index});
+}
+
+void AccessContext::UpdateAccessState(BufferAccessBatch &batch) {
+    auto &accesses = batch.accesses_;
+    if (accesses.empty()) {
+        return;
+    }
+    std::sort(accesses.begin(), accesses.end(), [](const BufferAccessBatch::Access &a, const BufferAccessBatch::Access &b) {
+        return a.range.begin < b.range.begin || (a.range.begin == b.range.begin && a.index < b.index);
+    });
+    // Accesses to disjoint ranges can be applied in any order. Overlapping accesses can not: a write clears the reads applied
+    // before it, but not the ones applied after it. If any ranges overlap, go back to recording order.
+    ResourceAccessRange::index_type max_end = accesses.front().range.end;
+    for (size_t i = 1; i < accesses.size(); ++i) {
+        if (accesses[i].range.begin < max_end) {
+            std::sort(accesses.begin(), accesses.end(),
+                      [](const BufferAccessBatch::Access &a, const BufferAccessBatch::Access &b) { return a.index < b.index; });
+            break;
+        }
+        max_end = std::max(max_end, accesses[i].range.end);
+    }
+
+    // infill_update_range returns the position following the range, which is a valid hint for any later range that starts at or
+    // after its end. Any other range needs a new lookup.
+    auto pos = access_state_map_.lower_bound(accesses.front().range);
+    ResourceAccessRange::index_type previous_end = accesses.front().range.begin;
+    for (const auto &access : accesses) {
+        if (access.range.begin < previous_end) {
+            pos = access_state_map_.lower_bound(access.range);
+        }
+        UpdateMemoryAccessStateFunctor action(*this, access.usage, access.ordering_rule, access.tag_ex);
+        ActionToOpsAdapter<UpdateMemoryAccessStateFunctor> ops{action, *this};
+        pos = sparse_container::infill_update_range(access_state_map_, pos, access.range, ops);
+        previous_end = access.range.end;
+    }
+    accesses.clear();
 }
 
 void AccessContext::UpdateAccessState(const ImageState &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -254,6 +341,7 @@ void AccessContext::UpdateAccessState(const ImageRangeGen &range_gen, SyncStageA
 }
 
 void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &contexts) {
+    FlushGlobalBarriers();
     for (uint32_t subpass_index = 0; subpass_index < contexts.size(); subpass_index++) {
         auto &context = contexts[subpass_index];
         ApplyTrackbackStackAction barrier_action(context.GetDstExternalTrackBack().barriers);
@@ -536,9 +624,27 @@ void AccessContext::UpdateMemoryAccessStateFunctor::operator()(const ResourceAcc
 // This is called with the *recorded* command buffers access context, with the *active* access context pass in, againsts which
 // hazards will be detected
 HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                                 const AccessContext &access_context) const {
+                                                 const AccessContext &access_context, vvl::ThreadPool *pool) const {
+    // The recorded states are read directly
+    FlushGlobalBarriers();
+    // Below this the walk is cheaper than handing it to the workers
+    constexpr size_t kMinParallelRanges = 1024;
+    if (pool && access_state_map_.size() >= kMinParallelRanges) {
+        return DetectFirstUseHazardParallel(queue_id, tag_range, access_context, *pool);
+    }
+    return DetectFirstUseHazard(queue_id, tag_range, access_context, access_state_map_.cbegin(), access_state_map_.cend(),
+                                nullptr, 0);
+}
+
+HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                                 const AccessContext &access_context, ResourceAccessRangeMap::const_iterator begin,
+                                                 ResourceAccessRangeMap::const_iterator end, const std::atomic<size_t> *stop_shard,
+                                                 size_t shard) const {
     HazardResult hazard;
-    for (const auto &recorded_access : access_state_map_) {
+    for (auto pos = begin; pos != end; ++pos) {
+        // A shard at a lower address already found a hazard, that one is reported
+        if (stop_shard && stop_shard->load(std::memory_order_relaxed) < shard) break;
+        const auto &recorded_access = *pos;
         // Cull any entries not in the current tag range
         if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
         HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
@@ -549,6 +655,101 @@ HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const Resourc
     return hazard;
 }
 
+// Detection only reads both contexts, so the recorded ranges can be split in address order. The first hazard of the lowest
+// shard that has one is the hazard the serial walk would have found.
+HazardResult AccessContext::DetectFirstUseHazardParallel(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                                         const AccessContext &access_context, vvl::ThreadPool &pool) const {
+    // A few shards per worker, so one expensive address range doesn't leave the others idle
+    const size_t shard_count = std::min<size_t>(size_t(pool.ThreadCount()) * 4, access_state_map_.size());
+    const size_t shard_size = (access_state_map_.size() + shard_count - 1) / shard_count;
+
+    std::vector<ResourceAccessRangeMap::const_iterator> bounds;
+    bounds.reserve(shard_count + 1);
+    auto pos = access_state_map_.cbegin();
+    for (size_t i = 0; i < access_state_map_.size(); i += shard_size) {
+        bounds.emplace_back(pos);
+        std::advance(pos, std::min(shard_size, access_state_map_.size() - i));
+    }
+    bounds.emplace_back(access_state_map_.cend());
+
+    // Detection applies pending global barriers where it reads, which the workers must not do concurrently
+    access_context.FlushReachableGlobalBarriers();
+
+    std::vector<HazardResult> hazards(bounds.size() - 1);
+    std::atomic<size_t> stop_shard{hazards.size()};
+    {
+        vvl::TaskGroup tasks(pool);
+        for (size_t shard = 0; shard < hazards.size(); ++shard) {
+            tasks.Post([&, shard]() {
+                hazards[shard] = DetectFirstUseHazard(queue_id, tag_range, access_context, bounds[shard], bounds[shard + 1],
+                                                      &stop_shard, shard);
+                if (hazards[shard].IsHazard()) {
+                    size_t current = stop_shard.load();
+                    while (shard < current && !stop_shard.compare_exchange_weak(current, shard)) {
+                    }
+                }
+            });
+        }
+        vvl::ThreadPool::BlockingScope blocking;
+        tasks.Wait();
+    }
+
+    for (auto &hazard : hazards) {
+        if (hazard.IsHazard()) {
+            return std::move(hazard);
+        }
+    }
+    return HazardResult();
+}
+
+static uint64_t NextGlobalBarrierSeq() {
+    // Shared by all contexts, so a state resolved from another context is never ahead of the barriers recorded later here
+    static std::atomic<uint64_t> last_seq{0};
+    return ++last_seq;
+}
+
+void AccessContext::AddGlobalBarrier(QueueId queue_id, const std::vector<SyncBarrier> &barriers, ResourceUsageTag tag) {
+    if (pending_global_barriers_.size() >= kMaxPendingGlobalBarriers) {
+        FlushGlobalBarriers();
+    }
+    pending_global_barriers_.emplace_back(GlobalBarrier{barriers, queue_id, tag, NextGlobalBarrierSeq()});
+}
+
+void AccessContext::CatchUpGlobalBarriersSlow(ResourceAccessState &state) const {
+    // Same as applying each global barrier to the whole map when it was recorded (ApplyBarrierOpsFunctor with resolve)
+    const auto first_pending =
+        std::upper_bound(pending_global_barriers_.begin(), pending_global_barriers_.end(), state.GlobalBarrierSeq(),
+                         [](uint64_t seq, const GlobalBarrier &global_barrier) { return seq < global_barrier.seq; });
+    for (auto it = first_pending; it != pending_global_barriers_.end(); ++it) {
+        const ResourceAccessState::QueueScopeOps scope(it->queue_id);
+        for (const auto &barrier : it->barriers) {
+            state.ApplyBarrier(scope, barrier, false);
+        }
+        state.ApplyPendingBarriers(it->tag);
+    }
+    state.SetGlobalBarrierSeq(pending_global_barriers_.back().seq);
+}
+
+void AccessContext::FlushGlobalBarriers() const {
+    if (pending_global_barriers_.empty()) {
+        return;
+    }
+    for (auto &access : access_state_map_) {
+        CatchUpGlobalBarriers(access.second);
+    }
+    pending_global_barriers_.clear();
+}
+
+void AccessContext::FlushReachableGlobalBarriers() const {
+    FlushGlobalBarriers();
+    for (const auto &async_ref : async_) {
+        async_ref.Context().FlushGlobalBarriers();
+    }
+    for (const auto &prev_dep : prev_) {
+        prev_dep.source_subpass->FlushReachableGlobalBarriers();
+    }
+}
+
 // For RenderPass time validation this is "start tag", for QueueSubmit, this is the earliest
 // unsynchronized tag for the Queue being tested against (max synchrononous + 1, perhaps)
 ResourceUsageTag AccessContext::AsyncReference::StartTag() const { return (tag_ == kInvalidTag) ? context_->StartTag() : tag_; }
@@ -557,16 +758,11 @@ AttachmentViewGen::AttachmentViewGen(const syncval_state::ImageViewState *image_
                                      const VkExtent3D &extent)
     : view_(image_view), view_mask_(image_view->normalized_subresource_range.aspectMask), gen_store_() {
     gen_store_[Gen::kViewSubresource].emplace(image_view->GetFullViewImageRangeGen());
-    gen_store_[Gen::kRenderArea].emplace(image_view->MakeImageRangeGen(offset, extent));
 
-    const auto depth = view_mask_ & VK_IMAGE_ASPECT_DEPTH_BIT;
-    if (depth && (depth != view_mask_)) {
-        gen_store_[Gen::kDepthOnlyRenderArea].emplace(image_view->MakeImageRangeGen(offset, extent, depth));
-    }
-    const auto stencil = view_mask_ & VK_IMAGE_ASPECT_STENCIL_BIT;
-    if (stencil && (stencil != view_mask_)) {
-        gen_store_[Gen::kStencilOnlyRenderArea].emplace(image_view->MakeImageRangeGen(offset, extent, stencil));
-    }
+    auto render_area_gens = image_view->GetRenderAreaRangeGens(offset, extent);
+    gen_store_[Gen::kRenderArea] = std::move(render_area_gens.render_area);
+    gen_store_[Gen::kDepthOnlyRenderArea] = std::move(render_area_gens.depth_only);
+    gen_store_[Gen::kStencilOnlyRenderArea] = std::move(render_area_gens.stencil_only);
 }
 
 const std::optional<ImageRangeGen> &AttachmentViewGen::GetRangeGen(AttachmentViewGen::Gen type) const {
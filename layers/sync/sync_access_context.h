@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "sync/sync_common.h"
 #include "sync/sync_access_state.h"
 
@@ -28,6 +30,7 @@ class VideoSession;
 class VideoPictureResource;
 class Bindable;
 class Event;
+class ThreadPool;
 }  // namespace vvl
 
 namespace syncval_state {
@@ -211,20 +214,29 @@ struct SubpassBarrierTrackback {
     const SubpassNode *source_subpass = nullptr;
     SubpassBarrierTrackback() = default;
     SubpassBarrierTrackback(const SubpassBarrierTrackback &) = default;
-    SubpassBarrierTrackback(const SubpassNode *source_subpass_, VkQueueFlags queue_flags_,
-                            const std::vector<const VkSubpassDependency2 *> &subpass_dependencies_)
-        : barriers(), source_subpass(source_subpass_) {
-        barriers.reserve(subpass_dependencies_.size());
-        for (const VkSubpassDependency2 *dependency : subpass_dependencies_) {
-            assert(dependency);
-            barriers.emplace_back(queue_flags_, *dependency);
-        }
-    }
     SubpassBarrierTrackback(const SubpassNode *source_subpass_, const SyncBarrier &barrier_)
         : barriers(1, barrier_), source_subpass(source_subpass_) {}
+    SubpassBarrierTrackback(const SubpassNode *source_subpass_, const std::vector<SyncBarrier> &barriers_)
+        : barriers(barriers_), source_subpass(source_subpass_) {}
     SubpassBarrierTrackback &operator=(const SubpassBarrierTrackback &) = default;
 };
 
+// The subpass dependency graph of a render pass with its VkSubpassDependency2 (the implicit external ones included) converted
+// to barriers for one queue type. It is built once per render pass and queue type, the subpass contexts of every instance of
+// the render pass and of its submit time replays are then set up from it.
+struct RenderPassBarrierSchedule {
+    struct Subpass {
+        std::vector<std::pair<uint32_t, std::vector<SyncBarrier>>> prev;  // Source subpass and the barriers from it
+        std::vector<uint32_t> async;
+        std::vector<SyncBarrier> from_external;
+        std::vector<SyncBarrier> to_external;
+    };
+    RenderPassBarrierSchedule(VkQueueFlags queue_flags_, const std::vector<SubpassDependencyGraphNode> &dependencies);
+
+    const VkQueueFlags queue_flags;
+    std::vector<Subpass> subpasses;
+};
+
 class AttachmentViewGen {
   public:
     enum Gen { kViewSubresource = 0, kRenderArea = 1, kDepthOnlyRenderArea = 2, kStencilOnlyRenderArea = 3, kGenSize = 4 };
@@ -244,6 +256,27 @@ class AttachmentViewGen {
 
 using AttachmentViewGenVector = std::vector<AttachmentViewGen>;
 
+// The buffer accesses of one command (copy regions, descriptors of a draw), so that AccessContext::UpdateAccessState can apply
+// all of them in one ordered walk of the access map instead of a lower_bound for each.
+// Accesses are applied in address order when their ranges are disjoint, and in the order they were added when any overlap.
+class BufferAccessBatch {
+  public:
+    void Add(const vvl::Buffer &buffer, SyncStageAccessIndex usage, SyncOrdering ordering_rule, const ResourceAccessRange &range,
+             ResourceUsageTagEx tag_ex);
+    bool empty() const { return accesses_.empty(); }
+
+  private:
+    friend class AccessContext;
+    struct Access {
+        ResourceAccessRange range;  // Base address of the buffer included
+        SyncStageAccessIndex usage;
+        SyncOrdering ordering_rule;
+        ResourceUsageTagEx tag_ex;
+        uint32_t index;  // Order of Add() calls
+    };
+    std::vector<Access> accesses_;
+};
+
 class AccessContext {
   public:
     using ImageState = syncval_state::ImageState;
@@ -284,8 +317,9 @@ class AccessContext {
                                           const VkImageSubresourceRange &subresource_range, DetectOptions options) const;
     HazardResult DetectSubpassTransitionHazard(const TrackBack &track_back, const AttachmentViewGen &attach_view) const;
 
-    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                      const AccessContext &access_context) const;
+    // With a pool, large contexts are split by address range across its workers. The hazard found is the same as without.
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      vvl::ThreadPool *pool = nullptr) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -296,6 +330,7 @@ class AccessContext {
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
         access_state_map_.clear();
+        pending_global_barriers_.clear();
     }
 
     void ResolvePreviousAccesses();
@@ -327,6 +362,8 @@ class AccessContext {
                            ResourceUsageTag tag);
     void UpdateAccessState(const vvl::VideoSession &vs_state, const vvl::VideoPictureResource &resource,
                            SyncStageAccessIndex current_usage, ResourceUsageTag tag);
+    // Consumes the batch, it is empty afterwards
+    void UpdateAccessState(BufferAccessBatch &batch);
     void ResolveChildContexts(const std::vector<AccessContext> &contexts);
 
     void ImportAsyncContexts(const AccessContext &from);
@@ -335,18 +372,29 @@ class AccessContext {
     void ApplyUpdateAction(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type, const Action &action);
     template <typename Action>
     void ApplyToContext(const Action &barrier_action);
+    // Memory barriers of a pipeline barrier, applied to all accesses of the context. The recording is O(1): the barriers are
+    // applied to each range the next time it is read or updated.
+    void AddGlobalBarrier(QueueId queue_id, const std::vector<SyncBarrier> &barriers, ResourceUsageTag tag);
 
-    AccessContext(uint32_t subpass, VkQueueFlags queue_flags, const std::vector<SubpassDependencyGraphNode> &dependencies,
-                  const std::vector<AccessContext> &contexts, const AccessContext *external_context);
+    AccessContext(uint32_t subpass, const RenderPassBarrierSchedule &barrier_schedule, const std::vector<AccessContext> &contexts,
+                  const AccessContext *external_context);
 
     AccessContext() { Reset(); }
     AccessContext(const AccessContext &copy_from) = default;
     void Trim();
     void TrimAndClearFirstAccess();
+    // Merges neighbor ranges with equal states, keeping everything else (first accesses included) as recorded
+    void Consolidate();
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
-    ResourceAccessRangeMap &GetAccessStateMap() { return access_state_map_; }
-    const ResourceAccessRangeMap &GetAccessStateMap() const { return access_state_map_; }
+    ResourceAccessRangeMap &GetAccessStateMap() {
+        FlushGlobalBarriers();
+        return access_state_map_;
+    }
+    const ResourceAccessRangeMap &GetAccessStateMap() const {
+        FlushGlobalBarriers();
+        return access_state_map_;
+    }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
             return src_external_;
@@ -390,7 +438,38 @@ class AccessContext {
 
   private:
     template <typename Action>
-    static void UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesses, Action &action, const ResourceAccessRange &range);
+    friend struct ActionToOpsAdapter;
+
+    template <typename Action>
+    void UpdateMemoryAccessRangeState(Action &action, const ResourceAccessRange &range);
+
+    // Recorded by AddGlobalBarrier and not yet applied to every range. Each range state holds the seq of the last one it got.
+    struct GlobalBarrier {
+        std::vector<SyncBarrier> barriers;
+        QueueId queue_id;
+        ResourceUsageTag tag;
+        uint64_t seq;
+    };
+    // Above this, the next global barrier walks the map once instead of growing the list
+    static constexpr size_t kMaxPendingGlobalBarriers = 64;
+
+    // Folding the pending barriers into a state doesn't change what the context describes, so it is done from const functions
+    void CatchUpGlobalBarriers(const ResourceAccessState &state) const {
+        if (!pending_global_barriers_.empty() && state.GlobalBarrierSeq() < pending_global_barriers_.back().seq) {
+            CatchUpGlobalBarriersSlow(const_cast<ResourceAccessState &>(state));
+        }
+    }
+    void CatchUpGlobalBarriersSlow(ResourceAccessState &state) const;
+    // For states new to this context, which never saw the pending barriers
+    void SkipGlobalBarriers(ResourceAccessState &state) const {
+        if (!pending_global_barriers_.empty()) {
+            state.SetGlobalBarrierSeq(pending_global_barriers_.back().seq);
+        }
+    }
+    // Applies the pending barriers to all ranges, needed before the map is used as a whole
+    void FlushGlobalBarriers() const;
+    // Also for the contexts read through this one (previous and async), before reading all of them from several threads
+    void FlushReachableGlobalBarriers() const;
 
     struct UpdateMemoryAccessStateFunctor {
         using Iterator = ResourceAccessRangeMap::iterator;
@@ -454,7 +533,15 @@ class AccessContext {
     template <typename Detector>
     HazardResult DetectPreviousHazard(Detector &detector, const ResourceAccessRange &range) const;
 
-    ResourceAccessRangeMap access_state_map_;
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      ResourceAccessRangeMap::const_iterator begin, ResourceAccessRangeMap::const_iterator end,
+                                      const std::atomic<size_t> *stop_shard, size_t shard) const;
+    HazardResult DetectFirstUseHazardParallel(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                              const AccessContext &access_context, vvl::ThreadPool &pool) const;
+
+    // Mutable for the pending global barriers applied while reading, see CatchUpGlobalBarriers
+    mutable ResourceAccessRangeMap access_state_map_;
+    mutable std::vector<GlobalBarrier> pending_global_barriers_;
     std::vector<TrackBack> prev_;
     std::vector<TrackBack *> prev_by_subpass_;
     // These contexts *must* have the same lifespan as this context, or be cleared, before the referenced contexts can expire
@@ -482,29 +569,34 @@ struct ActionToOpsAdapter {
         // the infill_range, where as Action::Infill assumes the caller will apply the action() logic to the infill_range
         for (; infill != pos; ++infill) {
             assert(infill != accesses.end());
+            context.SkipGlobalBarriers(infill->second);
             action(infill);
         }
     }
-    void update(const Iterator &pos) const { action(pos); }
+    void update(const Iterator &pos) const {
+        context.CatchUpGlobalBarriers(pos->second);
+        action(pos);
+    }
     const Action &action;
+    const AccessContext &context;
 };
 
 template <typename Action>
 void AccessContext::ApplyToContext(const Action &barrier_action) {
     // Note: Barriers do *not* cross context boundaries, applying to accessess within.... (at least for renderpass subpasses)
-    UpdateMemoryAccessRangeState(access_state_map_, barrier_action, kFullRange);
+    FlushGlobalBarriers();
+    UpdateMemoryAccessRangeState(barrier_action, kFullRange);
 }
 
 template <typename Action>
-void AccessContext::UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesses, Action &action,
-                                                 const ResourceAccessRange &range) {
-    ActionToOpsAdapter<Action> ops{action};
-    infill_update_range(accesses, range, ops);
+void AccessContext::UpdateMemoryAccessRangeState(Action &action, const ResourceAccessRange &range) {
+    ActionToOpsAdapter<Action> ops{action, *this};
+    infill_update_range(access_state_map_, range, ops);
 }
 
 template <typename Action, typename RangeGen>
 void AccessContext::UpdateMemoryAccessState(const Action &action, RangeGen &range_gen) {
-    ActionToOpsAdapter<Action> ops{action};
+    ActionToOpsAdapter<Action> ops{action, *this};
     infill_update_rangegen(access_state_map_, range_gen, ops);
 }
 
@@ -527,9 +619,10 @@ HazardResult AccessContext::DetectAsyncHazard(const Detector &detector, const Ra
 
     HazardResult hazard;
 
-    auto do_async_hazard_check = [&detector, async_tag, async_queue_id, &hazard](const RangeType &range, const ConstIterator &end,
-                                                                                 ConstIterator &pos) {
+    auto do_async_hazard_check = [this, &detector, async_tag, async_queue_id, &hazard](
+                                     const RangeType &range, const ConstIterator &end, ConstIterator &pos) {
         while (pos != end && pos->first.begin < range.end) {
+            CatchUpGlobalBarriers(pos->second);
             hazard = detector.DetectAsync(pos, async_tag, async_queue_id);
             if (hazard.IsHazard()) return true;
             ++pos;
@@ -564,6 +657,7 @@ HazardResult AccessContext::DetectHazardOneRange(Detector &detector, bool detect
             gap.begin = pos->first.end;
         }
 
+        CatchUpGlobalBarriers(pos->second);
         hazard = detector.Detect(pos);
         if (hazard.IsHazard()) return hazard;
         ++pos;
@@ -597,6 +691,7 @@ void AccessContext::ResolveAccessRange(const ResourceAccessRange &range, Barrier
         const auto current_range = current->range & range;
         if (current->pos_B->valid) {
             const auto &src_pos = current->pos_B->lower_bound;
+            CatchUpGlobalBarriers(src_pos->second);
             ResourceAccessState access(src_pos->second);  // intentional copy
             barrier_action(&access);
             if (current->pos_A->valid) {
@@ -696,18 +791,21 @@ HazardResult AccessContext::DetectPreviousHazard(Detector &detector, const Resou
 template <typename Predicate>
 void AccessContext::EraseIf(Predicate &&pred) {
     // Note: Don't forward, we don't want r-values moved, since we're going to make multiple calls.
+    FlushGlobalBarriers();
     vvl::EraseIf(access_state_map_, pred);
 }
 
 template <typename ResolveOp>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
+    FlushGlobalBarriers();
     from_context.ResolveAccessRange(kFullRange, resolve_op, &access_state_map_, infill_state, recur_to_infill);
 }
 
 template <typename ResolveOp, typename RangeGenerator>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context, RangeGenerator range_gen,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
+    FlushGlobalBarriers();
     for (; range_gen->non_empty(); ++range_gen) {
         from_context.ResolveAccessRange(*range_gen, resolve_op, &access_state_map_, infill_state, recur_to_infill);
     }
@@ -16,7 +16,62 @@
  */
 #include "sync/sync_utils.h"
 #include "sync/sync_access_state.h"
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vulkan/utility/vk_struct_helper.hpp>
+#include "utils/hash_util.h"
+
+const OrderingBarrier InternedOrderingBarrier::kEmpty = OrderingBarrier();
+
+namespace {
+struct OrderingBarrierHash {
+    size_t operator()(const OrderingBarrier &barrier) const {
+        hash_util::HashCombiner hc;
+        hc << barrier.exec_scope << std::hash<SyncStageAccessFlags>()(barrier.access_scope);
+        return hc.Value();
+    }
+};
+
+class OrderingBarrierTable {
+  public:
+    const OrderingBarrier *Intern(const OrderingBarrier &barrier) {
+        {
+            std::shared_lock<std::shared_mutex> guard(lock_);
+            auto it = barriers_.find(barrier);
+            if (it != barriers_.end()) {
+                return &*it;
+            }
+        }
+        std::unique_lock<std::shared_mutex> guard(lock_);
+        // Elements of an unordered_set don't move on rehash, so the pointers stay valid
+        return &*barriers_.insert(barrier).first;
+    }
+
+  private:
+    std::shared_mutex lock_;
+    std::unordered_set<OrderingBarrier, OrderingBarrierHash> barriers_;
+};
+
+OrderingBarrierTable &GetOrderingBarrierTable() {
+    // Never destroyed, access states referring to it can outlive static destruction order
+    static OrderingBarrierTable *table = new OrderingBarrierTable();
+    return *table;
+}
+}  // namespace
+
+InternedOrderingBarrier::InternedOrderingBarrier(const OrderingBarrier &barrier)
+    : barrier_((barrier == kEmpty) ? nullptr : GetOrderingBarrierTable().Intern(barrier)) {}
+
+InternedOrderingBarrier &InternedOrderingBarrier::operator|=(const OrderingBarrier &rhs) {
+    OrderingBarrier merged = Get();
+    merged |= rhs;
+    if (!(merged == Get())) {
+        *this = InternedOrderingBarrier(merged);
+    }
+    return *this;
+}
 
 ResourceAccessState::OrderingBarriers ResourceAccessState::kOrderingRules = {
     {{VK_PIPELINE_STAGE_2_NONE_KHR, SyncStageAccessFlags()},
@@ -63,7 +118,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
         if (last_reads.size()) {
             for (const auto &read_access : last_reads) {
                 if (IsReadHazard(usage_stage, read_access)) {
-                    hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.TagEx());
+                    hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.Access(), read_access.TagEx());
                     break;
                 }
             }
@@ -115,7 +170,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
         return DetectBarrierHazard(usage_info, queue_id, ordering.exec_scope, ordering.access_scope);
     } else {
         // Only check for WAW if there are no reads since last_write
-        const bool usage_write_is_ordered = (usage_bit & ordering.access_scope).any();
+        const bool usage_write_is_ordered = usage_bit.intersects(ordering.access_scope);
         if (last_reads.size()) {
             // Look for any WAR hazards outside the ordered set of stages
             VkPipelineStageFlags2KHR ordered_stages = VK_PIPELINE_STAGE_2_NONE;
@@ -128,7 +183,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
                 for (const auto &read_access : last_reads) {
                     if (read_access.stage & ordered_stages) continue;  // but we can skip the ordered ones
                     if (IsReadHazard(usage_stage, read_access)) {
-                        hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.TagEx());
+                        hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.Access(), read_access.TagEx());
                         break;
                     }
                 }
@@ -138,7 +193,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
             if ((usage_index == SYNC_IMAGE_LAYOUT_TRANSITION) && (last_write->IsIndex(SYNC_IMAGE_LAYOUT_TRANSITION))) {
                 // ILT after ILT is a special case where we check the 2nd access scope of the first ILT against the first access
                 // scope of the second ILT, which has been passed (smuggled?) in the ordering barrier
-                ilt_ilt_hazard = !(last_write->Barriers() & ordering.access_scope).any();
+                ilt_ilt_hazard = !last_write->Barriers().intersects(ordering.access_scope);
             }
             if (ilt_ilt_hazard || last_write->IsWriteHazard(usage_info)) {
                 hazard.Set(this, usage_info, WRITE_AFTER_WRITE, *last_write);
@@ -187,7 +242,7 @@ HazardResult ResourceAccessState::DetectHazard(const ResourceAccessState &record
                     // Or in the layout first access scope as a barrier... IFF the usage is an ILT
                     // this was saved off in the "apply barriers" logic to simplify ILT access checks as they straddle
                     // the barrier that applies them
-                    barrier |= recorded_use.first_write_layout_ordering_;
+                    barrier |= recorded_use.first_write_layout_ordering_.Get();
                 }
                 // Any read stages present in the recorded context (this) are most recent to the write, and thus mask those stages
                 // in the active context
@@ -228,7 +283,7 @@ HazardResult ResourceAccessState::DetectAsyncHazard(const SyncStageAccessInfoTyp
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
             for (const auto &read_access : last_reads) {
                 if (read_access.queue == queue_id && read_access.tag >= start_tag) {
-                    hazard.Set(this, usage_info, WRITE_RACING_READ, read_access.access, read_access.TagEx());
+                    hazard.Set(this, usage_info, WRITE_RACING_READ, read_access.Access(), read_access.TagEx());
                     break;
                 }
             }
@@ -266,7 +321,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(const SyncStageAccessInfoT
         // Look at the reads if any
         for (const auto &read_access : last_reads) {
             if (read_access.IsReadBarrierHazard(queue_id, src_exec_scope, src_access_scope)) {
-                hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.TagEx());
+                hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.Access(), read_access.TagEx());
                 break;
             }
         }
@@ -307,21 +362,21 @@ HazardResult ResourceAccessState::DetectBarrierHazard(const SyncStageAccessInfoT
                 assert(scope_read.stage == current_read.stage);
                 if (current_read.tag > event_tag) {
                     // The read is more recent than the set event scope, thus no barrier from the wait/ILT.
-                    hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.access, current_read.TagEx());
+                    hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.Access(), current_read.TagEx());
                 } else {
                     // The read is in the events first synchronization scope, so we use a barrier hazard check
                     // If the read stage is not in the src sync scope
                     // *AND* not execution chained with an existing sync barrier (that's the or)
                     // then the barrier access is unsafe (R/W after R)
                     if (scope_read.IsReadBarrierHazard(event_queue, src_exec_scope, src_access_scope)) {
-                        hazard.Set(this, usage_info, WRITE_AFTER_READ, scope_read.access, scope_read.TagEx());
+                        hazard.Set(this, usage_info, WRITE_AFTER_READ, scope_read.Access(), scope_read.TagEx());
                         break;
                     }
                 }
             }
             if (!hazard.IsHazard() && (last_reads.size() > scope_read_count)) {
                 const ReadState &current_read = last_reads[scope_read_count];
-                hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.access, current_read.TagEx());
+                hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.Access(), current_read.TagEx());
             }
         } else if (last_write.has_value()) {
             // if there are no reads, the write is either the reason the access is in the event scope... they are a hazard
@@ -354,7 +409,7 @@ void ResourceAccessState::MergeReads(const ResourceAccessState &other) {
                 if (other_read.stage == my_read.stage) {
                     if (my_read.tag < other_read.tag) {
                         // Other is more recent, copy in the state
-                        my_read.access = other_read.access;
+                        my_read.access_index = other_read.access_index;
                         my_read.tag = other_read.tag;
                         my_read.handle_index = other_read.handle_index;
                         my_read.queue = other_read.queue;
@@ -466,7 +521,7 @@ void ResourceAccessState::Update(const SyncStageAccessInfoType &usage_info, Sync
             const auto not_usage_stage = ~usage_stage;
             for (auto &read_access : last_reads) {
                 if (read_access.stage == usage_stage) {
-                    read_access.Set(usage_stage, usage_bit, 0, tag_ex);
+                    read_access.Set(usage_stage, usage_info.stage_access_index, 0, tag_ex);
                 } else if (read_access.barriers & usage_stage) {
                     // If the current access is barriered to this stage, mark it as "known to happen after"
                     read_access.sync_stages |= usage_stage;
@@ -483,7 +538,7 @@ void ResourceAccessState::Update(const SyncStageAccessInfoType &usage_info, Sync
                     read_access.sync_stages |= usage_stage;
                 }
             }
-            last_reads.emplace_back(usage_stage, usage_bit, 0, tag_ex);
+            last_reads.emplace_back(usage_stage, usage_info.stage_access_index, 0, tag_ex);
             last_read_stages |= usage_stage;
         }
 
@@ -545,7 +600,7 @@ void ResourceAccessState::ClearRead() {
 void ResourceAccessState::ClearFirstUse() {
     first_accesses_.clear();
     first_read_stages_ = VK_PIPELINE_STAGE_2_NONE;
-    first_write_layout_ordering_ = OrderingBarrier();
+    first_write_layout_ordering_ = InternedOrderingBarrier();
     first_access_closed_ = false;
 }
 
@@ -647,7 +702,7 @@ void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
     }
 }
 
-static const SyncStageAccessFlags kAllSyncStageAccessBits = ~SyncStageAccessFlags(0);
+static constexpr SyncStageAccessFlags kAllSyncStageAccessBits = ~SyncStageAccessFlags(0);
 ResourceAccessState::ResourceAccessState()
     : last_write(),
       last_read_stages(0),
@@ -655,17 +710,18 @@ ResourceAccessState::ResourceAccessState()
       last_reads(),
       input_attachment_read(false),
       pending_layout_transition(false),
+      first_access_closed_(false),
       first_accesses_(),
       first_read_stages_(VK_PIPELINE_STAGE_2_NONE),
       first_write_layout_ordering_(),
-      first_access_closed_(false) {}
+      global_barrier_seq_(0) {}
 
 // This should be just Bits or Index, but we don't have an invalid state for Index
 VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
     VkPipelineStageFlags2KHR barriers = VK_PIPELINE_STAGE_2_NONE;
 
     for (const auto &read_access : last_reads) {
-        if ((read_access.access & usage_bit).any()) {
+        if (usage_bit[read_access.access_index]) {
             barriers = read_access.barriers;
             break;
         }
@@ -689,7 +745,7 @@ bool ResourceAccessState::IsWriteBarrierHazard(QueueId queue_id, VkPipelineStage
 }
 
 bool ResourceAccessState::WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope,
-                                                    SyncStageAccessFlags src_access_scope) const {
+                                                    const SyncStageAccessFlags &src_access_scope) const {
     return last_write.has_value() && last_write->WriteInSourceScopeOrChain(src_exec_scope, src_access_scope);
 }
 
@@ -782,25 +838,25 @@ void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag,
     if (first_accesses_.back().tag == tag) {
         // If this layout transition is the the first write, add the additional ordering rules that guard the ILT
         assert(first_accesses_.back().usage_info->stage_access_index == SyncStageAccessIndex::SYNC_IMAGE_LAYOUT_TRANSITION);
-        first_write_layout_ordering_ = layout_ordering;
+        first_write_layout_ordering_ = InternedOrderingBarrier(layout_ordering);
     }
 }
 
-ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_,
+ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_,
                                           VkPipelineStageFlags2KHR barriers_, ResourceUsageTagEx tag_ex)
     : stage(stage_),
-      access(access_),
       barriers(barriers_),
       sync_stages(VK_PIPELINE_STAGE_2_NONE),
       tag(tag_ex.tag),
+      pending_dep_chain(VK_PIPELINE_STAGE_2_NONE),
       handle_index(tag_ex.handle_index),
       queue(kQueueIdInvalid),
-      pending_dep_chain(VK_PIPELINE_STAGE_2_NONE) {}
+      access_index(access_index_) {}
 
-void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_,
+void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_,
                                          VkPipelineStageFlags2KHR barriers_, ResourceUsageTagEx tag_ex) {
     stage = stage_;
-    access = access_;
+    access_index = access_index_;
     barriers = barriers_;
     sync_stages = VK_PIPELINE_STAGE_2_NONE;
     tag = tag_ex.tag;
@@ -892,7 +948,9 @@ void ResourceAccessWriteState::MergeBarriers(const ResourceAccessWriteState &oth
 
     pending_barriers_ |= other.pending_barriers_;
     pending_dep_chain_ |= other.pending_dep_chain_;
-    pending_layout_ordering_ |= other.pending_layout_ordering_;
+    if (pending_layout_ordering_ != other.pending_layout_ordering_) {
+        pending_layout_ordering_ |= other.pending_layout_ordering_.Get();
+    }
 }
 
 void ResourceAccessWriteState::UpdatePendingBarriers(const SyncBarrier &barrier) {
@@ -907,7 +965,7 @@ void ResourceAccessWriteState::ApplyPendingBarriers() {
     // Reset pending state
     pending_dep_chain_ = VK_PIPELINE_STAGE_2_NONE;
     pending_barriers_.reset();
-    pending_layout_ordering_ = OrderingBarrier();
+    pending_layout_ordering_ = InternedOrderingBarrier();
 }
 
 void ResourceAccessWriteState::UpdatePendingLayoutOrdering(const SyncBarrier &barrier) {
@@ -930,7 +988,7 @@ bool ResourceAccessWriteState::WriteInScope(const SyncStageAccessFlags &src_acce
 }
 
 bool ResourceAccessWriteState::WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope,
-                                                         SyncStageAccessFlags src_access_scope) const {
+                                                         const SyncStageAccessFlags &src_access_scope) const {
     assert(access_);
     return WriteInChain(src_exec_scope) || WriteInScope(src_access_scope);
 }
@@ -977,31 +1035,95 @@ HazardResult::HazardState::HazardState(const ResourceAccessState *access_state_,
     }
 }
 
-SyncExecScope SyncExecScope::MakeSrc(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR mask_param,
-                                     const VkPipelineStageFlags2KHR disabled_feature_mask) {
-    SyncExecScope result;
-    result.mask_param = mask_param;
-    result.expanded_mask = sync_utils::ExpandPipelineStages(mask_param, queue_flags, disabled_feature_mask);
-    result.exec_scope = sync_utils::WithEarlierPipelineStages(result.expanded_mask);
-    result.valid_accesses = SyncStageAccess::AccessScopeByStage(result.expanded_mask);
+namespace {
+struct BarrierScopeKey {
+    VkQueueFlags queue_flags;
+    VkPipelineStageFlags2KHR stage_mask;
+    VkAccessFlags2KHR access_mask;
+    VkPipelineStageFlags2KHR disabled_feature_mask;
+    bool is_src;
+
+    bool operator==(const BarrierScopeKey &rhs) const {
+        return queue_flags == rhs.queue_flags && stage_mask == rhs.stage_mask && access_mask == rhs.access_mask &&
+               disabled_feature_mask == rhs.disabled_feature_mask && is_src == rhs.is_src;
+    }
+};
+
+struct BarrierScopeKeyHash {
+    size_t operator()(const BarrierScopeKey &key) const {
+        hash_util::HashCombiner hc;
+        hc << key.queue_flags << key.stage_mask << key.access_mask << key.disabled_feature_mask << key.is_src;
+        return hc.Value();
+    }
+};
+
+SyncBarrierScope ExpandBarrierScope(const BarrierScopeKey &key) {
+    SyncBarrierScope result;
+    SyncExecScope &exec = result.exec_scope;
+    exec.mask_param = key.stage_mask;
+    exec.expanded_mask = sync_utils::ExpandPipelineStages(key.stage_mask, key.queue_flags, key.disabled_feature_mask);
+    exec.exec_scope = key.is_src ? sync_utils::WithEarlierPipelineStages(exec.expanded_mask)
+                                 : sync_utils::WithLaterPipelineStages(exec.expanded_mask);
+    exec.valid_accesses = SyncStageAccess::AccessScopeByStage(exec.expanded_mask);
     // ALL_COMMANDS stage includes all accesses performed by the gpu, not only accesses defined by the stages
-    if (mask_param & VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT) {
-        result.valid_accesses |= SYNC_IMAGE_LAYOUT_TRANSITION_BIT;
+    if (key.stage_mask & VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT) {
+        exec.valid_accesses |= SYNC_IMAGE_LAYOUT_TRANSITION_BIT;
+    }
+    if (key.access_mask) {
+        result.access_scope = SyncStageAccess::AccessScope(exec.valid_accesses, key.access_mask);
     }
     return result;
 }
 
-SyncExecScope SyncExecScope::MakeDst(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR mask_param) {
-    SyncExecScope result;
-    result.mask_param = mask_param;
-    result.expanded_mask = sync_utils::ExpandPipelineStages(mask_param, queue_flags);
-    result.exec_scope = sync_utils::WithLaterPipelineStages(result.expanded_mask);
-    result.valid_accesses = SyncStageAccess::AccessScopeByStage(result.expanded_mask);
-    // ALL_COMMANDS stage includes all accesses performed by the gpu, not only accesses defined by the stages
-    if (mask_param & VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT) {
-        result.valid_accesses |= SYNC_IMAGE_LAYOUT_TRANSITION_BIT;
+class BarrierScopeCache {
+  public:
+    SyncBarrierScope Get(const BarrierScopeKey &key) {
+        {
+            std::shared_lock<std::shared_mutex> guard(lock_);
+            auto it = scopes_.find(key);
+            if (it != scopes_.end()) {
+                return it->second;
+            }
+        }
+        const SyncBarrierScope scope = ExpandBarrierScope(key);
+        std::unique_lock<std::shared_mutex> guard(lock_);
+        // Masks are usually compile time constants in the application, but don't grow without bound if they are not
+        if (scopes_.size() < kMaxEntries) {
+            scopes_.emplace(key, scope);
+        }
+        return scope;
     }
-    return result;
+
+  private:
+    static constexpr size_t kMaxEntries = 4096;
+    std::shared_mutex lock_;
+    std::unordered_map<BarrierScopeKey, SyncBarrierScope, BarrierScopeKeyHash> scopes_;
+};
+
+BarrierScopeCache &GetBarrierScopeCache() {
+    // Never destroyed, same as the ordering barrier table
+    static BarrierScopeCache *cache = new BarrierScopeCache();
+    return *cache;
+}
+}  // namespace
+
+SyncBarrierScope SyncBarrierScope::MakeSrc(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR stage_mask,
+                                           VkAccessFlags2KHR access_mask, const VkPipelineStageFlags2KHR disabled_feature_mask) {
+    return GetBarrierScopeCache().Get({queue_flags, stage_mask, access_mask, disabled_feature_mask, true});
+}
+
+SyncBarrierScope SyncBarrierScope::MakeDst(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR stage_mask,
+                                           VkAccessFlags2KHR access_mask) {
+    return GetBarrierScopeCache().Get({queue_flags, stage_mask, access_mask, 0, false});
+}
+
+SyncExecScope SyncExecScope::MakeSrc(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR mask_param,
+                                     const VkPipelineStageFlags2KHR disabled_feature_mask) {
+    return SyncBarrierScope::MakeSrc(queue_flags, mask_param, 0, disabled_feature_mask).exec_scope;
+}
+
+SyncExecScope SyncExecScope::MakeDst(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR mask_param) {
+    return SyncBarrierScope::MakeDst(queue_flags, mask_param, 0).exec_scope;
 }
 
 SyncBarrier::SyncBarrier(const SyncExecScope &src, const SyncExecScope &dst)
@@ -1013,22 +1135,15 @@ SyncBarrier::SyncBarrier(const SyncExecScope &src, const SyncExecScope &dst, con
 SyncBarrier::SyncBarrier(VkQueueFlags queue_flags, const VkSubpassDependency2 &subpass) {
     const auto barrier = vku::FindStructInPNextChain<VkMemoryBarrier2KHR>(subpass.pNext);
     if (barrier) {
-        auto src = SyncExecScope::MakeSrc(queue_flags, barrier->srcStageMask);
-        src_exec_scope = src;
-        src_access_scope = SyncStageAccess::AccessScope(src.valid_accesses, barrier->srcAccessMask);
-
-        auto dst = SyncExecScope::MakeDst(queue_flags, barrier->dstStageMask);
-        dst_exec_scope = dst;
-        dst_access_scope = SyncStageAccess::AccessScope(dst.valid_accesses, barrier->dstAccessMask);
-
+        *this = SyncBarrier(queue_flags, *barrier);
     } else {
-        auto src = SyncExecScope::MakeSrc(queue_flags, subpass.srcStageMask);
-        src_exec_scope = src;
-        src_access_scope = SyncStageAccess::AccessScope(src.valid_accesses, subpass.srcAccessMask);
+        const auto src = SyncBarrierScope::MakeSrc(queue_flags, subpass.srcStageMask, subpass.srcAccessMask);
+        src_exec_scope = src.exec_scope;
+        src_access_scope = src.access_scope;
 
-        auto dst = SyncExecScope::MakeDst(queue_flags, subpass.dstStageMask);
-        dst_exec_scope = dst;
-        dst_access_scope = SyncStageAccess::AccessScope(dst.valid_accesses, subpass.dstAccessMask);
+        const auto dst = SyncBarrierScope::MakeDst(queue_flags, subpass.dstStageMask, subpass.dstAccessMask);
+        dst_exec_scope = dst.exec_scope;
+        dst_access_scope = dst.access_scope;
     }
 }
 
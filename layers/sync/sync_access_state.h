@@ -26,19 +26,19 @@ struct ResourceFirstAccess;
 //       rules apply only to this specific access for this stage, and not the stage as a whole. The ordering detection
 //       also reflects this special case for read hazard detection (using access instead of exec scope)
 constexpr VkPipelineStageFlags2KHR kColorAttachmentExecScope = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR;
-const SyncStageAccessFlags kColorAttachmentAccessScope =
+constexpr SyncStageAccessFlags kColorAttachmentAccessScope =
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_READ_BIT |
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_READ_NONCOHERENT_BIT_EXT |
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_WRITE_BIT |
     SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT;  // Note: this is intentionally not in the exec scope
 constexpr VkPipelineStageFlags2KHR kDepthStencilAttachmentExecScope =
     VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT_KHR | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT_KHR;
-const SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
+constexpr SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
     SYNC_EARLY_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | SYNC_EARLY_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
     SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
     SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT;  // Note: this is intentionally not in the exec scope
 constexpr VkPipelineStageFlags2KHR kRasterAttachmentExecScope = kDepthStencilAttachmentExecScope | kColorAttachmentExecScope;
-const SyncStageAccessFlags kRasterAttachmentAccessScope = kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
+constexpr SyncStageAccessFlags kRasterAttachmentAccessScope = kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
 
 enum SyncHazard {
     NONE = 0,
@@ -124,11 +124,24 @@ struct SyncExecScope {
                   VkPipelineStageFlags2KHR exec_scope_, const SyncStageAccessFlags &valid_accesses_)
         : mask_param(mask_param_), expanded_mask(expanded_mask_), exec_scope(exec_scope_), valid_accesses(valid_accesses_) {}
 
+    // Expanded scopes are memoized per distinct (queue flags, stage mask) combination, see SyncBarrierScope
     static SyncExecScope MakeSrc(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR src_stage_mask,
                                  const VkPipelineStageFlags2KHR disabled_feature_mask = 0);
     static SyncExecScope MakeDst(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR src_stage_mask);
 };
 
+// One side of a barrier with both the stage and the access mask expanded.
+// Applications record the same few barriers over and over, so the expansion is done once per distinct
+// (queue flags, stage mask, access mask) combination and looked up from a process wide cache afterwards.
+struct SyncBarrierScope {
+    SyncExecScope exec_scope;
+    SyncStageAccessFlags access_scope;
+
+    static SyncBarrierScope MakeSrc(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR stage_mask, VkAccessFlags2KHR access_mask,
+                                    const VkPipelineStageFlags2KHR disabled_feature_mask = 0);
+    static SyncBarrierScope MakeDst(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR stage_mask, VkAccessFlags2KHR access_mask);
+};
+
 struct SemaphoreScope : SyncExecScope {
     SemaphoreScope(QueueId qid, const SyncExecScope &exec_scope) : SyncExecScope(exec_scope), queue(qid) {}
     SemaphoreScope() = default;
@@ -202,6 +215,24 @@ struct OrderingBarrier {
     }
 };
 
+// Refers to a copy of an OrderingBarrier kept in a table shared by all access states.
+// The ordering barriers of layout transitions take only a handful of distinct values and are empty for nearly every access
+// state, so a pointer takes their place in the range map values. Interned barriers are never freed. The empty barrier is
+// nullptr, so equal barriers compare equal by pointer.
+class InternedOrderingBarrier {
+  public:
+    InternedOrderingBarrier() = default;
+    explicit InternedOrderingBarrier(const OrderingBarrier &barrier);
+    const OrderingBarrier &Get() const { return barrier_ ? *barrier_ : kEmpty; }
+    InternedOrderingBarrier &operator|=(const OrderingBarrier &rhs);
+    bool operator==(const InternedOrderingBarrier &rhs) const { return barrier_ == rhs.barrier_; }
+    bool operator!=(const InternedOrderingBarrier &rhs) const { return barrier_ != rhs.barrier_; }
+
+  private:
+    static const OrderingBarrier kEmpty;
+    const OrderingBarrier *barrier_ = nullptr;
+};
+
 using ResourceUsageTagSet = CachedInsertSet<ResourceUsageTag, 4>;
 
 class ResourceAccessWriteState {
@@ -212,7 +243,7 @@ class ResourceAccessWriteState {
     }
     bool WriteInChain(VkPipelineStageFlags2KHR src_exec_scope) const;
     bool WriteInScope(const SyncStageAccessFlags &src_access_scope) const;
-    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const;
+    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInQueueSourceScopeOrChain(QueueId queue, VkPipelineStageFlags2KHR src_exec_scope,
                                         const SyncStageAccessFlags &src_access_scope) const;
 
@@ -244,7 +275,7 @@ class ResourceAccessWriteState {
     void UpdatePendingBarriers(const SyncBarrier &barrier);
     void ApplyPendingBarriers();
     void UpdatePendingLayoutOrdering(const SyncBarrier &barrier);
-    const OrderingBarrier &GetPendingLayoutOrdering() const { return pending_layout_ordering_; }
+    const OrderingBarrier &GetPendingLayoutOrdering() const { return pending_layout_ordering_.Get(); }
 
   private:
     const SyncStageAccessInfoType *access_;
@@ -256,7 +287,7 @@ class ResourceAccessWriteState {
     VkPipelineStageFlags2KHR dependency_chain_;
 
     // Write specific layout state
-    OrderingBarrier pending_layout_ordering_;
+    InternedOrderingBarrier pending_layout_ordering_;
     VkPipelineStageFlags2KHR pending_dep_chain_;
     SyncStageAccessFlags pending_barriers_;
 
@@ -275,21 +306,24 @@ class ResourceAccessState : public SyncStageAccess {
     // and applicable one for hazard detection
     struct ReadState {
         VkPipelineStageFlags2KHR stage;        // The stage of this read
-        SyncStageAccessFlags access;           // TODO: Change to FlagBits when we have a None bit enum
-                                               // TODO: Revisit whether this needs to support multiple reads per stage
         VkPipelineStageFlags2KHR barriers;     // all applicable barriered stages
         VkPipelineStageFlags2KHR sync_stages;  // reads known to have happened after this
         ResourceUsageTag tag;
-        uint32_t handle_index;
-        QueueId queue;
         VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
                                                      // Excluded from comparison
+        uint32_t handle_index;
+        QueueId queue;
+        // A read is a single access, the index is enough and is much smaller than SyncStageAccessFlags
+        // TODO: Revisit whether this needs to support multiple reads per stage
+        SyncStageAccessIndex access_index;
+
         ReadState() = default;
-        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_, VkPipelineStageFlags2KHR barriers_,
+        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                   ResourceUsageTagEx tag_ex);
         ResourceUsageTagEx TagEx() const { return {tag, handle_index}; }
+        const SyncStageAccessFlags &Access() const { return SyncStageAccess::UsageInfo(access_index).stage_access_bit; }
         bool operator==(const ReadState &rhs) const {
-            return (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) &&
+            return (stage == rhs.stage) && (access_index == rhs.access_index) && (barriers == rhs.barriers) &&
                    (sync_stages == rhs.sync_stages) && (tag == rhs.tag) && (queue == rhs.queue) &&
                    (pending_dep_chain == rhs.pending_dep_chain);
         }
@@ -324,7 +358,7 @@ class ResourceAccessState : public SyncStageAccess {
         }
 
         bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
-        void Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_, VkPipelineStageFlags2KHR barriers_,
+        void Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                  ResourceUsageTagEx tag_ex);
         bool ReadInScopeOrChain(VkPipelineStageFlags2 exec_scope) const { return (exec_scope & (stage | barriers)) != 0; }
         bool ReadInQueueScopeOrChain(QueueId queue, VkPipelineStageFlags2 exec_scope) const;
@@ -427,7 +461,7 @@ class ResourceAccessState : public SyncStageAccess {
 
     bool IsWriteBarrierHazard(QueueId queue_id, VkPipelineStageFlags2KHR src_exec_scope,
                               const SyncStageAccessFlags &src_access_scope) const;
-    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const;
+    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInQueueSourceScopeOrChain(QueueId queue, VkPipelineStageFlags2KHR src_exec_scope,
                                         const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInEventScope(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope,
@@ -468,6 +502,11 @@ class ResourceAccessState : public SyncStageAccess {
     void Normalize();
     void GatherReferencedTags(ResourceUsageTagSet &used) const;
 
+    // Sequence number of the last global barrier of the owning AccessContext applied to this state. Not part of the state
+    // compared by operator==.
+    uint64_t GlobalBarrierSeq() const { return global_barrier_seq_; }
+    void SetGlobalBarrierSeq(uint64_t seq) { global_barrier_seq_ = seq; }
+
   private:
     static constexpr VkPipelineStageFlags2KHR kInvalidAttachmentStage = ~VkPipelineStageFlags2KHR(0);
     bool IsRAWHazard(const SyncStageAccessInfoType &usage_info) const;
@@ -519,16 +558,20 @@ class ResourceAccessState : public SyncStageAccess {
     // Not part of the write state, logically.  Can exist when !last_write
     // Pending execution state to support independent parallel barriers
     bool pending_layout_transition;
+    // Next to the other flags, this is in every range map value and padding adds up
+    bool first_access_closed_;
 
     FirstAccesses first_accesses_;
     VkPipelineStageFlags2KHR first_read_stages_;
-    OrderingBarrier first_write_layout_ordering_;
-    bool first_access_closed_;
+    InternedOrderingBarrier first_write_layout_ordering_;
+
+    uint64_t global_barrier_seq_;
 
     static OrderingBarriers kOrderingRules;
 };
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
-using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState>;
+using ResourceAccessRangeMap = sparse_container::pooled_range_map<ResourceAddress, ResourceAccessState, ResourceAccessRange,
+                                                                  vvl::MemoryTag::SyncvalAccessMaps>;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
 // Apply the memory barrier without updating the existing barriers.  The execution barrier
@@ -652,11 +695,11 @@ SyncBarrier::SyncBarrier(const Barrier &barrier, const SyncExecScope &src, const
 
 template <typename Barrier>
 SyncBarrier::SyncBarrier(VkQueueFlags queue_flags, const Barrier &barrier) {
-    auto src = SyncExecScope::MakeSrc(queue_flags, barrier.srcStageMask);
+    const auto src = SyncBarrierScope::MakeSrc(queue_flags, barrier.srcStageMask, barrier.srcAccessMask);
     src_exec_scope = src.exec_scope;
-    src_access_scope = SyncStageAccess::AccessScope(src.valid_accesses, barrier.srcAccessMask);
+    src_access_scope = src.access_scope;
 
-    auto dst = SyncExecScope::MakeDst(queue_flags, barrier.dstStageMask);
+    const auto dst = SyncBarrierScope::MakeDst(queue_flags, barrier.dstStageMask, barrier.dstAccessMask);
     dst_exec_scope = dst.exec_scope;
-    dst_access_scope = SyncStageAccess::AccessScope(dst.valid_accesses, barrier.dstAccessMask);
+    dst_access_scope = dst.access_scope;
 }
@@ -92,6 +92,7 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
     // Copy only the needed fields out of from for a temporary, proxy command buffer context
     cb_state_ = from.cb_state_;
     access_log_ = std::make_shared<AccessLog>(*from.access_log_);  // potentially large, but no choice given tagging lookup.
+    sync_state_->stats.AddAccessRecords((uint32_t)access_log_->size());
     command_number_ = from.command_number_;
     subcommand_number_ = from.subcommand_number_;
     reset_count_ = from.reset_count_;
@@ -116,11 +117,22 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
 CommandBufferAccessContext::~CommandBufferAccessContext() {
     sync_state_->stats.RemoveCommandBufferContext();
     sync_state_->stats.RemoveHandleRecord((uint32_t)handles_.size());
+    sync_state_->stats.RemoveAccessRecords((uint32_t)access_log_->size());
 }
 
 void CommandBufferAccessContext::Reset() {
-    access_log_ = std::make_shared<AccessLog>();
-    cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    sync_state_->stats.RemoveAccessRecords((uint32_t)access_log_->size());
+    // Submitted batches keep the log and references of the recording they replay, they are only reused once released
+    if (access_log_.use_count() == 1) {
+        access_log_->clear();
+    } else {
+        access_log_ = std::make_shared<AccessLog>();
+    }
+    if (cbs_referenced_.use_count() == 1) {
+        cbs_referenced_->clear();
+    } else {
+        cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    }
     if (cb_state_) {
         cbs_referenced_->push_back(cb_state_->shared_from_this());
     }
@@ -131,6 +143,7 @@ void CommandBufferAccessContext::Reset() {
 
     sync_state_->stats.RemoveHandleRecord((uint32_t)handles_.size());
     handles_.clear();
+    label_commands_snapshot_.reset();
 
     current_command_tag_ = vvl::kNoIndex32;
     cb_access_context_.Reset();
@@ -138,9 +151,22 @@ void CommandBufferAccessContext::Reset() {
     current_context_ = &cb_access_context_;
     current_renderpass_context_ = nullptr;
     events_context_.Clear();
+    event_first_scope_.reset();
+    event_first_scope_source_ = nullptr;
     dynamic_rendering_info_.reset();
 }
 
+std::shared_ptr<const AccessContext> CommandBufferAccessContext::GetEventFirstScope() {
+    const size_t tag_count = GetTagCount();
+    if (!event_first_scope_ || event_first_scope_source_ != current_context_ || event_first_scope_tag_count_ != tag_count) {
+        event_first_scope_ = std::make_shared<const AccessContext>(*current_context_);
+        event_first_scope_source_ = current_context_;
+    }
+    // If the set event command is the only one tagged before the next set, the access context has not changed
+    event_first_scope_tag_count_ = tag_count + 1;
+    return event_first_scope_;
+}
+
 std::string CommandBufferAccessContext::FormatUsage(ResourceUsageTagEx tag_ex) const {
     if (tag_ex.tag >= access_log_->size()) return std::string();
 
@@ -314,140 +340,135 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
     using ImageDescriptor = vvl::ImageDescriptor;
     using TexelDescriptor = vvl::TexelDescriptor;
 
-    for (const auto &stage_state : pipe->stage_states) {
-        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe->RasterizationDisabled()) {
+    for (const auto &resource : pipe->AccessedResources()) {
+        const auto &variable = *resource.variable;
+        if (variable.decorations.set >= per_sets->size()) {
+            // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
             continue;
-        } else if (!stage_state.entrypoint) {
+        }
+        const auto &per_set = (*per_sets)[variable.decorations.set];
+        const auto *descriptor_set = per_set.bound_descriptor_set.get();
+        if (!descriptor_set) continue;
+        auto binding = descriptor_set->GetBinding(variable.decorations.binding);
+        const auto descriptor_type = binding->type;
+        const SyncStageAccessIndex sync_index = GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, resource.stage);
+        if (sync_index == SYNC_ACCESS_INDEX_NONE) {
+            // Only the image descriptor is used, not the image
             continue;
         }
-        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
-            if (variable.decorations.set >= per_sets->size()) {
-                // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
-                continue;
-            }
-            const auto &per_set = (*per_sets)[variable.decorations.set];
-            const auto *descriptor_set = per_set.bound_descriptor_set.get();
-            if (!descriptor_set) continue;
-            auto binding = descriptor_set->GetBinding(variable.decorations.binding);
-            const auto descriptor_type = binding->type;
-            SyncStageAccessIndex sync_index =
-                GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
-
-            // Currently, validation of memory accesses based on declared descriptors can produce false-positives.
-            // The shader can decide not to do such accesses, it can perform accesses with more narrow scope
-            // (e.g. read access, when both reads and writes are allowed) or for an array of descriptors, not all
-            // elements are accessed in the general case.
-            //
-            // This workaround disables validation for the descriptor array case.
-            if (binding->count > 1) {
-                continue;
-            }
 
-            for (uint32_t index = 0; index < binding->count; index++) {
-                const auto *descriptor = binding->GetDescriptor(index);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        if (descriptor->Invalid()) {
-                            continue;
-                        }
+        // Currently, validation of memory accesses based on declared descriptors can produce false-positives.
+        // The shader can decide not to do such accesses, it can perform accesses with more narrow scope
+        // (e.g. read access, when both reads and writes are allowed) or for an array of descriptors, not all
+        // elements are accessed in the general case.
+        //
+        // This workaround disables validation for the descriptor array case.
+        if (binding->count > 1) {
+            continue;
+        }
 
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        const auto *img_view_state =
-                            static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
-                        VkImageLayout image_layout = image_descriptor->GetImageLayout();
-
-                        if (img_view_state->IsDepthSliced()) {
-                            // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                            // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
-                            // See: VUID 00343
-                            continue;
-                        }
+        for (uint32_t index = 0; index < binding->count; index++) {
+            const auto *descriptor = binding->GetDescriptor(index);
+            switch (descriptor->GetClass()) {
+                case DescriptorClass::ImageSampler:
+                case DescriptorClass::Image: {
+                    if (descriptor->Invalid()) {
+                        continue;
+                    }
 
-                        HazardResult hazard;
+                    // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                    const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
+                    const auto *img_view_state =
+                        static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
+                    VkImageLayout image_layout = image_descriptor->GetImageLayout();
+
+                    if (img_view_state->IsDepthSliced()) {
+                        // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                        // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
+                        // See: VUID 00343
+                        continue;
+                    }
 
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
-                            // Input attachments are subject to raster ordering rules
-                            hazard =
-                                current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
-                        } else {
-                            hazard = current_context_->DetectHazard(*img_view_state, sync_index);
-                        }
+                    HazardResult hazard;
 
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
-                                "Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
-                                ", index %" PRIu32 ". Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
-                                variable.decorations.binding, index, FormatHazard(hazard).c_str());
-                        }
-                        break;
+                    if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                        const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
+                        const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
+                        // Input attachments are subject to raster ordering rules
+                        hazard = current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
+                    } else {
+                        hazard = current_context_->DetectHazard(*img_view_state, sync_index);
                     }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_view_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
-                        }
-                        break;
+
+                    if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                        skip |= sync_state_->LogError(
+                            string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
+                            "Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
+                            ", index %" PRIu32 ". Access info %s.",
+                            string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
+                            sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                            sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                            sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
+                            string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
+                            variable.decorations.binding, index, FormatHazard(hazard).c_str());
                     }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        VkDeviceSize offset = buffer_descriptor->GetOffset();
-                        if (vvl::IsDynamicDescriptor(descriptor_type)) {
-                            const uint32_t dynamic_offset_index =
-                                descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
-                            if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
-                                continue;  // core validation error
-                            }
-                            offset += per_set.dynamicOffsets[dynamic_offset_index];
-                        }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range =
-                            MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
+                    break;
+                }
+                case DescriptorClass::TexelBuffer: {
+                    const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
+                    if (texel_descriptor->Invalid()) {
+                        continue;
+                    }
+                    const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                    const auto *buf_state = buf_view_state->buffer_state.get();
+                    const ResourceAccessRange range = MakeRange(*buf_view_state);
+                    auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                    if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                        skip |= sync_state_->LogError(
+                            string_SyncHazardVUID(hazard.Hazard()), buf_view_state->Handle(), loc,
+                            "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
+                            string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_view_state->Handle()).c_str(),
+                            sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                            sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                            sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
+                            string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
+                            FormatHazard(hazard).c_str());
+                    }
+                    break;
+                }
+                case DescriptorClass::GeneralBuffer: {
+                    const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
+                    if (buffer_descriptor->Invalid()) {
+                        continue;
+                    }
+                    VkDeviceSize offset = buffer_descriptor->GetOffset();
+                    if (vvl::IsDynamicDescriptor(descriptor_type)) {
+                        const uint32_t dynamic_offset_index = descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
+                        if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
+                            continue;  // core validation error
                         }
-                        break;
+                        offset += per_set.dynamicOffsets[dynamic_offset_index];
+                    }
+                    const auto *buf_state = buffer_descriptor->GetBufferState();
+                    const ResourceAccessRange range =
+                        MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
+                    auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                    if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                        skip |= sync_state_->LogError(
+                            string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
+                            "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
+                            string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_state->Handle()).c_str(),
+                            sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                            sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                            sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
+                            string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
+                            FormatHazard(hazard).c_str());
                     }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
-                    default:
-                        break;
+                    break;
                 }
+                // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
+                default:
+                    break;
             }
         }
     }
@@ -457,6 +478,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
 // TODO: Record structure repeats Validate. Unify this code, it was the source of bugs few times already.
 void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
                                                                  const ResourceUsageTag tag) {
+    syncval_stats::PhaseTimer timer(sync_state_->stats, syncval_stats::Phase::Record, (*access_log_)[tag].command);
     if (!sync_state_->syncval_settings.shader_accesses_heuristic) {
         return;
     }
@@ -472,98 +494,96 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
     using ImageDescriptor = vvl::ImageDescriptor;
     using TexelDescriptor = vvl::TexelDescriptor;
 
-    for (const auto &stage_state : pipe->stage_states) {
-        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe->RasterizationDisabled()) {
+    BufferAccessBatch buffer_batch;
+    for (const auto &resource : pipe->AccessedResources()) {
+        const auto &variable = *resource.variable;
+        if (variable.decorations.set >= per_sets->size()) {
+            // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
             continue;
-        } else if (!stage_state.entrypoint) {
+        }
+        const auto &per_set = (*per_sets)[variable.decorations.set];
+        const auto *descriptor_set = per_set.bound_descriptor_set.get();
+        if (!descriptor_set) continue;
+        auto binding = descriptor_set->GetBinding(variable.decorations.binding);
+        const auto descriptor_type = binding->type;
+        const SyncStageAccessIndex sync_index = GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, resource.stage);
+        if (sync_index == SYNC_ACCESS_INDEX_NONE) {
+            // Only the image descriptor is used, not the image
             continue;
         }
-        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
-            if (variable.decorations.set >= per_sets->size()) {
-                // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
-                continue;
-            }
-            const auto &per_set = (*per_sets)[variable.decorations.set];
-            const auto *descriptor_set = per_set.bound_descriptor_set.get();
-            if (!descriptor_set) continue;
-            auto binding = descriptor_set->GetBinding(variable.decorations.binding);
-            const auto descriptor_type = binding->type;
-            SyncStageAccessIndex sync_index =
-                GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
-
-            // Do not update state for descriptor array (the same as in Validate function).
-            if (binding->count > 1) {
-                continue;
-            }
 
-            for (uint32_t i = 0; i < binding->count; i++) {
-                const auto *descriptor = binding->GetDescriptor(i);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        if (image_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *img_view_state =
-                            static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
-                        if (img_view_state->IsDepthSliced()) {
-                            // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                            // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
-                            // See: VUID 00343
-                            continue;
-                        }
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kRaster, offset, extent,
-                                                                tag);
-                        } else {
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag);
-                        }
-                        AddCommandHandle(tag, img_view_state->Handle());
-                        break;
+        // Do not update state for descriptor array (the same as in Validate function).
+        if (binding->count > 1) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < binding->count; i++) {
+            const auto *descriptor = binding->GetDescriptor(i);
+            switch (descriptor->GetClass()) {
+                case DescriptorClass::ImageSampler:
+                case DescriptorClass::Image: {
+                    // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                    const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
+                    if (image_descriptor->Invalid()) {
+                        continue;
                     }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_view_state->Handle());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
-                        break;
+                    const auto *img_view_state =
+                        static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
+                    if (img_view_state->IsDepthSliced()) {
+                        // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                        // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
+                        // See: VUID 00343
+                        continue;
                     }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        VkDeviceSize offset = buffer_descriptor->GetOffset();
-                        if (vvl::IsDynamicDescriptor(descriptor_type)) {
-                            const uint32_t dynamic_offset_index =
-                                descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
-                            if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
-                                continue;  // core validation error
-                            }
-                            offset += per_set.dynamicOffsets[dynamic_offset_index];
+                    if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                        const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
+                        const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
+                        current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kRaster, offset, extent,
+                                                            tag);
+                    } else {
+                        current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag);
+                    }
+                    AddCommandHandle(tag, img_view_state->Handle());
+                    break;
+                }
+                case DescriptorClass::TexelBuffer: {
+                    const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
+                    if (texel_descriptor->Invalid()) {
+                        continue;
+                    }
+                    const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                    const auto *buf_state = buf_view_state->buffer_state.get();
+                    const ResourceAccessRange range = MakeRange(*buf_view_state);
+                    const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_view_state->Handle());
+                    buffer_batch.Add(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
+                    break;
+                }
+                case DescriptorClass::GeneralBuffer: {
+                    const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
+                    if (buffer_descriptor->Invalid()) {
+                        continue;
+                    }
+                    VkDeviceSize offset = buffer_descriptor->GetOffset();
+                    if (vvl::IsDynamicDescriptor(descriptor_type)) {
+                        const uint32_t dynamic_offset_index = descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
+                        if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
+                            continue;  // core validation error
                         }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_state->Handle());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
-                        break;
+                        offset += per_set.dynamicOffsets[dynamic_offset_index];
                     }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
-                    default:
-                        break;
+                    const auto *buf_state = buffer_descriptor->GetBufferState();
+                    const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
+                    const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_state->Handle());
+                    buffer_batch.Add(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
+                    break;
                 }
+                // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
+                default:
+                    break;
             }
         }
     }
+    current_context_->UpdateAccessState(buffer_batch);
 }
 
 bool CommandBufferAccessContext::ValidateDrawVertex(std::optional<uint32_t> vertexCount, uint32_t firstVertex,
@@ -610,6 +630,7 @@ bool CommandBufferAccessContext::ValidateDrawVertex(std::optional<uint32_t> vert
 
 void CommandBufferAccessContext::RecordDrawVertex(std::optional<uint32_t> vertexCount, uint32_t firstVertex,
                                                   const ResourceUsageTag tag) {
+    syncval_stats::PhaseTimer timer(sync_state_->stats, syncval_stats::Phase::Record, (*access_log_)[tag].command);
     const auto *pipe = cb_state_->GetCurrentPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS);
     if (!pipe) {
         return;
@@ -668,6 +689,7 @@ bool CommandBufferAccessContext::ValidateDrawVertexIndex(uint32_t index_count, u
 }
 
 void CommandBufferAccessContext::RecordDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, const ResourceUsageTag tag) {
+    syncval_stats::PhaseTimer timer(sync_state_->stats, syncval_stats::Phase::Record, (*access_log_)[tag].command);
     const auto &index_binding = cb_state_->index_buffer_binding;
     const auto index_buf_state = sync_state_->Get<vvl::Buffer>(index_binding.buffer);
     if (!index_buf_state) return;
@@ -749,6 +771,7 @@ bool CommandBufferAccessContext::ValidateDrawDynamicRenderingAttachment(const Lo
 }
 
 void CommandBufferAccessContext::RecordDrawAttachment(const ResourceUsageTag tag) {
+    syncval_stats::PhaseTimer timer(sync_state_->stats, syncval_stats::Phase::Record, (*access_log_)[tag].command);
     if (current_renderpass_context_) {
         current_renderpass_context_->RecordDrawSubpassAttachment(*cb_state_, tag);
     } else if (dynamic_rendering_info_) {
@@ -835,8 +858,9 @@ ResourceUsageTag CommandBufferAccessContext::RecordBeginRenderPass(
     const auto barrier_tag = NextCommandTag(command, ResourceUsageRecord::SubcommandType::kSubpassTransition);
     AddCommandHandle(barrier_tag, rp_state.Handle());
     const auto load_tag = NextSubcommandTag(command, ResourceUsageRecord::SubcommandType::kLoadOp);
-    render_pass_contexts_.emplace_back(
-        std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_));
+    auto barrier_schedule = sync_state_->GetRenderPassBarrierSchedule(rp_state, GetQueueFlags());
+    render_pass_contexts_.emplace_back(std::make_unique<RenderPassAccessContext>(rp_state, render_area, std::move(barrier_schedule),
+                                                                                 attachment_views, &cb_access_context_));
     current_renderpass_context_ = render_pass_contexts_.back().get();
     current_renderpass_context_->RecordBeginRenderPass(barrier_tag, load_tag);
     current_context_ = &current_renderpass_context_->CurrentContext();
@@ -899,6 +923,7 @@ void CommandBufferAccessContext::ResolveExecutedCommandBuffer(const AccessContex
 void CommandBufferAccessContext::ImportRecordedAccessLog(const CommandBufferAccessContext &recorded_context) {
     cbs_referenced_->emplace_back(recorded_context.GetCBStateShared());
     access_log_->insert(access_log_->end(), recorded_context.access_log_->cbegin(), recorded_context.access_log_->cend());
+    sync_state_->stats.AddAccessRecords((uint32_t)recorded_context.access_log_->size());
 
     // Adjust command indices for the log records added from recorded_context.
     const auto &recorded_label_commands = recorded_context.cb_state_->GetLabelCommands();
@@ -915,12 +940,34 @@ void CommandBufferAccessContext::ImportRecordedAccessLog(const CommandBufferAcce
     }
 }
 
+void CommandBufferAccessContext::RecordEndCommandBuffer() {
+    assert(cb_state_);
+    // The barriers recorded since the last resolve often leave runs of equal states, submits and executes replay a smaller map
+    cb_access_context_.Consolidate();
+    sync_state_->stats.UpdateCommandBufferAccessMapRanges((uint32_t)cb_access_context_.GetAccessStateMap().size());
+    const auto &label_commands = cb_state_->GetLabelCommands();
+    if (label_commands.empty()) {
+        label_commands_snapshot_.reset();
+    } else {
+        label_commands_snapshot_ = std::make_shared<const std::vector<vvl::CommandBuffer::LabelCommand>>(label_commands);
+    }
+}
+
+std::shared_ptr<const std::vector<vvl::CommandBuffer::LabelCommand>> CommandBufferAccessContext::GetLabelCommandsShared() const {
+    if (label_commands_snapshot_ || !cb_state_ || cb_state_->GetLabelCommands().empty()) {
+        return label_commands_snapshot_;
+    }
+    // Submitted without a completed recording, fall back to a private copy
+    return std::make_shared<const std::vector<vvl::CommandBuffer::LabelCommand>>(cb_state_->GetLabelCommands());
+}
+
 ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, ResourceUsageRecord::SubcommandType subcommand) {
     command_number_++;
     subcommand_number_ = 0;
     current_command_tag_ = access_log_->size();
 
     auto &record = access_log_->emplace_back(command, command_number_, subcommand, subcommand_number_, cb_state_, reset_count_);
+    sync_state_->stats.AddAccessRecords(1);
 
     if (!cb_state_->GetLabelCommands().empty()) {
         record.label_command_index = static_cast<uint32_t>(cb_state_->GetLabelCommands().size() - 1);
@@ -934,6 +981,7 @@ ResourceUsageTag CommandBufferAccessContext::NextSubcommandTag(vvl::Func command
 
     const ResourceUsageTag tag = access_log_->size();
     auto &record = access_log_->emplace_back(command, command_number_, subcommand, subcommand_number_, cb_state_, reset_count_);
+    sync_state_->stats.AddAccessRecords(1);
 
     // By default copy handle range from the main command, but can be overwritten with AddSubcommandHandle.
     const auto &main_command_record = (*access_log_)[current_command_tag_];
@@ -991,13 +1039,15 @@ void CommandBufferAccessContext::AddSubcommandHandle(ResourceUsageTag tag, const
     }
 }
 
-std::string CommandBufferAccessContext::GetDebugRegionName(const ResourceUsageRecord &record) const {
+std::string CommandBufferAccessContext::GetDebugRegionName(const ResourceUsageRecord &record,
+                                                          const vvl::LabelNames &label_names) const {
     const bool use_proxy = !proxy_label_commands_.empty();
     const auto &label_commands = use_proxy ? proxy_label_commands_ : cb_state_->GetLabelCommands();
-    return vvl::CommandBuffer::GetDebugRegionName(label_commands, record.label_command_index);
+    return vvl::CommandBuffer::GetDebugRegionName(label_names, label_commands, record.label_command_index);
 }
 
 void CommandBufferAccessContext::RecordSyncOp(SyncOpPointer &&sync_op) {
+    syncval_stats::PhaseTimer timer(sync_state_->stats, syncval_stats::Phase::Record, sync_op->GetCommand());
     auto tag = sync_op->Record(this);
     // As renderpass operations can have side effects on the command buffer access context,
     // update the sync operation to record these if any.
@@ -1081,11 +1131,7 @@ void CommandBufferAccessContext::RecordClearAttachment(ResourceUsageTag tag, con
 // VK_SYNCVAL_DEBUG_CMDBUF_PATTERN: (optional, empty string by default) pattern to match command buffer debug name
 void CommandBufferAccessContext::CheckCommandTagDebugCheckpoint() {
     auto get_cmdbuf_name = [](const DebugReport &debug_report, uint64_t cmdbuf_handle) {
-        std::unique_lock<std::mutex> lock(debug_report.debug_output_mutex);
-        std::string object_name = debug_report.GetUtilsObjectNameNoLock(cmdbuf_handle);
-        if (object_name.empty()) {
-            object_name = debug_report.GetMarkerObjectNameNoLock(cmdbuf_handle);
-        }
+        std::string object_name = debug_report.GetObjectName(cmdbuf_handle);
         vvl::ToLower(object_name);
         return object_name;
     };
@@ -1139,7 +1185,7 @@ static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags
     } else {
         for (size_t i = 0; i < syncStageAccessInfoByStageAccessIndex().size(); i++) {
             const auto &info = syncStageAccessInfoByStageAccessIndex()[i];
-            if ((flags & info.stage_access_bit).any()) {
+            if (flags.intersects(info.stage_access_bit)) {
                 if (!out_str.empty()) {
                     out_str.append(sep);
                 }
@@ -1227,7 +1273,8 @@ std::ostream &operator<<(std::ostream &out, const ResourceUsageRecord::Formatter
         }
         // Report debug region name. Empty name means that we are not inside any debug region.
         if (formatter.debug_name_provider) {
-            const std::string debug_region_name = formatter.debug_name_provider->GetDebugRegionName(record);
+            const std::string debug_region_name =
+                formatter.debug_name_provider->GetDebugRegionName(record, formatter.sync_state.label_names);
             if (!debug_region_name.empty()) {
                 out << ", debug_region: " << debug_region_name;
             }
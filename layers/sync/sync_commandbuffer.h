@@ -18,6 +18,7 @@
 
 #include "sync/sync_renderpass.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "utils/memory_accounting.h"
 
 class SyncValidator;
 
@@ -171,7 +172,7 @@ struct ResourceUsageRecord : public ResourceCmdUsageRecord {
 // Provides debug region name for the specified access log command.
 // If empty name is returned it means the command is not inside debug region.
 struct DebugNameProvider {
-    virtual std::string GetDebugRegionName(const ResourceUsageRecord &record) const = 0;
+    virtual std::string GetDebugRegionName(const ResourceUsageRecord &record, const vvl::LabelNames &label_names) const = 0;
 };
 
 // Command execution context is the base class for command buffer and queue contexts
@@ -180,7 +181,8 @@ struct DebugNameProvider {
 // TODO: determine where to draw the design split for tag tracking (is there anything command to Queues and CB's)
 class CommandExecutionContext : public SyncValidationInfo {
   public:
-    using AccessLog = std::vector<ResourceUsageRecord>;
+    using AccessLog =
+        std::vector<ResourceUsageRecord, vvl::TaggedAllocator<ResourceUsageRecord, vvl::MemoryTag::SyncvalAccessLogs>>;
     using CommandBufferSet = std::vector<std::shared_ptr<const vvl::CommandBuffer>>;
     CommandExecutionContext() : SyncValidationInfo(nullptr) {}
     CommandExecutionContext(const SyncValidator *sync_validator) : SyncValidationInfo(sync_validator) {}
@@ -305,6 +307,9 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     ResourceUsageTag RecordNextSubpass(vvl::Func command);
     ResourceUsageTag RecordEndRenderPass(vvl::Func command);
     void RecordDestroyEvent(vvl::Event *event_state);
+    // Copy of the current access context for the first scope of a set event. Events set one after the other, with no other
+    // command recorded in between, share the same copy.
+    std::shared_ptr<const AccessContext> GetEventFirstScope();
 
     void RecordExecutedCommandBuffer(const CommandBufferAccessContext &recorded_context);
     void ResolveExecutedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset);
@@ -348,11 +353,14 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     }
     std::shared_ptr<AccessLog> GetAccessLogShared() const { return access_log_; }
     std::shared_ptr<CommandBufferSet> GetCBReferencesShared() const { return cbs_referenced_; }
+    // Label commands are final once recording ends, take a snapshot that submissions of the command buffer can share
+    void RecordEndCommandBuffer();
+    std::shared_ptr<const std::vector<vvl::CommandBuffer::LabelCommand>> GetLabelCommandsShared() const;
     void ImportRecordedAccessLog(const CommandBufferAccessContext &cb_context);
     const std::vector<SyncOpEntry> &GetSyncOps() const { return sync_ops_; };
 
     // DebugNameProvider
-    std::string GetDebugRegionName(const ResourceUsageRecord &record) const override;
+    std::string GetDebugRegionName(const ResourceUsageRecord &record, const vvl::LabelNames &label_names) const override;
 
     std::vector<vvl::CommandBuffer::LabelCommand> &GetProxyLabelCommands() { return proxy_label_commands_; }
 
@@ -390,6 +398,10 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     AccessContext cb_access_context_;
     AccessContext *current_context_;
     SyncEventsContext events_context_;
+    // The last copy made by GetEventFirstScope(), the context it was copied from and the tag count it stays current for
+    std::shared_ptr<const AccessContext> event_first_scope_;
+    const AccessContext *event_first_scope_source_ = nullptr;
+    size_t event_first_scope_tag_count_ = 0;
 
     // Don't need the following for an active proxy cb context
     std::vector<std::unique_ptr<RenderPassAccessContext>> render_pass_contexts_;
@@ -404,6 +416,9 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     // Because in this case PreRecord is not called, the label state is not updated. We make
     // a copy of label state to update it locally together with proxy context.
     std::vector<vvl::CommandBuffer::LabelCommand> proxy_label_commands_;
+
+    // Label commands of the recorded command buffer, null until recording ends or if there are no labels
+    std::shared_ptr<const std::vector<vvl::CommandBuffer::LabelCommand>> label_commands_snapshot_;
 };
 
 namespace syncval_state {
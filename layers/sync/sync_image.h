@@ -16,6 +16,9 @@
  */
 #pragma once
 
+#include <mutex>
+#include <optional>
+
 #include "sync/sync_submit.h"
 #include "state_tracker/image_state.h"
 
@@ -42,9 +45,13 @@ class ImageState : public vvl::Image {
     ImageRangeGen MakeImageRangeGen(const VkImageSubresourceRange &subresource_range, bool is_depth_sliced) const;
     ImageRangeGen MakeImageRangeGen(const VkImageSubresourceRange &subresource_range, const VkOffset3D &offset,
                                     const VkExtent3D &extent, bool is_depth_sliced) const;
+    // Range generator of the whole image, made once the opaque address is set for swapchain images as they are presented and
+    // acquired every frame
+    ImageRangeGen MakeFullRangeGen() const;
 
   protected:
     VkDeviceSize opaque_base_address_ = 0U;
+    std::optional<ImageRangeGen> full_range_gen_;
 };
 
 class ImageViewState : public vvl::ImageView {
@@ -55,10 +62,25 @@ class ImageViewState : public vvl::ImageView {
     ImageRangeGen MakeImageRangeGen(const VkOffset3D &offset, const VkExtent3D &extent, VkImageAspectFlags aspect_mask = 0) const;
     const ImageRangeGen &GetFullViewImageRangeGen() const { return view_range_gen; }
 
+    // Range generators of a render area over the view, and over its depth only and stencil only parts for depth stencil views
+    struct RenderAreaRangeGens {
+        VkOffset3D offset;
+        VkExtent3D extent;
+        std::optional<ImageRangeGen> render_area;
+        std::optional<ImageRangeGen> depth_only;
+        std::optional<ImageRangeGen> stencil_only;
+    };
+    // The generators of the last render area are kept, render passes over a view almost always use the same area
+    RenderAreaRangeGens GetRenderAreaRangeGens(const VkOffset3D &offset, const VkExtent3D &extent) const;
+
   protected:
     ImageRangeGen MakeImageRangeGen() const;
     // All data members needs for MakeImageRangeGen() must be set before initializing view_range_gen... i.e. above this line.
     const ImageRangeGen view_range_gen;
+
+  private:
+    mutable std::mutex render_area_range_gens_lock_;
+    mutable std::optional<RenderAreaRangeGens> render_area_range_gens_;
 };
 
 class Swapchain : public vvl::Swapchain {
@@ -16,6 +16,10 @@
  */
 
 #include "sync/sync_op.h"
+
+#include <algorithm>
+#include <cstring>
+
 #include "sync/sync_renderpass.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_commandbuffer.h"
@@ -200,7 +204,7 @@ SyncOpBarriers::SyncOpBarriers(vvl::Func command, const SyncValidator &sync_stat
                                const VkMemoryBarrier *pMemoryBarriers, uint32_t bufferMemoryBarrierCount,
                                const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
                                const VkImageMemoryBarrier *pImageMemoryBarriers)
-    : SyncOpBase(command), barriers_(1) {
+    : SyncOpBase(command), barriers_(1), same_barriers_as_(1, 0) {
     auto &barrier_set = barriers_[0];
     barrier_set.dependency_flags = dependencyFlags;
     barrier_set.src_exec_scope = SyncExecScope::MakeSrc(queue_flags, srcStageMask);
@@ -214,12 +218,34 @@ SyncOpBarriers::SyncOpBarriers(vvl::Func command, const SyncValidator &sync_stat
                                         imageMemoryBarrierCount, pImageMemoryBarriers);
 }
 
+// Chained structures are compared by address, and padding bytes can make equal barriers compare different, the barriers are
+// then only translated once more
+template <typename Barrier>
+static bool SameBarriers(const Barrier *a, const Barrier *b, uint32_t count) {
+    return count == 0 || a == b || std::memcmp(a, b, count * sizeof(Barrier)) == 0;
+}
+
+static bool SameBarriers(const VkDependencyInfo &a, const VkDependencyInfo &b) {
+    return a.pNext == b.pNext && a.dependencyFlags == b.dependencyFlags && a.memoryBarrierCount == b.memoryBarrierCount &&
+           a.bufferMemoryBarrierCount == b.bufferMemoryBarrierCount && a.imageMemoryBarrierCount == b.imageMemoryBarrierCount &&
+           SameBarriers(a.pMemoryBarriers, b.pMemoryBarriers, a.memoryBarrierCount) &&
+           SameBarriers(a.pBufferMemoryBarriers, b.pBufferMemoryBarriers, a.bufferMemoryBarrierCount) &&
+           SameBarriers(a.pImageMemoryBarriers, b.pImageMemoryBarriers, a.imageMemoryBarrierCount);
+}
+
 SyncOpBarriers::SyncOpBarriers(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, uint32_t event_count,
                                const VkDependencyInfoKHR *dep_infos)
-    : SyncOpBase(command), barriers_(event_count) {
+    : SyncOpBase(command), barriers_(event_count), same_barriers_as_(event_count) {
     for (uint32_t i = 0; i < event_count; i++) {
         const auto &dep_info = dep_infos[i];
         auto &barrier_set = barriers_[i];
+        // An application waiting on many events often repeats one dependency info for each of them
+        if (i > 0 && SameBarriers(dep_info, dep_infos[i - 1])) {
+            barrier_set = barriers_[i - 1];
+            same_barriers_as_[i] = same_barriers_as_[i - 1];
+            continue;
+        }
+        same_barriers_as_[i] = i;
         barrier_set.dependency_flags = dep_info.dependencyFlags;
         auto stage_masks = sync_utils::GetGlobalStageMasks(dep_info);
         barrier_set.src_exec_scope = SyncExecScope::MakeSrc(queue_flags, stage_masks.src);
@@ -285,22 +311,13 @@ bool SyncOpPipelineBarrier::Validate(const CommandBufferAccessContext &cb_contex
 struct SyncOpPipelineBarrierFunctorFactory {
     using BarrierOpFunctor = PipelineBarrierOp;
     using ApplyFunctor = ApplyBarrierFunctor<BarrierOpFunctor>;
-    using GlobalBarrierOpFunctor = PipelineBarrierOp;
-    using GlobalApplyFunctor = ApplyBarrierOpsFunctor<GlobalBarrierOpFunctor>;
     using BufferRange = SingleRangeGenerator<ResourceAccessRange>;
     using ImageRange = subresource_adapter::ImageRangeGenerator;
-    using GlobalRange = SingleRangeGenerator<ResourceAccessRange>;
     using ImageState = syncval_state::ImageState;
 
     ApplyFunctor MakeApplyFunctor(QueueId queue_id, const SyncBarrier &barrier, bool layout_transition) const {
         return ApplyFunctor(BarrierOpFunctor(queue_id, barrier, layout_transition));
     }
-    GlobalApplyFunctor MakeGlobalApplyFunctor(size_t size_hint, ResourceUsageTag tag) const {
-        return GlobalApplyFunctor(true /* resolve */, size_hint, tag);
-    }
-    GlobalBarrierOpFunctor MakeGlobalBarrierOpFunctor(QueueId queue_id, const SyncBarrier &barrier) const {
-        return GlobalBarrierOpFunctor(queue_id, barrier, false);
-    }
 
     BufferRange MakeRangeGen(const vvl::Buffer &buffer, const ResourceAccessRange &range) const {
         if (!SimpleBinding(buffer)) return ResourceAccessRange();
@@ -310,7 +327,6 @@ struct SyncOpPipelineBarrierFunctorFactory {
     ImageRange MakeRangeGen(const ImageState &image, const VkImageSubresourceRange &subresource_range) const {
         return image.MakeImageRangeGen(subresource_range, false);
     }
-    GlobalRange MakeGlobalRangeGen() const { return kFullRange; }
 };
 
 template <typename Barriers, typename FunctorFactory>
@@ -352,6 +368,7 @@ ResourceUsageTag SyncOpPipelineBarrier::Record(CommandBufferAccessContext *cb_co
 }
 
 void SyncOpPipelineBarrier::ReplayRecord(CommandExecutionContext &exec_context, const ResourceUsageTag exec_tag) const {
+    syncval_stats::PhaseTimer timer(exec_context.GetSyncState().stats, syncval_stats::Phase::BarrierApplication);
     SyncOpPipelineBarrierFunctorFactory factory;
     // Pipeline barriers only have a single barrier set, unlike WaitEvents2
     assert(barriers_.size() == 1);
@@ -363,7 +380,8 @@ void SyncOpPipelineBarrier::ReplayRecord(CommandExecutionContext &exec_context,
     const auto queue_id = exec_context.GetQueueId();
     ApplyBarriers(barrier_set.buffer_memory_barriers, factory, queue_id, exec_tag, access_context);
     ApplyBarriers(barrier_set.image_memory_barriers, factory, queue_id, exec_tag, access_context);
-    ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+    // Applied lazily, as the ranges are accessed, instead of walking the whole context for each barrier
+    access_context->AddGlobalBarrier(queue_id, barrier_set.memory_barriers, exec_tag);
     if (barrier_set.single_exec_scope) {
         events_context->ApplyBarrier(barrier_set.src_exec_scope, barrier_set.dst_exec_scope, exec_tag);
     } else {
@@ -417,10 +435,7 @@ void SyncOpBarriers::BarrierSet::MakeMemoryBarriers(VkQueueFlags queue_flags, Vk
     memory_barriers.reserve(memory_barrier_count);
     for (uint32_t barrier_index = 0; barrier_index < memory_barrier_count; barrier_index++) {
         const auto &barrier = barriers[barrier_index];
-        auto src = SyncExecScope::MakeSrc(queue_flags, barrier.srcStageMask);
-        auto dst = SyncExecScope::MakeDst(queue_flags, barrier.dstStageMask);
-        SyncBarrier sync_barrier(barrier, src, dst);
-        memory_barriers.emplace_back(sync_barrier);
+        memory_barriers.emplace_back(queue_flags, barrier);
     }
     single_exec_scope = false;
 }
@@ -431,12 +446,10 @@ void SyncOpBarriers::BarrierSet::MakeBufferMemoryBarriers(const SyncValidator &s
     buffer_memory_barriers.reserve(barrier_count);
     for (uint32_t index = 0; index < barrier_count; index++) {
         const auto &barrier = barriers[index];
-        auto src = SyncExecScope::MakeSrc(queue_flags, barrier.srcStageMask);
-        auto dst = SyncExecScope::MakeDst(queue_flags, barrier.dstStageMask);
         auto buffer = sync_state.Get<vvl::Buffer>(barrier.buffer);
         if (buffer) {
             const auto range = MakeRange(*buffer, barrier.offset, barrier.size);
-            const SyncBarrier sync_barrier(barrier, src, dst);
+            const SyncBarrier sync_barrier(queue_flags, barrier);
             buffer_memory_barriers.emplace_back(buffer, sync_barrier, range);
         } else {
             buffer_memory_barriers.emplace_back();
@@ -468,12 +481,10 @@ void SyncOpBarriers::BarrierSet::MakeImageMemoryBarriers(const SyncValidator &sy
     image_memory_barriers.reserve(barrier_count);
     for (uint32_t index = 0; index < barrier_count; index++) {
         const auto &barrier = barriers[index];
-        auto src = SyncExecScope::MakeSrc(queue_flags, barrier.srcStageMask);
-        auto dst = SyncExecScope::MakeDst(queue_flags, barrier.dstStageMask);
         auto image = sync_state.Get<ImageState>(barrier.image);
         if (image) {
             auto subresource_range = NormalizeSubresourceRange(image->create_info, barrier.subresourceRange);
-            const SyncBarrier sync_barrier(barrier, src, dst);
+            const SyncBarrier sync_barrier(queue_flags, barrier);
             image_memory_barriers.emplace_back(image, index, sync_barrier, barrier.oldLayout, barrier.newLayout, subresource_range);
         } else {
             image_memory_barriers.emplace_back();
@@ -742,12 +753,24 @@ void SyncOpWaitEvents::ReplayRecord(CommandExecutionContext &exec_context, Resou
     // all accesses. Can instead import for all first_scopes, or a union of them, if this becomes a performance/memory issue,
     // but with no idea of the performance of the union, nor of whether it even matters... take the simplest approach here,
     if (!exec_context.ValidForSyncOps()) return;
+    syncval_stats::PhaseTimer timer(exec_context.GetSyncState().stats, syncval_stats::Phase::BarrierApplication);
     AccessContext *access_context = exec_context.GetCurrentAccessContext();
     SyncEventsContext *events_context = exec_context.GetCurrentEventsContext();
     const QueueId queue_id = exec_context.GetQueueId();
 
     access_context->ResolvePreviousAccesses();
 
+    // Events set one after the other share the copy of their first scope (see GetEventFirstScope), so accesses between their
+    // set tags can't exist. The same barriers restricted to the same scope are then only applied for the first of them, as
+    // applying them again leaves the same pending barriers.
+    struct AppliedScope {
+        const AccessContext *first_scope;
+        uint32_t barriers;
+        VkPipelineStageFlags2 exec_scope;
+        SyncStageAccessFlags valid_accesses;
+    };
+    small_vector<AppliedScope, 4> applied_scopes;
+
     size_t barrier_set_index = 0;
     size_t barrier_set_incr = (barriers_.size() == 1) ? 0 : 1;
     assert(barriers_.size() == 1 || (barriers_.size() == events_.size()));
@@ -761,13 +784,24 @@ void SyncOpWaitEvents::ReplayRecord(CommandExecutionContext &exec_context, Resou
         const auto &barrier_set = barriers_[barrier_set_index];
         const auto &dst = barrier_set.dst_exec_scope;
         if (!sync_event->IsIgnoredByWait(command_, barrier_set.src_exec_scope.mask_param)) {
-            // These apply barriers one at a time as the are restricted to the resource ranges specified per each barrier,
-            // but do not update the dependency chain information (but set the "pending" state) // s.t. the order independence
-            // of the barriers is maintained.
-            SyncOpWaitEventsFunctorFactory factory(sync_event);
-            ApplyBarriers(barrier_set.buffer_memory_barriers, factory, queue_id, exec_tag, access_context);
-            ApplyBarriers(barrier_set.image_memory_barriers, factory, queue_id, exec_tag, access_context);
-            ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+            const AppliedScope scope{sync_event->first_scope.get(), same_barriers_as_[barrier_set_index],
+                                     sync_event->scope.exec_scope, sync_event->scope.valid_accesses};
+            const bool applied = std::any_of(applied_scopes.begin(), applied_scopes.end(), [&scope](const AppliedScope &other) {
+                return other.first_scope == scope.first_scope && other.barriers == scope.barriers &&
+                       other.exec_scope == scope.exec_scope && other.valid_accesses == scope.valid_accesses;
+            });
+            if (!applied) {
+                // These apply barriers one at a time as the are restricted to the resource ranges specified per each barrier,
+                // but do not update the dependency chain information (but set the "pending" state) // s.t. the order
+                // independence of the barriers is maintained.
+                SyncOpWaitEventsFunctorFactory factory(sync_event);
+                ApplyBarriers(barrier_set.buffer_memory_barriers, factory, queue_id, exec_tag, access_context);
+                ApplyBarriers(barrier_set.image_memory_barriers, factory, queue_id, exec_tag, access_context);
+                ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+                if (scope.first_scope) {
+                    applied_scopes.emplace_back(scope);
+                }
+            }
 
             // Apply the global barrier to the event itself (for race condition tracking)
             // Events don't happen at a stage, so we need to store the unexpanded ALL_COMMANDS if set for inter-event-calls
@@ -877,32 +911,26 @@ void SyncOpResetEvent::ReplayRecord(CommandExecutionContext &exec_context, Resou
 }
 
 SyncOpSetEvent::SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, VkEvent event,
-                               VkPipelineStageFlags2KHR stageMask, const AccessContext *access_context)
+                               VkPipelineStageFlags2KHR stageMask, std::shared_ptr<const AccessContext> access_context)
     : SyncOpBase(command),
       event_(sync_state.Get<vvl::Event>(event)),
-      recorded_context_(),
+      recorded_context_(std::move(access_context)),
       src_exec_scope_(SyncExecScope::MakeSrc(queue_flags, stageMask)),
       dep_info_() {
-    // Snapshot the current access_context for later inspection at wait time.
+    // The access context is a snapshot of the command buffer access context (see GetEventFirstScope) for later inspection at
+    // wait time.
     // NOTE: This appears brute force, but given that we only save a "first-last" model of access history, the current
     //       access context (include barrier state for chaining) won't necessarily contain the needed information at Wait
     //       or Submit time reference.
-    if (access_context) {
-        recorded_context_ = std::make_shared<const AccessContext>(*access_context);
-    }
 }
 
 SyncOpSetEvent::SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, VkEvent event,
-                               const VkDependencyInfoKHR &dep_info, const AccessContext *access_context)
+                               const VkDependencyInfoKHR &dep_info, std::shared_ptr<const AccessContext> access_context)
     : SyncOpBase(command),
       event_(sync_state.Get<vvl::Event>(event)),
-      recorded_context_(),
+      recorded_context_(std::move(access_context)),
       src_exec_scope_(SyncExecScope::MakeSrc(queue_flags, sync_utils::GetGlobalStageMasks(dep_info).src)),
-      dep_info_(new vku::safe_VkDependencyInfo(&dep_info)) {
-    if (access_context) {
-        recorded_context_ = std::make_shared<const AccessContext>(*access_context);
-    }
-}
+      dep_info_(new vku::safe_VkDependencyInfo(&dep_info)) {}
 
 bool SyncOpSetEvent::Validate(const CommandBufferAccessContext &cb_context) const {
     return DoValidate(cb_context, ResourceUsageRecord::kMaxIndex);
@@ -1226,7 +1254,8 @@ bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range
         // We're allowing for the Replay(Validate|Record) to modify the exec_context (e.g. for Renderpass operations), so
         // we need to fetch the current access context each time
         hazard = GetRecordedAccessContext()->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
-                                                                  *exec_context_.GetCurrentAccessContext());
+                                                                  *exec_context_.GetCurrentAccessContext(),
+                                                                  exec_context_.GetSyncState().submit_validation_pool.get());
 
         if (hazard.IsHazard()) {
             const SyncValidator &sync_state = exec_context_.GetSyncState();
@@ -1279,7 +1308,13 @@ AccessContext *ReplayState::RenderPassReplayState::Begin(VkQueueFlags queue_flag
     assert(rp_context);
     replay_context = &rp_context->GetContexts()[0];
 
-    InitSubpassContexts(queue_flags, *rp_context->GetRenderPassState(), &external_context, subpass_contexts);
+    const RenderPassBarrierSchedule &recorded_schedule = rp_context->GetBarrierSchedule();
+    if (recorded_schedule.queue_flags == queue_flags) {
+        InitSubpassContexts(recorded_schedule, &external_context, subpass_contexts);
+    } else {
+        const RenderPassBarrierSchedule barrier_schedule(queue_flags, rp_context->GetRenderPassState()->subpass_dependencies);
+        InitSubpassContexts(barrier_schedule, &external_context, subpass_contexts);
+    }
 
     // Replace the Async contexts with the the async context of the "external" context
     // For replay we don't care about async subpasses, just async queue batches
@@ -160,6 +160,7 @@ class SyncOpBase {
     virtual ~SyncOpBase() = default;
 
     const char *CmdName() const { return vvl::String(command_); }
+    vvl::Func GetCommand() const { return command_; }
 
     virtual bool Validate(const CommandBufferAccessContext &cb_context) const = 0;
     virtual ResourceUsageTag Record(CommandBufferAccessContext *cb_context) = 0;
@@ -218,6 +219,8 @@ class SyncOpBarriers : public SyncOpBase {
                                      uint32_t barrier_count, const VkImageMemoryBarrier2 *barriers);
     };
     std::vector<BarrierSet> barriers_;
+    // For each barrier set, the index of the first one translated from the same barriers
+    std::vector<uint32_t> same_barriers_as_;
 };
 
 class SyncOpPipelineBarrier : public SyncOpBarriers {
@@ -284,9 +287,9 @@ class SyncOpResetEvent : public SyncOpBase {
 class SyncOpSetEvent : public SyncOpBase {
   public:
     SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, VkEvent event,
-                   VkPipelineStageFlags2KHR stageMask, const AccessContext *access_context);
+                   VkPipelineStageFlags2KHR stageMask, std::shared_ptr<const AccessContext> access_context);
     SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, VkEvent event,
-                   const VkDependencyInfoKHR &dep_info, const AccessContext *access_context);
+                   const VkDependencyInfoKHR &dep_info, std::shared_ptr<const AccessContext> access_context);
     ~SyncOpSetEvent() override = default;
 
     bool Validate(const CommandBufferAccessContext &cb_context) const override;
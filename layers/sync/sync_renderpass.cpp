@@ -68,14 +68,14 @@ class UpdateStateResolveAction {
     const ResourceUsageTag tag_;
 };
 
-void InitSubpassContexts(VkQueueFlags queue_flags, const vvl::RenderPass &rp_state, const AccessContext *external_context,
+void InitSubpassContexts(const RenderPassBarrierSchedule &barrier_schedule, const AccessContext *external_context,
                          std::vector<AccessContext> &subpass_contexts) {
-    const auto &create_info = rp_state.create_info;
+    const uint32_t subpass_count = static_cast<uint32_t>(barrier_schedule.subpasses.size());
     // Add this for all subpasses here so that they exsist during next subpass validation
     subpass_contexts.clear();
-    subpass_contexts.reserve(create_info.subpassCount);
-    for (uint32_t pass = 0; pass < create_info.subpassCount; pass++) {
-        subpass_contexts.emplace_back(pass, queue_flags, rp_state.subpass_dependencies, subpass_contexts, external_context);
+    subpass_contexts.reserve(subpass_count);
+    for (uint32_t pass = 0; pass < subpass_count; pass++) {
+        subpass_contexts.emplace_back(pass, barrier_schedule, subpass_contexts, external_context);
     }
 }
 
@@ -873,12 +873,16 @@ AttachmentViewGenVector RenderPassAccessContext::CreateAttachmentViewGen(
     return view_gens;
 }
 RenderPassAccessContext::RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area,
-                                                 VkQueueFlags queue_flags,
+                                                 std::shared_ptr<const RenderPassBarrierSchedule> barrier_schedule,
                                                  const std::vector<const syncval_state::ImageViewState *> &attachment_views,
                                                  const AccessContext *external_context)
-    : rp_state_(&rp_state), render_area_(render_area), current_subpass_(0U), attachment_views_() {
+    : rp_state_(&rp_state),
+      barrier_schedule_(std::move(barrier_schedule)),
+      render_area_(render_area),
+      current_subpass_(0U),
+      attachment_views_() {
     // Add this for all subpasses here so that they exist during next subpass validation
-    InitSubpassContexts(queue_flags, rp_state, external_context, subpass_contexts_);
+    InitSubpassContexts(*barrier_schedule_, external_context, subpass_contexts_);
     attachment_views_ = CreateAttachmentViewGen(render_area, attachment_views);
 }
 void RenderPassAccessContext::RecordBeginRenderPass(const ResourceUsageTag barrier_tag, const ResourceUsageTag load_tag) {
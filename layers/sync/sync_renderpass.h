@@ -72,7 +72,7 @@ struct BeginRenderingCmdState {
 };
 }  // namespace syncval_state
 
-void InitSubpassContexts(VkQueueFlags queue_flags, const vvl::RenderPass &rp_state, const AccessContext *external_context,
+void InitSubpassContexts(const RenderPassBarrierSchedule &barrier_schedule, const AccessContext *external_context,
                          std::vector<AccessContext> &subpass_contexts);
 
 struct ClearAttachmentInfo {
@@ -104,7 +104,8 @@ class RenderPassAccessContext {
     static AttachmentViewGenVector CreateAttachmentViewGen(
         const VkRect2D &render_area, const std::vector<const syncval_state::ImageViewState *> &attachment_views);
     RenderPassAccessContext() : rp_state_(nullptr), render_area_(VkRect2D()), current_subpass_(0) {}
-    RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
+    RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area,
+                            std::shared_ptr<const RenderPassBarrierSchedule> barrier_schedule,
                             const std::vector<const syncval_state::ImageViewState *> &attachment_views,
                             const AccessContext *external_context);
 
@@ -151,10 +152,12 @@ class RenderPassAccessContext {
     const std::vector<AccessContext> &GetContexts() const { return subpass_contexts_; }
     uint32_t GetCurrentSubpass() const { return current_subpass_; }
     const vvl::RenderPass *GetRenderPassState() const { return rp_state_; }
+    const RenderPassBarrierSchedule &GetBarrierSchedule() const { return *barrier_schedule_; }
     AccessContext *CreateStoreResolveProxy() const;
 
   private:
     const vvl::RenderPass *rp_state_;
+    std::shared_ptr<const RenderPassBarrierSchedule> barrier_schedule_;
     const VkRect2D render_area_;
     uint32_t current_subpass_;
     std::vector<AccessContext> subpass_contexts_;
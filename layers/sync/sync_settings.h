@@ -17,7 +17,12 @@
 
 #pragma once
 
+#include <cstdint>
+
 struct SyncValSettings {
     bool submit_time_validation = true;
     bool shader_accesses_heuristic = false;
+    bool parallel_submit_validation = false;
+    // Memory limit in megabytes for the command records all queue batches keep for hazard messages, zero means unlimited
+    uint32_t batch_log_memory_limit = 0;
 };
@@ -21,7 +21,9 @@
 #include "sync_commandbuffer.h"
 #include "utils/vk_layer_utils.h"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace syncval_stats {
 
@@ -49,6 +51,11 @@ void ValueMax32::Add(uint32_t n) {
 
 void ValueMax32::Sub(uint32_t n) { value.Sub(n); }
 
+void Timer64::Add(uint64_t ns) {
+    nanoseconds.fetch_add(ns);
+    calls.fetch_add(1);
+}
+
 Stats::~Stats() {
     if (report_on_destruction) {
         const std::string report = CreateReport();
@@ -71,6 +78,31 @@ void Stats::RemoveUnresolvedBatch() { unresolved_batch_counter.Sub(1); }
 void Stats::AddHandleRecord(uint32_t count) { handle_record_counter.Add(count); }
 void Stats::RemoveHandleRecord(uint32_t count) { handle_record_counter.Sub(count); }
 
+void Stats::AddEvictedAccessRecords(uint32_t count) { evicted_access_record_counter.Add(count); }
+
+void Stats::AddAccessRecords(uint32_t count) { access_record_counter.Add(count); }
+void Stats::RemoveAccessRecords(uint32_t count) { access_record_counter.Sub(count); }
+
+void Stats::UpdateCommandBufferAccessMapRanges(uint32_t count) { command_buffer_access_map_ranges.Update(count); }
+void Stats::UpdateQueueBatchAccessMapRanges(uint32_t count) { queue_batch_access_map_ranges.Update(count); }
+
+void Stats::AddPhaseTime(Phase phase, vvl::Func command, uint64_t nanoseconds) {
+    phase_timers[static_cast<size_t>(phase)].Add(nanoseconds);
+    if (command != vvl::Func::Empty) {
+        std::lock_guard<std::mutex> guard(command_timers_lock);
+        auto &command_time = command_timers[command];
+        command_time.first += nanoseconds;
+        command_time.second++;
+    }
+}
+
+void Stats::SetReportInterval(uint32_t submit_count) { report_interval = submit_count; }
+
+bool Stats::CountSubmitAndCheckReport() {
+    const uint32_t submits = submit_counter.Add(1);
+    return report_interval != 0 && (submits % report_interval) == 0;
+}
+
 void Stats::ReportOnDestruction() { report_on_destruction = true; }
 
 std::string Stats::CreateReport() {
@@ -114,6 +146,52 @@ std::string Stats::CreateReport() {
         str << "\tmax_count = " << handle_record_max << '\n';
         str << "\tmax_memory = " << handle_record_max_memory << " bytes\n";
     }
+    {
+        uint32_t evicted_access_record = evicted_access_record_counter.u32;
+        uint64_t evicted_access_record_memory = evicted_access_record * sizeof(ResourceUsageRecord);
+        str << "Evicted and released batch log records:\n";
+        str << "\tcount = " << evicted_access_record << '\n';
+        str << "\tmemory = " << evicted_access_record_memory << " bytes\n";
+    }
+    {
+        uint32_t access_record = access_record_counter.value.u32;
+        uint32_t access_record_max = access_record_counter.max_value.u32;
+        str << "Command buffer access log:\n";
+        str << "\tcount = " << access_record << '\n';
+        str << "\tmemory = " << uint64_t(access_record) * sizeof(ResourceUsageRecord) << " bytes\n";
+        str << "\tmax_count = " << access_record_max << '\n';
+        str << "\tmax_memory = " << uint64_t(access_record_max) * sizeof(ResourceUsageRecord) << " bytes\n";
+    }
+    {
+        str << "Access map ranges:\n";
+        str << "\tcommand buffer (last, max) = " << command_buffer_access_map_ranges.value.u32 << ", "
+            << command_buffer_access_map_ranges.max_value.u32 << '\n';
+        str << "\tqueue batch (last, max) = " << queue_batch_access_map_ranges.value.u32 << ", "
+            << queue_batch_access_map_ranges.max_value.u32 << '\n';
+    }
+    {
+        const char *phase_names[] = {"record", "submit validation", "barrier application"};
+        static_assert(std::size(phase_names) == static_cast<size_t>(Phase::Count));
+        str << "Time:\n";
+        for (size_t i = 0; i < phase_timers.size(); ++i) {
+            const uint64_t ns = phase_timers[i].nanoseconds.load();
+            str << '\t' << phase_names[i] << " = " << ns / 1000 << " us, calls = " << phase_timers[i].calls.load() << '\n';
+        }
+    }
+    {
+        std::vector<std::pair<vvl::Func, std::pair<uint64_t, uint64_t>>> commands;
+        {
+            std::lock_guard<std::mutex> guard(command_timers_lock);
+            commands.assign(command_timers.begin(), command_timers.end());
+        }
+        std::sort(commands.begin(), commands.end(), [](const auto &a, const auto &b) { return a.second.first > b.second.first; });
+        const size_t kMaxHotspots = 10;
+        str << "Command hotspots:\n";
+        for (size_t i = 0; i < std::min(commands.size(), kMaxHotspots); ++i) {
+            const auto &[command, time] = commands[i];
+            str << '\t' << vvl::String(command) << " = " << time.first / 1000 << " us, calls = " << time.second << '\n';
+        }
+    }
     return str.str();
 }
 
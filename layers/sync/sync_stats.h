@@ -19,16 +19,31 @@
 
 #include <string>
 #include <cstdint>
+#include "generated/error_location_helper.h"
 
 #ifndef VVL_ENABLE_SYNCVAL_STATS
 #define VVL_ENABLE_SYNCVAL_STATS 0
 #endif
 
 #if VVL_ENABLE_SYNCVAL_STATS != 0
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
 #endif
 
 namespace syncval_stats {
+
+// Timed parts of syncval. The phases can nest, barriers applied while recording or validating a submit
+// are also counted in the time of that phase.
+enum class Phase : uint32_t {
+    Record = 0,          // updating command buffer access state
+    SubmitValidation,    // replaying command buffers at submit time
+    BarrierApplication,  // applying memory and layout transition barriers
+    Count
+};
+
 #if VVL_ENABLE_SYNCVAL_STATS != 0
 
 struct Value32 {
@@ -46,6 +61,12 @@ struct ValueMax32 {
     void Sub(uint32_t n);
 };
 
+struct Timer64 {
+    std::atomic_uint64_t nanoseconds{0};
+    std::atomic_uint64_t calls{0};
+    void Add(uint64_t ns);
+};
+
 struct Stats {
     ~Stats();
     bool report_on_destruction = false;
@@ -70,10 +91,56 @@ struct Stats {
     void AddHandleRecord(uint32_t count = 1);
     void RemoveHandleRecord(uint32_t count = 1);
 
+    // Access records evicted from batch logs to respect syncval_batch_log_memory_limit, counted once their memory is released
+    Value32 evicted_access_record_counter;
+    void AddEvictedAccessRecords(uint32_t count);
+
+    // Records held by the access logs of the command buffer contexts
+    ValueMax32 access_record_counter;
+    void AddAccessRecords(uint32_t count);
+    void RemoveAccessRecords(uint32_t count);
+
+    // Size of the access maps when a command buffer ends recording and when a queue batch is retained
+    ValueMax32 command_buffer_access_map_ranges;
+    ValueMax32 queue_batch_access_map_ranges;
+    void UpdateCommandBufferAccessMapRanges(uint32_t count);
+    void UpdateQueueBatchAccessMapRanges(uint32_t count);
+
+    std::array<Timer64, static_cast<size_t>(Phase::Count)> phase_timers;
+    // Time spent in each command, the report lists the most expensive ones
+    std::mutex command_timers_lock;
+    std::unordered_map<vvl::Func, std::pair<uint64_t, uint64_t>> command_timers;  // nanoseconds, calls
+    void AddPhaseTime(Phase phase, vvl::Func command, uint64_t nanoseconds);
+
+    // Periodic report through a debug message, controlled by VK_SYNCVAL_STATS_REPORT_INTERVAL (in queue submits)
+    uint32_t report_interval = 0;
+    Value32 submit_counter;
+    void SetReportInterval(uint32_t submit_count);
+    bool CountSubmitAndCheckReport();
+
     void ReportOnDestruction();
     std::string CreateReport();
 };
 
+// Adds the time of its scope to a phase, and to the command when one is given
+class PhaseTimer {
+  public:
+    PhaseTimer(Stats &stats, Phase phase, vvl::Func command = vvl::Func::Empty)
+        : stats_(stats), phase_(phase), command_(command), start_(std::chrono::steady_clock::now()) {}
+    ~PhaseTimer() {
+        const auto duration = std::chrono::steady_clock::now() - start_;
+        stats_.AddPhaseTime(phase_, command_, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+    PhaseTimer(const PhaseTimer &) = delete;
+    PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+  private:
+    Stats &stats_;
+    Phase phase_;
+    vvl::Func command_;
+    std::chrono::steady_clock::time_point start_;
+};
+
 #else
 struct Stats {
     void AddHandleRecord(uint32_t count = 1) {}
@@ -86,8 +153,20 @@ struct Stats {
     void RemoveTimelineSignals(uint32_t count) {}
     void AddUnresolvedBatch() {}
     void RemoveUnresolvedBatch() {}
+    void AddEvictedAccessRecords(uint32_t count) {}
+    void AddAccessRecords(uint32_t count) {}
+    void RemoveAccessRecords(uint32_t count) {}
+    void UpdateCommandBufferAccessMapRanges(uint32_t count) {}
+    void UpdateQueueBatchAccessMapRanges(uint32_t count) {}
+    void SetReportInterval(uint32_t submit_count) {}
+    bool CountSubmitAndCheckReport() { return false; }
     void ReportOnDestruction() {}
     std::string CreateReport() { return "SyncVal stats are disabled in the current build configuration\n"; }
 };
+
+class PhaseTimer {
+  public:
+    PhaseTimer(Stats &, Phase, vvl::Func = vvl::Func::Empty) {}
+};
 #endif  // VVL_ENABLE_SYNCVAL_STATS != 0
 }  // namespace syncval_stats
@@ -272,6 +272,25 @@ void QueueBatchContext::Trim() {
 
     // Only conserve AccessLog references that are referenced by used_tags
     batch_log_.Trim(used_tags);
+    sync_state_->stats.UpdateQueueBatchAccessMapRanges((uint32_t)access_context_.GetAccessStateMap().size());
+
+    if (sync_state_->syncval_settings.batch_log_memory_limit != 0) {
+        batch_log_.DropEvictedRecords(sync_state_->batch_log_budget.EvictedTagLimit());
+    }
+}
+
+void QueueBatchContext::RegisterWithBatchLogBudget(ResourceUsageTag base_tag, const std::shared_ptr<const AccessLog>& log) {
+    const uint32_t memory_limit = sync_state_->syncval_settings.batch_log_memory_limit;
+    if (memory_limit == 0) {
+        return;
+    }
+    BatchLogBudget& budget = sync_state_->batch_log_budget;
+    budget.Register(base_tag, log);
+    const size_t max_records = size_t(memory_limit) * 1024 * 1024 / sizeof(ResourceUsageRecord);
+    const uint32_t released = budget.Enforce(max_records);
+    if (released != 0) {
+        sync_state_->stats.AddEvictedAccessRecords(released);
+    }
 }
 
 void QueueBatchContext::ResolveSubmittedCommandBuffer(const AccessContext& recorded_context, ResourceUsageTag offset) {
@@ -477,6 +496,7 @@ void QueueBatchContext::LogPresentOperations(const PresentedImages& presented_im
         for (const auto& presented : presented_images) {
             access_log->emplace_back(PresentResourceRecord(static_cast<const PresentedImageRecord>(presented)));
         }
+        RegisterWithBatchLogBudget(batch.base_tag, access_log);
     }
 }
 
@@ -491,6 +511,7 @@ void QueueBatchContext::LogAcquireOperation(const PresentedImage& presented, vvl
     batch.base_tag = tag_range_.begin;
     batch_log_.Insert(batch, tag_range_, access_log);
     access_log->emplace_back(AcquireResourceRecord(presented, tag_range_.begin, command));
+    RegisterWithBatchLogBudget(batch.base_tag, access_log);
 }
 
 void QueueBatchContext::SetupAccessContext(const PresentedImage& presented) {
@@ -542,6 +563,14 @@ std::string QueueBatchContext::FormatUsage(ResourceUsageTagEx tag_ex) const {
 
         // Commandbuffer Usages Information
         out << ", " << record.Formatter(*sync_state_, nullptr, access.debug_name_provider, tag_ex.handle_index);
+    } else if (access.IsEvicted()) {
+        const BatchAccessLog::BatchRecord& batch = *access.batch;
+        if (batch.queue) {
+            out << SyncNodeFormatter(*sync_state_, batch.queue->GetQueueState());
+            out << ", submit: " << batch.submit_index << ", batch: " << batch.batch_index;
+        }
+        out << ", batch_tag: " << batch.base_tag;
+        out << ", command details are not available (syncval_batch_log_memory_limit reached)";
     }
     return out.str();
 }
@@ -625,8 +654,9 @@ std::vector<BatchContextConstPtr> QueueBatchContext::ResolveSubmitWaits(vvl::spa
 }
 
 bool QueueBatchContext::ValidateSubmit(const std::vector<CommandBufferConstPtr>& command_buffers, uint64_t submit_index,
-                                       uint32_t batch_index, std::vector<std::string>& current_label_stack,
+                                       uint32_t batch_index, std::vector<uint32_t>& current_label_stack,
                                        const ErrorObject& error_obj) {
+    syncval_stats::PhaseTimer timer(sync_state_->stats, syncval_stats::Phase::SubmitValidation, error_obj.location.function);
     bool skip = false;
 
     BatchAccessLog::BatchRecord batch{queue_state_, submit_index, batch_index};
@@ -637,6 +667,9 @@ bool QueueBatchContext::ValidateSubmit(const std::vector<CommandBufferConstPtr>&
     }
     batch.base_tag = SetupBatchTags(tag_count);
 
+    // Command buffers without label commands don't change the label stack, they can share one copy of it
+    std::shared_ptr<const std::vector<uint32_t>> shared_label_stack;
+
     for (size_t index = 0; index < command_buffers.size(); index++) {
         const auto& cb = command_buffers[index];
         if (!cb) continue;
@@ -645,12 +678,19 @@ bool QueueBatchContext::ValidateSubmit(const std::vector<CommandBufferConstPtr>&
         if (access_context.GetTagCount() > 0) {
             skip |= ReplayState(*this, access_context, error_obj, uint32_t(index), batch.base_tag).ValidateFirstUse();
             // The barriers have already been applied in ValidatFirstUse
-            batch_log_.Import(batch, access_context, current_label_stack);
+            if (!shared_label_stack && !current_label_stack.empty()) {
+                shared_label_stack = std::make_shared<const std::vector<uint32_t>>(current_label_stack);
+            }
+            batch_log_.Import(batch, access_context, shared_label_stack);
+            RegisterWithBatchLogBudget(batch.base_tag, access_context.GetAccessLogShared());
             ResolveSubmittedCommandBuffer(*access_context.GetCurrentAccessContext(), batch.base_tag);
             batch.base_tag += access_context.GetTagCount();
         }
         // Apply debug label commands
-        vvl::CommandBuffer::ReplayLabelCommands(cb->GetLabelCommands(), current_label_stack);
+        if (!cb->GetLabelCommands().empty()) {
+            vvl::CommandBuffer::ReplayLabelCommands(cb->GetLabelCommands(), current_label_stack);
+            shared_label_stack.reset();
+        }
         batch.cb_index++;
     }
     return skip;
@@ -773,11 +813,12 @@ void QueueSyncState::ClearPending() const {
 }
 
 void BatchAccessLog::Import(const BatchRecord& batch, const CommandBufferAccessContext& cb_access,
-                            const std::vector<std::string>& initial_label_stack) {
+                            std::shared_ptr<const std::vector<uint32_t>> initial_label_stack) {
     ResourceUsageRange import_range = {batch.base_tag, batch.base_tag + cb_access.GetTagCount()};
-    log_map_.insert(std::make_pair(import_range, CBSubmitLog(batch, cb_access, initial_label_stack)));
+    log_map_.insert(std::make_pair(import_range, CBSubmitLog(batch, cb_access, std::move(initial_label_stack))));
 }
 
+// The submit logs only hold references to the immutable recorded data, so importing them does not copy any of it
 void BatchAccessLog::Import(const BatchAccessLog& other) {
     for (const auto& entry : other.log_map_) {
         log_map_.insert(entry);
@@ -844,6 +885,85 @@ void BatchAccessLog::Trim(const ResourceUsageTagSet& used_tags) {
     }
 }
 
+void BatchAccessLog::DropEvictedRecords(ResourceUsageTag evicted_tag_limit) {
+    // Tags grow with submission order, so the front of the map holds the oldest command buffers
+    for (auto it = log_map_.begin(); it != log_map_.end() && it->first.end <= evicted_tag_limit; ++it) {
+        it->second.DropRecords();
+    }
+}
+
+void BatchLogBudget::Register(ResourceUsageTag base_tag, const std::shared_ptr<const AccessLog>& log) {
+    if (!log || log->empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    // An evicted log that is submitted again is referenced by batch logs again
+    auto evicted = evicted_.find(log.get());
+    if (evicted != evicted_.end()) {
+        if (evicted->second.log.expired()) {
+            // The address of a released log was reused, Enforce did not see it released yet
+            released_records_ += evicted->second.size;
+        }
+        evicted_.erase(evicted);
+    }
+    auto [it, inserted] = registered_.try_emplace(log.get());
+    Entry& entry = it->second;
+    if (!inserted) {
+        // Submitted again, or a new log at the address of a released one
+        by_tag_.erase(entry.base_tag);
+        registered_records_ -= entry.size;
+    }
+    entry.log = log;
+    entry.base_tag = base_tag;
+    entry.size = log->size();
+    registered_records_ += entry.size;
+    by_tag_.emplace(base_tag, log.get());
+}
+
+void BatchLogBudget::RemoveReleased() {
+    for (auto it = registered_.begin(); it != registered_.end();) {
+        if (it->second.log.expired()) {
+            by_tag_.erase(it->second.base_tag);
+            registered_records_ -= it->second.size;
+            it = registered_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+uint32_t BatchLogBudget::Enforce(size_t max_records) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (registered_records_ > max_records) {
+        RemoveReleased();
+        ResourceUsageTag evicted_tag_limit = evicted_tag_limit_.load(std::memory_order_relaxed);
+        while (registered_records_ > max_records && !by_tag_.empty()) {
+            auto oldest = registered_.find(by_tag_.begin()->second);
+            assert(oldest != registered_.end());
+            Entry& entry = oldest->second;
+            evicted_tag_limit = std::max(evicted_tag_limit, entry.base_tag + entry.size);
+            registered_records_ -= entry.size;
+            evicted_.insert_or_assign(oldest->first, std::move(entry));
+            by_tag_.erase(by_tag_.begin());
+            registered_.erase(oldest);
+        }
+        evicted_tag_limit_.store(evicted_tag_limit, std::memory_order_release);
+    }
+
+    // The memory of an evicted log is released once the last batch log dropped it and its command buffer was reset
+    for (auto it = evicted_.begin(); it != evicted_.end();) {
+        if (it->second.log.expired()) {
+            released_records_ += it->second.size;
+            it = evicted_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    const uint32_t released = static_cast<uint32_t>(released_records_);
+    released_records_ = 0;
+    return released;
+}
+
 BatchAccessLog::AccessRecord BatchAccessLog::GetAccessRecord(ResourceUsageTag tag) const {
     auto found_log = log_map_.find(tag);
     if (found_log != log_map_.cend()) {
@@ -854,14 +974,22 @@ BatchAccessLog::AccessRecord BatchAccessLog::GetAccessRecord(ResourceUsageTag ta
     return AccessRecord();
 }
 
-std::string BatchAccessLog::CBSubmitLog::GetDebugRegionName(const ResourceUsageRecord& record) const {
+std::string BatchAccessLog::CBSubmitLog::GetDebugRegionName(const ResourceUsageRecord& record,
+                                                            const vvl::LabelNames& label_names) const {
+    static const std::vector<vvl::CommandBuffer::LabelCommand> empty_label_commands;
+    static const std::vector<uint32_t> empty_label_stack;
     // const auto& label_commands = (*cbs_)[0]->GetLabelCommands();
-    const auto& label_commands = label_commands_;  // TODO: use the above line when timelines are supported
-    return vvl::CommandBuffer::GetDebugRegionName(label_commands, record.label_command_index, initial_label_stack_);
+    // TODO: use the above line when timelines are supported
+    const auto& label_commands = label_commands_ ? *label_commands_ : empty_label_commands;
+    const auto& initial_label_stack = initial_label_stack_ ? *initial_label_stack_ : empty_label_stack;
+    return vvl::CommandBuffer::GetDebugRegionName(label_names, label_commands, record.label_command_index, initial_label_stack);
 }
 
 BatchAccessLog::AccessRecord BatchAccessLog::CBSubmitLog::GetAccessRecord(ResourceUsageTag tag) const {
     assert(tag >= batch_.base_tag);
+    if (!log_) {
+        return AccessRecord{&batch_, nullptr, nullptr};
+    }
     const size_t index = tag - batch_.base_tag;
     assert(log_);
     assert(index < log_->size());
@@ -870,16 +998,25 @@ BatchAccessLog::AccessRecord BatchAccessLog::CBSubmitLog::GetAccessRecord(Resour
     return AccessRecord{&batch_, record, debug_name_provider};
 }
 
+void BatchAccessLog::CBSubmitLog::DropRecords() {
+    cbs_.reset();
+    log_.reset();
+    initial_label_stack_.reset();
+    label_commands_.reset();
+}
+
 BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch,
                                          std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs,
                                          std::shared_ptr<const CommandExecutionContext::AccessLog> log)
     : batch_(batch), cbs_(cbs), log_(log) {}
 
 BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch, const CommandBufferAccessContext& cb,
-                                         const std::vector<std::string>& initial_label_stack)
-    : batch_(batch), cbs_(cb.GetCBReferencesShared()), log_(cb.GetAccessLogShared()), initial_label_stack_(initial_label_stack) {
-    label_commands_ = (*cbs_)[0]->GetLabelCommands();  // TODO: when timelines are supported use cbs directly
-}
+                                         std::shared_ptr<const std::vector<uint32_t>> initial_label_stack)
+    : batch_(batch),
+      cbs_(cb.GetCBReferencesShared()),
+      log_(cb.GetAccessLogShared()),
+      initial_label_stack_(std::move(initial_label_stack)),
+      label_commands_(cb.GetLabelCommandsShared()) {}  // TODO: when timelines are supported use cbs directly
 
 PresentedImage::PresentedImage(const SyncValidator& sync_state, QueueBatchContext::Ptr batch_, VkSwapchainKHR swapchain,
                                uint32_t image_index_, uint32_t present_index_, ResourceUsageTag tag_)
@@ -915,7 +1052,7 @@ void PresentedImage::SetImage(uint32_t at_index) {
         range_gen = ImageRangeGen();
     } else {
         // For valid images create the type/range_gen to used to scope the semaphore operations
-        range_gen = image->MakeImageRangeGen(image->full_range, false);
+        range_gen = image->MakeFullRangeGen();
     }
 }
 
@@ -16,6 +16,10 @@
  */
 
 #pragma once
+#include <atomic>
+#include <map>
+#include <mutex>
+
 #include "sync/sync_commandbuffer.h"
 #include "state_tracker/queue_state.h"
 
@@ -181,6 +185,8 @@ class BatchAccessLog {
         const ResourceUsageRecord *record;
         const DebugNameProvider *debug_name_provider;
         bool IsValid() const { return batch && record; }
+        // The command record was dropped to stay within the batch log memory limit
+        bool IsEvicted() const { return batch && !record; }
     };
 
     struct CBSubmitLog : DebugNameProvider {
@@ -193,19 +199,22 @@ class BatchAccessLog {
         CBSubmitLog(const BatchRecord &batch, std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs,
                     std::shared_ptr<const CommandExecutionContext::AccessLog> log);
         CBSubmitLog(const BatchRecord &batch, const CommandBufferAccessContext &cb,
-                    const std::vector<std::string> &initial_label_stack);
-        size_t Size() const { return log_->size(); }
+                    std::shared_ptr<const std::vector<uint32_t>> initial_label_stack);
+        size_t Size() const { return log_ ? log_->size() : 0; }
         AccessRecord GetAccessRecord(ResourceUsageTag tag) const;
+        // Release the command records, only the batch information is kept
+        void DropRecords();
 
         // DebugNameProvider
-        std::string GetDebugRegionName(const ResourceUsageRecord &record) const override;
+        std::string GetDebugRegionName(const ResourceUsageRecord &record, const vvl::LabelNames &label_names) const override;
 
       private:
         BatchRecord batch_;
         std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs_;
         std::shared_ptr<const CommandExecutionContext::AccessLog> log_;
-        // label stack at the point when command buffer is submitted to the queue
-        std::vector<std::string> initial_label_stack_;
+        // label stack at the point when command buffer is submitted to the queue.
+        // Shared by the command buffers of a submission that start with the same stack, null if the stack is empty.
+        std::shared_ptr<const std::vector<uint32_t>> initial_label_stack_;
 
         // TODO: remove this field and use (*cbs_)[0]->GetLabelCommands() directly
         // when timeline semaphore support is implemented.
@@ -214,17 +223,20 @@ class BatchAccessLog {
         // they are supposed to be when timeline semaphores are used (they can be reused
         // after wait on timeline semaphore). When this happens, validation might report
         // false positives (which is okay for unsupported feeature), but label code can crash.
-        // Make a copy of label commands as a temporary protection measure.
-        std::vector<vvl::CommandBuffer::LabelCommand> label_commands_;
+        // Keep a reference to the label commands snapshot taken at the end of recording as a
+        // temporary protection measure. Null if the command buffer has no label commands.
+        std::shared_ptr<const std::vector<vvl::CommandBuffer::LabelCommand>> label_commands_;
     };
 
     void Import(const BatchRecord &batch, const CommandBufferAccessContext &cb_access,
-                const std::vector<std::string> &initial_label_stack);
+                std::shared_ptr<const std::vector<uint32_t>> initial_label_stack);
     void Import(const BatchAccessLog &other);
     void Insert(const BatchRecord &batch, const ResourceUsageRange &range,
                 std::shared_ptr<const CommandExecutionContext::AccessLog> log);
 
     void Trim(const ResourceUsageTagSet &used);
+    // Drop the records of the command buffers whose tags all come before evicted_tag_limit (see BatchLogBudget)
+    void DropEvictedRecords(ResourceUsageTag evicted_tag_limit);
     // AccessRecord lookup is based on global tags
     AccessRecord GetAccessRecord(ResourceUsageTag tag) const;
     BatchAccessLog() {}
@@ -234,6 +246,45 @@ class BatchAccessLog {
     CBSubmitLogRangeMap log_map_;
 };
 
+// One memory budget, shared by all queues, for the command records the batch logs keep for hazard messages
+// (syncval_batch_log_memory_limit). The batch logs share the records of a command buffer by reference, so each record is
+// counted once, however many batch logs refer to it.
+//
+// When the registered records go over the limit, the oldest ones are evicted by raising EvictedTagLimit(). Each batch log drops
+// the evicted records on its next Trim. Their memory is only released once no batch log and no command buffer refers to them,
+// so a command buffer that is still recorded keeps its records alive. Only released records are reported as such.
+class BatchLogBudget {
+  public:
+    using AccessLog = CommandExecutionContext::AccessLog;
+
+    // Called for every log a batch log references. A log submitted again is registered again with its new base tag.
+    void Register(ResourceUsageTag base_tag, const std::shared_ptr<const AccessLog> &log);
+    // Evicts the oldest records while more than max_records are registered.
+    // Returns the number of evicted records whose memory was released since the last call.
+    uint32_t Enforce(size_t max_records);
+    // The highest tag of the evicted records, plus one
+    ResourceUsageTag EvictedTagLimit() const { return evicted_tag_limit_.load(std::memory_order_acquire); }
+
+  private:
+    struct Entry {
+        std::weak_ptr<const AccessLog> log;
+        ResourceUsageTag base_tag = 0;
+        size_t size = 0;
+    };
+    // Removes the entries of logs that were released without being evicted
+    void RemoveReleased();
+
+    std::mutex lock_;
+    // Registered logs that are not evicted, by the base tag of their latest submission
+    std::map<ResourceUsageTag, const AccessLog *> by_tag_;
+    vvl::unordered_map<const AccessLog *, Entry> registered_;
+    size_t registered_records_ = 0;
+    // Evicted logs whose memory may still be referenced
+    vvl::unordered_map<const AccessLog *, Entry> evicted_;
+    size_t released_records_ = 0;  // Not reported by Enforce yet
+    std::atomic<ResourceUsageTag> evicted_tag_limit_{0};
+};
+
 // Batch that has wait-before-signal dependencies.
 struct UnresolvedBatch {
     BatchContextPtr batch;
@@ -255,17 +306,29 @@ struct UnresolvedBatch {
     std::vector<VkSemaphoreSubmitInfo> signals;
 
     // Queue's label stack at the beginning of this batch
-    std::vector<std::string> label_stack;
+    std::vector<uint32_t> label_stack;
 };
 
 // Helper struct to resolve wait-before-signal
 struct UnresolvedQueue {
     std::shared_ptr<QueueSyncState> queue_state;
     std::vector<UnresolvedBatch> unresolved_batches;
+    // The batches before this one were resolved, in submission order
+    size_t resolved_count = 0;
+    // Incremented each time the first unresolved batch blocks, TimelineWaiter entries of earlier blocks are stale
+    uint32_t wait_generation = 0;
     // whether unresolved state should be updated for this queue
     bool update_unresolved = false;
 };
 
+// Only the first unresolved batch of a queue can be resolved, it blocks the queue on its remaining waits.
+// The blocked queues are indexed by semaphore and wait value, so a signal wakes only the queues it can unblock.
+struct TimelineWaiter {
+    size_t queue_index;
+    uint32_t wait_generation;
+};
+using TimelineWaiters = vvl::unordered_map<VkSemaphore, std::multimap<uint64_t, TimelineWaiter>>;
+
 class QueueBatchContext : public CommandExecutionContext, public std::enable_shared_from_this<QueueBatchContext> {
   public:
     class PresentResourceRecord : public AlternateResourceUsage::RecordBase {
@@ -322,7 +385,7 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
                                                          SignalsUpdate &signals_update);
 
     bool ValidateSubmit(const std::vector<CommandBufferConstPtr> &command_buffers, uint64_t submit_index, uint32_t batch_index,
-                        std::vector<std::string> &current_label_stack, const ErrorObject &error_obj);
+                        std::vector<uint32_t> &current_label_stack, const ErrorObject &error_obj);
     void ResolveSubmittedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset);
 
     // For Present
@@ -356,6 +419,8 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
 
   private:
     void ResolvePresentSemaphoreWait(const SignalInfo &signal_info, const PresentedImages &presented_images);
+    // Accounts for a log referenced by batch_log_ in the batch log memory limit, if there is one
+    void RegisterWithBatchLogBudget(ResourceUsageTag base_tag, const std::shared_ptr<const AccessLog> &log);
 
   private:
     const QueueSyncState *queue_state_ = nullptr;
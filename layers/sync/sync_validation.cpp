@@ -22,6 +22,7 @@
 #include "sync/sync_validation.h"
 #include "sync/sync_image.h"
 #include "state_tracker/buffer_state.h"
+#include "state_tracker/render_pass_state.h"
 #include "utils/convert_utils.h"
 #include "vk_layer_config.h"
 
@@ -299,7 +300,7 @@ std::shared_ptr<vvl::Image> SyncValidator::CreateImageState(VkImage handle, cons
 std::shared_ptr<vvl::ImageView> SyncValidator::CreateImageViewState(
     const std::shared_ptr<vvl::Image> &image_state, VkImageView handle, const VkImageViewCreateInfo *create_info,
     VkFormatFeatureFlags2 format_features, const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) {
-    return std::make_shared<ImageViewState>(image_state, handle, create_info, format_features, cubic_props);
+    return state_object::MakePooledState<ImageViewState>(image_state, handle, create_info, format_features, cubic_props);
 }
 
 bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
@@ -360,17 +361,19 @@ void SyncValidator::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, Vk
     auto dst_buffer = Get<vvl::Buffer>(dstBuffer);
     auto dst_tag_ex = dst_buffer ? cb_context->AddCommandHandle(tag, dst_buffer->Handle()) : ResourceUsageTagEx{tag};
 
+    BufferAccessBatch batch;
     for (uint32_t region = 0; region < regionCount; region++) {
         const auto &copy_region = pRegions[region];
         if (src_buffer) {
             const ResourceAccessRange src_range = MakeRange(*src_buffer, copy_region.srcOffset, copy_region.size);
-            context->UpdateAccessState(*src_buffer, SYNC_COPY_TRANSFER_READ, SyncOrdering::kNonAttachment, src_range, src_tag_ex);
+            batch.Add(*src_buffer, SYNC_COPY_TRANSFER_READ, SyncOrdering::kNonAttachment, src_range, src_tag_ex);
         }
         if (dst_buffer) {
             const ResourceAccessRange dst_range = MakeRange(*dst_buffer, copy_region.dstOffset, copy_region.size);
-            context->UpdateAccessState(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, SyncOrdering::kNonAttachment, dst_range, dst_tag_ex);
+            batch.Add(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, SyncOrdering::kNonAttachment, dst_range, dst_tag_ex);
         }
     }
+    context->UpdateAccessState(batch);
 }
 
 bool SyncValidator::PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfo,
@@ -435,17 +438,19 @@ void SyncValidator::RecordCmdCopyBuffer2(VkCommandBuffer commandBuffer, const Vk
     auto dst_buffer = Get<vvl::Buffer>(pCopyBufferInfo->dstBuffer);
     auto dst_tag_ex = dst_buffer ? cb_context->AddCommandHandle(tag, dst_buffer->Handle()) : ResourceUsageTagEx{tag};
 
+    BufferAccessBatch batch;
     for (uint32_t region = 0; region < pCopyBufferInfo->regionCount; region++) {
         const auto &copy_region = pCopyBufferInfo->pRegions[region];
         if (src_buffer) {
             const ResourceAccessRange src_range = MakeRange(*src_buffer, copy_region.srcOffset, copy_region.size);
-            context->UpdateAccessState(*src_buffer, SYNC_COPY_TRANSFER_READ, SyncOrdering::kNonAttachment, src_range, src_tag_ex);
+            batch.Add(*src_buffer, SYNC_COPY_TRANSFER_READ, SyncOrdering::kNonAttachment, src_range, src_tag_ex);
         }
         if (dst_buffer) {
             const ResourceAccessRange dst_range = MakeRange(*dst_buffer, copy_region.dstOffset, copy_region.size);
-            context->UpdateAccessState(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, SyncOrdering::kNonAttachment, dst_range, dst_tag_ex);
+            batch.Add(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, SyncOrdering::kNonAttachment, dst_range, dst_tag_ex);
         }
     }
+    context->UpdateAccessState(batch);
 }
 
 void SyncValidator::PreCallRecordCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR *pCopyBufferInfo,
@@ -725,6 +730,16 @@ void SyncValidator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, cons
         queue_sync_states_.emplace_back(std::make_shared<QueueSyncState>(queue, queue_id_limit_++));
     }
 
+    if (syncval_settings.submit_time_validation && syncval_settings.parallel_submit_validation) {
+        submit_validation_pool = std::make_unique<vvl::ThreadPool>(vvl::ThreadPool::DefaultThreadCount());
+    }
+
+    // Specify non-zero number N to get the stats report in a debug message every N queue submits
+    const auto env_stats_report_interval = GetEnvironment("VK_SYNCVAL_STATS_REPORT_INTERVAL");
+    if (!env_stats_report_interval.empty()) {
+        stats.SetReportInterval(static_cast<uint32_t>(std::stoul(env_stats_report_interval)));
+    }
+
     const auto env_debug_command_number = GetEnvironment("VK_SYNCVAL_DEBUG_COMMAND_NUMBER");
     if (!env_debug_command_number.empty()) {
         debug_command_number = static_cast<uint32_t>(std::stoul(env_debug_command_number));
@@ -756,6 +771,77 @@ void SyncValidator::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore s
     StateTracker::PreCallRecordDestroySemaphore(device, semaphore, pAllocator, record_obj);
 }
 
+std::shared_ptr<const RenderPassBarrierSchedule> SyncValidator::GetRenderPassBarrierSchedule(const vvl::RenderPass &rp_state,
+                                                                                            VkQueueFlags queue_flags) const {
+    const VkRenderPass render_pass = rp_state.VkHandle();
+    {
+        std::shared_lock<std::shared_mutex> guard(render_pass_barrier_schedules_lock_);
+        if (auto it = render_pass_barrier_schedules_.find(render_pass); it != render_pass_barrier_schedules_.end()) {
+            for (const auto &barrier_schedule : it->second) {
+                if (barrier_schedule->queue_flags == queue_flags) {
+                    return barrier_schedule;
+                }
+            }
+        }
+    }
+
+    // A queue type no device queue has, keep it for the next instances
+    auto barrier_schedule = std::make_shared<const RenderPassBarrierSchedule>(queue_flags, rp_state.subpass_dependencies);
+    std::unique_lock<std::shared_mutex> guard(render_pass_barrier_schedules_lock_);
+    if (auto it = render_pass_barrier_schedules_.find(render_pass); it != render_pass_barrier_schedules_.end()) {
+        it->second.emplace_back(barrier_schedule);
+    }
+    return barrier_schedule;
+}
+
+void SyncValidator::AddRenderPassBarrierSchedules(VkRenderPass render_pass) {
+    auto rp_state = Get<vvl::RenderPass>(render_pass);
+    if (!rp_state) {
+        return;
+    }
+    std::vector<std::shared_ptr<const RenderPassBarrierSchedule>> barrier_schedules;
+    for (const auto &queue_sync_state : queue_sync_states_) {
+        const VkQueueFlags queue_flags = queue_sync_state->GetQueueFlags();
+        if ((queue_flags & VK_QUEUE_GRAPHICS_BIT) == 0) {
+            continue;
+        }
+        const bool built =
+            std::any_of(barrier_schedules.begin(), barrier_schedules.end(),
+                        [queue_flags](const auto &barrier_schedule) { return barrier_schedule->queue_flags == queue_flags; });
+        if (!built) {
+            barrier_schedules.emplace_back(
+                std::make_shared<const RenderPassBarrierSchedule>(queue_flags, rp_state->subpass_dependencies));
+        }
+    }
+    std::unique_lock<std::shared_mutex> guard(render_pass_barrier_schedules_lock_);
+    render_pass_barrier_schedules_[render_pass] = std::move(barrier_schedules);
+}
+
+void SyncValidator::PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
+                                                   const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
+                                                   const RecordObject &record_obj) {
+    StateTracker::PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, record_obj);
+    if (record_obj.result != VK_SUCCESS) return;
+    AddRenderPassBarrierSchedules(*pRenderPass);
+}
+
+void SyncValidator::PostCallRecordCreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
+                                                    const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
+                                                    const RecordObject &record_obj) {
+    StateTracker::PostCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, record_obj);
+    if (record_obj.result != VK_SUCCESS) return;
+    AddRenderPassBarrierSchedules(*pRenderPass);
+}
+
+void SyncValidator::PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass,
+                                                   const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
+    {
+        std::unique_lock<std::shared_mutex> guard(render_pass_barrier_schedules_lock_);
+        render_pass_barrier_schedules_.erase(renderPass);
+    }
+    StateTracker::PreCallRecordDestroyRenderPass(device, renderPass, pAllocator, record_obj);
+}
+
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                             const VkSubpassBeginInfo *pSubpassBeginInfo, const ErrorObject &error_obj) const {
     bool skip = false;
@@ -802,6 +888,14 @@ void SyncValidator::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuff
     cb_state->access_context.Reset();
 }
 
+void SyncValidator::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordEndCommandBuffer(commandBuffer, record_obj);
+
+    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    assert(cb_state);
+    cb_state->access_context.RecordEndCommandBuffer();
+}
+
 void SyncValidator::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                              const VkSubpassBeginInfo *pSubpassBeginInfo, Func command) {
     auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
@@ -1119,6 +1213,7 @@ void SyncValidator::RecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer, Vk
         cb_access_context->AddCommandHandle(tag, dst_image->Handle());
     }
 
+    BufferAccessBatch batch;
     for (uint32_t region = 0; region < regionCount; region++) {
         const auto &copy_region = pRegions[region];
         if (dst_image) {
@@ -1126,14 +1221,14 @@ void SyncValidator::RecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer, Vk
                 ResourceAccessRange src_range = MakeRange(
                     copy_region.bufferOffset,
                     GetBufferSizeFromCopyImage(copy_region, dst_image->create_info.format, dst_image->create_info.arrayLayers));
-                context->UpdateAccessState(*src_buffer, SYNC_COPY_TRANSFER_READ, SyncOrdering::kNonAttachment, src_range,
-                                           src_tag_ex);
+                batch.Add(*src_buffer, SYNC_COPY_TRANSFER_READ, SyncOrdering::kNonAttachment, src_range, src_tag_ex);
             }
             context->UpdateAccessState(*dst_image, SYNC_COPY_TRANSFER_WRITE, SyncOrdering::kNonAttachment,
                                        RangeFromLayers(copy_region.imageSubresource), copy_region.imageOffset,
                                        copy_region.imageExtent, tag);
         }
     }
+    context->UpdateAccessState(batch);
 }
 
 void SyncValidator::PreCallRecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
@@ -1252,6 +1347,7 @@ void SyncValidator::RecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, Vk
     const auto dst_mem = (dst_buffer && !dst_buffer->sparse) ? dst_buffer->MemState()->VkHandle() : VK_NULL_HANDLE;
     const VulkanTypedHandle dst_handle(dst_mem, kVulkanObjectTypeDeviceMemory);
 
+    BufferAccessBatch batch;
     for (uint32_t region = 0; region < regionCount; region++) {
         const auto &copy_region = pRegions[region];
         if (src_image) {
@@ -1262,11 +1358,11 @@ void SyncValidator::RecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, Vk
                 ResourceAccessRange dst_range = MakeRange(
                     copy_region.bufferOffset,
                     GetBufferSizeFromCopyImage(copy_region, src_image->create_info.format, src_image->create_info.arrayLayers));
-                context->UpdateAccessState(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, SyncOrdering::kNonAttachment, dst_range,
-                                           dst_tag_ex);
+                batch.Add(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, SyncOrdering::kNonAttachment, dst_range, dst_tag_ex);
             }
         }
     }
+    context->UpdateAccessState(batch);
 }
 
 void SyncValidator::PreCallRecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
@@ -2654,7 +2750,7 @@ void SyncValidator::PostCallRecordCmdSetEvent(VkCommandBuffer commandBuffer, VkE
     auto *cb_context = &cb_state->access_context;
 
     cb_context->RecordSyncOp<SyncOpSetEvent>(record_obj.location.function, *this, cb_context->GetQueueFlags(), event, stageMask,
-                                             cb_context->GetCurrentAccessContext());
+                                             cb_context->GetEventFirstScope());
 }
 
 bool SyncValidator::PreCallValidateCmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event,
@@ -2694,7 +2790,7 @@ void SyncValidator::PostCallRecordCmdSetEvent2(VkCommandBuffer commandBuffer, Vk
     if (!pDependencyInfo) return;
 
     cb_context->RecordSyncOp<SyncOpSetEvent>(record_obj.location.function, *this, cb_context->GetQueueFlags(), event,
-                                             *pDependencyInfo, cb_context->GetCurrentAccessContext());
+                                             *pDependencyInfo, cb_context->GetEventFirstScope());
 }
 
 bool SyncValidator::PreCallValidateCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
@@ -3287,6 +3383,10 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
         const_cast<SyncValidator *>(this)->RecordQueueSubmit(queue, fence, cmd_state);
     }
 
+    if (stats.CountSubmitAndCheckReport()) {
+        LogInfo("SYNC-STATS", queue, error_obj.location, "%s", stats.CreateReport().c_str());
+    }
+
     // Note that if we skip, guard cleans up for us, but cannot release the reserved tag range
     return skip;
 }
@@ -3304,52 +3404,79 @@ bool SyncValidator::PropagateTimelineSignals(SignalsUpdate &signals_update, cons
         }
     }
 
-    // Each iteration uses registered timeline signals to resolve existing unresolved batches.
-    // Each resolved batch can generate new timeline signals which can resolve more unresolved batches on the next iteration.
-    // This finishes when all unresolved batches are resolved or when iteration does not generate new timeline signals.
-    while (PropagateTimelineSignalsIteration(queues, signals_update, skip, error_obj)) {
-        ;
+    // Every queue is tried once with the signals known so far. After that a queue is tried again only when a resolved batch
+    // signals a value one of its waits is blocked on.
+    std::vector<size_t> ready_queues(queues.size());
+    for (size_t i = 0; i < queues.size(); ++i) {
+        ready_queues[i] = queues.size() - 1 - i;  // pop_back tries the queues in order
+    }
+    TimelineWaiters waiters;
+    while (!ready_queues.empty()) {
+        const size_t queue_index = ready_queues.back();
+        ready_queues.pop_back();
+        ResolveQueueBatches(queues, queue_index, signals_update, waiters, ready_queues, skip, error_obj);
     }
 
     // Schedule unresolved state update
     for (UnresolvedQueue &queue : queues) {
         if (queue.update_unresolved) {
-            queue.queue_state->SetPendingUnresolvedBatches(std::move(queue.unresolved_batches));
+            auto &batches = queue.unresolved_batches;
+            batches.erase(batches.begin(), batches.begin() + queue.resolved_count);
+            queue.queue_state->SetPendingUnresolvedBatches(std::move(batches));
         }
     }
     return skip;
 }
 
-bool SyncValidator::PropagateTimelineSignalsIteration(std::vector<UnresolvedQueue> &queues, SignalsUpdate &signals_update,
-                                                      bool &skip, const ErrorObject &error_obj) const {
-    bool has_new_timeline_signals = false;
-    for (auto &queue : queues) {
-        if (queue.unresolved_batches.empty()) {
-            continue;  // all batches for this queue were resolved by previous iterations
-        }
-
-        BatchContextPtr last_batch =
-            queue.queue_state->PendingLastBatch() ? queue.queue_state->PendingLastBatch() : queue.queue_state->LastBatch();
-        const BatchContextPtr initial_last_batch = last_batch;
-
-        while (!queue.unresolved_batches.empty()) {
-            auto &unresolved_batch = queue.unresolved_batches.front();
-
-            has_new_timeline_signals |= ProcessUnresolvedBatch(unresolved_batch, signals_update, last_batch, skip, error_obj);
-
-            // Remove processed batch from the (local) unresolved list
-            queue.unresolved_batches.erase(queue.unresolved_batches.begin());
-
-            // Propagate change into the queue's (global) unresolved state
+void SyncValidator::ResolveQueueBatches(std::vector<UnresolvedQueue> &queues, size_t queue_index, SignalsUpdate &signals_update,
+                                        TimelineWaiters &waiters, std::vector<size_t> &ready_queues, bool &skip,
+                                        const ErrorObject &error_obj) const {
+    UnresolvedQueue &queue = queues[queue_index];
+    BatchContextPtr last_batch =
+        queue.queue_state->PendingLastBatch() ? queue.queue_state->PendingLastBatch() : queue.queue_state->LastBatch();
+    const BatchContextPtr initial_last_batch = last_batch;
+
+    while (queue.resolved_count < queue.unresolved_batches.size()) {
+        UnresolvedBatch &unresolved_batch = queue.unresolved_batches[queue.resolved_count];
+        const size_t wait_count = unresolved_batch.unresolved_waits.size();
+        const bool resolved = ProcessUnresolvedBatch(unresolved_batch, signals_update, last_batch, skip, error_obj);
+
+        // Propagate change into the queue's (global) unresolved state
+        if (resolved || unresolved_batch.unresolved_waits.size() != wait_count) {
             queue.update_unresolved = true;
-
-            stats.RemoveUnresolvedBatch();
         }
-        if (last_batch != initial_last_batch) {
-            queue.queue_state->SetPendingLastBatch(std::move(last_batch));
+        if (!resolved) {
+            // The later batches of the queue wait for this one
+            ++queue.wait_generation;
+            for (const VkSemaphoreSubmitInfo &wait_info : unresolved_batch.unresolved_waits) {
+                waiters[wait_info.semaphore].emplace(wait_info.value, TimelineWaiter{queue_index, queue.wait_generation});
+            }
+            break;
         }
+        ++queue.resolved_count;
+        stats.RemoveUnresolvedBatch();
+
+        // Wake the queues blocked on the values signaled by this batch
+        for (const VkSemaphoreSubmitInfo &signal_info : unresolved_batch.signals) {
+            auto semaphore_waiters = waiters.find(signal_info.semaphore);
+            if (semaphore_waiters == waiters.end()) {
+                continue;  // also skips binary semaphores, only timeline waits block
+            }
+            auto &by_value = semaphore_waiters->second;
+            const auto woken_end = by_value.upper_bound(signal_info.value);
+            for (auto it = by_value.begin(); it != woken_end; ++it) {
+                UnresolvedQueue &waiting_queue = queues[it->second.queue_index];
+                if (it->second.wait_generation == waiting_queue.wait_generation) {
+                    ++waiting_queue.wait_generation;  // queued once, even if several of its waits are reached
+                    ready_queues.emplace_back(it->second.queue_index);
+                }
+            }
+            by_value.erase(by_value.begin(), woken_end);
+        }
+    }
+    if (last_batch != initial_last_batch) {
+        queue.queue_state->SetPendingLastBatch(std::move(last_batch));
     }
-    return has_new_timeline_signals;
 }
 
 bool SyncValidator::ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, SignalsUpdate &signals_update,
@@ -3373,7 +3500,7 @@ bool SyncValidator::ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, Si
 
     // This batch still has unresolved waits
     if (!unresolved_batch.unresolved_waits.empty()) {
-        return false;  // no new timeline signals were registered
+        return false;
     }
 
     // Process fully resolved batch
@@ -3390,7 +3517,8 @@ bool SyncValidator::ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, Si
                                               ready_batch.label_stack, error_obj);
 
     const auto submit_signals = vvl::make_span(ready_batch.signals.data(), ready_batch.signals.size());
-    return signals_update.RegisterSignals(ready_batch.batch, submit_signals);
+    signals_update.RegisterSignals(ready_batch.batch, submit_signals);
+    return true;
 }
 
 void SyncValidator::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
@@ -3604,6 +3732,9 @@ void syncval_state::ImageState::SetOpaqueBaseAddress(ValidationStateTracker &dev
         opaque_base = dev_data.AllocFakeMemory(fragment_encoder->TotalSize());
     }
     opaque_base_address_ = opaque_base;
+    if (IsSwapchainImage()) {
+        full_range_gen_.emplace(MakeImageRangeGen(full_range, false));
+    }
 }
 
 VkDeviceSize syncval_state::ImageState::GetResourceBaseAddress() const {
@@ -3624,6 +3755,13 @@ ImageRangeGen syncval_state::ImageState::MakeImageRangeGen(const VkImageSubresou
     return range_gen;
 }
 
+ImageRangeGen syncval_state::ImageState::MakeFullRangeGen() const {
+    if (full_range_gen_) {
+        return *full_range_gen_;
+    }
+    return MakeImageRangeGen(full_range, false);
+}
+
 ImageRangeGen syncval_state::ImageState::MakeImageRangeGen(const VkImageSubresourceRange &subresource_range,
                                                            const VkOffset3D &offset, const VkExtent3D &extent,
                                                            bool is_depth_sliced) const {
@@ -3660,3 +3798,30 @@ ImageRangeGen syncval_state::ImageViewState::MakeImageRangeGen(const VkOffset3D
     return GetImageState()->MakeImageRangeGen(subresource_range, offset, extent, IsDepthSliced());
 }
 
+syncval_state::ImageViewState::RenderAreaRangeGens syncval_state::ImageViewState::GetRenderAreaRangeGens(
+    const VkOffset3D &offset, const VkExtent3D &extent) const {
+    std::lock_guard<std::mutex> guard(render_area_range_gens_lock_);
+    if (render_area_range_gens_) {
+        const VkOffset3D &cached_offset = render_area_range_gens_->offset;
+        const VkExtent3D &cached_extent = render_area_range_gens_->extent;
+        if (cached_offset.x == offset.x && cached_offset.y == offset.y && cached_offset.z == offset.z &&
+            cached_extent.width == extent.width && cached_extent.height == extent.height && cached_extent.depth == extent.depth) {
+            return *render_area_range_gens_;
+        }
+    }
+
+    RenderAreaRangeGens gens{offset, extent, {}, {}, {}};
+    gens.render_area.emplace(MakeImageRangeGen(offset, extent));
+    const VkImageAspectFlags view_mask = normalized_subresource_range.aspectMask;
+    const VkImageAspectFlags depth = view_mask & VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (depth && (depth != view_mask)) {
+        gens.depth_only.emplace(MakeImageRangeGen(offset, extent, depth));
+    }
+    const VkImageAspectFlags stencil = view_mask & VK_IMAGE_ASPECT_STENCIL_BIT;
+    if (stencil && (stencil != view_mask)) {
+        gens.stencil_only.emplace(MakeImageRangeGen(offset, extent, stencil));
+    }
+    render_area_range_gens_ = gens;
+    return gens;
+}
+
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <shared_mutex>
 #include <vulkan/vulkan.h>
 
 #include "sync/sync_common.h"
@@ -25,13 +26,14 @@
 #include "sync/sync_commandbuffer.h"
 #include "sync/sync_stats.h"
 #include "sync/sync_submit.h"
+#include "utils/thread_pool.h"
 
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImage, syncval_state::ImageState, vvl::Image)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImageView, syncval_state::ImageViewState, vvl::ImageView)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkCommandBuffer, syncval_state::CommandBuffer, vvl::CommandBuffer)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkSwapchainKHR, syncval_state::Swapchain, vvl::Swapchain)
 
-class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
+class SyncValidator final : public ValidationStateTracker, public SyncStageAccess {
   public:
     using ImageState = syncval_state::ImageState;
     using ImageViewState = syncval_state::ImageViewState;
@@ -58,6 +60,12 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     mutable std::mutex queue_submit_mutex_;
 
+    // Shared by the batch logs of all queues, only used with syncval_batch_log_memory_limit
+    mutable BatchLogBudget batch_log_budget;
+
+    // Only created for syncval_parallel_submit_validation
+    std::unique_ptr<vvl::ThreadPool> submit_validation_pool;
+
     // Semaphore signal registry
     vvl::unordered_map<VkSemaphore, SignalInfo> binary_signals_;
     vvl::unordered_map<VkSemaphore, std::vector<SignalInfo>> timeline_signals_;
@@ -66,6 +74,15 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     vvl::unordered_map<VkFence, FenceHostSyncPoint> waitable_fences_;
     vvl::unordered_map<VkSemaphore, std::deque<TimelineHostSyncPoint>> host_waitable_semaphores_;
 
+    // Barrier schedules of the render passes, one for each queue type they were needed for. The schedules for the queue types
+    // of the device queues are built when the render pass is created.
+    mutable std::shared_mutex render_pass_barrier_schedules_lock_;
+    mutable vvl::unordered_map<VkRenderPass, std::vector<std::shared_ptr<const RenderPassBarrierSchedule>>>
+        render_pass_barrier_schedules_;
+    std::shared_ptr<const RenderPassBarrierSchedule> GetRenderPassBarrierSchedule(const vvl::RenderPass &rp_state,
+                                                                                 VkQueueFlags queue_flags) const;
+    void AddRenderPassBarrierSchedules(VkRenderPass render_pass);
+
     uint32_t debug_command_number = vvl::kU32Max;
     uint32_t debug_reset_count = 1;
     std::string debug_cmdbuf_pattern;
@@ -87,9 +104,12 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     bool PropagateTimelineSignals(SignalsUpdate &signals_update, const ErrorObject &error_obj) const;
 
-    // Return true if new timeline signals were generated by resolved batches
-    bool PropagateTimelineSignalsIteration(std::vector<UnresolvedQueue> &queues, SignalsUpdate &signals_update, bool &skip,
-                                           const ErrorObject &error_ob) const;
+    // Resolves the batches of the queue in order until one still has unresolved waits. The queues waiting for the signals of
+    // the resolved batches are added to ready_queues.
+    void ResolveQueueBatches(std::vector<UnresolvedQueue> &queues, size_t queue_index, SignalsUpdate &signals_update,
+                             TimelineWaiters &waiters, std::vector<size_t> &ready_queues, bool &skip,
+                             const ErrorObject &error_obj) const;
+    // Return true if all the waits are resolved and the batch was validated
     bool ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, SignalsUpdate &signals_update, BatchContextPtr &last_batch,
                                 bool &skip, const ErrorObject &error_obj) const;
 
@@ -144,6 +164,14 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                        const RecordObject &record_obj) override;
     void PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator,
                                        const RecordObject &record_obj) override;
+    void PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
+                                        const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
+                                        const RecordObject &record_obj) override;
+    void PostCallRecordCreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
+                                         const RecordObject &record_obj) override;
+    void PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks *pAllocator,
+                                        const RecordObject &record_obj) override;
 
     bool ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                  const VkSubpassBeginInfo *pSubpassBeginInfo, const ErrorObject &error_obj) const;
@@ -219,6 +247,7 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     void PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
                                           const RecordObject &record_obj) override;
+    void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) override;
 
     void PostCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                           VkSubpassContents contents, const RecordObject &record_obj) override;
@@ -27,6 +27,7 @@ using vvl::FindVUID;
 using vvl::Func;
 using vvl::Key;
 using vvl::Struct;
+using vvl::VuidTable;
 
 const vvl::unordered_map<VkPipelineStageFlags2KHR, std::string> &GetFeatureNameMap() {
     static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::string> feature_name_map{
@@ -47,10 +48,10 @@ const vvl::unordered_map<VkPipelineStageFlags2KHR, std::string> &GetFeatureNameM
 // commonvalidity/pipeline_stage_common.txt
 // commonvalidity/stage_mask_2_common.txt
 // commonvalidity/stage_mask_common.txt
-static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &GetStageMaskErrorsMap() {
-    static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> stage_mask_errors{
+static const vvl::unordered_map<VkPipelineStageFlags2KHR, VuidTable> &GetStageMaskErrorsMap() {
+    static const vvl::unordered_map<VkPipelineStageFlags2KHR, VuidTable> stage_mask_errors{
         {VK_PIPELINE_STAGE_2_CONDITIONAL_RENDERING_BIT_EXT,
-         std::vector<Entry>{
+         VuidTable{
              {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-03931"},
              {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-03931"},
              {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-04092"},
@@ -76,7 +77,7 @@ static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &G
              {Key(Struct::VkSubpassDependency2, Field::dstStageMask), "VUID-VkSubpassDependency2-dstStageMask-04092"},
          }},
         {VK_PIPELINE_STAGE_2_FRAGMENT_DENSITY_PROCESS_BIT_EXT,
-         std::vector<Entry>{
+         VuidTable{
              {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-03932"},
              {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-03932"},
              {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-04093"},
@@ -102,7 +103,7 @@ static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &G
              {Key(Struct::VkSubpassDependency2, Field::dstStageMask), "VUID-VkSubpassDependency2-dstStageMask-04093"},
          }},
         {VK_PIPELINE_STAGE_2_GEOMETRY_SHADER_BIT_KHR,
-         std::vector<Entry>{
+         VuidTable{
              {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-03929"},
              {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-03929"},
              {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-04090"},
@@ -128,7 +129,7 @@ static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &G
              {Key(Struct::VkSubpassDependency2, Field::dstStageMask), "VUID-VkSubpassDependency2-dstStageMask-04090"},
          }},
         {VK_PIPELINE_STAGE_2_MESH_SHADER_BIT_EXT,
-         std::vector<Entry>{
+         VuidTable{
              {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-03934"},
              {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-03934"},
              {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-04095"},
@@ -154,7 +155,7 @@ static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &G
              {Key(Struct::VkSubpassDependency2, Field::dstStageMask), "VUID-VkSubpassDependency2-dstStageMask-04095"},
          }},
         {VK_PIPELINE_STAGE_2_TASK_SHADER_BIT_EXT,
-         std::vector<Entry>{
+         VuidTable{
              {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-03935"},
              {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-03935"},
              {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-04096"},
@@ -180,7 +181,7 @@ static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &G
              {Key(Struct::VkSubpassDependency2, Field::dstStageMask), "VUID-VkSubpassDependency2-dstStageMask-04096"},
          }},
         {VK_PIPELINE_STAGE_2_TESSELLATION_CONTROL_SHADER_BIT_KHR,
-         std::vector<Entry>{
+         VuidTable{
              {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-03930"},
              {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-03930"},
              {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-04091"},
@@ -206,7 +207,7 @@ static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &G
              {Key(Struct::VkSubpassDependency2, Field::dstStageMask), "VUID-VkSubpassDependency2-dstStageMask-04091"},
          }},
         {VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT_KHR,
-         std::vector<Entry>{
+         VuidTable{
              {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-03930"},
              {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-03930"},
              {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-04091"},
@@ -232,7 +233,7 @@ static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &G
              {Key(Struct::VkSubpassDependency2, Field::dstStageMask), "VUID-VkSubpassDependency2-dstStageMask-04091"},
          }},
         {VK_PIPELINE_STAGE_2_TRANSFORM_FEEDBACK_BIT_EXT,
-         std::vector<Entry>{
+         VuidTable{
              {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-03933"},
              {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-03933"},
              {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-04094"},
@@ -258,7 +259,7 @@ static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &G
              {Key(Struct::VkSubpassDependency2, Field::dstStageMask), "VUID-VkSubpassDependency2-dstStageMask-04094"},
          }},
         {VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR,
-         std::vector<Entry>{
+         VuidTable{
              {Key(Struct::VkSubmitInfo, Field::pWaitDstStageMask), "VUID-VkSubmitInfo-pWaitDstStageMask-07949"},
              {Key(Func::vkCmdSetEvent, Field::stageMask), "VUID-vkCmdSetEvent-stageMask-07949"},
              {Key(Func::vkCmdResetEvent, Field::stageMask), "VUID-vkCmdResetEvent-stageMask-07949"},
@@ -287,7 +288,7 @@ static const vvl::unordered_map<VkPipelineStageFlags2KHR, std::vector<Entry>> &G
 }
 
 const auto &GetStageMaskErrorsNone() {
-    static const std::array<Entry, 12> kStageMaskErrorsNone{{
+    static const VuidTable kStageMaskErrorsNone{{
         {Key(Func::vkCmdPipelineBarrier, Field::srcStageMask), "VUID-vkCmdPipelineBarrier-srcStageMask-03937"},
         {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-03937"},
         {Key(Func::vkCmdResetEvent, Field::stageMask), "VUID-vkCmdResetEvent-stageMask-03937"},
@@ -305,7 +306,7 @@ const auto &GetStageMaskErrorsNone() {
 }
 
 const auto &GetStageMaskErrorsShadingRate() {
-    static const std::array<Entry, 22> kStageMaskErrorsShadingRate{{
+    static const VuidTable kStageMaskErrorsShadingRate{{
         {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-07316"},
         {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-07316"},
         {Key(Func::vkCmdPipelineBarrier, Field::dstStageMask), "VUID-vkCmdPipelineBarrier-dstStageMask-07318"},
@@ -333,7 +334,7 @@ const auto &GetStageMaskErrorsShadingRate() {
 }
 
 const auto &GetStageMaskErrorsSubpassShader() {
-    static const std::array<Entry, 10> kStageMaskErrorsSubpassShader{{
+    static const VuidTable kStageMaskErrorsSubpassShader{{
         {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-04957"},
         {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-04957"},
         {Key(Func::vkCmdResetEvent2, Field::stageMask), "VUID-vkCmdResetEvent2-stageMask-04957"},
@@ -349,7 +350,7 @@ const auto &GetStageMaskErrorsSubpassShader() {
 }
 
 const auto &GetStageMaskErrorsInvocationMask() {
-    static const std::array<Entry, 10> kStageMaskErrorsInvocationMask{{
+    static const VuidTable kStageMaskErrorsInvocationMask{{
         {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "VUID-VkBufferMemoryBarrier2-dstStageMask-04995"},
         {Key(Struct::VkBufferMemoryBarrier2, Field::srcStageMask), "VUID-VkBufferMemoryBarrier2-srcStageMask-04995"},
         {Key(Func::vkCmdResetEvent2, Field::stageMask), "VUID-vkCmdResetEvent2-stageMask-04995"},
@@ -387,8 +388,8 @@ const std::string &GetBadFeatureVUID(const Location &loc, VkPipelineStageFlags2
 }
 
 // commonvalidity/access_mask_2_common.txt
-static const vvl::unordered_map<VkAccessFlags2KHR, std::array<Entry, 6>> &GetAccessMask2CommonMap() {
-    using ValueType = std::array<Entry, 6>;
+static const vvl::unordered_map<VkAccessFlags2KHR, VuidTable> &GetAccessMask2CommonMap() {
+    using ValueType = VuidTable;
     static const vvl::unordered_map<VkAccessFlags2KHR, ValueType> access_mask2_common{
         {VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT_KHR,
          ValueType{{
@@ -763,8 +764,8 @@ static const vvl::unordered_map<VkAccessFlags2KHR, std::array<Entry, 6>> &GetAcc
     return access_mask2_common;
 }
 // commonvalidity/fine_sync_commands_common.txt
-const std::vector<Entry> &GetFineSyncCommon() {
-    static const std::vector<Entry> kFineSyncCommon = {
+const VuidTable &GetFineSyncCommon() {
+    static const VuidTable kFineSyncCommon = {
         {Key(Func::vkCmdPipelineBarrier, Struct::VkMemoryBarrier, Field::srcAccessMask),
          "VUID-vkCmdPipelineBarrier-srcAccessMask-02815"},
         {Key(Func::vkCmdPipelineBarrier, Struct::VkMemoryBarrier, Field::dstAccessMask),
@@ -863,8 +864,8 @@ const std::string &GetAccessMaskRayQueryVUIDSelector(const Location &loc, const
     return unhandled;
 }
 
-const std::vector<Entry> &GetQueueCapErrors() {
-    static const std::vector<Entry> kQueueCapErrors{
+const VuidTable &GetQueueCapErrors() {
+    static const VuidTable kQueueCapErrors{
         {Key(Struct::VkSubmitInfo, Field::pWaitDstStageMask), "VUID-vkQueueSubmit-pWaitDstStageMask-00066"},
         {Key(Struct::VkSubpassDependency, Field::srcStageMask), "VUID-vkCmdBeginRenderPass-srcStageMask-06451"},
         {Key(Struct::VkSubpassDependency, Field::dstStageMask), "VUID-vkCmdBeginRenderPass-dstStageMask-06452"},
@@ -911,8 +912,8 @@ const std::string &GetStageQueueCapVUID(const Location &loc, VkPipelineStageFlag
     return result;
 }
 
-static const vvl::unordered_map<QueueError, std::vector<Entry>> &GetBarrierQueueErrors() {
-    static const vvl::unordered_map<QueueError, std::vector<Entry>> kBarrierQueueErrors{
+static const vvl::unordered_map<QueueError, VuidTable> &GetBarrierQueueErrors() {
+    static const vvl::unordered_map<QueueError, VuidTable> kBarrierQueueErrors{
         {QueueError::kSrcNoExternalExt,
          {
              {Key(Struct::VkBufferMemoryBarrier2), "VUID-VkBufferMemoryBarrier2-None-09097"},
@@ -1006,9 +1007,9 @@ const std::string &GetBarrierQueueVUID(const Location &loc, QueueError error) {
     return result;
 }
 
-const vvl::unordered_map<VkImageLayout, std::array<Entry, 2>> &GetImageLayoutErrorsMap() {
-    using ValueType = std::array<Entry, 2>;
-    static const vvl::unordered_map<VkImageLayout, std::array<Entry, 2>> kImageLayoutErrors{
+const vvl::unordered_map<VkImageLayout, VuidTable> &GetImageLayoutErrorsMap() {
+    using ValueType = VuidTable;
+    static const vvl::unordered_map<VkImageLayout, VuidTable> kImageLayoutErrors{
         {VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
          ValueType{{
              {Key(Struct::VkImageMemoryBarrier), "VUID-VkImageMemoryBarrier-oldLayout-01208"},
@@ -1108,8 +1109,8 @@ const std::string &GetBadImageLayoutVUID(const Location &loc, VkImageLayout layo
     return result;
 }
 
-static const vvl::unordered_map<BufferError, std::array<Entry, 2>> &GetBufferErrorsMap() {
-    static const vvl::unordered_map<BufferError, std::array<Entry, 2>> kBufferErrors{
+static const vvl::unordered_map<BufferError, VuidTable> &GetBufferErrorsMap() {
+    static const vvl::unordered_map<BufferError, VuidTable> kBufferErrors{
         {BufferError::kNoMemory,
          {{
              {Key(Struct::VkBufferMemoryBarrier2), "VUID-VkBufferMemoryBarrier2-buffer-01931"},
@@ -1149,8 +1150,8 @@ const std::string &GetBufferBarrierVUID(const Location &loc, BufferError error)
     return result;
 }
 
-const vvl::unordered_map<ImageError, std::vector<Entry>> &GetImageErrorsMap() {
-    static const vvl::unordered_map<ImageError, std::vector<Entry>> kImageErrors{
+const vvl::unordered_map<ImageError, VuidTable> &GetImageErrorsMap() {
+    static const vvl::unordered_map<ImageError, VuidTable> kImageErrors{
         {ImageError::kNoMemory,
          {
              {Key(Struct::VkImageMemoryBarrier), "VUID-VkImageMemoryBarrier-image-01932"},
@@ -1265,8 +1266,8 @@ const std::string &GetImageBarrierVUID(const Location &loc, ImageError error) {
     return result;
 }
 
-static const vvl::unordered_map<SubmitError, std::vector<Entry>> &GetSubmitErrorsMap() {
-    static const vvl::unordered_map<SubmitError, std::vector<Entry>> kSubmitErrors{
+static const vvl::unordered_map<SubmitError, VuidTable> &GetSubmitErrorsMap() {
+    static const vvl::unordered_map<SubmitError, VuidTable> kSubmitErrors{
         {SubmitError::kTimelineSemSmallValue,
          {
              {Key(Struct::VkSemaphoreSignalInfo), "VUID-VkSemaphoreSignalInfo-value-03258"},
@@ -1373,7 +1374,7 @@ const std::string &GetQueueSubmitVUID(const Location &loc, SubmitError error) {
 }
 
 const std::string &GetShaderTileImageVUID(const Location &loc, ShaderTileImageError error) {
-    static const vvl::unordered_map<ShaderTileImageError, std::vector<Entry>> kShaderTileImageErrors{
+    static const vvl::unordered_map<ShaderTileImageError, VuidTable> kShaderTileImageErrors{
         {ShaderTileImageError::kShaderTileImageFeatureError,
          {
              {Key(Func::vkCmdPipelineBarrier), "VUID-vkCmdPipelineBarrier-None-09553"},
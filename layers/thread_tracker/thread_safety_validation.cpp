@@ -23,6 +23,117 @@ ReadLockGuard ThreadSafety::ReadLock() const { return ReadLockGuard(validation_o
 
 WriteLockGuard ThreadSafety::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
 
+vvl::HandleSlotArray<ObjectUseData>& ObjectUseSlots() {
+    static vvl::HandleSlotArray<ObjectUseData> use_slots;
+    return use_slots;
+}
+
+namespace {
+// ObjectUseData::owner of a command pool that is used by several threads, it can only be claimed again after a reset
+constexpr uint64_t kSharedCommandPool = std::numeric_limits<uint64_t>::max();
+
+// Stored in ObjectUseData::owner of the command pools claimed by this thread, never 0 or kSharedCommandPool
+uint64_t ThreadOwnerToken() {
+    static std::atomic<uint64_t> next_token{1};
+    thread_local const uint64_t token = next_token.fetch_add(1);
+    return token;
+}
+
+// Last command buffer recorded by this thread from a command pool it owns
+struct OwnedCommandBuffer {
+    const ThreadSafety* thread_safety = nullptr;
+    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    std::shared_ptr<ObjectUseData> pool_use_data;
+    // StartWriteObject() calls that skipped the counters, their FinishWriteObject() must skip them too
+    uint32_t skipped_writes = 0;
+};
+thread_local OwnedCommandBuffer owned_command_buffer;
+}  // namespace
+
+std::shared_ptr<ObjectUseData> ThreadSafety::FindCommandPoolUseData(VkCommandPool pool) {
+#ifdef DISTINCT_NONDISPATCHABLE_HANDLES
+    return c_VkCommandPool.FindUseData(pool);
+#else
+    return c_uint64_t.FindUseData(pool);
+#endif
+}
+
+bool ThreadSafety::StartOwnedCommandBufferWrite(VkCommandBuffer command_buffer) {
+    OwnedCommandBuffer& owned = owned_command_buffer;
+    const uint64_t token = ThreadOwnerToken();
+    if (owned.thread_safety == this && owned.command_buffer == command_buffer &&
+        owned.pool_use_data->owner.load(std::memory_order_relaxed) == token) {
+        ++owned.skipped_writes;
+        return true;
+    }
+
+    auto iter = command_pool_map.find(command_buffer);
+    if (iter == command_pool_map.end()) {
+        return false;
+    }
+    std::shared_ptr<ObjectUseData> pool_use_data = FindCommandPoolUseData(iter->second);
+    if (!pool_use_data) {
+        return false;
+    }
+    uint64_t owner = pool_use_data->owner.load(std::memory_order_relaxed);
+    if (owner == 0) {
+        // Only claim a pool no other thread is using through the counters
+        const ObjectUseData::WriteReadCount count = pool_use_data->GetCount();
+        if (count.GetReadCount() == 0 && count.GetWriteCount() == 0 && pool_use_data->owner.compare_exchange_strong(owner, token)) {
+            owner = token;
+        }
+    }
+    if (owner == token) {
+        assert(owned.skipped_writes == 0);
+        owned.thread_safety = this;
+        owned.command_buffer = command_buffer;
+        owned.pool_use_data = std::move(pool_use_data);
+        owned.skipped_writes = 1;
+        return true;
+    }
+    // Another thread owns the pool, from now on both threads use the counters
+    while (owner != 0 && owner != kSharedCommandPool &&
+           !pool_use_data->owner.compare_exchange_weak(owner, kSharedCommandPool)) {
+    }
+    return false;
+}
+
+bool ThreadSafety::FinishOwnedCommandBufferWrite(VkCommandBuffer command_buffer) {
+    OwnedCommandBuffer& owned = owned_command_buffer;
+    if (owned.skipped_writes == 0 || owned.thread_safety != this || owned.command_buffer != command_buffer) {
+        return false;
+    }
+    --owned.skipped_writes;
+    return true;
+}
+
+void ThreadSafety::ShareCommandPool(VkCommandPool pool) {
+    std::shared_ptr<ObjectUseData> pool_use_data = FindCommandPoolUseData(pool);
+    if (!pool_use_data) {
+        return;
+    }
+    const uint64_t token = ThreadOwnerToken();
+    uint64_t owner = pool_use_data->owner.load(std::memory_order_relaxed);
+    if (owner == token) {
+        // The owner itself, it only has to look up the pool again for its next write
+        OwnedCommandBuffer& owned = owned_command_buffer;
+        if (owned.pool_use_data == pool_use_data && owned.skipped_writes == 0) {
+            owned = OwnedCommandBuffer();
+        }
+        return;
+    }
+    while (owner != 0 && owner != kSharedCommandPool &&
+           !pool_use_data->owner.compare_exchange_weak(owner, kSharedCommandPool)) {
+    }
+}
+
+void ThreadSafety::ReleaseCommandPool(VkCommandPool pool) {
+    ShareCommandPool(pool);
+    if (std::shared_ptr<ObjectUseData> pool_use_data = FindCommandPoolUseData(pool)) {
+        pool_use_data->owner.store(0);
+    }
+}
+
 void ThreadSafety::PreCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
                                                        VkCommandBuffer* pCommandBuffers, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
@@ -36,7 +147,7 @@ void ThreadSafety::PostCallRecordAllocateCommandBuffers(VkDevice device, const V
 
     // Record mapping from command buffer to command pool
     if (pCommandBuffers) {
-        auto lock = WriteLockGuard(thread_safety_lock);
+        auto lock = std::unique_lock(thread_safety_lock);
         auto& pool_command_buffers = pool_command_buffers_map[pAllocateInfo->commandPool];
         for (uint32_t index = 0; index < pAllocateInfo->commandBufferCount; index++) {
             command_pool_map.insert_or_assign(pCommandBuffers[index], pAllocateInfo->commandPool);
@@ -89,7 +200,7 @@ void ThreadSafety::PostCallRecordAllocateDescriptorSets(VkDevice device, const V
     FinishWriteObject(pAllocateInfo->descriptorPool, record_obj.location);
     // Host access to pAllocateInfo::descriptorPool must be externally synchronized
     if (VK_SUCCESS == record_obj.result) {
-        auto lock = WriteLockGuard(thread_safety_lock);
+        auto lock = std::unique_lock(thread_safety_lock);
         auto& pool_descriptor_sets = pool_descriptor_sets_map[pAllocateInfo->descriptorPool];
         for (uint32_t index0 = 0; index0 < pAllocateInfo->descriptorSetCount; index0++) {
             CreateObject(pDescriptorSets[index0]);
@@ -131,7 +242,7 @@ void ThreadSafety::PostCallRecordFreeDescriptorSets(VkDevice device, VkDescripto
     // Host access to each member of pDescriptorSets must be externally synchronized
     // Host access to pAllocateInfo::descriptorPool must be externally synchronized
     if (VK_SUCCESS == record_obj.result) {
-        auto lock = WriteLockGuard(thread_safety_lock);
+        auto lock = std::unique_lock(thread_safety_lock);
         auto& pool_descriptor_sets = pool_descriptor_sets_map[descriptorPool];
         for (uint32_t index0 = 0; index0 < descriptorSetCount; index0++) {
             auto descriptor_set = pDescriptorSets[index0];
@@ -147,7 +258,7 @@ void ThreadSafety::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDescrip
     StartReadObjectParentInstance(device, record_obj.location);
     StartWriteObject(descriptorPool, record_obj.location);
     // Host access to descriptorPool must be externally synchronized
-    auto lock = ReadLockGuard(thread_safety_lock);
+    auto lock = std::shared_lock(thread_safety_lock);
     auto iterator = pool_descriptor_sets_map.find(descriptorPool);
     // Possible to have no descriptor sets allocated from pool
     if (iterator != pool_descriptor_sets_map.end()) {
@@ -164,7 +275,7 @@ void ThreadSafety::PostCallRecordDestroyDescriptorPool(VkDevice device, VkDescri
     DestroyObject(descriptorPool);
     // Host access to descriptorPool must be externally synchronized
     {
-        auto lock = WriteLockGuard(thread_safety_lock);
+        auto lock = std::unique_lock(thread_safety_lock);
         // remove references to implicitly freed descriptor sets
         for (auto descriptor_set : pool_descriptor_sets_map[descriptorPool]) {
             FinishWriteObject(descriptor_set, record_obj.location);
@@ -182,7 +293,7 @@ void ThreadSafety::PreCallRecordResetDescriptorPool(VkDevice device, VkDescripto
     StartWriteObject(descriptorPool, record_obj.location);
     // Host access to descriptorPool must be externally synchronized
     // any sname:VkDescriptorSet objects allocated from pname:descriptorPool must be externally synchronized between host accesses
-    auto lock = ReadLockGuard(thread_safety_lock);
+    auto lock = std::shared_lock(thread_safety_lock);
     auto iterator = pool_descriptor_sets_map.find(descriptorPool);
     // Possible to have no descriptor sets allocated from pool
     if (iterator != pool_descriptor_sets_map.end()) {
@@ -200,7 +311,7 @@ void ThreadSafety::PostCallRecordResetDescriptorPool(VkDevice device, VkDescript
     // any sname:VkDescriptorSet objects allocated from pname:descriptorPool must be externally synchronized between host accesses
     if (VK_SUCCESS == record_obj.result) {
         // remove references to implicitly freed descriptor sets
-        auto lock = WriteLockGuard(thread_safety_lock);
+        auto lock = std::unique_lock(thread_safety_lock);
         for (auto descriptor_set : pool_descriptor_sets_map[descriptorPool]) {
             FinishWriteObject(descriptor_set, record_obj.location);
             DestroyObject(descriptor_set);
@@ -346,12 +457,15 @@ void ThreadSafety::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPoo
     const bool lockCommandPool = false;  // pool is already directly locked
     StartReadObjectParentInstance(device, record_obj.location);
     StartWriteObject(commandPool, record_obj.location);
+    if (global_settings.thread_safety_command_buffer_ownership) {
+        ShareCommandPool(commandPool);
+    }
     if (pCommandBuffers) {
         // Even though we're immediately "finishing" below, we still are testing for concurrency with any call in process
         // so this isn't a no-op
         // The driver may immediately reuse command buffers in another thread.
         // These updates need to be done before calling down to the driver.
-        auto lock = WriteLockGuard(thread_safety_lock);
+        auto lock = std::unique_lock(thread_safety_lock);
         auto& pool_command_buffers = pool_command_buffers_map[commandPool];
         for (uint32_t index = 0; index < commandBufferCount; index++) {
             StartWriteObject(pCommandBuffers[index], record_obj.location, lockCommandPool);
@@ -392,6 +506,9 @@ void ThreadSafety::PreCallRecordResetCommandPool(VkDevice device, VkCommandPool
     // Check for any uses of non-externally sync'd command buffers (for example from vkCmdExecuteCommands)
     c_VkCommandPoolContents.StartWrite(commandPool, record_obj.location);
     // Host access to commandPool must be externally synchronized
+    if (global_settings.thread_safety_command_buffer_ownership) {
+        ReleaseCommandPool(commandPool);
+    }
 }
 
 void ThreadSafety::PostCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags,
@@ -409,8 +526,11 @@ void ThreadSafety::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPoo
     // Check for any uses of non-externally sync'd command buffers (for example from vkCmdExecuteCommands)
     c_VkCommandPoolContents.StartWrite(commandPool, record_obj.location);
     // Host access to commandPool must be externally synchronized
+    if (global_settings.thread_safety_command_buffer_ownership) {
+        ShareCommandPool(commandPool);
+    }
 
-    auto lock = WriteLockGuard(thread_safety_lock);
+    auto lock = std::unique_lock(thread_safety_lock);
     // The driver may immediately reuse command buffers in another thread.
     // These updates need to be done before calling down to the driver.
     // remove references to implicitly freed command pools
@@ -443,7 +563,7 @@ void ThreadSafety::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapch
     FinishReadObjectParentInstance(device, record_obj.location);
     FinishReadObject(swapchain, record_obj.location);
     if (pSwapchainImages != nullptr) {
-        auto lock = WriteLockGuard(thread_safety_lock);
+        auto lock = std::unique_lock(thread_safety_lock);
         auto& wrapped_swapchain_image_handles = swapchain_wrapped_image_handle_map[swapchain];
         for (uint32_t i = static_cast<uint32_t>(wrapped_swapchain_image_handles.size()); i < *pSwapchainImageCount; i++) {
             CreateObject(pSwapchainImages[i]);
@@ -457,7 +577,7 @@ void ThreadSafety::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchain
     StartReadObjectParentInstance(device, record_obj.location);
     StartWriteObject(swapchain, record_obj.location);
     // Host access to swapchain must be externally synchronized
-    auto lock = ReadLockGuard(thread_safety_lock);
+    auto lock = std::shared_lock(thread_safety_lock);
     for (auto& image_handle : swapchain_wrapped_image_handle_map[swapchain]) {
         StartWriteObject(image_handle, record_obj.location);
     }
@@ -469,7 +589,7 @@ void ThreadSafety::PostCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchai
     FinishWriteObject(swapchain, record_obj.location);
     DestroyObject(swapchain);
     // Host access to swapchain must be externally synchronized
-    auto lock = WriteLockGuard(thread_safety_lock);
+    auto lock = std::unique_lock(thread_safety_lock);
     for (auto& image_handle : swapchain_wrapped_image_handle_map[swapchain]) {
         FinishWriteObject(image_handle, record_obj.location);
         DestroyObject(image_handle);
@@ -488,7 +608,7 @@ void ThreadSafety::PostCallRecordDestroyDevice(VkDevice device, const VkAllocati
     FinishWriteObjectParentInstance(device, record_obj.location);
     DestroyObjectParentInstance(device);
     // Host access to device must be externally synchronized
-    auto lock = WriteLockGuard(thread_safety_lock);
+    auto lock = std::unique_lock(thread_safety_lock);
     for (auto& queue : device_queues_map[device]) {
         DestroyObject(queue);
     }
@@ -504,7 +624,7 @@ void ThreadSafety::PostCallRecordGetDeviceQueue(VkDevice device, uint32_t queueF
                                                 const RecordObject& record_obj) {
     FinishReadObjectParentInstance(device, record_obj.location);
     CreateObject(*pQueue);
-    auto lock = WriteLockGuard(thread_safety_lock);
+    auto lock = std::unique_lock(thread_safety_lock);
     device_queues_map[device].insert(*pQueue);
 }
 
@@ -517,7 +637,7 @@ void ThreadSafety::PostCallRecordGetDeviceQueue2(VkDevice device, const VkDevice
                                                  const RecordObject& record_obj) {
     FinishReadObjectParentInstance(device, record_obj.location);
     CreateObject(*pQueue);
-    auto lock = WriteLockGuard(thread_safety_lock);
+    auto lock = std::unique_lock(thread_safety_lock);
     device_queues_map[device].insert(*pQueue);
 }
 
@@ -671,7 +791,7 @@ void ThreadSafety::PostCallRecordRegisterDisplayEventEXT(VkDevice device, VkDisp
 
 void ThreadSafety::PreCallRecordDeviceWaitIdle(VkDevice device, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
-    auto lock = ReadLockGuard(thread_safety_lock);
+    auto lock = std::shared_lock(thread_safety_lock);
     const auto& queue_set = device_queues_map[device];
     for (const auto& queue : queue_set) {
         StartWriteObject(queue, record_obj.location);
@@ -680,7 +800,7 @@ void ThreadSafety::PreCallRecordDeviceWaitIdle(VkDevice device, const RecordObje
 
 void ThreadSafety::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject& record_obj) {
     FinishReadObjectParentInstance(device, record_obj.location);
-    auto lock = ReadLockGuard(thread_safety_lock);
+    auto lock = std::shared_lock(thread_safety_lock);
     const auto& queue_set = device_queues_map[device];
     for (const auto& queue : queue_set) {
         FinishWriteObject(queue, record_obj.location);
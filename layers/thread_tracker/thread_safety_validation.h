@@ -23,7 +23,10 @@
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include "containers/handle_table.h"
+#include "generated/layer_chassis_dispatch.h"  // IsWrappedHandle()
 #include "utils/vk_layer_utils.h"
+#include "utils/lock_profiling.h"
 
 VK_DEFINE_NON_DISPATCHABLE_HANDLE(DISTINCT_NONDISPATCHABLE_PHONY_HANDLE)
 // The following line must match the vulkan_core.h condition guarding VK_DEFINE_NON_DISPATCHABLE_HANDLE
@@ -88,6 +91,20 @@ class alignas(kObjectUserDataAlignment) ObjectUseData {
         }
     }
 
+    // Only used for the use data embedded in ObjectUseSlots(), the wrapped handle currently using this slot (0 if none)
+    std::atomic<uint64_t> handle{0};
+
+    // Only used for command pools, see ThreadSafety::StartOwnedCommandBufferWrite()
+    std::atomic<uint64_t> owner{0};
+
+    // Called when a new handle takes the slot, a handle destroyed while in use must not leave its counts behind
+    void Reset(uint64_t new_handle) {
+        writer_reader_count.store(0);
+        thread.store(std::thread::id());
+        owner.store(0);
+        handle.store(new_handle, std::memory_order_release);
+    }
+
     std::atomic<std::thread::id> thread{};
 
   private:
@@ -95,22 +112,63 @@ class alignas(kObjectUserDataAlignment) ObjectUseData {
     std::atomic<int64_t> writer_reader_count{};
 };
 
+// With handle wrapping on, a non-dispatchable handle is a unique_id_mapping id, and its use data is kept at the slot
+// index of that id. Shared by every ThreadSafety object since wrapped ids are unique in the process.
+vvl::HandleSlotArray<ObjectUseData> &ObjectUseSlots();
+
 template <typename T>
 class counter {
   public:
     VulkanObjectType object_type;
     ValidationObject *object_data;
+    // Set for the counters of non-dispatchable handles, the objects whose handle is wrapped use it instead of object_table
+    vvl::HandleSlotArray<ObjectUseData> *use_slots = nullptr;
 
     vvl::concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
 
-    void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
+    void CreateObject(T object) {
+        if (use_slots && IsWrappedHandle(CastToUint64(object)) && vvl::HandleTable::InTable(CastToUint64(object))) {
+            ObjectUseData &use_data = use_slots->Get(CastToUint64(object));
+            // Objects like VkDisplayKHR are "created" each time they are queried
+            if (use_data.handle.load(std::memory_order_acquire) != CastToUint64(object)) {
+                use_data.Reset(CastToUint64(object));
+            }
+            return;
+        }
+        object_table.insert(object, std::make_shared<ObjectUseData>());
+    }
 
     void DestroyObject(T object) {
         if (object) {
+            if (ObjectUseData *use_data = FindEmbeddedObject(object)) {
+                use_data->handle.store(0, std::memory_order_release);
+                return;
+            }
             object_table.erase(object);
         }
     }
 
+    // Returns nullptr if object does not use an embedded slot
+    ObjectUseData *FindEmbeddedObject(T object) const {
+        if (!use_slots) {
+            return nullptr;
+        }
+        ObjectUseData *use_data = use_slots->Find(CastToUint64(object));
+        if (use_data && use_data->handle.load(std::memory_order_acquire) == CastToUint64(object)) {
+            return use_data;
+        }
+        return nullptr;
+    }
+
+    // Like FindObject() without the error, the use data of an embedded slot is returned through a non owning shared_ptr
+    std::shared_ptr<ObjectUseData> FindUseData(T object) {
+        if (ObjectUseData *use_data = FindEmbeddedObject(object)) {
+            return std::shared_ptr<ObjectUseData>(std::shared_ptr<ObjectUseData>(), use_data);
+        }
+        auto iter = object_table.find(object);
+        return (iter != object_table.end()) ? iter->second : nullptr;
+    }
+
     std::shared_ptr<ObjectUseData> FindObject(T object, const Location& loc) {
         assert(object_table.contains(object));
         auto iter = object_table.find(object);
@@ -129,44 +187,25 @@ class counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        if (ObjectUseData *use_data = FindEmbeddedObject(object)) {
+            StartWrite(*use_data, object, loc);
+            return;
+        }
         auto use_data = FindObject(object, loc);
         if (!use_data) {
             return;
         }
-
-        const std::thread::id tid = std::this_thread::get_id();
-        const ObjectUseData::WriteReadCount prev_count = use_data->AddWriter();
-        const bool prev_read = prev_count.GetReadCount() != 0;
-        const bool prev_write = prev_count.GetWriteCount() != 0;
-
-        if (!prev_read && !prev_write) {
-            // There is no current use of the object. Record writer thread.
-            use_data->thread = tid;
-        } else if (!prev_read) {
-            assert(prev_write);
-            // There are no other readers but there is another writer. Two writers just collided.
-            if (use_data->thread != tid) {
-                HandleErrorOnWrite(use_data, object, loc);
-            } else {
-                // This is either safe multiple use in one call, or recursive use.
-                // There is no way to make recursion safe. Just forge ahead.
-            }
-        } else {
-            assert(prev_read);
-            // There are other readers. This writer collided with them.
-            if (use_data->thread != tid) {
-                HandleErrorOnWrite(use_data, object, loc);
-            } else {
-                // This is either safe multiple use in one call, or recursive use.
-                // There is no way to make recursion safe. Just forge ahead.
-            }
-        }
+        StartWrite(*use_data, object, loc);
     }
 
     void FinishWrite(T object, const Location& loc) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        if (ObjectUseData *use_data = FindEmbeddedObject(object)) {
+            use_data->RemoveWriter();
+            return;
+        }
         auto use_data = FindObject(object, loc);
         if (!use_data) {
             return;
@@ -178,30 +217,25 @@ class counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        if (ObjectUseData *use_data = FindEmbeddedObject(object)) {
+            StartRead(*use_data, object, loc);
+            return;
+        }
         auto use_data = FindObject(object, loc);
         if (!use_data) {
             return;
         }
-
-        const std::thread::id tid = std::this_thread::get_id();
-        const ObjectUseData::WriteReadCount prev_count = use_data->AddReader();
-        const bool prev_read = prev_count.GetReadCount() != 0;
-        const bool prev_write = prev_count.GetWriteCount() != 0;
-
-        if (!prev_read && !prev_write) {
-            // There is no current use of the object. Record reader thread.
-            use_data->thread = tid;
-        } else if (prev_write && use_data->thread != tid) {
-            HandleErrorOnRead(use_data, object, loc);
-        } else {
-            // There are other readers of the object.
-        }
+        StartRead(*use_data, object, loc);
     }
 
     void FinishRead(T object, const Location& loc) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        if (ObjectUseData *use_data = FindEmbeddedObject(object)) {
+            use_data->RemoveReader();
+            return;
+        }
         auto use_data = FindObject(object, loc);
         if (!use_data) {
             return;
@@ -209,12 +243,60 @@ class counter {
         use_data->RemoveReader();
     }
 
-    counter(VulkanObjectType type = kVulkanObjectTypeUnknown, ValidationObject *val_obj = nullptr) {
+    counter(VulkanObjectType type = kVulkanObjectTypeUnknown, ValidationObject *val_obj = nullptr,
+            vvl::HandleSlotArray<ObjectUseData> *slots = nullptr) {
         object_type = type;
         object_data = val_obj;
+        use_slots = slots;
     }
 
   private:
+    void StartWrite(ObjectUseData &use_data, T object, const Location& loc) {
+        const std::thread::id tid = std::this_thread::get_id();
+        const ObjectUseData::WriteReadCount prev_count = use_data.AddWriter();
+        const bool prev_read = prev_count.GetReadCount() != 0;
+        const bool prev_write = prev_count.GetWriteCount() != 0;
+
+        if (!prev_read && !prev_write) {
+            // There is no current use of the object. Record writer thread.
+            use_data.thread = tid;
+        } else if (!prev_read) {
+            assert(prev_write);
+            // There are no other readers but there is another writer. Two writers just collided.
+            if (use_data.thread != tid) {
+                HandleErrorOnWrite(use_data, object, loc);
+            } else {
+                // This is either safe multiple use in one call, or recursive use.
+                // There is no way to make recursion safe. Just forge ahead.
+            }
+        } else {
+            assert(prev_read);
+            // There are other readers. This writer collided with them.
+            if (use_data.thread != tid) {
+                HandleErrorOnWrite(use_data, object, loc);
+            } else {
+                // This is either safe multiple use in one call, or recursive use.
+                // There is no way to make recursion safe. Just forge ahead.
+            }
+        }
+    }
+
+    void StartRead(ObjectUseData &use_data, T object, const Location& loc) {
+        const std::thread::id tid = std::this_thread::get_id();
+        const ObjectUseData::WriteReadCount prev_count = use_data.AddReader();
+        const bool prev_read = prev_count.GetReadCount() != 0;
+        const bool prev_write = prev_count.GetWriteCount() != 0;
+
+        if (!prev_read && !prev_write) {
+            // There is no current use of the object. Record reader thread.
+            use_data.thread = tid;
+        } else if (prev_write && use_data.thread != tid) {
+            HandleErrorOnRead(use_data, object, loc);
+        } else {
+            // There are other readers of the object.
+        }
+    }
+
     std::string GetErrorMessage(std::thread::id tid, std::thread::id other_tid) const {
         std::stringstream err_str;
         err_str << "THREADING ERROR : object of type " << string_VulkanObjectType(object_type)
@@ -222,39 +304,39 @@ class counter {
         return err_str.str();
     }
 
-    void HandleErrorOnWrite(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnWrite(ObjectUseData &use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
-        const std::string error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
+        const std::string error_message = GetErrorMessage(tid, use_data.thread.load(std::memory_order_relaxed));
         const bool skip =
             object_data->LogError("UNASSIGNED-Threading-MultipleThreads-Write", object, loc, "%s", error_message.c_str());
         if (skip) {
             // Wait for thread-safe access to object instead of skipping call.
-            use_data->WaitForObjectIdle(true);
+            use_data.WaitForObjectIdle(true);
             // There is now no current use of the object. Record writer thread.
-            use_data->thread = tid;
+            use_data.thread = tid;
         } else {
             // There is now no current use of the object. Record writer thread.
-            use_data->thread = tid;
+            use_data.thread = tid;
         }
     }
 
-    void HandleErrorOnRead(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnRead(ObjectUseData &use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         // There is a writer of the object.
-        const auto error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
+        const auto error_message = GetErrorMessage(tid, use_data.thread.load(std::memory_order_relaxed));
         const bool skip =
             object_data->LogError("UNASSIGNED-Threading-MultipleThreads-Read", object, loc, "%s", error_message.c_str());
         if (skip) {
             // Wait for thread-safe access to object instead of skipping call.
-            use_data->WaitForObjectIdle(false);
-            use_data->thread = tid;
+            use_data.WaitForObjectIdle(false);
+            use_data.thread = tid;
         }
     }
 };
 
-class ThreadSafety : public ValidationObject {
+class ThreadSafety final : public ValidationObject {
   public:
-    std::shared_mutex thread_safety_lock;
+    vvl::ProfiledSharedMutex<vvl::ProfiledLock::ThreadSafety> thread_safety_lock;
 
     // Override chassis read/write locks for this validation object
     // This override takes a deferred lock. i.e. it is not acquired.
@@ -304,6 +386,12 @@ class ThreadSafety : public ValidationObject {
     // for objects created with the instance as parent.
     ThreadSafety *parent_instance;
 
+    std::atomic<bool> multi_threaded_{false};
+    // The first thread calling into this object
+    std::atomic<std::thread::id> single_thread_{};
+    // Start calls skipped by single_thread_ whose Finish call did not come yet, only single_thread_ touches it
+    uint32_t single_thread_skips_ = 0;
+
     ThreadSafety(ThreadSafety *parent)
         : c_VkCommandBuffer(kVulkanObjectTypeCommandBuffer, this),
           c_VkDevice(kVulkanObjectTypeDevice, this),
@@ -313,32 +401,85 @@ class ThreadSafety : public ValidationObject {
 #ifdef DISTINCT_NONDISPATCHABLE_HANDLES
 #include "generated/thread_safety_counter_instances.h"
 #else   // DISTINCT_NONDISPATCHABLE_HANDLES
-          c_uint64_t(kVulkanObjectTypeUnknown, this),
+          c_uint64_t(kVulkanObjectTypeUnknown, this, &ObjectUseSlots()),
 #endif  // DISTINCT_NONDISPATCHABLE_HANDLES
           parent_instance(parent) {
         container_type = LayerObjectTypeThreading;
     };
 
-#define WRAPPER(type)                                                                                 \
-    void StartWriteObject(type object, const Location& loc) { c_##type.StartWrite(object, loc); }   \
-    void FinishWriteObject(type object, const Location& loc) { c_##type.FinishWrite(object, loc); } \
-    void StartReadObject(type object, const Location& loc) { c_##type.StartRead(object, loc); }     \
-    void FinishReadObject(type object, const Location& loc) { c_##type.FinishRead(object, loc); }   \
-    void CreateObject(type object) { c_##type.CreateObject(object); }                                 \
+    // With thread_safety_adaptive, the Start/Finish calls skip the counters while a single thread has called into this object,
+    // which then costs a thread id compare. Once a second thread calls, both use the counters. The first thread keeps skipping
+    // until the Finish calls of the Start calls it skipped, so the counts start from zero and are never left unbalanced, and a
+    // collision with that call can be missed.
+    bool SkipStart() {
+        if (!global_settings.thread_safety_adaptive) {
+            return false;
+        }
+        const std::thread::id tid = std::this_thread::get_id();
+        // Acquire pairs with the release of the thread that switched to the counters, so the Start calls of this thread that
+        // follow see the counts of the other threads
+        if (!multi_threaded_.load(std::memory_order_acquire)) {
+            std::thread::id single_thread = single_thread_.load(std::memory_order_acquire);
+            // If another thread got here first, the compare sets single_thread to it
+            if (single_thread == std::thread::id() &&
+                single_thread_.compare_exchange_strong(single_thread, tid, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                single_thread = tid;
+            }
+            if (single_thread == tid) {
+                ++single_thread_skips_;
+                return true;
+            }
+            multi_threaded_.store(true, std::memory_order_release);
+        }
+        if (single_thread_.load(std::memory_order_acquire) == tid && single_thread_skips_ != 0) {
+            ++single_thread_skips_;
+            return true;
+        }
+        return false;
+    }
+    bool SkipFinish() {
+        if (!global_settings.thread_safety_adaptive) {
+            return false;
+        }
+        if (single_thread_.load(std::memory_order_acquire) == std::this_thread::get_id() && single_thread_skips_ != 0) {
+            --single_thread_skips_;
+            return true;
+        }
+        return false;
+    }
+
+#define WRAPPER(type)                                                 \
+    void StartWriteObject(type object, const Location& loc) {         \
+        if (!SkipStart()) c_##type.StartWrite(object, loc);           \
+    }                                                                 \
+    void FinishWriteObject(type object, const Location& loc) {        \
+        if (!SkipFinish()) c_##type.FinishWrite(object, loc);         \
+    }                                                                 \
+    void StartReadObject(type object, const Location& loc) {          \
+        if (!SkipStart()) c_##type.StartRead(object, loc);            \
+    }                                                                 \
+    void FinishReadObject(type object, const Location& loc) {         \
+        if (!SkipFinish()) c_##type.FinishRead(object, loc);          \
+    }                                                                 \
+    void CreateObject(type object) { c_##type.CreateObject(object); } \
     void DestroyObject(type object) { c_##type.DestroyObject(object); }
 
 #define WRAPPER_PARENT_INSTANCE(type)                                                                                           \
-    void StartWriteObjectParentInstance(type object, const Location& loc) {                                                       \
-        (parent_instance ? parent_instance : this)->c_##type.StartWrite(object, loc);                                       \
+    void StartWriteObjectParentInstance(type object, const Location& loc) {                                                     \
+        ThreadSafety *target = parent_instance ? parent_instance : this;                                                        \
+        if (!target->SkipStart()) target->c_##type.StartWrite(object, loc);                                                     \
     }                                                                                                                           \
-    void FinishWriteObjectParentInstance(type object, const Location& loc) {                                                      \
-        (parent_instance ? parent_instance : this)->c_##type.FinishWrite(object, loc);                                      \
+    void FinishWriteObjectParentInstance(type object, const Location& loc) {                                                    \
+        ThreadSafety *target = parent_instance ? parent_instance : this;                                                        \
+        if (!target->SkipFinish()) target->c_##type.FinishWrite(object, loc);                                                   \
     }                                                                                                                           \
-    void StartReadObjectParentInstance(type object, const Location& loc) {                                                        \
-        (parent_instance ? parent_instance : this)->c_##type.StartRead(object, loc);                                        \
+    void StartReadObjectParentInstance(type object, const Location& loc) {                                                      \
+        ThreadSafety *target = parent_instance ? parent_instance : this;                                                        \
+        if (!target->SkipStart()) target->c_##type.StartRead(object, loc);                                                      \
     }                                                                                                                           \
-    void FinishReadObjectParentInstance(type object, const Location& loc) {                                                       \
-        (parent_instance ? parent_instance : this)->c_##type.FinishRead(object, loc);                                       \
+    void FinishReadObjectParentInstance(type object, const Location& loc) {                                                     \
+        ThreadSafety *target = parent_instance ? parent_instance : this;                                                        \
+        if (!target->SkipFinish()) target->c_##type.FinishRead(object, loc);                                                    \
     }                                                                                                                           \
     void CreateObjectParentInstance(type object) { (parent_instance ? parent_instance : this)->c_##type.CreateObject(object); } \
     void DestroyObjectParentInstance(type object) { (parent_instance ? parent_instance : this)->c_##type.DestroyObject(object); }
@@ -356,8 +497,25 @@ class ThreadSafety : public ValidationObject {
     void CreateObject(VkCommandBuffer object) { c_VkCommandBuffer.CreateObject(object); }
     void DestroyObject(VkCommandBuffer object) { c_VkCommandBuffer.DestroyObject(object); }
 
+    // With thread_safety_command_buffer_ownership, a thread recording a command buffer claims its command pool. The writes
+    // of that thread to the command buffers of the pool then skip the counters of both, until another thread uses the pool
+    // or one of its command buffers and the pool is shared again. Returns true if the counters are skipped.
+    bool StartOwnedCommandBufferWrite(VkCommandBuffer command_buffer);
+    bool FinishOwnedCommandBufferWrite(VkCommandBuffer command_buffer);
+    // Called when the pool or one of its command buffers is used outside of StartOwnedCommandBufferWrite()
+    void ShareCommandPool(VkCommandPool pool);
+    // Called for vkResetCommandPool, the pool can be claimed again by the next thread recording one of its command buffers
+    void ReleaseCommandPool(VkCommandPool pool);
+    std::shared_ptr<ObjectUseData> FindCommandPoolUseData(VkCommandPool pool);
+
     // VkCommandBuffer needs check for implicit use of command pool
     void StartWriteObject(VkCommandBuffer object, const Location& loc, bool lockPool = true) {
+        if (SkipStart()) {
+            return;
+        }
+        if (lockPool && global_settings.thread_safety_command_buffer_ownership && StartOwnedCommandBufferWrite(object)) {
+            return;
+        }
         if (lockPool) {
             auto iter = command_pool_map.find(object);
             if (iter != command_pool_map.end()) {
@@ -368,6 +526,12 @@ class ThreadSafety : public ValidationObject {
         c_VkCommandBuffer.StartWrite(object, loc);
     }
     void FinishWriteObject(VkCommandBuffer object, const Location& loc, bool lockPool = true) {
+        if (SkipFinish()) {
+            return;
+        }
+        if (lockPool && global_settings.thread_safety_command_buffer_ownership && FinishOwnedCommandBufferWrite(object)) {
+            return;
+        }
         c_VkCommandBuffer.FinishWrite(object, loc);
         if (lockPool) {
             auto iter = command_pool_map.find(object);
@@ -378,9 +542,15 @@ class ThreadSafety : public ValidationObject {
         }
     }
     void StartReadObject(VkCommandBuffer object, const Location& loc) {
+        if (SkipStart()) {
+            return;
+        }
         auto iter = command_pool_map.find(object);
         if (iter != command_pool_map.end()) {
             VkCommandPool pool = iter->second;
+            if (global_settings.thread_safety_command_buffer_ownership) {
+                ShareCommandPool(pool);
+            }
             // We set up a read guard against the "Contents" counter to catch conflict vs. vkResetCommandPool and
             // vkDestroyCommandPool while *not* establishing a read guard against the command pool counter itself to avoid false
             // positive for non-externally sync'd command buffers
@@ -389,6 +559,9 @@ class ThreadSafety : public ValidationObject {
         c_VkCommandBuffer.StartRead(object, loc);
     }
     void FinishReadObject(VkCommandBuffer object, const Location& loc) {
+        if (SkipFinish()) {
+            return;
+        }
         c_VkCommandBuffer.FinishRead(object, loc);
         auto iter = command_pool_map.find(object);
         if (iter != command_pool_map.end()) {
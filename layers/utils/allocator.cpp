@@ -0,0 +1,158 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "allocator.h"
+
+#include <new>
+
+#if defined(VVL_ALLOCATOR_MIMALLOC)
+#include <cstdlib>
+
+#include <mimalloc.h>
+#endif
+
+namespace vvl {
+namespace allocator {
+
+#if defined(VVL_ALLOCATOR_THREAD_CACHE)
+
+// Sizes up to kMaxCachedSize are rounded up to a multiple of kGranularity, each multiple has its own free list in every thread.
+// A block freed by another thread than the one that allocated it goes to the list of the freeing thread, every block of a size
+// class is interchangeable.
+static constexpr size_t kGranularity = 16;
+static constexpr size_t kMaxCachedSize = 1024;
+static constexpr size_t kClassCount = kMaxCachedSize / kGranularity;
+// Past this many bytes in one list, the freed blocks go back to operator new so an idle thread doesn't hold on to memory
+static constexpr size_t kMaxCachedBytesPerClass = 64 * 1024;
+
+static_assert(kGranularity % kDefaultAlignment == 0, "blocks of every size class must keep the default alignment");
+
+struct FreeBlock {
+    FreeBlock *next;
+};
+
+struct ThreadCache {
+    struct FreeList {
+        FreeBlock *head = nullptr;
+        size_t count = 0;
+    };
+    FreeList lists[kClassCount];
+
+    ~ThreadCache();
+};
+
+static thread_local ThreadCache thread_cache;
+// Trivially destructible so it can still be read after thread_cache was destroyed, when thread local and static destructors free
+// memory late in the exit of the thread
+static thread_local bool thread_cache_destroyed = false;
+
+ThreadCache::~ThreadCache() {
+    thread_cache_destroyed = true;
+    for (FreeList &list : lists) {
+        while (list.head) {
+            FreeBlock *block = list.head;
+            list.head = block->next;
+            ::operator delete(block);
+        }
+        list.count = 0;
+    }
+}
+
+static size_t ClassIndex(size_t size) { return (size + kGranularity - 1) / kGranularity - 1; }
+static size_t ClassSize(size_t index) { return (index + 1) * kGranularity; }
+
+void *Allocate(size_t size, size_t alignment) {
+    if (alignment > kDefaultAlignment) {
+        return ::operator new(size, std::align_val_t(alignment));
+    }
+    if (size > kMaxCachedSize) {
+        return ::operator new(size);
+    }
+    const size_t index = ClassIndex(size == 0 ? 1 : size);
+    if (!thread_cache_destroyed) {
+        ThreadCache::FreeList &list = thread_cache.lists[index];
+        if (FreeBlock *block = list.head) {
+            list.head = block->next;
+            --list.count;
+            return block;
+        }
+    }
+    // Always the size of the whole class, the block can be reused for any size of it once freed
+    return ::operator new(ClassSize(index));
+}
+
+void Free(void *ptr, size_t size, size_t alignment) noexcept {
+    if (!ptr) {
+        return;
+    }
+    if (alignment > kDefaultAlignment) {
+        ::operator delete(ptr, std::align_val_t(alignment));
+        return;
+    }
+    if (size <= kMaxCachedSize && !thread_cache_destroyed) {
+        const size_t index = ClassIndex(size == 0 ? 1 : size);
+        ThreadCache::FreeList &list = thread_cache.lists[index];
+        if (list.count * ClassSize(index) < kMaxCachedBytesPerClass) {
+            FreeBlock *block = static_cast<FreeBlock *>(ptr);
+            block->next = list.head;
+            list.head = block;
+            ++list.count;
+            return;
+        }
+    }
+    ::operator delete(ptr);
+}
+
+const char *BackendName() { return "thread_cache"; }
+
+#elif defined(VVL_ALLOCATOR_MIMALLOC)
+
+void *Allocate(size_t size, size_t alignment) {
+    void *ptr = alignment > kDefaultAlignment ? mi_malloc_aligned(size, alignment) : mi_malloc(size);
+    if (!ptr) {
+        std::abort();
+    }
+    return ptr;
+}
+
+void Free(void *ptr, size_t, size_t) noexcept { mi_free(ptr); }
+
+const char *BackendName() { return "mimalloc"; }
+
+#else
+
+void *Allocate(size_t size, size_t alignment) {
+    if (alignment > kDefaultAlignment) {
+        return ::operator new(size, std::align_val_t(alignment));
+    }
+    return ::operator new(size);
+}
+
+void Free(void *ptr, size_t, size_t alignment) noexcept {
+    if (alignment > kDefaultAlignment) {
+        ::operator delete(ptr, std::align_val_t(alignment));
+    } else {
+        ::operator delete(ptr);
+    }
+}
+
+const char *BackendName() { return "system"; }
+
+#endif
+
+}  // namespace allocator
+}  // namespace vvl
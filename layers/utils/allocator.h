@@ -0,0 +1,77 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace vvl {
+namespace allocator {
+
+// Every backend returns memory with at least this alignment, larger alignments are passed through to aligned operator new
+static constexpr size_t kDefaultAlignment = alignof(std::max_align_t);
+
+// Memory of the containers of the layer itself (small_vector storage, node pool blocks, the std fallback of
+// vvl::unordered_map, pooled state objects). The backend is chosen when the layer is built (VVL_LAYER_ALLOCATOR):
+//   system       operator new, which is mimalloc when USE_MIMALLOC replaces it
+//   thread_cache small blocks are kept in per thread free lists, so the threads of a heavily multithreaded application
+//                don't all go through the allocator locks for the many small allocations of the layer
+//   mimalloc     mimalloc only for these containers, without replacing operator new of the whole process
+void *Allocate(size_t size, size_t alignment = kDefaultAlignment);
+// size and alignment must be the ones given to Allocate, the thread_cache backend files the block by its size
+void Free(void *ptr, size_t size, size_t alignment = kDefaultAlignment) noexcept;
+
+const char *BackendName();
+
+#if defined(VVL_ALLOCATOR_THREAD_CACHE) || defined(VVL_ALLOCATOR_MIMALLOC)
+static constexpr bool kCachesPerThread = true;
+#else
+static constexpr bool kCachesPerThread = false;
+#endif
+
+}  // namespace allocator
+
+// std allocator going through vvl::allocator
+template <typename T>
+class Allocator {
+  public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    Allocator() noexcept = default;
+    template <typename U>
+    Allocator(const Allocator<U> &) noexcept {}
+
+    T *allocate(size_t n) {
+        assert(n <= std::numeric_limits<size_t>::max() / sizeof(T));
+        return static_cast<T *>(allocator::Allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T *p, size_t n) noexcept { allocator::Free(p, n * sizeof(T), alignof(T)); }
+
+    template <typename U>
+    bool operator==(const Allocator<U> &) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const Allocator<U> &) const {
+        return false;
+    }
+};
+
+}  // namespace vvl
@@ -0,0 +1,140 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cache_file.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+namespace vvl {
+
+namespace {
+// Exclusive advisory lock, held until destruction. Only processes that take the same lock are kept out.
+class FileLock {
+  public:
+    explicit FileLock(const std::string &path);
+    ~FileLock();
+    FileLock(const FileLock &) = delete;
+    FileLock &operator=(const FileLock &) = delete;
+
+  private:
+#if defined(_WIN32)
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+#elif defined(__unix__) || defined(__APPLE__)
+    int fd_ = -1;
+#endif
+};
+
+#if defined(_WIN32)
+FileLock::FileLock(const std::string &path) {
+    file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS,
+                        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    OVERLAPPED overlapped{};
+    if (!LockFileEx(file_, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped)) {
+        CloseHandle(file_);
+        file_ = INVALID_HANDLE_VALUE;
+    }
+}
+
+// Closing the handle releases the lock
+FileLock::~FileLock() {
+    if (file_ != INVALID_HANDLE_VALUE) {
+        CloseHandle(file_);
+    }
+}
+
+// Unlike rename(), replaces an existing file, and does it in one step
+bool ReplaceWith(const std::string &temp_path, const std::string &path) {
+    return MoveFileExA(temp_path.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+#elif defined(__unix__) || defined(__APPLE__)
+FileLock::FileLock(const std::string &path) {
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+    if (fd_ < 0) {
+        return;
+    }
+    while (flock(fd_, LOCK_EX) != 0) {
+        if (errno != EINTR) {
+            close(fd_);
+            fd_ = -1;
+            return;
+        }
+    }
+}
+
+// Closing the descriptor releases the lock
+FileLock::~FileLock() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+// rename() replaces an existing file atomically
+bool ReplaceWith(const std::string &temp_path, const std::string &path) {
+    return std::rename(temp_path.c_str(), path.c_str()) == 0;
+}
+#else
+FileLock::FileLock(const std::string &) {}
+FileLock::~FileLock() {}
+
+bool ReplaceWith(const std::string &temp_path, const std::string &path) {
+    return std::rename(temp_path.c_str(), path.c_str()) == 0;
+}
+#endif
+
+bool WriteTempAndReplace(const std::string &path, const void *data, size_t size) {
+    const std::string temp_path = path + "." + std::to_string(std::random_device{}()) + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        if (!file) {
+            file.close();
+            std::remove(temp_path.c_str());
+            return false;
+        }
+    }
+    if (!ReplaceWith(temp_path, path)) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+}  // namespace
+
+bool SaveCacheFile(const std::string &path, const std::function<bool(const CacheFileWriter &write)> &update) {
+    const FileLock lock(path + ".lock");
+    const CacheFileWriter write = [&path](const void *data, size_t size) { return WriteTempAndReplace(path, data, size); };
+    return update(write);
+}
+
+}  // namespace vvl
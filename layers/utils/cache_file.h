@@ -0,0 +1,40 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace vvl {
+
+// Saves a cache file that several processes share (like test runners launched in parallel).
+//
+// An advisory lock on |path| + ".lock" is held while |update| runs. |update| reads what other processes saved, merges it, and
+// calls the returned write function with the merged contents. The lock covers the whole read-merge-write, so two processes
+// saving at the same time do not drop each other's entries. The data goes to a temporary file that then atomically replaces
+// |path|, so a reader without the lock still sees either the old or the new file, never a missing or half written one.
+//
+// If the lock file can not be created (read only directory, unsupported platform), the file is saved without the lock and
+// entries saved by another process at the same time can be lost.
+//
+// Returns false if the file could not be written, the cache in memory is unaffected.
+using CacheFileWriter = std::function<bool(const void *data, size_t size)>;
+bool SaveCacheFile(const std::string &path, const std::function<bool(const CacheFileWriter &write)> &update);
+
+}  // namespace vvl
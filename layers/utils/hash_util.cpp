@@ -42,6 +42,17 @@ uint32_t ShaderHash(const void *pCode, const size_t codeSize) {
     return XXH32(pCode, codeSize, seed);
 }
 
+uint64_t ShaderHash64(const void *pCode, const size_t codeSize) {
+    constexpr uint64_t seed = 0;
+    return XXH64(pCode, codeSize, seed);
+}
+
+Hash128 ShaderHash128(const void *pCode, const size_t codeSize) {
+    constexpr uint64_t seed = 0;
+    const XXH128_hash_t hash = XXH3_128bits_withSeed(pCode, codeSize, seed);
+    return Hash128{hash.low64, hash.high64};
+}
+
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size) {
     constexpr uint64_t seed = 0;
     return XXH64(info, info_size, seed);
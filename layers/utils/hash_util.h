@@ -161,6 +161,27 @@ uint32_t VuidHash(std::string_view vuid);
 
 uint32_t ShaderHash(const void *pCode, const size_t codeSize);
 
+// Used when a collision would give wrong results instead of a skipped check
+uint64_t ShaderHash64(const void *pCode, const size_t codeSize);
+
+// Wide enough for the caches that persist across runs and can grow to millions of shaders
+struct Hash128 {
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    bool operator==(const Hash128 &other) const { return low == other.low && high == other.high; }
+    bool operator!=(const Hash128 &other) const { return !(*this == other); }
+    // For the places that can only hold 32 bits, like the shader id GPU-AV puts in the instrumented SPIR-V
+    uint32_t Fold32() const { return static_cast<uint32_t>(low ^ (low >> 32) ^ high ^ (high >> 32)); }
+
+    struct Hasher {
+        size_t operator()(const Hash128 &hash) const { return static_cast<size_t>(hash.low); }
+    };
+};
+
+// XXH3-128, computed once per SPIR-V module and kept on spirv::Module so the caches don't hash the code again
+Hash128 ShaderHash128(const void *pCode, const size_t codeSize);
+
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size);
 
 }  // namespace hash_util
@@ -0,0 +1,165 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "lock_profiling.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+
+namespace vvl {
+namespace lock_profiling {
+
+std::atomic<bool> enabled{false};
+
+static std::array<LockStats, static_cast<size_t>(ProfiledLock::Count)> lock_stats;
+
+void Enable() { enabled.store(true, std::memory_order_relaxed); }
+
+const char *Name(ProfiledLock lock) {
+    switch (lock) {
+        case ProfiledLock::ObjectLifetime:
+            return "ObjectLifetimes::object_lifetime_mutex";
+        case ProfiledLock::ThreadSafety:
+            return "ThreadSafety::thread_safety_lock";
+        case ProfiledLock::BufferAddress:
+            return "ValidationStateTracker::buffer_address_lock_";
+        case ProfiledLock::StateObjectTree:
+            return "StateObject::tree_lock_";
+        case ProfiledLock::DebugOutput:
+            return "DebugReport::debug_output_mutex";
+        case ProfiledLock::HandleTable:
+            return "HandleTable::write_lock_ (unique_id_mapping)";
+        case ProfiledLock::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+LockStats &Stats(ProfiledLock lock) { return lock_stats[static_cast<size_t>(lock)]; }
+
+uint64_t Now() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void RecordWait(ProfiledLock lock, uint64_t wait_ns) {
+    LockStats &stats = Stats(lock);
+    stats.contended.fetch_add(1, std::memory_order_relaxed);
+    stats.wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+    uint64_t max_wait = stats.max_wait_ns.load(std::memory_order_relaxed);
+    while (wait_ns > max_wait && !stats.max_wait_ns.compare_exchange_weak(max_wait, wait_ns, std::memory_order_relaxed)) {
+    }
+
+    uint32_t bucket = 0;
+    for (uint64_t wait_us = wait_ns / 1000; wait_us != 0 && bucket < kWaitBuckets - 1; wait_us >>= 1) {
+        ++bucket;
+    }
+    stats.wait_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+static std::string FormatTime(uint64_t ns) {
+    char buffer[32];
+    if (ns < 10'000) {
+        std::snprintf(buffer, sizeof(buffer), "%" PRIu64 "ns", ns);
+    } else if (ns < 10'000'000) {
+        std::snprintf(buffer, sizeof(buffer), "%" PRIu64 "us", ns / 1000);
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "%" PRIu64 "ms", ns / 1'000'000);
+    }
+    return buffer;
+}
+
+std::string Report() {
+    std::string report = "Lock profiling:\n";
+    bool any_acquisition = false;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(ProfiledLock::Count); ++i) {
+        const ProfiledLock lock = static_cast<ProfiledLock>(i);
+        const LockStats &stats = Stats(lock);
+        const uint64_t acquisitions = stats.acquisitions.load(std::memory_order_relaxed);
+        if (acquisitions == 0) {
+            continue;
+        }
+        any_acquisition = true;
+        const uint64_t contended = stats.contended.load(std::memory_order_relaxed);
+
+        char line[256];
+        std::snprintf(line, sizeof(line), "    %s: %" PRIu64 " acquisitions, %" PRIu64 " contended (%.2f%%)", Name(lock),
+                      acquisitions, contended, 100.0 * static_cast<double>(contended) / static_cast<double>(acquisitions));
+        report += line;
+        if (contended != 0) {
+            report += ", waited " + FormatTime(stats.wait_ns.load(std::memory_order_relaxed)) + " (max " +
+                      FormatTime(stats.max_wait_ns.load(std::memory_order_relaxed)) + ")";
+        }
+        report += ", held exclusively " + FormatTime(stats.hold_ns.load(std::memory_order_relaxed)) + "\n";
+
+        if (contended != 0) {
+            report += "        wait histogram:";
+            for (uint32_t bucket = 0; bucket < kWaitBuckets; ++bucket) {
+                const uint64_t count = stats.wait_histogram[bucket].load(std::memory_order_relaxed);
+                if (count == 0) {
+                    continue;
+                }
+                if (bucket == kWaitBuckets - 1) {
+                    std::snprintf(line, sizeof(line), " >=%uus: %" PRIu64, 1u << (bucket - 1), count);
+                } else {
+                    std::snprintf(line, sizeof(line), " <%uus: %" PRIu64, 1u << bucket, count);
+                }
+                report += line;
+            }
+            report += "\n";
+        }
+    }
+    if (!any_acquisition) {
+        report += "    No profiled lock was taken.\n";
+    }
+    return report;
+}
+
+std::string ReportJson() {
+    std::string report = "[";
+    for (uint32_t i = 0; i < static_cast<uint32_t>(ProfiledLock::Count); ++i) {
+        const ProfiledLock lock = static_cast<ProfiledLock>(i);
+        const LockStats &stats = Stats(lock);
+        char entry[384];
+        std::snprintf(entry, sizeof(entry),
+                      "%s{\"lock\":\"%s\",\"acquisitions\":%" PRIu64 ",\"contended\":%" PRIu64 ",\"wait_ns\":%" PRIu64
+                      ",\"max_wait_ns\":%" PRIu64 ",\"hold_ns\":%" PRIu64 "}",
+                      i == 0 ? "" : ",", Name(lock), stats.acquisitions.load(std::memory_order_relaxed),
+                      stats.contended.load(std::memory_order_relaxed), stats.wait_ns.load(std::memory_order_relaxed),
+                      stats.max_wait_ns.load(std::memory_order_relaxed), stats.hold_ns.load(std::memory_order_relaxed));
+        report += entry;
+    }
+    report += "]";
+    return report;
+}
+
+void Reset() {
+    for (LockStats &stats : lock_stats) {
+        stats.acquisitions.store(0, std::memory_order_relaxed);
+        stats.contended.store(0, std::memory_order_relaxed);
+        stats.wait_ns.store(0, std::memory_order_relaxed);
+        stats.max_wait_ns.store(0, std::memory_order_relaxed);
+        stats.hold_ns.store(0, std::memory_order_relaxed);
+        for (auto &count : stats.wait_histogram) {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+}  // namespace lock_profiling
+}  // namespace vvl
@@ -0,0 +1,159 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+#include "profiling/profiling.h"
+
+namespace vvl {
+
+// Locks that report their contention with the lock_profiling setting. Every instance of a lock (like the tree_lock_ of each
+// state object) adds to the same counters.
+enum class ProfiledLock : uint32_t {
+    ObjectLifetime,
+    ThreadSafety,
+    BufferAddress,
+    StateObjectTree,
+    DebugOutput,
+    HandleTable,
+    Count,
+};
+
+namespace lock_profiling {
+
+// Bucket i counts the waits shorter than 2^i microseconds (and longer than the previous bucket), the last one everything above
+static constexpr uint32_t kWaitBuckets = 16;
+
+struct LockStats {
+    std::atomic<uint64_t> acquisitions{0};
+    // Acquisitions that had to wait for another thread
+    std::atomic<uint64_t> contended{0};
+    std::atomic<uint64_t> wait_ns{0};
+    std::atomic<uint64_t> max_wait_ns{0};
+    // Only exclusive locks are timed, shared holders can't be told apart
+    std::atomic<uint64_t> hold_ns{0};
+    std::array<std::atomic<uint64_t>, kWaitBuckets> wait_histogram{};
+};
+
+extern std::atomic<bool> enabled;
+inline bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+// Profiling can't be turned off once on, a lock taken while it was on must still record its hold time on unlock
+void Enable();
+
+const char *Name(ProfiledLock lock);
+LockStats &Stats(ProfiledLock lock);
+uint64_t Now();
+void RecordWait(ProfiledLock lock, uint64_t wait_ns);
+
+// Plain text summary of every lock taken since profiling was enabled
+std::string Report();
+// Same counters as a JSON array with one object per lock, for tools that compare runs
+std::string ReportJson();
+void Reset();
+
+}  // namespace lock_profiling
+
+// Drop-in replacement for std::mutex and std::shared_mutex (works with the std lock guards).
+//
+// When profiling is off a lock costs one relaxed load on top of the wrapped mutex. When it is on, a try_lock() is attempted
+// first so uncontended acquisitions are only counted, then the wait is timed and shows up as a "Lock wait" Tracy zone.
+template <typename Mutex, ProfiledLock kLock>
+class ProfiledMutex {
+  public:
+    ProfiledMutex() = default;
+    ProfiledMutex(const ProfiledMutex &) = delete;
+    ProfiledMutex &operator=(const ProfiledMutex &) = delete;
+
+    void lock() {
+        if (!lock_profiling::IsEnabled()) {
+            mutex_.lock();
+            return;
+        }
+        if (!mutex_.try_lock()) {
+            Wait([this]() { mutex_.lock(); });
+        }
+        lock_profiling::Stats(kLock).acquisitions.fetch_add(1, std::memory_order_relaxed);
+        lock_time_ = lock_profiling::Now();
+    }
+
+    bool try_lock() {
+        if (!mutex_.try_lock()) {
+            return false;
+        }
+        if (lock_profiling::IsEnabled()) {
+            lock_profiling::Stats(kLock).acquisitions.fetch_add(1, std::memory_order_relaxed);
+            lock_time_ = lock_profiling::Now();
+        }
+        return true;
+    }
+
+    void unlock() {
+        if (lock_time_ != 0) {
+            lock_profiling::Stats(kLock).hold_ns.fetch_add(lock_profiling::Now() - lock_time_, std::memory_order_relaxed);
+            lock_time_ = 0;
+        }
+        mutex_.unlock();
+    }
+
+    void lock_shared() {
+        if (!lock_profiling::IsEnabled()) {
+            mutex_.lock_shared();
+            return;
+        }
+        if (!mutex_.try_lock_shared()) {
+            Wait([this]() { mutex_.lock_shared(); });
+        }
+        lock_profiling::Stats(kLock).acquisitions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool try_lock_shared() {
+        if (!mutex_.try_lock_shared()) {
+            return false;
+        }
+        if (lock_profiling::IsEnabled()) {
+            lock_profiling::Stats(kLock).acquisitions.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    void unlock_shared() { mutex_.unlock_shared(); }
+
+  private:
+    template <typename LockFn>
+    void Wait(LockFn &&lock_fn) {
+        VVL_ZoneScopedN("Lock wait");
+        VVL_ZoneText(lock_profiling::Name(kLock));
+        const uint64_t start = lock_profiling::Now();
+        lock_fn();
+        lock_profiling::RecordWait(kLock, lock_profiling::Now() - start);
+    }
+
+    Mutex mutex_;
+    // Written by the exclusive owner only, 0 when the lock was not taken with profiling on
+    uint64_t lock_time_ = 0;
+};
+
+template <ProfiledLock kLock>
+using ProfiledSharedMutex = ProfiledMutex<std::shared_mutex, kLock>;
+
+}  // namespace vvl
@@ -0,0 +1,142 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vvl {
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        Close();
+        is_open_ = other.is_open_;
+        size_ = other.size_;
+        mapping_ = other.mapping_;
+        read_data_ = std::move(other.read_data_);
+        data_ = other.data_;
+        other.is_open_ = false;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.mapping_ = nullptr;
+    }
+    return *this;
+}
+
+#if defined(_WIN32)
+bool MappedFile::Map(const std::string &path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0 ||
+        static_cast<uint64_t>(file_size.QuadPart) > static_cast<uint64_t>(SIZE_MAX)) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // The view keeps the mapping and the file alive
+    CloseHandle(file);
+    if (!mapping) {
+        return false;
+    }
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+        return false;
+    }
+    mapping_ = view;
+    data_ = static_cast<const uint8_t *>(view);
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    return true;
+}
+#elif defined(__unix__) || defined(__APPLE__)
+bool MappedFile::Map(const std::string &path) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    const size_t size = static_cast<size_t>(file_stat.st_size);
+    void *view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    mapping_ = view;
+    data_ = static_cast<const uint8_t *>(view);
+    size_ = size;
+    return true;
+}
+#else
+bool MappedFile::Map(const std::string &) { return false; }
+#endif
+
+bool MappedFile::Open(const std::string &path) {
+    Close();
+    if (Map(path)) {
+        is_open_ = true;
+        return true;
+    }
+
+    // Empty files can't be mapped, and mapping can fail on some file systems
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::copy(std::istreambuf_iterator<char>(file), {}, std::back_inserter(read_data_));
+    is_open_ = true;
+    data_ = read_data_.empty() ? nullptr : read_data_.data();
+    size_ = read_data_.size();
+    return true;
+}
+
+void MappedFile::Close() {
+    if (mapping_) {
+#if defined(_WIN32)
+        UnmapViewOfFile(mapping_);
+#elif defined(__unix__) || defined(__APPLE__)
+        munmap(mapping_, size_);
+#endif
+        mapping_ = nullptr;
+    }
+    read_data_.clear();
+    read_data_.shrink_to_fit();
+    is_open_ = false;
+    data_ = nullptr;
+    size_ = 0;
+}
+
+}  // namespace vvl
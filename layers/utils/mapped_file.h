@@ -0,0 +1,60 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Read only view of a whole file. The file is mapped in memory where the platform allows it, so opening a large file costs
+// nothing until its pages are touched; otherwise (or if mapping fails) it is read into memory.
+//
+// On Windows a mapped file can't be deleted or replaced, Close() it before writing over it.
+class MappedFile {
+  public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept { *this = std::move(other); }
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    // Returns false if the file can't be opened, an empty file opens with a null Data()
+    bool Open(const std::string &path);
+    void Close();
+
+    bool IsOpen() const { return is_open_; }
+    bool IsMapped() const { return mapping_ != nullptr; }
+    const uint8_t *Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+  private:
+    bool Map(const std::string &path);
+
+    bool is_open_ = false;
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+    // Start of the mapped view, null when the file was read instead
+    void *mapping_ = nullptr;
+    std::vector<uint8_t> read_data_;
+};
+
+}  // namespace vvl
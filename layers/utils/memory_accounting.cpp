@@ -0,0 +1,118 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "memory_accounting.h"
+
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+
+namespace vvl {
+namespace memory_accounting {
+
+struct TagStats {
+    // Signed, memory allocated before a counter was reset can be freed after it
+    std::atomic<int64_t> bytes{0};
+    std::atomic<int64_t> peak_bytes{0};
+    std::atomic<uint64_t> allocations{0};
+};
+
+static std::array<TagStats, static_cast<size_t>(MemoryTag::Count)> tag_stats;
+
+static TagStats &Stats(MemoryTag tag) { return tag_stats[static_cast<size_t>(tag)]; }
+
+void Allocate(MemoryTag tag, size_t bytes) {
+    TagStats &stats = Stats(tag);
+    const int64_t new_bytes = stats.bytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) +
+                              static_cast<int64_t>(bytes);
+    stats.allocations.fetch_add(1, std::memory_order_relaxed);
+    int64_t peak = stats.peak_bytes.load(std::memory_order_relaxed);
+    while (new_bytes > peak && !stats.peak_bytes.compare_exchange_weak(peak, new_bytes, std::memory_order_relaxed)) {
+    }
+}
+
+void Free(MemoryTag tag, size_t bytes) { Stats(tag).bytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed); }
+
+const char *Name(MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::StateObjects:
+            return "Pooled state objects";
+        case MemoryTag::SyncvalAccessMaps:
+            return "Syncval access maps";
+        case MemoryTag::SyncvalAccessLogs:
+            return "Syncval command buffer access logs";
+        case MemoryTag::SpirvModules:
+            return "SPIR-V modules";
+        case MemoryTag::Other:
+            return "Other pools";
+        case MemoryTag::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+uint64_t CurrentBytes(MemoryTag tag) {
+    const int64_t bytes = Stats(tag).bytes.load(std::memory_order_relaxed);
+    return bytes > 0 ? static_cast<uint64_t>(bytes) : 0;
+}
+
+uint64_t PeakBytes(MemoryTag tag) {
+    const int64_t bytes = Stats(tag).peak_bytes.load(std::memory_order_relaxed);
+    return bytes > 0 ? static_cast<uint64_t>(bytes) : 0;
+}
+
+std::string Report() {
+    std::string report = std::string("Memory accounting (") + allocator::BackendName() + " allocator):\n";
+    for (uint32_t i = 0; i < static_cast<uint32_t>(MemoryTag::Count); ++i) {
+        const MemoryTag tag = static_cast<MemoryTag>(i);
+        const uint64_t allocations = Stats(tag).allocations.load(std::memory_order_relaxed);
+        if (allocations == 0) {
+            continue;
+        }
+        char line[256];
+        std::snprintf(line, sizeof(line), "    %s: %.3fMB now, %.3fMB at peak, %" PRIu64 " allocations\n", Name(tag),
+                      static_cast<double>(CurrentBytes(tag)) / 1e6, static_cast<double>(PeakBytes(tag)) / 1e6, allocations);
+        report += line;
+    }
+    return report;
+}
+
+std::string ReportJson() {
+    std::string report = "[";
+    for (uint32_t i = 0; i < static_cast<uint32_t>(MemoryTag::Count); ++i) {
+        const MemoryTag tag = static_cast<MemoryTag>(i);
+        char entry[256];
+        std::snprintf(entry, sizeof(entry),
+                      "%s{\"tag\":\"%s\",\"bytes\":%" PRIu64 ",\"peak_bytes\":%" PRIu64 ",\"allocations\":%" PRIu64 "}",
+                      i == 0 ? "" : ",", Name(tag), CurrentBytes(tag), PeakBytes(tag),
+                      Stats(tag).allocations.load(std::memory_order_relaxed));
+        report += entry;
+    }
+    report += "]";
+    return report;
+}
+
+void ResetPeaks() {
+    for (TagStats &stats : tag_stats) {
+        stats.peak_bytes.store(stats.bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        stats.allocations.store(0, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace memory_accounting
+}  // namespace vvl
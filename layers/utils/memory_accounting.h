@@ -0,0 +1,113 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "utils/allocator.h"
+
+namespace vvl {
+
+// What the memory of the layer is used for, the memory_accounting setting reports the bytes of each tag
+enum class MemoryTag : uint32_t {
+    // State objects made with MakePooledState (views, descriptor sets, ...). Not counted when vvl::allocator caches per thread,
+    // the objects don't go through a pool then.
+    StateObjects,
+    // Nodes of the syncval access maps
+    SyncvalAccessMaps,
+    // Records of the commands of each syncval command buffer, kept until the command buffer is reset
+    SyncvalAccessLogs,
+    // SPIR-V words and parsed instructions of the shader modules and shader objects
+    SpirvModules,
+    Other,
+    Count,
+};
+
+namespace memory_accounting {
+
+// Always counted, only tagged memory that is allocated in big chunks (pool blocks, vector storage, whole modules) so two
+// relaxed atomic adds per allocation don't matter
+void Allocate(MemoryTag tag, size_t bytes);
+void Free(MemoryTag tag, size_t bytes);
+
+const char *Name(MemoryTag tag);
+uint64_t CurrentBytes(MemoryTag tag);
+uint64_t PeakBytes(MemoryTag tag);
+
+// Current and peak bytes of each tag
+std::string Report();
+// Same counters as a JSON array with one object per tag, for tools that compare runs
+std::string ReportJson();
+// The next peaks start from the current bytes and the allocations are counted again from zero
+void ResetPeaks();
+
+}  // namespace memory_accounting
+
+// Memory allocated in one go that lives as long as its owner, like the SPIR-V of a module
+class AccountedMemory {
+  public:
+    AccountedMemory(MemoryTag tag, size_t bytes) : tag_(tag), bytes_(bytes) { memory_accounting::Allocate(tag_, bytes_); }
+    ~AccountedMemory() { memory_accounting::Free(tag_, bytes_); }
+    AccountedMemory(const AccountedMemory &) = delete;
+    AccountedMemory &operator=(const AccountedMemory &) = delete;
+
+  private:
+    const MemoryTag tag_;
+    const size_t bytes_;
+};
+
+// vvl::Allocator counting what it allocates under kTag, for containers whose type is private to the subsystem owning them
+template <typename T, MemoryTag kTag>
+class TaggedAllocator {
+  public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+    template <typename U>
+    struct rebind {
+        using other = TaggedAllocator<U, kTag>;
+    };
+
+    TaggedAllocator() noexcept = default;
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U, kTag> &) noexcept {}
+
+    T *allocate(size_t n) {
+        T *p = Allocator<T>().allocate(n);
+        memory_accounting::Allocate(kTag, n * sizeof(T));
+        return p;
+    }
+
+    void deallocate(T *p, size_t n) {
+        memory_accounting::Free(kTag, n * sizeof(T));
+        Allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const TaggedAllocator<U, kTag> &) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const TaggedAllocator<U, kTag> &) const {
+        return false;
+    }
+};
+
+}  // namespace vvl
@@ -19,6 +19,9 @@
 
 #include "shader_utils.h"
 
+#include <utility>
+#include <vector>
+
 #include "generated/device_features.h"
 #include "generated/vk_api_version.h"
 #include "generated/vk_extension_helper.h"
@@ -45,60 +48,68 @@ void ValidationCache::GetUUID(uint8_t *uuid) {
         uuid[i] = static_cast<uint8_t>(std::strtoul(byte_str, nullptr, 16));
     }
 
+    // The entries used to be 32-bit hashes, then unsorted 128-bit hashes, older data has a different UUID and is ignored
+    constexpr uint32_t entry_format = 3;
+    std::memcpy(uuid + (VK_UUID_SIZE - 2 * sizeof(uint32_t)), &entry_format, sizeof(uint32_t));
     // Replace the last 4 bytes (likely padded with zero anyway)
     std::memcpy(uuid + (VK_UUID_SIZE - sizeof(uint32_t)), &spirv_val_option_hash_, sizeof(uint32_t));
 }
 
-void ValidationCache::Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-    const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-    auto size = headerSize;
-    if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
-
-    uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
-    if (data[0] != size) return;
-    if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
-    uint8_t expected_uuid[VK_UUID_SIZE];
-    GetUUID(expected_uuid);
-    if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
-
-    data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
+ValidationCache::ValidationCache(uint32_t spirv_val_option_hash, size_t max_entries)
+    : spirv_val_option_hash_(spirv_val_option_hash), good_shader_hashes_(max_entries) {
+    const uint32_t header_size = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
+    const uint32_t header_version = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
+    header_.resize(header_size);
+    std::memcpy(header_.data(), &header_size, sizeof(uint32_t));
+    std::memcpy(header_.data() + sizeof(uint32_t), &header_version, sizeof(uint32_t));
+    GetUUID(header_.data() + 2 * sizeof(uint32_t));
+}
 
+void ValidationCache::Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
+    if (!pCreateInfo->pInitialData) return;
     auto guard = WriteLock();
-    for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-        good_shader_hashes_.insert(*data);
-    }
+    good_shader_hashes_.Load(pCreateInfo->pInitialData, pCreateInfo->initialDataSize, header_);
 }
 
-void ValidationCache::Write(size_t *pDataSize, void *pData) {
-    const auto header_size = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
-    if (!pData) {
-        *pDataSize = header_size + good_shader_hashes_.size() * sizeof(uint32_t);
-        return;
+bool ValidationCache::Contains(const hash_util::Hash128 &hash) {
+    auto guard = ReadLock();
+    if (good_shader_hashes_.Contains(hash)) {
+        return true;
     }
+    PendingShard &shard = GetPendingShard(hash);
+    std::lock_guard<std::mutex> shard_guard(shard.lock);
+    return shard.hashes.find(hash) != shard.hashes.end();
+}
 
-    if (*pDataSize < header_size) {
-        *pDataSize = 0;
-        return;  // Too small for even the header!
+void ValidationCache::Insert(const hash_util::Hash128 &hash) {
+    auto guard = ReadLock();
+    // Also marks it as used
+    if (good_shader_hashes_.Contains(hash)) {
+        return;
     }
+    PendingShard &shard = GetPendingShard(hash);
+    std::lock_guard<std::mutex> shard_guard(shard.lock);
+    shard.hashes.insert(hash);
+}
 
-    uint32_t *out = (uint32_t *)pData;
-    size_t actual_size = header_size;
-
-    // Write the header
-    *out++ = header_size;
-    *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-    GetUUID(reinterpret_cast<uint8_t *>(out));
-    out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
-
-    {
-        auto guard = ReadLock();
-        for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actual_size < *pDataSize;
-             it++, out++, actual_size += sizeof(uint32_t)) {
-            *out = *it;
+void ValidationCache::FlushPending() {
+    for (PendingShard &shard : pending_) {
+        std::lock_guard<std::mutex> shard_guard(shard.lock);
+        for (const hash_util::Hash128 &hash : shard.hashes) {
+            good_shader_hashes_.Insert(hash);
         }
+        shard.hashes.clear();
     }
+}
 
-    *pDataSize = actual_size;
+void ValidationCache::Write(size_t *pDataSize, void *pData) {
+    auto guard = WriteLock();
+    FlushPending();
+    if (!pData) {
+        *pDataSize = good_shader_hashes_.WriteSize(header_.size());
+        return;
+    }
+    *pDataSize = good_shader_hashes_.Write(header_, pData, *pDataSize);
 }
 
 void ValidationCache::Merge(ValidationCache const *other) {
@@ -108,8 +119,26 @@ void ValidationCache::Merge(ValidationCache const *other) {
     }
     auto other_guard = other->ReadLock();
     auto guard = WriteLock();
-    good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
-    for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
+    FlushPending();
+    good_shader_hashes_.Merge(other->good_shader_hashes_);
+    // The other cache can't flush its own pending hashes while only holding the lock for reading
+    for (const PendingShard &other_shard : other->pending_) {
+        std::lock_guard<std::mutex> shard_guard(other_shard.lock);
+        for (const hash_util::Hash128 &hash : other_shard.hashes) {
+            good_shader_hashes_.Insert(hash);
+        }
+    }
+}
+
+bool ValidationCache::LoadFile(const std::string &path) {
+    auto guard = WriteLock();
+    return good_shader_hashes_.LoadFile(path, header_);
+}
+
+bool ValidationCache::SaveFile(const std::string &path) {
+    auto guard = WriteLock();
+    FlushPending();
+    return good_shader_hashes_.SaveFile(path, header_);
 }
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
@@ -127,6 +156,28 @@ spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
     return SPV_ENV_VULKAN_1_0;
 }
 
+spv_const_context GetThreadSpirvContext(spv_target_env target_env) {
+    struct ThreadContexts {
+        ~ThreadContexts() {
+            for (const auto &[env, context] : contexts) {
+                spvContextDestroy(context);
+            }
+        }
+        // A thread only sees the environments of the devices it is used with, usually one
+        std::vector<std::pair<spv_target_env, spv_context>> contexts;
+    };
+    thread_local ThreadContexts thread_contexts;
+
+    for (const auto &[env, context] : thread_contexts.contexts) {
+        if (env == target_env) {
+            return context;
+        }
+    }
+    spv_context context = spvContextCreate(target_env);
+    thread_contexts.contexts.emplace_back(target_env, context);
+    return context;
+}
+
 // Some Vulkan extensions/features are just all done in spirv-val behind optional settings
 void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
                             spvtools::ValidatorOptions &out_options, uint32_t *out_hash) {
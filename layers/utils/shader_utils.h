@@ -23,7 +23,11 @@
 #include <vulkan/vulkan_core.h>
 #include "utils/vk_layer_utils.h"
 #include "containers/custom_containers.h"
+#include "utils/hash_util.h"
+#include "utils/spirv_hash_set.h"
 
+#include <array>
+#include <mutex>
 #include <spirv-tools/libspirv.hpp>
 
 struct DeviceFeatures;
@@ -69,10 +73,13 @@ inline ShaderObjectStage VkShaderStageToShaderObjectStage(VkShaderStageFlagBits
     return ShaderObjectStage::LAST;
 }
 
+// VK_EXT_validation_cache, the hashes of the shaders that passed spirv-val. The data is the header the spec requires
+// followed by a spirv::HashSet, so a large cache is loaded without decoding its entries.
 class ValidationCache {
   public:
-    static VkValidationCacheEXT Create(VkValidationCacheCreateInfoEXT const *pCreateInfo, uint32_t spirv_val_option_hash) {
-        auto cache = new ValidationCache(spirv_val_option_hash);
+    static VkValidationCacheEXT Create(VkValidationCacheCreateInfoEXT const *pCreateInfo, uint32_t spirv_val_option_hash,
+                                       size_t max_entries) {
+        auto cache = new ValidationCache(spirv_val_option_hash, max_entries);
         cache->Load(pCreateInfo);
         return VkValidationCacheEXT(cache);
     }
@@ -81,37 +88,52 @@ class ValidationCache {
     void Write(size_t *pDataSize, void *pData);
     void Merge(ValidationCache const *other);
 
-    bool Contains(uint32_t hash) {
-        auto guard = ReadLock();
-        return good_shader_hashes_.count(hash) != 0;
-    }
+    // The cache file of the layer is memory mapped instead of read
+    bool LoadFile(const std::string &path);
+    bool SaveFile(const std::string &path);
 
-    void Insert(uint32_t hash) {
-        auto guard = WriteLock();
-        good_shader_hashes_.insert(hash);
-    }
+    // Both only take the lock for reading, so threads creating shader modules don't wait on each other
+    bool Contains(const hash_util::Hash128 &hash);
+    void Insert(const hash_util::Hash128 &hash);
 
   private:
-    ValidationCache(uint32_t spirv_val_option_hash) : spirv_val_option_hash_(spirv_val_option_hash) {}
+    ValidationCache(uint32_t spirv_val_option_hash, size_t max_entries);
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
     void GetUUID(uint8_t *uuid);
+    // Moves the pending hashes into good_shader_hashes_, the lock is held for writing
+    void FlushPending();
 
     // Can hit cases where error appear/disappear if spirv-val settings are adjusted
     // see https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/8031
     uint32_t spirv_val_option_hash_;
+    // 4 bytes for header size + 4 bytes for version number + UUID, data starting with anything else is ignored
+    std::vector<uint8_t> header_;
 
     // hashes of shaders that have passed validation before, and can be skipped.
     // we don't store negative results, as we would have to also store what was
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
-    vvl::unordered_set<uint32_t> good_shader_hashes_;
+    spirv::HashSet good_shader_hashes_;
     mutable std::shared_mutex lock_;
+
+    // Hashes inserted since the last write, split by hash so inserting only locks one shard
+    struct alignas(vku::concurrent::get_hardware_destructive_interference_size()) PendingShard {
+        mutable std::mutex lock;
+        vvl::unordered_set<hash_util::Hash128, hash_util::Hash128::Hasher> hashes;
+    };
+    static constexpr size_t kPendingShardCount = 16;
+    PendingShard &GetPendingShard(const hash_util::Hash128 &hash) { return pending_[hash.high % kPendingShardCount]; }
+    std::array<PendingShard, kPendingShardCount> pending_;
 };
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4);
 
+// Context of the calling thread for target_env. Creating a context sets up the grammar tables, so each thread keeps the ones
+// it created until it exits instead of creating one for every module it validates.
+spv_const_context GetThreadSpirvContext(spv_target_env target_env);
+
 void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
                             spvtools::ValidatorOptions &out_options, uint32_t *out_hash);
 
@@ -0,0 +1,184 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "spirv_analysis_cache.h"
+
+#include <cstring>
+#include <mutex>
+
+#include "utils/hash_util.h"
+
+namespace spirv {
+
+// File layout, everything is a uint32_t:
+//   magic, version, result count
+//   for each result:
+//     key (4 words, least significant first), entry point count
+//     for each entry point: emit_vertex_geometry, id count, ids
+//     argument count, (parameter, argument) pairs
+static constexpr uint32_t kMagic = 0x53564141;  // "AAVS"
+
+namespace {
+class Reader {
+  public:
+    explicit Reader(const std::vector<char> &data) : data_(data) {}
+
+    bool Read(uint32_t &value) {
+        if (data_.size() - offset_ < sizeof(uint32_t)) {
+            return false;
+        }
+        std::memcpy(&value, data_.data() + offset_, sizeof(uint32_t));
+        offset_ += sizeof(uint32_t);
+        return true;
+    }
+
+    // Guards the resize() calls against a corrupted count
+    bool HasWords(uint64_t count) const { return (data_.size() - offset_) / sizeof(uint32_t) >= count; }
+
+  private:
+    const std::vector<char> &data_;
+    size_t offset_ = 0;
+};
+
+void Append(std::vector<char> &out, uint32_t value) {
+    const size_t offset = out.size();
+    out.resize(offset + sizeof(uint32_t));
+    std::memcpy(out.data() + offset, &value, sizeof(uint32_t));
+}
+
+size_t WordCount(const AnalysisResult &result) {
+    size_t words = 5 + 1 + result.function_arguments.size() * 2;
+    for (const auto &entry_point : result.entry_points) {
+        words += 2 + entry_point.accessible_ids.size();
+    }
+    return words;
+}
+}  // namespace
+
+std::shared_ptr<const AnalysisResult> AnalysisCache::Find(const hash_util::Hash128 &key) const {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    auto it = results_.find(key);
+    return it != results_.end() ? it->second : nullptr;
+}
+
+void AnalysisCache::Insert(const hash_util::Hash128 &key, std::shared_ptr<const AnalysisResult> result) {
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    results_.emplace(key, std::move(result));
+}
+
+size_t AnalysisCache::Size() const {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    return results_.size();
+}
+
+void AnalysisCache::Load(const std::vector<char> &data) {
+    Reader reader(data);
+    uint32_t magic = 0, version = 0, result_count = 0;
+    if (!reader.Read(magic) || magic != kMagic || !reader.Read(version) || version != kVersion || !reader.Read(result_count)) {
+        return;
+    }
+
+    // Only keep what was read to the end, a file cut short by a crash loses its last result
+    std::vector<std::pair<hash_util::Hash128, std::shared_ptr<const AnalysisResult>>> loaded;
+    auto read_result = [&reader, &loaded]() {
+        uint32_t key_words[4] = {};
+        uint32_t entry_point_count = 0;
+        if (!reader.Read(key_words[0]) || !reader.Read(key_words[1]) || !reader.Read(key_words[2]) ||
+            !reader.Read(key_words[3]) || !reader.Read(entry_point_count) || !reader.HasWords(uint64_t(entry_point_count) * 2)) {
+            return false;
+        }
+        auto result = std::make_shared<AnalysisResult>();
+        result->entry_points.resize(entry_point_count);
+        for (auto &entry_point : result->entry_points) {
+            uint32_t emit_vertex_geometry = 0, id_count = 0;
+            if (!reader.Read(emit_vertex_geometry) || !reader.Read(id_count) || !reader.HasWords(id_count)) {
+                return false;
+            }
+            entry_point.emit_vertex_geometry = emit_vertex_geometry != 0;
+            entry_point.accessible_ids.resize(id_count);
+            for (uint32_t &id : entry_point.accessible_ids) {
+                reader.Read(id);
+            }
+        }
+        uint32_t argument_count = 0;
+        if (!reader.Read(argument_count) || !reader.HasWords(uint64_t(argument_count) * 2)) {
+            return false;
+        }
+        result->function_arguments.resize(argument_count);
+        for (auto &argument : result->function_arguments) {
+            reader.Read(argument.first);
+            reader.Read(argument.second);
+        }
+        const hash_util::Hash128 key{(uint64_t(key_words[1]) << 32) | key_words[0], (uint64_t(key_words[3]) << 32) | key_words[2]};
+        loaded.emplace_back(key, std::move(result));
+        return true;
+    };
+    for (uint32_t i = 0; i < result_count; ++i) {
+        if (!read_result()) {
+            break;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    for (auto &[key, result] : loaded) {
+        results_.emplace(key, std::move(result));
+    }
+}
+
+std::vector<char> AnalysisCache::Write() const {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+
+    // Pick what fits first, the header holds the count
+    std::vector<std::pair<hash_util::Hash128, const AnalysisResult *>> written;
+    size_t total_words = 3;
+    for (const auto &[key, result] : results_) {
+        const size_t words = WordCount(*result);
+        if ((total_words + words) * sizeof(uint32_t) > kMaxFileSize) {
+            continue;
+        }
+        total_words += words;
+        written.emplace_back(key, result.get());
+    }
+
+    std::vector<char> out;
+    out.reserve(total_words * sizeof(uint32_t));
+    Append(out, kMagic);
+    Append(out, kVersion);
+    Append(out, static_cast<uint32_t>(written.size()));
+    for (const auto &[key, result] : written) {
+        Append(out, static_cast<uint32_t>(key.low));
+        Append(out, static_cast<uint32_t>(key.low >> 32));
+        Append(out, static_cast<uint32_t>(key.high));
+        Append(out, static_cast<uint32_t>(key.high >> 32));
+        Append(out, static_cast<uint32_t>(result->entry_points.size()));
+        for (const auto &entry_point : result->entry_points) {
+            Append(out, entry_point.emit_vertex_geometry ? 1u : 0u);
+            Append(out, static_cast<uint32_t>(entry_point.accessible_ids.size()));
+            for (uint32_t id : entry_point.accessible_ids) {
+                Append(out, id);
+            }
+        }
+        Append(out, static_cast<uint32_t>(result->function_arguments.size()));
+        for (const auto &[parameter, argument] : result->function_arguments) {
+            Append(out, parameter);
+            Append(out, argument);
+        }
+    }
+    return out;
+}
+
+}  // namespace spirv
@@ -0,0 +1,67 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "utils/hash_util.h"
+
+namespace spirv {
+
+// Results of the module wide walks done while building spirv::Module::StaticData.
+// They only depend on the SPIR-V words, so they can be saved to disk and reused the next time the application runs.
+struct AnalysisResult {
+    struct EntryPoint {
+        bool emit_vertex_geometry = false;
+        // Every id reachable from the static call tree of the entry point
+        std::vector<uint32_t> accessible_ids;
+    };
+    // Same order as the OpEntryPoint instructions in the module
+    std::vector<EntryPoint> entry_points;
+    // <OpFunctionParameter id, argument id> pairs, one for each argument of each OpFunctionCall
+    std::vector<std::pair<uint32_t, uint32_t>> function_arguments;
+};
+
+// Thread safe, keyed by the hash of the SPIR-V words (spirv::Module::hash_)
+class AnalysisCache {
+  public:
+    // Bump whenever the file layout or what goes into AnalysisResult changes, older files are then ignored
+    static constexpr uint32_t kVersion = 2;
+    // Results are not written past this, so a cache in the temp directory can't grow forever
+    static constexpr size_t kMaxFileSize = 64 * 1024 * 1024;
+
+    std::shared_ptr<const AnalysisResult> Find(const hash_util::Hash128 &key) const;
+    void Insert(const hash_util::Hash128 &key, std::shared_ptr<const AnalysisResult> result);
+    size_t Size() const;
+
+    // Data that is truncated, corrupt or written by another version is ignored
+    void Load(const std::vector<char> &data);
+    std::vector<char> Write() const;
+
+  private:
+    mutable std::shared_mutex lock_;
+    vvl::unordered_map<hash_util::Hash128, std::shared_ptr<const AnalysisResult>, hash_util::Hash128::Hasher> results_;
+};
+
+}  // namespace spirv
@@ -0,0 +1,280 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "spirv_blob_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "utils/cache_file.h"
+
+namespace spirv {
+
+// File layout:
+//   magic, version, tag size (uint32_t), tag bytes, entry count (uint32_t)
+//   for each entry:
+//     key, last use, word count, compressed size (uint32_t), compressed bytes
+static constexpr uint32_t kMagic = 0x53424356;  // "VCBS"
+
+namespace {
+class Reader {
+  public:
+    explicit Reader(const std::vector<char> &data) : data_(data) {}
+
+    bool Read(uint32_t &value) {
+        if (data_.size() - offset_ < sizeof(uint32_t)) {
+            return false;
+        }
+        std::memcpy(&value, data_.data() + offset_, sizeof(uint32_t));
+        offset_ += sizeof(uint32_t);
+        return true;
+    }
+
+    bool ReadBytes(size_t size, const char *&out_bytes) {
+        if (data_.size() - offset_ < size) {
+            return false;
+        }
+        out_bytes = data_.data() + offset_;
+        offset_ += size;
+        return true;
+    }
+
+  private:
+    const std::vector<char> &data_;
+    size_t offset_ = 0;
+};
+
+void Append(std::vector<char> &out, uint32_t value) {
+    const size_t offset = out.size();
+    out.resize(offset + sizeof(uint32_t));
+    std::memcpy(out.data() + offset, &value, sizeof(uint32_t));
+}
+
+void AppendBytes(std::vector<char> &out, const void *bytes, size_t size) {
+    const size_t offset = out.size();
+    out.resize(offset + size);
+    std::memcpy(out.data() + offset, bytes, size);
+}
+
+bool ReadFile(const std::string &path, std::vector<char> &out_data) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::copy(std::istreambuf_iterator<char>(file), {}, std::back_inserter(out_data));
+    return true;
+}
+
+constexpr size_t kEntryHeaderSize = 4 * sizeof(uint32_t);
+}  // namespace
+
+void BlobCache::Compress(const std::vector<uint32_t> &words, std::vector<uint8_t> &out_bytes) {
+    out_bytes.clear();
+    out_bytes.reserve(words.size() * 2);
+    for (uint32_t word : words) {
+        while (word >= 0x80) {
+            out_bytes.emplace_back(static_cast<uint8_t>(word | 0x80));
+            word >>= 7;
+        }
+        out_bytes.emplace_back(static_cast<uint8_t>(word));
+    }
+}
+
+bool BlobCache::Decompress(const std::vector<uint8_t> &bytes, uint32_t word_count, std::vector<uint32_t> &out_words) {
+    out_words.clear();
+    out_words.reserve(word_count);
+    uint32_t word = 0;
+    uint32_t shift = 0;
+    for (const uint8_t byte : bytes) {
+        if (shift > 28) {
+            return false;
+        }
+        word |= uint32_t(byte & 0x7f) << shift;
+        if (byte & 0x80) {
+            shift += 7;
+            continue;
+        }
+        if (out_words.size() == word_count) {
+            return false;
+        }
+        out_words.emplace_back(word);
+        word = 0;
+        shift = 0;
+    }
+    return shift == 0 && out_words.size() == word_count;
+}
+
+void BlobCache::Add(uint32_t key, const std::vector<uint32_t> &words) {
+    Entry entry;
+    entry.word_count = static_cast<uint32_t>(words.size());
+    std::vector<uint8_t> compressed;
+    Compress(words, compressed);
+    entry.compressed = std::make_shared<const std::vector<uint8_t>>(std::move(compressed));
+
+    std::lock_guard<std::mutex> guard(lock_);
+    entry.last_use = current_use_;
+    entries_.insert_or_assign(key, std::move(entry));
+}
+
+bool BlobCache::Get(uint32_t key, std::vector<uint32_t> &out_words) {
+    std::shared_ptr<const std::vector<uint8_t>> compressed;
+    uint32_t word_count = 0;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return false;
+        }
+        compressed = it->second.compressed;
+        word_count = it->second.word_count;
+        it->second.last_use = current_use_;
+    }
+
+    // Decompressed without the lock, threads creating pipelines at the same time don't wait on each other
+    if (!Decompress(*compressed, word_count, out_words)) {
+        // Loading only checks the blob sizes, a corrupted file can still get here
+        std::lock_guard<std::mutex> guard(lock_);
+        auto it = entries_.find(key);
+        if (it != entries_.end() && it->second.compressed == compressed) {
+            entries_.erase(it);
+        }
+        return false;
+    }
+    return true;
+}
+
+bool BlobCache::IsEmpty() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return entries_.empty();
+}
+
+size_t BlobCache::Size() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return entries_.size();
+}
+
+void BlobCache::Load(const std::vector<char> &data, const std::vector<char> &tag) {
+    std::lock_guard<std::mutex> guard(lock_);
+    LoadLocked(data, tag);
+}
+
+void BlobCache::LoadLocked(const std::vector<char> &data, const std::vector<char> &tag) {
+    Reader reader(data);
+    uint32_t magic = 0, version = 0, tag_size = 0, entry_count = 0;
+    const char *file_tag = nullptr;
+    if (!reader.Read(magic) || magic != kMagic || !reader.Read(version) || version != kVersion || !reader.Read(tag_size) ||
+        tag_size != tag.size() || !reader.ReadBytes(tag_size, file_tag) || !std::equal(tag.begin(), tag.end(), file_tag) ||
+        !reader.Read(entry_count)) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        uint32_t key = 0, last_use = 0, word_count = 0, compressed_size = 0;
+        const char *compressed = nullptr;
+        // A file cut short by a crash only loses its last entries
+        if (!reader.Read(key) || !reader.Read(last_use) || !reader.Read(word_count) || !reader.Read(compressed_size) ||
+            !reader.ReadBytes(compressed_size, compressed)) {
+            break;
+        }
+        // Each word takes 1 to 5 bytes
+        if (compressed_size < word_count || compressed_size > uint64_t(word_count) * 5) {
+            continue;
+        }
+        if (last_use != UINT32_MAX) {
+            current_use_ = std::max(current_use_, last_use + 1);
+        }
+
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            // Another process might have used it more recently than this one
+            it->second.last_use = std::max(it->second.last_use, last_use);
+            continue;
+        }
+        Entry &entry = entries_[key];
+        entry.word_count = word_count;
+        entry.last_use = last_use;
+        entry.compressed = std::make_shared<const std::vector<uint8_t>>(compressed, compressed + compressed_size);
+    }
+}
+
+std::vector<char> BlobCache::Write(const std::vector<char> &tag) const {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    // Most recently used first, what does not fit under the cap is dropped
+    std::vector<std::pair<uint32_t, const Entry *>> sorted;
+    sorted.reserve(entries_.size());
+    for (const auto &[key, entry] : entries_) {
+        sorted.emplace_back(key, &entry);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) {
+        return a.second->last_use != b.second->last_use ? a.second->last_use > b.second->last_use : a.first < b.first;
+    });
+
+    size_t total_size = 4 * sizeof(uint32_t) + tag.size();
+    size_t written_count = 0;
+    for (const auto &[key, entry] : sorted) {
+        const size_t entry_size = kEntryHeaderSize + entry->compressed->size();
+        if (total_size + entry_size > max_file_size_) {
+            break;
+        }
+        total_size += entry_size;
+        ++written_count;
+    }
+
+    std::vector<char> out;
+    out.reserve(total_size);
+    Append(out, kMagic);
+    Append(out, kVersion);
+    Append(out, static_cast<uint32_t>(tag.size()));
+    AppendBytes(out, tag.data(), tag.size());
+    Append(out, static_cast<uint32_t>(written_count));
+    for (size_t i = 0; i < written_count; ++i) {
+        const auto &[key, entry] = sorted[i];
+        Append(out, key);
+        Append(out, entry->last_use);
+        Append(out, entry->word_count);
+        Append(out, static_cast<uint32_t>(entry->compressed->size()));
+        AppendBytes(out, entry->compressed->data(), entry->compressed->size());
+    }
+    return out;
+}
+
+bool BlobCache::LoadFile(const std::string &path, const std::vector<char> &tag) {
+    std::vector<char> data;
+    if (!ReadFile(path, data)) {
+        return false;
+    }
+    Load(data, tag);
+    return true;
+}
+
+bool BlobCache::SaveFile(const std::string &path, const std::vector<char> &tag) {
+    return vvl::SaveCacheFile(path, [this, &path, &tag](const vvl::CacheFileWriter &write) {
+        // Pick up what other processes saved since this one loaded the file
+        std::vector<char> data;
+        if (ReadFile(path, data)) {
+            std::lock_guard<std::mutex> guard(lock_);
+            LoadLocked(data, tag);
+        }
+        data = Write(tag);
+        return write(data.data(), data.size());
+    });
+}
+
+}  // namespace spirv
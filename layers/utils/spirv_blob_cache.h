@@ -0,0 +1,85 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace spirv {
+
+// SPIR-V binaries keyed by a 32-bit hash, kept compressed both in memory and in the cache file.
+//
+// A blob is only decompressed when it is asked for, so loading a large cache file costs one read and no decoding. Every
+// entry remembers the run it was last used in; when the cache is written, the least recently used entries are dropped first
+// to stay under the size cap.
+//
+// Several processes can share one cache file (like test runners launched in parallel). SaveFile() merges what the other
+// processes saved in the meantime and replaces the file, see vvl::SaveCacheFile.
+//
+// Thread safe.
+class BlobCache {
+  public:
+    // Bump whenever the file layout or the compression changes, older files are then ignored
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kDefaultMaxFileSize = 128 * 1024 * 1024;
+
+    explicit BlobCache(size_t max_file_size = kDefaultMaxFileSize) : max_file_size_(max_file_size) {}
+
+    void Add(uint32_t key, const std::vector<uint32_t> &words);
+    // Decompresses the SPIR-V into out_words, returns false if the key is not in the cache
+    bool Get(uint32_t key, std::vector<uint32_t> &out_words);
+    bool IsEmpty() const;
+    size_t Size() const;
+
+    // The tag identifies what produced the SPIR-V (settings, versions...), data written with another tag is ignored.
+    // Load() adds the entries of data which are not in the cache yet, data that is truncated or corrupt is ignored past the
+    // last good entry.
+    void Load(const std::vector<char> &data, const std::vector<char> &tag);
+    std::vector<char> Write(const std::vector<char> &tag) const;
+
+    bool LoadFile(const std::string &path, const std::vector<char> &tag);
+    bool SaveFile(const std::string &path, const std::vector<char> &tag);
+
+    // SPIR-V is mostly small ids and literals, so each word is stored as a little endian base 128 varint
+    static void Compress(const std::vector<uint32_t> &words, std::vector<uint8_t> &out_bytes);
+    static bool Decompress(const std::vector<uint8_t> &bytes, uint32_t word_count, std::vector<uint32_t> &out_words);
+
+  private:
+    struct Entry {
+        uint32_t word_count = 0;
+        // Run counter value of the last Add() or Get(), files written by later runs have larger values
+        uint32_t last_use = 0;
+        // Shared so Get() can decompress without holding the lock
+        std::shared_ptr<const std::vector<uint8_t>> compressed;
+    };
+
+    void LoadLocked(const std::vector<char> &data, const std::vector<char> &tag);
+
+    const size_t max_file_size_;
+    mutable std::mutex lock_;
+    vvl::unordered_map<uint32_t, Entry> entries_;
+    // One more than the largest last_use loaded so far
+    uint32_t current_use_ = 1;
+};
+
+}  // namespace spirv
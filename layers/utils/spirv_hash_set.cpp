@@ -0,0 +1,301 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "spirv_hash_set.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "utils/cache_file.h"
+
+namespace spirv {
+
+static constexpr uint32_t kMagic = 0x53485653;  // "SVHS"
+
+namespace {
+// magic, version, run of the writer, entry count
+constexpr size_t kHeaderSize = 4 * sizeof(uint32_t);
+constexpr size_t kHashSize = 2 * sizeof(uint64_t);
+constexpr size_t kEntrySize = kHashSize + sizeof(uint32_t);
+
+bool Less(const hash_util::Hash128 &a, const hash_util::Hash128 &b) { return a.low != b.low ? a.low < b.low : a.high < b.high; }
+
+hash_util::Hash128 ReadHash(const uint8_t *bytes) {
+    hash_util::Hash128 hash;
+    std::memcpy(&hash.low, bytes, sizeof(uint64_t));
+    std::memcpy(&hash.high, bytes + sizeof(uint64_t), sizeof(uint64_t));
+    return hash;
+}
+
+uint8_t *WriteValue(uint8_t *out, const void *value, size_t size) {
+    std::memcpy(out, value, size);
+    return out + size;
+}
+}  // namespace
+
+hash_util::Hash128 HashSet::BaseHash(size_t index) const { return ReadHash(base_entries_ + index * kHashSize); }
+
+uint32_t HashSet::BaseLastUse(size_t index) const {
+    uint32_t last_use;
+    std::memcpy(&last_use, base_entries_ + base_count_ * kHashSize + index * sizeof(uint32_t), sizeof(uint32_t));
+    return last_use;
+}
+
+bool HashSet::FindInBase(const hash_util::Hash128 &hash, size_t &out_index) const {
+    size_t first = 0;
+    size_t count = base_count_;
+    while (count > 0) {
+        const size_t half_count = count / 2;
+        if (Less(BaseHash(first + half_count), hash)) {
+            first += half_count + 1;
+            count -= half_count + 1;
+        } else {
+            count = half_count;
+        }
+    }
+    if (first < base_count_ && BaseHash(first) == hash) {
+        out_index = first;
+        return true;
+    }
+    return false;
+}
+
+bool HashSet::Contains(const hash_util::Hash128 &hash) const {
+    size_t index;
+    if (FindInBase(hash, index)) {
+        base_used_[index / 32].fetch_or(1u << (index % 32), std::memory_order_relaxed);
+        return true;
+    }
+    return added_.find(hash) != added_.end();
+}
+
+void HashSet::Insert(const hash_util::Hash128 &hash) {
+    size_t index;
+    if (FindInBase(hash, index)) {
+        base_used_[index / 32].fetch_or(1u << (index % 32), std::memory_order_relaxed);
+        return;
+    }
+    added_.insert_or_assign(hash, current_use_);
+}
+
+void HashSet::AddEntry(const hash_util::Hash128 &hash, uint32_t last_use) {
+    size_t index;
+    if (FindInBase(hash, index)) {
+        if (last_use > BaseLastUse(index)) {
+            uint32_t &base_last_use = base_last_uses_[index];
+            base_last_use = std::max(base_last_use, last_use);
+        }
+        return;
+    }
+    auto [it, inserted] = added_.emplace(hash, last_use);
+    if (!inserted) {
+        it->second = std::max(it->second, last_use);
+    }
+}
+
+void HashSet::AddEntries(const uint8_t *entries, uint32_t count) {
+    added_.reserve(added_.size() + count);
+    const uint8_t *last_uses = entries + size_t(count) * kHashSize;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t last_use;
+        std::memcpy(&last_use, last_uses + i * sizeof(uint32_t), sizeof(uint32_t));
+        AddEntry(ReadHash(entries + i * kHashSize), last_use);
+    }
+}
+
+void HashSet::Merge(const HashSet &other) {
+    if (&other == this) {
+        return;
+    }
+    // What the other set used in its current run counts as used in this one
+    for (size_t i = 0; i < other.base_count_; ++i) {
+        const bool used = (other.base_used_[i / 32].load(std::memory_order_relaxed) >> (i % 32)) & 1;
+        AddEntry(other.BaseHash(i), used ? current_use_ : other.BaseLastUse(i));
+    }
+    for (const auto &[hash, last_use] : other.added_) {
+        AddEntry(hash, last_use == other.current_use_ ? current_use_ : last_use);
+    }
+}
+
+void HashSet::SetBase(const uint8_t *entries, uint32_t count) {
+    base_entries_ = entries;
+    base_count_ = count;
+    const size_t word_count = (size_t(count) + 31) / 32;
+    base_used_ = std::make_unique<std::atomic<uint32_t>[]>(word_count);
+    for (size_t i = 0; i < word_count; ++i) {
+        base_used_[i].store(0, std::memory_order_relaxed);
+    }
+    base_last_uses_.clear();
+}
+
+bool HashSet::ParseHeader(const uint8_t *data, size_t size, const std::vector<uint8_t> &prefix, uint32_t &out_run,
+                          uint32_t &out_count) {
+    if (!data || size < prefix.size() + kHeaderSize ||
+        (!prefix.empty() && std::memcmp(data, prefix.data(), prefix.size()) != 0)) {
+        return false;
+    }
+    uint32_t header[4];
+    std::memcpy(header, data + prefix.size(), kHeaderSize);
+    if (header[0] != kMagic || header[1] != kVersion) {
+        return false;
+    }
+    // Data cut short is ignored as a whole, the last uses are stored after all the hashes
+    if (uint64_t(size - prefix.size() - kHeaderSize) < uint64_t(header[3]) * kEntrySize) {
+        return false;
+    }
+    out_run = header[2];
+    out_count = header[3];
+    return true;
+}
+
+bool HashSet::Load(const void *data, size_t size, const std::vector<uint8_t> &prefix) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    uint32_t run = 0;
+    uint32_t count = 0;
+    if (!ParseHeader(bytes, size, prefix, run, count)) {
+        return false;
+    }
+    current_use_ = std::max(current_use_, run + 1);
+
+    const uint8_t *entries = bytes + prefix.size() + kHeaderSize;
+    if (Size() == 0) {
+        // A copy of the whole block, nothing is decoded
+        base_copy_.assign(entries, entries + size_t(count) * kEntrySize);
+        base_file_.Close();
+        SetBase(base_copy_.data(), count);
+    } else {
+        AddEntries(entries, count);
+    }
+    return true;
+}
+
+bool HashSet::LoadFile(const std::string &path, const std::vector<uint8_t> &prefix) {
+    vvl::MappedFile file;
+    if (!file.Open(path)) {
+        return false;
+    }
+    uint32_t run = 0;
+    uint32_t count = 0;
+    if (!ParseHeader(file.Data(), file.Size(), prefix, run, count)) {
+        return false;
+    }
+    current_use_ = std::max(current_use_, run + 1);
+
+    const size_t entries_offset = prefix.size() + kHeaderSize;
+    if (Size() == 0) {
+        base_copy_.clear();
+        base_file_ = std::move(file);
+        SetBase(base_file_.Data() + entries_offset, count);
+    } else {
+        AddEntries(file.Data() + entries_offset, count);
+    }
+    return true;
+}
+
+std::vector<HashSet::Entry> HashSet::SortedEntries(size_t max_count) const {
+    std::vector<Entry> added;
+    added.reserve(added_.size());
+    for (const auto &[hash, last_use] : added_) {
+        added.emplace_back(Entry{hash, last_use});
+    }
+    std::sort(added.begin(), added.end(), [](const Entry &a, const Entry &b) { return Less(a.hash, b.hash); });
+
+    // Both lists are sorted and never hold the same hash, merge them
+    std::vector<Entry> entries;
+    entries.reserve(base_count_ + added.size());
+    size_t added_i = 0;
+    for (size_t base_i = 0; base_i < base_count_; ++base_i) {
+        const hash_util::Hash128 hash = BaseHash(base_i);
+        for (; added_i < added.size() && Less(added[added_i].hash, hash); ++added_i) {
+            entries.emplace_back(added[added_i]);
+        }
+        uint32_t last_use = BaseLastUse(base_i);
+        if ((base_used_[base_i / 32].load(std::memory_order_relaxed) >> (base_i % 32)) & 1) {
+            last_use = current_use_;
+        } else if (auto it = base_last_uses_.find(base_i); it != base_last_uses_.end()) {
+            last_use = std::max(last_use, it->second);
+        }
+        entries.emplace_back(Entry{hash, last_use});
+    }
+    entries.insert(entries.end(), added.begin() + added_i, added.end());
+
+    if (entries.size() > max_count) {
+        const auto by_recent_use = [](const Entry &a, const Entry &b) { return a.last_use > b.last_use; };
+        std::nth_element(entries.begin(), entries.begin() + max_count, entries.end(), by_recent_use);
+        entries.resize(max_count);
+        std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return Less(a.hash, b.hash); });
+    }
+    return entries;
+}
+
+size_t HashSet::WriteSize(size_t prefix_size) const {
+    return prefix_size + kHeaderSize + std::min(Size(), max_entries_) * kEntrySize;
+}
+
+size_t HashSet::Write(const std::vector<uint8_t> &prefix, void *out, size_t out_size) const {
+    if (out_size < prefix.size() + kHeaderSize) {
+        return 0;
+    }
+    const size_t fitting_count = (out_size - prefix.size() - kHeaderSize) / kEntrySize;
+    const std::vector<Entry> entries = SortedEntries(std::min(fitting_count, max_entries_));
+
+    const uint32_t header[4] = {kMagic, kVersion, current_use_, static_cast<uint32_t>(entries.size())};
+    uint8_t *bytes = WriteValue(static_cast<uint8_t *>(out), prefix.data(), prefix.size());
+    bytes = WriteValue(bytes, header, kHeaderSize);
+    for (const Entry &entry : entries) {
+        bytes = WriteValue(bytes, &entry.hash.low, sizeof(uint64_t));
+        bytes = WriteValue(bytes, &entry.hash.high, sizeof(uint64_t));
+    }
+    for (const Entry &entry : entries) {
+        bytes = WriteValue(bytes, &entry.last_use, sizeof(uint32_t));
+    }
+    return static_cast<size_t>(bytes - static_cast<uint8_t *>(out));
+}
+
+bool HashSet::SaveFile(const std::string &path, const std::vector<uint8_t> &prefix) {
+    return vvl::SaveCacheFile(path, [this, &path, &prefix](const vvl::CacheFileWriter &write) {
+        {
+            // Pick up what other processes saved since this one loaded the file, unless it is still the file in use
+            vvl::MappedFile file;
+            uint32_t run = 0;
+            uint32_t count = 0;
+            if (file.Open(path) && ParseHeader(file.Data(), file.Size(), prefix, run, count)) {
+                const bool unchanged = base_file_.IsOpen() && base_file_.Size() == file.Size() &&
+                                       std::memcmp(base_file_.Data(), file.Data(), file.Size()) == 0;
+                if (!unchanged) {
+                    current_use_ = std::max(current_use_, run + 1);
+                    AddEntries(file.Data() + prefix.size() + kHeaderSize, count);
+                }
+            }
+        }
+
+        std::vector<uint8_t> data(WriteSize(prefix.size()));
+        data.resize(Write(prefix, data.data(), data.size()));
+
+        // Everything is in data now, use it as the base so the mapping of the old file is released before replacing it
+        uint32_t count = 0;
+        std::memcpy(&count, data.data() + prefix.size() + 3 * sizeof(uint32_t), sizeof(uint32_t));
+        base_copy_ = std::move(data);
+        base_file_.Close();
+        added_.clear();
+        SetBase(base_copy_.data() + prefix.size() + kHeaderSize, count);
+
+        return write(base_copy_.data(), base_copy_.size());
+    });
+}
+
+}  // namespace spirv
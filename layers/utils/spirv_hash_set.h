@@ -0,0 +1,105 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "utils/hash_util.h"
+#include "utils/mapped_file.h"
+
+namespace spirv {
+
+// Set of SPIR-V hashes (the modules that passed spirv-val) which can be saved and loaded without touching every entry.
+//
+// The data is a small header followed by the hashes sorted, then the run each hash was last used in. Loaded data is used in
+// place (a file is memory mapped) and looked up with a binary search, so loading a cache with millions of entries costs
+// the same as an empty one. Hashes added afterwards live in a regular hash set until the next Write().
+//
+// When written, the least recently used entries are dropped first to stay under max_entries.
+//
+// Contains() can be called from several threads at once, everything else needs exclusive access.
+class HashSet {
+  public:
+    // Bump whenever the layout changes, older data is then ignored
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kDefaultMaxEntries = 1 << 20;
+
+    explicit HashSet(size_t max_entries = kDefaultMaxEntries) : max_entries_(max_entries) {}
+
+    bool Contains(const hash_util::Hash128 &hash) const;
+    void Insert(const hash_util::Hash128 &hash);
+    void Merge(const HashSet &other);
+    size_t Size() const { return base_count_ + added_.size(); }
+
+    // The prefix identifies what produced the hashes (settings, versions...), data starting with another prefix is ignored.
+    // The first Load() keeps a copy of the data as is, later ones add the entries which are not in the set yet.
+    bool Load(const void *data, size_t size, const std::vector<uint8_t> &prefix);
+    bool LoadFile(const std::string &path, const std::vector<uint8_t> &prefix);
+
+    // Size of the data Write() produces with enough room
+    size_t WriteSize(size_t prefix_size) const;
+    // Writes the prefix and as many entries as fit in out_size, returns the number of bytes written (0 if even the header
+    // does not fit)
+    size_t Write(const std::vector<uint8_t> &prefix, void *out, size_t out_size) const;
+
+    // Merges what other processes saved in the meantime and replaces the file, see vvl::SaveCacheFile
+    bool SaveFile(const std::string &path, const std::vector<uint8_t> &prefix);
+
+  private:
+    struct Entry {
+        hash_util::Hash128 hash;
+        // Run counter value of the last Insert() or Contains() hit, data written by later runs has larger values
+        uint32_t last_use;
+    };
+
+    hash_util::Hash128 BaseHash(size_t index) const;
+    uint32_t BaseLastUse(size_t index) const;
+    bool FindInBase(const hash_util::Hash128 &hash, size_t &out_index) const;
+    // Returns false if the prefix or the header don't match, or if the data is too small for the entries
+    static bool ParseHeader(const uint8_t *data, size_t size, const std::vector<uint8_t> &prefix, uint32_t &out_run,
+                            uint32_t &out_count);
+    void SetBase(const uint8_t *entries, uint32_t count);
+    void AddEntry(const hash_util::Hash128 &hash, uint32_t last_use);
+    void AddEntries(const uint8_t *entries, uint32_t count);
+    // All entries sorted by hash, trimmed to the max_count most recently used
+    std::vector<Entry> SortedEntries(size_t max_count) const;
+
+    const size_t max_entries_;
+
+    // The data of the first Load(), either a copy or the mapped file
+    std::vector<uint8_t> base_copy_;
+    vvl::MappedFile base_file_;
+    // Points into base_copy_ or base_file_: count hashes, then count last uses
+    const uint8_t *base_entries_ = nullptr;
+    size_t base_count_ = 0;
+    // One bit per base entry, set when Contains() finds it
+    std::unique_ptr<std::atomic<uint32_t>[]> base_used_;
+    // Later last uses of base entries, found when merging other data
+    vvl::unordered_map<size_t, uint32_t> base_last_uses_;
+
+    vvl::unordered_map<hash_util::Hash128, uint32_t, hash_util::Hash128::Hasher> added_;
+    // One more than the largest run loaded so far
+    uint32_t current_use_ = 1;
+};
+
+}  // namespace spirv
@@ -0,0 +1,121 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace vvl {
+
+// The pool that owns the calling thread, if it is a worker
+static thread_local ThreadPool *current_pool = nullptr;
+
+ThreadPool::ThreadPool(uint32_t thread_count) : thread_count_(thread_count) { assert(thread_count > 0); }
+
+void ThreadPool::StartWorkers() {
+    threads_.reserve(thread_count_);
+    for (uint32_t i = 0; i < thread_count_; ++i) {
+        threads_.emplace_back(&ThreadPool::WorkerFunc, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        exit_ = true;
+    }
+    cond_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+uint32_t ThreadPool::DefaultThreadCount() {
+    // Leave a core to the application thread that is waiting for the results
+    const uint32_t hw_threads = std::thread::hardware_concurrency();
+    return std::clamp(hw_threads > 1 ? hw_threads - 1 : 1u, 1u, 8u);
+}
+
+uint32_t ThreadPool::ThreadCount() const {
+    std::unique_lock<std::mutex> guard(lock_);
+    return std::max(thread_count_, static_cast<uint32_t>(threads_.size()));
+}
+
+ThreadPool::BlockingScope::BlockingScope() {
+    ThreadPool *pool = current_pool;
+    if (!pool) {
+        return;
+    }
+    std::unique_lock<std::mutex> guard(pool->lock_);
+    // Once exit_ is set the destructor is joining threads_, which must not change anymore
+    if (pool->idle_count_ == 0 && !pool->exit_) {
+        pool->threads_.emplace_back(&ThreadPool::WorkerFunc, pool);
+    }
+}
+
+void ThreadPool::Post(Task &&task) {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        if (threads_.empty()) {
+            StartWorkers();
+        }
+        tasks_.emplace_back(std::move(task));
+    }
+    cond_.notify_one();
+}
+
+void ThreadPool::WorkerFunc() {
+    current_pool = this;
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> guard(lock_);
+            ++idle_count_;
+            cond_.wait(guard, [this] { return exit_ || !tasks_.empty(); });
+            --idle_count_;
+            if (tasks_.empty()) {
+                // exit_ is set and there is nothing left to do
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+void TaskGroup::Post(ThreadPool::Task &&task) {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        ++pending_;
+    }
+    pool_.Post([this, task = std::move(task)]() {
+        task();
+        std::unique_lock<std::mutex> guard(lock_);
+        if (--pending_ == 0) {
+            cond_.notify_all();
+        }
+    });
+}
+
+void TaskGroup::Wait() {
+    std::unique_lock<std::mutex> guard(lock_);
+    cond_.wait(guard, [this] { return pending_ == 0; });
+}
+
+}  // namespace vvl
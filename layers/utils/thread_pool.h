@@ -0,0 +1,92 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Fixed size set of worker threads. Tasks are started in the order they are posted, but any worker may pick any task,
+// so tasks that depend on each other must be ordered by the caller.
+// The workers are only started by the first posted task, so a pool that is never used costs no threads.
+class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(uint32_t thread_count);
+    // Tasks that are still queued are run before the workers exit
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    void Post(Task &&task);
+    // The number of workers the pool runs once started, plus the extra workers of BlockingScope
+    uint32_t ThreadCount() const;
+
+    // Worker count used when the user did not ask for a specific number
+    static uint32_t DefaultThreadCount();
+
+    // Wraps a wait that can depend on other tasks of the same pool. If it is used on a worker thread and no other worker is
+    // idle, an extra worker is started so the tasks being waited on still get to run. Extra workers stay in the pool until
+    // it is destroyed. Outside of a worker thread this does nothing.
+    class BlockingScope {
+      public:
+        BlockingScope();
+        BlockingScope(const BlockingScope &) = delete;
+        BlockingScope &operator=(const BlockingScope &) = delete;
+    };
+
+  private:
+    void WorkerFunc();
+    // Must be called with lock_ held
+    void StartWorkers();
+
+    mutable std::mutex lock_;
+    std::condition_variable cond_;
+    std::deque<Task> tasks_;
+    bool exit_ = false;
+    uint32_t idle_count_ = 0;
+    const uint32_t thread_count_;
+    std::vector<std::thread> threads_;
+};
+
+// Tracks a batch of tasks posted to a ThreadPool so the caller can wait for all of them to finish
+class TaskGroup {
+  public:
+    explicit TaskGroup(ThreadPool &pool) : pool_(pool) {}
+    ~TaskGroup() { Wait(); }
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    void Post(ThreadPool::Task &&task);
+    void Wait();
+
+  private:
+    ThreadPool &pool_;
+    std::mutex lock_;
+    std::condition_variable cond_;
+    uint32_t pending_ = 0;
+};
+
+}  // namespace vvl
@@ -58,6 +58,16 @@
 #endif
 #endif
 
+// For functions only called when validation finds an error. The compiler keeps them out of line and treats the branches calling
+// them as unlikely, so the checks around them stay small.
+#if defined(__GNUC__) || defined(__clang__)
+#define VVL_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define VVL_COLD __declspec(noinline)
+#else
+#define VVL_COLD
+#endif
+
 // There are many times we want to assert, but also it is highly important to not crash for release builds.
 // This Macro also makes it more obvious if we are returning early because of a known situation or if we are just guarding against
 // something wrong actually happening.
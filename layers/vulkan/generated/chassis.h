@@ -44,6 +44,7 @@
 #include "utils/cast_utils.h"
 #include "layer_options.h"
 #include "containers/custom_containers.h"
+#include "containers/handle_table.h"
 #include "error_message/logging.h"
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
@@ -55,21 +56,6 @@
 #include "gpu/core/gpuav_settings.h"
 #include "sync/sync_settings.h"
 
-extern std::atomic<uint64_t> global_unique_id;
-
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t& t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)vvl::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
-
 namespace chassis {
 struct CreateGraphicsPipelines;
 struct CreateComputePipelines;
@@ -90,7 +76,7 @@ class Pipeline;
 // Each chassis layer will need to track its own state
 using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vvl::HandleTable unique_id_mapping;
 
 std::vector<std::pair<uint32_t, uint32_t>>& GetCustomStypeInfo();
 
@@ -2372,6 +2358,10 @@ class ValidationObject {
     ValidationObjectType* GetValidationObject() const;
 
     // Debug Logging Helpers
+    // Cheap check to do once a check failed, before building the arguments of the message. Returns false if LogError() would
+    // drop the message anyway (filtered VUID, inactive severity or duplicate_message_limit reached).
+    bool IsErrorReportable(std::string_view vuid_text) const { return debug_report->IsMessageReportable(kErrorBit, vuid_text); }
+
     bool DECORATE_PRINTF(5, 6)
         LogError(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
         va_list argptr;
@@ -2466,10 +2456,8 @@ class ValidationObject {
     template <typename HandleType>
     HandleType WrapNew(HandleType new_created_handle) {
         if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-        auto unique_id = global_unique_id++;
-        unique_id = HashedUint64::hash(unique_id);
-        assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-        unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
+        // The table never hands out 0, otherwise unwrap would apply the special rule for VK_NULL_HANDLE
+        const uint64_t unique_id = unique_id_mapping.insert(CastToUint64(new_created_handle));
         return (HandleType)unique_id;
     }
 
@@ -130,6 +130,7 @@ typedef enum InterceptId {
     InterceptIdPreCallRecordGetQueryPoolResults,
     InterceptIdPostCallRecordGetQueryPoolResults,
     InterceptIdPreCallValidateCreateBuffer,
+    InterceptIdPreCallRecordCreateBuffer,
     InterceptIdPostCallRecordCreateBuffer,
     InterceptIdPreCallValidateDestroyBuffer,
     InterceptIdPreCallRecordDestroyBuffer,
@@ -155,6 +156,9 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateDestroyImageView,
     InterceptIdPreCallRecordDestroyImageView,
     InterceptIdPostCallRecordDestroyImageView,
+    InterceptIdPreCallValidateCreateShaderModule,
+    InterceptIdPreCallRecordCreateShaderModule,
+    InterceptIdPostCallRecordCreateShaderModule,
     InterceptIdPreCallValidateDestroyShaderModule,
     InterceptIdPreCallRecordDestroyShaderModule,
     InterceptIdPostCallRecordDestroyShaderModule,
@@ -170,10 +174,17 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateMergePipelineCaches,
     InterceptIdPreCallRecordMergePipelineCaches,
     InterceptIdPostCallRecordMergePipelineCaches,
+    InterceptIdPreCallValidateCreateGraphicsPipelines,
+    InterceptIdPreCallRecordCreateGraphicsPipelines,
+    InterceptIdPostCallRecordCreateGraphicsPipelines,
+    InterceptIdPreCallValidateCreateComputePipelines,
+    InterceptIdPreCallRecordCreateComputePipelines,
+    InterceptIdPostCallRecordCreateComputePipelines,
     InterceptIdPreCallValidateDestroyPipeline,
     InterceptIdPreCallRecordDestroyPipeline,
     InterceptIdPostCallRecordDestroyPipeline,
     InterceptIdPreCallValidateCreatePipelineLayout,
+    InterceptIdPreCallRecordCreatePipelineLayout,
     InterceptIdPostCallRecordCreatePipelineLayout,
     InterceptIdPreCallValidateDestroyPipelineLayout,
     InterceptIdPreCallRecordDestroyPipelineLayout,
@@ -199,7 +210,9 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateResetDescriptorPool,
     InterceptIdPreCallRecordResetDescriptorPool,
     InterceptIdPostCallRecordResetDescriptorPool,
+    InterceptIdPreCallValidateAllocateDescriptorSets,
     InterceptIdPreCallRecordAllocateDescriptorSets,
+    InterceptIdPostCallRecordAllocateDescriptorSets,
     InterceptIdPreCallValidateFreeDescriptorSets,
     InterceptIdPreCallRecordFreeDescriptorSets,
     InterceptIdPostCallRecordFreeDescriptorSets,
@@ -1109,6 +1122,9 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateCmdTraceRaysNV,
     InterceptIdPreCallRecordCmdTraceRaysNV,
     InterceptIdPostCallRecordCmdTraceRaysNV,
+    InterceptIdPreCallValidateCreateRayTracingPipelinesNV,
+    InterceptIdPreCallRecordCreateRayTracingPipelinesNV,
+    InterceptIdPostCallRecordCreateRayTracingPipelinesNV,
     InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR,
     InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesKHR,
     InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR,
@@ -1616,6 +1632,9 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateAntiLagUpdateAMD,
     InterceptIdPreCallRecordAntiLagUpdateAMD,
     InterceptIdPostCallRecordAntiLagUpdateAMD,
+    InterceptIdPreCallValidateCreateShadersEXT,
+    InterceptIdPreCallRecordCreateShadersEXT,
+    InterceptIdPostCallRecordCreateShadersEXT,
     InterceptIdPreCallValidateDestroyShaderEXT,
     InterceptIdPreCallRecordDestroyShaderEXT,
     InterceptIdPostCallRecordDestroyShaderEXT,
@@ -1733,6 +1752,9 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateCmdTraceRaysKHR,
     InterceptIdPreCallRecordCmdTraceRaysKHR,
     InterceptIdPostCallRecordCmdTraceRaysKHR,
+    InterceptIdPreCallValidateCreateRayTracingPipelinesKHR,
+    InterceptIdPreCallRecordCreateRayTracingPipelinesKHR,
+    InterceptIdPostCallRecordCreateRayTracingPipelinesKHR,
     InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR,
     InterceptIdPreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR,
     InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR,
@@ -1757,6 +1779,110 @@ typedef enum InterceptId {
     InterceptIdCount,
 } InterceptId;
 
+// clang-format off
+// Overloaded hooks can't be passed to typeid() since the name alone is ambiguous.
+// HookClass() deduces the class that declares the overload matching Sig. If a class declares only one of the two
+// overloads, the other is hidden and the fallback reports the class itself, which is correct as it overrides the hook.
+template <typename Sig, typename C>
+C* HookClass(Sig C::*);
+
+#define DECLARE_OVERLOADED_HOOK_CLASS(name) \
+    template <typename Sig, typename T> \
+    auto name ## Class(int) -> decltype(HookClass<Sig>(&T::name)); \
+    template <typename Sig, typename T> \
+    T* name ## Class(...);
+
+using PreCallRecordCreateBufferSig = void(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer, const RecordObject& record_obj);
+using PreCallRecordCreateBufferStateSig = void(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer, const RecordObject& record_obj, chassis::CreateBuffer& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallRecordCreateBuffer)
+using PreCallRecordCreateShaderModuleSig = void(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule, const RecordObject& record_obj);
+using PreCallRecordCreateShaderModuleStateSig = void(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule, const RecordObject& record_obj, chassis::CreateShaderModule& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallRecordCreateShaderModule)
+using PostCallRecordCreateShaderModuleSig = void(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule, const RecordObject& record_obj);
+using PostCallRecordCreateShaderModuleStateSig = void(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule, const RecordObject& record_obj, chassis::CreateShaderModule& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PostCallRecordCreateShaderModule)
+using PreCallValidateCreateGraphicsPipelinesSig = bool(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const ErrorObject& error_obj) const;
+using PreCallValidateCreateGraphicsPipelinesStateSig = bool(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const ErrorObject& error_obj, PipelineStates& pipeline_states, chassis::CreateGraphicsPipelines& chassis_state) const;
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallValidateCreateGraphicsPipelines)
+using PreCallRecordCreateGraphicsPipelinesSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj);
+using PreCallRecordCreateGraphicsPipelinesStateSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj, PipelineStates& pipeline_states, chassis::CreateGraphicsPipelines& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallRecordCreateGraphicsPipelines)
+using PostCallRecordCreateGraphicsPipelinesSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj);
+using PostCallRecordCreateGraphicsPipelinesStateSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj, PipelineStates& pipeline_states, chassis::CreateGraphicsPipelines& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PostCallRecordCreateGraphicsPipelines)
+using PreCallValidateCreateComputePipelinesSig = bool(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const ErrorObject& error_obj) const;
+using PreCallValidateCreateComputePipelinesStateSig = bool(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const ErrorObject& error_obj, PipelineStates& pipeline_states, chassis::CreateComputePipelines& chassis_state) const;
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallValidateCreateComputePipelines)
+using PreCallRecordCreateComputePipelinesSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj);
+using PreCallRecordCreateComputePipelinesStateSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj, PipelineStates& pipeline_states, chassis::CreateComputePipelines& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallRecordCreateComputePipelines)
+using PostCallRecordCreateComputePipelinesSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj);
+using PostCallRecordCreateComputePipelinesStateSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj, PipelineStates& pipeline_states, chassis::CreateComputePipelines& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PostCallRecordCreateComputePipelines)
+using PreCallRecordCreatePipelineLayoutSig = void(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout, const RecordObject& record_obj);
+using PreCallRecordCreatePipelineLayoutStateSig = void(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout, const RecordObject& record_obj, chassis::CreatePipelineLayout& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallRecordCreatePipelineLayout)
+using PreCallValidateAllocateDescriptorSetsSig = bool(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets, const ErrorObject& error_obj) const;
+using PreCallValidateAllocateDescriptorSetsStateSig = bool(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets, const ErrorObject& error_obj, vvl::AllocateDescriptorSetsData& ads_state) const;
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallValidateAllocateDescriptorSets)
+using PostCallRecordAllocateDescriptorSetsSig = void(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets, const RecordObject& record_obj);
+using PostCallRecordAllocateDescriptorSetsStateSig = void(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets, const RecordObject& record_obj, vvl::AllocateDescriptorSetsData& ads_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PostCallRecordAllocateDescriptorSets)
+using PreCallValidateCreateRayTracingPipelinesNVSig = bool(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const ErrorObject& error_obj) const;
+using PreCallValidateCreateRayTracingPipelinesNVStateSig = bool(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const ErrorObject& error_obj, PipelineStates& pipeline_states, chassis::CreateRayTracingPipelinesNV& chassis_state) const;
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallValidateCreateRayTracingPipelinesNV)
+using PreCallRecordCreateRayTracingPipelinesNVSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj);
+using PreCallRecordCreateRayTracingPipelinesNVStateSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj, PipelineStates& pipeline_states, chassis::CreateRayTracingPipelinesNV& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallRecordCreateRayTracingPipelinesNV)
+using PostCallRecordCreateRayTracingPipelinesNVSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj);
+using PostCallRecordCreateRayTracingPipelinesNVStateSig = void(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj, PipelineStates& pipeline_states, chassis::CreateRayTracingPipelinesNV& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PostCallRecordCreateRayTracingPipelinesNV)
+using PreCallRecordCreateShadersEXTSig = void(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders, const RecordObject& record_obj);
+using PreCallRecordCreateShadersEXTStateSig = void(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders, const RecordObject& record_obj, chassis::ShaderObject& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallRecordCreateShadersEXT)
+using PostCallRecordCreateShadersEXTSig = void(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders, const RecordObject& record_obj);
+using PostCallRecordCreateShadersEXTStateSig = void(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders, const RecordObject& record_obj, chassis::ShaderObject& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PostCallRecordCreateShadersEXT)
+using PreCallValidateCreateRayTracingPipelinesKHRSig = bool(VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const ErrorObject& error_obj) const;
+using PreCallValidateCreateRayTracingPipelinesKHRStateSig = bool(VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const ErrorObject& error_obj, PipelineStates& pipeline_states, chassis::CreateRayTracingPipelinesKHR& chassis_state) const;
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallValidateCreateRayTracingPipelinesKHR)
+using PreCallRecordCreateRayTracingPipelinesKHRSig = void(VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj);
+using PreCallRecordCreateRayTracingPipelinesKHRStateSig = void(VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj, PipelineStates& pipeline_states, chassis::CreateRayTracingPipelinesKHR& chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PreCallRecordCreateRayTracingPipelinesKHR)
+using PostCallRecordCreateRayTracingPipelinesKHRSig = void(VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj);
+using PostCallRecordCreateRayTracingPipelinesKHRStateSig = void(VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, const RecordObject& record_obj, PipelineStates& pipeline_states, std::shared_ptr<chassis::CreateRayTracingPipelinesKHR> chassis_state);
+DECLARE_OVERLOADED_HOOK_CLASS(PostCallRecordCreateRayTracingPipelinesKHR)
+// clang-format on
+
+// clang-format off
+// Calls hook with the validation object cast to its concrete type. The validation object classes are final, so the
+// call is resolved at compile time and small hooks can be inlined, instead of going through the vtable.
+template <typename From, typename To>
+using ConstLike = std::conditional_t<std::is_const_v<From>, const To, To>;
+
+template <typename VO, typename Hook>
+decltype(auto) VisitValidationObject(VO* object, Hook&& hook) {
+    switch (object->container_type) {
+        case LayerObjectTypeThreading:
+            return hook(static_cast<ConstLike<VO, ThreadSafety>*>(object));
+        case LayerObjectTypeParameterValidation:
+            return hook(static_cast<ConstLike<VO, StatelessValidation>*>(object));
+        case LayerObjectTypeObjectTracker:
+            return hook(static_cast<ConstLike<VO, ObjectLifetimes>*>(object));
+        case LayerObjectTypeCoreValidation:
+            return hook(static_cast<ConstLike<VO, CoreChecks>*>(object));
+        case LayerObjectTypeBestPractices:
+            return hook(static_cast<ConstLike<VO, BestPractices>*>(object));
+        case LayerObjectTypeGpuAssisted:
+            return hook(static_cast<ConstLike<VO, gpuav::Validator>*>(object));
+        case LayerObjectTypeSyncValidation:
+            return hook(static_cast<ConstLike<VO, SyncValidator>*>(object));
+        default:
+            return hook(object);
+    }
+}
+// clang-format on
+
 // clang-format off
 void ValidationObject::InitObjectDispatchVectors() {
 
@@ -1771,6 +1897,22 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&gpuav::Validator::name), \
                                 typeid(&SyncValidator::name));
 
+#define OVERLOADED_HOOK_TYPEID(name, type) \
+    (typeid(decltype(name ## Class<name ## Sig, type>(0))) != typeid(ValidationObject*) \
+         ? typeid(type*) \
+         : typeid(decltype(name ## Class<name ## StateSig, type>(0))))
+
+#define BUILD_OVERLOADED_DISPATCH_VECTOR(name) \
+    init_object_dispatch_vector(InterceptId ## name, \
+                                typeid(ValidationObject*), \
+                                OVERLOADED_HOOK_TYPEID(name, ThreadSafety), \
+                                OVERLOADED_HOOK_TYPEID(name, StatelessValidation), \
+                                OVERLOADED_HOOK_TYPEID(name, ObjectLifetimes), \
+                                OVERLOADED_HOOK_TYPEID(name, CoreChecks), \
+                                OVERLOADED_HOOK_TYPEID(name, BestPractices), \
+                                OVERLOADED_HOOK_TYPEID(name, gpuav::Validator), \
+                                OVERLOADED_HOOK_TYPEID(name, SyncValidator));
+
     auto init_object_dispatch_vector = [this](InterceptId id,
                                               const std::type_info& vo_typeid,
                                               const std::type_info& tt_typeid,
@@ -1913,6 +2055,7 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallRecordGetQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateBuffer);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallRecordCreateBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBuffer);
@@ -1938,6 +2081,9 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyImageView);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyImageView);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyImageView);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateShaderModule);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallRecordCreateShaderModule);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PostCallRecordCreateShaderModule);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyShaderModule);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyShaderModule);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyShaderModule);
@@ -1953,10 +2099,17 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateMergePipelineCaches);
     BUILD_DISPATCH_VECTOR(PreCallRecordMergePipelineCaches);
     BUILD_DISPATCH_VECTOR(PostCallRecordMergePipelineCaches);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallValidateCreateGraphicsPipelines);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallRecordCreateGraphicsPipelines);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PostCallRecordCreateGraphicsPipelines);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallValidateCreateComputePipelines);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallRecordCreateComputePipelines);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PostCallRecordCreateComputePipelines);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipeline);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipeline);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipeline);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreatePipelineLayout);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallRecordCreatePipelineLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreatePipelineLayout);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipelineLayout);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipelineLayout);
@@ -1982,7 +2135,9 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateResetDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetDescriptorPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetDescriptorPool);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallValidateAllocateDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallRecordAllocateDescriptorSets);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PostCallRecordAllocateDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallValidateFreeDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallRecordFreeDescriptorSets);
     BUILD_DISPATCH_VECTOR(PostCallRecordFreeDescriptorSets);
@@ -2904,6 +3059,9 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysNV);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallValidateCreateRayTracingPipelinesNV);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallRecordCreateRayTracingPipelinesNV);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PostCallRecordCreateRayTracingPipelinesNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupHandlesKHR);
@@ -3417,6 +3575,9 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateAntiLagUpdateAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordAntiLagUpdateAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordAntiLagUpdateAMD);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateShadersEXT);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallRecordCreateShadersEXT);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PostCallRecordCreateShadersEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyShaderEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyShaderEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyShaderEXT);
@@ -3536,6 +3697,9 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysKHR);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallValidateCreateRayTracingPipelinesKHR);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PreCallRecordCreateRayTracingPipelinesKHR);
+    BUILD_OVERLOADED_DISPATCH_VECTOR(PostCallRecordCreateRayTracingPipelinesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
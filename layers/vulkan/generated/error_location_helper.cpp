@@ -30,7 +30,7 @@
 namespace vvl {
 
 const char* String(Func func) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Func::Empty
     {"vkAcquireDrmDisplayEXT", 23},
     {"vkAcquireFullScreenExclusiveModeEXT", 36},
@@ -734,7 +734,7 @@ const char* String(Func func) {
 }
 
 const char* String(Struct structure) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Struct::Empty
     {"VkAabbPositionsKHR", 19},
     {"VkAccelerationStructureBuildGeometryInfoKHR", 44},
@@ -1839,7 +1839,7 @@ const char* String(Struct structure) {
 }
 
 const char* String(Field field) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Field::Empty
     {"AType", 6},
     {"BType", 6},
@@ -4566,7 +4566,7 @@ const char* String(Field field) {
 }
 
 const char* String(Enum value) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Enum::Empty
     {"VkAccelerationStructureBuildTypeKHR", 36},
     {"VkAccelerationStructureCompatibilityKHR", 40},
@@ -4704,7 +4704,7 @@ const char* String(Enum value) {
 }
 
 const char* String(FlagBitmask value) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // FlagBitmask::Empty
     {"VkAccelerationStructureCreateFlagBitsKHR", 41},
     {"VkAccessFlagBits", 17},
@@ -4846,7 +4846,7 @@ const char* String(FlagBitmask value) {
 }
 
 const char* String(Extension extension) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Extension::Empty
     {"VK_AMDX_shader_enqueue", 23},
     {"VK_AMD_anti_lag", 16},
@@ -27,6 +27,7 @@
 #include "layer_chassis_dispatch.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include "state_tracker/pipeline_state.h"
+#include "chassis/dispatch_scratch.h"
 
 #define DISPATCH_MAX_STACK_ALLOCATIONS 32
 
@@ -552,6 +553,9 @@ void DispatchGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t
 VkResult DispatchQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
+    if (vvl::dispatch::CanUnwrapInScratch(submitCount, pSubmits)) {
+        return ScratchDispatchQueueSubmit(layer_data, queue, submitCount, pSubmits, fence);
+    }
     vku::safe_VkSubmitInfo* local_pSubmits = nullptr;
     {
         if (pSubmits) {
@@ -1441,6 +1445,10 @@ void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount
     if (!wrap_handles)
         return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
                                                                       descriptorCopyCount, pDescriptorCopies);
+    if (vvl::dispatch::CanUnwrapInScratch(descriptorWriteCount, pDescriptorWrites)) {
+        return ScratchDispatchUpdateDescriptorSets(layer_data, device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
+                                                   pDescriptorCopies);
+    }
     vku::safe_VkWriteDescriptorSet* local_pDescriptorWrites = nullptr;
     vku::safe_VkCopyDescriptorSet* local_pDescriptorCopies = nullptr;
     {
@@ -1961,6 +1969,12 @@ void DispatchCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFl
         return layer_data->device_dispatch_table.CmdPipelineBarrier(
             commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers,
             bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    if (vvl::dispatch::CanUnwrapInScratch(bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
+                                          pImageMemoryBarriers)) {
+        return ScratchDispatchCmdPipelineBarrier(layer_data, commandBuffer, srcStageMask, dstStageMask, dependencyFlags,
+                                                 memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                                                 pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    }
     vku::safe_VkBufferMemoryBarrier* local_pBufferMemoryBarriers = nullptr;
     vku::safe_VkImageMemoryBarrier* local_pImageMemoryBarriers = nullptr;
     {
@@ -2722,6 +2736,10 @@ void DispatchCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount,
 void DispatchCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdPipelineBarrier2(commandBuffer, pDependencyInfo);
+    if (vvl::dispatch::CanUnwrapInScratch(pDependencyInfo)) {
+        return ScratchDispatchCmdPipelineBarrier2(layer_data, layer_data->device_dispatch_table.CmdPipelineBarrier2, commandBuffer,
+                                                  pDependencyInfo);
+    }
     vku::safe_VkDependencyInfo var_local_pDependencyInfo;
     vku::safe_VkDependencyInfo* local_pDependencyInfo = nullptr;
     {
@@ -2759,6 +2777,10 @@ void DispatchCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFl
 VkResult DispatchQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit2(queue, submitCount, pSubmits, fence);
+    if (vvl::dispatch::CanUnwrapInScratch(submitCount, pSubmits)) {
+        return ScratchDispatchQueueSubmit2(layer_data, layer_data->device_dispatch_table.QueueSubmit2, queue, submitCount, pSubmits,
+                                           fence);
+    }
     vku::safe_VkSubmitInfo2* local_pSubmits = nullptr;
     {
         if (pSubmits) {
@@ -5006,6 +5028,10 @@ void DispatchCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCoun
 void DispatchCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+    if (vvl::dispatch::CanUnwrapInScratch(pDependencyInfo)) {
+        return ScratchDispatchCmdPipelineBarrier2(layer_data, layer_data->device_dispatch_table.CmdPipelineBarrier2KHR,
+                                                  commandBuffer, pDependencyInfo);
+    }
     vku::safe_VkDependencyInfo var_local_pDependencyInfo;
     vku::safe_VkDependencyInfo* local_pDependencyInfo = nullptr;
     {
@@ -5044,6 +5070,10 @@ void DispatchCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStag
 VkResult DispatchQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    if (vvl::dispatch::CanUnwrapInScratch(submitCount, pSubmits)) {
+        return ScratchDispatchQueueSubmit2(layer_data, layer_data->device_dispatch_table.QueueSubmit2KHR, queue, submitCount,
+                                           pSubmits, fence);
+    }
     vku::safe_VkSubmitInfo2* local_pSubmits = nullptr;
     {
         if (pSubmits) {
@@ -26,6 +26,8 @@
 #include <vulkan/vulkan.h>
 
 extern bool wrap_handles;
+// True if handle is a live unique_id_mapping id, always false when handle wrapping is off
+bool IsWrappedHandle(uint64_t handle);
 
 class ValidationObject;
 void UnwrapPnextChainHandles(ValidationObject* layer_data, const void* pNext);
@@ -433,10 +433,12 @@ bool ObjectLifetimes::PreCallValidateBindBufferMemory(VkDevice device, VkBuffer
                                                       VkDeviceSize memoryOffset, const ErrorObject& error_obj) const {
     bool skip = false;
     // Checked by chassis: device: "VUID-vkBindBufferMemory-device-parameter"
-    skip |= ValidateObject(buffer, kVulkanObjectTypeBuffer, false, "VUID-vkBindBufferMemory-buffer-parameter",
-                           "VUID-vkBindBufferMemory-buffer-parent", error_obj.location.dot(Field::buffer));
-    skip |= ValidateObject(memory, kVulkanObjectTypeDeviceMemory, false, "VUID-vkBindBufferMemory-memory-parameter",
-                           "VUID-vkBindBufferMemory-memory-parent", error_obj.location.dot(Field::memory));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeBuffer, false, Field::buffer, "VUID-vkBindBufferMemory-buffer-parameter",
+         "VUID-vkBindBufferMemory-buffer-parent"},
+        {kVulkanObjectTypeDeviceMemory, false, Field::memory, "VUID-vkBindBufferMemory-memory-parameter",
+         "VUID-vkBindBufferMemory-memory-parent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(buffer), HandleToUint64(memory)}, error_obj.location);
 
     return skip;
 }
@@ -445,10 +447,12 @@ bool ObjectLifetimes::PreCallValidateBindImageMemory(VkDevice device, VkImage im
                                                      VkDeviceSize memoryOffset, const ErrorObject& error_obj) const {
     bool skip = false;
     // Checked by chassis: device: "VUID-vkBindImageMemory-device-parameter"
-    skip |= ValidateObject(image, kVulkanObjectTypeImage, false, "VUID-vkBindImageMemory-image-parameter",
-                           "VUID-vkBindImageMemory-image-parent", error_obj.location.dot(Field::image));
-    skip |= ValidateObject(memory, kVulkanObjectTypeDeviceMemory, false, "VUID-vkBindImageMemory-memory-parameter",
-                           "VUID-vkBindImageMemory-memory-parent", error_obj.location.dot(Field::memory));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeImage, false, Field::image, "VUID-vkBindImageMemory-image-parameter",
+         "VUID-vkBindImageMemory-image-parent"},
+        {kVulkanObjectTypeDeviceMemory, false, Field::memory, "VUID-vkBindImageMemory-memory-parameter",
+         "VUID-vkBindImageMemory-memory-parent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(image), HandleToUint64(memory)}, error_obj.location);
 
     return skip;
 }
@@ -1593,10 +1597,12 @@ bool ObjectLifetimes::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyBuffer-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyBuffer-commonparent"
-    skip |= ValidateObject(srcBuffer, kVulkanObjectTypeBuffer, false, "VUID-vkCmdCopyBuffer-srcBuffer-parameter",
-                           "VUID-vkCmdCopyBuffer-commonparent", error_obj.location.dot(Field::srcBuffer));
-    skip |= ValidateObject(dstBuffer, kVulkanObjectTypeBuffer, false, "VUID-vkCmdCopyBuffer-dstBuffer-parameter",
-                           "VUID-vkCmdCopyBuffer-commonparent", error_obj.location.dot(Field::dstBuffer));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeBuffer, false, Field::srcBuffer, "VUID-vkCmdCopyBuffer-srcBuffer-parameter",
+         "VUID-vkCmdCopyBuffer-commonparent"},
+        {kVulkanObjectTypeBuffer, false, Field::dstBuffer, "VUID-vkCmdCopyBuffer-dstBuffer-parameter",
+         "VUID-vkCmdCopyBuffer-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(srcBuffer), HandleToUint64(dstBuffer)}, error_obj.location);
 
     return skip;
 }
@@ -1607,10 +1613,12 @@ bool ObjectLifetimes::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer,
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyImage-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyImage-commonparent"
-    skip |= ValidateObject(srcImage, kVulkanObjectTypeImage, false, "VUID-vkCmdCopyImage-srcImage-parameter",
-                           "VUID-vkCmdCopyImage-commonparent", error_obj.location.dot(Field::srcImage));
-    skip |= ValidateObject(dstImage, kVulkanObjectTypeImage, false, "VUID-vkCmdCopyImage-dstImage-parameter",
-                           "VUID-vkCmdCopyImage-commonparent", error_obj.location.dot(Field::dstImage));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeImage, false, Field::srcImage, "VUID-vkCmdCopyImage-srcImage-parameter",
+         "VUID-vkCmdCopyImage-commonparent"},
+        {kVulkanObjectTypeImage, false, Field::dstImage, "VUID-vkCmdCopyImage-dstImage-parameter",
+         "VUID-vkCmdCopyImage-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(srcImage), HandleToUint64(dstImage)}, error_obj.location);
 
     return skip;
 }
@@ -1622,10 +1630,12 @@ bool ObjectLifetimes::PreCallValidateCmdBlitImage(VkCommandBuffer commandBuffer,
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdBlitImage-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdBlitImage-commonparent"
-    skip |= ValidateObject(srcImage, kVulkanObjectTypeImage, false, "VUID-vkCmdBlitImage-srcImage-parameter",
-                           "VUID-vkCmdBlitImage-commonparent", error_obj.location.dot(Field::srcImage));
-    skip |= ValidateObject(dstImage, kVulkanObjectTypeImage, false, "VUID-vkCmdBlitImage-dstImage-parameter",
-                           "VUID-vkCmdBlitImage-commonparent", error_obj.location.dot(Field::dstImage));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeImage, false, Field::srcImage, "VUID-vkCmdBlitImage-srcImage-parameter",
+         "VUID-vkCmdBlitImage-commonparent"},
+        {kVulkanObjectTypeImage, false, Field::dstImage, "VUID-vkCmdBlitImage-dstImage-parameter",
+         "VUID-vkCmdBlitImage-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(srcImage), HandleToUint64(dstImage)}, error_obj.location);
 
     return skip;
 }
@@ -1636,10 +1646,12 @@ bool ObjectLifetimes::PreCallValidateCmdCopyBufferToImage(VkCommandBuffer comman
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyBufferToImage-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyBufferToImage-commonparent"
-    skip |= ValidateObject(srcBuffer, kVulkanObjectTypeBuffer, false, "VUID-vkCmdCopyBufferToImage-srcBuffer-parameter",
-                           "VUID-vkCmdCopyBufferToImage-commonparent", error_obj.location.dot(Field::srcBuffer));
-    skip |= ValidateObject(dstImage, kVulkanObjectTypeImage, false, "VUID-vkCmdCopyBufferToImage-dstImage-parameter",
-                           "VUID-vkCmdCopyBufferToImage-commonparent", error_obj.location.dot(Field::dstImage));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeBuffer, false, Field::srcBuffer, "VUID-vkCmdCopyBufferToImage-srcBuffer-parameter",
+         "VUID-vkCmdCopyBufferToImage-commonparent"},
+        {kVulkanObjectTypeImage, false, Field::dstImage, "VUID-vkCmdCopyBufferToImage-dstImage-parameter",
+         "VUID-vkCmdCopyBufferToImage-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(srcBuffer), HandleToUint64(dstImage)}, error_obj.location);
 
     return skip;
 }
@@ -1650,10 +1662,12 @@ bool ObjectLifetimes::PreCallValidateCmdCopyImageToBuffer(VkCommandBuffer comman
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyImageToBuffer-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyImageToBuffer-commonparent"
-    skip |= ValidateObject(srcImage, kVulkanObjectTypeImage, false, "VUID-vkCmdCopyImageToBuffer-srcImage-parameter",
-                           "VUID-vkCmdCopyImageToBuffer-commonparent", error_obj.location.dot(Field::srcImage));
-    skip |= ValidateObject(dstBuffer, kVulkanObjectTypeBuffer, false, "VUID-vkCmdCopyImageToBuffer-dstBuffer-parameter",
-                           "VUID-vkCmdCopyImageToBuffer-commonparent", error_obj.location.dot(Field::dstBuffer));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeImage, false, Field::srcImage, "VUID-vkCmdCopyImageToBuffer-srcImage-parameter",
+         "VUID-vkCmdCopyImageToBuffer-commonparent"},
+        {kVulkanObjectTypeBuffer, false, Field::dstBuffer, "VUID-vkCmdCopyImageToBuffer-dstBuffer-parameter",
+         "VUID-vkCmdCopyImageToBuffer-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(srcImage), HandleToUint64(dstBuffer)}, error_obj.location);
 
     return skip;
 }
@@ -1716,10 +1730,12 @@ bool ObjectLifetimes::PreCallValidateCmdResolveImage(VkCommandBuffer commandBuff
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdResolveImage-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdResolveImage-commonparent"
-    skip |= ValidateObject(srcImage, kVulkanObjectTypeImage, false, "VUID-vkCmdResolveImage-srcImage-parameter",
-                           "VUID-vkCmdResolveImage-commonparent", error_obj.location.dot(Field::srcImage));
-    skip |= ValidateObject(dstImage, kVulkanObjectTypeImage, false, "VUID-vkCmdResolveImage-dstImage-parameter",
-                           "VUID-vkCmdResolveImage-commonparent", error_obj.location.dot(Field::dstImage));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeImage, false, Field::srcImage, "VUID-vkCmdResolveImage-srcImage-parameter",
+         "VUID-vkCmdResolveImage-commonparent"},
+        {kVulkanObjectTypeImage, false, Field::dstImage, "VUID-vkCmdResolveImage-dstImage-parameter",
+         "VUID-vkCmdResolveImage-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(srcImage), HandleToUint64(dstImage)}, error_obj.location);
 
     return skip;
 }
@@ -1859,10 +1875,12 @@ bool ObjectLifetimes::PreCallValidateCmdCopyQueryPoolResults(VkCommandBuffer com
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyQueryPoolResults-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdCopyQueryPoolResults-commonparent"
-    skip |= ValidateObject(queryPool, kVulkanObjectTypeQueryPool, false, "VUID-vkCmdCopyQueryPoolResults-queryPool-parameter",
-                           "VUID-vkCmdCopyQueryPoolResults-commonparent", error_obj.location.dot(Field::queryPool));
-    skip |= ValidateObject(dstBuffer, kVulkanObjectTypeBuffer, false, "VUID-vkCmdCopyQueryPoolResults-dstBuffer-parameter",
-                           "VUID-vkCmdCopyQueryPoolResults-commonparent", error_obj.location.dot(Field::dstBuffer));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeQueryPool, false, Field::queryPool, "VUID-vkCmdCopyQueryPoolResults-queryPool-parameter",
+         "VUID-vkCmdCopyQueryPoolResults-commonparent"},
+        {kVulkanObjectTypeBuffer, false, Field::dstBuffer, "VUID-vkCmdCopyQueryPoolResults-dstBuffer-parameter",
+         "VUID-vkCmdCopyQueryPoolResults-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(queryPool), HandleToUint64(dstBuffer)}, error_obj.location);
 
     return skip;
 }
@@ -2143,13 +2161,15 @@ bool ObjectLifetimes::PreCallValidateUpdateDescriptorSetWithTemplate(VkDevice de
                                                                      const void* pData, const ErrorObject& error_obj) const {
     bool skip = false;
     // Checked by chassis: device: "VUID-vkUpdateDescriptorSetWithTemplate-device-parameter"
-    skip |= ValidateObject(
-        descriptorSet, kVulkanObjectTypeDescriptorSet, false, "VUID-vkUpdateDescriptorSetWithTemplate-descriptorSet-parameter",
-        "VUID-vkUpdateDescriptorSetWithTemplate-descriptorSet-parent", error_obj.location.dot(Field::descriptorSet));
-    skip |= ValidateObject(descriptorUpdateTemplate, kVulkanObjectTypeDescriptorUpdateTemplate, false,
-                           "VUID-vkUpdateDescriptorSetWithTemplate-descriptorUpdateTemplate-parameter",
-                           "VUID-vkUpdateDescriptorSetWithTemplate-descriptorUpdateTemplate-parent",
-                           error_obj.location.dot(Field::descriptorUpdateTemplate));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeDescriptorSet, false, Field::descriptorSet,
+         "VUID-vkUpdateDescriptorSetWithTemplate-descriptorSet-parameter",
+         "VUID-vkUpdateDescriptorSetWithTemplate-descriptorSet-parent"},
+        {kVulkanObjectTypeDescriptorUpdateTemplate, false, Field::descriptorUpdateTemplate,
+         "VUID-vkUpdateDescriptorSetWithTemplate-descriptorUpdateTemplate-parameter",
+         "VUID-vkUpdateDescriptorSetWithTemplate-descriptorUpdateTemplate-parent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(descriptorSet), HandleToUint64(descriptorUpdateTemplate)},
+                            error_obj.location);
 
     return skip;
 }
@@ -2170,10 +2190,12 @@ bool ObjectLifetimes::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer comman
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdDrawIndirectCount-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdDrawIndirectCount-commonparent"
-    skip |= ValidateObject(buffer, kVulkanObjectTypeBuffer, false, "VUID-vkCmdDrawIndirectCount-buffer-parameter",
-                           "VUID-vkCmdDrawIndirectCount-commonparent", error_obj.location.dot(Field::buffer));
-    skip |= ValidateObject(countBuffer, kVulkanObjectTypeBuffer, false, "VUID-vkCmdDrawIndirectCount-countBuffer-parameter",
-                           "VUID-vkCmdDrawIndirectCount-commonparent", error_obj.location.dot(Field::countBuffer));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeBuffer, false, Field::buffer, "VUID-vkCmdDrawIndirectCount-buffer-parameter",
+         "VUID-vkCmdDrawIndirectCount-commonparent"},
+        {kVulkanObjectTypeBuffer, false, Field::countBuffer, "VUID-vkCmdDrawIndirectCount-countBuffer-parameter",
+         "VUID-vkCmdDrawIndirectCount-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(buffer), HandleToUint64(countBuffer)}, error_obj.location);
 
     return skip;
 }
@@ -2185,10 +2207,12 @@ bool ObjectLifetimes::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdDrawIndexedIndirectCount-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdDrawIndexedIndirectCount-commonparent"
-    skip |= ValidateObject(buffer, kVulkanObjectTypeBuffer, false, "VUID-vkCmdDrawIndexedIndirectCount-buffer-parameter",
-                           "VUID-vkCmdDrawIndexedIndirectCount-commonparent", error_obj.location.dot(Field::buffer));
-    skip |= ValidateObject(countBuffer, kVulkanObjectTypeBuffer, false, "VUID-vkCmdDrawIndexedIndirectCount-countBuffer-parameter",
-                           "VUID-vkCmdDrawIndexedIndirectCount-commonparent", error_obj.location.dot(Field::countBuffer));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeBuffer, false, Field::buffer, "VUID-vkCmdDrawIndexedIndirectCount-buffer-parameter",
+         "VUID-vkCmdDrawIndexedIndirectCount-commonparent"},
+        {kVulkanObjectTypeBuffer, false, Field::countBuffer, "VUID-vkCmdDrawIndexedIndirectCount-countBuffer-parameter",
+         "VUID-vkCmdDrawIndexedIndirectCount-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(buffer), HandleToUint64(countBuffer)}, error_obj.location);
 
     return skip;
 }
@@ -2958,12 +2982,15 @@ bool ObjectLifetimes::PreCallValidateAcquireNextImageKHR(VkDevice device, VkSwap
                                                          const ErrorObject& error_obj) const {
     bool skip = false;
     // Checked by chassis: device: "VUID-vkAcquireNextImageKHR-device-parameter"
-    skip |= ValidateObject(swapchain, kVulkanObjectTypeSwapchainKHR, false, "VUID-vkAcquireNextImageKHR-swapchain-parameter",
-                           "VUID-vkAcquireNextImageKHR-swapchain-parent", error_obj.location.dot(Field::swapchain));
-    skip |= ValidateObject(semaphore, kVulkanObjectTypeSemaphore, true, "VUID-vkAcquireNextImageKHR-semaphore-parameter",
-                           "VUID-vkAcquireNextImageKHR-semaphore-parent", error_obj.location.dot(Field::semaphore));
-    skip |= ValidateObject(fence, kVulkanObjectTypeFence, true, "VUID-vkAcquireNextImageKHR-fence-parameter",
-                           "VUID-vkAcquireNextImageKHR-fence-parent", error_obj.location.dot(Field::fence));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeSwapchainKHR, false, Field::swapchain, "VUID-vkAcquireNextImageKHR-swapchain-parameter",
+         "VUID-vkAcquireNextImageKHR-swapchain-parent"},
+        {kVulkanObjectTypeSemaphore, true, Field::semaphore, "VUID-vkAcquireNextImageKHR-semaphore-parameter",
+         "VUID-vkAcquireNextImageKHR-semaphore-parent"},
+        {kVulkanObjectTypeFence, true, Field::fence, "VUID-vkAcquireNextImageKHR-fence-parameter",
+         "VUID-vkAcquireNextImageKHR-fence-parent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(swapchain), HandleToUint64(semaphore), HandleToUint64(fence)},
+                            error_obj.location);
 
     return skip;
 }
@@ -3682,13 +3709,13 @@ bool ObjectLifetimes::PreCallValidateCmdPushDescriptorSetWithTemplateKHR(VkComma
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdPushDescriptorSetWithTemplateKHR-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdPushDescriptorSetWithTemplateKHR-commonparent"
-    skip |= ValidateObject(descriptorUpdateTemplate, kVulkanObjectTypeDescriptorUpdateTemplate, false,
-                           "VUID-vkCmdPushDescriptorSetWithTemplateKHR-descriptorUpdateTemplate-parameter",
-                           "VUID-vkCmdPushDescriptorSetWithTemplateKHR-commonparent",
-                           error_obj.location.dot(Field::descriptorUpdateTemplate));
-    skip |= ValidateObject(layout, kVulkanObjectTypePipelineLayout, false,
-                           "VUID-vkCmdPushDescriptorSetWithTemplateKHR-layout-parameter",
-                           "VUID-vkCmdPushDescriptorSetWithTemplateKHR-commonparent", error_obj.location.dot(Field::layout));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeDescriptorUpdateTemplate, false, Field::descriptorUpdateTemplate,
+         "VUID-vkCmdPushDescriptorSetWithTemplateKHR-descriptorUpdateTemplate-parameter",
+         "VUID-vkCmdPushDescriptorSetWithTemplateKHR-commonparent"},
+        {kVulkanObjectTypePipelineLayout, false, Field::layout, "VUID-vkCmdPushDescriptorSetWithTemplateKHR-layout-parameter",
+         "VUID-vkCmdPushDescriptorSetWithTemplateKHR-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(descriptorUpdateTemplate), HandleToUint64(layout)}, error_obj.location);
 
     return skip;
 }
@@ -5568,18 +5595,19 @@ bool ObjectLifetimes::PreCallValidateCmdTraceRaysNV(VkCommandBuffer commandBuffe
     bool skip = false;
     // Checked by chassis: commandBuffer: "VUID-vkCmdTraceRaysNV-commandBuffer-parameter"
     // Checked by chassis: commandBuffer: "VUID-vkCmdTraceRaysNV-commonparent"
-    skip |= ValidateObject(raygenShaderBindingTableBuffer, kVulkanObjectTypeBuffer, false,
-                           "VUID-vkCmdTraceRaysNV-raygenShaderBindingTableBuffer-parameter", "VUID-vkCmdTraceRaysNV-commonparent",
-                           error_obj.location.dot(Field::raygenShaderBindingTableBuffer));
-    skip |= ValidateObject(missShaderBindingTableBuffer, kVulkanObjectTypeBuffer, true,
-                           "VUID-vkCmdTraceRaysNV-missShaderBindingTableBuffer-parameter", "VUID-vkCmdTraceRaysNV-commonparent",
-                           error_obj.location.dot(Field::missShaderBindingTableBuffer));
-    skip |= ValidateObject(hitShaderBindingTableBuffer, kVulkanObjectTypeBuffer, true,
-                           "VUID-vkCmdTraceRaysNV-hitShaderBindingTableBuffer-parameter", "VUID-vkCmdTraceRaysNV-commonparent",
-                           error_obj.location.dot(Field::hitShaderBindingTableBuffer));
-    skip |= ValidateObject(callableShaderBindingTableBuffer, kVulkanObjectTypeBuffer, true,
-                           "VUID-vkCmdTraceRaysNV-callableShaderBindingTableBuffer-parameter", "VUID-vkCmdTraceRaysNV-commonparent",
-                           error_obj.location.dot(Field::callableShaderBindingTableBuffer));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeBuffer, false, Field::raygenShaderBindingTableBuffer,
+         "VUID-vkCmdTraceRaysNV-raygenShaderBindingTableBuffer-parameter", "VUID-vkCmdTraceRaysNV-commonparent"},
+        {kVulkanObjectTypeBuffer, true, Field::missShaderBindingTableBuffer,
+         "VUID-vkCmdTraceRaysNV-missShaderBindingTableBuffer-parameter", "VUID-vkCmdTraceRaysNV-commonparent"},
+        {kVulkanObjectTypeBuffer, true, Field::hitShaderBindingTableBuffer,
+         "VUID-vkCmdTraceRaysNV-hitShaderBindingTableBuffer-parameter", "VUID-vkCmdTraceRaysNV-commonparent"},
+        {kVulkanObjectTypeBuffer, true, Field::callableShaderBindingTableBuffer,
+         "VUID-vkCmdTraceRaysNV-callableShaderBindingTableBuffer-parameter", "VUID-vkCmdTraceRaysNV-commonparent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(raygenShaderBindingTableBuffer),
+                                            HandleToUint64(missShaderBindingTableBuffer),
+                                            HandleToUint64(hitShaderBindingTableBuffer),
+                                            HandleToUint64(callableShaderBindingTableBuffer)}, error_obj.location);
 
     return skip;
 }
@@ -7393,11 +7421,12 @@ bool ObjectLifetimes::PreCallValidateBindOpticalFlowSessionImageNV(VkDevice devi
                                                                    const ErrorObject& error_obj) const {
     bool skip = false;
     // Checked by chassis: device: "VUID-vkBindOpticalFlowSessionImageNV-device-parameter"
-    skip |= ValidateObject(session, kVulkanObjectTypeOpticalFlowSessionNV, false,
-                           "VUID-vkBindOpticalFlowSessionImageNV-session-parameter",
-                           "VUID-vkBindOpticalFlowSessionImageNV-session-parent", error_obj.location.dot(Field::session));
-    skip |= ValidateObject(view, kVulkanObjectTypeImageView, true, "VUID-vkBindOpticalFlowSessionImageNV-view-parameter",
-                           "VUID-vkBindOpticalFlowSessionImageNV-view-parent", error_obj.location.dot(Field::view));
+    static constexpr HandleParam kHandleParams[] = {
+        {kVulkanObjectTypeOpticalFlowSessionNV, false, Field::session, "VUID-vkBindOpticalFlowSessionImageNV-session-parameter",
+         "VUID-vkBindOpticalFlowSessionImageNV-session-parent"},
+        {kVulkanObjectTypeImageView, true, Field::view, "VUID-vkBindOpticalFlowSessionImageNV-view-parameter",
+         "VUID-vkBindOpticalFlowSessionImageNV-view-parent"}};
+    skip |= ValidateObjects(kHandleParams, {HandleToUint64(session), HandleToUint64(view)}, error_obj.location);
 
     return skip;
 }
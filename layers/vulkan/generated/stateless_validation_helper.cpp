@@ -40,18 +40,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_16bit_storage)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_16bit_storage))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES), but its parent extension "
-                                 "VK_KHR_16bit_storage has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES",
+                                                    "VK_KHR_16bit_storage");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevice16BitStorageFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_16bit_storage)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevice16BitStorageFeatures, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_KHR_16bit_storage) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDevice16BitStorageFeatures",
+                                                               "VK_KHR_16bit_storage");
                 }
                 VkPhysicalDevice16BitStorageFeatures* structure = (VkPhysicalDevice16BitStorageFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::storageBuffer16BitAccess), structure->storageBuffer16BitAccess);
@@ -70,18 +66,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_multiview)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_multiview))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES), "
-                                 "but its parent extension "
-                                 "VK_KHR_multiview has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES",
+                                                    "VK_KHR_multiview");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMultiviewFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_multiview)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMultiviewFeatures, but when creating VkDevice, the "
-                                     "parent extension "
-                                     "(VK_KHR_multiview) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMultiviewFeatures",
+                                                               "VK_KHR_multiview");
                 }
                 VkPhysicalDeviceMultiviewFeatures* structure = (VkPhysicalDeviceMultiviewFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::multiview), structure->multiview);
@@ -98,18 +90,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_variable_pointers)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_variable_pointers))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES), but its parent extension "
-                                 "VK_KHR_variable_pointers has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES",
+                                                    "VK_KHR_variable_pointers");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceVariablePointersFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_variable_pointers)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceVariablePointersFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_variable_pointers) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceVariablePointersFeatures",
+                                                               "VK_KHR_variable_pointers");
                 }
                 VkPhysicalDeviceVariablePointersFeatures* structure = (VkPhysicalDeviceVariablePointersFeatures*)header;
                 skip |=
@@ -126,14 +114,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_1) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |= LogError(
-                        pnext_vuid, instance, loc.dot(Field::pNext),
-                        "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES) "
-                        "which was added in VK_API_VERSION_1_1 but the "
-                        "current effective API version is %s.",
-                        StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_1 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES",
+                                                     "VK_API_VERSION_1_1", device_properties.apiVersion);
                 }
             }
             if (is_const_param) {
@@ -149,18 +132,16 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_sampler_ycbcr_conversion)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES), but its parent extension "
-                                 "VK_KHR_sampler_ycbcr_conversion has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES",
+                                                    "VK_KHR_sampler_ycbcr_conversion");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceSamplerYcbcrConversionFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceSamplerYcbcrConversionFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_sampler_ycbcr_conversion) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceSamplerYcbcrConversionFeatures",
+                                                               "VK_KHR_sampler_ycbcr_conversion");
                 }
                 VkPhysicalDeviceSamplerYcbcrConversionFeatures* structure = (VkPhysicalDeviceSamplerYcbcrConversionFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::samplerYcbcrConversion), structure->samplerYcbcrConversion);
@@ -174,14 +155,10 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_1) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                     "includes a pointer to a VkStructureType "
-                                     "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES) which was added in "
-                                     "VK_API_VERSION_1_1 but the "
-                                     "current effective API version is %s.",
-                                     StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_1 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc,
+                                                     "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES",
+                                                     "VK_API_VERSION_1_1", device_properties.apiVersion);
                 }
             }
             if (is_const_param) {
@@ -197,14 +174,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_2) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |=
-                        LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES) "
-                                 "which was added in VK_API_VERSION_1_2 but the "
-                                 "current effective API version is %s.",
-                                 StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_2 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES",
+                                                     "VK_API_VERSION_1_2", device_properties.apiVersion);
                 }
             }
             if (is_const_param) {
@@ -244,14 +216,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_2) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |=
-                        LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES) "
-                                 "which was added in VK_API_VERSION_1_2 but the "
-                                 "current effective API version is %s.",
-                                 StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_2 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES",
+                                                     "VK_API_VERSION_1_2", device_properties.apiVersion);
                 }
             }
             if (is_const_param) {
@@ -382,18 +349,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_8bit_storage)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_8bit_storage))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES), but its parent extension "
-                                 "VK_KHR_8bit_storage has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES",
+                                                    "VK_KHR_8bit_storage");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevice8BitStorageFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_8bit_storage)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevice8BitStorageFeatures, but when creating VkDevice, the "
-                                     "parent extension "
-                                     "(VK_KHR_8bit_storage) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDevice8BitStorageFeatures",
+                                                               "VK_KHR_8bit_storage");
                 }
                 VkPhysicalDevice8BitStorageFeatures* structure = (VkPhysicalDevice8BitStorageFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::storageBuffer8BitAccess), structure->storageBuffer8BitAccess);
@@ -411,18 +374,15 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_shader_atomic_int64)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_shader_atomic_int64))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES), but its parent extension "
-                                 "VK_KHR_shader_atomic_int64 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES",
+                                                    "VK_KHR_shader_atomic_int64");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderAtomicInt64Features);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_atomic_int64)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderAtomicInt64Features, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_shader_atomic_int64) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceShaderAtomicInt64Features",
+                                                               "VK_KHR_shader_atomic_int64");
                 }
                 VkPhysicalDeviceShaderAtomicInt64Features* structure = (VkPhysicalDeviceShaderAtomicInt64Features*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderBufferInt64Atomics), structure->shaderBufferInt64Atomics);
@@ -437,18 +397,15 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_shader_float16_int8)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_shader_float16_int8))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES), but its parent extension "
-                                 "VK_KHR_shader_float16_int8 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES",
+                                                    "VK_KHR_shader_float16_int8");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderFloat16Int8Features);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_float16_int8)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderFloat16Int8Features, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_shader_float16_int8) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceShaderFloat16Int8Features",
+                                                               "VK_KHR_shader_float16_int8");
                 }
                 VkPhysicalDeviceShaderFloat16Int8Features* structure = (VkPhysicalDeviceShaderFloat16Int8Features*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderFloat16), structure->shaderFloat16);
@@ -463,18 +420,15 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_descriptor_indexing)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_descriptor_indexing))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES), but its parent extension "
-                                 "VK_EXT_descriptor_indexing has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES",
+                                                    "VK_EXT_descriptor_indexing");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDescriptorIndexingFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_descriptor_indexing)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDescriptorIndexingFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_descriptor_indexing) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceDescriptorIndexingFeatures",
+                                                               "VK_EXT_descriptor_indexing");
                 }
                 VkPhysicalDeviceDescriptorIndexingFeatures* structure = (VkPhysicalDeviceDescriptorIndexingFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderInputAttachmentArrayDynamicIndexing),
@@ -544,18 +498,15 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_scalar_block_layout)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_scalar_block_layout))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES), but its parent extension "
-                                 "VK_EXT_scalar_block_layout has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES",
+                                                    "VK_EXT_scalar_block_layout");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceScalarBlockLayoutFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_scalar_block_layout)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceScalarBlockLayoutFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_scalar_block_layout) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceScalarBlockLayoutFeatures",
+                                                               "VK_EXT_scalar_block_layout");
                 }
                 VkPhysicalDeviceScalarBlockLayoutFeatures* structure = (VkPhysicalDeviceScalarBlockLayoutFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::scalarBlockLayout), structure->scalarBlockLayout);
@@ -568,18 +519,15 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_vulkan_memory_model)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_vulkan_memory_model))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES), but its parent extension "
-                                 "VK_KHR_vulkan_memory_model has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES",
+                                                    "VK_KHR_vulkan_memory_model");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceVulkanMemoryModelFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_vulkan_memory_model)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceVulkanMemoryModelFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_vulkan_memory_model) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceVulkanMemoryModelFeatures",
+                                                               "VK_KHR_vulkan_memory_model");
                 }
                 VkPhysicalDeviceVulkanMemoryModelFeatures* structure = (VkPhysicalDeviceVulkanMemoryModelFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::vulkanMemoryModel), structure->vulkanMemoryModel);
@@ -597,18 +545,16 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_imageless_framebuffer)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_imageless_framebuffer))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES), but its parent extension "
-                                 "VK_KHR_imageless_framebuffer has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES",
+                                                    "VK_KHR_imageless_framebuffer");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImagelessFramebufferFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_imageless_framebuffer)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImagelessFramebufferFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_imageless_framebuffer) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceImagelessFramebufferFeatures",
+                                                               "VK_KHR_imageless_framebuffer");
                 }
                 VkPhysicalDeviceImagelessFramebufferFeatures* structure = (VkPhysicalDeviceImagelessFramebufferFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::imagelessFramebuffer), structure->imagelessFramebuffer);
@@ -621,19 +567,16 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_uniform_buffer_standard_layout)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_uniform_buffer_standard_layout))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType "
-                    "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES), but its parent extension "
-                    "VK_KHR_uniform_buffer_standard_layout has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES",
+                                                    "VK_KHR_uniform_buffer_standard_layout");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceUniformBufferStandardLayoutFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_uniform_buffer_standard_layout)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceUniformBufferStandardLayoutFeatures, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_uniform_buffer_standard_layout) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceUniformBufferStandardLayoutFeatures",
+                                                               "VK_KHR_uniform_buffer_standard_layout");
                 }
                 VkPhysicalDeviceUniformBufferStandardLayoutFeatures* structure =
                     (VkPhysicalDeviceUniformBufferStandardLayoutFeatures*)header;
@@ -647,11 +590,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_shader_subgroup_extended_types)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_shader_subgroup_extended_types))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType "
-                    "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES), but its parent extension "
-                    "VK_KHR_shader_subgroup_extended_types has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES",
+                                                    "VK_KHR_shader_subgroup_extended_types");
             }
         } break;
 
@@ -661,19 +602,16 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_separate_depth_stencil_layouts)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_separate_depth_stencil_layouts))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType "
-                    "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES), but its parent extension "
-                    "VK_KHR_separate_depth_stencil_layouts has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES",
+                                                    "VK_KHR_separate_depth_stencil_layouts");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_separate_depth_stencil_layouts)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_separate_depth_stencil_layouts) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures",
+                                                               "VK_KHR_separate_depth_stencil_layouts");
                 }
                 VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures* structure =
                     (VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures*)header;
@@ -687,18 +625,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_host_query_reset)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_host_query_reset))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES), but its parent extension "
-                                 "VK_EXT_host_query_reset has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES",
+                                                    "VK_EXT_host_query_reset");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceHostQueryResetFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_host_query_reset)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceHostQueryResetFeatures, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_EXT_host_query_reset) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceHostQueryResetFeatures",
+                                                               "VK_EXT_host_query_reset");
                 }
                 VkPhysicalDeviceHostQueryResetFeatures* structure = (VkPhysicalDeviceHostQueryResetFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::hostQueryReset), structure->hostQueryReset);
@@ -711,18 +645,15 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_timeline_semaphore)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_timeline_semaphore))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES), but its parent extension "
-                                 "VK_KHR_timeline_semaphore has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES",
+                                                    "VK_KHR_timeline_semaphore");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceTimelineSemaphoreFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_timeline_semaphore)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceTimelineSemaphoreFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_timeline_semaphore) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceTimelineSemaphoreFeatures",
+                                                               "VK_KHR_timeline_semaphore");
                 }
                 VkPhysicalDeviceTimelineSemaphoreFeatures* structure = (VkPhysicalDeviceTimelineSemaphoreFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::timelineSemaphore), structure->timelineSemaphore);
@@ -735,18 +666,15 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_buffer_device_address)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_buffer_device_address))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES), but its parent extension "
-                                 "VK_KHR_buffer_device_address has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES",
+                                                    "VK_KHR_buffer_device_address");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceBufferDeviceAddressFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceBufferDeviceAddressFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_buffer_device_address) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceBufferDeviceAddressFeatures",
+                                                               "VK_KHR_buffer_device_address");
                 }
                 VkPhysicalDeviceBufferDeviceAddressFeatures* structure = (VkPhysicalDeviceBufferDeviceAddressFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::bufferDeviceAddress), structure->bufferDeviceAddress);
@@ -765,14 +693,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_3) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |=
-                        LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES) "
-                                 "which was added in VK_API_VERSION_1_3 but the "
-                                 "current effective API version is %s.",
-                                 StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_3 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES",
+                                                     "VK_API_VERSION_1_3", device_properties.apiVersion);
                 }
             }
             if (is_const_param) {
@@ -819,19 +742,16 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_shader_terminate_invocation)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_shader_terminate_invocation))) {
-                skip |=
-                    LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                             "includes a pointer to a VkStructureType "
-                             "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES), but its parent extension "
-                             "VK_KHR_shader_terminate_invocation has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES",
+                                                    "VK_KHR_shader_terminate_invocation");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderTerminateInvocationFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_terminate_invocation)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderTerminateInvocationFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_shader_terminate_invocation) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderTerminateInvocationFeatures",
+                                                               "VK_KHR_shader_terminate_invocation");
                 }
                 VkPhysicalDeviceShaderTerminateInvocationFeatures* structure =
                     (VkPhysicalDeviceShaderTerminateInvocationFeatures*)header;
@@ -845,20 +765,17 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_shader_demote_to_helper_invocation)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_shader_demote_to_helper_invocation))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType "
-                    "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES), but its parent extension "
-                    "VK_EXT_shader_demote_to_helper_invocation has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES",
+                                                    "VK_EXT_shader_demote_to_helper_invocation");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_shader_demote_to_helper_invocation)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_shader_demote_to_helper_invocation) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures",
+                                                               "VK_EXT_shader_demote_to_helper_invocation");
                 }
                 VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures* structure =
                     (VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures*)header;
@@ -873,18 +790,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_private_data)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_private_data))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES), but its parent extension "
-                                 "VK_EXT_private_data has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES",
+                                                    "VK_EXT_private_data");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePrivateDataFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_private_data)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePrivateDataFeatures, but when creating VkDevice, the "
-                                     "parent extension "
-                                     "(VK_EXT_private_data) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDevicePrivateDataFeatures",
+                                                               "VK_EXT_private_data");
                 }
                 VkPhysicalDevicePrivateDataFeatures* structure = (VkPhysicalDevicePrivateDataFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::privateData), structure->privateData);
@@ -897,19 +810,16 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_pipeline_creation_cache_control)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_pipeline_creation_cache_control))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType "
-                    "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES), but its parent extension "
-                    "VK_EXT_pipeline_creation_cache_control has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES",
+                                                    "VK_EXT_pipeline_creation_cache_control");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePipelineCreationCacheControlFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_pipeline_creation_cache_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePipelineCreationCacheControlFeatures, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_pipeline_creation_cache_control) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePipelineCreationCacheControlFeatures",
+                                                               "VK_EXT_pipeline_creation_cache_control");
                 }
                 VkPhysicalDevicePipelineCreationCacheControlFeatures* structure =
                     (VkPhysicalDevicePipelineCreationCacheControlFeatures*)header;
@@ -923,18 +833,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_synchronization2)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_synchronization2))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES), but its parent extension "
-                                 "VK_KHR_synchronization2 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES",
+                                                    "VK_KHR_synchronization2");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceSynchronization2Features);
                 if (!IsExtEnabled(device_extensions.vk_khr_synchronization2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceSynchronization2Features, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_synchronization2) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceSynchronization2Features",
+                                                               "VK_KHR_synchronization2");
                 }
                 VkPhysicalDeviceSynchronization2Features* structure = (VkPhysicalDeviceSynchronization2Features*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::synchronization2), structure->synchronization2);
@@ -947,20 +853,17 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_zero_initialize_workgroup_memory)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_zero_initialize_workgroup_memory))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType "
-                    "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES), but its parent extension "
-                    "VK_KHR_zero_initialize_workgroup_memory has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES",
+                                                    "VK_KHR_zero_initialize_workgroup_memory");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_zero_initialize_workgroup_memory)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_zero_initialize_workgroup_memory) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures",
+                                                               "VK_KHR_zero_initialize_workgroup_memory");
                 }
                 VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures* structure =
                     (VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures*)header;
@@ -975,18 +878,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_image_robustness)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_image_robustness))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES), but its parent extension "
-                                 "VK_EXT_image_robustness has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES",
+                                                    "VK_EXT_image_robustness");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImageRobustnessFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_image_robustness)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImageRobustnessFeatures, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_EXT_image_robustness) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceImageRobustnessFeatures",
+                                                               "VK_EXT_image_robustness");
                 }
                 VkPhysicalDeviceImageRobustnessFeatures* structure = (VkPhysicalDeviceImageRobustnessFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::robustImageAccess), structure->robustImageAccess);
@@ -999,18 +898,15 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_subgroup_size_control)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_subgroup_size_control))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES), but its parent extension "
-                                 "VK_EXT_subgroup_size_control has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES",
+                                                    "VK_EXT_subgroup_size_control");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceSubgroupSizeControlFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_subgroup_size_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceSubgroupSizeControlFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_subgroup_size_control) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceSubgroupSizeControlFeatures",
+                                                               "VK_EXT_subgroup_size_control");
                 }
                 VkPhysicalDeviceSubgroupSizeControlFeatures* structure = (VkPhysicalDeviceSubgroupSizeControlFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::subgroupSizeControl), structure->subgroupSizeControl);
@@ -1025,18 +921,15 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_inline_uniform_block)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_inline_uniform_block))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES), but its parent extension "
-                                 "VK_EXT_inline_uniform_block has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES",
+                                                    "VK_EXT_inline_uniform_block");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceInlineUniformBlockFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_inline_uniform_block)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceInlineUniformBlockFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_inline_uniform_block) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceInlineUniformBlockFeatures",
+                                                               "VK_EXT_inline_uniform_block");
                 }
                 VkPhysicalDeviceInlineUniformBlockFeatures* structure = (VkPhysicalDeviceInlineUniformBlockFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::inlineUniformBlock), structure->inlineUniformBlock);
@@ -1052,19 +945,16 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_texture_compression_astc_hdr)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_texture_compression_astc_hdr))) {
-                skip |=
-                    LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                             "includes a pointer to a VkStructureType "
-                             "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES), but its parent extension "
-                             "VK_EXT_texture_compression_astc_hdr has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES",
+                                                    "VK_EXT_texture_compression_astc_hdr");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceTextureCompressionASTCHDRFeatures);
                 if (!IsExtEnabled(device_extensions.vk_ext_texture_compression_astc_hdr)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceTextureCompressionASTCHDRFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_texture_compression_astc_hdr) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceTextureCompressionASTCHDRFeatures",
+                                                               "VK_EXT_texture_compression_astc_hdr");
                 }
                 VkPhysicalDeviceTextureCompressionASTCHDRFeatures* structure =
                     (VkPhysicalDeviceTextureCompressionASTCHDRFeatures*)header;
@@ -1078,18 +968,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_dynamic_rendering)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_dynamic_rendering))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES), but its parent extension "
-                                 "VK_KHR_dynamic_rendering has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES",
+                                                    "VK_KHR_dynamic_rendering");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDynamicRenderingFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_dynamic_rendering)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDynamicRenderingFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_dynamic_rendering) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceDynamicRenderingFeatures",
+                                                               "VK_KHR_dynamic_rendering");
                 }
                 VkPhysicalDeviceDynamicRenderingFeatures* structure = (VkPhysicalDeviceDynamicRenderingFeatures*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::dynamicRendering), structure->dynamicRendering);
@@ -1102,19 +988,16 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_shader_integer_dot_product)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_shader_integer_dot_product))) {
-                skip |=
-                    LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                             "includes a pointer to a VkStructureType "
-                             "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES), but its parent extension "
-                             "VK_KHR_shader_integer_dot_product has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES",
+                                                    "VK_KHR_shader_integer_dot_product");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderIntegerDotProductFeatures);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_integer_dot_product)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderIntegerDotProductFeatures, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_shader_integer_dot_product) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderIntegerDotProductFeatures",
+                                                               "VK_KHR_shader_integer_dot_product");
                 }
                 VkPhysicalDeviceShaderIntegerDotProductFeatures* structure =
                     (VkPhysicalDeviceShaderIntegerDotProductFeatures*)header;
@@ -1128,18 +1011,14 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_maintenance4)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_maintenance4))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES), but its parent extension "
-                                 "VK_KHR_maintenance4 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES",
+                                                    "VK_KHR_maintenance4");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMaintenance4Features);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance4)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMaintenance4Features, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_KHR_maintenance4) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMaintenance4Features",
+                                                               "VK_KHR_maintenance4");
                 }
                 VkPhysicalDeviceMaintenance4Features* structure = (VkPhysicalDeviceMaintenance4Features*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::maintenance4), structure->maintenance4);
@@ -1152,10 +1031,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePerformanceQueryFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_performance_query)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePerformanceQueryFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_performance_query) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDevicePerformanceQueryFeaturesKHR",
+                                                               "VK_KHR_performance_query");
                 }
                 VkPhysicalDevicePerformanceQueryFeaturesKHR* structure = (VkPhysicalDevicePerformanceQueryFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::performanceCounterQueryPools), structure->performanceCounterQueryPools);
@@ -1172,10 +1049,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePortabilitySubsetFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_portability_subset)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePortabilitySubsetFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_portability_subset) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePortabilitySubsetFeaturesKHR",
+                                                               "VK_KHR_portability_subset");
                 }
                 VkPhysicalDevicePortabilitySubsetFeaturesKHR* structure = (VkPhysicalDevicePortabilitySubsetFeaturesKHR*)header;
                 skip |=
@@ -1221,10 +1097,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderClockFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_clock)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderClockFeaturesKHR, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_KHR_shader_clock) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceShaderClockFeaturesKHR",
+                                                               "VK_KHR_shader_clock");
                 }
                 VkPhysicalDeviceShaderClockFeaturesKHR* structure = (VkPhysicalDeviceShaderClockFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderSubgroupClock), structure->shaderSubgroupClock);
@@ -1240,11 +1114,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_global_priority) &&
                     !IsExtEnabled(device_extensions.vk_ext_global_priority_query)) {
-                    skip |= LogError(
-                        pnext_vuid, instance, pNext_loc,
-                        "includes a pointer to a VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR, but when creating VkDevice, the "
-                        "parent extension "
-                        "(VK_KHR_global_priority or VK_EXT_global_priority_query) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR",
+                                                               "VK_KHR_global_priority or VK_EXT_global_priority_query");
                 }
                 VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR* structure = (VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::globalPriorityQuery), structure->globalPriorityQuery);
@@ -1257,10 +1129,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFragmentShadingRateFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_fragment_shading_rate)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceFragmentShadingRateFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_fragment_shading_rate) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceFragmentShadingRateFeaturesKHR",
+                                                               "VK_KHR_fragment_shading_rate");
                 }
                 VkPhysicalDeviceFragmentShadingRateFeaturesKHR* structure = (VkPhysicalDeviceFragmentShadingRateFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::pipelineFragmentShadingRate), structure->pipelineFragmentShadingRate);
@@ -1278,10 +1149,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_dynamic_rendering_local_read)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_dynamic_rendering_local_read) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR",
+                                                               "VK_KHR_dynamic_rendering_local_read");
                 }
                 VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR* structure =
                     (VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR*)header;
@@ -1295,10 +1165,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderQuadControlFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_quad_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderQuadControlFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_shader_quad_control) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderQuadControlFeaturesKHR",
+                                                               "VK_KHR_shader_quad_control");
                 }
                 VkPhysicalDeviceShaderQuadControlFeaturesKHR* structure = (VkPhysicalDeviceShaderQuadControlFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderQuadControl), structure->shaderQuadControl);
@@ -1311,10 +1180,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePresentWaitFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_present_wait)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePresentWaitFeaturesKHR, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_KHR_present_wait) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDevicePresentWaitFeaturesKHR",
+                                                               "VK_KHR_present_wait");
                 }
                 VkPhysicalDevicePresentWaitFeaturesKHR* structure = (VkPhysicalDevicePresentWaitFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::presentWait), structure->presentWait);
@@ -1328,10 +1195,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_pipeline_executable_properties)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_pipeline_executable_properties) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR",
+                                                               "VK_KHR_pipeline_executable_properties");
                 }
                 VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR* structure =
                     (VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR*)header;
@@ -1345,10 +1211,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePresentIdFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_present_id)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePresentIdFeaturesKHR, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_KHR_present_id) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDevicePresentIdFeaturesKHR",
+                                                               "VK_KHR_present_id");
                 }
                 VkPhysicalDevicePresentIdFeaturesKHR* structure = (VkPhysicalDevicePresentIdFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::presentId), structure->presentId);
@@ -1362,11 +1226,10 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_fragment_shader_barycentric) &&
                     !IsExtEnabled(device_extensions.vk_nv_fragment_shader_barycentric)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_fragment_shader_barycentric or VK_NV_fragment_shader_barycentric) was not included "
-                                     "in ppEnabledExtensionNames.");
+                    skip |=
+                        LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                           "VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR",
+                                                           "VK_KHR_fragment_shader_barycentric or VK_NV_fragment_shader_barycentric");
                 }
                 VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR* structure =
                     (VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR*)header;
@@ -1381,10 +1244,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_subgroup_uniform_control_flow)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR, but "
-                                     "when creating VkDevice, the parent extension "
-                                     "(VK_KHR_shader_subgroup_uniform_control_flow) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR",
+                                                               "VK_KHR_shader_subgroup_uniform_control_flow");
                 }
                 VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR* structure =
                     (VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR*)header;
@@ -1400,10 +1262,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_workgroup_memory_explicit_layout)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_workgroup_memory_explicit_layout) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR",
+                                                               "VK_KHR_workgroup_memory_explicit_layout");
                 }
                 VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR* structure =
                     (VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR*)header;
@@ -1427,10 +1288,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_ray_tracing_maintenance1)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_ray_tracing_maintenance1) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR",
+                                                               "VK_KHR_ray_tracing_maintenance1");
                 }
                 VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR* structure =
                     (VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR*)header;
@@ -1447,10 +1307,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_subgroup_rotate)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_shader_subgroup_rotate) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR",
+                                                               "VK_KHR_shader_subgroup_rotate");
                 }
                 VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR* structure =
                     (VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR*)header;
@@ -1468,10 +1327,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_maximal_reconvergence)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_shader_maximal_reconvergence) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR",
+                                                               "VK_KHR_shader_maximal_reconvergence");
                 }
                 VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR* structure =
                     (VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR*)header;
@@ -1485,10 +1343,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMaintenance5FeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance5)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMaintenance5FeaturesKHR, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_KHR_maintenance5) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMaintenance5FeaturesKHR",
+                                                               "VK_KHR_maintenance5");
                 }
                 VkPhysicalDeviceMaintenance5FeaturesKHR* structure = (VkPhysicalDeviceMaintenance5FeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::maintenance5), structure->maintenance5);
@@ -1501,10 +1357,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_ray_tracing_position_fetch)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_ray_tracing_position_fetch) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR",
+                                                               "VK_KHR_ray_tracing_position_fetch");
                 }
                 VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR* structure =
                     (VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR*)header;
@@ -1518,10 +1373,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePipelineBinaryFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_pipeline_binary)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePipelineBinaryFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_pipeline_binary) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDevicePipelineBinaryFeaturesKHR",
+                                                               "VK_KHR_pipeline_binary");
                 }
                 VkPhysicalDevicePipelineBinaryFeaturesKHR* structure = (VkPhysicalDevicePipelineBinaryFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::pipelineBinaries), structure->pipelineBinaries);
@@ -1534,10 +1387,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCooperativeMatrixFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_cooperative_matrix)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCooperativeMatrixFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_cooperative_matrix) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceCooperativeMatrixFeaturesKHR",
+                                                               "VK_KHR_cooperative_matrix");
                 }
                 VkPhysicalDeviceCooperativeMatrixFeaturesKHR* structure = (VkPhysicalDeviceCooperativeMatrixFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::cooperativeMatrix), structure->cooperativeMatrix);
@@ -1554,11 +1406,10 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceComputeShaderDerivativesFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_compute_shader_derivatives) &&
                     !IsExtEnabled(device_extensions.vk_nv_compute_shader_derivatives)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceComputeShaderDerivativesFeaturesKHR, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_KHR_compute_shader_derivatives or VK_NV_compute_shader_derivatives) was not included in "
-                                     "ppEnabledExtensionNames.");
+                    skip |=
+                        LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                           "VkPhysicalDeviceComputeShaderDerivativesFeaturesKHR",
+                                                           "VK_KHR_compute_shader_derivatives or VK_NV_compute_shader_derivatives");
                 }
                 VkPhysicalDeviceComputeShaderDerivativesFeaturesKHR* structure =
                     (VkPhysicalDeviceComputeShaderDerivativesFeaturesKHR*)header;
@@ -1585,11 +1436,10 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_vertex_attribute_divisor) &&
                     !IsExtEnabled(device_extensions.vk_ext_vertex_attribute_divisor)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_vertex_attribute_divisor or VK_EXT_vertex_attribute_divisor) was not included in "
-                                     "ppEnabledExtensionNames.");
+                    skip |=
+                        LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                           "VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR",
+                                                           "VK_KHR_vertex_attribute_divisor or VK_EXT_vertex_attribute_divisor");
                 }
                 VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR* structure =
                     (VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR*)header;
@@ -1607,10 +1457,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderFloatControls2FeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_float_controls2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderFloatControls2FeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_shader_float_controls2) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderFloatControls2FeaturesKHR",
+                                                               "VK_KHR_shader_float_controls2");
                 }
                 VkPhysicalDeviceShaderFloatControls2FeaturesKHR* structure =
                     (VkPhysicalDeviceShaderFloatControls2FeaturesKHR*)header;
@@ -1625,11 +1474,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceIndexTypeUint8FeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_index_type_uint8) &&
                     !IsExtEnabled(device_extensions.vk_ext_index_type_uint8)) {
-                    skip |= LogError(
-                        pnext_vuid, instance, pNext_loc,
-                        "includes a pointer to a VkPhysicalDeviceIndexTypeUint8FeaturesKHR, but when creating VkDevice, the parent "
-                        "extension "
-                        "(VK_KHR_index_type_uint8 or VK_EXT_index_type_uint8) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceIndexTypeUint8FeaturesKHR",
+                                                               "VK_KHR_index_type_uint8 or VK_EXT_index_type_uint8");
                 }
                 VkPhysicalDeviceIndexTypeUint8FeaturesKHR* structure = (VkPhysicalDeviceIndexTypeUint8FeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::indexTypeUint8), structure->indexTypeUint8);
@@ -1643,11 +1489,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceLineRasterizationFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_line_rasterization) &&
                     !IsExtEnabled(device_extensions.vk_ext_line_rasterization)) {
-                    skip |= LogError(
-                        pnext_vuid, instance, pNext_loc,
-                        "includes a pointer to a VkPhysicalDeviceLineRasterizationFeaturesKHR, but when creating VkDevice, the "
-                        "parent extension "
-                        "(VK_KHR_line_rasterization or VK_EXT_line_rasterization) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceLineRasterizationFeaturesKHR",
+                                                               "VK_KHR_line_rasterization or VK_EXT_line_rasterization");
                 }
                 VkPhysicalDeviceLineRasterizationFeaturesKHR* structure = (VkPhysicalDeviceLineRasterizationFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::rectangularLines), structure->rectangularLines);
@@ -1670,10 +1514,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderExpectAssumeFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_expect_assume)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderExpectAssumeFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_shader_expect_assume) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderExpectAssumeFeaturesKHR",
+                                                               "VK_KHR_shader_expect_assume");
                 }
                 VkPhysicalDeviceShaderExpectAssumeFeaturesKHR* structure = (VkPhysicalDeviceShaderExpectAssumeFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderExpectAssume), structure->shaderExpectAssume);
@@ -1686,10 +1529,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMaintenance6FeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance6)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMaintenance6FeaturesKHR, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_KHR_maintenance6) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMaintenance6FeaturesKHR",
+                                                               "VK_KHR_maintenance6");
                 }
                 VkPhysicalDeviceMaintenance6FeaturesKHR* structure = (VkPhysicalDeviceMaintenance6FeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::maintenance6), structure->maintenance6);
@@ -1703,10 +1544,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_shader_relaxed_extended_instruction)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR, but "
-                                     "when creating VkDevice, the parent extension "
-                                     "(VK_KHR_shader_relaxed_extended_instruction) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR",
+                                                               "VK_KHR_shader_relaxed_extended_instruction");
                 }
                 VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR* structure =
                     (VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR*)header;
@@ -1721,10 +1561,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMaintenance7FeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance7)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMaintenance7FeaturesKHR, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_KHR_maintenance7) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMaintenance7FeaturesKHR",
+                                                               "VK_KHR_maintenance7");
                 }
                 VkPhysicalDeviceMaintenance7FeaturesKHR* structure = (VkPhysicalDeviceMaintenance7FeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::maintenance7), structure->maintenance7);
@@ -1737,10 +1575,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceTransformFeedbackFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_transform_feedback)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceTransformFeedbackFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_transform_feedback) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceTransformFeedbackFeaturesEXT",
+                                                               "VK_EXT_transform_feedback");
                 }
                 VkPhysicalDeviceTransformFeedbackFeaturesEXT* structure = (VkPhysicalDeviceTransformFeedbackFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::transformFeedback), structure->transformFeedback);
@@ -1755,10 +1592,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCornerSampledImageFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_corner_sampled_image)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCornerSampledImageFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_corner_sampled_image) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceCornerSampledImageFeaturesNV",
+                                                               "VK_NV_corner_sampled_image");
                 }
                 VkPhysicalDeviceCornerSampledImageFeaturesNV* structure = (VkPhysicalDeviceCornerSampledImageFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::cornerSampledImage), structure->cornerSampledImage);
@@ -1771,10 +1607,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceASTCDecodeFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_astc_decode_mode)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceASTCDecodeFeaturesEXT, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_EXT_astc_decode_mode) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceASTCDecodeFeaturesEXT",
+                                                               "VK_EXT_astc_decode_mode");
                 }
                 VkPhysicalDeviceASTCDecodeFeaturesEXT* structure = (VkPhysicalDeviceASTCDecodeFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::decodeModeSharedExponent), structure->decodeModeSharedExponent);
@@ -1787,10 +1621,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePipelineRobustnessFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_pipeline_robustness)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePipelineRobustnessFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_pipeline_robustness) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePipelineRobustnessFeaturesEXT",
+                                                               "VK_EXT_pipeline_robustness");
                 }
                 VkPhysicalDevicePipelineRobustnessFeaturesEXT* structure = (VkPhysicalDevicePipelineRobustnessFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::pipelineRobustness), structure->pipelineRobustness);
@@ -1803,10 +1636,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceConditionalRenderingFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_conditional_rendering)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceConditionalRenderingFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_conditional_rendering) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceConditionalRenderingFeaturesEXT",
+                                                               "VK_EXT_conditional_rendering");
                 }
                 VkPhysicalDeviceConditionalRenderingFeaturesEXT* structure =
                     (VkPhysicalDeviceConditionalRenderingFeaturesEXT*)header;
@@ -1823,10 +1655,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDepthClipEnableFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_depth_clip_enable)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDepthClipEnableFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_depth_clip_enable) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceDepthClipEnableFeaturesEXT",
+                                                               "VK_EXT_depth_clip_enable");
                 }
                 VkPhysicalDeviceDepthClipEnableFeaturesEXT* structure = (VkPhysicalDeviceDepthClipEnableFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::depthClipEnable), structure->depthClipEnable);
@@ -1839,10 +1669,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG);
                 if (!IsExtEnabled(device_extensions.vk_img_relaxed_line_rasterization)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_IMG_relaxed_line_rasterization) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG",
+                                                               "VK_IMG_relaxed_line_rasterization");
                 }
                 VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG* structure =
                     (VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG*)header;
@@ -1857,10 +1686,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderEnqueueFeaturesAMDX);
                 if (!IsExtEnabled(device_extensions.vk_amdx_shader_enqueue)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderEnqueueFeaturesAMDX, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_AMDX_shader_enqueue) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceShaderEnqueueFeaturesAMDX",
+                                                               "VK_AMDX_shader_enqueue");
                 }
                 VkPhysicalDeviceShaderEnqueueFeaturesAMDX* structure = (VkPhysicalDeviceShaderEnqueueFeaturesAMDX*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderEnqueue), structure->shaderEnqueue);
@@ -1876,10 +1703,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_blend_operation_advanced)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_blend_operation_advanced) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT",
+                                                               "VK_EXT_blend_operation_advanced");
                 }
                 VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT* structure =
                     (VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT*)header;
@@ -1894,10 +1720,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderSMBuiltinsFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_shader_sm_builtins)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderSMBuiltinsFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_shader_sm_builtins) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceShaderSMBuiltinsFeaturesNV",
+                                                               "VK_NV_shader_sm_builtins");
                 }
                 VkPhysicalDeviceShaderSMBuiltinsFeaturesNV* structure = (VkPhysicalDeviceShaderSMBuiltinsFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderSMBuiltins), structure->shaderSMBuiltins);
@@ -1910,10 +1734,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShadingRateImageFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_shading_rate_image)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShadingRateImageFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_shading_rate_image) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceShadingRateImageFeaturesNV",
+                                                               "VK_NV_shading_rate_image");
                 }
                 VkPhysicalDeviceShadingRateImageFeaturesNV* structure = (VkPhysicalDeviceShadingRateImageFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shadingRateImage), structure->shadingRateImage);
@@ -1928,10 +1750,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_representative_fragment_test)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_representative_fragment_test) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV",
+                                                               "VK_NV_representative_fragment_test");
                 }
                 VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV* structure =
                     (VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV*)header;
@@ -1945,10 +1766,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMeshShaderFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_mesh_shader)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMeshShaderFeaturesNV, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_NV_mesh_shader) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMeshShaderFeaturesNV",
+                                                               "VK_NV_mesh_shader");
                 }
                 VkPhysicalDeviceMeshShaderFeaturesNV* structure = (VkPhysicalDeviceMeshShaderFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::taskShader), structure->taskShader);
@@ -1963,10 +1782,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderImageFootprintFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_shader_image_footprint)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderImageFootprintFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_shader_image_footprint) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderImageFootprintFeaturesNV",
+                                                               "VK_NV_shader_image_footprint");
                 }
                 VkPhysicalDeviceShaderImageFootprintFeaturesNV* structure = (VkPhysicalDeviceShaderImageFootprintFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::imageFootprint), structure->imageFootprint);
@@ -1979,10 +1797,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceExclusiveScissorFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_scissor_exclusive)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceExclusiveScissorFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_scissor_exclusive) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceExclusiveScissorFeaturesNV",
+                                                               "VK_NV_scissor_exclusive");
                 }
                 VkPhysicalDeviceExclusiveScissorFeaturesNV* structure = (VkPhysicalDeviceExclusiveScissorFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::exclusiveScissor), structure->exclusiveScissor);
@@ -1995,10 +1811,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL);
                 if (!IsExtEnabled(device_extensions.vk_intel_shader_integer_functions2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_INTEL_shader_integer_functions2) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL",
+                                                               "VK_INTEL_shader_integer_functions2");
                 }
                 VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL* structure =
                     (VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL*)header;
@@ -2012,10 +1827,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFragmentDensityMapFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_fragment_density_map)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceFragmentDensityMapFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_fragment_density_map) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceFragmentDensityMapFeaturesEXT",
+                                                               "VK_EXT_fragment_density_map");
                 }
                 VkPhysicalDeviceFragmentDensityMapFeaturesEXT* structure = (VkPhysicalDeviceFragmentDensityMapFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::fragmentDensityMap), structure->fragmentDensityMap);
@@ -2033,10 +1847,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCoherentMemoryFeaturesAMD);
                 if (!IsExtEnabled(device_extensions.vk_amd_device_coherent_memory)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCoherentMemoryFeaturesAMD, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_AMD_device_coherent_memory) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceCoherentMemoryFeaturesAMD",
+                                                               "VK_AMD_device_coherent_memory");
                 }
                 VkPhysicalDeviceCoherentMemoryFeaturesAMD* structure = (VkPhysicalDeviceCoherentMemoryFeaturesAMD*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::deviceCoherentMemory), structure->deviceCoherentMemory);
@@ -2049,10 +1861,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_shader_image_atomic_int64)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_shader_image_atomic_int64) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT",
+                                                               "VK_EXT_shader_image_atomic_int64");
                 }
                 VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT* structure =
                     (VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT*)header;
@@ -2068,10 +1879,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMemoryPriorityFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_memory_priority)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMemoryPriorityFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_memory_priority) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMemoryPriorityFeaturesEXT",
+                                                               "VK_EXT_memory_priority");
                 }
                 VkPhysicalDeviceMemoryPriorityFeaturesEXT* structure = (VkPhysicalDeviceMemoryPriorityFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::memoryPriority), structure->memoryPriority);
@@ -2085,10 +1894,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_dedicated_allocation_image_aliasing)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_dedicated_allocation_image_aliasing) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV",
+                                                               "VK_NV_dedicated_allocation_image_aliasing");
                 }
                 VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV* structure =
                     (VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV*)header;
@@ -2103,10 +1911,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceBufferDeviceAddressFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_buffer_device_address)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceBufferDeviceAddressFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_buffer_device_address) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceBufferDeviceAddressFeaturesEXT",
+                                                               "VK_EXT_buffer_device_address");
                 }
                 VkPhysicalDeviceBufferDeviceAddressFeaturesEXT* structure = (VkPhysicalDeviceBufferDeviceAddressFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::bufferDeviceAddress), structure->bufferDeviceAddress);
@@ -2125,10 +1932,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCooperativeMatrixFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_cooperative_matrix)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCooperativeMatrixFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_cooperative_matrix) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceCooperativeMatrixFeaturesNV",
+                                                               "VK_NV_cooperative_matrix");
                 }
                 VkPhysicalDeviceCooperativeMatrixFeaturesNV* structure = (VkPhysicalDeviceCooperativeMatrixFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::cooperativeMatrix), structure->cooperativeMatrix);
@@ -2144,10 +1949,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCoverageReductionModeFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_coverage_reduction_mode)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCoverageReductionModeFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_coverage_reduction_mode) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceCoverageReductionModeFeaturesNV",
+                                                               "VK_NV_coverage_reduction_mode");
                 }
                 VkPhysicalDeviceCoverageReductionModeFeaturesNV* structure =
                     (VkPhysicalDeviceCoverageReductionModeFeaturesNV*)header;
@@ -2161,10 +1965,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_fragment_shader_interlock)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_fragment_shader_interlock) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT",
+                                                               "VK_EXT_fragment_shader_interlock");
                 }
                 VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT* structure =
                     (VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT*)header;
@@ -2184,10 +1987,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceYcbcrImageArraysFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_ycbcr_image_arrays)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceYcbcrImageArraysFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_ycbcr_image_arrays) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceYcbcrImageArraysFeaturesEXT",
+                                                               "VK_EXT_ycbcr_image_arrays");
                 }
                 VkPhysicalDeviceYcbcrImageArraysFeaturesEXT* structure = (VkPhysicalDeviceYcbcrImageArraysFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::ycbcrImageArrays), structure->ycbcrImageArrays);
@@ -2200,10 +2001,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceProvokingVertexFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_provoking_vertex)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceProvokingVertexFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_provoking_vertex) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceProvokingVertexFeaturesEXT",
+                                                               "VK_EXT_provoking_vertex");
                 }
                 VkPhysicalDeviceProvokingVertexFeaturesEXT* structure = (VkPhysicalDeviceProvokingVertexFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::provokingVertexLast), structure->provokingVertexLast);
@@ -2219,10 +2018,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderAtomicFloatFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_shader_atomic_float)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderAtomicFloatFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_shader_atomic_float) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderAtomicFloatFeaturesEXT",
+                                                               "VK_EXT_shader_atomic_float");
                 }
                 VkPhysicalDeviceShaderAtomicFloatFeaturesEXT* structure = (VkPhysicalDeviceShaderAtomicFloatFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderBufferFloat32Atomics), structure->shaderBufferFloat32Atomics);
@@ -2257,10 +2055,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceExtendedDynamicStateFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_extended_dynamic_state)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceExtendedDynamicStateFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_extended_dynamic_state) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceExtendedDynamicStateFeaturesEXT",
+                                                               "VK_EXT_extended_dynamic_state");
                 }
                 VkPhysicalDeviceExtendedDynamicStateFeaturesEXT* structure =
                     (VkPhysicalDeviceExtendedDynamicStateFeaturesEXT*)header;
@@ -2274,10 +2071,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceHostImageCopyFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_host_image_copy)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceHostImageCopyFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_host_image_copy) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceHostImageCopyFeaturesEXT",
+                                                               "VK_EXT_host_image_copy");
                 }
                 VkPhysicalDeviceHostImageCopyFeaturesEXT* structure = (VkPhysicalDeviceHostImageCopyFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::hostImageCopy), structure->hostImageCopy);
@@ -2290,10 +2085,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMapMemoryPlacedFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_map_memory_placed)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMapMemoryPlacedFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_map_memory_placed) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMapMemoryPlacedFeaturesEXT",
+                                                               "VK_EXT_map_memory_placed");
                 }
                 VkPhysicalDeviceMapMemoryPlacedFeaturesEXT* structure = (VkPhysicalDeviceMapMemoryPlacedFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::memoryMapPlaced), structure->memoryMapPlaced);
@@ -2310,10 +2103,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_shader_atomic_float2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_shader_atomic_float2) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT",
+                                                               "VK_EXT_shader_atomic_float2");
                 }
                 VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT* structure = (VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderBufferFloat16Atomics), structure->shaderBufferFloat16Atomics);
@@ -2356,10 +2148,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_swapchain_maintenance1)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_swapchain_maintenance1) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT",
+                                                               "VK_EXT_swapchain_maintenance1");
                 }
                 VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT* structure =
                     (VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT*)header;
@@ -2373,10 +2164,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_device_generated_commands)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_device_generated_commands) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV",
+                                                               "VK_NV_device_generated_commands");
                 }
                 VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV* structure =
                     (VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV*)header;
@@ -2390,10 +2180,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceInheritedViewportScissorFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_inherited_viewport_scissor)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceInheritedViewportScissorFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_inherited_viewport_scissor) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceInheritedViewportScissorFeaturesNV",
+                                                               "VK_NV_inherited_viewport_scissor");
                 }
                 VkPhysicalDeviceInheritedViewportScissorFeaturesNV* structure =
                     (VkPhysicalDeviceInheritedViewportScissorFeaturesNV*)header;
@@ -2407,10 +2196,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_texel_buffer_alignment)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_texel_buffer_alignment) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT",
+                                                               "VK_EXT_texel_buffer_alignment");
                 }
                 VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT* structure =
                     (VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT*)header;
@@ -2424,10 +2212,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDepthBiasControlFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_depth_bias_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDepthBiasControlFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_depth_bias_control) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceDepthBiasControlFeaturesEXT",
+                                                               "VK_EXT_depth_bias_control");
                 }
                 VkPhysicalDeviceDepthBiasControlFeaturesEXT* structure = (VkPhysicalDeviceDepthBiasControlFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::depthBiasControl), structure->depthBiasControl);
@@ -2447,10 +2233,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDeviceMemoryReportFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_device_memory_report)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDeviceMemoryReportFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_device_memory_report) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDeviceMemoryReportFeaturesEXT",
+                                                               "VK_EXT_device_memory_report");
                 }
                 VkPhysicalDeviceDeviceMemoryReportFeaturesEXT* structure = (VkPhysicalDeviceDeviceMemoryReportFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::deviceMemoryReport), structure->deviceMemoryReport);
@@ -2463,10 +2248,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRobustness2FeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_robustness2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRobustness2FeaturesEXT, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_EXT_robustness2) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceRobustness2FeaturesEXT",
+                                                               "VK_EXT_robustness2");
                 }
                 VkPhysicalDeviceRobustness2FeaturesEXT* structure = (VkPhysicalDeviceRobustness2FeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::robustBufferAccess2), structure->robustBufferAccess2);
@@ -2483,10 +2266,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCustomBorderColorFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_custom_border_color)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCustomBorderColorFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_custom_border_color) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceCustomBorderColorFeaturesEXT",
+                                                               "VK_EXT_custom_border_color");
                 }
                 VkPhysicalDeviceCustomBorderColorFeaturesEXT* structure = (VkPhysicalDeviceCustomBorderColorFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::customBorderColors), structure->customBorderColors);
@@ -2502,10 +2284,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePresentBarrierFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_present_barrier)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePresentBarrierFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_present_barrier) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDevicePresentBarrierFeaturesNV",
+                                                               "VK_NV_present_barrier");
                 }
                 VkPhysicalDevicePresentBarrierFeaturesNV* structure = (VkPhysicalDevicePresentBarrierFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::presentBarrier), structure->presentBarrier);
@@ -2518,10 +2298,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDiagnosticsConfigFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_device_diagnostics_config)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDiagnosticsConfigFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_device_diagnostics_config) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceDiagnosticsConfigFeaturesNV",
+                                                               "VK_NV_device_diagnostics_config");
                 }
                 VkPhysicalDeviceDiagnosticsConfigFeaturesNV* structure = (VkPhysicalDeviceDiagnosticsConfigFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::diagnosticsConfig), structure->diagnosticsConfig);
@@ -2534,10 +2312,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCudaKernelLaunchFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_cuda_kernel_launch)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCudaKernelLaunchFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_cuda_kernel_launch) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceCudaKernelLaunchFeaturesNV",
+                                                               "VK_NV_cuda_kernel_launch");
                 }
                 VkPhysicalDeviceCudaKernelLaunchFeaturesNV* structure = (VkPhysicalDeviceCudaKernelLaunchFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::cudaKernelLaunchFeatures), structure->cudaKernelLaunchFeatures);
@@ -2550,10 +2326,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDescriptorBufferFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_descriptor_buffer)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDescriptorBufferFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_descriptor_buffer) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceDescriptorBufferFeaturesEXT",
+                                                               "VK_EXT_descriptor_buffer");
                 }
                 VkPhysicalDeviceDescriptorBufferFeaturesEXT* structure = (VkPhysicalDeviceDescriptorBufferFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::descriptorBuffer), structure->descriptorBuffer);
@@ -2575,10 +2349,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_graphics_pipeline_library)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_graphics_pipeline_library) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT",
+                                                               "VK_EXT_graphics_pipeline_library");
                 }
                 VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT* structure =
                     (VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT*)header;
@@ -2593,10 +2366,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD);
                 if (!IsExtEnabled(device_extensions.vk_amd_shader_early_and_late_fragment_tests)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_AMD_shader_early_and_late_fragment_tests) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD",
+                                                               "VK_AMD_shader_early_and_late_fragment_tests");
                 }
                 VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD* structure =
                     (VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD*)header;
@@ -2611,10 +2383,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_fragment_shading_rate_enums)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_fragment_shading_rate_enums) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV",
+                                                               "VK_NV_fragment_shading_rate_enums");
                 }
                 VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV* structure =
                     (VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV*)header;
@@ -2634,10 +2405,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRayTracingMotionBlurFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_ray_tracing_motion_blur)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRayTracingMotionBlurFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_ray_tracing_motion_blur) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceRayTracingMotionBlurFeaturesNV",
+                                                               "VK_NV_ray_tracing_motion_blur");
                 }
                 VkPhysicalDeviceRayTracingMotionBlurFeaturesNV* structure = (VkPhysicalDeviceRayTracingMotionBlurFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::rayTracingMotionBlur), structure->rayTracingMotionBlur);
@@ -2653,10 +2423,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_ycbcr_2plane_444_formats)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_ycbcr_2plane_444_formats) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT",
+                                                               "VK_EXT_ycbcr_2plane_444_formats");
                 }
                 VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT* structure =
                     (VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT*)header;
@@ -2670,10 +2439,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFragmentDensityMap2FeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_fragment_density_map2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceFragmentDensityMap2FeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_fragment_density_map2) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceFragmentDensityMap2FeaturesEXT",
+                                                               "VK_EXT_fragment_density_map2");
                 }
                 VkPhysicalDeviceFragmentDensityMap2FeaturesEXT* structure = (VkPhysicalDeviceFragmentDensityMap2FeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::fragmentDensityMapDeferred), structure->fragmentDensityMapDeferred);
@@ -2686,10 +2454,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImageCompressionControlFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_image_compression_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImageCompressionControlFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_image_compression_control) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceImageCompressionControlFeaturesEXT",
+                                                               "VK_EXT_image_compression_control");
                 }
                 VkPhysicalDeviceImageCompressionControlFeaturesEXT* structure =
                     (VkPhysicalDeviceImageCompressionControlFeaturesEXT*)header;
@@ -2704,10 +2471,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_attachment_feedback_loop_layout)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_attachment_feedback_loop_layout) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT",
+                                                               "VK_EXT_attachment_feedback_loop_layout");
                 }
                 VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT* structure =
                     (VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT*)header;
@@ -2721,10 +2487,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevice4444FormatsFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_4444_formats)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevice4444FormatsFeaturesEXT, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_EXT_4444_formats) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDevice4444FormatsFeaturesEXT",
+                                                               "VK_EXT_4444_formats");
                 }
                 VkPhysicalDevice4444FormatsFeaturesEXT* structure = (VkPhysicalDevice4444FormatsFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::formatA4R4G4B4), structure->formatA4R4G4B4);
@@ -2738,10 +2502,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFaultFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_device_fault)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceFaultFeaturesEXT, but when creating VkDevice, the "
-                                     "parent extension "
-                                     "(VK_EXT_device_fault) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceFaultFeaturesEXT",
+                                                               "VK_EXT_device_fault");
                 }
                 VkPhysicalDeviceFaultFeaturesEXT* structure = (VkPhysicalDeviceFaultFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::deviceFault), structure->deviceFault);
@@ -2758,11 +2520,10 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                     loc.pNext(Struct::VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_arm_rasterization_order_attachment_access) &&
                     !IsExtEnabled(device_extensions.vk_ext_rasterization_order_attachment_access)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT, but "
-                                     "when creating VkDevice, the parent extension "
-                                     "(VK_ARM_rasterization_order_attachment_access or "
-                                     "VK_EXT_rasterization_order_attachment_access) was not included in ppEnabledExtensionNames.");
+                    skip |=
+                        LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                           "VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT",
+                                                           "VK_ARM_rasterization_order_attachment_access or VK_EXT_rasterization_order_attachment_access");
                 }
                 VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT* structure =
                     (VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT*)header;
@@ -2783,10 +2544,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_rgba10x6_formats)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_rgba10x6_formats) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT",
+                                                               "VK_EXT_rgba10x6_formats");
                 }
                 VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT* structure = (VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::formatRgba10x6WithoutYCbCrSampler),
@@ -2801,11 +2560,10 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_valve_mutable_descriptor_type) &&
                     !IsExtEnabled(device_extensions.vk_ext_mutable_descriptor_type)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_VALVE_mutable_descriptor_type or VK_EXT_mutable_descriptor_type) was not included in "
-                                     "ppEnabledExtensionNames.");
+                    skip |=
+                        LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                           "VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT",
+                                                           "VK_VALVE_mutable_descriptor_type or VK_EXT_mutable_descriptor_type");
                 }
                 VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT* structure =
                     (VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT*)header;
@@ -2819,10 +2577,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_vertex_input_dynamic_state)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_vertex_input_dynamic_state) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT",
+                                                               "VK_EXT_vertex_input_dynamic_state");
                 }
                 VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT* structure =
                     (VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT*)header;
@@ -2836,10 +2593,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceAddressBindingReportFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_device_address_binding_report)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceAddressBindingReportFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_device_address_binding_report) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceAddressBindingReportFeaturesEXT",
+                                                               "VK_EXT_device_address_binding_report");
                 }
                 VkPhysicalDeviceAddressBindingReportFeaturesEXT* structure =
                     (VkPhysicalDeviceAddressBindingReportFeaturesEXT*)header;
@@ -2853,10 +2609,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDepthClipControlFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_depth_clip_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDepthClipControlFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_depth_clip_control) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceDepthClipControlFeaturesEXT",
+                                                               "VK_EXT_depth_clip_control");
                 }
                 VkPhysicalDeviceDepthClipControlFeaturesEXT* structure = (VkPhysicalDeviceDepthClipControlFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::depthClipControl), structure->depthClipControl);
@@ -2870,10 +2624,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_primitive_topology_list_restart)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_primitive_topology_list_restart) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT",
+                                                               "VK_EXT_primitive_topology_list_restart");
                 }
                 VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT* structure =
                     (VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT*)header;
@@ -2891,10 +2644,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDevicePresentModeFifoLatestReadyFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_present_mode_fifo_latest_ready)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePresentModeFifoLatestReadyFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_present_mode_fifo_latest_ready) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePresentModeFifoLatestReadyFeaturesEXT",
+                                                               "VK_EXT_present_mode_fifo_latest_ready");
                 }
                 VkPhysicalDevicePresentModeFifoLatestReadyFeaturesEXT* structure =
                     (VkPhysicalDevicePresentModeFifoLatestReadyFeaturesEXT*)header;
@@ -2908,10 +2660,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceSubpassShadingFeaturesHUAWEI);
                 if (!IsExtEnabled(device_extensions.vk_huawei_subpass_shading)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceSubpassShadingFeaturesHUAWEI, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_HUAWEI_subpass_shading) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceSubpassShadingFeaturesHUAWEI",
+                                                               "VK_HUAWEI_subpass_shading");
                 }
                 VkPhysicalDeviceSubpassShadingFeaturesHUAWEI* structure = (VkPhysicalDeviceSubpassShadingFeaturesHUAWEI*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::subpassShading), structure->subpassShading);
@@ -2924,10 +2675,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceInvocationMaskFeaturesHUAWEI);
                 if (!IsExtEnabled(device_extensions.vk_huawei_invocation_mask)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceInvocationMaskFeaturesHUAWEI, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_HUAWEI_invocation_mask) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceInvocationMaskFeaturesHUAWEI",
+                                                               "VK_HUAWEI_invocation_mask");
                 }
                 VkPhysicalDeviceInvocationMaskFeaturesHUAWEI* structure = (VkPhysicalDeviceInvocationMaskFeaturesHUAWEI*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::invocationMask), structure->invocationMask);
@@ -2940,10 +2690,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceExternalMemoryRDMAFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_external_memory_rdma)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceExternalMemoryRDMAFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_external_memory_rdma) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceExternalMemoryRDMAFeaturesNV",
+                                                               "VK_NV_external_memory_rdma");
                 }
                 VkPhysicalDeviceExternalMemoryRDMAFeaturesNV* structure = (VkPhysicalDeviceExternalMemoryRDMAFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::externalMemoryRDMA), structure->externalMemoryRDMA);
@@ -2956,10 +2705,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePipelinePropertiesFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_pipeline_properties)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePipelinePropertiesFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_pipeline_properties) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePipelinePropertiesFeaturesEXT",
+                                                               "VK_EXT_pipeline_properties");
                 }
                 VkPhysicalDevicePipelinePropertiesFeaturesEXT* structure = (VkPhysicalDevicePipelinePropertiesFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::pipelinePropertiesIdentifier), structure->pipelinePropertiesIdentifier);
@@ -2972,10 +2720,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFrameBoundaryFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_frame_boundary)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceFrameBoundaryFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_frame_boundary) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceFrameBoundaryFeaturesEXT",
+                                                               "VK_EXT_frame_boundary");
                 }
                 VkPhysicalDeviceFrameBoundaryFeaturesEXT* structure = (VkPhysicalDeviceFrameBoundaryFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::frameBoundary), structure->frameBoundary);
@@ -2989,10 +2735,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_multisampled_render_to_single_sampled)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT, but "
-                                     "when creating VkDevice, the parent extension "
-                                     "(VK_EXT_multisampled_render_to_single_sampled) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT",
+                                                               "VK_EXT_multisampled_render_to_single_sampled");
                 }
                 VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT* structure =
                     (VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT*)header;
@@ -3007,10 +2752,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceExtendedDynamicState2FeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_extended_dynamic_state2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceExtendedDynamicState2FeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_extended_dynamic_state2) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceExtendedDynamicState2FeaturesEXT",
+                                                               "VK_EXT_extended_dynamic_state2");
                 }
                 VkPhysicalDeviceExtendedDynamicState2FeaturesEXT* structure =
                     (VkPhysicalDeviceExtendedDynamicState2FeaturesEXT*)header;
@@ -3029,10 +2773,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceColorWriteEnableFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_color_write_enable)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceColorWriteEnableFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_color_write_enable) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceColorWriteEnableFeaturesEXT",
+                                                               "VK_EXT_color_write_enable");
                 }
                 VkPhysicalDeviceColorWriteEnableFeaturesEXT* structure = (VkPhysicalDeviceColorWriteEnableFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::colorWriteEnable), structure->colorWriteEnable);
@@ -3045,10 +2787,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_primitives_generated_query)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_primitives_generated_query) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT",
+                                                               "VK_EXT_primitives_generated_query");
                 }
                 VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT* structure =
                     (VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT*)header;
@@ -3068,10 +2809,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImageViewMinLodFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_image_view_min_lod)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImageViewMinLodFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_image_view_min_lod) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceImageViewMinLodFeaturesEXT",
+                                                               "VK_EXT_image_view_min_lod");
                 }
                 VkPhysicalDeviceImageViewMinLodFeaturesEXT* structure = (VkPhysicalDeviceImageViewMinLodFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::minLod), structure->minLod);
@@ -3084,10 +2823,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMultiDrawFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_multi_draw)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMultiDrawFeaturesEXT, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_EXT_multi_draw) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMultiDrawFeaturesEXT",
+                                                               "VK_EXT_multi_draw");
                 }
                 VkPhysicalDeviceMultiDrawFeaturesEXT* structure = (VkPhysicalDeviceMultiDrawFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::multiDraw), structure->multiDraw);
@@ -3100,10 +2837,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImage2DViewOf3DFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_image_2d_view_of_3d)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImage2DViewOf3DFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_image_2d_view_of_3d) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceImage2DViewOf3DFeaturesEXT",
+                                                               "VK_EXT_image_2d_view_of_3d");
                 }
                 VkPhysicalDeviceImage2DViewOf3DFeaturesEXT* structure = (VkPhysicalDeviceImage2DViewOf3DFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::image2DViewOf3D), structure->image2DViewOf3D);
@@ -3118,10 +2853,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderTileImageFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_shader_tile_image)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderTileImageFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_shader_tile_image) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceShaderTileImageFeaturesEXT",
+                                                               "VK_EXT_shader_tile_image");
                 }
                 VkPhysicalDeviceShaderTileImageFeaturesEXT* structure = (VkPhysicalDeviceShaderTileImageFeaturesEXT*)header;
                 skip |=
@@ -3141,10 +2874,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceOpacityMicromapFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_opacity_micromap)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceOpacityMicromapFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_opacity_micromap) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceOpacityMicromapFeaturesEXT",
+                                                               "VK_EXT_opacity_micromap");
                 }
                 VkPhysicalDeviceOpacityMicromapFeaturesEXT* structure = (VkPhysicalDeviceOpacityMicromapFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::micromap), structure->micromap);
@@ -3162,10 +2893,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDisplacementMicromapFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_displacement_micromap)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDisplacementMicromapFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_displacement_micromap) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDisplacementMicromapFeaturesNV",
+                                                               "VK_NV_displacement_micromap");
                 }
                 VkPhysicalDeviceDisplacementMicromapFeaturesNV* structure = (VkPhysicalDeviceDisplacementMicromapFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::displacementMicromap), structure->displacementMicromap);
@@ -3179,10 +2909,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI);
                 if (!IsExtEnabled(device_extensions.vk_huawei_cluster_culling_shader)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_HUAWEI_cluster_culling_shader) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI",
+                                                               "VK_HUAWEI_cluster_culling_shader");
                 }
                 VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI* structure =
                     (VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI*)header;
@@ -3199,10 +2928,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceBorderColorSwizzleFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_border_color_swizzle)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceBorderColorSwizzleFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_border_color_swizzle) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceBorderColorSwizzleFeaturesEXT",
+                                                               "VK_EXT_border_color_swizzle");
                 }
                 VkPhysicalDeviceBorderColorSwizzleFeaturesEXT* structure = (VkPhysicalDeviceBorderColorSwizzleFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::borderColorSwizzle), structure->borderColorSwizzle);
@@ -3217,10 +2945,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_pageable_device_local_memory)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_pageable_device_local_memory) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT",
+                                                               "VK_EXT_pageable_device_local_memory");
                 }
                 VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT* structure =
                     (VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT*)header;
@@ -3234,10 +2961,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceSchedulingControlsFeaturesARM);
                 if (!IsExtEnabled(device_extensions.vk_arm_scheduling_controls)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceSchedulingControlsFeaturesARM, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_ARM_scheduling_controls) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceSchedulingControlsFeaturesARM",
+                                                               "VK_ARM_scheduling_controls");
                 }
                 VkPhysicalDeviceSchedulingControlsFeaturesARM* structure = (VkPhysicalDeviceSchedulingControlsFeaturesARM*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::schedulingControls), structure->schedulingControls);
@@ -3250,10 +2976,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_image_sliced_view_of_3d)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_image_sliced_view_of_3d) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT",
+                                                               "VK_EXT_image_sliced_view_of_3d");
                 }
                 VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT* structure = (VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::imageSlicedViewOf3D), structure->imageSlicedViewOf3D);
@@ -3267,10 +2992,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE);
                 if (!IsExtEnabled(device_extensions.vk_valve_descriptor_set_host_mapping)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_VALVE_descriptor_set_host_mapping) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE",
+                                                               "VK_VALVE_descriptor_set_host_mapping");
                 }
                 VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE* structure =
                     (VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE*)header;
@@ -3284,10 +3008,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDepthClampZeroOneFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_depth_clamp_zero_one)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDepthClampZeroOneFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_depth_clamp_zero_one) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDepthClampZeroOneFeaturesEXT",
+                                                               "VK_EXT_depth_clamp_zero_one");
                 }
                 VkPhysicalDeviceDepthClampZeroOneFeaturesEXT* structure = (VkPhysicalDeviceDepthClampZeroOneFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::depthClampZeroOne), structure->depthClampZeroOne);
@@ -3300,10 +3023,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_non_seamless_cube_map)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_non_seamless_cube_map) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT",
+                                                               "VK_EXT_non_seamless_cube_map");
                 }
                 VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT* structure = (VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::nonSeamlessCubeMap), structure->nonSeamlessCubeMap);
@@ -3316,10 +3038,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRenderPassStripedFeaturesARM);
                 if (!IsExtEnabled(device_extensions.vk_arm_render_pass_striped)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRenderPassStripedFeaturesARM, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_ARM_render_pass_striped) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceRenderPassStripedFeaturesARM",
+                                                               "VK_ARM_render_pass_striped");
                 }
                 VkPhysicalDeviceRenderPassStripedFeaturesARM* structure = (VkPhysicalDeviceRenderPassStripedFeaturesARM*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::renderPassStriped), structure->renderPassStriped);
@@ -3332,10 +3053,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_fragment_density_map_offset)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_QCOM_fragment_density_map_offset) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM",
+                                                               "VK_QCOM_fragment_density_map_offset");
                 }
                 VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM* structure =
                     (VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM*)header;
@@ -3349,10 +3069,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCopyMemoryIndirectFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_copy_memory_indirect)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCopyMemoryIndirectFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_copy_memory_indirect) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceCopyMemoryIndirectFeaturesNV",
+                                                               "VK_NV_copy_memory_indirect");
                 }
                 VkPhysicalDeviceCopyMemoryIndirectFeaturesNV* structure = (VkPhysicalDeviceCopyMemoryIndirectFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::indirectCopy), structure->indirectCopy);
@@ -3365,10 +3084,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMemoryDecompressionFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_memory_decompression)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMemoryDecompressionFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_memory_decompression) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceMemoryDecompressionFeaturesNV",
+                                                               "VK_NV_memory_decompression");
                 }
                 VkPhysicalDeviceMemoryDecompressionFeaturesNV* structure = (VkPhysicalDeviceMemoryDecompressionFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::memoryDecompression), structure->memoryDecompression);
@@ -3382,10 +3100,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_device_generated_commands_compute)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_device_generated_commands_compute) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV",
+                                                               "VK_NV_device_generated_commands_compute");
                 }
                 VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV* structure =
                     (VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV*)header;
@@ -3405,10 +3122,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceLinearColorAttachmentFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_linear_color_attachment)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceLinearColorAttachmentFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_linear_color_attachment) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceLinearColorAttachmentFeaturesNV",
+                                                               "VK_NV_linear_color_attachment");
                 }
                 VkPhysicalDeviceLinearColorAttachmentFeaturesNV* structure =
                     (VkPhysicalDeviceLinearColorAttachmentFeaturesNV*)header;
@@ -3423,10 +3139,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_image_compression_control_swapchain)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT, but "
-                                     "when creating VkDevice, the parent extension "
-                                     "(VK_EXT_image_compression_control_swapchain) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT",
+                                                               "VK_EXT_image_compression_control_swapchain");
                 }
                 VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT* structure =
                     (VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT*)header;
@@ -3441,10 +3156,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImageProcessingFeaturesQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_image_processing)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImageProcessingFeaturesQCOM, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_QCOM_image_processing) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceImageProcessingFeaturesQCOM",
+                                                               "VK_QCOM_image_processing");
                 }
                 VkPhysicalDeviceImageProcessingFeaturesQCOM* structure = (VkPhysicalDeviceImageProcessingFeaturesQCOM*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::textureSampleWeighted), structure->textureSampleWeighted);
@@ -3461,10 +3174,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceNestedCommandBufferFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_nested_command_buffer)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceNestedCommandBufferFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_nested_command_buffer) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceNestedCommandBufferFeaturesEXT",
+                                                               "VK_EXT_nested_command_buffer");
                 }
                 VkPhysicalDeviceNestedCommandBufferFeaturesEXT* structure = (VkPhysicalDeviceNestedCommandBufferFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::nestedCommandBuffer), structure->nestedCommandBuffer);
@@ -3482,10 +3194,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceExtendedDynamicState3FeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_extended_dynamic_state3)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceExtendedDynamicState3FeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_extended_dynamic_state3) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceExtendedDynamicState3FeaturesEXT",
+                                                               "VK_EXT_extended_dynamic_state3");
                 }
                 VkPhysicalDeviceExtendedDynamicState3FeaturesEXT* structure =
                     (VkPhysicalDeviceExtendedDynamicState3FeaturesEXT*)header;
@@ -3590,10 +3301,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_subpass_merge_feedback)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_subpass_merge_feedback) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT",
+                                                               "VK_EXT_subpass_merge_feedback");
                 }
                 VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT* structure =
                     (VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT*)header;
@@ -3607,10 +3317,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_shader_module_identifier)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_shader_module_identifier) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT",
+                                                               "VK_EXT_shader_module_identifier");
                 }
                 VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT* structure =
                     (VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT*)header;
@@ -3624,10 +3333,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceOpticalFlowFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_optical_flow)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceOpticalFlowFeaturesNV, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_NV_optical_flow) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceOpticalFlowFeaturesNV",
+                                                               "VK_NV_optical_flow");
                 }
                 VkPhysicalDeviceOpticalFlowFeaturesNV* structure = (VkPhysicalDeviceOpticalFlowFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::opticalFlow), structure->opticalFlow);
@@ -3640,10 +3347,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceLegacyDitheringFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_legacy_dithering)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceLegacyDitheringFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_legacy_dithering) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceLegacyDitheringFeaturesEXT",
+                                                               "VK_EXT_legacy_dithering");
                 }
                 VkPhysicalDeviceLegacyDitheringFeaturesEXT* structure = (VkPhysicalDeviceLegacyDitheringFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::legacyDithering), structure->legacyDithering);
@@ -3656,10 +3361,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePipelineProtectedAccessFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_pipeline_protected_access)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePipelineProtectedAccessFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_pipeline_protected_access) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePipelineProtectedAccessFeaturesEXT",
+                                                               "VK_EXT_pipeline_protected_access");
                 }
                 VkPhysicalDevicePipelineProtectedAccessFeaturesEXT* structure =
                     (VkPhysicalDevicePipelineProtectedAccessFeaturesEXT*)header;
@@ -3674,10 +3378,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceExternalFormatResolveFeaturesANDROID);
                 if (!IsExtEnabled(device_extensions.vk_android_external_format_resolve)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceExternalFormatResolveFeaturesANDROID, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_ANDROID_external_format_resolve) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceExternalFormatResolveFeaturesANDROID",
+                                                               "VK_ANDROID_external_format_resolve");
                 }
                 VkPhysicalDeviceExternalFormatResolveFeaturesANDROID* structure =
                     (VkPhysicalDeviceExternalFormatResolveFeaturesANDROID*)header;
@@ -3692,10 +3395,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceAntiLagFeaturesAMD);
                 if (!IsExtEnabled(device_extensions.vk_amd_anti_lag)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceAntiLagFeaturesAMD, but when creating VkDevice, the "
-                                     "parent extension "
-                                     "(VK_AMD_anti_lag) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceAntiLagFeaturesAMD",
+                                                               "VK_AMD_anti_lag");
                 }
                 VkPhysicalDeviceAntiLagFeaturesAMD* structure = (VkPhysicalDeviceAntiLagFeaturesAMD*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::antiLag), structure->antiLag);
@@ -3708,10 +3409,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderObjectFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_shader_object)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderObjectFeaturesEXT, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_EXT_shader_object) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceShaderObjectFeaturesEXT",
+                                                               "VK_EXT_shader_object");
                 }
                 VkPhysicalDeviceShaderObjectFeaturesEXT* structure = (VkPhysicalDeviceShaderObjectFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderObject), structure->shaderObject);
@@ -3724,10 +3423,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceTilePropertiesFeaturesQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_tile_properties)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceTilePropertiesFeaturesQCOM, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_QCOM_tile_properties) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceTilePropertiesFeaturesQCOM",
+                                                               "VK_QCOM_tile_properties");
                 }
                 VkPhysicalDeviceTilePropertiesFeaturesQCOM* structure = (VkPhysicalDeviceTilePropertiesFeaturesQCOM*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::tileProperties), structure->tileProperties);
@@ -3740,10 +3437,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceAmigoProfilingFeaturesSEC);
                 if (!IsExtEnabled(device_extensions.vk_sec_amigo_profiling)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceAmigoProfilingFeaturesSEC, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_SEC_amigo_profiling) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceAmigoProfilingFeaturesSEC",
+                                                               "VK_SEC_amigo_profiling");
                 }
                 VkPhysicalDeviceAmigoProfilingFeaturesSEC* structure = (VkPhysicalDeviceAmigoProfilingFeaturesSEC*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::amigoProfiling), structure->amigoProfiling);
@@ -3757,10 +3452,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_multiview_per_view_viewports)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_QCOM_multiview_per_view_viewports) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM",
+                                                               "VK_QCOM_multiview_per_view_viewports");
                 }
                 VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM* structure =
                     (VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM*)header;
@@ -3775,10 +3469,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_ray_tracing_invocation_reorder)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_ray_tracing_invocation_reorder) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV",
+                                                               "VK_NV_ray_tracing_invocation_reorder");
                 }
                 VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV* structure =
                     (VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV*)header;
@@ -3792,10 +3485,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_extended_sparse_address_space)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_extended_sparse_address_space) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV",
+                                                               "VK_NV_extended_sparse_address_space");
                 }
                 VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV* structure =
                     (VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV*)header;
@@ -3809,10 +3501,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_legacy_vertex_attributes)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_legacy_vertex_attributes) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT",
+                                                               "VK_EXT_legacy_vertex_attributes");
                 }
                 VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT* structure =
                     (VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT*)header;
@@ -3826,10 +3517,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM);
                 if (!IsExtEnabled(device_extensions.vk_arm_shader_core_builtins)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_ARM_shader_core_builtins) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM",
+                                                               "VK_ARM_shader_core_builtins");
                 }
                 VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM* structure = (VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderCoreBuiltins), structure->shaderCoreBuiltins);
@@ -3843,10 +3533,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_pipeline_library_group_handles)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_pipeline_library_group_handles) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT",
+                                                               "VK_EXT_pipeline_library_group_handles");
                 }
                 VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT* structure =
                     (VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT*)header;
@@ -3861,10 +3550,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_dynamic_rendering_unused_attachments)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT, but "
-                                     "when creating VkDevice, the parent extension "
-                                     "(VK_EXT_dynamic_rendering_unused_attachments) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT",
+                                                               "VK_EXT_dynamic_rendering_unused_attachments");
                 }
                 VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT* structure =
                     (VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT*)header;
@@ -3880,10 +3568,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_multiview_per_view_render_areas)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_QCOM_multiview_per_view_render_areas) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM",
+                                                               "VK_QCOM_multiview_per_view_render_areas");
                 }
                 VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM* structure =
                     (VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM*)header;
@@ -3897,10 +3584,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePerStageDescriptorSetFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_per_stage_descriptor_set)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDevicePerStageDescriptorSetFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_per_stage_descriptor_set) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDevicePerStageDescriptorSetFeaturesNV",
+                                                               "VK_NV_per_stage_descriptor_set");
                 }
                 VkPhysicalDevicePerStageDescriptorSetFeaturesNV* structure =
                     (VkPhysicalDevicePerStageDescriptorSetFeaturesNV*)header;
@@ -3916,10 +3602,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImageProcessing2FeaturesQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_image_processing2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImageProcessing2FeaturesQCOM, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_QCOM_image_processing2) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceImageProcessing2FeaturesQCOM",
+                                                               "VK_QCOM_image_processing2");
                 }
                 VkPhysicalDeviceImageProcessing2FeaturesQCOM* structure = (VkPhysicalDeviceImageProcessing2FeaturesQCOM*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::textureBlockMatch2), structure->textureBlockMatch2);
@@ -3932,10 +3617,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCubicWeightsFeaturesQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_filter_cubic_weights)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCubicWeightsFeaturesQCOM, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_QCOM_filter_cubic_weights) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceCubicWeightsFeaturesQCOM",
+                                                               "VK_QCOM_filter_cubic_weights");
                 }
                 VkPhysicalDeviceCubicWeightsFeaturesQCOM* structure = (VkPhysicalDeviceCubicWeightsFeaturesQCOM*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::selectableCubicWeights), structure->selectableCubicWeights);
@@ -3948,10 +3631,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceYcbcrDegammaFeaturesQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_ycbcr_degamma)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceYcbcrDegammaFeaturesQCOM, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_QCOM_ycbcr_degamma) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceYcbcrDegammaFeaturesQCOM",
+                                                               "VK_QCOM_ycbcr_degamma");
                 }
                 VkPhysicalDeviceYcbcrDegammaFeaturesQCOM* structure = (VkPhysicalDeviceYcbcrDegammaFeaturesQCOM*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::ycbcrDegamma), structure->ycbcrDegamma);
@@ -3964,10 +3645,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCubicClampFeaturesQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_filter_cubic_clamp)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCubicClampFeaturesQCOM, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_QCOM_filter_cubic_clamp) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceCubicClampFeaturesQCOM",
+                                                               "VK_QCOM_filter_cubic_clamp");
                 }
                 VkPhysicalDeviceCubicClampFeaturesQCOM* structure = (VkPhysicalDeviceCubicClampFeaturesQCOM*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::cubicRangeClamp), structure->cubicRangeClamp);
@@ -3981,11 +3660,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_attachment_feedback_loop_dynamic_state)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc,
-                                 "includes a pointer to a VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT, but when "
-                                 "creating VkDevice, the parent extension "
-                                 "(VK_EXT_attachment_feedback_loop_dynamic_state) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT",
+                                                               "VK_EXT_attachment_feedback_loop_dynamic_state");
                 }
                 VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT* structure =
                     (VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT*)header;
@@ -4002,10 +3679,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX);
                 if (!IsExtEnabled(device_extensions.vk_qnx_external_memory_screen_buffer)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_QNX_external_memory_screen_buffer) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX",
+                                                               "VK_QNX_external_memory_screen_buffer");
                 }
                 VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX* structure =
                     (VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX*)header;
@@ -4021,10 +3697,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_descriptor_pool_overallocation)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_descriptor_pool_overallocation) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV",
+                                                               "VK_NV_descriptor_pool_overallocation");
                 }
                 VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV* structure =
                     (VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV*)header;
@@ -4038,10 +3713,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRawAccessChainsFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_raw_access_chains)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRawAccessChainsFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_raw_access_chains) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceRawAccessChainsFeaturesNV",
+                                                               "VK_NV_raw_access_chains");
                 }
                 VkPhysicalDeviceRawAccessChainsFeaturesNV* structure = (VkPhysicalDeviceRawAccessChainsFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::shaderRawAccessChains), structure->shaderRawAccessChains);
@@ -4054,10 +3727,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCommandBufferInheritanceFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_command_buffer_inheritance)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCommandBufferInheritanceFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_command_buffer_inheritance) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceCommandBufferInheritanceFeaturesNV",
+                                                               "VK_NV_command_buffer_inheritance");
                 }
                 VkPhysicalDeviceCommandBufferInheritanceFeaturesNV* structure =
                     (VkPhysicalDeviceCommandBufferInheritanceFeaturesNV*)header;
@@ -4071,10 +3743,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_shader_atomic_float16_vector)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_NV_shader_atomic_float16_vector) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV",
+                                                               "VK_NV_shader_atomic_float16_vector");
                 }
                 VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV* structure =
                     (VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV*)header;
@@ -4089,10 +3760,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_shader_replicated_composites)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_shader_replicated_composites) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT",
+                                                               "VK_EXT_shader_replicated_composites");
                 }
                 VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT* structure =
                     (VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT*)header;
@@ -4106,10 +3776,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRayTracingValidationFeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_ray_tracing_validation)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRayTracingValidationFeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_ray_tracing_validation) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceRayTracingValidationFeaturesNV",
+                                                               "VK_NV_ray_tracing_validation");
                 }
                 VkPhysicalDeviceRayTracingValidationFeaturesNV* structure = (VkPhysicalDeviceRayTracingValidationFeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::rayTracingValidation), structure->rayTracingValidation);
@@ -4122,10 +3791,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_device_generated_commands)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT, but when "
-                                     "creating VkDevice, the parent extension "
-                                     "(VK_EXT_device_generated_commands) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT",
+                                                               "VK_EXT_device_generated_commands");
                 }
                 VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT* structure =
                     (VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT*)header;
@@ -4142,10 +3810,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImageAlignmentControlFeaturesMESA);
                 if (!IsExtEnabled(device_extensions.vk_mesa_image_alignment_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceImageAlignmentControlFeaturesMESA, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_MESA_image_alignment_control) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceImageAlignmentControlFeaturesMESA",
+                                                               "VK_MESA_image_alignment_control");
                 }
                 VkPhysicalDeviceImageAlignmentControlFeaturesMESA* structure =
                     (VkPhysicalDeviceImageAlignmentControlFeaturesMESA*)header;
@@ -4159,10 +3826,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceDepthClampControlFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_depth_clamp_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceDepthClampControlFeaturesEXT, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_EXT_depth_clamp_control) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceDepthClampControlFeaturesEXT",
+                                                               "VK_EXT_depth_clamp_control");
                 }
                 VkPhysicalDeviceDepthClampControlFeaturesEXT* structure = (VkPhysicalDeviceDepthClampControlFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::depthClampControl), structure->depthClampControl);
@@ -4175,10 +3841,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceCooperativeMatrix2FeaturesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_cooperative_matrix2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceCooperativeMatrix2FeaturesNV, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_NV_cooperative_matrix2) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceCooperativeMatrix2FeaturesNV",
+                                                               "VK_NV_cooperative_matrix2");
                 }
                 VkPhysicalDeviceCooperativeMatrix2FeaturesNV* structure = (VkPhysicalDeviceCooperativeMatrix2FeaturesNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::cooperativeMatrixWorkgroupScope),
@@ -4207,10 +3872,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceAccelerationStructureFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_acceleration_structure)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceAccelerationStructureFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_acceleration_structure) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceAccelerationStructureFeaturesKHR",
+                                                               "VK_KHR_acceleration_structure");
                 }
                 VkPhysicalDeviceAccelerationStructureFeaturesKHR* structure =
                     (VkPhysicalDeviceAccelerationStructureFeaturesKHR*)header;
@@ -4236,10 +3900,9 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRayTracingPipelineFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_ray_tracing_pipeline)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRayTracingPipelineFeaturesKHR, but when creating "
-                                     "VkDevice, the parent extension "
-                                     "(VK_KHR_ray_tracing_pipeline) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc,
+                                                               "VkPhysicalDeviceRayTracingPipelineFeaturesKHR",
+                                                               "VK_KHR_ray_tracing_pipeline");
                 }
                 VkPhysicalDeviceRayTracingPipelineFeaturesKHR* structure = (VkPhysicalDeviceRayTracingPipelineFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::rayTracingPipeline), structure->rayTracingPipeline);
@@ -4263,10 +3926,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceRayQueryFeaturesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_ray_query)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceRayQueryFeaturesKHR, but when creating VkDevice, the "
-                                     "parent extension "
-                                     "(VK_KHR_ray_query) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceRayQueryFeaturesKHR",
+                                                               "VK_KHR_ray_query");
                 }
                 VkPhysicalDeviceRayQueryFeaturesKHR* structure = (VkPhysicalDeviceRayQueryFeaturesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::rayQuery), structure->rayQuery);
@@ -4279,10 +3940,8 @@ bool StatelessValidation::ValidatePnextFeatureStructContents(const Location& loc
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceMeshShaderFeaturesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_mesh_shader)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "includes a pointer to a VkPhysicalDeviceMeshShaderFeaturesEXT, but when creating VkDevice, "
-                                     "the parent extension "
-                                     "(VK_EXT_mesh_shader) was not included in ppEnabledExtensionNames.");
+                    skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "VkPhysicalDeviceMeshShaderFeaturesEXT",
+                                                               "VK_EXT_mesh_shader");
                 }
                 VkPhysicalDeviceMeshShaderFeaturesEXT* structure = (VkPhysicalDeviceMeshShaderFeaturesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::taskShader), structure->taskShader);
@@ -4316,14 +3975,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_1) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |=
-                        LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES) "
-                                 "which was added in VK_API_VERSION_1_1 but the "
-                                 "current effective API version is %s.",
-                                 StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_1 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES",
+                                                     "VK_API_VERSION_1_1", device_properties.apiVersion);
                 }
             }
         } break;
@@ -4334,10 +3988,8 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_maintenance2)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_maintenance2))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES), but its parent extension "
-                                 "VK_KHR_maintenance2 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES",
+                                                    "VK_KHR_maintenance2");
             }
         } break;
 
@@ -4347,10 +3999,8 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_multiview)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_multiview))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES), but its parent extension "
-                                 "VK_KHR_multiview has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES",
+                                                    "VK_KHR_multiview");
             }
         } break;
 
@@ -4361,14 +4011,10 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_1) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |= LogError(
-                        pnext_vuid, instance, loc.dot(Field::pNext),
-                        "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES) "
-                        "which was added in VK_API_VERSION_1_1 but the "
-                        "current effective API version is %s.",
-                        StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_1 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc,
+                                                     "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES",
+                                                     "VK_API_VERSION_1_1", device_properties.apiVersion);
                 }
             }
         } break;
@@ -4379,11 +4025,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (!IsExtEnabled(instance_extensions.vk_khr_external_fence_capabilities) &&
                 !IsExtEnabled(instance_extensions.vk_khr_external_memory_capabilities) &&
                 !IsExtEnabled(instance_extensions.vk_khr_external_semaphore_capabilities)) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES), but "
-                                 "its parent extension "
-                                 "VK_KHR_external_fence_capabilities, VK_KHR_external_memory_capabilities, or "
-                                 "VK_KHR_external_semaphore_capabilities has not been enabled.");
+                skip |=
+                    LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES",
+                                                "VK_KHR_external_fence_capabilities, VK_KHR_external_memory_capabilities, or VK_KHR_external_semaphore_capabilities");
             }
         } break;
 
@@ -4393,10 +4037,8 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_maintenance3)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_maintenance3))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES), but its parent extension "
-                                 "VK_KHR_maintenance3 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES",
+                                                    "VK_KHR_maintenance3");
             }
         } break;
 
@@ -4407,14 +4049,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_2) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |= LogError(
-                        pnext_vuid, instance, loc.dot(Field::pNext),
-                        "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES) which "
-                        "was added in VK_API_VERSION_1_2 but the "
-                        "current effective API version is %s.",
-                        StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_2 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES",
+                                                     "VK_API_VERSION_1_2", device_properties.apiVersion);
                 }
             }
         } break;
@@ -4426,14 +4063,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_2) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |= LogError(
-                        pnext_vuid, instance, loc.dot(Field::pNext),
-                        "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES) which "
-                        "was added in VK_API_VERSION_1_2 but the "
-                        "current effective API version is %s.",
-                        StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_2 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES",
+                                                     "VK_API_VERSION_1_2", device_properties.apiVersion);
                 }
             }
         } break;
@@ -4443,10 +4075,8 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_driver_properties)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_driver_properties))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES), "
-                                 "but its parent extension "
-                                 "VK_KHR_driver_properties has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES",
+                                                    "VK_KHR_driver_properties");
             }
         } break;
 
@@ -4456,10 +4086,8 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_shader_float_controls)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_shader_float_controls))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES), but its parent extension "
-                                 "VK_KHR_shader_float_controls has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES",
+                                                    "VK_KHR_shader_float_controls");
             }
         } break;
 
@@ -4469,10 +4097,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_descriptor_indexing)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_descriptor_indexing))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES), but its parent extension "
-                                 "VK_EXT_descriptor_indexing has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES",
+                                                    "VK_EXT_descriptor_indexing");
             }
         } break;
 
@@ -4482,10 +4109,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_depth_stencil_resolve)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_depth_stencil_resolve))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES), but its parent extension "
-                                 "VK_KHR_depth_stencil_resolve has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES",
+                                                    "VK_KHR_depth_stencil_resolve");
             }
         } break;
 
@@ -4495,10 +4121,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_sampler_filter_minmax)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_sampler_filter_minmax))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES), but its parent extension "
-                                 "VK_EXT_sampler_filter_minmax has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES",
+                                                    "VK_EXT_sampler_filter_minmax");
             }
         } break;
 
@@ -4508,10 +4133,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_timeline_semaphore)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_timeline_semaphore))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES), but its parent extension "
-                                 "VK_KHR_timeline_semaphore has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES",
+                                                    "VK_KHR_timeline_semaphore");
             }
         } break;
 
@@ -4522,14 +4146,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_3) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |= LogError(
-                        pnext_vuid, instance, loc.dot(Field::pNext),
-                        "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES) which "
-                        "was added in VK_API_VERSION_1_3 but the "
-                        "current effective API version is %s.",
-                        StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_3 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES",
+                                                     "VK_API_VERSION_1_3", device_properties.apiVersion);
                 }
             }
         } break;
@@ -4540,10 +4159,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_subgroup_size_control)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_subgroup_size_control))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES), but its parent extension "
-                                 "VK_EXT_subgroup_size_control has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES",
+                                                    "VK_EXT_subgroup_size_control");
             }
         } break;
 
@@ -4553,10 +4171,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_inline_uniform_block)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_inline_uniform_block))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES), but its parent extension "
-                                 "VK_EXT_inline_uniform_block has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES",
+                                                    "VK_EXT_inline_uniform_block");
             }
         } break;
 
@@ -4566,11 +4183,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_shader_integer_dot_product)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_shader_integer_dot_product))) {
-                skip |=
-                    LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                             "includes a pointer to a VkStructureType "
-                             "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES), but its parent extension "
-                             "VK_KHR_shader_integer_dot_product has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES",
+                                                    "VK_KHR_shader_integer_dot_product");
             }
         } break;
 
@@ -4580,10 +4195,9 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_texel_buffer_alignment)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_texel_buffer_alignment))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES), but its parent extension "
-                                 "VK_EXT_texel_buffer_alignment has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES",
+                                                    "VK_EXT_texel_buffer_alignment");
             }
         } break;
 
@@ -4593,10 +4207,8 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_maintenance4)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_maintenance4))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES), but its parent extension "
-                                 "VK_KHR_maintenance4 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES",
+                                                    "VK_KHR_maintenance4");
             }
         } break;
 
@@ -4626,8 +4238,7 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDevicePipelineBinaryPropertiesKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_pipeline_binary)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_pipeline_binary");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_pipeline_binary");
                 }
                 VkPhysicalDevicePipelineBinaryPropertiesKHR* structure = (VkPhysicalDevicePipelineBinaryPropertiesKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::pipelineBinaryInternalCache), structure->pipelineBinaryInternalCache);
@@ -4669,8 +4280,7 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceLayeredApiPropertiesListKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance7)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_maintenance7");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_maintenance7");
                 }
                 VkPhysicalDeviceLayeredApiPropertiesListKHR* structure = (VkPhysicalDeviceLayeredApiPropertiesListKHR*)header;
                 skip |= ValidateStructTypeArray(
@@ -4755,8 +4365,7 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceHostImageCopyPropertiesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_host_image_copy)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_host_image_copy");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_host_image_copy");
                 }
                 VkPhysicalDeviceHostImageCopyPropertiesEXT* structure = (VkPhysicalDeviceHostImageCopyPropertiesEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::identicalMemoryTypeRequirements),
@@ -4791,8 +4400,7 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_graphics_pipeline_library)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_graphics_pipeline_library");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_graphics_pipeline_library");
                 }
                 VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT* structure =
                     (VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT*)header;
@@ -4810,8 +4418,7 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_fragment_shading_rate_enums)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_fragment_shading_rate_enums");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_fragment_shading_rate_enums");
                 }
                 VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV* structure =
                     (VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV*)header;
@@ -4858,8 +4465,7 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceSchedulingControlsPropertiesARM);
                 if (!IsExtEnabled(device_extensions.vk_arm_scheduling_controls)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_ARM_scheduling_controls");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_ARM_scheduling_controls");
                 }
                 VkPhysicalDeviceSchedulingControlsPropertiesARM* structure =
                     (VkPhysicalDeviceSchedulingControlsPropertiesARM*)header;
@@ -4895,8 +4501,7 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceExtendedDynamicState3PropertiesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_extended_dynamic_state3)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_extended_dynamic_state3");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_extended_dynamic_state3");
                 }
                 VkPhysicalDeviceExtendedDynamicState3PropertiesEXT* structure =
                     (VkPhysicalDeviceExtendedDynamicState3PropertiesEXT*)header;
@@ -4931,8 +4536,7 @@ bool StatelessValidation::ValidatePnextPropertyStructContents(const Location& lo
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_legacy_vertex_attributes)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_legacy_vertex_attributes");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_legacy_vertex_attributes");
                 }
                 VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT* structure =
                     (VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT*)header;
@@ -5026,10 +4630,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_dedicated_allocation)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_dedicated_allocation))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS), but "
-                                 "its parent extension "
-                                 "VK_KHR_dedicated_allocation has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS",
+                                                    "VK_KHR_dedicated_allocation");
             }
         } break;
 
@@ -5038,10 +4640,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_dedicated_allocation)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_dedicated_allocation))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_dedicated_allocation has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO",
+                                                    "VK_KHR_dedicated_allocation");
             }
         } break;
 
@@ -5050,16 +4650,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_device_group)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_device_group))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO), but its "
-                                 "parent extension "
-                                 "VK_KHR_device_group has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO",
+                                                    "VK_KHR_device_group");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkMemoryAllocateFlagsInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_device_group)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_device_group");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_device_group");
                 }
                 VkMemoryAllocateFlagsInfo* structure = (VkMemoryAllocateFlagsInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::flags), vvl::FlagBitmask::VkMemoryAllocateFlagBits,
@@ -5073,16 +4670,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_device_group)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_device_group))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO), "
-                                 "but its parent extension "
-                                 "VK_KHR_device_group has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO",
+                                                    "VK_KHR_device_group");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceGroupRenderPassBeginInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_device_group)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_device_group");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_device_group");
                 }
                 VkDeviceGroupRenderPassBeginInfo* structure = (VkDeviceGroupRenderPassBeginInfo*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::deviceRenderAreaCount), pNext_loc.dot(Field::pDeviceRenderAreas),
@@ -5105,10 +4699,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_device_group)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_device_group))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO), but its parent extension "
-                                 "VK_KHR_device_group has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO",
+                                                    "VK_KHR_device_group");
             }
         } break;
 
@@ -5117,16 +4709,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_device_group)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_device_group))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO), but its "
-                                 "parent extension "
-                                 "VK_KHR_device_group has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO",
+                                                    "VK_KHR_device_group");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceGroupSubmitInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_device_group)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_device_group");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_device_group");
                 }
                 VkDeviceGroupSubmitInfo* structure = (VkDeviceGroupSubmitInfo*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::waitSemaphoreCount), pNext_loc.dot(Field::pWaitSemaphoreDeviceIndices),
@@ -5149,10 +4738,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_device_group)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_device_group))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_device_group has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO",
+                                                    "VK_KHR_device_group");
             }
         } break;
 
@@ -5161,16 +4748,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_device_group)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_device_group))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO), but its parent extension "
-                                 "VK_KHR_device_group has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO",
+                                                    "VK_KHR_device_group");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkBindBufferMemoryDeviceGroupInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_device_group)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_device_group");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_device_group");
                 }
                 VkBindBufferMemoryDeviceGroupInfo* structure = (VkBindBufferMemoryDeviceGroupInfo*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::deviceIndexCount), pNext_loc.dot(Field::pDeviceIndices),
@@ -5184,16 +4768,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_device_group)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_device_group))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO), "
-                                 "but its parent extension "
-                                 "VK_KHR_device_group has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO",
+                                                    "VK_KHR_device_group");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkBindImageMemoryDeviceGroupInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_device_group)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_device_group");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_device_group");
                 }
                 VkBindImageMemoryDeviceGroupInfo* structure = (VkBindImageMemoryDeviceGroupInfo*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::deviceIndexCount), pNext_loc.dot(Field::pDeviceIndices),
@@ -5219,10 +4800,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
         case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO: {  // Covers VUID-VkDeviceGroupDeviceCreateInfo-sType-sType
 
             if (!IsExtEnabled(instance_extensions.vk_khr_device_group_creation)) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_device_group_creation has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO",
+                                                    "VK_KHR_device_group_creation");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceGroupDeviceCreateInfo);
@@ -5237,10 +4816,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2: {  // Covers VUID-VkPhysicalDeviceFeatures2-sType-sType
 
             if (!IsExtEnabled(instance_extensions.vk_khr_get_physical_device_properties2)) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2), but its "
-                                 "parent extension "
-                                 "VK_KHR_get_physical_device_properties2 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2",
+                                                    "VK_KHR_get_physical_device_properties2");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceFeatures2);
@@ -5378,16 +4955,14 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_maintenance2)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_maintenance2))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO), but its parent extension "
-                                 "VK_KHR_maintenance2 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO",
+                                                    "VK_KHR_maintenance2");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassInputAttachmentAspectCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance2)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_maintenance2");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_maintenance2");
                 }
                 VkRenderPassInputAttachmentAspectCreateInfo* structure = (VkRenderPassInputAttachmentAspectCreateInfo*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::aspectReferenceCount), pNext_loc.dot(Field::pAspectReferences),
@@ -5415,16 +4990,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_maintenance2)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_maintenance2))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_maintenance2 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO",
+                                                    "VK_KHR_maintenance2");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImageViewUsageCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance2)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_maintenance2");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_maintenance2");
                 }
                 VkImageViewUsageCreateInfo* structure = (VkImageViewUsageCreateInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::usage), vvl::FlagBitmask::VkImageUsageFlagBits, AllVkImageUsageFlagBits,
@@ -5440,17 +5012,14 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_maintenance2)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_maintenance2))) {
-                skip |=
-                    LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                             "includes a pointer to a VkStructureType "
-                             "(VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO), but its parent extension "
-                             "VK_KHR_maintenance2 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO",
+                                                    "VK_KHR_maintenance2");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineTessellationDomainOriginStateCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance2)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_maintenance2");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_maintenance2");
                 }
                 VkPipelineTessellationDomainOriginStateCreateInfo* structure =
                     (VkPipelineTessellationDomainOriginStateCreateInfo*)header;
@@ -5465,15 +5034,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_multiview)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_multiview))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO), "
-                                 "but its parent extension "
-                                 "VK_KHR_multiview has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO",
+                                                    "VK_KHR_multiview");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassMultiviewCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_multiview)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_multiview");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_multiview");
                 }
                 VkRenderPassMultiviewCreateInfo* structure = (VkRenderPassMultiviewCreateInfo*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::subpassCount), pNext_loc.dot(Field::pViewMasks), structure->subpassCount,
@@ -5496,13 +5063,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_physdev_api) {
                 VkPhysicalDeviceProperties device_properties = {};
                 DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                if (device_properties.apiVersion < VK_API_VERSION_1_1) {
-                    APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                    skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                     "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO) which was "
-                                     "added in VK_API_VERSION_1_1 but the "
-                                     "current effective API version is %s.",
-                                     StringAPIVersion(device_api_version).c_str());
+                if (device_properties.apiVersion < VK_API_VERSION_1_1 && IsErrorReportable(pnext_vuid)) {
+                    skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO",
+                                                     "VK_API_VERSION_1_1", device_properties.apiVersion);
                 }
             }
             if (is_const_param) {
@@ -5517,16 +5080,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_sampler_ycbcr_conversion)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_sampler_ycbcr_conversion has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO",
+                                                    "VK_KHR_sampler_ycbcr_conversion");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSamplerYcbcrConversionInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_sampler_ycbcr_conversion");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_sampler_ycbcr_conversion");
                 }
                 VkSamplerYcbcrConversionInfo* structure = (VkSamplerYcbcrConversionInfo*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::conversion), structure->conversion);
@@ -5538,16 +5098,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_sampler_ycbcr_conversion)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_sampler_ycbcr_conversion has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO",
+                                                    "VK_KHR_sampler_ycbcr_conversion");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkBindImagePlaneMemoryInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_sampler_ycbcr_conversion");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_sampler_ycbcr_conversion");
                 }
                 VkBindImagePlaneMemoryInfo* structure = (VkBindImagePlaneMemoryInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::planeAspect), vvl::FlagBitmask::VkImageAspectFlagBits,
@@ -5563,16 +5120,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_sampler_ycbcr_conversion)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO), but its parent extension "
-                                 "VK_KHR_sampler_ycbcr_conversion has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO",
+                                                    "VK_KHR_sampler_ycbcr_conversion");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImagePlaneMemoryRequirementsInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_sampler_ycbcr_conversion");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_sampler_ycbcr_conversion");
                 }
                 VkImagePlaneMemoryRequirementsInfo* structure = (VkImagePlaneMemoryRequirementsInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::planeAspect), vvl::FlagBitmask::VkImageAspectFlagBits,
@@ -5588,10 +5142,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_sampler_ycbcr_conversion)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES), but its parent extension "
-                                 "VK_KHR_sampler_ycbcr_conversion has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES",
+                                                    "VK_KHR_sampler_ycbcr_conversion");
             }
         } break;
 
@@ -5600,10 +5153,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                                                               // VUID-VkPhysicalDeviceExternalImageFormatInfo-sType-sType
 
             if (!IsExtEnabled(instance_extensions.vk_khr_external_memory_capabilities)) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO), but its parent extension "
-                                 "VK_KHR_external_memory_capabilities has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO",
+                                                    "VK_KHR_external_memory_capabilities");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceExternalImageFormatInfo);
@@ -5618,10 +5169,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
         case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES: {  // Covers VUID-VkExternalImageFormatProperties-sType-sType
 
             if (!IsExtEnabled(instance_extensions.vk_khr_external_memory_capabilities)) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES), "
-                                 "but its parent extension "
-                                 "VK_KHR_external_memory_capabilities has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES",
+                                                    "VK_KHR_external_memory_capabilities");
             }
         } break;
 
@@ -5630,16 +5179,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_external_memory)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_external_memory))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO), "
-                                 "but its parent extension "
-                                 "VK_KHR_external_memory has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO",
+                                                    "VK_KHR_external_memory");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExternalMemoryImageCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_external_memory)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_external_memory");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_external_memory");
                 }
                 VkExternalMemoryImageCreateInfo* structure = (VkExternalMemoryImageCreateInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleTypes), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBits,
@@ -5653,16 +5199,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_external_memory)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_external_memory))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO), "
-                                 "but its parent extension "
-                                 "VK_KHR_external_memory has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO",
+                                                    "VK_KHR_external_memory");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExternalMemoryBufferCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_external_memory)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_external_memory");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_external_memory");
                 }
                 VkExternalMemoryBufferCreateInfo* structure = (VkExternalMemoryBufferCreateInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleTypes), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBits,
@@ -5676,16 +5219,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_external_memory)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_external_memory))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO), but its "
-                                 "parent extension "
-                                 "VK_KHR_external_memory has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO",
+                                                    "VK_KHR_external_memory");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExportMemoryAllocateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_external_memory)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_external_memory");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_external_memory");
                 }
                 VkExportMemoryAllocateInfo* structure = (VkExportMemoryAllocateInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleTypes), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBits,
@@ -5699,16 +5239,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_external_fence)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_external_fence))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO), but its "
-                                 "parent extension "
-                                 "VK_KHR_external_fence has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO",
+                                                    "VK_KHR_external_fence");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExportFenceCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_external_fence)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_external_fence");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_external_fence");
                 }
                 VkExportFenceCreateInfo* structure = (VkExportFenceCreateInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleTypes), vvl::FlagBitmask::VkExternalFenceHandleTypeFlagBits,
@@ -5722,16 +5259,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_external_semaphore)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_external_semaphore))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_external_semaphore has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO",
+                                                    "VK_KHR_external_semaphore");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExportSemaphoreCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_external_semaphore)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_external_semaphore");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_external_semaphore");
                 }
                 VkExportSemaphoreCreateInfo* structure = (VkExportSemaphoreCreateInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleTypes), vvl::FlagBitmask::VkExternalSemaphoreHandleTypeFlagBits,
@@ -5745,16 +5279,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_image_format_list)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_image_format_list))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_image_format_list has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO",
+                                                    "VK_KHR_image_format_list");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImageFormatListCreateInfo);
                 if ((!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_image_format_list))) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_image_format_list");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_image_format_list");
                 }
                 VkImageFormatListCreateInfo* structure = (VkImageFormatListCreateInfo*)header;
                 skip |= ValidateRangedEnumArray(pNext_loc.dot(Field::viewFormatCount), pNext_loc.dot(Field::pViewFormats),
@@ -5769,16 +5300,14 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_descriptor_indexing)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_descriptor_indexing))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO), but its parent extension "
-                                 "VK_EXT_descriptor_indexing has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO",
+                                                    "VK_EXT_descriptor_indexing");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDescriptorSetLayoutBindingFlagsCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_ext_descriptor_indexing)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_descriptor_indexing");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_descriptor_indexing");
                 }
                 VkDescriptorSetLayoutBindingFlagsCreateInfo* structure = (VkDescriptorSetLayoutBindingFlagsCreateInfo*)header;
                 skip |= ValidateFlagsArray(pNext_loc.dot(Field::bindingCount), pNext_loc.dot(Field::pBindingFlags),
@@ -5794,17 +5323,14 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_descriptor_indexing)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_descriptor_indexing))) {
-                skip |=
-                    LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                             "includes a pointer to a VkStructureType "
-                             "(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO), but its parent extension "
-                             "VK_EXT_descriptor_indexing has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO",
+                                                    "VK_EXT_descriptor_indexing");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDescriptorSetVariableDescriptorCountAllocateInfo);
                 if (!IsExtEnabled(device_extensions.vk_ext_descriptor_indexing)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_descriptor_indexing");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_descriptor_indexing");
                 }
                 VkDescriptorSetVariableDescriptorCountAllocateInfo* structure =
                     (VkDescriptorSetVariableDescriptorCountAllocateInfo*)header;
@@ -5820,11 +5346,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_descriptor_indexing)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_descriptor_indexing))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType "
-                    "(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT), but its parent extension "
-                    "VK_EXT_descriptor_indexing has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT",
+                                                    "VK_EXT_descriptor_indexing");
             }
         } break;
 
@@ -5834,16 +5358,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_depth_stencil_resolve)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_depth_stencil_resolve))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE), but its parent extension "
-                                 "VK_KHR_depth_stencil_resolve has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE",
+                                                    "VK_KHR_depth_stencil_resolve");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSubpassDescriptionDepthStencilResolve);
                 if (!IsExtEnabled(device_extensions.vk_khr_depth_stencil_resolve)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_depth_stencil_resolve");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_depth_stencil_resolve");
                 }
                 VkSubpassDescriptionDepthStencilResolve* structure = (VkSubpassDescriptionDepthStencilResolve*)header;
                 skip |=
@@ -5867,16 +5388,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_separate_stencil_usage)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_separate_stencil_usage))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO), but "
-                                 "its parent extension "
-                                 "VK_EXT_separate_stencil_usage has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO",
+                                                    "VK_EXT_separate_stencil_usage");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImageStencilUsageCreateInfo);
                 if ((!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_separate_stencil_usage))) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_separate_stencil_usage");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_separate_stencil_usage");
                 }
                 VkImageStencilUsageCreateInfo* structure = (VkImageStencilUsageCreateInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::stencilUsage), vvl::FlagBitmask::VkImageUsageFlagBits,
@@ -5891,16 +5409,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_sampler_filter_minmax)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_sampler_filter_minmax))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO), "
-                                 "but its parent extension "
-                                 "VK_EXT_sampler_filter_minmax has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO",
+                                                    "VK_EXT_sampler_filter_minmax");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSamplerReductionModeCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_ext_sampler_filter_minmax)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_sampler_filter_minmax");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_sampler_filter_minmax");
                 }
                 VkSamplerReductionModeCreateInfo* structure = (VkSamplerReductionModeCreateInfo*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::reductionMode), vvl::Enum::VkSamplerReductionMode,
@@ -5914,16 +5429,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_imageless_framebuffer)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_imageless_framebuffer))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO), "
-                                 "but its parent extension "
-                                 "VK_KHR_imageless_framebuffer has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO",
+                                                    "VK_KHR_imageless_framebuffer");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkFramebufferAttachmentsCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_imageless_framebuffer)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_imageless_framebuffer");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_imageless_framebuffer");
                 }
                 VkFramebufferAttachmentsCreateInfo* structure = (VkFramebufferAttachmentsCreateInfo*)header;
                 skip |= ValidateStructTypeArray(
@@ -5965,16 +5477,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_imageless_framebuffer)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_imageless_framebuffer))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO), "
-                                 "but its parent extension "
-                                 "VK_KHR_imageless_framebuffer has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO",
+                                                    "VK_KHR_imageless_framebuffer");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassAttachmentBeginInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_imageless_framebuffer)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_imageless_framebuffer");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_imageless_framebuffer");
                 }
                 VkRenderPassAttachmentBeginInfo* structure = (VkRenderPassAttachmentBeginInfo*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::attachmentCount), pNext_loc.dot(Field::pAttachments),
@@ -5988,16 +5497,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_separate_depth_stencil_layouts)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_separate_depth_stencil_layouts))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT), "
-                                 "but its parent extension "
-                                 "VK_KHR_separate_depth_stencil_layouts has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT",
+                                                    "VK_KHR_separate_depth_stencil_layouts");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkAttachmentReferenceStencilLayout);
                 if (!IsExtEnabled(device_extensions.vk_khr_separate_depth_stencil_layouts)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_separate_depth_stencil_layouts");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_separate_depth_stencil_layouts");
                 }
                 VkAttachmentReferenceStencilLayout* structure = (VkAttachmentReferenceStencilLayout*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::stencilLayout), vvl::Enum::VkImageLayout, structure->stencilLayout,
@@ -6011,16 +5517,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_separate_depth_stencil_layouts)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_separate_depth_stencil_layouts))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT), but its parent extension "
-                                 "VK_KHR_separate_depth_stencil_layouts has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT",
+                                                    "VK_KHR_separate_depth_stencil_layouts");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkAttachmentDescriptionStencilLayout);
                 if (!IsExtEnabled(device_extensions.vk_khr_separate_depth_stencil_layouts)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_separate_depth_stencil_layouts");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_separate_depth_stencil_layouts");
                 }
                 VkAttachmentDescriptionStencilLayout* structure = (VkAttachmentDescriptionStencilLayout*)header;
                 skip |= ValidateRangedEnum(
@@ -6038,16 +5541,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_timeline_semaphore)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_timeline_semaphore))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO), but its "
-                                 "parent extension "
-                                 "VK_KHR_timeline_semaphore has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO",
+                                                    "VK_KHR_timeline_semaphore");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSemaphoreTypeCreateInfo);
                 if ((!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_timeline_semaphore))) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_timeline_semaphore");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_timeline_semaphore");
                 }
                 VkSemaphoreTypeCreateInfo* structure = (VkSemaphoreTypeCreateInfo*)header;
                 skip |=
@@ -6061,10 +5561,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_timeline_semaphore)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_timeline_semaphore))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_timeline_semaphore has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO",
+                                                    "VK_KHR_timeline_semaphore");
             }
         } break;
 
@@ -6074,10 +5572,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_buffer_device_address)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_buffer_device_address))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO), but its parent extension "
-                                 "VK_KHR_buffer_device_address has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO",
+                                                    "VK_KHR_buffer_device_address");
             }
         } break;
 
@@ -6087,10 +5583,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_buffer_device_address)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_buffer_device_address))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO), but its parent extension "
-                                 "VK_KHR_buffer_device_address has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO",
+                                                    "VK_KHR_buffer_device_address");
             }
         } break;
 
@@ -6100,16 +5595,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_pipeline_creation_feedback)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_pipeline_creation_feedback))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO), but its parent extension "
-                                 "VK_EXT_pipeline_creation_feedback has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO",
+                                                    "VK_EXT_pipeline_creation_feedback");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineCreationFeedbackCreateInfo);
                 if (!IsExtEnabled(device_extensions.vk_ext_pipeline_creation_feedback)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_pipeline_creation_feedback");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_pipeline_creation_feedback");
                 }
                 VkPipelineCreationFeedbackCreateInfo* structure = (VkPipelineCreationFeedbackCreateInfo*)header;
                 skip |=
@@ -6141,10 +5633,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_private_data)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_private_data))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO), but "
-                                 "its parent extension "
-                                 "VK_EXT_private_data has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO",
+                                                    "VK_EXT_private_data");
             }
         } break;
 
@@ -6153,16 +5643,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_synchronization2)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_synchronization2))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_MEMORY_BARRIER_2), but its parent extension "
-                    "VK_KHR_synchronization2 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_MEMORY_BARRIER_2",
+                                                    "VK_KHR_synchronization2");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkMemoryBarrier2);
                 if (!IsExtEnabled(device_extensions.vk_khr_synchronization2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_synchronization2");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_synchronization2");
                 }
                 VkMemoryBarrier2* structure = (VkMemoryBarrier2*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::srcStageMask), vvl::FlagBitmask::VkPipelineStageFlagBits2,
@@ -6189,11 +5676,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_subgroup_size_control)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_subgroup_size_control))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType "
-                    "(VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO), but its parent extension "
-                    "VK_EXT_subgroup_size_control has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO",
+                                                    "VK_EXT_subgroup_size_control");
             }
         } break;
 
@@ -6203,16 +5688,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_inline_uniform_block)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_inline_uniform_block))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK), but its parent extension "
-                                 "VK_EXT_inline_uniform_block has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK",
+                                                    "VK_EXT_inline_uniform_block");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkWriteDescriptorSetInlineUniformBlock);
                 if (!IsExtEnabled(device_extensions.vk_ext_inline_uniform_block)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_inline_uniform_block");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_inline_uniform_block");
                 }
                 VkWriteDescriptorSetInlineUniformBlock* structure = (VkWriteDescriptorSetInlineUniformBlock*)header;
                 skip |=
@@ -6228,10 +5710,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_EXT_inline_uniform_block)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_inline_uniform_block))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO), but its parent extension "
-                                 "VK_EXT_inline_uniform_block has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc,
+                                                    "VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO",
+                                                    "VK_EXT_inline_uniform_block");
             }
         } break;
 
@@ -6240,10 +5721,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_dynamic_rendering)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_dynamic_rendering))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO), but "
-                                 "its parent extension "
-                                 "VK_KHR_dynamic_rendering has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO",
+                                                    "VK_KHR_dynamic_rendering");
             }
         } break;
 
@@ -6253,16 +5732,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_dynamic_rendering)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_dynamic_rendering))) {
-                skip |= LogError(pnext_vuid, instance, loc.dot(Field::pNext),
-                                 "includes a pointer to a VkStructureType "
-                                 "(VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO), but its parent extension "
-                                 "VK_KHR_dynamic_rendering has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO",
+                                                    "VK_KHR_dynamic_rendering");
             }
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkCommandBufferInheritanceRenderingInfo);
                 if (!IsExtEnabled(device_extensions.vk_khr_dynamic_rendering)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_dynamic_rendering");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_dynamic_rendering");
                 }
                 VkCommandBufferInheritanceRenderingInfo* structure = (VkCommandBufferInheritanceRenderingInfo*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::flags), vvl::FlagBitmask::VkRenderingFlagBits, AllVkRenderingFlagBits,
@@ -6293,10 +5769,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
             if ((is_physdev_api && !SupportedByPdev(physical_device, vvl::Extension::_VK_KHR_format_feature_flags2)) ||
                 (!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_format_feature_flags2))) {
-                skip |= LogError(
-                    pnext_vuid, instance, loc.dot(Field::pNext),
-                    "includes a pointer to a VkStructureType (VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3), but its parent extension "
-                    "VK_KHR_format_feature_flags2 has not been enabled.");
+                skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3",
+                                                    "VK_KHR_format_feature_flags2");
             }
         } break;
 
@@ -6308,8 +5782,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkBindImageMemorySwapchainInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_swapchain) && !IsExtEnabled(device_extensions.vk_khr_device_group)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_swapchain or VK_KHR_device_group");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_swapchain or VK_KHR_device_group");
                 }
                 VkBindImageMemorySwapchainInfoKHR* structure = (VkBindImageMemorySwapchainInfoKHR*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::swapchain), structure->swapchain);
@@ -6321,8 +5794,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceGroupPresentInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_swapchain) && !IsExtEnabled(device_extensions.vk_khr_device_group)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_swapchain or VK_KHR_device_group");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_swapchain or VK_KHR_device_group");
                 }
                 VkDeviceGroupPresentInfoKHR* structure = (VkDeviceGroupPresentInfoKHR*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::swapchainCount), pNext_loc.dot(Field::pDeviceMasks),
@@ -6342,8 +5814,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceGroupSwapchainCreateInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_swapchain) && !IsExtEnabled(device_extensions.vk_khr_device_group)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_swapchain or VK_KHR_device_group");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_swapchain or VK_KHR_device_group");
                 }
                 VkDeviceGroupSwapchainCreateInfoKHR* structure = (VkDeviceGroupSwapchainCreateInfoKHR*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::modes), vvl::FlagBitmask::VkDeviceGroupPresentModeFlagBitsKHR,
@@ -6358,8 +5829,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDisplayPresentInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_display_swapchain)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_display_swapchain");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_display_swapchain");
                 }
                 VkDisplayPresentInfoKHR* structure = (VkDisplayPresentInfoKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::persistent), structure->persistent);
@@ -6806,8 +6276,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImportMemoryWin32HandleInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_external_memory_win32)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_external_memory_win32");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_external_memory_win32");
                 }
                 VkImportMemoryWin32HandleInfoKHR* structure = (VkImportMemoryWin32HandleInfoKHR*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleType), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBits,
@@ -6825,8 +6294,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImportMemoryFdInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_external_memory_fd)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_external_memory_fd");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_external_memory_fd");
                 }
                 VkImportMemoryFdInfoKHR* structure = (VkImportMemoryFdInfoKHR*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleType), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBits,
@@ -6842,8 +6310,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkWin32KeyedMutexAcquireReleaseInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_win32_keyed_mutex)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_win32_keyed_mutex");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_win32_keyed_mutex");
                 }
                 VkWin32KeyedMutexAcquireReleaseInfoKHR* structure = (VkWin32KeyedMutexAcquireReleaseInfoKHR*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::acquireCount), pNext_loc.dot(Field::pAcquireSyncs),
@@ -6879,8 +6346,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPresentRegionsKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_incremental_present)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_incremental_present");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_incremental_present");
                 }
                 VkPresentRegionsKHR* structure = (VkPresentRegionsKHR*)header;
                 skip |=
@@ -6917,8 +6383,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkQueryPoolPerformanceCreateInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_performance_query)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_performance_query");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_performance_query");
                 }
                 VkQueryPoolPerformanceCreateInfoKHR* structure = (VkQueryPoolPerformanceCreateInfoKHR*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::counterIndexCount), pNext_loc.dot(Field::pCounterIndices),
@@ -7021,8 +6486,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceQueueGlobalPriorityCreateInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_global_priority) &&
                     !IsExtEnabled(device_extensions.vk_ext_global_priority)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_global_priority or VK_EXT_global_priority");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_global_priority or VK_EXT_global_priority");
                 }
                 VkDeviceQueueGlobalPriorityCreateInfoKHR* structure = (VkDeviceQueueGlobalPriorityCreateInfoKHR*)header;
                 skip |= ValidateRangedEnum(
@@ -7040,8 +6504,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkFragmentShadingRateAttachmentInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_fragment_shading_rate)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_fragment_shading_rate");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_fragment_shading_rate");
                 }
                 VkFragmentShadingRateAttachmentInfoKHR* structure = (VkFragmentShadingRateAttachmentInfoKHR*)header;
                 skip |=
@@ -7069,8 +6532,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderingFragmentShadingRateAttachmentInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_fragment_shading_rate)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_fragment_shading_rate");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_fragment_shading_rate");
                 }
                 VkRenderingFragmentShadingRateAttachmentInfoKHR* structure =
                     (VkRenderingFragmentShadingRateAttachmentInfoKHR*)header;
@@ -7094,8 +6556,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineLibraryCreateInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_pipeline_library)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_pipeline_library");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_pipeline_library");
                 }
                 VkPipelineLibraryCreateInfoKHR* structure = (VkPipelineLibraryCreateInfoKHR*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::libraryCount), pNext_loc.dot(Field::pLibraries), structure->libraryCount,
@@ -7109,7 +6570,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPresentIdKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_present_id)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_present_id");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_present_id");
                 }
                 VkPresentIdKHR* structure = (VkPresentIdKHR*)header;
                 skip |=
@@ -7191,8 +6652,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineCreateFlags2CreateInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance5)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_maintenance5");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_maintenance5");
                 }
                 VkPipelineCreateFlags2CreateInfoKHR* structure = (VkPipelineCreateFlags2CreateInfoKHR*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::flags), vvl::FlagBitmask::VkPipelineCreateFlagBits2KHR,
@@ -7207,8 +6667,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkBufferUsageFlags2CreateInfoKHR);
                 if ((!is_physdev_api && !IsExtEnabled(device_extensions.vk_khr_maintenance5))) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_maintenance5");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_maintenance5");
                 }
                 VkBufferUsageFlags2CreateInfoKHR* structure = (VkBufferUsageFlags2CreateInfoKHR*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::usage), vvl::FlagBitmask::VkBufferUsageFlagBits2KHR,
@@ -7224,8 +6683,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDevicePipelineBinaryInternalCacheControlKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_pipeline_binary)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_pipeline_binary");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_pipeline_binary");
                 }
                 VkDevicePipelineBinaryInternalCacheControlKHR* structure = (VkDevicePipelineBinaryInternalCacheControlKHR*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::disableInternalCache), structure->disableInternalCache);
@@ -7237,8 +6695,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineBinaryInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_pipeline_binary)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_pipeline_binary");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_pipeline_binary");
                 }
                 VkPipelineBinaryInfoKHR* structure = (VkPipelineBinaryInfoKHR*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::binaryCount), pNext_loc.dot(Field::pPipelineBinaries),
@@ -7309,9 +6766,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineVertexInputDivisorStateCreateInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_vertex_attribute_divisor) &&
                     !IsExtEnabled(device_extensions.vk_ext_vertex_attribute_divisor)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_vertex_attribute_divisor or "
-                                     "VK_EXT_vertex_attribute_divisor");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc,
+                                                       "VK_KHR_vertex_attribute_divisor or VK_EXT_vertex_attribute_divisor");
                 }
                 VkPipelineVertexInputDivisorStateCreateInfoKHR* structure = (VkPipelineVertexInputDivisorStateCreateInfoKHR*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::vertexBindingDivisorCount), pNext_loc.dot(Field::pVertexBindingDivisors),
@@ -7336,9 +6792,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineRasterizationLineStateCreateInfoKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_line_rasterization) &&
                     !IsExtEnabled(device_extensions.vk_ext_line_rasterization)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc,
-                                 "extended struct requires the extensions VK_KHR_line_rasterization or VK_EXT_line_rasterization");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc,
+                                                       "VK_KHR_line_rasterization or VK_EXT_line_rasterization");
                 }
                 VkPipelineRasterizationLineStateCreateInfoKHR* structure = (VkPipelineRasterizationLineStateCreateInfoKHR*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::lineRasterizationMode), vvl::Enum::VkLineRasterizationModeKHR,
@@ -7355,8 +6810,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkBindMemoryStatusKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_maintenance6)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_KHR_maintenance6");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_maintenance6");
                 }
                 VkBindMemoryStatusKHR* structure = (VkBindMemoryStatusKHR*)header;
                 skip |= ValidateRequiredPointer(pNext_loc.dot(Field::pResult), structure->pResult,
@@ -7389,8 +6843,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineRasterizationStateRasterizationOrderAMD);
                 if (!IsExtEnabled(device_extensions.vk_amd_rasterization_order)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_AMD_rasterization_order");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_AMD_rasterization_order");
                 }
                 VkPipelineRasterizationStateRasterizationOrderAMD* structure =
                     (VkPipelineRasterizationStateRasterizationOrderAMD*)header;
@@ -7406,8 +6859,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDedicatedAllocationImageCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_dedicated_allocation)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_dedicated_allocation");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_dedicated_allocation");
                 }
                 VkDedicatedAllocationImageCreateInfoNV* structure = (VkDedicatedAllocationImageCreateInfoNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::dedicatedAllocation), structure->dedicatedAllocation);
@@ -7420,8 +6872,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDedicatedAllocationBufferCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_dedicated_allocation)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_dedicated_allocation");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_dedicated_allocation");
                 }
                 VkDedicatedAllocationBufferCreateInfoNV* structure = (VkDedicatedAllocationBufferCreateInfoNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::dedicatedAllocation), structure->dedicatedAllocation);
@@ -7437,8 +6888,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineRasterizationStateStreamCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_transform_feedback)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_transform_feedback");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_transform_feedback");
                 }
                 VkPipelineRasterizationStateStreamCreateInfoEXT* structure =
                     (VkPipelineRasterizationStateStreamCreateInfoEXT*)header;
@@ -7455,8 +6905,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExternalMemoryImageCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_external_memory)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_NV_external_memory");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_external_memory");
                 }
                 VkExternalMemoryImageCreateInfoNV* structure = (VkExternalMemoryImageCreateInfoNV*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleTypes), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBitsNV,
@@ -7470,8 +6919,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExportMemoryAllocateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_external_memory)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_NV_external_memory");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_external_memory");
                 }
                 VkExportMemoryAllocateInfoNV* structure = (VkExportMemoryAllocateInfoNV*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleTypes), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBitsNV,
@@ -7486,8 +6934,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImportMemoryWin32HandleInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_external_memory_win32)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_external_memory_win32");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_external_memory_win32");
                 }
                 VkImportMemoryWin32HandleInfoNV* structure = (VkImportMemoryWin32HandleInfoNV*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleType), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBitsNV,
@@ -7505,8 +6952,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkWin32KeyedMutexAcquireReleaseInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_win32_keyed_mutex)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_win32_keyed_mutex");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_win32_keyed_mutex");
                 }
                 VkWin32KeyedMutexAcquireReleaseInfoNV* structure = (VkWin32KeyedMutexAcquireReleaseInfoNV*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::acquireCount), pNext_loc.dot(Field::pAcquireSyncs),
@@ -7550,8 +6996,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImageViewASTCDecodeModeEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_astc_decode_mode)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_astc_decode_mode");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_astc_decode_mode");
                 }
                 VkImageViewASTCDecodeModeEXT* structure = (VkImageViewASTCDecodeModeEXT*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::decodeMode), vvl::Enum::VkFormat, structure->decodeMode,
@@ -7564,8 +7009,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineRobustnessCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_pipeline_robustness)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_pipeline_robustness");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_pipeline_robustness");
                 }
                 VkPipelineRobustnessCreateInfoEXT* structure = (VkPipelineRobustnessCreateInfoEXT*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::storageBuffers), vvl::Enum::VkPipelineRobustnessBufferBehaviorEXT,
@@ -7593,8 +7037,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkCommandBufferInheritanceConditionalRenderingInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_conditional_rendering)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_conditional_rendering");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_conditional_rendering");
                 }
                 VkCommandBufferInheritanceConditionalRenderingInfoEXT* structure =
                     (VkCommandBufferInheritanceConditionalRenderingInfoEXT*)header;
@@ -7608,8 +7051,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineViewportWScalingStateCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_clip_space_w_scaling)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_clip_space_w_scaling");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_clip_space_w_scaling");
                 }
                 VkPipelineViewportWScalingStateCreateInfoNV* structure = (VkPipelineViewportWScalingStateCreateInfoNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::viewportWScalingEnable), structure->viewportWScalingEnable);
@@ -7625,8 +7067,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSwapchainCounterCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_display_control)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_display_control");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_display_control");
                 }
                 VkSwapchainCounterCreateInfoEXT* structure = (VkSwapchainCounterCreateInfoEXT*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::surfaceCounters), vvl::FlagBitmask::VkSurfaceCounterFlagBitsEXT,
@@ -7640,8 +7081,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPresentTimesInfoGOOGLE);
                 if (!IsExtEnabled(device_extensions.vk_google_display_timing)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_GOOGLE_display_timing");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_GOOGLE_display_timing");
                 }
                 VkPresentTimesInfoGOOGLE* structure = (VkPresentTimesInfoGOOGLE*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::swapchainCount), pNext_loc.dot(Field::pTimes), structure->swapchainCount,
@@ -7662,8 +7102,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkMultiviewPerViewAttributesInfoNVX);
                 if (!IsExtEnabled(device_extensions.vk_nvx_multiview_per_view_attributes)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NVX_multiview_per_view_attributes");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NVX_multiview_per_view_attributes");
                 }
                 VkMultiviewPerViewAttributesInfoNVX* structure = (VkMultiviewPerViewAttributesInfoNVX*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::perViewAttributes), structure->perViewAttributes);
@@ -7679,8 +7118,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineViewportSwizzleStateCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_viewport_swizzle)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_NV_viewport_swizzle");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_viewport_swizzle");
                 }
                 VkPipelineViewportSwizzleStateCreateInfoNV* structure = (VkPipelineViewportSwizzleStateCreateInfoNV*)header;
                 skip |= ValidateReservedFlags(pNext_loc.dot(Field::flags), structure->flags,
@@ -7721,8 +7159,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineDiscardRectangleStateCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_discard_rectangles)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_discard_rectangles");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_discard_rectangles");
                 }
                 VkPipelineDiscardRectangleStateCreateInfoEXT* structure = (VkPipelineDiscardRectangleStateCreateInfoEXT*)header;
                 skip |= ValidateReservedFlags(pNext_loc.dot(Field::flags), structure->flags,
@@ -7742,8 +7179,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPipelineRasterizationConservativeStateCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_conservative_rasterization)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_conservative_rasterization");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_conservative_rasterization");
                 }
                 VkPipelineRasterizationConservativeStateCreateInfoEXT* structure =
                     (VkPipelineRasterizationConservativeStateCreateInfoEXT*)header;
@@ -7764,8 +7200,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineRasterizationDepthClipStateCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_depth_clip_enable)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_depth_clip_enable");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_depth_clip_enable");
                 }
                 VkPipelineRasterizationDepthClipStateCreateInfoEXT* structure =
                     (VkPipelineRasterizationDepthClipStateCreateInfoEXT*)header;
@@ -7825,8 +7260,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImportAndroidHardwareBufferInfoANDROID);
                 if (!IsExtEnabled(device_extensions.vk_android_external_memory_android_hardware_buffer)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_ANDROID_external_memory_android_hardware_buffer");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_ANDROID_external_memory_android_hardware_buffer");
                 }
                 VkImportAndroidHardwareBufferInfoANDROID* structure = (VkImportAndroidHardwareBufferInfoANDROID*)header;
                 skip |= ValidateRequiredPointer(pNext_loc.dot(Field::buffer), structure->buffer,
@@ -7853,8 +7287,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSampleLocationsInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_sample_locations)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_sample_locations");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_sample_locations");
                 }
                 VkSampleLocationsInfoEXT* structure = (VkSampleLocationsInfoEXT*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::sampleLocationsCount), pNext_loc.dot(Field::pSampleLocations),
@@ -7877,8 +7310,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassSampleLocationsBeginInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_sample_locations)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_sample_locations");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_sample_locations");
                 }
                 VkRenderPassSampleLocationsBeginInfoEXT* structure = (VkRenderPassSampleLocationsBeginInfoEXT*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::attachmentInitialSampleLocationsCount),
@@ -7970,8 +7402,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineSampleLocationsStateCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_sample_locations)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_sample_locations");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_sample_locations");
                 }
                 VkPipelineSampleLocationsStateCreateInfoEXT* structure = (VkPipelineSampleLocationsStateCreateInfoEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::sampleLocationsEnable), structure->sampleLocationsEnable);
@@ -8001,8 +7432,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineColorBlendAdvancedStateCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_blend_operation_advanced)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_blend_operation_advanced");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_blend_operation_advanced");
                 }
                 VkPipelineColorBlendAdvancedStateCreateInfoEXT* structure = (VkPipelineColorBlendAdvancedStateCreateInfoEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::srcPremultiplied), structure->srcPremultiplied);
@@ -8021,8 +7451,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineCoverageToColorStateCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_fragment_coverage_to_color)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_fragment_coverage_to_color");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_fragment_coverage_to_color");
                 }
                 VkPipelineCoverageToColorStateCreateInfoNV* structure = (VkPipelineCoverageToColorStateCreateInfoNV*)header;
                 skip |= ValidateReservedFlags(pNext_loc.dot(Field::flags), structure->flags,
@@ -8038,8 +7467,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineCoverageModulationStateCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_framebuffer_mixed_samples)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_framebuffer_mixed_samples");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_framebuffer_mixed_samples");
                 }
                 VkPipelineCoverageModulationStateCreateInfoNV* structure = (VkPipelineCoverageModulationStateCreateInfoNV*)header;
                 skip |= ValidateReservedFlags(pNext_loc.dot(Field::flags), structure->flags,
@@ -8064,8 +7492,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImageDrmFormatModifierInfoEXT);
                 if ((!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier))) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_image_drm_format_modifier");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_image_drm_format_modifier");
                 }
                 VkPhysicalDeviceImageDrmFormatModifierInfoEXT* structure = (VkPhysicalDeviceImageDrmFormatModifierInfoEXT*)header;
                 skip |=
@@ -8080,8 +7507,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImageDrmFormatModifierListCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_image_drm_format_modifier");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_image_drm_format_modifier");
                 }
                 VkImageDrmFormatModifierListCreateInfoEXT* structure = (VkImageDrmFormatModifierListCreateInfoEXT*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::drmFormatModifierCount), pNext_loc.dot(Field::pDrmFormatModifiers),
@@ -8097,8 +7523,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImageDrmFormatModifierExplicitCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_image_drm_format_modifier");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_image_drm_format_modifier");
                 }
                 VkImageDrmFormatModifierExplicitCreateInfoEXT* structure = (VkImageDrmFormatModifierExplicitCreateInfoEXT*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::drmFormatModifierPlaneCount), pNext_loc.dot(Field::pPlaneLayouts),
@@ -8125,8 +7550,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkShaderModuleValidationCacheCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_validation_cache)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_validation_cache");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_validation_cache");
                 }
                 VkShaderModuleValidationCacheCreateInfoEXT* structure = (VkShaderModuleValidationCacheCreateInfoEXT*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::validationCache), structure->validationCache);
@@ -8139,8 +7563,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineViewportShadingRateImageStateCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_shading_rate_image)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_shading_rate_image");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_shading_rate_image");
                 }
                 VkPipelineViewportShadingRateImageStateCreateInfoNV* structure =
                     (VkPipelineViewportShadingRateImageStateCreateInfoNV*)header;
@@ -8154,8 +7577,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineViewportCoarseSampleOrderStateCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_shading_rate_image)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_shading_rate_image");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_shading_rate_image");
                 }
                 VkPipelineViewportCoarseSampleOrderStateCreateInfoNV* structure =
                     (VkPipelineViewportCoarseSampleOrderStateCreateInfoNV*)header;
@@ -8204,7 +7626,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkWriteDescriptorSetAccelerationStructureNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_ray_tracing)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_NV_ray_tracing");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_ray_tracing");
                 }
                 VkWriteDescriptorSetAccelerationStructureNV* structure = (VkWriteDescriptorSetAccelerationStructureNV*)header;
                 skip |=
@@ -8222,8 +7644,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPipelineRepresentativeFragmentTestStateCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_representative_fragment_test)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_representative_fragment_test");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_representative_fragment_test");
                 }
                 VkPipelineRepresentativeFragmentTestStateCreateInfoNV* structure =
                     (VkPipelineRepresentativeFragmentTestStateCreateInfoNV*)header;
@@ -8238,8 +7659,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPhysicalDeviceImageViewImageFormatInfoEXT);
                 if ((!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_filter_cubic))) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_filter_cubic");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_filter_cubic");
                 }
                 VkPhysicalDeviceImageViewImageFormatInfoEXT* structure = (VkPhysicalDeviceImageViewImageFormatInfoEXT*)header;
                 skip |=
@@ -8256,8 +7676,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImportMemoryHostPointerInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_external_memory_host)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_external_memory_host");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_external_memory_host");
                 }
                 VkImportMemoryHostPointerInfoEXT* structure = (VkImportMemoryHostPointerInfoEXT*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleType), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBits,
@@ -8276,8 +7695,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineCompilerControlCreateInfoAMD);
                 if (!IsExtEnabled(device_extensions.vk_amd_pipeline_compiler_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_AMD_pipeline_compiler_control");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_AMD_pipeline_compiler_control");
                 }
                 VkPipelineCompilerControlCreateInfoAMD* structure = (VkPipelineCompilerControlCreateInfoAMD*)header;
                 skip |= ValidateReservedFlags(pNext_loc.dot(Field::compilerControlFlags), structure->compilerControlFlags,
@@ -8291,8 +7709,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceMemoryOverallocationCreateInfoAMD);
                 if (!IsExtEnabled(device_extensions.vk_amd_memory_overallocation_behavior)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_AMD_memory_overallocation_behavior");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_AMD_memory_overallocation_behavior");
                 }
                 VkDeviceMemoryOverallocationCreateInfoAMD* structure = (VkDeviceMemoryOverallocationCreateInfoAMD*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::overallocationBehavior),
@@ -8321,8 +7738,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkQueryPoolPerformanceQueryCreateInfoINTEL);
                 if (!IsExtEnabled(device_extensions.vk_intel_performance_query)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_INTEL_performance_query");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_INTEL_performance_query");
                 }
                 VkQueryPoolPerformanceQueryCreateInfoINTEL* structure = (VkQueryPoolPerformanceQueryCreateInfoINTEL*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::performanceCountersSampling),
@@ -8341,8 +7757,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSwapchainDisplayNativeHdrCreateInfoAMD);
                 if (!IsExtEnabled(device_extensions.vk_amd_display_native_hdr)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_AMD_display_native_hdr");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_AMD_display_native_hdr");
                 }
                 VkSwapchainDisplayNativeHdrCreateInfoAMD* structure = (VkSwapchainDisplayNativeHdrCreateInfoAMD*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::localDimmingEnable), structure->localDimmingEnable);
@@ -8355,8 +7770,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassFragmentDensityMapCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_fragment_density_map)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_fragment_density_map");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_fragment_density_map");
                 }
                 VkRenderPassFragmentDensityMapCreateInfoEXT* structure = (VkRenderPassFragmentDensityMapCreateInfoEXT*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::layout), vvl::Enum::VkImageLayout,
@@ -8371,8 +7785,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderingFragmentDensityMapAttachmentInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_fragment_density_map)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_fragment_density_map");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_fragment_density_map");
                 }
                 VkRenderingFragmentDensityMapAttachmentInfoEXT* structure = (VkRenderingFragmentDensityMapAttachmentInfoEXT*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::imageView), structure->imageView);
@@ -8417,8 +7830,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineCoverageReductionStateCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_coverage_reduction_mode)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_coverage_reduction_mode");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_coverage_reduction_mode");
                 }
                 VkPipelineCoverageReductionStateCreateInfoNV* structure = (VkPipelineCoverageReductionStateCreateInfoNV*)header;
                 skip |= ValidateReservedFlags(pNext_loc.dot(Field::flags), structure->flags,
@@ -8438,8 +7850,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPipelineRasterizationProvokingVertexStateCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_provoking_vertex)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_provoking_vertex");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_provoking_vertex");
                 }
                 VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* structure =
                     (VkPipelineRasterizationProvokingVertexStateCreateInfoEXT*)header;
@@ -8456,8 +7867,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSurfaceFullScreenExclusiveInfoEXT);
                 if ((!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_full_screen_exclusive))) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_full_screen_exclusive");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_full_screen_exclusive");
                 }
                 VkSurfaceFullScreenExclusiveInfoEXT* structure = (VkSurfaceFullScreenExclusiveInfoEXT*)header;
                 skip |= ValidateRangedEnum(
@@ -8502,8 +7912,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSwapchainPresentFenceInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_swapchain_maintenance1)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_swapchain_maintenance1");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_swapchain_maintenance1");
                 }
                 VkSwapchainPresentFenceInfoEXT* structure = (VkSwapchainPresentFenceInfoEXT*)header;
                 skip |= ValidateHandleArray(pNext_loc.dot(Field::swapchainCount), pNext_loc.dot(Field::pFences),
@@ -8518,8 +7927,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSwapchainPresentModesCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_swapchain_maintenance1)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_swapchain_maintenance1");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_swapchain_maintenance1");
                 }
                 VkSwapchainPresentModesCreateInfoEXT* structure = (VkSwapchainPresentModesCreateInfoEXT*)header;
                 skip |=
@@ -8535,8 +7943,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSwapchainPresentModeInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_swapchain_maintenance1)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_swapchain_maintenance1");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_swapchain_maintenance1");
                 }
                 VkSwapchainPresentModeInfoEXT* structure = (VkSwapchainPresentModeInfoEXT*)header;
                 skip |= ValidateRangedEnumArray(pNext_loc.dot(Field::swapchainCount), pNext_loc.dot(Field::pPresentModes),
@@ -8552,8 +7959,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSwapchainPresentScalingCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_swapchain_maintenance1)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_swapchain_maintenance1");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_swapchain_maintenance1");
                 }
                 VkSwapchainPresentScalingCreateInfoEXT* structure = (VkSwapchainPresentScalingCreateInfoEXT*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::scalingBehavior), vvl::FlagBitmask::VkPresentScalingFlagBitsEXT,
@@ -8576,8 +7982,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkGraphicsPipelineShaderGroupsCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_device_generated_commands)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_device_generated_commands");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_device_generated_commands");
                 }
                 VkGraphicsPipelineShaderGroupsCreateInfoNV* structure = (VkGraphicsPipelineShaderGroupsCreateInfoNV*)header;
                 skip |=
@@ -8660,8 +8065,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkCommandBufferInheritanceViewportScissorInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_inherited_viewport_scissor)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_inherited_viewport_scissor");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_inherited_viewport_scissor");
                 }
                 VkCommandBufferInheritanceViewportScissorInfoNV* structure =
                     (VkCommandBufferInheritanceViewportScissorInfoNV*)header;
@@ -8680,8 +8084,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDepthBiasRepresentationInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_depth_bias_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_depth_bias_control");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_depth_bias_control");
                 }
                 VkDepthBiasRepresentationInfoEXT* structure = (VkDepthBiasRepresentationInfoEXT*)header;
                 skip |=
@@ -8699,8 +8102,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceDeviceMemoryReportCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_device_memory_report)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_device_memory_report");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_device_memory_report");
                 }
                 VkDeviceDeviceMemoryReportCreateInfoEXT* structure = (VkDeviceDeviceMemoryReportCreateInfoEXT*)header;
                 skip |= ValidateReservedFlags(pNext_loc.dot(Field::flags), structure->flags,
@@ -8721,8 +8123,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSamplerCustomBorderColorCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_custom_border_color)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_custom_border_color");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_custom_border_color");
                 }
                 VkSamplerCustomBorderColorCreateInfoEXT* structure = (VkSamplerCustomBorderColorCreateInfoEXT*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::format), vvl::Enum::VkFormat, structure->format,
@@ -8739,8 +8140,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSwapchainPresentBarrierCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_present_barrier)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_NV_present_barrier");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_present_barrier");
                 }
                 VkSwapchainPresentBarrierCreateInfoNV* structure = (VkSwapchainPresentBarrierCreateInfoNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::presentBarrierEnable), structure->presentBarrierEnable);
@@ -8753,8 +8153,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceDiagnosticsConfigCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_device_diagnostics_config)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_device_diagnostics_config");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_device_diagnostics_config");
                 }
                 VkDeviceDiagnosticsConfigCreateInfoNV* structure = (VkDeviceDiagnosticsConfigCreateInfoNV*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::flags), vvl::FlagBitmask::VkDeviceDiagnosticsConfigFlagBitsNV,
@@ -8768,7 +8167,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkQueryLowLatencySupportNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_low_latency)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_NV_low_latency");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_low_latency");
                 }
                 VkQueryLowLatencySupportNV* structure = (VkQueryLowLatencySupportNV*)header;
                 skip |= ValidateRequiredPointer(pNext_loc.dot(Field::pQueriedLowLatencyData), structure->pQueriedLowLatencyData,
@@ -8782,8 +8181,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExportMetalObjectCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_metal_objects)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_metal_objects");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_metal_objects");
                 }
                 VkExportMetalObjectCreateInfoEXT* structure = (VkExportMetalObjectCreateInfoEXT*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::exportObjectType), vvl::FlagBitmask::VkExportMetalObjectTypeFlagBitsEXT,
@@ -8800,8 +8198,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExportMetalCommandQueueInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_metal_objects)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_metal_objects");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_metal_objects");
                 }
                 VkExportMetalCommandQueueInfoEXT* structure = (VkExportMetalCommandQueueInfoEXT*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::queue), structure->queue);
@@ -8813,8 +8210,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExportMetalBufferInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_metal_objects)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_metal_objects");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_metal_objects");
                 }
                 VkExportMetalBufferInfoEXT* structure = (VkExportMetalBufferInfoEXT*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::memory), structure->memory);
@@ -8829,8 +8225,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExportMetalTextureInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_metal_objects)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_metal_objects");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_metal_objects");
                 }
                 VkExportMetalTextureInfoEXT* structure = (VkExportMetalTextureInfoEXT*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::plane), vvl::FlagBitmask::VkImageAspectFlagBits,
@@ -8845,8 +8240,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImportMetalTextureInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_metal_objects)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_metal_objects");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_metal_objects");
                 }
                 VkImportMetalTextureInfoEXT* structure = (VkImportMetalTextureInfoEXT*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::plane), vvl::FlagBitmask::VkImageAspectFlagBits,
@@ -8861,8 +8255,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExportMetalIOSurfaceInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_metal_objects)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_metal_objects");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_metal_objects");
                 }
                 VkExportMetalIOSurfaceInfoEXT* structure = (VkExportMetalIOSurfaceInfoEXT*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::image), structure->image);
@@ -8886,8 +8279,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkDescriptorBufferBindingPushDescriptorBufferHandleEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_descriptor_buffer)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_descriptor_buffer");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_descriptor_buffer");
                 }
                 VkDescriptorBufferBindingPushDescriptorBufferHandleEXT* structure =
                     (VkDescriptorBufferBindingPushDescriptorBufferHandleEXT*)header;
@@ -8901,8 +8293,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkOpaqueCaptureDescriptorDataCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_descriptor_buffer)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_descriptor_buffer");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_descriptor_buffer");
                 }
                 VkOpaqueCaptureDescriptorDataCreateInfoEXT* structure = (VkOpaqueCaptureDescriptorDataCreateInfoEXT*)header;
                 skip |= ValidateRequiredPointer(
@@ -8917,8 +8308,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkGraphicsPipelineLibraryCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_graphics_pipeline_library)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_graphics_pipeline_library");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_graphics_pipeline_library");
                 }
                 VkGraphicsPipelineLibraryCreateInfoEXT* structure = (VkGraphicsPipelineLibraryCreateInfoEXT*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::flags), vvl::FlagBitmask::VkGraphicsPipelineLibraryFlagBitsEXT,
@@ -8940,8 +8330,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkAccelerationStructureMotionInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_ray_tracing_motion_blur)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_ray_tracing_motion_blur");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_ray_tracing_motion_blur");
                 }
                 VkAccelerationStructureMotionInfoNV* structure = (VkAccelerationStructureMotionInfoNV*)header;
                 skip |= ValidateReservedFlags(pNext_loc.dot(Field::flags), structure->flags,
@@ -8965,9 +8354,8 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkMutableDescriptorTypeCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_valve_mutable_descriptor_type) &&
                     !IsExtEnabled(device_extensions.vk_ext_mutable_descriptor_type)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_VALVE_mutable_descriptor_type or "
-                                     "VK_EXT_mutable_descriptor_type");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc,
+                                                       "VK_VALVE_mutable_descriptor_type or VK_EXT_mutable_descriptor_type");
                 }
                 VkMutableDescriptorTypeCreateInfoEXT* structure = (VkMutableDescriptorTypeCreateInfoEXT*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::mutableDescriptorTypeListCount),
@@ -8998,8 +8386,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkDeviceAddressBindingCallbackDataEXT);
                 if ((!is_physdev_api && !IsExtEnabled(device_extensions.vk_ext_device_address_binding_report))) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_device_address_binding_report");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_device_address_binding_report");
                 }
                 VkDeviceAddressBindingCallbackDataEXT* structure = (VkDeviceAddressBindingCallbackDataEXT*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::flags), vvl::FlagBitmask::VkDeviceAddressBindingFlagBitsEXT,
@@ -9018,8 +8405,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineViewportDepthClipControlCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_depth_clip_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_depth_clip_control");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_depth_clip_control");
                 }
                 VkPipelineViewportDepthClipControlCreateInfoEXT* structure =
                     (VkPipelineViewportDepthClipControlCreateInfoEXT*)header;
@@ -9034,8 +8420,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImportMemoryZirconHandleInfoFUCHSIA);
                 if (!IsExtEnabled(device_extensions.vk_fuchsia_external_memory)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_FUCHSIA_external_memory");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_FUCHSIA_external_memory");
                 }
                 VkImportMemoryZirconHandleInfoFUCHSIA* structure = (VkImportMemoryZirconHandleInfoFUCHSIA*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::handleType), vvl::FlagBitmask::VkExternalMemoryHandleTypeFlagBits,
@@ -9050,8 +8435,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkImportMemoryBufferCollectionFUCHSIA);
                 if (!IsExtEnabled(device_extensions.vk_fuchsia_buffer_collection)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_FUCHSIA_buffer_collection");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_FUCHSIA_buffer_collection");
                 }
                 VkImportMemoryBufferCollectionFUCHSIA* structure = (VkImportMemoryBufferCollectionFUCHSIA*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::collection), structure->collection);
@@ -9064,8 +8448,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkBufferCollectionImageCreateInfoFUCHSIA);
                 if (!IsExtEnabled(device_extensions.vk_fuchsia_buffer_collection)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_FUCHSIA_buffer_collection");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_FUCHSIA_buffer_collection");
                 }
                 VkBufferCollectionImageCreateInfoFUCHSIA* structure = (VkBufferCollectionImageCreateInfoFUCHSIA*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::collection), structure->collection);
@@ -9078,8 +8461,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkBufferCollectionBufferCreateInfoFUCHSIA);
                 if (!IsExtEnabled(device_extensions.vk_fuchsia_buffer_collection)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_FUCHSIA_buffer_collection");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_FUCHSIA_buffer_collection");
                 }
                 VkBufferCollectionBufferCreateInfoFUCHSIA* structure = (VkBufferCollectionBufferCreateInfoFUCHSIA*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::collection), structure->collection);
@@ -9093,8 +8475,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSubpassShadingPipelineCreateInfoHUAWEI);
                 if (!IsExtEnabled(device_extensions.vk_huawei_subpass_shading)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_HUAWEI_subpass_shading");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_HUAWEI_subpass_shading");
                 }
                 VkSubpassShadingPipelineCreateInfoHUAWEI* structure = (VkSubpassShadingPipelineCreateInfoHUAWEI*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::renderPass), structure->renderPass);
@@ -9106,8 +8487,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkFrameBoundaryEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_frame_boundary)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_EXT_frame_boundary");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_frame_boundary");
                 }
                 VkFrameBoundaryEXT* structure = (VkFrameBoundaryEXT*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::flags), vvl::FlagBitmask::VkFrameBoundaryFlagBitsEXT,
@@ -9125,8 +8505,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkMultisampledRenderToSingleSampledInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_multisampled_render_to_single_sampled)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_multisampled_render_to_single_sampled");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_multisampled_render_to_single_sampled");
                 }
                 VkMultisampledRenderToSingleSampledInfoEXT* structure = (VkMultisampledRenderToSingleSampledInfoEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::multisampledRenderToSingleSampledEnable),
@@ -9144,8 +8523,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineColorWriteCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_color_write_enable)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_color_write_enable");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_color_write_enable");
                 }
                 VkPipelineColorWriteCreateInfoEXT* structure = (VkPipelineColorWriteCreateInfoEXT*)header;
                 skip |= ValidateBool32Array(pNext_loc.dot(Field::attachmentCount), pNext_loc.dot(Field::pColorWriteEnables),
@@ -9163,8 +8541,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkAccelerationStructureTrianglesOpacityMicromapEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_opacity_micromap)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_opacity_micromap");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_opacity_micromap");
                 }
                 VkAccelerationStructureTrianglesOpacityMicromapEXT* structure =
                     (VkAccelerationStructureTrianglesOpacityMicromapEXT*)header;
@@ -9194,8 +8571,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkAccelerationStructureTrianglesDisplacementMicromapNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_displacement_micromap)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_NV_displacement_micromap");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_displacement_micromap");
                 }
                 VkAccelerationStructureTrianglesDisplacementMicromapNV* structure =
                     (VkAccelerationStructureTrianglesDisplacementMicromapNV*)header;
@@ -9236,8 +8612,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 [[maybe_unused]] const Location pNext_loc =
                     loc.pNext(Struct::VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI);
                 if (!IsExtEnabled(device_extensions.vk_huawei_cluster_culling_shader)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_HUAWEI_cluster_culling_shader");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_HUAWEI_cluster_culling_shader");
                 }
                 VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI* structure =
                     (VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI*)header;
@@ -9251,8 +8626,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSamplerBorderColorComponentMappingCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_border_color_swizzle)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_border_color_swizzle");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_border_color_swizzle");
                 }
                 VkSamplerBorderColorComponentMappingCreateInfoEXT* structure =
                     (VkSamplerBorderColorComponentMappingCreateInfoEXT*)header;
@@ -9283,8 +8657,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassStripeBeginInfoARM);
                 if (!IsExtEnabled(device_extensions.vk_arm_render_pass_striped)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_ARM_render_pass_striped");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_ARM_render_pass_striped");
                 }
                 VkRenderPassStripeBeginInfoARM* structure = (VkRenderPassStripeBeginInfoARM*)header;
                 skip |= ValidateStructTypeArray(
@@ -9306,8 +8679,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassStripeSubmitInfoARM);
                 if (!IsExtEnabled(device_extensions.vk_arm_render_pass_striped)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_ARM_render_pass_striped");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_ARM_render_pass_striped");
                 }
                 VkRenderPassStripeSubmitInfoARM* structure = (VkRenderPassStripeSubmitInfoARM*)header;
                 skip |= ValidateStructTypeArray(pNext_loc.dot(Field::stripeSemaphoreInfoCount),
@@ -9340,8 +8712,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSubpassFragmentDensityMapOffsetEndInfoQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_fragment_density_map_offset)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_QCOM_fragment_density_map_offset");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_QCOM_fragment_density_map_offset");
                 }
                 VkSubpassFragmentDensityMapOffsetEndInfoQCOM* structure = (VkSubpassFragmentDensityMapOffsetEndInfoQCOM*)header;
                 skip |= ValidateArray(pNext_loc.dot(Field::fragmentDensityOffsetCount),
@@ -9371,8 +8742,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkExternalMemoryAcquireUnmodifiedEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_external_memory_acquire_unmodified)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_external_memory_acquire_unmodified");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_external_memory_acquire_unmodified");
                 }
                 VkExternalMemoryAcquireUnmodifiedEXT* structure = (VkExternalMemoryAcquireUnmodifiedEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::acquireUnmodifiedMemory), structure->acquireUnmodifiedMemory);
@@ -9384,8 +8754,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassCreationControlEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_subpass_merge_feedback)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_subpass_merge_feedback");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_subpass_merge_feedback");
                 }
                 VkRenderPassCreationControlEXT* structure = (VkRenderPassCreationControlEXT*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::disallowMerging), structure->disallowMerging);
@@ -9398,8 +8767,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassCreationFeedbackCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_subpass_merge_feedback)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_subpass_merge_feedback");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_subpass_merge_feedback");
                 }
                 VkRenderPassCreationFeedbackCreateInfoEXT* structure = (VkRenderPassCreationFeedbackCreateInfoEXT*)header;
                 skip |= ValidateRequiredPointer(pNext_loc.dot(Field::pRenderPassFeedback), structure->pRenderPassFeedback,
@@ -9417,8 +8785,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkRenderPassSubpassFeedbackCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_subpass_merge_feedback)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_subpass_merge_feedback");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_subpass_merge_feedback");
                 }
                 VkRenderPassSubpassFeedbackCreateInfoEXT* structure = (VkRenderPassSubpassFeedbackCreateInfoEXT*)header;
                 skip |= ValidateRequiredPointer(pNext_loc.dot(Field::pSubpassFeedback), structure->pSubpassFeedback,
@@ -9460,8 +8827,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineShaderStageModuleIdentifierCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_shader_module_identifier)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_shader_module_identifier");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_shader_module_identifier");
                 }
                 VkPipelineShaderStageModuleIdentifierCreateInfoEXT* structure =
                     (VkPipelineShaderStageModuleIdentifierCreateInfoEXT*)header;
@@ -9476,7 +8842,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkOpticalFlowImageFormatInfoNV);
                 if ((!is_physdev_api && !IsExtEnabled(device_extensions.vk_nv_optical_flow))) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_NV_optical_flow");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_optical_flow");
                 }
                 VkOpticalFlowImageFormatInfoNV* structure = (VkOpticalFlowImageFormatInfoNV*)header;
                 skip |= ValidateFlags(pNext_loc.dot(Field::usage), vvl::FlagBitmask::VkOpticalFlowUsageFlagBitsNV,
@@ -9492,7 +8858,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkOpticalFlowSessionCreatePrivateDataInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_optical_flow)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_NV_optical_flow");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_optical_flow");
                 }
                 VkOpticalFlowSessionCreatePrivateDataInfoNV* structure = (VkOpticalFlowSessionCreatePrivateDataInfoNV*)header;
                 skip |= ValidateRequiredPointer(pNext_loc.dot(Field::pPrivateData), structure->pPrivateData,
@@ -9516,7 +8882,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSwapchainLatencyCreateInfoNV);
                 if (!IsExtEnabled(device_extensions.vk_nv_low_latency2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_NV_low_latency2");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_NV_low_latency2");
                 }
                 VkSwapchainLatencyCreateInfoNV* structure = (VkSwapchainLatencyCreateInfoNV*)header;
                 skip |= ValidateBool32(pNext_loc.dot(Field::latencyModeEnable), structure->latencyModeEnable);
@@ -9532,8 +8898,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_multiview_per_view_render_areas)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_QCOM_multiview_per_view_render_areas");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_QCOM_multiview_per_view_render_areas");
                 }
                 VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM* structure =
                     (VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM*)header;
@@ -9558,8 +8923,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSamplerBlockMatchWindowCreateInfoQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_image_processing2)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_QCOM_image_processing2");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_QCOM_image_processing2");
                 }
                 VkSamplerBlockMatchWindowCreateInfoQCOM* structure = (VkSamplerBlockMatchWindowCreateInfoQCOM*)header;
                 skip |=
@@ -9575,8 +8939,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSamplerCubicWeightsCreateInfoQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_filter_cubic_weights)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_QCOM_filter_cubic_weights");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_QCOM_filter_cubic_weights");
                 }
                 VkSamplerCubicWeightsCreateInfoQCOM* structure = (VkSamplerCubicWeightsCreateInfoQCOM*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::cubicWeights), vvl::Enum::VkCubicFilterWeightsQCOM,
@@ -9590,8 +8953,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkBlitImageCubicWeightsInfoQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_filter_cubic_weights)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_QCOM_filter_cubic_weights");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_QCOM_filter_cubic_weights");
                 }
                 VkBlitImageCubicWeightsInfoQCOM* structure = (VkBlitImageCubicWeightsInfoQCOM*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::cubicWeights), vvl::Enum::VkCubicFilterWeightsQCOM,
@@ -9606,8 +8968,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM);
                 if (!IsExtEnabled(device_extensions.vk_qcom_ycbcr_degamma)) {
-                    skip |=
-                        LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions VK_QCOM_ycbcr_degamma");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_QCOM_ycbcr_degamma");
                 }
                 VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM* structure =
                     (VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM*)header;
@@ -9633,8 +8994,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkGeneratedCommandsPipelineInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_device_generated_commands)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_device_generated_commands");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_device_generated_commands");
                 }
                 VkGeneratedCommandsPipelineInfoEXT* structure = (VkGeneratedCommandsPipelineInfoEXT*)header;
                 skip |= ValidateRequiredHandle(pNext_loc.dot(Field::pipeline), structure->pipeline);
@@ -9646,8 +9006,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkGeneratedCommandsShaderInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_device_generated_commands)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_device_generated_commands");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_device_generated_commands");
                 }
                 VkGeneratedCommandsShaderInfoEXT* structure = (VkGeneratedCommandsShaderInfoEXT*)header;
                 skip |= ValidateHandleArray(pNext_loc.dot(Field::shaderCount), pNext_loc.dot(Field::pShaders),
@@ -9665,8 +9024,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkPipelineViewportDepthClampControlCreateInfoEXT);
                 if (!IsExtEnabled(device_extensions.vk_ext_depth_clamp_control)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_EXT_depth_clamp_control");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_EXT_depth_clamp_control");
                 }
                 VkPipelineViewportDepthClampControlCreateInfoEXT* structure =
                     (VkPipelineViewportDepthClampControlCreateInfoEXT*)header;
@@ -9686,8 +9044,7 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
             if (is_const_param) {
                 [[maybe_unused]] const Location pNext_loc = loc.pNext(Struct::VkWriteDescriptorSetAccelerationStructureKHR);
                 if (!IsExtEnabled(device_extensions.vk_khr_acceleration_structure)) {
-                    skip |= LogError(pnext_vuid, instance, pNext_loc,
-                                     "extended struct requires the extensions VK_KHR_acceleration_structure");
+                    skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "VK_KHR_acceleration_structure");
                 }
                 VkWriteDescriptorSetAccelerationStructureKHR* structure = (VkWriteDescriptorSetAccelerationStructureKHR*)header;
                 skip |=
@@ -11051,6 +10408,8 @@ bool StatelessValidation::PreCallValidateCreateBufferView(VkDevice device, const
                                                           const ErrorObject& error_obj) const {
     bool skip = false;
     [[maybe_unused]] const Location loc = error_obj.location;
+    auto cached_create_info = create_info_cache.Find(pCreateInfo, pAllocator, pView);
+    if (cached_create_info.validated) return skip;
     skip |= ValidateStructType(loc.dot(Field::pCreateInfo), pCreateInfo, VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO, true,
                                "VUID-vkCreateBufferView-pCreateInfo-parameter", "VUID-VkBufferViewCreateInfo-sType-sType");
     if (pCreateInfo != nullptr) {
@@ -11077,6 +10436,7 @@ bool StatelessValidation::PreCallValidateCreateBufferView(VkDevice device, const
     }
     skip |= ValidateRequiredPointer(loc.dot(Field::pView), pView, "VUID-vkCreateBufferView-pView-parameter");
     if (!skip) skip |= manual_PreCallValidateCreateBufferView(device, pCreateInfo, pAllocator, pView, error_obj);
+    create_info_cache.Insert(cached_create_info, skip);
     return skip;
 }
 
@@ -11199,6 +10559,8 @@ bool StatelessValidation::PreCallValidateCreateImageView(VkDevice device, const
                                                          const ErrorObject& error_obj) const {
     bool skip = false;
     [[maybe_unused]] const Location loc = error_obj.location;
+    auto cached_create_info = create_info_cache.Find(pCreateInfo, pAllocator, pView);
+    if (cached_create_info.validated) return skip;
     skip |= ValidateStructType(loc.dot(Field::pCreateInfo), pCreateInfo, VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO, true,
                                "VUID-vkCreateImageView-pCreateInfo-parameter", "VUID-VkImageViewCreateInfo-sType-sType");
     if (pCreateInfo != nullptr) {
@@ -11253,6 +10615,7 @@ bool StatelessValidation::PreCallValidateCreateImageView(VkDevice device, const
     }
     skip |= ValidateRequiredPointer(loc.dot(Field::pView), pView, "VUID-vkCreateImageView-pView-parameter");
     if (!skip) skip |= manual_PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView, error_obj);
+    create_info_cache.Insert(cached_create_info, skip);
     return skip;
 }
 
@@ -11617,6 +10980,8 @@ bool StatelessValidation::PreCallValidateCreateSampler(VkDevice device, const Vk
                                                        const ErrorObject& error_obj) const {
     bool skip = false;
     [[maybe_unused]] const Location loc = error_obj.location;
+    auto cached_create_info = create_info_cache.Find(pCreateInfo, pAllocator, pSampler);
+    if (cached_create_info.validated) return skip;
     skip |= ValidateStructType(loc.dot(Field::pCreateInfo), pCreateInfo, VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, true,
                                "VUID-vkCreateSampler-pCreateInfo-parameter", "VUID-VkSamplerCreateInfo-sType-sType");
     if (pCreateInfo != nullptr) {
@@ -11669,6 +11034,7 @@ bool StatelessValidation::PreCallValidateCreateSampler(VkDevice device, const Vk
     }
     skip |= ValidateRequiredPointer(loc.dot(Field::pSampler), pSampler, "VUID-vkCreateSampler-pSampler-parameter");
     if (!skip) skip |= manual_PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler, error_obj);
+    create_info_cache.Insert(cached_create_info, skip);
     return skip;
 }
 
@@ -2812,8 +2812,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bi
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
-    unique_lock_t lock(global_lock);
-    *pFence = (VkFence)global_unique_handle++;
+    *pFence = (VkFence)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2832,8 +2831,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice device, uint32_t fe
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
-    unique_lock_t lock(global_lock);
-    *pSemaphore = (VkSemaphore)global_unique_handle++;
+    *pSemaphore = (VkSemaphore)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2842,8 +2840,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
-    unique_lock_t lock(global_lock);
-    *pEvent = (VkEvent)global_unique_handle++;
+    *pEvent = (VkEvent)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2857,8 +2854,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(VkDevice device, VkEvent event)
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
-    unique_lock_t lock(global_lock);
-    *pQueryPool = (VkQueryPool)global_unique_handle++;
+    *pQueryPool = (VkQueryPool)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2873,8 +2869,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQue
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo,
                                                        const VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
-    unique_lock_t lock(global_lock);
-    *pView = (VkBufferView)global_unique_handle++;
+    *pView = (VkBufferView)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2883,8 +2878,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroyBufferView(VkDevice device, VkBufferVie
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkImageView* pView) {
-    unique_lock_t lock(global_lock);
-    *pView = (VkImageView)global_unique_handle++;
+    *pView = (VkImageView)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2893,8 +2887,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroyImageView(VkDevice device, VkImageView
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) {
-    unique_lock_t lock(global_lock);
-    *pShaderModule = (VkShaderModule)global_unique_handle++;
+    *pShaderModule = (VkShaderModule)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2904,8 +2897,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderM
 static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator,
                                                           VkPipelineCache* pPipelineCache) {
-    unique_lock_t lock(global_lock);
-    *pPipelineCache = (VkPipelineCache)global_unique_handle++;
+    *pPipelineCache = (VkPipelineCache)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2926,9 +2918,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, V
                                                               uint32_t createInfoCount,
                                                               const VkGraphicsPipelineCreateInfo* pCreateInfos,
                                                               const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
+    const uint64_t first_handle = NewHandles(createInfoCount);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
-        pPipelines[i] = (VkPipeline)global_unique_handle++;
+        pPipelines[i] = (VkPipeline)(first_handle + i);
     }
     return VK_SUCCESS;
 }
@@ -2937,9 +2929,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, Vk
                                                              uint32_t createInfoCount,
                                                              const VkComputePipelineCreateInfo* pCreateInfos,
                                                              const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
+    const uint64_t first_handle = NewHandles(createInfoCount);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
-        pPipelines[i] = (VkPipeline)global_unique_handle++;
+        pPipelines[i] = (VkPipeline)(first_handle + i);
     }
     return VK_SUCCESS;
 }
@@ -2949,8 +2941,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pi
 static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator,
                                                            VkPipelineLayout* pPipelineLayout) {
-    unique_lock_t lock(global_lock);
-    *pPipelineLayout = (VkPipelineLayout)global_unique_handle++;
+    *pPipelineLayout = (VkPipelineLayout)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2959,8 +2950,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipel
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
                                                     const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
-    unique_lock_t lock(global_lock);
-    *pSampler = (VkSampler)global_unique_handle++;
+    *pSampler = (VkSampler)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2969,8 +2959,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroySampler(VkDevice device, VkSampler samp
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
                                                                 const VkAllocationCallbacks* pAllocator,
                                                                 VkDescriptorSetLayout* pSetLayout) {
-    unique_lock_t lock(global_lock);
-    *pSetLayout = (VkDescriptorSetLayout)global_unique_handle++;
+    *pSetLayout = (VkDescriptorSetLayout)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2980,8 +2969,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, Vk
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator,
                                                            VkDescriptorPool* pDescriptorPool) {
-    unique_lock_t lock(global_lock);
-    *pDescriptorPool = (VkDescriptorPool)global_unique_handle++;
+    *pDescriptorPool = (VkDescriptorPool)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -2995,9 +2983,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDes
 
 static VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo,
                                                              VkDescriptorSet* pDescriptorSets) {
-    unique_lock_t lock(global_lock);
+    const uint64_t first_handle = NewHandles(pAllocateInfo->descriptorSetCount);
     for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
-        pDescriptorSets[i] = (VkDescriptorSet)global_unique_handle++;
+        pDescriptorSets[i] = (VkDescriptorSet)(first_handle + i);
     }
     return VK_SUCCESS;
 }
@@ -3013,8 +3001,7 @@ static VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice device, uint32_t
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
-    unique_lock_t lock(global_lock);
-    *pFramebuffer = (VkFramebuffer)global_unique_handle++;
+    *pFramebuffer = (VkFramebuffer)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3023,8 +3010,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuf
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo,
                                                        const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
-    unique_lock_t lock(global_lock);
-    *pRenderPass = (VkRenderPass)global_unique_handle++;
+    *pRenderPass = (VkRenderPass)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3217,8 +3203,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(VkDevice devi
                                                                    const VkSamplerYcbcrConversionCreateInfo* pCreateInfo,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkSamplerYcbcrConversion* pYcbcrConversion) {
-    unique_lock_t lock(global_lock);
-    *pYcbcrConversion = (VkSamplerYcbcrConversion)global_unique_handle++;
+    *pYcbcrConversion = (VkSamplerYcbcrConversion)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3229,8 +3214,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(VkDevice de
                                                                      const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
                                                                      const VkAllocationCallbacks* pAllocator,
                                                                      VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
-    unique_lock_t lock(global_lock);
-    *pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate)global_unique_handle++;
+    *pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3252,8 +3236,7 @@ static VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(VkCommandBuffer co
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
-    unique_lock_t lock(global_lock);
-    *pRenderPass = (VkRenderPass)global_unique_handle++;
+    *pRenderPass = (VkRenderPass)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3297,8 +3280,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolProperties(VkPhysical
 static VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(VkDevice device, const VkPrivateDataSlotCreateInfo* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator,
                                                             VkPrivateDataSlot* pPrivateDataSlot) {
-    unique_lock_t lock(global_lock);
-    *pPrivateDataSlot = (VkPrivateDataSlot)global_unique_handle++;
+    *pPrivateDataSlot = (VkPrivateDataSlot)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3428,8 +3410,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModePropertiesKHR(VkPhysicalDevi
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display,
                                                            const VkDisplayModeCreateInfoKHR* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) {
-    unique_lock_t lock(global_lock);
-    *pMode = (VkDisplayModeKHR)global_unique_handle++;
+    *pMode = (VkDisplayModeKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3443,8 +3424,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(VkInstance in
                                                                    const VkDisplaySurfaceCreateInfoKHR* pCreateInfo,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3452,9 +3432,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device,
                                                                 const VkSwapchainCreateInfoKHR* pCreateInfos,
                                                                 const VkAllocationCallbacks* pAllocator,
                                                                 VkSwapchainKHR* pSwapchains) {
-    unique_lock_t lock(global_lock);
+    const uint64_t first_handle = NewHandles(swapchainCount);
     for (uint32_t i = 0; i < swapchainCount; ++i) {
-        pSwapchains[i] = (VkSwapchainKHR)global_unique_handle++;
+        pSwapchains[i] = (VkSwapchainKHR)(first_handle + i);
     }
     return VK_SUCCESS;
 }
@@ -3462,8 +3442,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device,
 #ifdef VK_USE_PLATFORM_XLIB_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3477,8 +3456,7 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXlibPresentationSupportKH
 #ifdef VK_USE_PLATFORM_XCB_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3493,8 +3471,7 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupportKHR
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo,
                                                               const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3508,8 +3485,7 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWaylandPresentationSuppor
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo,
                                                               const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3517,8 +3493,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(VkInstance instanc
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3531,8 +3506,7 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupportK
 static VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(VkDevice device, const VkVideoSessionCreateInfoKHR* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator,
                                                             VkVideoSessionKHR* pVideoSession) {
-    unique_lock_t lock(global_lock);
-    *pVideoSession = (VkVideoSessionKHR)global_unique_handle++;
+    *pVideoSession = (VkVideoSessionKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3549,8 +3523,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionParametersKHR(VkDevice d
                                                                       const VkVideoSessionParametersCreateInfoKHR* pCreateInfo,
                                                                       const VkAllocationCallbacks* pAllocator,
                                                                       VkVideoSessionParametersKHR* pVideoSessionParameters) {
-    unique_lock_t lock(global_lock);
-    *pVideoSessionParameters = (VkVideoSessionParametersKHR)global_unique_handle++;
+    *pVideoSessionParameters = (VkVideoSessionParametersKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -3886,8 +3859,7 @@ static VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(VkD
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                                                  VkDeferredOperationKHR* pDeferredOperation) {
-    unique_lock_t lock(global_lock);
-    *pDeferredOperation = (VkDeferredOperationKHR)global_unique_handle++;
+    *pDeferredOperation = (VkDeferredOperationKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4071,8 +4043,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(VkInstance in
                                                                    const VkDebugReportCallbackCreateInfoEXT* pCreateInfo,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkDebugReportCallbackEXT* pCallback) {
-    unique_lock_t lock(global_lock);
-    *pCallback = (VkDebugReportCallbackEXT)global_unique_handle++;
+    *pCallback = (VkDebugReportCallbackEXT)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4125,15 +4096,13 @@ static VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(VkCommandBuffer co
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCuModuleNVX(VkDevice device, const VkCuModuleCreateInfoNVX* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkCuModuleNVX* pModule) {
-    unique_lock_t lock(global_lock);
-    *pModule = (VkCuModuleNVX)global_unique_handle++;
+    *pModule = (VkCuModuleNVX)NewHandles();
     return VK_SUCCESS;
 }
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCuFunctionNVX(VkDevice device, const VkCuFunctionCreateInfoNVX* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator, VkCuFunctionNVX* pFunction) {
-    unique_lock_t lock(global_lock);
-    *pFunction = (VkCuFunctionNVX)global_unique_handle++;
+    *pFunction = (VkCuFunctionNVX)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4177,8 +4146,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateStreamDescriptorSurfaceGGP(VkInstanc
                                                                        const VkStreamDescriptorSurfaceCreateInfoGGP* pCreateInfo,
                                                                        const VkAllocationCallbacks* pAllocator,
                                                                        VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4200,8 +4168,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(VkDevice device, Vk
 #ifdef VK_USE_PLATFORM_VI_NN
 static VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(VkInstance instance, const VkViSurfaceCreateInfoNN* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4276,8 +4243,7 @@ static VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(VkDevice device, uint32_t sw
 #ifdef VK_USE_PLATFORM_IOS_MVK
 static VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(VkInstance instance, const VkIOSSurfaceCreateInfoMVK* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4285,8 +4251,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(VkInstance instance, c
 #ifdef VK_USE_PLATFORM_MACOS_MVK
 static VKAPI_ATTR VkResult VKAPI_CALL CreateMacOSSurfaceMVK(VkInstance instance, const VkMacOSSurfaceCreateInfoMVK* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4317,8 +4282,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDebugUtilsMessengerEXT(VkInstance in
                                                                    const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkDebugUtilsMessengerEXT* pMessenger) {
-    unique_lock_t lock(global_lock);
-    *pMessenger = (VkDebugUtilsMessengerEXT)global_unique_handle++;
+    *pMessenger = (VkDebugUtilsMessengerEXT)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4343,9 +4307,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateExecutionGraphPipelinesAMDX(VkDevice
                                                                         const VkExecutionGraphPipelineCreateInfoAMDX* pCreateInfos,
                                                                         const VkAllocationCallbacks* pAllocator,
                                                                         VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
+    const uint64_t first_handle = NewHandles(createInfoCount);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
-        pPipelines[i] = (VkPipeline)global_unique_handle++;
+        pPipelines[i] = (VkPipeline)(first_handle + i);
     }
     return VK_SUCCESS;
 }
@@ -4385,8 +4349,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(VkD
 static VKAPI_ATTR VkResult VKAPI_CALL CreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo,
                                                                const VkAllocationCallbacks* pAllocator,
                                                                VkValidationCacheEXT* pValidationCache) {
-    unique_lock_t lock(global_lock);
-    *pValidationCache = (VkValidationCacheEXT)global_unique_handle++;
+    *pValidationCache = (VkValidationCacheEXT)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4419,8 +4382,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(VkDevice dev
                                                                     const VkAccelerationStructureCreateInfoNV* pCreateInfo,
                                                                     const VkAllocationCallbacks* pAllocator,
                                                                     VkAccelerationStructureNV* pAccelerationStructure) {
-    unique_lock_t lock(global_lock);
-    *pAccelerationStructure = (VkAccelerationStructureNV)global_unique_handle++;
+    *pAccelerationStructure = (VkAccelerationStructureNV)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4454,9 +4416,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(VkDevice devic
                                                                   uint32_t createInfoCount,
                                                                   const VkRayTracingPipelineCreateInfoNV* pCreateInfos,
                                                                   const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
+    const uint64_t first_handle = NewHandles(createInfoCount);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
-        pPipelines[i] = (VkPipeline)global_unique_handle++;
+        pPipelines[i] = (VkPipeline)(first_handle + i);
     }
     return VK_SUCCESS;
 }
@@ -4578,8 +4540,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(VkInstance i
                                                                     const VkImagePipeSurfaceCreateInfoFUCHSIA* pCreateInfo,
                                                                     const VkAllocationCallbacks* pAllocator,
                                                                     VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4587,8 +4548,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(VkInstance i
 #ifdef VK_USE_PLATFORM_METAL_EXT
 static VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(VkInstance instance, const VkMetalSurfaceCreateInfoEXT* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4639,8 +4599,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(VkDe
 static VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(VkInstance instance,
                                                                const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo,
                                                                const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4755,8 +4714,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(VkDevice de
                                                                      const VkIndirectCommandsLayoutCreateInfoNV* pCreateInfo,
                                                                      const VkAllocationCallbacks* pAllocator,
                                                                      VkIndirectCommandsLayoutNV* pIndirectCommandsLayout) {
-    unique_lock_t lock(global_lock);
-    *pIndirectCommandsLayout = (VkIndirectCommandsLayoutNV)global_unique_handle++;
+    *pIndirectCommandsLayout = (VkIndirectCommandsLayoutNV)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4798,8 +4756,7 @@ static VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(VkDevice device, VkObjectTyp
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCudaModuleNV(VkDevice device, const VkCudaModuleCreateInfoNV* pCreateInfo,
                                                          const VkAllocationCallbacks* pAllocator, VkCudaModuleNV* pModule) {
-    unique_lock_t lock(global_lock);
-    *pModule = (VkCudaModuleNV)global_unique_handle++;
+    *pModule = (VkCudaModuleNV)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4810,8 +4767,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetCudaModuleCacheNV(VkDevice device, VkCu
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCudaFunctionNV(VkDevice device, const VkCudaFunctionCreateInfoNV* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator, VkCudaFunctionNV* pFunction) {
-    unique_lock_t lock(global_lock);
-    *pFunction = (VkCudaFunctionNV)global_unique_handle++;
+    *pFunction = (VkCudaFunctionNV)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4897,8 +4853,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetWinrtDisplayNV(VkPhysicalDevice physica
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDirectFBSurfaceEXT(VkInstance instance,
                                                                const VkDirectFBSurfaceCreateInfoEXT* pCreateInfo,
                                                                const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -4940,8 +4895,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateBufferCollectionFUCHSIA(VkDevice dev
                                                                     const VkBufferCollectionCreateInfoFUCHSIA* pCreateInfo,
                                                                     const VkAllocationCallbacks* pAllocator,
                                                                     VkBufferCollectionFUCHSIA* pCollection) {
-    unique_lock_t lock(global_lock);
-    *pCollection = (VkBufferCollectionFUCHSIA)global_unique_handle++;
+    *pCollection = (VkBufferCollectionFUCHSIA)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -5005,8 +4959,7 @@ static VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(VkCommandBuffe
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
 static VKAPI_ATTR VkResult VKAPI_CALL CreateScreenSurfaceQNX(VkInstance instance, const VkScreenSurfaceCreateInfoQNX* pCreateInfo,
                                                              const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
-    *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    *pSurface = (VkSurfaceKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -5030,8 +4983,7 @@ static VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(VkCommandBuffer command
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateMicromapEXT(VkDevice device, const VkMicromapCreateInfoEXT* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkMicromapEXT* pMicromap) {
-    unique_lock_t lock(global_lock);
-    *pMicromap = (VkMicromapEXT)global_unique_handle++;
+    *pMicromap = (VkMicromapEXT)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -5226,8 +5178,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateOpticalFlowSessionNV(VkDevice device
                                                                  const VkOpticalFlowSessionCreateInfoNV* pCreateInfo,
                                                                  const VkAllocationCallbacks* pAllocator,
                                                                  VkOpticalFlowSessionNV* pSession) {
-    unique_lock_t lock(global_lock);
-    *pSession = (VkOpticalFlowSessionNV)global_unique_handle++;
+    *pSession = (VkOpticalFlowSessionNV)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -5248,9 +5199,9 @@ static VKAPI_ATTR void VKAPI_CALL AntiLagUpdateAMD(VkDevice device, const VkAnti
 static VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t createInfoCount,
                                                        const VkShaderCreateInfoEXT* pCreateInfos,
                                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders) {
-    unique_lock_t lock(global_lock);
+    const uint64_t first_handle = NewHandles(createInfoCount);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
-        pShaders[i] = (VkShaderEXT)global_unique_handle++;
+        pShaders[i] = (VkShaderEXT)(first_handle + i);
     }
     return VK_SUCCESS;
 }
@@ -5320,8 +5271,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutEXT(VkDevice d
                                                                       const VkIndirectCommandsLayoutCreateInfoEXT* pCreateInfo,
                                                                       const VkAllocationCallbacks* pAllocator,
                                                                       VkIndirectCommandsLayoutEXT* pIndirectCommandsLayout) {
-    unique_lock_t lock(global_lock);
-    *pIndirectCommandsLayout = (VkIndirectCommandsLayoutEXT)global_unique_handle++;
+    *pIndirectCommandsLayout = (VkIndirectCommandsLayoutEXT)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -5333,8 +5283,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectExecutionSetEXT(VkDevice dev
                                                                     const VkIndirectExecutionSetCreateInfoEXT* pCreateInfo,
                                                                     const VkAllocationCallbacks* pAllocator,
                                                                     VkIndirectExecutionSetEXT* pIndirectExecutionSet) {
-    unique_lock_t lock(global_lock);
-    *pIndirectExecutionSet = (VkIndirectExecutionSetEXT)global_unique_handle++;
+    *pIndirectExecutionSet = (VkIndirectExecutionSetEXT)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -5358,8 +5307,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(VkDevice de
                                                                      const VkAccelerationStructureCreateInfoKHR* pCreateInfo,
                                                                      const VkAllocationCallbacks* pAllocator,
                                                                      VkAccelerationStructureKHR* pAccelerationStructure) {
-    unique_lock_t lock(global_lock);
-    *pAccelerationStructure = (VkAccelerationStructureKHR)global_unique_handle++;
+    *pAccelerationStructure = (VkAccelerationStructureKHR)NewHandles();
     return VK_SUCCESS;
 }
 
@@ -5434,9 +5382,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice devi
                                                                    const VkRayTracingPipelineCreateInfoKHR* pCreateInfos,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
+    const uint64_t first_handle = NewHandles(createInfoCount);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
-        pPipelines[i] = (VkPipeline)global_unique_handle++;
+        pPipelines[i] = (VkPipeline)(first_handle + i);
     }
     return VK_SUCCESS;
 }
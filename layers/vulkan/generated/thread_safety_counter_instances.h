@@ -23,56 +23,56 @@
 
 // NOLINTBEGIN
 // clang-format off
-c_VkBuffer(kVulkanObjectTypeBuffer, this),
-c_VkImage(kVulkanObjectTypeImage, this),
-c_VkSemaphore(kVulkanObjectTypeSemaphore, this),
-c_VkFence(kVulkanObjectTypeFence, this),
-c_VkDeviceMemory(kVulkanObjectTypeDeviceMemory, this),
-c_VkEvent(kVulkanObjectTypeEvent, this),
-c_VkQueryPool(kVulkanObjectTypeQueryPool, this),
-c_VkBufferView(kVulkanObjectTypeBufferView, this),
-c_VkImageView(kVulkanObjectTypeImageView, this),
-c_VkShaderModule(kVulkanObjectTypeShaderModule, this),
-c_VkPipelineCache(kVulkanObjectTypePipelineCache, this),
-c_VkPipelineLayout(kVulkanObjectTypePipelineLayout, this),
-c_VkPipeline(kVulkanObjectTypePipeline, this),
-c_VkRenderPass(kVulkanObjectTypeRenderPass, this),
-c_VkDescriptorSetLayout(kVulkanObjectTypeDescriptorSetLayout, this),
-c_VkSampler(kVulkanObjectTypeSampler, this),
-c_VkDescriptorSet(kVulkanObjectTypeDescriptorSet, this),
-c_VkDescriptorPool(kVulkanObjectTypeDescriptorPool, this),
-c_VkFramebuffer(kVulkanObjectTypeFramebuffer, this),
-c_VkCommandPool(kVulkanObjectTypeCommandPool, this),
-c_VkSamplerYcbcrConversion(kVulkanObjectTypeSamplerYcbcrConversion, this),
-c_VkDescriptorUpdateTemplate(kVulkanObjectTypeDescriptorUpdateTemplate, this),
-c_VkPrivateDataSlot(kVulkanObjectTypePrivateDataSlot, this),
-c_VkSurfaceKHR(kVulkanObjectTypeSurfaceKHR, this),
-c_VkSwapchainKHR(kVulkanObjectTypeSwapchainKHR, this),
-c_VkDisplayKHR(kVulkanObjectTypeDisplayKHR, this),
-c_VkDisplayModeKHR(kVulkanObjectTypeDisplayModeKHR, this),
-c_VkVideoSessionKHR(kVulkanObjectTypeVideoSessionKHR, this),
-c_VkVideoSessionParametersKHR(kVulkanObjectTypeVideoSessionParametersKHR, this),
-c_VkDeferredOperationKHR(kVulkanObjectTypeDeferredOperationKHR, this),
-c_VkPipelineBinaryKHR(kVulkanObjectTypePipelineBinaryKHR, this),
-c_VkDebugReportCallbackEXT(kVulkanObjectTypeDebugReportCallbackEXT, this),
-c_VkCuModuleNVX(kVulkanObjectTypeCuModuleNVX, this),
-c_VkCuFunctionNVX(kVulkanObjectTypeCuFunctionNVX, this),
-c_VkDebugUtilsMessengerEXT(kVulkanObjectTypeDebugUtilsMessengerEXT, this),
-c_VkValidationCacheEXT(kVulkanObjectTypeValidationCacheEXT, this),
-c_VkAccelerationStructureNV(kVulkanObjectTypeAccelerationStructureNV, this),
-c_VkPerformanceConfigurationINTEL(kVulkanObjectTypePerformanceConfigurationINTEL, this),
-c_VkIndirectCommandsLayoutNV(kVulkanObjectTypeIndirectCommandsLayoutNV, this),
-c_VkCudaModuleNV(kVulkanObjectTypeCudaModuleNV, this),
-c_VkCudaFunctionNV(kVulkanObjectTypeCudaFunctionNV, this),
-c_VkAccelerationStructureKHR(kVulkanObjectTypeAccelerationStructureKHR, this),
+c_VkBuffer(kVulkanObjectTypeBuffer, this, &ObjectUseSlots()),
+c_VkImage(kVulkanObjectTypeImage, this, &ObjectUseSlots()),
+c_VkSemaphore(kVulkanObjectTypeSemaphore, this, &ObjectUseSlots()),
+c_VkFence(kVulkanObjectTypeFence, this, &ObjectUseSlots()),
+c_VkDeviceMemory(kVulkanObjectTypeDeviceMemory, this, &ObjectUseSlots()),
+c_VkEvent(kVulkanObjectTypeEvent, this, &ObjectUseSlots()),
+c_VkQueryPool(kVulkanObjectTypeQueryPool, this, &ObjectUseSlots()),
+c_VkBufferView(kVulkanObjectTypeBufferView, this, &ObjectUseSlots()),
+c_VkImageView(kVulkanObjectTypeImageView, this, &ObjectUseSlots()),
+c_VkShaderModule(kVulkanObjectTypeShaderModule, this, &ObjectUseSlots()),
+c_VkPipelineCache(kVulkanObjectTypePipelineCache, this, &ObjectUseSlots()),
+c_VkPipelineLayout(kVulkanObjectTypePipelineLayout, this, &ObjectUseSlots()),
+c_VkPipeline(kVulkanObjectTypePipeline, this, &ObjectUseSlots()),
+c_VkRenderPass(kVulkanObjectTypeRenderPass, this, &ObjectUseSlots()),
+c_VkDescriptorSetLayout(kVulkanObjectTypeDescriptorSetLayout, this, &ObjectUseSlots()),
+c_VkSampler(kVulkanObjectTypeSampler, this, &ObjectUseSlots()),
+c_VkDescriptorSet(kVulkanObjectTypeDescriptorSet, this, &ObjectUseSlots()),
+c_VkDescriptorPool(kVulkanObjectTypeDescriptorPool, this, &ObjectUseSlots()),
+c_VkFramebuffer(kVulkanObjectTypeFramebuffer, this, &ObjectUseSlots()),
+c_VkCommandPool(kVulkanObjectTypeCommandPool, this, &ObjectUseSlots()),
+c_VkSamplerYcbcrConversion(kVulkanObjectTypeSamplerYcbcrConversion, this, &ObjectUseSlots()),
+c_VkDescriptorUpdateTemplate(kVulkanObjectTypeDescriptorUpdateTemplate, this, &ObjectUseSlots()),
+c_VkPrivateDataSlot(kVulkanObjectTypePrivateDataSlot, this, &ObjectUseSlots()),
+c_VkSurfaceKHR(kVulkanObjectTypeSurfaceKHR, this, &ObjectUseSlots()),
+c_VkSwapchainKHR(kVulkanObjectTypeSwapchainKHR, this, &ObjectUseSlots()),
+c_VkDisplayKHR(kVulkanObjectTypeDisplayKHR, this, &ObjectUseSlots()),
+c_VkDisplayModeKHR(kVulkanObjectTypeDisplayModeKHR, this, &ObjectUseSlots()),
+c_VkVideoSessionKHR(kVulkanObjectTypeVideoSessionKHR, this, &ObjectUseSlots()),
+c_VkVideoSessionParametersKHR(kVulkanObjectTypeVideoSessionParametersKHR, this, &ObjectUseSlots()),
+c_VkDeferredOperationKHR(kVulkanObjectTypeDeferredOperationKHR, this, &ObjectUseSlots()),
+c_VkPipelineBinaryKHR(kVulkanObjectTypePipelineBinaryKHR, this, &ObjectUseSlots()),
+c_VkDebugReportCallbackEXT(kVulkanObjectTypeDebugReportCallbackEXT, this, &ObjectUseSlots()),
+c_VkCuModuleNVX(kVulkanObjectTypeCuModuleNVX, this, &ObjectUseSlots()),
+c_VkCuFunctionNVX(kVulkanObjectTypeCuFunctionNVX, this, &ObjectUseSlots()),
+c_VkDebugUtilsMessengerEXT(kVulkanObjectTypeDebugUtilsMessengerEXT, this, &ObjectUseSlots()),
+c_VkValidationCacheEXT(kVulkanObjectTypeValidationCacheEXT, this, &ObjectUseSlots()),
+c_VkAccelerationStructureNV(kVulkanObjectTypeAccelerationStructureNV, this, &ObjectUseSlots()),
+c_VkPerformanceConfigurationINTEL(kVulkanObjectTypePerformanceConfigurationINTEL, this, &ObjectUseSlots()),
+c_VkIndirectCommandsLayoutNV(kVulkanObjectTypeIndirectCommandsLayoutNV, this, &ObjectUseSlots()),
+c_VkCudaModuleNV(kVulkanObjectTypeCudaModuleNV, this, &ObjectUseSlots()),
+c_VkCudaFunctionNV(kVulkanObjectTypeCudaFunctionNV, this, &ObjectUseSlots()),
+c_VkAccelerationStructureKHR(kVulkanObjectTypeAccelerationStructureKHR, this, &ObjectUseSlots()),
 #ifdef VK_USE_PLATFORM_FUCHSIA
-c_VkBufferCollectionFUCHSIA(kVulkanObjectTypeBufferCollectionFUCHSIA, this),
+c_VkBufferCollectionFUCHSIA(kVulkanObjectTypeBufferCollectionFUCHSIA, this, &ObjectUseSlots()),
 #endif  // VK_USE_PLATFORM_FUCHSIA
-c_VkMicromapEXT(kVulkanObjectTypeMicromapEXT, this),
-c_VkOpticalFlowSessionNV(kVulkanObjectTypeOpticalFlowSessionNV, this),
-c_VkShaderEXT(kVulkanObjectTypeShaderEXT, this),
-c_VkIndirectExecutionSetEXT(kVulkanObjectTypeIndirectExecutionSetEXT, this),
-c_VkIndirectCommandsLayoutEXT(kVulkanObjectTypeIndirectCommandsLayoutEXT, this),
+c_VkMicromapEXT(kVulkanObjectTypeMicromapEXT, this, &ObjectUseSlots()),
+c_VkOpticalFlowSessionNV(kVulkanObjectTypeOpticalFlowSessionNV, this, &ObjectUseSlots()),
+c_VkShaderEXT(kVulkanObjectTypeShaderEXT, this, &ObjectUseSlots()),
+c_VkIndirectExecutionSetEXT(kVulkanObjectTypeIndirectExecutionSetEXT, this, &ObjectUseSlots()),
+c_VkIndirectCommandsLayoutEXT(kVulkanObjectTypeIndirectCommandsLayoutEXT, this, &ObjectUseSlots()),
     // clang-format on
 
     // NOLINTEND
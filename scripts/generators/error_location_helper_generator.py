@@ -182,7 +182,7 @@ namespace vvl {
 ''')
         out.append('''
 const char* String(Func func) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Func::Empty
 ''')
         # Need to be alpha-sort also to match array indexing
@@ -193,7 +193,7 @@ const char* String(Func func) {
 }
 
 const char* String(Struct structure) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Struct::Empty
 ''')
         # Need to be alpha-sort also to match array indexing
@@ -204,7 +204,7 @@ const char* String(Struct structure) {
 }
 
 const char* String(Field field) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Field::Empty
 ''')
         for field in self.fields:
@@ -214,7 +214,7 @@ const char* String(Field field) {
 }
 
 const char* String(Enum value) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Enum::Empty
 ''')
         # Need to be alpha-sort also to match array indexing
@@ -225,7 +225,7 @@ const char* String(Enum value) {
 }
 
 const char* String(FlagBitmask value) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // FlagBitmask::Empty
 ''')
         # Need to be alpha-sort also to match array indexing
@@ -236,7 +236,7 @@ const char* String(FlagBitmask value) {
 }
 
 const char* String(Extension extension) {
-    static const std::string_view table[] = {
+    static constexpr std::string_view table[] = {
     {"INVALID_EMPTY", 15}, // Extension::Empty
 ''')
         for extension in sorted(self.vk.extensions.values(), key=lambda x: x.name):
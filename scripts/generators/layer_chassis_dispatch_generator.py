@@ -105,6 +105,26 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             'vkGetPipelineKeyKHR',
             ]
 
+        # Entry points called every frame. When their structs chain no extension with handles, they are unwrapped in a thread
+        # local scratch arena instead of heap allocated safe structs (see chassis/dispatch_scratch.h)
+        submit_params = 'submitCount, pSubmits'
+        barrier_params = 'bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers'
+        # The second element is the call, {} is replaced by the parameters of the command
+        self.scratch_unwrap_commands = {
+            'vkUpdateDescriptorSets': ('descriptorWriteCount, pDescriptorWrites',
+                                       'ScratchDispatchUpdateDescriptorSets(layer_data, {})'),
+            'vkQueueSubmit': (submit_params, 'ScratchDispatchQueueSubmit(layer_data, {})'),
+            'vkQueueSubmit2': (submit_params,
+                               'ScratchDispatchQueueSubmit2(layer_data, layer_data->device_dispatch_table.QueueSubmit2, {})'),
+            'vkQueueSubmit2KHR': (submit_params,
+                                  'ScratchDispatchQueueSubmit2(layer_data, layer_data->device_dispatch_table.QueueSubmit2KHR, {})'),
+            'vkCmdPipelineBarrier': (barrier_params, 'ScratchDispatchCmdPipelineBarrier(layer_data, {})'),
+            'vkCmdPipelineBarrier2': ('pDependencyInfo', 'ScratchDispatchCmdPipelineBarrier2(layer_data, '
+                                      'layer_data->device_dispatch_table.CmdPipelineBarrier2, {})'),
+            'vkCmdPipelineBarrier2KHR': ('pDependencyInfo', 'ScratchDispatchCmdPipelineBarrier2(layer_data, '
+                                         'layer_data->device_dispatch_table.CmdPipelineBarrier2KHR, {})'),
+        }
+
         # List of all extension structs strings containing handles
         self.ndo_extension_structs = [
             # These are added manually because vkGetPipelineKeyKHR needs to unwrap these (see VUID 09604)
@@ -174,6 +194,8 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             #include <vulkan/vulkan.h>
 
             extern bool wrap_handles;
+            // True if handle is a live unique_id_mapping id, always false when handle wrapping is off
+            bool IsWrappedHandle(uint64_t handle);
 
             class ValidationObject;
             void UnwrapPnextChainHandles(ValidationObject *layer_data, const void *pNext);
@@ -207,6 +229,7 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             #include "layer_chassis_dispatch.h"
             #include <vulkan/utility/vk_safe_struct.hpp>
             #include "state_tracker/pipeline_state.h"
+            #include "chassis/dispatch_scratch.h"
 
             #define DISPATCH_MAX_STACK_ALLOCATIONS 32
 
@@ -348,6 +371,11 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             # Put all this together for the final down-chain call
             if not down_chain_call_only:
                 out.append(f'if (!wrap_handles) return layer_data->{dispatch_table}.{command.name[2:]}({paramstext});\n')
+            if command.name in self.scratch_unwrap_commands:
+                (can_unwrap_params, scratch_call) = self.scratch_unwrap_commands[command.name]
+                out.append(f'''if (vvl::dispatch::CanUnwrapInScratch({can_unwrap_params})) {{
+                    return {scratch_call.format(paramstext)};
+                }}\n''')
 
             # Handle return values, if any
             assignResult = f'{command.returnType} result = ' if command.returnType != 'void' else ''
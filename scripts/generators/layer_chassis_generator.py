@@ -108,6 +108,44 @@ class APISpecific:
             ]
 
 
+    # Generates the visitor used to call hooks on the concrete validation object types
+    @staticmethod
+    def genVisitValidationObjectSource(targetApiName: str) -> str:
+        match targetApiName:
+
+            # Vulkan specific VisitValidationObject
+            case 'vulkan':
+                return '''
+// clang-format off
+// Calls hook with the validation object cast to its concrete type. The validation object classes are final, so the
+// call is resolved at compile time and small hooks can be inlined, instead of going through the vtable.
+template <typename From, typename To>
+using ConstLike = std::conditional_t<std::is_const_v<From>, const To, To>;
+
+template <typename VO, typename Hook>
+decltype(auto) VisitValidationObject(VO* object, Hook&& hook) {
+    switch (object->container_type) {
+        case LayerObjectTypeThreading:
+            return hook(static_cast<ConstLike<VO, ThreadSafety>*>(object));
+        case LayerObjectTypeParameterValidation:
+            return hook(static_cast<ConstLike<VO, StatelessValidation>*>(object));
+        case LayerObjectTypeObjectTracker:
+            return hook(static_cast<ConstLike<VO, ObjectLifetimes>*>(object));
+        case LayerObjectTypeCoreValidation:
+            return hook(static_cast<ConstLike<VO, CoreChecks>*>(object));
+        case LayerObjectTypeBestPractices:
+            return hook(static_cast<ConstLike<VO, BestPractices>*>(object));
+        case LayerObjectTypeGpuAssisted:
+            return hook(static_cast<ConstLike<VO, gpuav::Validator>*>(object));
+        case LayerObjectTypeSyncValidation:
+            return hook(static_cast<ConstLike<VO, SyncValidator>*>(object));
+        default:
+            return hook(object);
+    }
+}
+// clang-format on
+'''
+
     # Generates source code for InitObjectDispatchVector
     @staticmethod
     def genInitObjectDispatchVectorSource(targetApiName: str) -> str:
@@ -130,6 +168,22 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&gpuav::Validator::name), \\
                                 typeid(&SyncValidator::name));
 
+#define OVERLOADED_HOOK_TYPEID(name, type) \\
+    (typeid(decltype(name ## Class<name ## Sig, type>(0))) != typeid(ValidationObject*) \\
+         ? typeid(type*) \\
+         : typeid(decltype(name ## Class<name ## StateSig, type>(0))))
+
+#define BUILD_OVERLOADED_DISPATCH_VECTOR(name) \\
+    init_object_dispatch_vector(InterceptId ## name, \\
+                                typeid(ValidationObject*), \\
+                                OVERLOADED_HOOK_TYPEID(name, ThreadSafety), \\
+                                OVERLOADED_HOOK_TYPEID(name, StatelessValidation), \\
+                                OVERLOADED_HOOK_TYPEID(name, ObjectLifetimes), \\
+                                OVERLOADED_HOOK_TYPEID(name, CoreChecks), \\
+                                OVERLOADED_HOOK_TYPEID(name, BestPractices), \\
+                                OVERLOADED_HOOK_TYPEID(name, gpuav::Validator), \\
+                                OVERLOADED_HOOK_TYPEID(name, SyncValidator));
+
     auto init_object_dispatch_vector = [this](InterceptId id,
                                               const std::type_info& vo_typeid,
                                               const std::type_info& tt_typeid,
@@ -304,6 +358,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "utils/cast_utils.h"
             #include "layer_options.h"
             #include "containers/custom_containers.h"
+            #include "containers/handle_table.h"
             #include "error_message/logging.h"
             #include "error_message/error_location.h"
             #include "error_message/record_object.h"
@@ -315,21 +370,6 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "gpu/core/gpuav_settings.h"
             #include "sync/sync_settings.h"
 
-            extern std::atomic<uint64_t> global_unique_id;
-
-            // To avoid re-hashing unique ids on each use, we precompute the hash and store the
-            // hash's LSBs in the high 24 bits.
-            struct HashedUint64 {
-                static const int HASHED_UINT64_SHIFT = 40;
-                size_t operator()(const uint64_t& t) const { return t >> HASHED_UINT64_SHIFT; }
-
-                static uint64_t hash(uint64_t id) {
-                    uint64_t h = (uint64_t)vvl::hash<uint64_t>()(id);
-                    id |= h << HASHED_UINT64_SHIFT;
-                    return id;
-                }
-            };
-
             namespace chassis {
                 struct CreateGraphicsPipelines;
                 struct CreateComputePipelines;
@@ -350,7 +390,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             // Each chassis layer will need to track its own state
             using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-            extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            extern vvl::HandleTable unique_id_mapping;
 
             std::vector<std::pair<uint32_t, uint32_t>>& GetCustomStypeInfo();
 
@@ -506,6 +546,10 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ValidationObjectType* GetValidationObject() const;
 
                 // Debug Logging Helpers
+                // Cheap check to do once a check failed, before building the arguments of the message. Returns false if LogError() would
+                // drop the message anyway (filtered VUID, inactive severity or duplicate_message_limit reached).
+                bool IsErrorReportable(std::string_view vuid_text) const { return debug_report->IsMessageReportable(kErrorBit, vuid_text); }
+
                 bool DECORATE_PRINTF(5, 6)
                     LogError(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
                     va_list argptr;
@@ -595,10 +639,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 template <typename HandleType>
                 HandleType WrapNew(HandleType new_created_handle) {
                     if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-                    auto unique_id = global_unique_id++;
-                    unique_id = HashedUint64::hash(unique_id);
-                    assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-                    unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
+                    // The table never hands out 0, otherwise unwrap would apply the special rule for VK_NULL_HANDLE
+                    const uint64_t unique_id = unique_id_mapping.insert(CastToUint64(new_created_handle));
                     return (HandleType)unique_id;
                 }
 
@@ -744,6 +786,10 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "layer_chassis_dispatch.h"
             #include "state_tracker/descriptor_sets.h"
             #include "chassis/chassis_modification_state.h"
+            #include "chassis/frame_profiling.h"
+            #include "chassis/intercept_timing.h"
+            #include "utils/memory_accounting.h"
+            #include "chassis/validation_sampling.h"
 
             #include "profiling/profiling.h"
 
@@ -751,11 +797,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 
-            // Global unique object identifier.
-            std::atomic<uint64_t> global_unique_id(1ULL);
-            // Map uniqueID to actual object handle. Accesses to the map itself are
-            // internally synchronized.
-            vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            // Map uniqueID to actual object handle. The unique ID is handed out by the table itself.
+            // Lookups are lock-free, insertion and removal are internally synchronized.
+            vvl::HandleTable unique_id_mapping;
 
             // State we track in order to populate HandleData for things such as ignored pointers
             static vvl::unordered_map<VkCommandBuffer, VkCommandPool> secondary_cb_map{};
@@ -1152,6 +1196,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkCreateInstance, VulkanTypedHandle());
                 for (const ValidationObject* intercept : local_object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreateInstance);
                     skip |= intercept->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance, error_obj);
                     if (skip) {
                         cleanup_allocations();
@@ -1162,6 +1207,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateInstance);
                 for (ValidationObject* intercept : local_object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreateInstance);
                     intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
                 }
 
@@ -1205,6 +1251,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : framework->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreateInstance);
                     intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
                 }
 
@@ -1222,18 +1269,21 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkDestroyInstance);
                     intercept->PreCallValidateDestroyInstance(instance, pAllocator, error_obj);
                 }
 
                 RecordObject record_obj(vvl::Func::vkDestroyInstance);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkDestroyInstance);
                     intercept->PreCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
                 // Before instance is destroyed, allow aborted objects to clean up
                 for (ValidationObject* intercept : layer_data->aborted_object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkDestroyInstance);
                     intercept->PreCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
@@ -1245,6 +1295,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 VVL_TracyCZone(tracy_zone_postcall, true);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkDestroyInstance);
                     intercept->PostCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
@@ -1302,6 +1353,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkCreateDevice, VulkanTypedHandle(gpu, kVulkanObjectTypePhysicalDevice));
                 for (const ValidationObject* intercept : instance_interceptor->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreateDevice);
                     skip |= intercept->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1309,6 +1361,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateDevice);
                 for (ValidationObject* intercept : instance_interceptor->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreateDevice);
                     intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, record_obj, &modified_create_info);
                 }
 
@@ -1357,6 +1410,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : instance_interceptor->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreateDevice);
                     // Send down modified create info as we want to mark enabled features that we sent down on behalf of the app
                     intercept->PostCallRecordCreateDevice(gpu, reinterpret_cast<VkDeviceCreateInfo*>(&modified_create_info), pAllocator, pDevice, record_obj);
                 }
@@ -1378,18 +1432,21 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkDestroyDevice, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkDestroyDevice);
                     intercept->PreCallValidateDestroyDevice(device, pAllocator, error_obj);
                 }
 
                 RecordObject record_obj(vvl::Func::vkDestroyDevice);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkDestroyDevice);
                     intercept->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
                 // Before device is destroyed, allow aborted objects to clean up
                 for (ValidationObject* intercept : layer_data->aborted_object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkDestroyDevice);
                     intercept->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
@@ -1397,11 +1454,39 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkDestroyDevice);
                     intercept->PostCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
+                if (layer_data->global_settings.lock_profiling) {
+                    layer_data->LogInfo("WARNING-DestroyDevice-lock-profiling", device, error_obj.location, "%s",
+                                        vvl::lock_profiling::Report().c_str());
+                    layer_data->LogInfo("WARNING-DestroyDevice-lock-profiling-json", device, error_obj.location, "%s",
+                                        vvl::lock_profiling::ReportJson().c_str());
+                    // The next device reports only its own lock usage
+                    vvl::lock_profiling::Reset();
+                }
+
+                if (layer_data->global_settings.intercept_timing) {
+                    layer_data->LogInfo("WARNING-DestroyDevice-intercept-timing", device, error_obj.location, "%s",
+                                        vvl::intercept_timing::Report().c_str());
+                    layer_data->LogInfo("WARNING-DestroyDevice-intercept-timing-json", device, error_obj.location, "%s",
+                                        vvl::intercept_timing::ReportJson().c_str());
+                    vvl::intercept_timing::Reset();
+                }
+
+                if (layer_data->global_settings.memory_accounting) {
+                    layer_data->LogInfo("WARNING-DestroyDevice-memory-accounting", device, error_obj.location, "%s",
+                                        vvl::memory_accounting::Report().c_str());
+                    layer_data->LogInfo("WARNING-DestroyDevice-memory-accounting-json", device, error_obj.location, "%s",
+                                        vvl::memory_accounting::ReportJson().c_str());
+                    vvl::memory_accounting::ResetPeaks();
+                }
+
                 auto instance_interceptor = GetLayerDataPtr(GetDispatchKey(layer_data->physical_device), layer_data_map);
                 instance_interceptor->debug_report->device_created--;
+                // With asynchronous message delivery, the messages about this device come out before vkDestroyDevice returns
+                instance_interceptor->debug_report->FlushMessages();
 
                 for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
                     delete *item;
@@ -1429,8 +1514,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PreCallValidate");
-                    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateGraphicsPipelines]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreateGraphicsPipelines);
                         skip |= intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                                 pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
                         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1440,8 +1526,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateGraphicsPipelines);
                 {
                     VVL_ZoneScopedN("PreCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateGraphicsPipelines]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreateGraphicsPipelines);
                         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                     }
@@ -1456,8 +1543,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PostCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateGraphicsPipelines]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreateGraphicsPipelines);
                         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                     }
@@ -1480,8 +1568,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PreCallValidate");
-                    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateComputePipelines]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreateComputePipelines);
                         skip |= intercept->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                                 pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
                         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1491,8 +1580,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateComputePipelines);
                 {
                     VVL_ZoneScopedN("PreCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateComputePipelines]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreateComputePipelines);
                         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                     pipeline_states[intercept->container_type], chassis_state);
                     }
@@ -1507,8 +1597,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PostCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateComputePipelines]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreateComputePipelines);
                         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                     }
@@ -1526,8 +1617,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 PipelineStates pipeline_states[LayerObjectTypeMaxEnum];
                 chassis::CreateRayTracingPipelinesNV chassis_state(pCreateInfos);
 
-                for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRayTracingPipelinesNV]) {
                     auto lock = intercept->ReadLock();
+                    VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreateRayTracingPipelinesNV);
                     skip |=
                         intercept->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
@@ -1535,8 +1627,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesNV);
-                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRayTracingPipelinesNV]) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreateRayTracingPipelinesNV);
                     intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1545,8 +1638,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     DispatchCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, chassis_state.pCreateInfos, pAllocator, pPipelines);
                 record_obj.result = result;
 
-                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRayTracingPipelinesNV]) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreateRayTracingPipelinesNV);
                     intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1568,8 +1662,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PreCallValidate");
-                    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRayTracingPipelinesKHR]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreateRayTracingPipelinesKHR);
                         skip |= intercept->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                                     pCreateInfos, pAllocator, pPipelines, error_obj,
                                                                                     pipeline_states[intercept->container_type], *chassis_state);
@@ -1580,8 +1675,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesKHR);
                 {
                     VVL_ZoneScopedN("PreCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRayTracingPipelinesKHR]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreateRayTracingPipelinesKHR);
                         intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                             pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                             pipeline_states[intercept->container_type], *chassis_state);
@@ -1599,8 +1695,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PostCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRayTracingPipelinesKHR]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreateRayTracingPipelinesKHR);
                         intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                             pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                             pipeline_states[intercept->container_type], chassis_state);
@@ -1622,6 +1719,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PreCallValidate");
                     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineLayout]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreatePipelineLayout);
                         skip |= intercept->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, error_obj);
                         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                     }
@@ -1633,8 +1731,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreatePipelineLayout);
                 {
                     VVL_ZoneScopedN("PreCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePipelineLayout]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreatePipelineLayout);
                         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj, chassis_state);
                     }
                 }
@@ -1650,6 +1749,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PostCallRecord");
                     for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineLayout]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreatePipelineLayout);
                         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj);
                     }
                 }
@@ -1667,8 +1767,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PreCallValidate");
-                    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateShaderModule]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreateShaderModule);
                         skip |= intercept->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, error_obj);
                         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                     }
@@ -1679,8 +1780,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateShaderModule);
                 {
                     VVL_ZoneScopedN("PreCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateShaderModule]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreateShaderModule);
                         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
                     }
                 }
@@ -1695,8 +1797,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
                 {
                     VVL_ZoneScopedN("PostCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateShaderModule]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreateShaderModule);
                         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
                     }
                 }
@@ -1716,8 +1819,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PreCallValidate");
-                    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateShadersEXT]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreateShadersEXT);
                         skip |= intercept->PreCallValidateCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, error_obj);
                         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                     }
@@ -1726,8 +1830,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateShadersEXT);
                 {
                     VVL_ZoneScopedN("PreCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateShadersEXT]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreateShadersEXT);
                         intercept->PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj, chassis_state);
                     }
                 }
@@ -1744,8 +1849,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PostCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateShadersEXT]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreateShadersEXT);
                         intercept->PostCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                                                 chassis_state);
                     }
@@ -1762,12 +1868,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkAllocateDescriptorSets, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
 
                 vvl::AllocateDescriptorSetsData ads_state[LayerObjectTypeMaxEnum];
+                // Objects that only record still get their state sized, the validate pass may not visit them
+                for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
+                }
 
                 {
                     VVL_ZoneScopedN("PreCallValidate");
-                    for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                        ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
+                    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateDescriptorSets]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkAllocateDescriptorSets);
                         skip |= intercept->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, error_obj,
                                                                                 ads_state[intercept->container_type]);
                         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1779,6 +1889,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PreCallRecord");
                     for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateDescriptorSets]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkAllocateDescriptorSets);
                         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj);
                     }
                 }
@@ -1792,8 +1903,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 {
                     VVL_ZoneScopedN("PostCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateDescriptorSets]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkAllocateDescriptorSets);
                         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj,
                                                                         ads_state[intercept->container_type]);
                     }
@@ -1814,6 +1926,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PreCallValidate");
                     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBuffer]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkCreateBuffer);
                         skip |= intercept->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, error_obj);
                         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                     }
@@ -1825,8 +1938,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateBuffer);
                 {
                     VVL_ZoneScopedN("PreCallRecord");
-                    for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateBuffer]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkCreateBuffer);
                         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj, chassis_state);
                     }
                 }
@@ -1842,6 +1956,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PostCallRecord");
                     for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBuffer]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkCreateBuffer);
                         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj);
                     }
                 }
@@ -1859,6 +1974,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PreCallValidate");
                     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueuePresentKHR]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkQueuePresentKHR);
                         skip |= intercept->PreCallValidateQueuePresentKHR(queue, pPresentInfo, error_obj);
                         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                     }
@@ -1868,6 +1984,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PreCallRecord");
                     for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueuePresentKHR]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkQueuePresentKHR);
                         intercept->PreCallRecordQueuePresentKHR(queue, pPresentInfo, record_obj);
                     }
                 }
@@ -1888,11 +2005,21 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     result = DispatchQueuePresentKHR(queue, pPresentInfo);
                 }
                 VVL_TracyCFrameMark;
+                if (layer_data->global_settings.intercept_timing &&
+                    vvl::intercept_timing::EndFrame(layer_data->global_settings.intercept_timing_report_frames)) {
+                    // Each report covers the frames since the previous one
+                    layer_data->LogInfo("WARNING-QueuePresentKHR-intercept-timing", queue, error_obj.location, "%s",
+                                        vvl::intercept_timing::Report().c_str());
+                    layer_data->LogInfo("WARNING-QueuePresentKHR-intercept-timing-json", queue, error_obj.location, "%s",
+                                        vvl::intercept_timing::ReportJson().c_str());
+                    vvl::intercept_timing::Reset();
+                }
                 record_obj.result = result;
                 {
                     VVL_ZoneScopedN("PostCallRecord");
                     for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueuePresentKHR]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkQueuePresentKHR);
 
                         if (result == VK_ERROR_DEVICE_LOST) {
                             intercept->is_device_lost = true;
@@ -1900,6 +2027,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                         intercept->PostCallRecordQueuePresentKHR(queue, pPresentInfo, record_obj);
                     }
                 }
+                if (vvl::frame_profiling::IsEnabled()) {
+                    vvl::frame_profiling::EndFrame(vvl::frame_profiling::Boundary::Present, 0, *layer_data->debug_report);
+                }
                 return result;
             }
 
@@ -1920,6 +2050,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PreCallValidate");
                     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
                         auto lock = intercept->ReadLock();
+                        VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkBeginCommandBuffer);
                         skip |= intercept->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo, error_obj);
                         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                     }
@@ -1930,6 +2061,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PreCallRecord");
                     for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkBeginCommandBuffer);
                         intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
                     }
                 }
@@ -1945,6 +2077,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     VVL_ZoneScopedN("PostCallRecord");
                     for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
                         auto lock = intercept->WriteLock();
+                        VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkBeginCommandBuffer);
                         intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
                     }
                 }
@@ -1979,6 +2112,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT);
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1987,6 +2121,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT);
                     intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -2001,6 +2136,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT);
                     intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -2023,6 +2159,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::vkGetPhysicalDeviceToolProperties);
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -2031,6 +2168,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolProperties);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::vkGetPhysicalDeviceToolProperties);
                     intercept->PreCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -2045,6 +2183,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::vkGetPhysicalDeviceToolProperties);
                     intercept->PostCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -2117,22 +2256,50 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 'uint64_t': 'return 0;'
             }
 
+            # The hottest recording commands call the hooks on the concrete validation object types (see VisitValidationObject)
+            fused_hook_commands = [
+                'vkCmdBindPipeline',
+                'vkCmdSetViewport',
+                'vkCmdSetScissor',
+                'vkCmdBindDescriptorSets',
+                'vkCmdBindIndexBuffer',
+                'vkCmdBindVertexBuffers',
+                'vkCmdDraw',
+                'vkCmdDrawIndexed',
+                'vkCmdDrawIndirect',
+                'vkCmdDrawIndexedIndirect',
+                'vkCmdDispatch',
+                'vkCmdPushConstants',
+            ]
+            def hookCall(hook: str, record_param: str) -> str:
+                call = f'{hook}{command.name[2:]}({paramsList}, {record_param})'
+                if command.name in fused_hook_commands:
+                    return f'VisitValidationObject(intercept, [&](auto* vo) {{ return vo->{call}; }})'
+                return f'intercept->{call}'
+
             # Set up skip and locking
             out.append('bool skip = false;\n')
 
             out.append(f'ErrorObject error_obj(vvl::Func::{command.name}, VulkanTypedHandle({command.params[0].name}, kVulkanObjectType{command.params[0].type[2:]}));\n')
 
             # Generate pre-call validation source code
-            out.append('''{
-                VVL_ZoneScopedN("PreCallValidate");
-            ''')
+            # With validation sampling only some of the command buffer recording calls are validated
+            if command.name.startswith('vkCmd'):
+                out.append(f'''if (vvl::validation_sampling::ShouldValidate(vvl::Func::{command.name})) {{
+                    VVL_ZoneScopedN("PreCallValidate");
+                ''')
+            else:
+                out.append('''{
+                    VVL_ZoneScopedN("PreCallValidate");
+                ''')
             if not command.instance:
                 out.append(f'    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}]) {{\n')
             else:
                 out.append('    for (const ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
                     auto lock = intercept->ReadLock();
-                        skip |= intercept->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
+                    VVL_InterceptTimer(intercept, PreCallValidate, vvl::Func::{command.name});
+                        skip |= {hookCall('PreCallValidate', 'error_obj')};
                         if (skip) {return_map[command.returnType]}
                     }}\n''')
             out.append('}\n')
@@ -2148,7 +2315,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 out.append('    for (ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
                     auto lock = intercept->WriteLock();
-                    intercept->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
+                    VVL_InterceptTimer(intercept, PreCallRecord, vvl::Func::{command.name});
+                    {hookCall('PreCallRecord', 'record_obj')};
             }}\n''')
             out.append('}\n')
 
@@ -2218,6 +2386,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             if command.name not in commands_with_blocking_operations:
                 out.append('auto lock = intercept->WriteLock();\n')
+                out.append(f'VVL_InterceptTimer(intercept, PostCallRecord, vvl::Func::{command.name});\n')
             else:
                 out.append('ValidationObject::BlockingOperationGuard lock(intercept);\n')
 
@@ -2229,7 +2398,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     }
                 ''')
 
-            out.append(f'intercept->PostCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
+            out.append(f'{hookCall("PostCallRecord", "record_obj")};\n')
             out.append('    }\n')
             out.append('}\n')
 
@@ -2266,6 +2435,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     }
                 ''')
 
+            # Submissions can end a frame with VkFrameBoundaryEXT, after PostCallRecord so the frame includes their validation
+            frame_boundary_functions = {
+                'vkQueueSubmit' : 'submitCount, pSubmits',
+                'vkQueueSubmit2' : 'submitCount, pSubmits',
+                'vkQueueSubmit2KHR' : 'submitCount, pSubmits',
+                'vkQueueBindSparse' : 'bindInfoCount, pBindInfo',
+            }
+            if command.name in frame_boundary_functions:
+                out.append(f'vvl::frame_profiling::OnSubmit({frame_boundary_functions[command.name]}, *layer_data->debug_report);\n')
+
             # Return result variable, if any.
             if command.returnType != 'void':
                 out.append('    return result;\n')
@@ -2367,27 +2546,33 @@ const vvl::unordered_map<std::string, function_data> &GetNameToFuncPtrMap() {
             'vkDestroyValidationCacheEXT',
             'vkMergeValidationCachesEXT',
             'vkGetValidationCacheDataEXT',
-            # have all 3 calls have dual signatures being used
-            'vkCreateShaderModule',
-            'vkCreateShadersEXT',
-            'vkCreateGraphicsPipelines',
-            'vkCreateComputePipelines',
-            'vkCreateRayTracingPipelinesNV',
-            'vkCreateRayTracingPipelinesKHR',
         ]
 
-        # We need to skip any signatures that pass around chassis_modification_state structs
-        # and therefore can't easily create the intercept id
-        skip_intercept_id_pre_validate = [
-            'vkAllocateDescriptorSets'
-        ]
-        skip_intercept_id_pre_record = [
-            'vkCreatePipelineLayout',
-            'vkCreateBuffer',
-        ]
-        skip_intercept_id_post_record = [
-            'vkAllocateDescriptorSets'
-        ]
+        # These hooks have a second overload that passes around chassis_modification_state structs,
+        # the value is the extra parameters of that overload
+        pipeline_state_param = 'PipelineStates& pipeline_states'
+        overloaded_hooks = {
+            'PreCallValidateCreateGraphicsPipelines' : f'{pipeline_state_param}, chassis::CreateGraphicsPipelines& chassis_state',
+            'PreCallRecordCreateGraphicsPipelines' : f'{pipeline_state_param}, chassis::CreateGraphicsPipelines& chassis_state',
+            'PostCallRecordCreateGraphicsPipelines' : f'{pipeline_state_param}, chassis::CreateGraphicsPipelines& chassis_state',
+            'PreCallValidateCreateComputePipelines' : f'{pipeline_state_param}, chassis::CreateComputePipelines& chassis_state',
+            'PreCallRecordCreateComputePipelines' : f'{pipeline_state_param}, chassis::CreateComputePipelines& chassis_state',
+            'PostCallRecordCreateComputePipelines' : f'{pipeline_state_param}, chassis::CreateComputePipelines& chassis_state',
+            'PreCallValidateCreateRayTracingPipelinesNV' : f'{pipeline_state_param}, chassis::CreateRayTracingPipelinesNV& chassis_state',
+            'PreCallRecordCreateRayTracingPipelinesNV' : f'{pipeline_state_param}, chassis::CreateRayTracingPipelinesNV& chassis_state',
+            'PostCallRecordCreateRayTracingPipelinesNV' : f'{pipeline_state_param}, chassis::CreateRayTracingPipelinesNV& chassis_state',
+            'PreCallValidateCreateRayTracingPipelinesKHR' : f'{pipeline_state_param}, chassis::CreateRayTracingPipelinesKHR& chassis_state',
+            'PreCallRecordCreateRayTracingPipelinesKHR' : f'{pipeline_state_param}, chassis::CreateRayTracingPipelinesKHR& chassis_state',
+            'PostCallRecordCreateRayTracingPipelinesKHR' : f'{pipeline_state_param}, std::shared_ptr<chassis::CreateRayTracingPipelinesKHR> chassis_state',
+            'PreCallRecordCreatePipelineLayout' : 'chassis::CreatePipelineLayout& chassis_state',
+            'PreCallRecordCreateShaderModule' : 'chassis::CreateShaderModule& chassis_state',
+            'PostCallRecordCreateShaderModule' : 'chassis::CreateShaderModule& chassis_state',
+            'PreCallRecordCreateShadersEXT' : 'chassis::ShaderObject& chassis_state',
+            'PostCallRecordCreateShadersEXT' : 'chassis::ShaderObject& chassis_state',
+            'PreCallValidateAllocateDescriptorSets' : 'vvl::AllocateDescriptorSetsData& ads_state',
+            'PostCallRecordAllocateDescriptorSets' : 'vvl::AllocateDescriptorSetsData& ads_state',
+            'PreCallRecordCreateBuffer' : 'chassis::CreateBuffer& chassis_state',
+        }
 
         out = []
         out.append('''
@@ -2401,28 +2586,62 @@ const vvl::unordered_map<std::string, function_data> &GetNameToFuncPtrMap() {
 
             ''')
 
+        commands = [x for x in self.vk.commands.values() if not x.instance and x.name not in skip_intercept_id_functions]
+        hook_prefixes = ['PreCallValidate', 'PreCallRecord', 'PostCallRecord']
+
         out.append('typedef enum InterceptId{\n')
-        for command in [x for x in self.vk.commands.values() if not x.instance and x.name not in skip_intercept_id_functions]:
-            if command.name not in skip_intercept_id_pre_validate:
-                out.append(f'    InterceptIdPreCallValidate{command.name[2:]},\n')
-            if command.name not in skip_intercept_id_pre_record:
-                out.append(f'    InterceptIdPreCallRecord{command.name[2:]},\n')
-            if command.name not in skip_intercept_id_post_record:
-                out.append(f'    InterceptIdPostCallRecord{command.name[2:]},\n')
+        for command in commands:
+            for prefix in hook_prefixes:
+                out.append(f'    InterceptId{prefix}{command.name[2:]},\n')
         out.append('    InterceptIdCount,\n')
         out.append('} InterceptId;\n')
 
+        out.append('''
+// clang-format off
+// Overloaded hooks can't be passed to typeid() since the name alone is ambiguous.
+// HookClass() deduces the class that declares the overload matching Sig. If a class declares only one of the two
+// overloads, the other is hidden and the fallback reports the class itself, which is correct as it overrides the hook.
+template <typename Sig, typename C>
+C* HookClass(Sig C::*);
+
+#define DECLARE_OVERLOADED_HOOK_CLASS(name) \\
+    template <typename Sig, typename T> \\
+    auto name ## Class(int) -> decltype(HookClass<Sig>(&T::name)); \\
+    template <typename Sig, typename T> \\
+    T* name ## Class(...);
+
+''')
+        for command in [x for x in commands if any(f'{p}{x.name[2:]}' in overloaded_hooks for p in hook_prefixes)]:
+            parameters = (command.cPrototype.split('(')[1])[:-2] # leaves just the parameters
+            parameters = parameters.replace('\n', '')
+            parameters = ' '.join(parameters.split()) # remove duplicate whitespace
+            for prefix in hook_prefixes:
+                hook = f'{prefix}{command.name[2:]}'
+                if hook not in overloaded_hooks:
+                    continue
+                if prefix == 'PreCallValidate':
+                    base_params = f'{parameters}, const ErrorObject& error_obj'
+                    (return_type, qualifier) = ('bool', ' const')
+                else:
+                    base_params = f'{parameters}, const RecordObject& record_obj'
+                    (return_type, qualifier) = ('void', '')
+                out.append(f'using {hook}Sig = {return_type}({base_params}){qualifier};\n')
+                out.append(f'using {hook}StateSig = {return_type}({base_params}, {overloaded_hooks[hook]}){qualifier};\n')
+                out.append(f'DECLARE_OVERLOADED_HOOK_CLASS({hook})\n')
+        out.append('// clang-format on\n')
+
+        out.append(APISpecific.genVisitValidationObjectSource(self.targetApiName))
         out.append(APISpecific.genInitObjectDispatchVectorSource(self.targetApiName))
 
         guard_helper = PlatformGuardHelper()
-        for command in [x for x in self.vk.commands.values() if not x.instance and x.name not in skip_intercept_id_functions]:
+        for command in commands:
             out.extend(guard_helper.add_guard(command.protect))
-            if command.name not in skip_intercept_id_pre_validate:
-                out.append(f'    BUILD_DISPATCH_VECTOR(PreCallValidate{command.name[2:]});\n')
-            if command.name not in skip_intercept_id_pre_record:
-                out.append(f'    BUILD_DISPATCH_VECTOR(PreCallRecord{command.name[2:]});\n')
-            if command.name not in skip_intercept_id_post_record:
-                out.append(f'    BUILD_DISPATCH_VECTOR(PostCallRecord{command.name[2:]});\n')
+            for prefix in hook_prefixes:
+                hook = f'{prefix}{command.name[2:]}'
+                if hook in overloaded_hooks:
+                    out.append(f'    BUILD_OVERLOADED_DISPATCH_VECTOR({hook});\n')
+                else:
+                    out.append(f'    BUILD_DISPATCH_VECTOR({hook});\n')
         out.extend(guard_helper.add_guard(None))
         out.append('}\n')
         self.write("".join(out))
@@ -852,6 +852,8 @@ bool ObjectLifetimes::ReportUndestroyedDeviceObjects(VkDevice device, const Loca
             handle_types = [x.type for x in members if self.hasParameterParentVUID(x, parentName)]
 
         single_parent_vuid = (len(handle_types) == 1)
+        # Handle parameters of the command itself, see validateHandleParams()
+        handle_params = []
 
         # Parent type in parent/commonparent VUIDs: Device, PhysicalDevice or Instance
         parent_type = 'Device'
@@ -945,6 +947,11 @@ bool ObjectLifetimes::ReportUndestroyedDeviceObjects(VkDevice device, const Loca
                         pre_call_validate += 'auto instance_data = GetLayerDataPtr(GetDispatchKey(instance), layer_data_map);\n'
                         pre_call_validate += 'auto instance_object_lifetimes = instance_data->GetValidationObject<ObjectLifetimes>();\n'
                         pre_call_validate += f'skip |= instance_object_lifetimes->ValidateObject({prefix}{member.name}, kVulkanObjectType{member.type[2:]}, {nullAllowed}, {param_vuid}, {parent_vuid}, {location}{parent_object_type});\n'
+                    elif not is_struct:
+                        # Emitted where the first one is, once all of them are known
+                        if not handle_params:
+                            pre_call_validate += '@HANDLE_PARAMS@'
+                        handle_params.append((member, nullAllowed, param_vuid, parent_vuid, parent_object_type))
                     else:
                         pre_call_validate += f'skip |= ValidateObject({prefix}{member.name}, kVulkanObjectType{member.type[2:]}, {nullAllowed}, {param_vuid}, {parent_vuid}, {location}{parent_object_type});\n'
 
@@ -1009,7 +1016,30 @@ bool ObjectLifetimes::ReportUndestroyedDeviceObjects(VkDevice device, const Loca
                 if contains_object or contains_pNext:
                     pre_call_validate += "".join(nested_struct)
 
+        if handle_params:
+            pre_call_validate = pre_call_validate.replace('@HANDLE_PARAMS@', self.validateHandleParams(handle_params, errorLoc))
         return pre_call_validate
+
+    # A single handle parameter is checked with its own call, like the hot vkCmd* commands binding one object. Several are
+    # described by a constexpr table walked by ValidateObjects(), instead of repeating the call and its arguments for each.
+    def validateHandleParams(self, handle_params: list, errorLoc: str) -> str:
+        if len(handle_params) == 1:
+            member, nullAllowed, param_vuid, parent_vuid, parent_object_type = handle_params[0]
+            return f'skip |= ValidateObject({member.name}, kVulkanObjectType{member.type[2:]}, {nullAllowed}, {param_vuid}, {parent_vuid}, {errorLoc}.dot(Field::{member.name}){parent_object_type});\n'
+
+        out = []
+        out.append('static constexpr HandleParam kHandleParams[] = {\n')
+        entries = []
+        for member, nullAllowed, param_vuid, parent_vuid, _ in handle_params:
+            # kVUIDUndefined is not a constant expression
+            param_vuid = 'nullptr' if param_vuid == 'kVUIDUndefined' else param_vuid
+            parent_vuid = 'nullptr' if parent_vuid == 'kVUIDUndefined' else parent_vuid
+            entries.append(f'{{kVulkanObjectType{member.type[2:]}, {nullAllowed}, Field::{member.name}, {param_vuid}, {parent_vuid}}}')
+        out.append(',\n'.join(entries))
+        out.append('};\n')
+        handles = ', '.join([f'HandleToUint64({x[0].name})' for x in handle_params])
+        out.append(f'skip |= ValidateObjects(kHandleParams, {{{handles}}}, {errorLoc}{handle_params[0][4]});\n')
+        return ''.join(out)
     #
     # For a particular API, generate the object handling code
     def generateFunctionBody(self, command: Command):
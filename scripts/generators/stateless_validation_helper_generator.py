@@ -203,6 +203,13 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
             'vkGetPipelinePropertiesEXT',
             ]
 
+        # Create infos of these functions that passed before skip the checks, see StatelessCreateInfoCache
+        self.functions_with_create_info_cache = [
+            'vkCreateSampler',
+            'vkCreateImageView',
+            'vkCreateBufferView',
+            ]
+
         # Commands to ignore
         self.blacklist = [
             'vkGetInstanceProcAddr',
@@ -478,6 +485,11 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
             # Create a copy here to make the logic simpler passing into ValidatePnextStructContents
             out.append('    [[maybe_unused]] const Location loc = error_obj.location;\n')
 
+            if command.name in self.functions_with_create_info_cache:
+                cache_params = ', '.join([x.name for x in command.params[1:]])
+                out.append(f'    auto cached_create_info = create_info_cache.Find({cache_params});\n')
+                out.append('    if (cached_create_info.validated) return skip;\n')
+
             # Cannot validate extension dependencies for device extension APIs having a physical device as their dispatchable object
             if command.extensions and (not any(x.device for x in command.extensions) or command.params[0].type != 'VkPhysicalDevice'):
                 cExpression =  []
@@ -531,6 +543,8 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                     # Generate parameter list for manual fcn and down-chain calls
                     params_text = ', '.join([x.name for x in command.params]) + ', error_obj'
                     out.append(f'    if (!skip) skip |= manual_PreCallValidate{manualCheckCmd[2:]}({params_text});\n')
+                if command.name in self.functions_with_create_info_cache:
+                    out.append('    create_info_cache.Insert(cached_create_info, skip);\n')
             out.append('return skip;\n')
             out.append('}\n')
         out.extend(guard_helper.add_guard(None, extra_newline=True))
@@ -1011,12 +1025,8 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                 if (is_physdev_api) {{
                     VkPhysicalDeviceProperties device_properties = {{}};
                     DispatchGetPhysicalDeviceProperties(physicalDevice, &device_properties);
-                    if (device_properties.apiVersion < {struct.version.nameApi}) {{
-                        APIVersion device_api_version(static_cast<uint32_t>(device_properties.apiVersion));
-                        skip |= LogError(
-                                pnext_vuid, instance, loc.dot(Field::pNext),
-                                "includes a pointer to a VkStructureType ({struct.sType}) which was added in {struct.version.nameApi} but the "
-                                "current effective API version is %s.", StringAPIVersion(device_api_version).c_str());
+                    if (device_properties.apiVersion < {struct.version.nameApi} && IsErrorReportable(pnext_vuid)) {{
+                        skip |= LogPnextApiVersionTooLow(pnext_vuid, loc, "{struct.sType}", "{struct.version.nameApi}", device_properties.apiVersion);
                     }}
                 }}
                 '''
@@ -1050,10 +1060,7 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
             extension_check = f'if ({" && ".join(extension_conditinals)}) {{'
             pnext_check += f'''
                     {extension_check}
-                        skip |= LogError(
-                            pnext_vuid, instance, loc.dot(Field::pNext),
-                            "includes a pointer to a VkStructureType ({struct.sType}), but its parent extension "
-                            "{self.englishJoin(ext_names, "or")} has not been enabled.");
+                        skip |= LogPnextExtensionNotEnabled(pnext_vuid, loc, "{struct.sType}", "{self.englishJoin(ext_names, "or")}");
                     }}
                 '''
 
@@ -1089,14 +1096,12 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                 # Special message for device features
                 if 'VkPhysicalDeviceFeatures2' in struct.extends and 'VkDeviceCreateInfo' in struct.extends:
                     pnext_check += f'''if ({" && ".join(checkExpression)}){{
-                        skip |= LogError(pnext_vuid, instance, pNext_loc,
-                            "includes a pointer to a {struct.name}, but when creating VkDevice, the parent extension "
-                            "({" or ".join(resultExpression)}) was not included in ppEnabledExtensionNames.");
+                        skip |= LogPnextFeatureExtensionNotEnabled(pnext_vuid, pNext_loc, "{struct.name}", "{" or ".join(resultExpression)}");
                         }}
                     '''
                 else:
                     pnext_check += f'''if ({" && ".join(checkExpression)}){{
-                            skip |= LogError(pnext_vuid, instance, pNext_loc, "extended struct requires the extensions {" or ".join(resultExpression)}");
+                            skip |= LogPnextExtensionsRequired(pnext_vuid, pNext_loc, "{" or ".join(resultExpression)}");
                         }}
                         '''
 
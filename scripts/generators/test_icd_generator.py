@@ -221,13 +221,13 @@ class TestIcdGenerator(BaseGenerator):
                 out.append(f'{returnName}{command.alias[2:]}({params});')
             elif 'vkCreate' in command.name or 'vkAllocate' in command.name:
                 last_param = command.params[-1]
-                out.append('unique_lock_t lock(global_lock);\n')
                 if (last_param.length):
+                    out.append(f'const uint64_t first_handle = NewHandles({last_param.length});\n')
                     out.append(f'for (uint32_t i = 0; i < {last_param.length}; ++i) {{\n')
-                    out.append(f'{last_param.name}[i] = ({last_param.type})global_unique_handle++;\n')
+                    out.append(f'{last_param.name}[i] = ({last_param.type})(first_handle + i);\n')
                     out.append('}\n')
                 else:
-                    out.append(f'*{last_param.name} = ({last_param.type})global_unique_handle++;\n')
+                    out.append(f'*{last_param.name} = ({last_param.type})NewHandles();\n')
                 out.append('return VK_SUCCESS;\n')
             elif not voidReturn:
                 out.append('return VK_SUCCESS;')
@@ -336,7 +336,7 @@ class ThreadSafetyOutputGenerator(BaseGenerator):
         guard_helper = PlatformGuardHelper()
         for handle in [x for x in self.vk.handles.values() if not x.dispatchable]:
             out.extend(guard_helper.add_guard(handle.protect))
-            out.append(f'c_{handle.name}(kVulkanObjectType{handle.name[2:]}, this),\n')
+            out.append(f'c_{handle.name}(kVulkanObjectType{handle.name[2:]}, this, &ObjectUseSlots()),\n')
         out.extend(guard_helper.add_guard(None))
         out.append('// clang-format on\n')
         self.write("".join(out))
@@ -611,9 +611,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submit
 
 static VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                                      const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
+    *pMemory = (VkDeviceMemory)NewHandles();
     unique_lock_t lock(global_lock);
-    allocated_memory_size_map[(VkDeviceMemory)global_unique_handle] = pAllocateInfo->allocationSize;
-    *pMemory = (VkDeviceMemory)global_unique_handle++;
+    allocated_memory_size_map[*pMemory] = pAllocateInfo->allocationSize;
     return VK_SUCCESS;
 }
 
@@ -733,7 +733,17 @@ static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(V
 static VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
                                                    const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
     unique_lock_t lock(global_lock);
-    *pBuffer = (VkBuffer)global_unique_handle++;
+    // Special way to return the handle of a live buffer
+    if (pCreateInfo->size == colliding_buffer_size) {
+        if (colliding_buffer != VK_NULL_HANDLE) {
+            *pBuffer = colliding_buffer;
+            return VK_SUCCESS;
+        }
+        colliding_buffer = (VkBuffer)NewHandles();
+        *pBuffer = colliding_buffer;
+    } else {
+        *pBuffer = (VkBuffer)NewHandles();
+    }
     buffer_map[device][*pBuffer] = {pCreateInfo->size, current_available_address};
     current_available_address += pCreateInfo->size;
     // Always align to next 64-bit pointer
@@ -747,12 +757,15 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBuff
 static VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
     unique_lock_t lock(global_lock);
     buffer_map[device].erase(buffer);
+    if (buffer == colliding_buffer) {
+        colliding_buffer = VK_NULL_HANDLE;
+    }
 }
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
+    *pImage = (VkImage)NewHandles();
     unique_lock_t lock(global_lock);
-    *pImage = (VkImage)global_unique_handle++;
     image_memory_size_map[device][*pImage] = GetImageSizeFromCreateInfo(pCreateInfo);
     return VK_SUCCESS;
 }
@@ -775,8 +788,8 @@ static VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice device, VkRe
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
+    *pCommandPool = (VkCommandPool)NewHandles();
     unique_lock_t lock(global_lock);
-    *pCommandPool = (VkCommandPool)global_unique_handle++;
     command_pool_map[device].insert(*pCommandPool);
     return VK_SUCCESS;
 }
@@ -808,16 +821,20 @@ static VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, co
 static VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                      const VkCommandBuffer* pCommandBuffers) {
     unique_lock_t lock(global_lock);
+    // Command buffers can only be freed to their own pool, don't look through the command buffers of every other pool
+    auto pool_it = command_pool_buffer_map.find(commandPool);
     for (auto i = 0u; i < commandBufferCount; ++i) {
         if (!pCommandBuffers[i]) {
             continue;
         }
 
-        for (auto& pair : command_pool_buffer_map) {
-            auto& cbs = pair.second;
+        if (pool_it != command_pool_buffer_map.end()) {
+            auto& cbs = pool_it->second;
             auto it = std::find(cbs.begin(), cbs.end(), pCommandBuffers[i]);
             if (it != cbs.end()) {
-                cbs.erase(it);
+                // Order doesn't matter, avoid shifting the rest
+                *it = cbs.back();
+                cbs.pop_back();
             }
         }
 
@@ -1006,10 +1023,10 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(Vk
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo,
                                                          const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) {
+    *pSwapchain = (VkSwapchainKHR)NewHandles();
     unique_lock_t lock(global_lock);
-    *pSwapchain = (VkSwapchainKHR)global_unique_handle++;
     for (uint32_t i = 0; i < icd_swapchain_image_count; ++i) {
-        swapchain_image_map[*pSwapchain][i] = (VkImage)global_unique_handle++;
+        swapchain_image_map[*pSwapchain][i] = (VkImage)NewHandles();
     }
     return VK_SUCCESS;
 }
@@ -1056,8 +1073,8 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(VkPh
     if (!pProperties) {
         *pPropertyCount = 1;
     } else {
+        pProperties[0].display = (VkDisplayKHR)NewHandles();
         unique_lock_t lock(global_lock);
-        pProperties[0].display = (VkDisplayKHR)global_unique_handle++;
         display_map[physicalDevice].insert(pProperties[0].display);
     }
     return VK_SUCCESS;
@@ -2143,20 +2160,17 @@ static VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureBuildSizesKHR(
 static VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display,
                                                               const VkDisplayEventInfoEXT* pDisplayEventInfo,
                                                               const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
-    unique_lock_t lock(global_lock);
-    *pFence = (VkFence)global_unique_handle++;
+    *pFence = (VkFence)NewHandles();
     return VK_SUCCESS;
 }
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineBinariesKHR(VkDevice device, const VkPipelineBinaryCreateInfoKHR* pCreateInfo,
                                                                 const VkAllocationCallbacks* pAllocator,
                                                                 VkPipelineBinaryHandlesInfoKHR* pBinaries) {
-    unique_lock_t lock(global_lock);
-
     pBinaries->pipelineBinaryCount = 1;
 
     if (pBinaries->pPipelineBinaries != nullptr) {
-        pBinaries->pPipelineBinaries[0] = (VkPipelineBinaryKHR)global_unique_handle++;
+        pBinaries->pPipelineBinaries[0] = (VkPipelineBinaryKHR)NewHandles();
     }
 
     return VK_SUCCESS;
@@ -20,6 +20,7 @@
 #include <cstring>
 
 #include <array>
+#include <atomic>
 #include <mutex>
 #include <unordered_set>
 #include <unordered_map>
@@ -35,7 +36,11 @@ using lock_guard_t = std::lock_guard<mutex_t>;
 using unique_lock_t = std::unique_lock<mutex_t>;
 
 static mutex_t global_lock;
-static uint64_t global_unique_handle = 1;
+// Handles are only numbers, they don't need global_lock. Objects created from many threads at once then measure the layer and
+// not the driver.
+static std::atomic<uint64_t> global_unique_handle{1};
+// First of count consecutive new handles
+static uint64_t NewHandles(uint64_t count = 1) { return global_unique_handle.fetch_add(count, std::memory_order_relaxed); }
 static const uint32_t SUPPORTED_LOADER_ICD_INTERFACE_VERSION = 5;
 static uint32_t loader_interface_version = 0;
 static bool negotiate_loader_icd_interface_called = false;
@@ -63,6 +68,9 @@ struct BufferState {
     VkDeviceAddress address;
 };
 static std::unordered_map<VkDevice, std::unordered_map<VkBuffer, BufferState>> buffer_map;
+// Buffers of this size all get the same handle while one of them is alive, to test drivers returning a live handle
+static constexpr VkDeviceSize colliding_buffer_size = 0xC011DE;
+static VkBuffer colliding_buffer = VK_NULL_HANDLE;
 static std::unordered_map<VkDevice, std::unordered_map<VkImage, VkDeviceSize>> image_memory_size_map;
 static std::unordered_map<VkDevice, std::unordered_set<VkCommandPool>> command_pool_map;
 static std::unordered_map<VkCommandPool, std::vector<VkCommandBuffer>> command_pool_buffer_map;
@@ -31,6 +31,7 @@ static bool buffer_device_address_pass = false;
 static bool ray_query_pass = false;
 static bool debug_printf_pass = false;
 static bool post_process_descriptor_indexing_pass = false;
+static bool inline_fast_path_checks = false;
 
 void PrintUsage(const char* program) {
     printf(R"(
@@ -57,6 +58,8 @@ USAGE: %s <input> -o <output> <passes>
                Runs DebugPrintfPass
   --post-process-descriptor-indexing
                Runs PostProcessDescriptorIndexingPass
+  --inline-fast-path-checks
+               Passes with a fast path check inline before calling their function
 
   --timer
                Prints time it takes to instrument entire module
@@ -101,6 +104,8 @@ bool ParseFlags(int argc, char** argv, const char** out_file) {
             debug_printf_pass = true;
         } else if (0 == strcmp(cur_arg, "--post-process-descriptor-indexing")) {
             post_process_descriptor_indexing_pass = true;
+        } else if (0 == strcmp(cur_arg, "--inline-fast-path-checks")) {
+            inline_fast_path_checks = true;
         } else if (0 == strncmp(cur_arg, "--", 2)) {
             printf("Unknown pass %s\n", cur_arg);
             PrintUsage(argv[0]);
@@ -159,23 +164,17 @@ int main(int argc, char** argv) {
     module_settings.support_memory_model_device_scope = true;
     // for all passes, test worst case of using bindless
     module_settings.has_bindless_descriptors = all_passes || bindless_descriptor_pass;
+    module_settings.inline_fast_path_checks = inline_fast_path_checks;
 
     gpuav::spirv::Module module(spirv_data, nullptr, module_settings);
-    if (all_passes || bindless_descriptor_pass) {
-        module.RunPassBindlessDescriptor();
-    }
-    if (all_passes || non_bindless_oob_buffer_pass) {
-        module.RunPassNonBindlessOOBBuffer();
-    }
-    if (all_passes || non_bindless_oob_texel_buffer_pass) {
-        module.RunPassNonBindlessOOBTexelBuffer();
-    }
-    if (all_passes || buffer_device_address_pass) {
-        module.RunPassBufferDeviceAddress();
-    }
-    if (all_passes || ray_query_pass) {
-        module.RunPassRayQuery();
-    }
+    // Single walk over the module to match how we do it in GpuShaderInstrumentor::InstrumentShader()
+    gpuav::spirv::FusedPassSelection fused_passes;
+    fused_passes.bindless_descriptor = all_passes || bindless_descriptor_pass;
+    fused_passes.non_bindless_oob_buffer = all_passes || non_bindless_oob_buffer_pass;
+    fused_passes.non_bindless_oob_texel_buffer = all_passes || non_bindless_oob_texel_buffer_pass;
+    fused_passes.buffer_device_address = all_passes || buffer_device_address_pass;
+    fused_passes.ray_query = all_passes || ray_query_pass;
+    module.RunFusedPasses(fused_passes);
 
     if (all_passes || post_process_descriptor_indexing_pass) {
         module.RunPassPostProcessDescriptorIndexing();
@@ -0,0 +1,1134 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../framework/layer_validation_tests.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/descriptor_helper.h"
+#include "../framework/render_pass_helper.h"
+#include "../framework/ray_tracing_objects.h"
+#include "vk_layer_config.h"
+
+// Measures the time the layer adds to the hot entry points, for each validation object on its own.
+//
+// By default every benchmark runs a single iteration so that they are just smoke tests in the normal test runs. To benchmark:
+//   VVL_BENCHMARK_ITERATIONS=1000 VVL_BENCHMARK_OUTPUT=results.json vk_layer_validation_tests --gtest_filter=Benchmark/*
+// Each result is appended to VVL_BENCHMARK_OUTPUT as one JSON object per line:
+//   {"benchmark":"CmdDraw/descriptors=8","config":"core","iterations":1000,"calls":256000,"ns_per_call":123.4}
+// The multithreaded benchmarks also report the thread count and the lock profiling counters of the run.
+//
+// The Sync* benchmarks are the hazard heavy streams of synchronization validation (barrier chains, render passes with many
+// attachments, copies of many regions, bindless draws, timeline semaphore graphs). They report the record time and the
+// submit time per command, and the syncval stats (peak memory of the records, time of each phase) when the layer is built
+// with VVL_ENABLE_SYNCVAL_STATS:
+//   VVL_BENCHMARK_ITERATIONS=100 VVL_BENCHMARK_OUTPUT=results.json vk_layer_validation_tests --gtest_filter=Benchmark/*Sync*/sync
+//
+// GpuAVBenchmark/* run representative shaders (fragment heavy draws, compute loops, ray queries) and copies with one kind
+// of GPU-AV check at a time. They report the GPU time of the work from timestamp queries, and the intercept timing report
+// of the device, which has the CPU time of shader instrumentation and post processing in the GPU-AV entry points. Only
+// meaningful on real hardware, on the mock ICD they are smoke tests.
+
+struct BenchmarkConfig {
+    const char *name;
+    std::vector<VkValidationFeatureEnableEXT> enables;
+    std::vector<VkValidationFeatureDisableEXT> disables;
+};
+
+// Every config keeps only one validation object (besides handle wrapping), "none" measures the dispatch cost alone
+static const std::vector<BenchmarkConfig> kBenchmarkConfigs = {
+    {"none", {}, {VK_VALIDATION_FEATURE_DISABLE_ALL_EXT}},
+    {"core",
+     {},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT}},
+    {"stateless",
+     {},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+    {"thread_safety",
+     {},
+     {VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT, VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+    {"object_lifetimes",
+     {},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+    {"sync",
+     {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+    {"best_practices",
+     {VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT},
+     {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+      VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT}},
+};
+
+static uint32_t BenchmarkIterations() {
+    const std::string iterations = GetEnvironment("VVL_BENCHMARK_ITERATIONS");
+    return iterations.empty() ? 1u : std::max(1u, static_cast<uint32_t>(std::stoul(iterations)));
+}
+
+// extra_fields is appended as is to the JSON object, it must start with a comma when not empty
+static void WriteBenchmarkResult(const std::string &benchmark, const char *config, uint32_t iterations, uint64_t calls,
+                                 double elapsed_ns, const std::string &extra_fields) {
+    const std::string output = GetEnvironment("VVL_BENCHMARK_OUTPUT");
+    if (output.empty()) {
+        return;
+    }
+    FILE *file = fopen(output.c_str(), "a");
+    ASSERT_NE(file, nullptr) << "Could not open " << output;
+    fprintf(file, "{\"benchmark\":\"%s\",\"config\":\"%s\",\"iterations\":%u,\"calls\":%llu,\"ns_per_call\":%.1f%s}\n",
+            benchmark.c_str(), config, iterations, static_cast<unsigned long long>(calls), elapsed_ns / static_cast<double>(calls),
+            extra_fields.c_str());
+    fclose(file);
+}
+
+class VkBenchmarkTest : public VkLayerTest, public ::testing::WithParamInterface<BenchmarkConfig> {
+  protected:
+    void InitBenchmark(void *instance_pnext = nullptr) {
+        const BenchmarkConfig &config = GetParam();
+        VkValidationFeaturesEXT validation_features = vku::InitStructHelper(instance_pnext);
+        validation_features.enabledValidationFeatureCount = size32(config.enables);
+        validation_features.pEnabledValidationFeatures = config.enables.data();
+        validation_features.disabledValidationFeatureCount = size32(config.disables);
+        validation_features.pDisabledValidationFeatures = config.disables.data();
+        RETURN_IF_SKIP(InitFramework(&validation_features));
+        RETURN_IF_SKIP(InitState());
+        InitRenderTarget();
+    }
+
+    static uint32_t Iterations() { return BenchmarkIterations(); }
+
+    // Runs iteration() Iterations() times after one warm up run, each run making calls_per_iteration calls to the measured
+    // entry point
+    template <typename Iteration>
+    void Measure(const std::string &benchmark, uint32_t calls_per_iteration, Iteration &&iteration) {
+        iteration();
+        const uint32_t iterations = Iterations();
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            iteration();
+        }
+        const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+        WriteResult(benchmark, iterations, uint64_t(iterations) * calls_per_iteration, elapsed.count());
+    }
+
+    void WriteResult(const std::string &benchmark, uint32_t iterations, uint64_t calls, double elapsed_ns,
+                     const std::string &extra_fields = {}) {
+        WriteBenchmarkResult(benchmark, GetParam().name, iterations, calls, elapsed_ns, extra_fields);
+    }
+
+    // Syncval logs its stats after every submit of the device (peak record counts and memory, time of each validation
+    // phase) when the layer is built with VVL_ENABLE_SYNCVAL_STATS, the last report is added to the results
+    void InitSyncStatsBenchmark(void *instance_pnext = nullptr) {
+        VkDebugUtilsMessengerCreateInfoEXT messenger_ci = vku::InitStructHelper(instance_pnext);
+        messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+        messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+        messenger_ci.pfnUserCallback = CaptureSyncStats;
+        messenger_ci.pUserData = &sync_stats_report_;
+#if !defined(__ANDROID__)
+        // Only read when the device is created
+        SetEnvironment("VK_SYNCVAL_STATS_REPORT_INTERVAL", "1");
+#endif
+        InitBenchmark(&messenger_ci);
+#if !defined(__ANDROID__)
+        SetEnvironment("VK_SYNCVAL_STATS_REPORT_INTERVAL", "");
+#endif
+    }
+
+    // Like Measure(), with the recording and the submission (up to the queues being idle) timed on their own, so that record
+    // time and submit time validation are reported per command. submitted_commands is the number of commands all the submits
+    // of an iteration execute.
+    template <typename Record, typename Submit>
+    void MeasureRecordAndSubmit(const std::string &benchmark, uint32_t recorded_commands, uint32_t submitted_commands,
+                                Record &&record, Submit &&submit) {
+        record();
+        submit();
+        const uint32_t iterations = Iterations();
+        double record_ns = 0.0;
+        double submit_ns = 0.0;
+        for (uint32_t i = 0; i < iterations; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            record();
+            const auto recorded = std::chrono::steady_clock::now();
+            submit();
+            record_ns += std::chrono::duration<double, std::nano>(recorded - start).count();
+            submit_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - recorded).count();
+        }
+
+        char times[128];
+        snprintf(times, sizeof(times), ",\"record_ns_per_command\":%.1f,\"submit_ns_per_command\":%.1f",
+                 record_ns / (double(iterations) * recorded_commands), submit_ns / (double(iterations) * submitted_commands));
+        std::string extra_fields = times;
+        if (!sync_stats_report_.empty()) {
+            extra_fields += ",\"sync_stats\":\"";
+            for (const char c : sync_stats_report_) {
+                switch (c) {
+                    case '\n':
+                        extra_fields += "\\n";
+                        break;
+                    case '\t':
+                        extra_fields += "\\t";
+                        break;
+                    case '"':
+                    case '\\':
+                        extra_fields += '\\';
+                        extra_fields += c;
+                        break;
+                    default:
+                        extra_fields += c;
+                        break;
+                }
+            }
+            extra_fields += '"';
+        }
+        WriteResult(benchmark, iterations, uint64_t(iterations) * recorded_commands, record_ns + submit_ns, extra_fields);
+    }
+
+  private:
+    static VKAPI_ATTR VkBool32 VKAPI_CALL CaptureSyncStats(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                           const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                           void *user_data) {
+        if (callback_data->pMessageIdName && strcmp(callback_data->pMessageIdName, "SYNC-STATS") == 0) {
+            *static_cast<std::string *>(user_data) = callback_data->pMessage;
+        }
+        return VK_FALSE;
+    }
+
+    std::string sync_stats_report_;
+};
+
+INSTANTIATE_TEST_SUITE_P(Benchmark, VkBenchmarkTest, ::testing::ValuesIn(kBenchmarkConfigs),
+                         [](const ::testing::TestParamInfo<BenchmarkConfig> &info) { return std::string(info.param.name); });
+
+TEST_P(VkBenchmarkTest, CmdDraw) {
+    TEST_DESCRIPTION("vkCmdDraw with a growing number of descriptors used by the pipeline");
+    RETURN_IF_SKIP(InitBenchmark());
+    constexpr uint32_t kDrawCount = 256;
+    const uint32_t max_uniform_buffers = m_device->Physical().limits_.maxPerStageDescriptorUniformBuffers;
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+    for (const uint32_t descriptor_count : {1u, 8u, 32u}) {
+        if (descriptor_count > max_uniform_buffers) {
+            break;
+        }
+        OneOffDescriptorSet descriptor_set(
+            m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+        for (uint32_t i = 0; i < descriptor_count; ++i) {
+            descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, i);
+        }
+        descriptor_set.UpdateDescriptorSets();
+
+        // The loop indexes the array dynamically, so every descriptor is used
+        const std::string fs_source = R"glsl(
+            #version 450
+            layout(location=0) out vec4 color;
+            layout(set=0, binding=0) uniform UBO { vec4 value; } ubos[)glsl" +
+                                      std::to_string(descriptor_count) + R"glsl(];
+            void main() {
+                color = vec4(0.0);
+                for (int i = 0; i < ubos.length(); ++i) {
+                    color += ubos[i].value;
+                }
+            }
+        )glsl";
+        VkShaderObj fs(this, fs_source.c_str(), VK_SHADER_STAGE_FRAGMENT_BIT);
+
+        CreatePipelineHelper pipe(*this);
+        pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+        pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+        pipe.CreateGraphicsPipeline();
+
+        Measure("CmdDraw/descriptors=" + std::to_string(descriptor_count), kDrawCount, [&]() {
+            m_command_buffer.Begin();
+            m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+            vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+            vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(),
+                                      0, 1, &descriptor_set.set_, 0, nullptr);
+            for (uint32_t i = 0; i < kDrawCount; ++i) {
+                vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+            }
+            m_command_buffer.EndRenderPass();
+            m_command_buffer.End();
+        });
+    }
+}
+
+TEST_P(VkBenchmarkTest, QueueSubmit) {
+    TEST_DESCRIPTION("vkQueueSubmit of many command buffers");
+    RETURN_IF_SKIP(InitBenchmark());
+    constexpr uint32_t kCommandBufferCount = 64;
+    vkt::Buffer src(*m_device, 1024, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer dst(*m_device, 1024, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    std::vector<vkt::CommandBuffer> command_buffers;
+    std::vector<VkCommandBuffer> handles;
+    for (uint32_t i = 0; i < kCommandBufferCount; ++i) {
+        vkt::CommandBuffer &cb = command_buffers.emplace_back(*m_device, m_command_pool);
+        cb.Begin();
+        VkBufferCopy region = {0, 0, 1024};
+        vk::CmdCopyBuffer(cb.handle(), src.handle(), dst.handle(), 1, &region);
+        cb.End();
+        handles.push_back(cb.handle());
+    }
+
+    VkSubmitInfo submit_info = vku::InitStructHelper();
+    submit_info.commandBufferCount = size32(handles);
+    submit_info.pCommandBuffers = handles.data();
+    Measure("QueueSubmit/command_buffers=" + std::to_string(kCommandBufferCount), 1, [&]() {
+        vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+        m_default_queue->Wait();
+    });
+}
+
+TEST_P(VkBenchmarkTest, UpdateDescriptorSets) {
+    TEST_DESCRIPTION("vkUpdateDescriptorSets writing an array of buffers");
+    RETURN_IF_SKIP(InitBenchmark());
+    constexpr uint32_t kDescriptorCount = 64;
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kDescriptorCount, VK_SHADER_STAGE_ALL, nullptr}});
+
+    std::vector<VkDescriptorBufferInfo> buffer_infos(kDescriptorCount, {buffer.handle(), 0, VK_WHOLE_SIZE});
+    VkWriteDescriptorSet write = vku::InitStructHelper();
+    write.dstSet = descriptor_set.set_;
+    write.dstBinding = 0;
+    write.descriptorCount = kDescriptorCount;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    write.pBufferInfo = buffer_infos.data();
+    Measure("UpdateDescriptorSets/descriptors=" + std::to_string(kDescriptorCount), 1,
+            [&]() { vk::UpdateDescriptorSets(device(), 1, &write, 0, nullptr); });
+}
+
+TEST_P(VkBenchmarkTest, CreateGraphicsPipeline) {
+    TEST_DESCRIPTION("vkCreateGraphicsPipelines with the default helper state");
+    RETURN_IF_SKIP(InitBenchmark());
+    CreatePipelineHelper pipe(*this);
+    pipe.LateBindPipelineInfo();
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    Measure("CreateGraphicsPipelines", 1, [&]() {
+        vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, 1, &pipe.gp_ci_, nullptr, &pipeline);
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    });
+}
+
+TEST_P(VkBenchmarkTest, BarrierStream) {
+    TEST_DESCRIPTION("Copies separated by barriers, recorded and submitted");
+    RETURN_IF_SKIP(InitBenchmark());
+    constexpr uint32_t kCopyCount = 256;
+    vkt::Buffer buffer_a(*m_device, 4096, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 4096, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkBufferMemoryBarrier barriers[2] = {vku::InitStructHelper(), vku::InitStructHelper()};
+    for (VkBufferMemoryBarrier &barrier : barriers) {
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.size = VK_WHOLE_SIZE;
+    }
+    barriers[0].buffer = buffer_a.handle();
+    barriers[1].buffer = buffer_b.handle();
+
+    Measure("BarrierStream/copies=" + std::to_string(kCopyCount), kCopyCount, [&]() {
+        m_command_buffer.Begin();
+        for (uint32_t i = 0; i < kCopyCount; ++i) {
+            // Alternating directions so that every copy depends on the previous one
+            const VkBufferCopy region = {(i % 16) * 256, ((i + 1) % 16) * 256, 256};
+            if (i % 2 == 0) {
+                vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+            } else {
+                vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_b.handle(), buffer_a.handle(), 1, &region);
+            }
+            vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                                   nullptr, 2, barriers, 0, nullptr);
+        }
+        m_command_buffer.End();
+        m_default_queue->Submit(m_command_buffer);
+        m_default_queue->Wait();
+    });
+}
+
+// A JSON report the layer logs when a device is destroyed, with lock_profiling or intercept_timing on
+struct LayerReport {
+    const char *message_id;
+    std::string json;
+};
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL CaptureLayerReport(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                         const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                         void *user_data) {
+    auto *report = static_cast<LayerReport *>(user_data);
+    if (callback_data->pMessageIdName && strcmp(callback_data->pMessageIdName, report->message_id) == 0) {
+        const std::string message = callback_data->pMessage;
+        const size_t begin = message.find('[');
+        const size_t end = message.rfind(']');
+        if (begin != std::string::npos && end != std::string::npos && end > begin) {
+            report->json = message.substr(begin, end + 1 - begin);
+        }
+    }
+    return VK_FALSE;
+}
+
+static VkDebugUtilsMessengerCreateInfoEXT LayerReportMessengerInfo(LayerReport &report) {
+    VkDebugUtilsMessengerCreateInfoEXT messenger_ci = vku::InitStructHelper();
+    messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+    messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    messenger_ci.pfnUserCallback = CaptureLayerReport;
+    messenger_ci.pUserData = &report;
+    return messenger_ci;
+}
+
+TEST_P(VkBenchmarkTest, MultithreadedRecording) {
+    TEST_DESCRIPTION("Command buffers recorded from 1 to 64 threads at once, with the contention of the layer locks of each run");
+    constexpr uint32_t kCopyCount = 256;
+
+    // Each thread count gets its own instance and device so that the lock report of the device only covers that run
+    for (const uint32_t thread_count : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+        LayerReport lock_report = {"WARNING-DestroyDevice-lock-profiling-json", {}};
+        VkDebugUtilsMessengerCreateInfoEXT messenger_ci = LayerReportMessengerInfo(lock_report);
+        const VkBool32 lock_profiling = VK_TRUE;
+        const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "lock_profiling", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                           &lock_profiling};
+        VkLayerSettingsCreateInfoEXT layer_settings = vku::InitStructHelper(&messenger_ci);
+        layer_settings.settingCount = 1;
+        layer_settings.pSettings = &setting;
+        RETURN_IF_SKIP(InitBenchmark(&layer_settings));
+
+        const uint32_t iterations = Iterations();
+        double elapsed_ns = 0.0;
+        {
+            // The buffers are shared by every thread, the command pools and buffers are not
+            vkt::Buffer src(*m_device, 4096, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+            vkt::Buffer dst(*m_device, 4096, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+            std::vector<vkt::CommandPool> command_pools;
+            std::vector<vkt::CommandBuffer> command_buffers;
+            command_pools.reserve(thread_count);
+            command_buffers.reserve(thread_count);
+            for (uint32_t i = 0; i < thread_count; ++i) {
+                command_pools.emplace_back(*m_device, m_device->graphics_queue_node_index_);
+                command_buffers.emplace_back(*m_device, command_pools.back());
+            }
+
+            const auto record = [&](vkt::CommandBuffer &cb) {
+                cb.Begin();
+                for (uint32_t i = 0; i < kCopyCount; ++i) {
+                    const VkBufferCopy region = {(i % 16) * 256, (i % 16) * 256, 256};
+                    vk::CmdCopyBuffer(cb.handle(), src.handle(), dst.handle(), 1, &region);
+                }
+                cb.End();
+            };
+            // Warm up
+            for (vkt::CommandBuffer &cb : command_buffers) {
+                record(cb);
+            }
+
+            std::atomic<bool> start_recording{false};
+            std::vector<std::thread> threads;
+            threads.reserve(thread_count);
+            for (uint32_t t = 0; t < thread_count; ++t) {
+                threads.emplace_back([&, t]() {
+                    while (!start_recording.load()) {
+                        std::this_thread::yield();
+                    }
+                    for (uint32_t i = 0; i < iterations; ++i) {
+                        record(command_buffers[t]);
+                    }
+                });
+            }
+            const auto start = std::chrono::steady_clock::now();
+            start_recording = true;
+            for (std::thread &thread : threads) {
+                thread.join();
+            }
+            elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+        // Destroying the device logs the lock report
+        ShutdownFramework();
+        ASSERT_FALSE(lock_report.json.empty());
+
+        const uint64_t calls = uint64_t(iterations) * thread_count * (kCopyCount + 2);
+        const std::string extra_fields = ",\"threads\":" + std::to_string(thread_count) + ",\"locks\":" + lock_report.json;
+        WriteResult("MultithreadedRecording/threads=" + std::to_string(thread_count), iterations, calls, elapsed_ns,
+                    extra_fields);
+    }
+}
+
+TEST_P(VkBenchmarkTest, InterceptTiming) {
+    TEST_DESCRIPTION("A small frame (uploads, descriptor updates, draws, submit) with the time of each validation object");
+    LayerReport timing_report = {"WARNING-DestroyDevice-intercept-timing-json", {}};
+    VkDebugUtilsMessengerCreateInfoEXT messenger_ci = LayerReportMessengerInfo(timing_report);
+    const VkBool32 intercept_timing = VK_TRUE;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "intercept_timing", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &intercept_timing};
+    VkLayerSettingsCreateInfoEXT layer_settings = vku::InitStructHelper(&messenger_ci);
+    layer_settings.settingCount = 1;
+    layer_settings.pSettings = &setting;
+    RETURN_IF_SKIP(InitBenchmark(&layer_settings));
+
+    constexpr uint32_t kDrawCount = 64;
+    const uint32_t iterations = Iterations();
+    {
+        vkt::Buffer staging(*m_device, 4096, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+        vkt::Buffer uniform(*m_device, 4096, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        OneOffDescriptorSet descriptor_set(m_device,
+                                           {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+        const char *fs_source = R"glsl(
+            #version 450
+            layout(location=0) out vec4 color;
+            layout(set=0, binding=0) uniform UBO { vec4 value; } ubo;
+            void main() { color = ubo.value; }
+        )glsl";
+        VkShaderObj fs(this, fs_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+        CreatePipelineHelper pipe(*this);
+        pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+        pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+        pipe.CreateGraphicsPipeline();
+
+        VkBufferMemoryBarrier barrier = vku::InitStructHelper();
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_UNIFORM_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = uniform.handle();
+        barrier.size = VK_WHOLE_SIZE;
+
+        descriptor_set.WriteDescriptorBufferInfo(0, uniform.handle(), 0, 256);
+        for (uint32_t i = 0; i < iterations; ++i) {
+            descriptor_set.UpdateDescriptorSets();
+
+            m_command_buffer.Begin();
+            const VkBufferCopy region = {0, 0, 256};
+            vk::CmdCopyBuffer(m_command_buffer.handle(), staging.handle(), uniform.handle(), 1, &region);
+            vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                   VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+            m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+            vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+            vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(),
+                                      0, 1, &descriptor_set.set_, 0, nullptr);
+            for (uint32_t draw = 0; draw < kDrawCount; ++draw) {
+                vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+            }
+            m_command_buffer.EndRenderPass();
+            m_command_buffer.End();
+            m_default_queue->Submit(m_command_buffer);
+            m_default_queue->Wait();
+        }
+    }
+    // Destroying the device logs the timing report
+    ShutdownFramework();
+    ASSERT_FALSE(timing_report.json.empty());
+
+    const std::string output = GetEnvironment("VVL_BENCHMARK_OUTPUT");
+    if (output.empty()) {
+        return;
+    }
+    FILE *file = fopen(output.c_str(), "a");
+    ASSERT_NE(file, nullptr) << "Could not open " << output;
+    fprintf(file, "{\"benchmark\":\"InterceptTiming\",\"config\":\"%s\",\"iterations\":%u,\"calls\":%s}\n", GetParam().name,
+            iterations, timing_report.json.c_str());
+    fclose(file);
+}
+
+TEST_P(VkBenchmarkTest, SyncComputeChain) {
+    TEST_DESCRIPTION("Dispatches reading and writing one storage buffer, each separated from the next one by a barrier");
+    RETURN_IF_SKIP(InitSyncStatsBenchmark());
+    constexpr uint32_t kDispatchCount = 256;
+    vkt::Buffer buffer(*m_device, 4096, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    std::vector<VkDescriptorSetLayoutBinding> bindings = {
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    OneOffDescriptorSet descriptor_set(m_device, bindings);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x=64) in;
+        layout(set=0, binding=0) buffer SSBO { uint data[]; } ssbo;
+        void main() { ssbo.data[gl_GlobalInvocationID.x] += 1; }
+    )glsl";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.dsl_bindings_ = bindings;
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    pipe.CreateComputePipeline();
+
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+    MeasureRecordAndSubmit(
+        "SyncComputeChain/dispatches=" + std::to_string(kDispatchCount), 2 * kDispatchCount, 2 * kDispatchCount,
+        [&]() {
+            m_command_buffer.Begin();
+            vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+            vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(),
+                                      0, 1, &descriptor_set.set_, 0, nullptr);
+            for (uint32_t i = 0; i < kDispatchCount; ++i) {
+                vk::CmdDispatch(m_command_buffer.handle(), 16, 1, 1);
+                vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+            }
+            m_command_buffer.End();
+        },
+        [&]() {
+            m_default_queue->Submit(m_command_buffer);
+            m_default_queue->Wait();
+        });
+}
+
+TEST_P(VkBenchmarkTest, SyncRenderPassAttachments) {
+    TEST_DESCRIPTION("Render passes with as many color attachments as the device allows, loaded and stored by each pass");
+    RETURN_IF_SKIP(InitSyncStatsBenchmark());
+    constexpr uint32_t kRenderPassCount = 64;
+    const uint32_t attachment_count = std::min(8u, m_device->Physical().limits_.maxColorAttachments);
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+
+    std::vector<std::unique_ptr<vkt::Image>> images;
+    std::vector<vkt::ImageView> views;
+    std::vector<VkImageView> view_handles;
+    RenderPassSingleSubpass rp(*this);
+    for (uint32_t i = 0; i < attachment_count; ++i) {
+        images.emplace_back(std::make_unique<vkt::Image>(*m_device, 32, 32, 1, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT));
+        images.back()->SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+        views.emplace_back(images.back()->CreateView());
+        view_handles.push_back(views.back().handle());
+        rp.AddAttachmentDescription(format, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL, VK_ATTACHMENT_LOAD_OP_LOAD,
+                                    VK_ATTACHMENT_STORE_OP_STORE);
+        rp.AddAttachmentReference({i, VK_IMAGE_LAYOUT_GENERAL});
+        rp.AddColorAttachment(i);
+    }
+    // The stores of a pass happen before the loads of the next one
+    rp.AddSubpassDependency({VK_SUBPASS_EXTERNAL, 0, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                             VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                             VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, 0});
+    rp.CreateRenderPass();
+    vkt::Framebuffer framebuffer(*m_device, rp.Handle(), attachment_count, view_handles.data());
+
+    MeasureRecordAndSubmit(
+        "SyncRenderPassAttachments/attachments=" + std::to_string(attachment_count), 2 * kRenderPassCount,
+        2 * kRenderPassCount,
+        [&]() {
+            m_command_buffer.Begin();
+            for (uint32_t i = 0; i < kRenderPassCount; ++i) {
+                m_command_buffer.BeginRenderPass(rp.Handle(), framebuffer.handle(), 32, 32);
+                m_command_buffer.EndRenderPass();
+            }
+            m_command_buffer.End();
+        },
+        [&]() {
+            m_default_queue->Submit(m_command_buffer);
+            m_default_queue->Wait();
+        });
+}
+
+TEST_P(VkBenchmarkTest, SyncCopyRegions) {
+    TEST_DESCRIPTION("Buffer to buffer and buffer to image copies of 10000 regions each");
+    RETURN_IF_SKIP(InitSyncStatsBenchmark());
+    // One texel of the 100x100 image per region
+    constexpr uint32_t kRegionCount = 10000;
+    constexpr uint32_t kImageSize = 100;
+    constexpr VkDeviceSize kRegionSize = 4;
+    const VkBufferUsageFlags buffer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, kRegionCount * kRegionSize, buffer_usage);
+    vkt::Buffer buffer_b(*m_device, kRegionCount * kRegionSize, buffer_usage);
+    vkt::Image image(*m_device, kImageSize, kImageSize, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    image.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+
+    std::vector<VkBufferCopy> buffer_regions;
+    std::vector<VkBufferImageCopy> image_regions;
+    for (uint32_t i = 0; i < kRegionCount; ++i) {
+        // Every other region backwards so that the ranges are not merged
+        const VkDeviceSize dst_offset = (i % 2 == 0 ? i : kRegionCount - i) * kRegionSize;
+        buffer_regions.push_back({i * kRegionSize, dst_offset, kRegionSize});
+        VkBufferImageCopy image_region = {};
+        image_region.bufferOffset = i * kRegionSize;
+        image_region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        image_region.imageOffset = {int32_t(i % kImageSize), int32_t(i / kImageSize), 0};
+        image_region.imageExtent = {1, 1, 1};
+        image_regions.push_back(image_region);
+    }
+
+    VkBufferMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = buffer_b.handle();
+    barrier.size = VK_WHOLE_SIZE;
+
+    // The next iteration writes the buffers again, after the queue is idle
+    MeasureRecordAndSubmit(
+        "SyncCopyRegions/regions=" + std::to_string(kRegionCount), 3, 3,
+        [&]() {
+            m_command_buffer.Begin();
+            vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_a.handle(), buffer_b.handle(), kRegionCount, buffer_regions.data());
+            vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                                   nullptr, 1, &barrier, 0, nullptr);
+            vk::CmdCopyBufferToImage(m_command_buffer.handle(), buffer_b.handle(), image.handle(), VK_IMAGE_LAYOUT_GENERAL,
+                                     kRegionCount, image_regions.data());
+            m_command_buffer.End();
+        },
+        [&]() {
+            m_default_queue->Submit(m_command_buffer);
+            m_default_queue->Wait();
+        });
+}
+
+TEST_P(VkBenchmarkTest, SyncBindlessDraws) {
+    TEST_DESCRIPTION("Draws reading a large array of storage buffers, each descriptor a different buffer");
+    RETURN_IF_SKIP(InitSyncStatsBenchmark());
+    constexpr uint32_t kDrawCount = 256;
+    const VkPhysicalDeviceLimits &limits = m_device->Physical().limits_;
+    const uint32_t descriptor_count =
+        std::min({1024u, limits.maxPerStageDescriptorStorageBuffers, limits.maxDescriptorSetStorageBuffers});
+
+    std::vector<vkt::Buffer> buffers(descriptor_count);
+    OneOffDescriptorSet descriptor_set(
+        m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    for (uint32_t i = 0; i < descriptor_count; ++i) {
+        buffers[i].init(*m_device, 256, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        descriptor_set.WriteDescriptorBufferInfo(0, buffers[i].handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, i);
+    }
+    descriptor_set.UpdateDescriptorSets();
+
+    // The loop indexes the array dynamically, so every descriptor is used
+    const std::string fs_source = R"glsl(
+        #version 450
+        layout(location=0) out vec4 color;
+        layout(set=0, binding=0) readonly buffer SSBO { vec4 value; } ssbos[)glsl" +
+                                  std::to_string(descriptor_count) + R"glsl(];
+        void main() {
+            color = vec4(0.0);
+            for (int i = 0; i < ssbos.length(); ++i) {
+                color += ssbos[i].value;
+            }
+        }
+    )glsl";
+    VkShaderObj fs(this, fs_source.c_str(), VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    MeasureRecordAndSubmit(
+        "SyncBindlessDraws/descriptors=" + std::to_string(descriptor_count), kDrawCount, kDrawCount,
+        [&]() {
+            m_command_buffer.Begin();
+            m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+            vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+            vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(),
+                                      0, 1, &descriptor_set.set_, 0, nullptr);
+            for (uint32_t i = 0; i < kDrawCount; ++i) {
+                vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+            }
+            m_command_buffer.EndRenderPass();
+            m_command_buffer.End();
+        },
+        [&]() {
+            m_default_queue->Submit(m_command_buffer);
+            m_default_queue->Wait();
+        });
+}
+
+TEST_P(VkBenchmarkTest, SyncTimelineGraph) {
+    TEST_DESCRIPTION("Two queues taking turns through a timeline semaphore, each copy depending on the copy of the other queue");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    RETURN_IF_SKIP(InitSyncStatsBenchmark());
+    if (!m_second_queue) {
+        GTEST_SKIP() << "Two queues are needed";
+    }
+    constexpr uint32_t kStepCount = 64;
+    vkt::Buffer buffer_a(*m_device, 4096, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 4096, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+    uint64_t value = 0;
+
+    const VkBufferCopy region = {0, 0, 4096};
+    MeasureRecordAndSubmit(
+        "SyncTimelineGraph/submits=" + std::to_string(2 * kStepCount), 2, 2 * kStepCount,
+        [&]() {
+            // Each command buffer is submitted once per step
+            m_command_buffer.Begin(VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+            vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+            m_command_buffer.End();
+            m_second_command_buffer.Begin(VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+            vk::CmdCopyBuffer(m_second_command_buffer.handle(), buffer_b.handle(), buffer_a.handle(), 1, &region);
+            m_second_command_buffer.End();
+        },
+        [&]() {
+            for (uint32_t i = 0; i < kStepCount; ++i) {
+                m_default_queue->Submit(m_command_buffer, vkt::TimelineWait(semaphore, value),
+                                        vkt::TimelineSignal(semaphore, value + 1));
+                m_second_queue->Submit(m_second_command_buffer, vkt::TimelineWait(semaphore, value + 1),
+                                       vkt::TimelineSignal(semaphore, value + 2));
+                value += 2;
+            }
+            m_device->Wait();
+        });
+}
+
+struct GpuAVBenchmarkConfig {
+    const char *name;
+    // The settings of kGpuAVInstrumentationSettings turned on, the others are off
+    std::vector<const char *> enabled_settings;
+};
+
+// One setting per kind of GPU-AV check
+static const std::vector<const char *> kGpuAVInstrumentationSettings = {
+    "gpuav_descriptor_checks",
+    "gpuav_buffer_address_oob",
+    "gpuav_validate_ray_query",
+    "gpuav_post_process_descriptor_indexing",
+    "gpuav_inline_fast_path_checks",
+    "gpuav_indirect_draws_buffers",
+    "gpuav_indirect_dispatches_buffers",
+    "gpuav_buffer_copies",
+};
+
+// "no_checks" measures GPU-AV without any instrumentation, the cost of each check is the difference with it
+static const std::vector<GpuAVBenchmarkConfig> kGpuAVBenchmarkConfigs = {
+    {"no_checks", {}},
+    {"descriptor_checks", {"gpuav_descriptor_checks"}},
+    {"descriptor_checks_inline", {"gpuav_descriptor_checks", "gpuav_inline_fast_path_checks"}},
+    {"buffer_device_address", {"gpuav_buffer_address_oob"}},
+    {"ray_query", {"gpuav_validate_ray_query"}},
+    {"post_process_descriptor_indexing", {"gpuav_post_process_descriptor_indexing"}},
+    {"indirect_buffers", {"gpuav_indirect_draws_buffers", "gpuav_indirect_dispatches_buffers"}},
+    {"buffer_copies", {"gpuav_buffer_copies"}},
+};
+
+// What MeasureGpuAV() measured, written once the device is destroyed and the timing report logged
+struct GpuAVMeasurement {
+    uint32_t iterations = 0;
+    double record_ns = 0.0;
+    double submit_ns = 0.0;
+    // Zero when the queue has no timestamps
+    double gpu_ns = 0.0;
+};
+
+class VkGpuAVBenchmarkTest : public GpuAVTest, public ::testing::WithParamInterface<GpuAVBenchmarkConfig> {
+  protected:
+    void InitGpuAVBenchmark() {
+        static const VkBool32 kTrue = VK_TRUE;
+        static const VkBool32 kFalse = VK_FALSE;
+        // Shaders are instrumented again for every run, on the thread creating the pipeline, and errors are post processed on
+        // the thread waiting for the queue, so that the timing report has all the CPU time of GPU-AV
+        std::vector<VkLayerSettingEXT> settings = {
+            {OBJECT_LAYER_NAME, "intercept_timing", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kTrue},
+            {OBJECT_LAYER_NAME, "gpuav_shader_instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kTrue},
+            {OBJECT_LAYER_NAME, "gpuav_buffers_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kTrue},
+            {OBJECT_LAYER_NAME, "gpuav_cache_instrumented_shaders", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kFalse},
+            {OBJECT_LAYER_NAME, "gpuav_parallel_shader_instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kFalse},
+            {OBJECT_LAYER_NAME, "gpuav_parallel_post_processing", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kFalse},
+        };
+        const std::vector<const char *> &enabled = GetParam().enabled_settings;
+        for (const char *setting : kGpuAVInstrumentationSettings) {
+            const bool on = std::find(enabled.begin(), enabled.end(), setting) != enabled.end();
+            settings.push_back({OBJECT_LAYER_NAME, setting, VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, on ? &kTrue : &kFalse});
+        }
+
+        VkDebugUtilsMessengerCreateInfoEXT messenger_ci = LayerReportMessengerInfo(timing_report_);
+        VkLayerSettingsCreateInfoEXT layer_settings = vku::InitStructHelper(&messenger_ci);
+        layer_settings.settingCount = size32(settings);
+        layer_settings.pSettings = settings.data();
+        RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings));
+        RETURN_IF_SKIP(InitState());
+        InitRenderTarget();
+
+        const vkt::PhysicalDevice &physical = m_device->Physical();
+        const uint32_t timestamp_bits = physical.queue_properties_[m_device->graphics_queue_node_index_].timestampValidBits;
+        if (timestamp_bits != 0 && physical.limits_.timestampComputeAndGraphics) {
+            timestamp_mask_ = timestamp_bits >= 64 ? ~uint64_t(0) : (uint64_t(1) << timestamp_bits) - 1;
+            timestamps_.init(*m_device, vkt::QueryPool::CreateInfo(VK_QUERY_TYPE_TIMESTAMP, 2));
+        }
+    }
+
+    // Records workload(), between two timestamps, then submits it and waits for the queue, once per iteration after one warm up
+    // run. The CPU time GPU-AV adds to each entry point (instrumentation when pipelines are created, post processing after
+    // the waits...) is in the timing report of the device.
+    template <typename Workload>
+    GpuAVMeasurement MeasureGpuAV(Workload &&workload) {
+        const auto run = [&](GpuAVMeasurement &measurement) {
+            const auto start = std::chrono::steady_clock::now();
+            m_command_buffer.Begin();
+            if (timestamps_.initialized()) {
+                vk::CmdResetQueryPool(m_command_buffer.handle(), timestamps_.handle(), 0, 2);
+                vk::CmdWriteTimestamp(m_command_buffer.handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestamps_.handle(), 0);
+            }
+            workload();
+            if (timestamps_.initialized()) {
+                vk::CmdWriteTimestamp(m_command_buffer.handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestamps_.handle(), 1);
+            }
+            m_command_buffer.End();
+            const auto recorded = std::chrono::steady_clock::now();
+            m_default_queue->Submit(m_command_buffer);
+            m_default_queue->Wait();
+            measurement.record_ns += std::chrono::duration<double, std::nano>(recorded - start).count();
+            measurement.submit_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - recorded).count();
+
+            if (timestamps_.initialized()) {
+                uint64_t ticks[2] = {};
+                vk::GetQueryPoolResults(device(), timestamps_.handle(), 0, 2, sizeof(ticks), ticks, sizeof(uint64_t),
+                                        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+                measurement.gpu_ns +=
+                    double((ticks[1] - ticks[0]) & timestamp_mask_) * m_device->Physical().limits_.timestampPeriod;
+            }
+        };
+        GpuAVMeasurement warm_up;
+        run(warm_up);
+        GpuAVMeasurement measurement;
+        measurement.iterations = BenchmarkIterations();
+        for (uint32_t i = 0; i < measurement.iterations; ++i) {
+            run(measurement);
+        }
+        return measurement;
+    }
+
+    // Destroys the device, which logs the timing report, and writes the result. Every object of the test must be destroyed.
+    void WriteGpuAVResult(const std::string &benchmark, const GpuAVMeasurement &measurement) {
+        timestamps_.destroy();
+        ShutdownFramework();
+        ASSERT_FALSE(timing_report_.json.empty());
+
+        const double iterations = measurement.iterations;
+        char times[192];
+        snprintf(times, sizeof(times), ",\"record_ns\":%.1f,\"submit_ns\":%.1f,\"gpu_ns\":%.1f", measurement.record_ns / iterations,
+                 measurement.submit_ns / iterations, measurement.gpu_ns / iterations);
+        WriteBenchmarkResult(benchmark, GetParam().name, measurement.iterations, measurement.iterations,
+                             measurement.record_ns + measurement.submit_ns,
+                             std::string(times) + ",\"timing\":" + timing_report_.json);
+    }
+
+  private:
+    LayerReport timing_report_ = {"WARNING-DestroyDevice-intercept-timing-json", {}};
+    vkt::QueryPool timestamps_;
+    uint64_t timestamp_mask_ = 0;
+};
+
+INSTANTIATE_TEST_SUITE_P(GpuAVBenchmark, VkGpuAVBenchmarkTest, ::testing::ValuesIn(kGpuAVBenchmarkConfigs),
+                         [](const ::testing::TestParamInfo<GpuAVBenchmarkConfig> &info) { return std::string(info.param.name); });
+
+TEST_P(VkGpuAVBenchmarkTest, FragmentHeavy) {
+    TEST_DESCRIPTION("Indirect draws covering the render target, each fragment reading an array of storage buffers");
+    RETURN_IF_SKIP(InitGpuAVBenchmark());
+    constexpr uint32_t kDrawCount = 64;
+    constexpr uint32_t kDescriptorCount = 16;
+    GpuAVMeasurement measurement;
+    {
+        std::vector<vkt::Buffer> buffers(kDescriptorCount);
+        OneOffDescriptorSet descriptor_set(
+            m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kDescriptorCount, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+        for (uint32_t i = 0; i < kDescriptorCount; ++i) {
+            buffers[i].init(*m_device, 1024, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+            descriptor_set.WriteDescriptorBufferInfo(0, buffers[i].handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                     i);
+        }
+        descriptor_set.UpdateDescriptorSets();
+
+        const char *fs_source = R"glsl(
+            #version 450
+            layout(location=0) out vec4 color;
+            layout(set=0, binding=0) readonly buffer SSBO { vec4 values[64]; } ssbos[16];
+            void main() {
+                color = vec4(0.0);
+                const int texel = int(gl_FragCoord.x) + int(gl_FragCoord.y);
+                for (int i = 0; i < ssbos.length(); ++i) {
+                    for (int j = 0; j < 16; ++j) {
+                        color += ssbos[i].values[(texel + j) % 64];
+                    }
+                }
+            }
+        )glsl";
+        VkShaderObj fs(this, fs_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+        CreatePipelineHelper pipe(*this);
+        pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+        pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+        pipe.CreateGraphicsPipeline();
+
+        const VkDrawIndirectCommand draw = {3, 1, 0, 0};
+        vkt::Buffer indirect_buffer(*m_device, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, &draw, sizeof(draw));
+
+        measurement = MeasureGpuAV([&]() {
+            m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+            vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+            vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(),
+                                      0, 1, &descriptor_set.set_, 0, nullptr);
+            for (uint32_t i = 0; i < kDrawCount; ++i) {
+                vk::CmdDrawIndirect(m_command_buffer.handle(), indirect_buffer.handle(), 0, 1, sizeof(draw));
+            }
+            m_command_buffer.EndRenderPass();
+        });
+    }
+    WriteGpuAVResult("FragmentHeavy/draws=" + std::to_string(kDrawCount), measurement);
+}
+
+TEST_P(VkGpuAVBenchmarkTest, ComputeLoop) {
+    TEST_DESCRIPTION("Indirect dispatches looping over a storage buffer and a buffer device address");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    RETURN_IF_SKIP(InitGpuAVBenchmark());
+    constexpr uint32_t kDispatchCount = 16;
+    GpuAVMeasurement measurement;
+    {
+        vkt::Buffer storage_buffer(*m_device, 4096, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        vkt::Buffer address_buffer(*m_device, 4096, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, vkt::device_address);
+        const VkDeviceAddress address = address_buffer.Address();
+        std::vector<VkDescriptorSetLayoutBinding> bindings = {
+            {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+        OneOffDescriptorSet descriptor_set(m_device, bindings);
+        descriptor_set.WriteDescriptorBufferInfo(0, storage_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        descriptor_set.UpdateDescriptorSets();
+
+        const char *cs_source = R"glsl(
+            #version 450
+            #extension GL_EXT_buffer_reference : enable
+            layout(local_size_x=64) in;
+            layout(buffer_reference, std430) readonly buffer Values { uint values[1024]; };
+            layout(push_constant) uniform PushConstants { Values ptr; } pc;
+            layout(set=0, binding=0) buffer SSBO { uint values[1024]; } ssbo;
+            void main() {
+                const uint id = gl_GlobalInvocationID.x;
+                uint sum = 0;
+                for (uint i = 0; i < 64; ++i) {
+                    sum += pc.ptr.values[(id + i) % 1024] + ssbo.values[(id * 7 + i) % 1024];
+                }
+                ssbo.values[id % 1024] = sum;
+            }
+        )glsl";
+        const VkPushConstantRange push_constant_range = {VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(VkDeviceAddress)};
+        CreateComputePipelineHelper pipe(*this);
+        pipe.dsl_bindings_ = bindings;
+        pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+        pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_}, {push_constant_range});
+        pipe.CreateComputePipeline();
+
+        const VkDispatchIndirectCommand dispatch = {16, 1, 1};
+        vkt::Buffer indirect_buffer(*m_device, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, &dispatch, sizeof(dispatch));
+
+        VkMemoryBarrier barrier = vku::InitStructHelper();
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+        measurement = MeasureGpuAV([&]() {
+            vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+            vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(),
+                                      0, 1, &descriptor_set.set_, 0, nullptr);
+            vk::CmdPushConstants(m_command_buffer.handle(), pipe.pipeline_layout_.handle(), VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                 sizeof(address), &address);
+            for (uint32_t i = 0; i < kDispatchCount; ++i) {
+                vk::CmdDispatchIndirect(m_command_buffer.handle(), indirect_buffer.handle(), 0);
+                vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+            }
+        });
+    }
+    WriteGpuAVResult("ComputeLoop/dispatches=" + std::to_string(kDispatchCount), measurement);
+}
+
+TEST_P(VkGpuAVBenchmarkTest, RayQuery) {
+    TEST_DESCRIPTION("Compute shader tracing several ray queries per invocation");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_KHR_RAY_QUERY_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::rayQuery);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    RETURN_IF_SKIP(InitGpuAVBenchmark());
+    constexpr uint32_t kDispatchCount = 16;
+    GpuAVMeasurement measurement;
+    {
+        const char *cs_source = R"glsl(
+            #version 460
+            #extension GL_EXT_ray_query : require
+            layout(local_size_x=64) in;
+            layout(set=0, binding=0) uniform accelerationStructureEXT tlas;
+            void main() {
+                for (int i = 0; i < 8; ++i) {
+                    rayQueryEXT query;
+                    const vec3 origin = vec3(float(gl_GlobalInvocationID.x), float(i), 0.0);
+                    rayQueryInitializeEXT(query, tlas, gl_RayFlagsOpaqueEXT, 0xff, origin, 0.1, vec3(0, 0, 1), 1000.0);
+                    while (rayQueryProceedEXT(query)) {}
+                }
+            }
+        )glsl";
+        CreateComputePipelineHelper pipe(*this);
+        pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+        pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+        pipe.CreateComputePipeline();
+
+        vkt::as::BuildGeometryInfoKHR tlas =
+            vkt::as::blueprint::BuildOnDeviceTopLevel(*m_device, *m_default_queue, m_command_buffer);
+        pipe.descriptor_set_->WriteDescriptorAccelStruct(0, 1, &tlas.GetDstAS()->handle());
+        pipe.descriptor_set_->UpdateDescriptorSets();
+
+        measurement = MeasureGpuAV([&]() {
+            vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+            vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(),
+                                      0, 1, &pipe.descriptor_set_->set_, 0, nullptr);
+            for (uint32_t i = 0; i < kDispatchCount; ++i) {
+                vk::CmdDispatch(m_command_buffer.handle(), 16, 1, 1);
+            }
+        });
+    }
+    WriteGpuAVResult("RayQuery/dispatches=" + std::to_string(kDispatchCount), measurement);
+}
+
+TEST_P(VkGpuAVBenchmarkTest, CopyBufferToImage) {
+    TEST_DESCRIPTION("Copies of depth values into a D32 image, which GPU-AV checks on the GPU");
+    RETURN_IF_SKIP(InitGpuAVBenchmark());
+    constexpr uint32_t kCopyCount = 16;
+    constexpr uint32_t kImageSize = 256;
+    const VkFormat format = VK_FORMAT_D32_SFLOAT;
+    if (!FormatFeaturesAreSupported(Gpu(), format, VK_IMAGE_TILING_OPTIMAL, VK_FORMAT_FEATURE_TRANSFER_DST_BIT)) {
+        GTEST_SKIP() << "D32 images can't be copied to";
+    }
+    GpuAVMeasurement measurement;
+    {
+        vkt::Buffer buffer(*m_device, kImageSize * kImageSize * sizeof(float), VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+        vkt::Image image(*m_device, kImageSize, kImageSize, 1, format, VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+        image.SetLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+        VkBufferImageCopy region = {};
+        region.imageSubresource = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 0, 1};
+        region.imageExtent = {kImageSize, kImageSize, 1};
+
+        VkImageMemoryBarrier barrier = vku::InitStructHelper();
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image.handle();
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, 1};
+
+        measurement = MeasureGpuAV([&]() {
+            for (uint32_t i = 0; i < kCopyCount; ++i) {
+                vk::CmdCopyBufferToImage(m_command_buffer.handle(), buffer.handle(), image.handle(),
+                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+                vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                                       0, nullptr, 0, nullptr, 1, &barrier);
+            }
+        });
+    }
+    WriteGpuAVResult("CopyBufferToImage/copies=" + std::to_string(kCopyCount), measurement);
+}
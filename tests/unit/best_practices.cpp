@@ -493,6 +493,78 @@ TEST_F(VkBestPracticesLayerTest, SmallAllocation) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkBestPracticesLayerTest, AggregatedReport) {
+    TEST_DESCRIPTION("Count the performance warnings and report them once when the device is destroyed");
+
+    const uint32_t interval = 1000;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "best_practices_report_interval", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                       &interval};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    features_.pNext = &layer_settings_create_info;
+    RETURN_IF_SKIP(InitFramework(&features_));
+
+    VkDeviceQueueCreateInfo qci = vku::InitStructHelper();
+    qci.queueFamilyIndex = 0;
+    float priority = 1;
+    qci.pQueuePriorities = &priority;
+    qci.queueCount = 1;
+
+    VkDeviceCreateInfo dev_info = vku::InitStructHelper();
+    dev_info.queueCreateInfoCount = 1;
+    dev_info.pQueueCreateInfos = &qci;
+
+    m_errorMonitor->SetAllowedFailureMsg("BestPractices-vkCreateDevice-API-version-mismatch");
+    VkDevice device = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, vk::CreateDevice(Gpu(), &dev_info, nullptr, &device));
+
+    VkMemoryAllocateInfo alloc_info = vku::InitStructHelper();
+    alloc_info.allocationSize = 1024;
+    alloc_info.memoryTypeIndex = 0;
+
+    // Counted, nothing is logged until the report
+    VkDeviceMemory memory[3];
+    for (uint32_t i = 0; i < 3; i++) {
+        vk::AllocateMemory(device, &alloc_info, nullptr, &memory[i]);
+    }
+    for (uint32_t i = 0; i < 3; i++) {
+        vk::FreeMemory(device, memory[i], nullptr);
+    }
+
+    m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit, "Reported 3 times since the last report");
+    vk::DestroyDevice(device, nullptr);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkBestPracticesLayerTest, GpuTimingHotSpots) {
+    TEST_DESCRIPTION("Time a render pass and report it when the device is destroyed");
+
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "best_practices_gpu_timing", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    features_.pNext = &layer_settings_create_info;
+    RETURN_IF_SKIP(InitFramework(&features_));
+    RETURN_IF_SKIP(InitState());
+    if (m_device->Physical().queue_properties_[m_device->graphics_queue_node_index_].timestampValidBits == 0) {
+        GTEST_SKIP() << "Graphics queue does not support timestamps";
+    }
+    InitRenderTarget();
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+
+    // Freeing the command buffer reads back its timestamps
+    m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit, "BestPractices-GpuTiming-HotSpots");
+    ShutdownFramework();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkBestPracticesLayerTest, SmallDedicatedAllocation) {
     TEST_DESCRIPTION("Test for small dedicated memory allocations");
 
@@ -2092,6 +2164,55 @@ TEST_F(VkBestPracticesLayerTest, PartialPushConstantSetMiddle) {
     m_command_buffer.End();
 }
 
+TEST_F(VkBestPracticesLayerTest, PartialPushConstantSetRepeatedly) {
+    TEST_DESCRIPTION("Set the same part of push constants before each draw");
+
+    RETURN_IF_SKIP(InitBestPracticesFramework());
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    char const *const vsSource = R"glsl(
+        #version 450
+        layout(push_constant, std430) uniform foo { uint x[2]; } constants;
+        void main(){
+           gl_Position = vec4(constants.x[0] * constants.x[1]);
+        }
+    )glsl";
+
+    VkShaderObj const vs(this, vsSource, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj const fs(this, kFragmentMinimalGlsl, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    uint32_t data[2] = {1u, 2u};
+    VkPushConstantRange push_constant_range = {VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(data)};
+
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {}, {push_constant_range});
+    pipe.CreateGraphicsPipeline();
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    // Setting the first value twice is not the same as setting both
+    for (uint32_t i = 0; i < 2; ++i) {
+        vk::CmdPushConstants(m_command_buffer.handle(), pipe.pipeline_layout_.handle(), VK_SHADER_STAGE_VERTEX_BIT, 0,
+                             sizeof(uint32_t), data);
+        m_errorMonitor->SetDesiredWarning("BestPractices-PushConstants");
+        vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+        m_errorMonitor->VerifyFound();
+    }
+
+    vk::CmdPushConstants(m_command_buffer.handle(), pipe.pipeline_layout_.handle(), VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(data),
+                         data);
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+    vk::CmdPushConstants(m_command_buffer.handle(), pipe.pipeline_layout_.handle(), VK_SHADER_STAGE_VERTEX_BIT, 0,
+                         sizeof(uint32_t), data);
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+}
+
 // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/7495
 TEST_F(VkBestPracticesLayerTest, IgnoreResolveImageView) {
     TEST_DESCRIPTION("Help warn user when they might have resolveMode set to NONE by accident");
@@ -532,6 +532,44 @@ TEST_F(NegativeDebugPrintf, FloatMix) {
     BasicComputeTest(shader_source, "3.332031 3.333333 3.333333 3.333333");
 }
 
+TEST_F(NegativeDebugPrintf, FloatMixSameFormatString) {
+    TEST_DESCRIPTION("The same format string is printed with a double and then a float");
+    AddRequiredFeature(vkt::Feature::shaderFloat64);
+    RETURN_IF_SKIP(InitDebugPrintfFramework());
+    RETURN_IF_SKIP(InitState());
+
+    char const *shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_debug_printf : enable
+        #extension GL_EXT_shader_explicit_arithmetic_types_float64 : enable
+        layout(local_size_x = 2, local_size_y = 1, local_size_z = 1) in;
+        void main() {
+            if (gl_LocalInvocationIndex == 0) {
+                float64_t a = float64_t(2.5);
+                debugPrintfEXT("value %f next %f", a, 1.5f);
+            } else {
+                float b = 4.5;
+                debugPrintfEXT("value %f next %f", b, 1.5f);
+            }
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, shader_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+    m_command_buffer.End();
+
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "value 2.500000 next 1.500000");
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "value 4.500000 next 1.500000");
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeDebugPrintf, Float16) {
     AddRequiredExtensions(VK_KHR_SHADER_FLOAT16_INT8_EXTENSION_NAME);
     AddRequiredFeature(vkt::Feature::shaderFloat16);
@@ -2875,6 +2913,43 @@ TEST_F(NegativeDebugPrintf, OverflowBuffer) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDebugPrintf, OverflowBufferGrows) {
+    TEST_DESCRIPTION("After going over the VK_LAYER_PRINTF_BUFFER_SIZE limit, the next recording has room for all the messages");
+    RETURN_IF_SKIP(InitDebugPrintfFramework());
+    RETURN_IF_SKIP(InitState());
+
+    char const *shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_debug_printf : enable
+        layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+        void main() {
+            debugPrintfEXT("WorkGroup %v3u | Invocation %v3u\n", gl_WorkGroupID, gl_LocalInvocationID);
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, shader_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdDispatch(m_command_buffer.handle(), 4, 4, 1);
+    m_command_buffer.End();
+
+    m_errorMonitor->SetDesiredWarning("Command buffers recorded from now on will use a buffer size of");
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdDispatch(m_command_buffer.handle(), 4, 4, 1);
+    m_command_buffer.End();
+
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeDebugPrintf, OverflowBufferLoop) {
     TEST_DESCRIPTION("go over the default VK_LAYER_PRINTF_BUFFER_SIZE limit... by a LOT");
     RETURN_IF_SKIP(InitDebugPrintfFramework());
@@ -943,6 +943,48 @@ TEST_F(NegativeDescriptorBuffer, InconsistentBuffer) {
     m_command_buffer.End();
 }
 
+TEST_F(NegativeDescriptorBuffer, InconsistentBufferAfterValidDispatch) {
+    TEST_DESCRIPTION("Set descriptor buffer offsets after a valid dispatch, and again with the same bindings");
+    AddRequiredExtensions(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    RETURN_IF_SKIP(InitBasicDescriptorBuffer());
+
+    const VkDescriptorSetLayoutBinding binding{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+    const vkt::DescriptorSetLayout dsl(*m_device, {binding}, VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT);
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&dsl});
+
+    vkt::Buffer buffer(*m_device, 4096, VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT, vkt::device_address);
+
+    VkDescriptorBufferBindingInfoEXT dbbi = vku::InitStructHelper();
+    dbbi.address = buffer.Address();
+    dbbi.usage = VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorBuffersEXT(m_command_buffer.handle(), 1, &dbbi);
+    vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+
+    uint32_t index = 0;
+    VkDeviceSize offset = 0;
+    vk::CmdSetDescriptorBufferOffsetsEXT(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                                         &index, &offset);
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-None-08117");
+    vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+
+    // Same sets at the same offsets
+    vk::CmdSetDescriptorBufferOffsetsEXT(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                                         &index, &offset);
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-None-08117");
+    vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeDescriptorBuffer, InconsistentSet) {
     TEST_DESCRIPTION("Dispatch pipeline with descriptor buffer bound while of descriptor set expected");
     AddRequiredExtensions(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
@@ -1446,6 +1488,42 @@ TEST_F(NegativeDescriptorBuffer, DescriptorGetInfo) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDescriptorBuffer, DescriptorGetInfoDestroyedBuffer) {
+    TEST_DESCRIPTION("The address of a destroyed buffer is not an address within a buffer anymore.");
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    RETURN_IF_SKIP(InitBasicDescriptorBuffer());
+
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT descriptor_buffer_properties = vku::InitStructHelper();
+    GetPhysicalDeviceProperties2(descriptor_buffer_properties);
+
+    vkt::Buffer other_buffer(*m_device, 256, 0, vkt::device_address);
+    vkt::Buffer buffer(*m_device, 256, 0, vkt::device_address);
+
+    VkDescriptorAddressInfoEXT dai = vku::InitStructHelper();
+    dai.address = buffer.Address();
+    dai.range = 16;
+    dai.format = VK_FORMAT_UNDEFINED;
+
+    VkDescriptorGetInfoEXT dgi = vku::InitStructHelper();
+    dgi.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    dgi.data.pStorageBuffer = &dai;
+    uint8_t descriptor[256];
+    vk::GetDescriptorEXT(device(), &dgi, descriptor_buffer_properties.storageBufferDescriptorSize, &descriptor);
+
+    // Asking for the address again does not change anything
+    ASSERT_EQ(dai.address, buffer.Address());
+    vk::GetDescriptorEXT(device(), &dgi, descriptor_buffer_properties.storageBufferDescriptorSize, &descriptor);
+
+    buffer.destroy();
+    m_errorMonitor->SetDesiredError("VUID-VkDescriptorAddressInfoEXT-None-08044");
+    m_errorMonitor->SetDesiredError("VUID-VkDescriptorGetInfoEXT-type-08027");
+    vk::GetDescriptorEXT(device(), &dgi, descriptor_buffer_properties.storageBufferDescriptorSize, &descriptor);
+    m_errorMonitor->VerifyFound();
+
+    dai.address = other_buffer.Address();
+    vk::GetDescriptorEXT(device(), &dgi, descriptor_buffer_properties.storageBufferDescriptorSize, &descriptor);
+}
+
 TEST_F(NegativeDescriptorBuffer, ExtensionCombination) {
     TEST_DESCRIPTION("Descriptor invalid extension combination.");
     SetTargetApiVersion(VK_API_VERSION_1_2);
@@ -506,6 +506,49 @@ TEST_F(NegativeDescriptors, CmdBufferDescriptorSetBufferDestroyed) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDescriptors, CmdBufferDescriptorSetRewrittenBufferDestroyed) {
+    TEST_DESCRIPTION("Rewrite a descriptor with the buffer it already holds, then destroy the buffer before submitting.");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    {
+        vkt::Buffer buffer(*m_device, 1024, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+        char const *fsSource = R"glsl(
+            #version 450
+            layout(location=0) out vec4 x;
+            layout(set=0) layout(binding=0) uniform foo { int x; int y; } bar;
+            void main(){
+               x = vec4(bar.y);
+            }
+        )glsl";
+        VkShaderObj fs(this, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+        pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+        pipe.CreateGraphicsPipeline();
+
+        pipe.descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 0, 1024);
+        pipe.descriptor_set_->UpdateDescriptorSets();
+        // Same buffer again, the set must still be invalidated when the buffer goes away
+        pipe.descriptor_set_->Clear();
+        pipe.descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 0, 512);
+        pipe.descriptor_set_->UpdateDescriptorSets();
+
+        m_command_buffer.Begin();
+        m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+        vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                                  &pipe.descriptor_set_->set_, 0, NULL);
+        vk::CmdDraw(m_command_buffer.handle(), 1, 0, 0, 0);
+        m_command_buffer.EndRenderPass();
+        m_command_buffer.End();
+    }
+
+    m_errorMonitor->SetDesiredError("VUID-vkQueueSubmit-pCommandBuffers-00070");
+    m_default_queue->Submit(m_command_buffer);
+    m_errorMonitor->VerifyFound();
+}
+
 // This is similar to the CmdBufferDescriptorSetBufferDestroyed test above except that the buffer
 // is destroyed before recording the Draw cmd.
 TEST_F(NegativeDescriptors, DrawDescriptorSetBufferDestroyed) {
@@ -550,6 +593,49 @@ TEST_F(NegativeDescriptors, DrawDescriptorSetBufferDestroyed) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDescriptors, DrawDescriptorArrayBufferDestroyedAfterRepeatedBuffer) {
+    TEST_DESCRIPTION("Descriptor array with the same buffer in most elements and a destroyed buffer in the last one.");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    vkt::Buffer buffer(*m_device, 1024, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+    char const *fsSource = R"glsl(
+        #version 450
+        layout(location=0) out vec4 x;
+        layout(set=0) layout(binding=0) uniform foo { int x; } bar[4];
+        void main(){
+           x = vec4(bar[0].x + bar[1].x + bar[2].x + bar[3].x);
+        }
+    )glsl";
+    VkShaderObj fs(this, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 4, VK_SHADER_STAGE_ALL, nullptr}};
+    pipe.CreateGraphicsPipeline();
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        pipe.descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 0, 1024, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, i);
+    }
+    {
+        vkt::Buffer destroyed_buffer(*m_device, 1024, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+        pipe.descriptor_set_->WriteDescriptorBufferInfo(0, destroyed_buffer.handle(), 0, 1024, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                                                        3);
+        pipe.descriptor_set_->UpdateDescriptorSets();
+    }
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, NULL);
+
+    m_errorMonitor->SetDesiredError("Index 3");
+    vk::CmdDraw(m_command_buffer.handle(), 1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeDescriptors, CmdBufferDescriptorSetImageSamplerDestroyed) {
     TEST_DESCRIPTION(
         "Attempt to draw with a command buffer that is invalid due to a bound descriptor sets with a combined image sampler having "
@@ -817,6 +903,63 @@ TEST_F(NegativeDescriptors, DescriptorSetSamplerDestroyed) {
     m_command_buffer.End();
 }
 
+TEST_F(NegativeDescriptors, DescriptorSetSamplerDestroyedAlternatingSets) {
+    TEST_DESCRIPTION("Switch between a valid set and a set with a destroyed sampler, every draw with the bad set has to report it.");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    const std::vector<VkDescriptorSetLayoutBinding> bindings = {
+        {0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_ALL, nullptr}};
+    OneOffDescriptorSet good_set(m_device, bindings);
+    OneOffDescriptorSet bad_set(m_device, bindings);
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&good_set.layout_});
+
+    vkt::Image image(*m_device, 32, 32, 1, VK_FORMAT_B8G8R8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT);
+    image.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+    vkt::ImageView view = image.CreateView();
+    VkSamplerCreateInfo sampler_ci = SafeSaneSamplerCreateInfo();
+    vkt::Sampler sampler(*m_device, sampler_ci);
+    vkt::Sampler bad_sampler(*m_device, sampler_ci);
+
+    good_set.WriteDescriptorImageInfo(0, view, sampler);
+    good_set.UpdateDescriptorSets();
+    bad_set.WriteDescriptorImageInfo(0, view, bad_sampler);
+    bad_set.UpdateDescriptorSets();
+    bad_sampler.destroy();
+
+    char const *fsSource = R"glsl(
+        #version 450
+        layout(set=0, binding=0) uniform sampler2D s;
+        layout(location=0) out vec4 x;
+        void main(){
+           x = texture(s, vec2(1));
+        }
+    )glsl";
+    VkShaderObj fs(this, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_[1] = fs.GetStageCreateInfo();
+    pipe.gp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateGraphicsPipeline();
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    for (uint32_t i = 0; i < 2; ++i) {
+        vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                  &good_set.set_, 0, nullptr);
+        vk::CmdDraw(m_command_buffer.handle(), 1, 0, 0, 0);
+
+        vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                  &bad_set.set_, 0, nullptr);
+        m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-08114");
+        vk::CmdDraw(m_command_buffer.handle(), 1, 0, 0, 0);
+        m_errorMonitor->VerifyFound();
+    }
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeDescriptors, ImageDescriptorLayoutMismatch) {
     TEST_DESCRIPTION("Create an image sampler layout->image layout mismatch within/without a command buffer");
 
@@ -2057,6 +2200,25 @@ TEST_F(NegativeDescriptors, DSUpdateIndex) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDescriptors, DSUpdateIndexSparseBindings) {
+    TEST_DESCRIPTION("Update a binding missing from a layout whose binding numbers are far apart");
+    RETURN_IF_SKIP(Init());
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                                     {1000, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+    vkt::Buffer buffer(*m_device, 32, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer, 0, VK_WHOLE_SIZE);
+    descriptor_set.WriteDescriptorBufferInfo(1000, buffer, 0, VK_WHOLE_SIZE);
+    descriptor_set.UpdateDescriptorSets();
+
+    descriptor_set.Clear();
+    descriptor_set.WriteDescriptorBufferInfo(500, buffer, 0, VK_WHOLE_SIZE);
+    m_errorMonitor->SetDesiredError("VUID-VkWriteDescriptorSet-dstBinding-00315");
+    descriptor_set.UpdateDescriptorSets();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeDescriptors, DSUpdateEmptyBinding) {
     TEST_DESCRIPTION("Create layout w/ empty binding and attempt to update it");
     RETURN_IF_SKIP(Init());
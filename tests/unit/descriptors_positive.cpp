@@ -465,6 +465,43 @@ TEST_F(PositiveDescriptors, CopyMutableDescriptors) {
     vk::UpdateDescriptorSets(device(), 0, nullptr, 1, &copy_set);
 }
 
+TEST_F(PositiveDescriptors, RewriteMutableDescriptorType) {
+    TEST_DESCRIPTION("Rewrite a mutable descriptor with another type, the old buffer is no longer used by the set.");
+    AddRequiredExtensions(VK_EXT_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::mutableDescriptorType);
+    RETURN_IF_SKIP(Init());
+
+    VkDescriptorType descriptor_types[] = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER};
+    VkMutableDescriptorTypeListEXT mutable_descriptor_type_list = {2, descriptor_types};
+    VkMutableDescriptorTypeCreateInfoEXT mdtci = vku::InitStructHelper();
+    mdtci.mutableDescriptorTypeListCount = 1;
+    mdtci.pMutableDescriptorTypeLists = &mutable_descriptor_type_list;
+
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_MUTABLE_EXT, 1, VK_SHADER_STAGE_ALL, nullptr}}, 0,
+                                       &mdtci, 0, nullptr, &mdtci);
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    vkt::Buffer uniform_buffer(*m_device, 32, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    descriptor_set.WriteDescriptorBufferInfo(0, uniform_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    vkt::Buffer texel_buffer(*m_device, 32, VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT);
+    vkt::BufferView buffer_view(*m_device, vkt::BufferView::CreateInfo(texel_buffer.handle(), VK_FORMAT_R8_UNORM));
+    descriptor_set.Clear();
+    descriptor_set.WriteDescriptorBufferView(0, buffer_view.handle(), VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    m_command_buffer.Begin();
+    vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    m_command_buffer.End();
+
+    // The set only holds the buffer view now, destroying the first buffer must not invalidate the command buffer
+    uniform_buffer.destroy();
+    m_default_queue->Submit(m_command_buffer);
+    m_device->Wait();
+}
+
 TEST_F(PositiveDescriptors, CopyAccelerationStructureMutableDescriptors) {
     TEST_DESCRIPTION("Copy acceleration structure descriptor in a mutable descriptor.");
 
@@ -1189,3 +1226,56 @@ TEST_F(PositiveDescriptors, ImageSubresourceOverlapBetweenRenderPassAndDescripto
     m_command_buffer.EndRenderPass();
     m_command_buffer.End();
 }
+
+TEST_F(PositiveDescriptors, UpdateDescriptorSetsMixedTypesAndCopies) {
+    TEST_DESCRIPTION("Update image, buffer and texel buffer descriptors and copy them in a single vkUpdateDescriptorSets call");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Image image(*m_device, 32, 32, 1, VK_FORMAT_B8G8R8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT);
+    vkt::ImageView image_view = image.CreateView();
+    vkt::Sampler sampler(*m_device, SafeSaneSamplerCreateInfo());
+    vkt::Buffer uniform_buffer(*m_device, 1024, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    vkt::Buffer texel_buffer(*m_device, 1024, VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT);
+    VkBufferViewCreateInfo buffer_view_ci = vku::InitStructHelper();
+    buffer_view_ci.buffer = texel_buffer.handle();
+    buffer_view_ci.format = VK_FORMAT_R8_UNORM;
+    buffer_view_ci.range = VK_WHOLE_SIZE;
+    vkt::BufferView buffer_view(*m_device, buffer_view_ci);
+
+    const OneOffDescriptorSet::Bindings bindings = {
+        {0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 2, VK_SHADER_STAGE_ALL, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+        {2, VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+    };
+    OneOffDescriptorSet src_set(m_device, bindings);
+    OneOffDescriptorSet dst_set(m_device, bindings);
+
+    src_set.WriteDescriptorImageInfo(0, image_view.handle(), sampler.handle(), VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0);
+    src_set.WriteDescriptorImageInfo(0, image_view.handle(), sampler.handle(), VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 1);
+    src_set.WriteDescriptorBufferInfo(1, uniform_buffer.handle(), 0, VK_WHOLE_SIZE);
+    src_set.WriteDescriptorBufferView(2, buffer_view.handle(), VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER);
+    src_set.UpdateDescriptorSets();
+
+    VkCopyDescriptorSet copies[3];
+    for (uint32_t i = 0; i < 3; ++i) {
+        copies[i] = vku::InitStructHelper();
+        copies[i].srcSet = src_set.set_;
+        copies[i].srcBinding = i;
+        copies[i].dstSet = dst_set.set_;
+        copies[i].dstBinding = i;
+        copies[i].descriptorCount = i == 0 ? 2 : 1;
+    }
+    vk::UpdateDescriptorSets(device(), 0, nullptr, 3, copies);
+
+    // Written again together with copies in the same call
+    VkDescriptorBufferInfo buffer_info = {uniform_buffer.handle(), 0, 256};
+    VkWriteDescriptorSet write = vku::InitStructHelper();
+    write.dstSet = dst_set.set_;
+    write.dstBinding = 1;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    write.pBufferInfo = &buffer_info;
+    vk::UpdateDescriptorSets(device(), 1, &write, 1, &copies[0]);
+}
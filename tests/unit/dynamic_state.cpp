@@ -69,6 +69,46 @@ TEST_F(NegativeDynamicState, LineWidthNotBound) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDynamicState, LineWidthNotBoundRepeatedDraws) {
+    TEST_DESCRIPTION("Draw time validation is skipped when nothing changed since the last draw, make sure errors still show up.");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.AddDynamicState(VK_DYNAMIC_STATE_LINE_WIDTH);
+    pipe.ia_ci_.topology = VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+    pipe.CreateGraphicsPipeline();
+
+    CreatePipelineHelper depth_bias_pipe(*this);
+    depth_bias_pipe.AddDynamicState(VK_DYNAMIC_STATE_DEPTH_BIAS);
+    depth_bias_pipe.rs_state_ci_.lineWidth = 1.0f;
+    depth_bias_pipe.rs_state_ci_.depthBiasEnable = VK_TRUE;
+    depth_bias_pipe.CreateGraphicsPipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-07833");
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-07833");
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    vk::CmdSetLineWidth(m_command_buffer.handle(), 1.0f);
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, depth_bias_pipe.Handle());
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-07834");
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeDynamicState, LineStippleNotBound) {
     TEST_DESCRIPTION(
         "Run a simple draw calls to validate failure when Line Stipple dynamic state is required but not correctly bound.");
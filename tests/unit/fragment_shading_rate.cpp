@@ -1152,6 +1152,56 @@ TEST_F(NegativeFragmentShadingRate, LoadOpClear) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeFragmentShadingRate, AttachmentAlsoUsedAsColor) {
+    TEST_DESCRIPTION("Use an attachment as a fragment shading rate attachment and as a color attachment of another subpass");
+    AddRequiredExtensions(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME);
+    AddRequiredExtensions(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::attachmentFragmentShadingRate);
+    RETURN_IF_SKIP(Init());
+
+    VkPhysicalDeviceFragmentShadingRatePropertiesKHR fsr_properties = vku::InitStructHelper();
+    GetPhysicalDeviceProperties2(fsr_properties);
+
+    VkAttachmentReference2 fsr_attach = vku::InitStructHelper();
+    fsr_attach.layout = VK_IMAGE_LAYOUT_GENERAL;
+    fsr_attach.attachment = 0;
+
+    VkAttachmentReference2 color_attach = vku::InitStructHelper();
+    color_attach.layout = VK_IMAGE_LAYOUT_GENERAL;
+    color_attach.attachment = 0;
+
+    VkFragmentShadingRateAttachmentInfoKHR fsr_attachment = vku::InitStructHelper();
+    fsr_attachment.shadingRateAttachmentTexelSize = fsr_properties.minFragmentShadingRateAttachmentTexelSize;
+    fsr_attachment.pFragmentShadingRateAttachment = &fsr_attach;
+
+    VkSubpassDescription2 subpasses[2];
+    subpasses[0] = vku::InitStructHelper();
+    subpasses[0].colorAttachmentCount = 1;
+    subpasses[0].pColorAttachments = &color_attach;
+    subpasses[1] = vku::InitStructHelper(&fsr_attachment);
+
+    // The other attachments are not used, the checks must only report the uses of attachment 0
+    VkAttachmentDescription2 attach_descs[4];
+    for (auto &attach_desc : attach_descs) {
+        attach_desc = vku::InitStructHelper();
+        attach_desc.format = VK_FORMAT_R8_UINT;
+        attach_desc.samples = VK_SAMPLE_COUNT_1_BIT;
+        attach_desc.initialLayout = VK_IMAGE_LAYOUT_GENERAL;
+        attach_desc.finalLayout = VK_IMAGE_LAYOUT_GENERAL;
+    }
+
+    VkRenderPassCreateInfo2 rpci = vku::InitStructHelper();
+    rpci.subpassCount = 2;
+    rpci.pSubpasses = subpasses;
+    rpci.attachmentCount = 4;
+    rpci.pAttachments = attach_descs;
+
+    m_errorMonitor->SetDesiredError("VUID-VkRenderPassCreateInfo2-pAttachments-04585");
+    VkRenderPass rp;
+    vk::CreateRenderPass2KHR(device(), &rpci, NULL, &rp);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeFragmentShadingRate, IncompatibleFragmentRateShadingAttachmentInExecuteCommands) {
     TEST_DESCRIPTION(
         "Test incompatible fragment shading rate attachments "
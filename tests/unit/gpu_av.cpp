@@ -145,6 +145,279 @@ TEST_F(NegativeGpuAV, SelectInstrumentedShaders) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeGpuAV, ParallelShaderInstrumentation) {
+    TEST_DESCRIPTION("Shaders of a single vkCreateComputePipelines call are instrumented together");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    RETURN_IF_SKIP(InitGpuAvFramework());
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer write_buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, kHostVisibleMemProps);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *in_bounds_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+            Data.data[0] = 1;
+        }
+    )glsl";
+    const char *out_of_bounds_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+            Data.data[8] = 2;
+        }
+    )glsl";
+    VkShaderObj in_bounds_cs(this, in_bounds_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+    VkShaderObj out_of_bounds_cs(this, out_of_bounds_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+
+    VkComputePipelineCreateInfo pipeline_cis[3];
+    for (auto &pipeline_ci : pipeline_cis) {
+        pipeline_ci = vku::InitStructHelper();
+        pipeline_ci.layout = pipeline_layout.handle();
+    }
+    pipeline_cis[0].stage = in_bounds_cs.GetStageCreateInfo();
+    pipeline_cis[1].stage = out_of_bounds_cs.GetStageCreateInfo();
+    // Same shader twice in the batch
+    pipeline_cis[2].stage = out_of_bounds_cs.GetStageCreateInfo();
+    VkPipeline pipelines[3];
+    ASSERT_EQ(VK_SUCCESS, vk::CreateComputePipelines(device(), VK_NULL_HANDLE, 3, pipeline_cis, nullptr, pipelines));
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        m_command_buffer.Begin();
+        vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipelines[i]);
+        vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+        m_command_buffer.End();
+
+        if (i != 0) {
+            m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-storageBuffers-06936");
+        }
+        m_default_queue->Submit(m_command_buffer);
+        m_default_queue->Wait();
+        if (i != 0) {
+            m_errorMonitor->VerifyFound();
+        }
+    }
+
+    for (VkPipeline pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
+
+TEST_F(NegativeGpuAV, ParallelPostProcessing) {
+    TEST_DESCRIPTION("Errors of all the command buffers of a submission are reported when they are post processed together");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    RETURN_IF_SKIP(InitGpuAvFramework());
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer write_buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, kHostVisibleMemProps);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+            Data.data[8] = 2;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.cp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateComputePipeline();
+
+    std::vector<vkt::CommandBuffer> command_buffers;
+    std::vector<VkCommandBuffer> command_buffer_handles;
+    for (uint32_t i = 0; i < 8; ++i) {
+        vkt::CommandBuffer &command_buffer = command_buffers.emplace_back(*m_device, m_command_pool);
+        command_buffer.Begin();
+        vk::CmdBindPipeline(command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+        vk::CmdBindDescriptorSets(command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        vk::CmdDispatch(command_buffer.handle(), 1, 1, 1);
+        command_buffer.End();
+    }
+    for (const vkt::CommandBuffer &command_buffer : command_buffers) {
+        command_buffer_handles.emplace_back(command_buffer.handle());
+    }
+
+    VkSubmitInfo submit_info = vku::InitStructHelper();
+    submit_info.commandBufferCount = static_cast<uint32_t>(command_buffer_handles.size());
+    submit_info.pCommandBuffers = command_buffer_handles.data();
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-storageBuffers-06936", 8);
+    vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeGpuAV, LazyShaderInstrumentation) {
+    TEST_DESCRIPTION("Pipelines are instrumented on first bind, an unbound pipeline is never instrumented");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_lazy_shader_instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer write_buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, kHostVisibleMemProps);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+            Data.data[8] = 2;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper unused_pipe(*this);
+    unused_pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    unused_pipe.cp_ci_.layout = pipeline_layout.handle();
+    unused_pipe.CreateComputePipeline();
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.cp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateComputePipeline();
+
+    // Bound twice, the second bind reuses the pipeline created by the first one
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_command_buffer.Begin();
+        vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+        vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+        m_command_buffer.End();
+
+        m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-storageBuffers-06936");
+        m_default_queue->Submit(m_command_buffer);
+        m_default_queue->Wait();
+        m_errorMonitor->VerifyFound();
+    }
+}
+
+TEST_F(NegativeGpuAV, LazyShaderInstrumentationDestroyedShaderModules) {
+    TEST_DESCRIPTION("The shader modules of a lazily instrumented pipeline are destroyed before its first bind");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::robustBufferAccess);
+    const VkBool32 value = true;
+    // Only the vertex shader is selected, the fragment shader stage keeps the module of the app
+    const VkLayerSettingEXT settings[2] = {
+        {OBJECT_LAYER_NAME, "gpuav_lazy_shader_instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value},
+        {OBJECT_LAYER_NAME, "gpuav_select_instrumented_shaders", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value}};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 2,
+                                                               settings};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    vkt::Buffer write_buffer(*m_device, 4, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, kHostVisibleMemProps);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *vs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+            Data.data[4] = 0xdeadca71;
+        }
+    )glsl";
+    VkValidationFeatureEnableEXT enabled[] = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT};
+    VkValidationFeaturesEXT features = vku::InitStructHelper();
+    features.enabledValidationFeatureCount = 1;
+    features.pEnabledValidationFeatures = enabled;
+    VkShaderObj vs(this, vs_source, VK_SHADER_STAGE_VERTEX_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_GLSL, nullptr, "main", &features);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), pipe.fs_->GetStageCreateInfo()};
+    pipe.gp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateGraphicsPipeline();
+    vs.destroy();
+    pipe.fs_->destroy();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+
+    // The pipeline is still created and instrumented, no warning that it can't be
+    m_errorMonitor->ExpectSuccess(kWarningBit | kErrorBit);
+    m_errorMonitor->SetDesiredWarning("VUID-vkCmdDraw-storageBuffers-06936", 3);
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeGpuAV, UninstrumentCleanPipelines) {
+    TEST_DESCRIPTION("A lazily instrumented pipeline is not instrumented anymore after running cleanly");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    const VkBool32 lazy = true;
+    const uint32_t clean_count = 1;
+    const VkLayerSettingEXT settings[2] = {
+        {OBJECT_LAYER_NAME, "gpuav_lazy_shader_instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &lazy},
+        {OBJECT_LAYER_NAME, "gpuav_uninstrument_clean_pipelines_count", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &clean_count}};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 2,
+                                                               settings};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer write_buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, kHostVisibleMemProps);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+            Data.data[Data.data[0]] = 2;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.cp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateComputePipeline();
+
+    // The first submission indexes in bounds, the out of bounds index of the second one isn't found as the pipeline
+    // already ran cleanly once
+    for (uint32_t index : {1u, 8u}) {
+        auto data = static_cast<uint32_t *>(write_buffer.Memory().Map());
+        data[0] = index;
+        write_buffer.Memory().Unmap();
+
+        m_command_buffer.Begin();
+        vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+        vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+        m_command_buffer.End();
+
+        m_default_queue->Submit(m_command_buffer);
+        m_default_queue->Wait();
+    }
+}
+
 TEST_F(NegativeGpuAV, UseAllDescriptorSlotsPipelineNotReserved) {
     TEST_DESCRIPTION("Don't reserve a descriptor slot and proceed to use them all so GPU-AV can't");
     SetTargetApiVersion(VK_API_VERSION_1_2);
@@ -985,6 +1258,64 @@ TEST_F(NegativeGpuAV, CopyBufferToImageD32) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeGpuAV, CopyBufferToImageD32BackToBack) {
+    TEST_DESCRIPTION("Copies recorded back to back share a validation dispatch, one out of range depth value is still reported.");
+
+    AddRequiredExtensions(VK_KHR_8BIT_STORAGE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::uniformAndStorageBuffer8BitAccess);
+
+    RETURN_IF_SKIP(InitGpuAvFramework());
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer copy_src_buffer(*m_device, sizeof(float) * 64 * 64,
+                                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, kHostVisibleMemProps);
+
+    float *ptr = static_cast<float *>(copy_src_buffer.Memory().Map());
+    for (size_t i = 0; i < 64 * 64; ++i) {
+        ptr[i] = 0.1f;
+    }
+    ptr[4094] = 42.0f;
+    copy_src_buffer.Memory().Unmap();
+
+    vkt::Image copy_dst_image(*m_device, 64, 64, 1, VK_FORMAT_D32_SFLOAT,
+                              VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    copy_dst_image.SetLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    m_command_buffer.Begin();
+
+    VkBufferImageCopy buffer_image_copy;
+    buffer_image_copy.bufferOffset = 0;
+    buffer_image_copy.bufferRowLength = 0;
+    buffer_image_copy.bufferImageHeight = 0;
+    buffer_image_copy.imageSubresource = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 0, 1};
+    buffer_image_copy.imageExtent = {16, 16, 1};
+    // Only the last block reads the texel at offset 16376
+    for (int32_t i = 0; i < 4; ++i) {
+        buffer_image_copy.imageOffset = {16 * i, 16 * i, 0};
+        vk::CmdCopyBufferToImage(m_command_buffer, copy_src_buffer, copy_dst_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+                                 &buffer_image_copy);
+    }
+
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                           nullptr, 0, nullptr);
+
+    // Validated by a dispatch of its own
+    buffer_image_copy.imageOffset = {0, 0, 0};
+    buffer_image_copy.imageExtent = {64, 64, 1};
+    vk::CmdCopyBufferToImage(m_command_buffer, copy_src_buffer, copy_dst_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+                             &buffer_image_copy);
+
+    m_command_buffer.End();
+    m_errorMonitor->SetDesiredError("has a float value at offset 16376 that is not in the range [0, 1]");
+    m_errorMonitor->SetDesiredError("has a float value at offset 16376 that is not in the range [0, 1]");
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeGpuAV, CopyBufferToImageD32Vk13) {
     TEST_DESCRIPTION(
         "Copy depth buffer to image with some of its depth value being outside of the [0, 1] legal range. Depth image has format "
@@ -721,6 +721,53 @@ TEST_F(PositiveGpuAV, SelectInstrumentedShaders) {
     m_default_queue->Wait();
 }
 
+TEST_F(PositiveGpuAV, OutputPoolBlockSizeAndMemoryReport) {
+    TEST_DESCRIPTION("Small VMA blocks for the output buffers and the device memory report at device destruction");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    const uint32_t block_size = 1;
+    const VkBool32 report = true;
+    const VkLayerSettingEXT settings[2] = {
+        {OBJECT_LAYER_NAME, "gpuav_vma_output_pool_block_size", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &block_size},
+        {OBJECT_LAYER_NAME, "gpuav_debug_print_memory_report", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &report}};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 2,
+                                                               settings};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer write_buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, kHostVisibleMemProps);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+            Data.data[1] = 2;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.cp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateComputePipeline();
+
+    // Several command buffers alive at the same time need several output buffers
+    std::vector<vkt::CommandBuffer> command_buffers;
+    for (uint32_t i = 0; i < 4; ++i) {
+        vkt::CommandBuffer &command_buffer = command_buffers.emplace_back(*m_device, m_command_pool);
+        command_buffer.Begin();
+        vk::CmdBindPipeline(command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+        vk::CmdBindDescriptorSets(command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        vk::CmdDispatch(command_buffer.handle(), 1, 1, 1);
+        command_buffer.End();
+        m_default_queue->Submit(command_buffer);
+    }
+    m_default_queue->Wait();
+}
+
 TEST_F(PositiveGpuAV, BindingPartiallyBound) {
     TEST_DESCRIPTION("Ensure that no validation errors for invalid descriptors if binding is PARTIALLY_BOUND");
     SetTargetApiVersion(VK_API_VERSION_1_2);
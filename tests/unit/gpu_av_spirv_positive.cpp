@@ -390,3 +390,76 @@ TEST_F(PositiveGpuAVSpirv, FindMultipleStores) {
     m_default_queue->Submit(m_command_buffer);
     m_default_queue->Wait();
 }
+
+TEST_F(PositiveGpuAVSpirv, DuplicatedConstants) {
+    TEST_DESCRIPTION("Instrumentation should reuse the first of the duplicated constants it looks up");
+    RETURN_IF_SKIP(InitGpuAvFramework());
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, kHostVisibleMemProps);
+    uint32_t *data = (uint32_t *)buffer.Memory().Map();
+    data[0] = 1;
+    buffer.Memory().Unmap();
+
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    // Same as foo.bar[0] = foo.bar[foo.x]; but with every constant declared twice
+    const char *cs_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main" %foo
+               OpExecutionMode %main LocalSize 1 1 1
+               OpDecorate %_arr_uint_uint_8 ArrayStride 4
+               OpMemberDecorate %InOut 0 Offset 0
+               OpMemberDecorate %InOut 1 Offset 4
+               OpDecorate %InOut Block
+               OpDecorate %foo DescriptorSet 0
+               OpDecorate %foo Binding 0
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %uint = OpTypeInt 32 0
+     %uint_8 = OpConstant %uint 8
+     %uint_0 = OpConstant %uint 0
+ %uint_0_dup = OpConstant %uint 0
+%_arr_uint_uint_8 = OpTypeArray %uint %uint_8
+      %InOut = OpTypeStruct %uint %_arr_uint_uint_8
+%_ptr_StorageBuffer_InOut = OpTypePointer StorageBuffer %InOut
+        %foo = OpVariable %_ptr_StorageBuffer_InOut StorageBuffer
+        %int = OpTypeInt 32 1
+      %int_1 = OpConstant %int 1
+  %int_1_dup = OpConstant %int 1
+      %int_0 = OpConstant %int 0
+  %int_0_dup = OpConstant %int 0
+%_ptr_StorageBuffer_uint = OpTypePointer StorageBuffer %uint
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+         %16 = OpAccessChain %_ptr_StorageBuffer_uint %foo %int_0_dup
+         %17 = OpLoad %uint %16
+         %18 = OpAccessChain %_ptr_StorageBuffer_uint %foo %int_1_dup %17
+         %19 = OpLoad %uint %18
+         %20 = OpAccessChain %_ptr_StorageBuffer_uint %foo %int_1 %uint_0_dup
+               OpStore %20 %19
+               OpReturn
+               OpFunctionEnd
+        )";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_ASM);
+    pipe.cp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+    m_command_buffer.End();
+
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+}
@@ -2054,3 +2054,56 @@ TEST_F(NegativeHostImageCopy, ImageMemorySparseUnbound) {
     vk::CopyImageToImageEXT(*m_device, &copy_image_to_image);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeHostImageCopy, CurrentLayoutPerMipLevel) {
+    TEST_DESCRIPTION("Copy from mip levels after only one of them was transitioned to another layout");
+    image_ci = vkt::Image::ImageCreateInfo2D(
+        width, height, 2, 1, format,
+        VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+    RETURN_IF_SKIP(InitHostImageCopyTest(image_ci));
+
+    vkt::Image image(*m_device, image_ci);
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+    VkHostImageLayoutTransitionInfoEXT transition_info = vku::InitStructHelper();
+    transition_info.image = image;
+    transition_info.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    transition_info.newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    transition_info.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 1, 1, 0, 1};
+    vk::TransitionImageLayoutEXT(*m_device, 1, &transition_info);
+
+    std::vector<uint8_t> pixels(width * height * 4);
+    VkImageToMemoryCopyEXT region = vku::InitStructHelper();
+    region.pHostPointer = pixels.data();
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageExtent = {width / 2, height / 2, 1};
+
+    VkCopyImageToMemoryInfoEXT copy_from_image = vku::InitStructHelper();
+    copy_from_image.srcImage = image;
+    copy_from_image.srcImageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    copy_from_image.regionCount = 1;
+    copy_from_image.pRegions = &region;
+    vk::CopyImageToMemoryEXT(*m_device, &copy_from_image);
+
+    region.imageSubresource.mipLevel = 1;
+    m_errorMonitor->SetDesiredError("VUID-VkCopyImageToMemoryInfoEXT-srcImageLayout-09064");
+    vk::CopyImageToMemoryEXT(*m_device, &copy_from_image);
+    m_errorMonitor->VerifyFound();
+
+    // Once every mip level is back in the same layout, copying from either one is valid again
+    transition_info.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    transition_info.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    vk::TransitionImageLayoutEXT(*m_device, 1, &transition_info);
+    vk::CopyImageToMemoryEXT(*m_device, &copy_from_image);
+    region.imageSubresource.mipLevel = 0;
+    vk::CopyImageToMemoryEXT(*m_device, &copy_from_image);
+
+    // The whole image moves to another layout at once
+    transition_info.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    transition_info.newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    transition_info.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 2, 0, 1};
+    vk::TransitionImageLayoutEXT(*m_device, 1, &transition_info);
+    m_errorMonitor->SetDesiredError("VUID-VkCopyImageToMemoryInfoEXT-srcImageLayout-09064");
+    vk::CopyImageToMemoryEXT(*m_device, &copy_from_image);
+    m_errorMonitor->VerifyFound();
+}
@@ -229,6 +229,59 @@ TEST_F(NegativeLayerSettings, DuplicateMessageLimitNone) {
     }
 }
 
+TEST_F(NegativeLayerSettings, ValidationSamplingRate) {
+    TEST_DESCRIPTION("Use the validation_sampling_rate setting, only 1 in 2 calls of an entry point are validated");
+
+    uint32_t value = 2;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "validation_sampling_rate", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    m_command_buffer.Begin();
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdSetViewport-viewportCount-arraylength");
+    vk::CmdSetViewport(m_command_buffer.handle(), 0, 0, nullptr);
+    m_errorMonitor->VerifyFound();
+
+    // Not sampled
+    vk::CmdSetViewport(m_command_buffer.handle(), 0, 0, nullptr);
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdSetViewport-viewportCount-arraylength");
+    vk::CmdSetViewport(m_command_buffer.handle(), 0, 0, nullptr);
+    m_errorMonitor->VerifyFound();
+
+    m_command_buffer.End();
+}
+
+TEST_F(NegativeLayerSettings, AsyncMessageDelivery) {
+    TEST_DESCRIPTION("Messages logged with async_message_delivery are all delivered once a device is destroyed");
+    AddRequiredExtensions(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+
+    const VkBool32 value = VK_TRUE;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "async_message_delivery", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // Create an invalid pNext structure to trigger the stateless validation warning
+    VkBaseOutStructure bogus_struct{};
+    bogus_struct.sType = static_cast<VkStructureType>(0x33333333);
+    VkPhysicalDeviceProperties2KHR properties2 = vku::InitStructHelper(&bogus_struct);
+
+    m_errorMonitor->SetDesiredError("VUID-VkPhysicalDeviceProperties2-pNext-pNext", 3);
+    for (uint32_t i = 0; i < 3; i++) {
+        vk::GetPhysicalDeviceProperties2KHR(Gpu(), &properties2);
+    }
+    {
+        // Destroying any device flushes the messages
+        vkt::Device test_device(Gpu(), m_device_extension_names);
+    }
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeLayerSettings, VuidIdFilterString) {
     TEST_DESCRIPTION("Validate that message id string filtering is working");
 
@@ -262,6 +315,30 @@ TEST_F(NegativeLayerSettings, VuidIdFilterString) {
     TestRenderPassCreate(m_errorMonitor, *m_device, rpci, false, "VUID-VkInputAttachmentAspectReference-aspectMask-01964", nullptr);
 }
 
+TEST_F(NegativeLayerSettings, VuidFilterPnext) {
+    TEST_DESCRIPTION("Filter a stateless pNext error, which is dropped before its message is built");
+    AddRequiredExtensions(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+
+    const char *ids[] = {"VUID-VkPhysicalDeviceProperties2-pNext-pNext"};
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "message_id_filter", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, ids};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    VkBaseOutStructure bogus_struct{};
+    bogus_struct.sType = static_cast<VkStructureType>(0x33333333);
+    VkPhysicalDeviceProperties2KHR properties2 = vku::InitStructHelper(&bogus_struct);
+    vk::GetPhysicalDeviceProperties2KHR(Gpu(), &properties2);
+
+    // Other VUIDs are still reported
+    m_errorMonitor->SetDesiredError("VUID-VkPhysicalDeviceProperties2-sType-sType");
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    properties2.pNext = nullptr;
+    vk::GetPhysicalDeviceProperties2KHR(Gpu(), &properties2);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeLayerSettings, VuidFilterHexInt) {
     TEST_DESCRIPTION("Validate that message id hex int filtering is working");
 
@@ -263,6 +263,35 @@ TEST_F(NegativeMemory, MapMemoryNullppData) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeMemory, FlushRangesOfSeveralMemories) {
+    TEST_DESCRIPTION("Flush ranges alternating between a mapped and an unmapped memory");
+    RETURN_IF_SKIP(Init());
+
+    VkMemoryAllocateInfo memory_info = vku::InitStructHelper();
+    memory_info.allocationSize = 1024;
+    ASSERT_TRUE(m_device->Physical().SetMemoryType(vvl::kU32Max, &memory_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+    vkt::DeviceMemory mapped(*m_device, memory_info);
+    vkt::DeviceMemory unmapped(*m_device, memory_info);
+    void *data = nullptr;
+    ASSERT_EQ(VK_SUCCESS, vk::MapMemory(device(), mapped.handle(), 0, VK_WHOLE_SIZE, 0, &data));
+
+    VkMappedMemoryRange ranges[4];
+    for (uint32_t i = 0; i < 4; ++i) {
+        ranges[i] = vku::InitStructHelper();
+        ranges[i].memory = (i == 2) ? unmapped.handle() : mapped.handle();
+        ranges[i].offset = 0;
+        ranges[i].size = VK_WHOLE_SIZE;
+    }
+    m_errorMonitor->SetDesiredError("VUID-VkMappedMemoryRange-memory-00684");
+    vk::FlushMappedMemoryRanges(device(), 4, ranges);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredError("VUID-VkMappedMemoryRange-memory-00684");
+    vk::InvalidateMappedMemoryRanges(device(), 4, ranges);
+    m_errorMonitor->VerifyFound();
+    vk::UnmapMemory(device(), mapped.handle());
+}
+
 TEST_F(NegativeMemory, MapMemWithoutHostVisibleBit) {
     TEST_DESCRIPTION("Allocate memory that is not mappable and then attempt to map it.");
 
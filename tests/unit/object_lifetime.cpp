@@ -65,6 +65,42 @@ TEST_F(NegativeObjectLifetime, CmdBufferBufferDestroyed) {
     vk::FreeMemory(m_device->handle(), mem, NULL);
 }
 
+TEST_F(NegativeObjectLifetime, CmdBufferBufferDestroyedLazyBindings) {
+    TEST_DESCRIPTION("Destroy a buffer used by recorded command buffers, with the command buffers not linked to the buffer");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "lazy_object_bindings", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer other_buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::CommandBuffer other_cb(*m_device, m_command_pool);
+
+    m_command_buffer.Begin();
+    vk::CmdFillBuffer(m_command_buffer.handle(), buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    m_command_buffer.End();
+
+    // Does not use the destroyed buffer and stays valid
+    other_cb.Begin();
+    vk::CmdFillBuffer(other_cb.handle(), other_buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    other_cb.End();
+
+    m_default_queue->Submit(m_command_buffer);
+    m_errorMonitor->SetDesiredError("VUID-vkDestroyBuffer-buffer-00922");
+    vk::DestroyBuffer(device(), buffer.handle(), nullptr);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+
+    buffer.destroy();
+    m_errorMonitor->SetDesiredError("VUID-vkQueueSubmit-pCommandBuffers-00070");
+    m_default_queue->Submit(m_command_buffer);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Submit(other_cb);
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeObjectLifetime, CmdBarrierBufferDestroyed) {
     RETURN_IF_SKIP(Init());
 
@@ -148,6 +184,49 @@ TEST_F(NegativeObjectLifetime, CmdBarrierImageDestroyed) {
     m_default_queue->Wait();
 }
 
+TEST_F(NegativeObjectLifetime, FreeMemorySuballocatedBufferInUse) {
+    TEST_DESCRIPTION("Free a memory suballocated by many buffers while one of them is used by a pending command buffer");
+    RETURN_IF_SKIP(Init());
+
+    constexpr uint32_t buffer_count = 64;
+    VkBufferCreateInfo buffer_ci = vkt::Buffer::CreateInfo(256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    std::vector<vkt::Buffer> buffers(buffer_count);
+    for (auto &buffer : buffers) {
+        buffer.InitNoMemory(*m_device, buffer_ci);
+    }
+
+    VkMemoryRequirements mem_reqs;
+    vk::GetBufferMemoryRequirements(device(), buffers[0].handle(), &mem_reqs);
+    const VkDeviceSize stride = Align(mem_reqs.size, mem_reqs.alignment);
+
+    VkMemoryAllocateInfo alloc_info = vku::InitStructHelper();
+    alloc_info.allocationSize = stride * buffer_count;
+    bool pass = m_device->Physical().SetMemoryType(mem_reqs.memoryTypeBits, &alloc_info, 0);
+    ASSERT_TRUE(pass);
+
+    vkt::DeviceMemory buffer_mem(*m_device, alloc_info);
+    for (uint32_t i = 0; i < buffer_count; ++i) {
+        ASSERT_EQ(VK_SUCCESS, vk::BindBufferMemory(device(), buffers[i].handle(), buffer_mem.handle(), stride * i));
+    }
+
+    m_command_buffer.Begin();
+    VkBufferMemoryBarrier buf_barrier = vku::InitStructHelper();
+    buf_barrier.buffer = buffers[buffer_count / 2].handle();
+    buf_barrier.offset = 0;
+    buf_barrier.size = VK_WHOLE_SIZE;
+    vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                           NULL, 1, &buf_barrier, 0, NULL);
+    m_command_buffer.End();
+
+    m_default_queue->Submit(m_command_buffer);
+
+    m_errorMonitor->SetDesiredError("VUID-vkFreeMemory-memory-00677");
+    vk::FreeMemory(m_device->handle(), buffer_mem.handle(), nullptr);
+    m_errorMonitor->VerifyFound();
+
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeObjectLifetime, Sync2CmdBarrierBufferDestroyed) {
     SetTargetApiVersion(VK_API_VERSION_1_2);
     AddRequiredExtensions(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
@@ -1202,6 +1281,36 @@ TEST_F(NegativeObjectLifetime, FreeDescriptorSetsNull) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeObjectLifetime, FreeDescriptorSetsAfterReset) {
+    TEST_DESCRIPTION("Free a descriptor set that was implicitly freed by resetting its pool");
+    RETURN_IF_SKIP(Init());
+
+    VkDescriptorPoolSize ds_type_count = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 4};
+    VkDescriptorPoolCreateInfo ds_pool_ci = vku::InitStructHelper();
+    ds_pool_ci.maxSets = 4;
+    ds_pool_ci.poolSizeCount = 1;
+    ds_pool_ci.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    ds_pool_ci.pPoolSizes = &ds_type_count;
+    vkt::DescriptorPool ds_pool(*m_device, ds_pool_ci);
+    const vkt::DescriptorSetLayout ds_layout(*m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+
+    VkDescriptorSetLayout set_layouts[4] = {ds_layout.handle(), ds_layout.handle(), ds_layout.handle(), ds_layout.handle()};
+    VkDescriptorSet descriptor_sets[4] = {};
+    VkDescriptorSetAllocateInfo alloc_info = vku::InitStructHelper();
+    alloc_info.descriptorSetCount = 4;
+    alloc_info.descriptorPool = ds_pool.handle();
+    alloc_info.pSetLayouts = set_layouts;
+    vk::AllocateDescriptorSets(device(), &alloc_info, descriptor_sets);
+
+    // Freeing a set in the middle of the pool moves the last one
+    vk::FreeDescriptorSets(device(), ds_pool.handle(), 1, &descriptor_sets[1]);
+    vk::ResetDescriptorPool(device(), ds_pool.handle(), 0);
+
+    m_errorMonitor->SetDesiredError("VUID-vkFreeDescriptorSets-pDescriptorSets-00310");
+    vk::FreeDescriptorSets(device(), ds_pool.handle(), 1, &descriptor_sets[3]);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeObjectLifetime, DescriptorBufferInfoUpdate) {
     TEST_DESCRIPTION("Destroy a buffer then try to update it in the descriptor set");
     RETURN_IF_SKIP(Init());
@@ -1222,3 +1331,31 @@ TEST_F(NegativeObjectLifetime, DescriptorBufferInfoUpdate) {
     descriptor_set.UpdateDescriptorSets();
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeObjectLifetime, HandlePassthroughCollision) {
+    TEST_DESCRIPTION("With handle_passthrough, the driver returns the handle of a buffer that is still alive");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "handle_passthrough", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    if (!IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test only supported by MockICD";
+    }
+
+    // The test ICD returns the same handle for all the buffers of this size while one of them is alive
+    VkBufferCreateInfo buffer_ci = vku::InitStructHelper();
+    buffer_ci.size = 0xC011DE;
+    buffer_ci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkBuffer colliding_buffer = VK_NULL_HANDLE;
+    vk::CreateBuffer(device(), &buffer_ci, nullptr, &buffer);
+
+    m_errorMonitor->SetDesiredWarning("WARNING-ObjectTracker-HandleCollision");
+    vk::CreateBuffer(device(), &buffer_ci, nullptr, &colliding_buffer);
+    m_errorMonitor->VerifyFound();
+    ASSERT_EQ(buffer, colliding_buffer);
+
+    vk::DestroyBuffer(device(), buffer, nullptr);
+}
@@ -155,4 +155,50 @@ TEST_F(PositiveObjectLifetime, DescriptorBufferInfoCopy) {
     copy_ds_update.dstBinding = 0;
     copy_ds_update.descriptorCount = 1;
     vk::UpdateDescriptorSets(device(), 0, nullptr, 1, &copy_ds_update);
-}
\ No newline at end of file
+}
+
+TEST_F(PositiveObjectLifetime, ResetCommandPoolUnlinksSharedBuffer) {
+    TEST_DESCRIPTION("Command buffers of a reset pool no longer reference the buffer they all used");
+    RETURN_IF_SKIP(Init());
+
+    vkt::CommandPool pool(*m_device, m_device->graphics_queue_node_index_);
+    std::vector<vkt::CommandBuffer> command_buffers;
+    for (int i = 0; i < 4; ++i) {
+        command_buffers.emplace_back(*m_device, pool);
+    }
+    vkt::Buffer shared_buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer other_buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    for (auto &command_buffer : command_buffers) {
+        command_buffer.Begin();
+        vk::CmdFillBuffer(command_buffer.handle(), shared_buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+        command_buffer.End();
+        m_default_queue->Submit(command_buffer);
+    }
+    m_default_queue->Wait();
+    vk::ResetCommandPool(device(), pool.handle(), 0);
+
+    command_buffers[0].Begin();
+    vk::CmdFillBuffer(command_buffers[0].handle(), other_buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    command_buffers[0].End();
+    // Would invalidate the command buffer if the reset left it linked to the buffer
+    shared_buffer.destroy();
+    m_default_queue->Submit(command_buffers[0]);
+    m_default_queue->Wait();
+}
+
+TEST_F(PositiveObjectLifetime, HandlePassthroughUniqueDriverHandles) {
+    TEST_DESCRIPTION("Objects created and destroyed with handle_passthrough, the driver handles are all distinct");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "handle_passthrough", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    for (int i = 0; i < 4; ++i) {
+        vkt::Sampler sampler_a(*m_device, SafeSaneSamplerCreateInfo());
+        vkt::Sampler sampler_b(*m_device, SafeSaneSamplerCreateInfo());
+        vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    }
+}
@@ -695,4 +695,47 @@ TEST_F(VkPositiveLayerTest, UnrecognizedFlagOutOfRange2) {
     format_info.type = VK_IMAGE_TYPE_1D;
     format_info.usage = static_cast<VkImageUsageFlags>(0xffffffff);
     vk::GetPhysicalDeviceImageFormatProperties2(Gpu(), &format_info, &format_properties);
-}
\ No newline at end of file
+}
+TEST_F(VkPositiveLayerTest, FrameProfilingFrameBoundary) {
+    TEST_DESCRIPTION("Each submission ending a frame with VkFrameBoundaryEXT writes one line of the frame profiling timeline");
+    AddRequiredExtensions(VK_EXT_FRAME_BOUNDARY_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::frameBoundary);
+    const char *filename = "vvl_frame_profiling.csv";
+    const VkBool32 frame_profiling = VK_TRUE;
+    const VkLayerSettingEXT settings[2] = {
+        {OBJECT_LAYER_NAME, "frame_profiling_filename", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &filename},
+        {OBJECT_LAYER_NAME, "frame_profiling", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &frame_profiling}};
+    VkLayerSettingsCreateInfoEXT layer_settings = vku::InitStructHelper();
+    layer_settings.settingCount = 2;
+    layer_settings.pSettings = settings;
+    RETURN_IF_SKIP(InitFramework(&layer_settings));
+    RETURN_IF_SKIP(InitState());
+
+    constexpr uint32_t kFrameCount = 3;
+    for (uint32_t i = 0; i < kFrameCount; ++i) {
+        m_command_buffer.Begin();
+        m_command_buffer.End();
+        // Only the end of a frame counts
+        VkFrameBoundaryEXT frame_boundary = vku::InitStructHelper();
+        frame_boundary.frameID = i;
+        VkSubmitInfo submit_info = vku::InitStructHelper(&frame_boundary);
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &m_command_buffer.handle();
+        vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+        m_default_queue->Wait();
+
+        frame_boundary.flags = VK_FRAME_BOUNDARY_FRAME_END_BIT_EXT;
+        vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+        m_default_queue->Wait();
+    }
+
+    // The header and a line per frame
+    FILE *file = fopen(filename, "r");
+    ASSERT_NE(file, nullptr);
+    uint32_t line_count = 0;
+    for (int c = fgetc(file); c != EOF; c = fgetc(file)) {
+        line_count += c == '\n' ? 1 : 0;
+    }
+    fclose(file);
+    ASSERT_EQ(line_count, kFrameCount + 1);
+}
@@ -995,6 +995,80 @@ TEST_F(NegativePipeline, MissingEntrypoint) {
     }
 }
 
+TEST_F(NegativePipeline, ParallelPipelineValidation) {
+    TEST_DESCRIPTION("Validate the pipelines of one create call on worker threads, every invalid pipeline is still reported");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "parallel_pipeline_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    {
+        CreateComputePipelineHelper valid_pipe(*this);
+        valid_pipe.LateBindPipelineInfo();
+        CreateComputePipelineHelper invalid_pipe(*this);
+        invalid_pipe.cs_ = std::make_unique<VkShaderObj>(this, kMinimalShaderGlsl, VK_SHADER_STAGE_COMPUTE_BIT,
+                                                         SPV_ENV_VULKAN_1_0, SPV_SOURCE_GLSL, nullptr, "foo");
+        invalid_pipe.LateBindPipelineInfo();
+
+        VkComputePipelineCreateInfo create_infos[8];
+        for (uint32_t i = 0; i < 8; i++) {
+            create_infos[i] = (i == 2 || i == 5) ? invalid_pipe.cp_ci_ : valid_pipe.cp_ci_;
+        }
+        VkPipeline pipelines[8];
+        m_errorMonitor->SetDesiredError("VUID-VkPipelineShaderStageCreateInfo-pName-00707", 2);
+        vk::CreateComputePipelines(device(), VK_NULL_HANDLE, 8, create_infos, nullptr, pipelines);
+        m_errorMonitor->VerifyFound();
+    }
+
+    {
+        CreatePipelineHelper valid_pipe(*this);
+        valid_pipe.LateBindPipelineInfo();
+        CreatePipelineHelper invalid_pipe(*this);
+        invalid_pipe.LateBindPipelineInfo();
+        invalid_pipe.gp_ci_.subpass = 4u;
+
+        VkGraphicsPipelineCreateInfo create_infos[4] = {valid_pipe.gp_ci_, invalid_pipe.gp_ci_, valid_pipe.gp_ci_,
+                                                        invalid_pipe.gp_ci_};
+        VkPipeline pipelines[4];
+        m_errorMonitor->SetDesiredError("VUID-VkGraphicsPipelineCreateInfo-renderPass-06046", 2);
+        vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, 4, create_infos, nullptr, pipelines);
+        m_errorMonitor->VerifyFound();
+    }
+}
+
+TEST_F(NegativePipeline, ParallelPipelineValidationRecreate) {
+    TEST_DESCRIPTION("An invalid pipeline validated on a worker thread is not remembered as valid, creating it again errors again");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "parallel_pipeline_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    CreatePipelineHelper valid_pipe(*this);
+    valid_pipe.LateBindPipelineInfo();
+    CreatePipelineHelper invalid_pipe(*this);
+    invalid_pipe.LateBindPipelineInfo();
+    invalid_pipe.gp_ci_.subpass = 4u;
+
+    // Two pipelines per call, so they are validated on the worker pool
+    VkGraphicsPipelineCreateInfo create_infos[2] = {valid_pipe.gp_ci_, invalid_pipe.gp_ci_};
+    VkPipeline pipelines[2];
+    m_errorMonitor->SetDesiredError("VUID-VkGraphicsPipelineCreateInfo-renderPass-06046");
+    vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, 2, create_infos, nullptr, pipelines);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredError("VUID-VkGraphicsPipelineCreateInfo-renderPass-06046");
+    vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, 2, create_infos, nullptr, pipelines);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativePipeline, DepthStencilRequired) {
     m_errorMonitor->SetDesiredError("VUID-VkGraphicsPipelineCreateInfo-renderPass-09028");
 
@@ -3091,6 +3165,29 @@ TEST_F(NegativePipeline, PipelineSubpassOutOfBounds) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativePipeline, PipelineSubpassOutOfBoundsRecreate) {
+    TEST_DESCRIPTION("Pipelines without errors are remembered, make sure different or invalid pipelines are still validated");
+
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    CreatePipelineHelper valid_pipe(*this);
+    valid_pipe.CreateGraphicsPipeline();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.gp_ci_.subpass = 4u;
+    m_errorMonitor->SetDesiredError("VUID-VkGraphicsPipelineCreateInfo-renderPass-06046");
+    pipe.CreateGraphicsPipeline();
+    m_errorMonitor->VerifyFound();
+
+    // Creates with errors are never skipped
+    CreatePipelineHelper same_pipe(*this);
+    same_pipe.gp_ci_.subpass = 4u;
+    m_errorMonitor->SetDesiredError("VUID-VkGraphicsPipelineCreateInfo-renderPass-06046");
+    same_pipe.CreateGraphicsPipeline();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativePipeline, PipelineRenderingInfoInvalidFormats) {
     TEST_DESCRIPTION("Create pipeline with invalid pipeline rendering formats");
 
@@ -48,6 +48,24 @@ TEST_F(PositivePipeline, BasicUsage) {
     pipe.CreateGraphicsPipeline();
 }
 
+TEST_F(PositivePipeline, RecreateIdenticalGraphicsPipeline) {
+    TEST_DESCRIPTION("Create the same graphics pipeline again, like an application rebuilding its swapchain.");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.CreateGraphicsPipeline();
+    vkt::Pipeline same_pipe(*m_device, pipe.gp_ci_);
+    ASSERT_TRUE(same_pipe.initialized());
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, same_pipe.handle());
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+}
+
 TEST_F(PositivePipeline, MissingDescriptorUnused) {
     TEST_DESCRIPTION(
         "Test that pipeline validation accepts a compute pipeline which declares a descriptor-backed resource which is not "
@@ -70,6 +88,39 @@ TEST_F(PositivePipeline, MissingDescriptorUnused) {
     pipe.CreateComputePipeline();
 }
 
+TEST_F(PositivePipeline, SameShaderModuleActiveSlots) {
+    TEST_DESCRIPTION("Two pipelines made from the same shader module share their active descriptor slots, use both.");
+    RETURN_IF_SKIP(Init());
+
+    char const *csSource = R"glsl(
+        #version 450
+        layout(local_size_x=1) in;
+        layout(set=0, binding=0) buffer block { vec4 x; };
+        void main(){
+           x = vec4(1.0);
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, csSource, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.CreateComputePipeline();
+    vkt::Pipeline other_pipe(*m_device, pipe.cp_ci_);
+
+    vkt::Buffer buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    pipe.descriptor_set_->UpdateDescriptorSets();
+
+    m_command_buffer.Begin();
+    vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, nullptr);
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, other_pipe.handle());
+    vk::CmdDispatch(m_command_buffer.handle(), 1, 1, 1);
+    m_command_buffer.End();
+}
+
 TEST_F(PositivePipeline, FragmentShadingRate) {
     TEST_DESCRIPTION("Verify that pipeline validation accepts a compute pipeline with fragment shading rate extension enabled");
 
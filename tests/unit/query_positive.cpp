@@ -539,3 +539,36 @@ TEST_F(PositiveQuery, ReuseSecondaryWithQueryCommand) {
 
     m_default_queue->Wait();
 }
+
+TEST_F(PositiveQuery, LargePoolQueriesInSecondary) {
+    TEST_DESCRIPTION("Write a range of timestamps of a large pool in a secondary command buffer and read them back");
+
+    RETURN_IF_SKIP(Init());
+    if (HasZeroTimestampValidBits()) {
+        GTEST_SKIP() << "Device graphic queue has timestampValidBits of 0, skipping.";
+    }
+
+    const uint32_t query_count = 4096;
+    const uint32_t first_written = 1000;
+    const uint32_t written_count = 64;
+    vkt::QueryPool query_pool(*m_device, VK_QUERY_TYPE_TIMESTAMP, query_count);
+
+    vkt::CommandBuffer secondary_buffer(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary_buffer.Begin();
+    for (uint32_t i = 0; i < written_count; ++i) {
+        vk::CmdWriteTimestamp(secondary_buffer.handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, query_pool, first_written + i);
+    }
+    secondary_buffer.End();
+
+    m_command_buffer.Begin();
+    vk::CmdResetQueryPool(m_command_buffer.handle(), query_pool, 0, query_count);
+    vk::CmdExecuteCommands(m_command_buffer.handle(), 1, &secondary_buffer.handle());
+    m_command_buffer.End();
+
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+
+    std::vector<uint64_t> results(written_count);
+    vk::GetQueryPoolResults(device(), query_pool, first_written, written_count, results.size() * sizeof(uint64_t), results.data(),
+                            sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+}
@@ -183,6 +183,20 @@ TEST_F(NegativeSampler, BasicUsage) {
     sampler_info.mipLodBias = sampler_info_ref.mipLodBias;
 }
 
+TEST_F(NegativeSampler, RecreateSampler) {
+    TEST_DESCRIPTION("Create infos that passed before are remembered, make sure invalid ones are still reported every time");
+    RETURN_IF_SKIP(Init());
+
+    VkSamplerCreateInfo sampler_info = SafeSaneSamplerCreateInfo();
+    CreateSamplerTest(*this, &sampler_info, "");
+    CreateSamplerTest(*this, &sampler_info, "");
+
+    sampler_info.minLod = 4.0f;
+    sampler_info.maxLod = 1.0f;
+    CreateSamplerTest(*this, &sampler_info, "VUID-VkSamplerCreateInfo-maxLod-01973");
+    CreateSamplerTest(*this, &sampler_info, "VUID-VkSamplerCreateInfo-maxLod-01973");
+}
+
 TEST_F(NegativeSampler, AllocationCount) {
     VkResult err = VK_SUCCESS;
     const int max_samplers = 32;
@@ -679,6 +679,49 @@ TEST_F(NegativeShaderCompute, LocalSizeIdExecutionMode) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeShaderCompute, LocalSizeIdExecutionModeParallelEntryPoints) {
+    TEST_DESCRIPTION("Entry points of a module validated on worker threads, each invalid one is still reported");
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "parallel_pipeline_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    const char *source = R"(
+               OpCapability Shader
+          %1 = OpExtInstImport "GLSL.std.450"
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpEntryPoint GLCompute %main_1 "main_1"
+               OpEntryPoint GLCompute %main_2 "main_2"
+               OpExecutionModeId %main LocalSizeId %uint_1 %uint_1 %uint_1
+               OpExecutionMode %main_1 LocalSize 1 1 1
+               OpExecutionModeId %main_2 LocalSizeId %uint_1 %uint_1 %uint_1
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %uint = OpTypeInt 32 0
+     %uint_1 = OpConstant %uint 1
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+     %main_1 = OpFunction %void None %3
+          %6 = OpLabel
+               OpReturn
+               OpFunctionEnd
+     %main_2 = OpFunction %void None %3
+          %7 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+    m_errorMonitor->SetDesiredError("VUID-RuntimeSpirv-LocalSizeId-06434", 2);
+    VkShaderObj::CreateFromASM(this, source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_UNIVERSAL_1_6);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeShaderCompute, LocalSizeIdExecutionModeMaintenance5) {
     TEST_DESCRIPTION("Test SPIRV is still checked if using new pNext in VkPipelineShaderStageCreateInfo");
     SetTargetApiVersion(VK_API_VERSION_1_3);
@@ -3167,6 +3167,52 @@ TEST_F(NegativeShaderObject, BindShaderBetweenLinkedShaders) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeShaderObject, BindShaderBetweenLinkedShadersAfterValidDraw) {
+    TEST_DESCRIPTION("Draw with linked shaders, then again with a shader bound between them.");
+
+    AddRequiredFeature(vkt::Feature::geometryShader);
+    RETURN_IF_SKIP(InitBasicShaderObject());
+    InitDynamicRenderTarget();
+
+    const auto vert_spv = GLSLToSPV(VK_SHADER_STAGE_VERTEX_BIT, kVertexMinimalGlsl);
+    const auto frag_spv = GLSLToSPV(VK_SHADER_STAGE_FRAGMENT_BIT, kFragmentMinimalGlsl);
+
+    VkShaderCreateInfoEXT createInfos[2];
+    createInfos[0] = ShaderCreateInfoLink(vert_spv, VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_FRAGMENT_BIT);
+    createInfos[1] = ShaderCreateInfoLink(frag_spv, VK_SHADER_STAGE_FRAGMENT_BIT);
+    VkShaderEXT shaders[2];
+    vk::CreateShadersEXT(*m_device, 2u, createInfos, nullptr, shaders);
+
+    const vkt::Shader geomShader(*m_device, VK_SHADER_STAGE_GEOMETRY_BIT,
+                                 GLSLToSPV(VK_SHADER_STAGE_GEOMETRY_BIT, kGeometryMinimalGlsl));
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderingColor(GetDynamicRenderTarget(), GetRenderTargetArea());
+    SetDefaultDynamicStatesExclude();
+    const VkShaderStageFlagBits stages[] = {VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT,
+                                            VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, VK_SHADER_STAGE_GEOMETRY_BIT,
+                                            VK_SHADER_STAGE_FRAGMENT_BIT};
+    const VkShaderEXT linkedShaders[] = {shaders[0], VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, shaders[1]};
+    vk::CmdBindShadersEXT(m_command_buffer.handle(), 5u, stages, linkedShaders);
+    vk::CmdDraw(m_command_buffer.handle(), 4, 1, 0, 0);
+
+    // The valid combination is remembered, this one must still be checked
+    const VkShaderEXT bindShaders[] = {shaders[0], VK_NULL_HANDLE, VK_NULL_HANDLE, geomShader.handle(), shaders[1]};
+    vk::CmdBindShadersEXT(m_command_buffer.handle(), 5u, stages, bindShaders);
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-08699");
+    vk::CmdDraw(m_command_buffer.handle(), 4, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    // Going back to the valid combination
+    vk::CmdBindShadersEXT(m_command_buffer.handle(), 5u, stages, linkedShaders);
+    vk::CmdDraw(m_command_buffer.handle(), 4, 1, 0, 0);
+    m_command_buffer.EndRendering();
+    m_command_buffer.End();
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        vk::DestroyShaderEXT(*m_device, shaders[i], nullptr);
+    }
+}
+
 TEST_F(NegativeShaderObject, DifferentShaderPushConstantRanges) {
     TEST_DESCRIPTION("Draw with shaders that have different push constant ranges.");
 
@@ -1143,6 +1143,41 @@ TEST_F(NegativeShaderSpirv, ReadShaderClock) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeShaderSpirv, ReadShaderClockSharedAcrossDevices) {
+    TEST_DESCRIPTION("The parsed SPIR-V is shared by the devices of the instance, each device still validates it");
+
+    AddRequiredExtensions(VK_KHR_SHADER_CLOCK_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::shaderDeviceClock);
+    RETURN_IF_SKIP(Init());
+    // Same extensions, but shaderDeviceClock is not enabled
+    auto features = m_device->Physical().Features();
+    vkt::Device second_device(gpu_, m_device_extension_names, &features, nullptr);
+
+    char const *vs_source = R"glsl(
+        #version 450
+        #extension GL_EXT_shader_realtime_clock: enable
+        void main(){
+           uvec2 a = clockRealtime2x32EXT();
+           gl_Position = vec4(float(a.x) * 0.0);
+        }
+    )glsl";
+    std::vector<uint32_t> spv;
+    GLSLtoSPV(m_device->Physical().limits_, VK_SHADER_STAGE_VERTEX_BIT, vs_source, spv);
+    VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+    module_ci.codeSize = spv.size() * sizeof(uint32_t);
+    module_ci.pCode = spv.data();
+
+    // Parsed here first, then shared with the second device while it is alive
+    vkt::ShaderModule first_module(*m_device, module_ci);
+
+    m_errorMonitor->SetDesiredError("VUID-RuntimeSpirv-shaderDeviceClock-06268");
+    vkt::ShaderModule second_module(second_device, module_ci);
+    m_errorMonitor->VerifyFound();
+
+    first_module.destroy();
+    vkt::ShaderModule third_module(*m_device, module_ci);
+}
+
 TEST_F(NegativeShaderSpirv, SpecializationApplied) {
     TEST_DESCRIPTION(
         "Make sure specialization constants get applied during shader validation by using a value that breaks compilation.");
@@ -2530,3 +2565,44 @@ TEST_F(NegativeShaderSpirv, ScalarBlockLayoutShaderCache) {
     VkShaderObj cs(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeShaderSpirv, AsyncSpirvValidation) {
+    TEST_DESCRIPTION("With async spirv-val the error is reported at the next sync point instead of vkCreateShaderModule");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "async_spirv_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // Location-04919 is broken by the block member decoration
+    const char *spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Fragment %main "main" %fragCoord %block_var
+               OpExecutionMode %main OriginUpperLeft
+               OpSource GLSL 450
+               OpDecorate %fragCoord Location 0
+               OpDecorate %block Block
+               OpMemberDecorate %block 0 Location 1
+       %void = OpTypeVoid
+      %voidfn = OpTypeFunction %void
+      %float = OpTypeFloat 32
+    %v4float = OpTypeVector %float 4
+%ptr_v4float = OpTypePointer Output %v4float
+  %fragCoord = OpVariable %ptr_v4float Output
+      %block = OpTypeStruct %v4float %v4float
+  %block_ptr = OpTypePointer Output %block
+  %block_var = OpVariable %block_ptr Output
+       %main = OpFunction %void None %voidfn
+       %label = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+
+    auto fs = VkShaderObj::CreateFromASM(this, spv_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    m_errorMonitor->SetDesiredError("VUID-VkShaderModuleCreateInfo-pCode-08737");
+    m_device->Wait();
+    m_errorMonitor->VerifyFound();
+}
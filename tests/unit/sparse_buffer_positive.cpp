@@ -417,6 +417,90 @@ TEST_F(PositiveSparseBuffer, NonOverlappingBufferCopy5) {
     m_default_queue->Wait();
 }
 
+TEST_F(PositiveSparseBuffer, OverlappingBindsInOneBindInfo) {
+    TEST_DESCRIPTION("The last of two overlapping binds of a bind info rebinds the buffer to non overlapping memory");
+    AddRequiredFeature(vkt::Feature::sparseBinding);
+    RETURN_IF_SKIP(Init());
+
+    if (m_device->QueuesWithSparseCapability().empty()) {
+        GTEST_SKIP() << "Required SPARSE_BINDING queue families not present";
+    }
+
+    vkt::Semaphore semaphore(*m_device);
+
+    VkBufferCopy copy_info;
+    copy_info.srcOffset = 0;
+    copy_info.dstOffset = 0;
+    copy_info.size = 0x10000;
+
+    VkBufferCreateInfo b_info =
+        vkt::Buffer::CreateInfo(copy_info.size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    b_info.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT;
+    vkt::Buffer buffer_sparse(*m_device, b_info, vkt::no_mem);
+    vkt::Buffer buffer_sparse2(*m_device, b_info, vkt::no_mem);
+
+    VkMemoryRequirements buffer_mem_reqs;
+    vk::GetBufferMemoryRequirements(device(), buffer_sparse.handle(), &buffer_mem_reqs);
+    if (buffer_mem_reqs.alignment >= buffer_mem_reqs.size) {
+        GTEST_SKIP() << "Buffer is a single sparse block";
+    }
+    VkMemoryAllocateInfo buffer_mem_alloc =
+        vkt::DeviceMemory::GetResourceAllocInfo(*m_device, buffer_mem_reqs, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    vkt::DeviceMemory buffer_mem;
+    buffer_mem.init(*m_device, buffer_mem_alloc);
+    vkt::DeviceMemory buffer_mem2;
+    buffer_mem2.init(*m_device, buffer_mem_alloc);
+
+    VkSparseMemoryBind buffer_memory_bind = {};
+    buffer_memory_bind.size = buffer_mem_reqs.size;
+    buffer_memory_bind.memory = buffer_mem.handle();
+
+    // buffer_sparse2 first gets the memory of buffer_sparse past its first block, then all of buffer_mem2. Applying the binds
+    // sorted by resource offset would leave the overlap in place.
+    VkSparseMemoryBind buffer_memory_binds2[2] = {};
+    buffer_memory_binds2[0].resourceOffset = buffer_mem_reqs.alignment;
+    buffer_memory_binds2[0].size = buffer_mem_reqs.size - buffer_mem_reqs.alignment;
+    buffer_memory_binds2[0].memory = buffer_mem.handle();
+    buffer_memory_binds2[0].memoryOffset = buffer_mem_reqs.alignment;
+    buffer_memory_binds2[1].size = buffer_mem_reqs.size;
+    buffer_memory_binds2[1].memory = buffer_mem2.handle();
+
+    VkSparseBufferMemoryBindInfo buffer_memory_bind_infos[2] = {};
+    buffer_memory_bind_infos[0].buffer = buffer_sparse.handle();
+    buffer_memory_bind_infos[0].bindCount = 1;
+    buffer_memory_bind_infos[0].pBinds = &buffer_memory_bind;
+    buffer_memory_bind_infos[1].buffer = buffer_sparse2.handle();
+    buffer_memory_bind_infos[1].bindCount = 2;
+    buffer_memory_bind_infos[1].pBinds = buffer_memory_binds2;
+
+    VkBindSparseInfo bind_info = vku::InitStructHelper();
+    bind_info.bufferBindCount = 2;
+    bind_info.pBufferBinds = buffer_memory_bind_infos;
+    bind_info.signalSemaphoreCount = 1;
+    bind_info.pSignalSemaphores = &semaphore.handle();
+
+    vkt::Queue* sparse_queue = m_device->QueuesWithSparseCapability()[0];
+    vk::QueueBindSparse(sparse_queue->handle(), 1, &bind_info, VK_NULL_HANDLE);
+
+    m_command_buffer.Begin();
+    vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_sparse.handle(), buffer_sparse2.handle(), 1, &copy_info);
+    m_command_buffer.End();
+
+    VkPipelineStageFlags mask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkSubmitInfo submit_info = vku::InitStructHelper();
+    submit_info.waitSemaphoreCount = 1;
+    submit_info.pWaitSemaphores = &semaphore.handle();
+    submit_info.pWaitDstStageMask = &mask;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_command_buffer.handle();
+    vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+
+    // Wait for operations to finish before destroying anything
+    sparse_queue->Wait();
+    m_default_queue->Wait();
+}
+
 TEST_F(PositiveSparseBuffer, BindSparseEmpty) {
     TEST_DESCRIPTION("Test submitting empty queue bind sparse");
     AddRequiredFeature(vkt::Feature::sparseBinding);
@@ -257,6 +257,29 @@ TEST_F(PositiveSyncObject, FenceCreateSignaledWaitHandling) {
     // Should have both retired! (get destroyed now)
 }
 
+TEST_F(PositiveSyncObject, FencePolledAfterSignal) {
+    TEST_DESCRIPTION("Poll the status of a fence until and after it signals, then reuse the command buffer it waited for");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Fence fence(*m_device);
+    for (uint32_t frame = 0; frame < 2; ++frame) {
+        m_command_buffer.Begin();
+        m_command_buffer.End();
+        m_default_queue->Submit(m_command_buffer, fence);
+
+        VkResult result = fence.GetStatus();
+        while (result == VK_NOT_READY) {
+            result = fence.GetStatus();
+        }
+        ASSERT_EQ(VK_SUCCESS, result);
+        for (uint32_t i = 0; i < 4; ++i) {
+            ASSERT_EQ(VK_SUCCESS, fence.GetStatus());
+        }
+        ASSERT_EQ(VK_SUCCESS, vk::WaitForFences(device(), 1, &fence.handle(), VK_TRUE, kWaitTimeout));
+        vk::ResetFences(device(), 1, &fence.handle());
+    }
+}
+
 TEST_F(PositiveSyncObject, TwoFencesThreeFrames) {
     TEST_DESCRIPTION(
         "Two command buffers with two separate fences are each run through a Submit & WaitForFences cycle 3 times. This previously "
@@ -2232,6 +2255,48 @@ TEST_F(PositiveSyncObject, PollSemaphoreCounter) {
     } while (counter != 1);
 }
 
+TEST_F(PositiveSyncObject, PollSemaphoreCounterThenResetCommandBuffer) {
+    TEST_DESCRIPTION("The command buffer of the polled signal is no longer in use once the counter reaches the signal value");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    RETURN_IF_SKIP(Init());
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test not supported by MockICD (GetSemaphoreCounterValue)";
+    }
+
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+    for (uint64_t value = 1; value <= 8; ++value) {
+        m_command_buffer.Begin();
+        m_command_buffer.End();
+        m_default_queue->Submit(m_command_buffer, vkt::TimelineSignal(semaphore, value));
+
+        uint64_t counter = 0;
+        do {
+            vk::GetSemaphoreCounterValue(*m_device, semaphore, &counter);
+        } while (counter != value);
+        // Begin implicitly resets the command buffer, it must not be reported as in use
+    }
+    m_command_buffer.Begin();
+    m_command_buffer.End();
+}
+
+TEST_F(PositiveSyncObject, WaitSemaphoreThenResetFence) {
+    TEST_DESCRIPTION("The fence of a submit is no longer in flight once the host waited for the timeline value it signals");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    RETURN_IF_SKIP(Init());
+
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+    vkt::Fence fence(*m_device);
+    m_command_buffer.Begin();
+    m_command_buffer.End();
+    m_default_queue->Submit(m_command_buffer, vkt::TimelineSignal(semaphore, 1), fence);
+
+    semaphore.Wait(1, kWaitTimeout);
+    // The fence signaled with the semaphore, it must not be reported as in use
+    vk::ResetFences(device(), 1, &fence.handle());
+}
+
 TEST_F(PositiveSyncObject, KhronosTimelineSemaphoreExample) {
     TEST_DESCRIPTION("https://www.khronos.org/blog/vulkan-timeline-semaphores");
     SetTargetApiVersion(VK_API_VERSION_1_2);
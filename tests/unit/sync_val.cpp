@@ -16,6 +16,7 @@
 #include "../framework/render_pass_helper.h"
 #include "../framework/descriptor_helper.h"
 #include "../framework/queue_submit_context.h"
+#include "../layers/sync/sync_settings.h"
 #include <utils/vk_layer_utils.h>
 
 class NegativeSyncVal : public VkSyncValTest {};
@@ -3538,6 +3539,59 @@ TEST_F(NegativeSyncVal, EventsBufferCopy) {
     m_command_buffer.End();
 }
 
+TEST_F(NegativeSyncVal, EventsSetTogether) {
+    TEST_DESCRIPTION("Wait on events set one after the other, which share their first synchronization scope");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, 256, transfer_usage);
+    VkBufferCopy region = {0, 0, 256};
+
+    vkt::Event event_a(*m_device);
+    vkt::Event event_b(*m_device);
+    const VkEvent events[2] = {event_a.handle(), event_b.handle()};
+
+    VkMemoryBarrier mem_barrier_waw = vku::InitStructHelper();
+    mem_barrier_waw.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    mem_barrier_waw.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    auto cb = m_command_buffer.handle();
+    m_command_buffer.Begin();
+    vk::CmdCopyBuffer(cb, buffer_a.handle(), buffer_b.handle(), 1, &region);
+    m_command_buffer.SetEvent(event_a, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    m_command_buffer.SetEvent(event_b, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    m_command_buffer.WaitEvents(2, events, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 1, &mem_barrier_waw, 0,
+                                nullptr, 0, nullptr);
+    vk::CmdCopyBuffer(cb, buffer_a.handle(), buffer_b.handle(), 1, &region);
+    m_command_buffer.End();
+
+    // The second event scope has the copy stage, the first one does not
+    m_command_buffer.Reset();
+    m_command_buffer.Begin();
+    vk::CmdCopyBuffer(cb, buffer_a.handle(), buffer_b.handle(), 1, &region);
+    m_command_buffer.SetEvent(event_a, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT);
+    m_command_buffer.SetEvent(event_b, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    m_command_buffer.WaitEvents(2, events, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                VK_PIPELINE_STAGE_TRANSFER_BIT, 1, &mem_barrier_waw, 0, nullptr, 0, nullptr);
+    vk::CmdCopyBuffer(cb, buffer_a.handle(), buffer_b.handle(), 1, &region);
+    m_command_buffer.End();
+
+    // Neither event scope has the copy stage
+    m_command_buffer.Reset();
+    m_command_buffer.Begin();
+    vk::CmdCopyBuffer(cb, buffer_a.handle(), buffer_b.handle(), 1, &region);
+    m_command_buffer.SetEvent(event_a, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT);
+    m_command_buffer.SetEvent(event_b, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT);
+    m_command_buffer.WaitEvents(2, events, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 1,
+                                &mem_barrier_waw, 0, nullptr, 0, nullptr);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdCopyBuffer(cb, buffer_a.handle(), buffer_b.handle(), 1, &region);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeSyncVal, EventsCopyImageHazards) {
     RETURN_IF_SKIP(InitSyncValFramework());
     RETURN_IF_SKIP(InitState());
@@ -5697,6 +5751,56 @@ TEST_F(NegativeSyncVal, QSDebugRegion_Secondary) {
     m_default_queue->Wait();
 }
 
+TEST_F(NegativeSyncVal, QSDebugRegion_ResubmitRerecorded) {
+    TEST_DESCRIPTION("Prior access debug region reporting: command buffer is submitted multiple times and then re-recorded");
+
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    const VkBufferUsageFlags buffer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, buffer_usage);
+    vkt::Buffer buffer_b(*m_device, 256, buffer_usage);
+    vkt::Buffer buffer_c(*m_device, 256, buffer_usage);
+    VkBufferCopy region = {0, 0, 256};
+    VkDebugUtilsLabelEXT label = vku::InitStructHelper();
+
+    vkt::CommandBuffer cb0(*m_device, m_command_pool);
+    label.pLabelName = "RegionA";
+    cb0.Begin();
+    vk::CmdBeginDebugUtilsLabelEXT(cb0, &label);
+    vk::CmdCopyBuffer(cb0, buffer_a, buffer_b, 1, &region);
+    vk::CmdEndDebugUtilsLabelEXT(cb0);
+    cb0.End();
+
+    vkt::CommandBuffer cb1(*m_device, m_command_pool);
+    cb1.Begin();
+    vk::CmdCopyBuffer(cb1, buffer_c, buffer_a, 1, &region);
+    cb1.End();
+
+    // Submissions share the label commands recorded by cb0
+    m_default_queue->Submit(cb0);
+    m_default_queue->Wait();
+    m_default_queue->Submit(cb0);
+    m_errorMonitor->SetDesiredError("RegionA");
+    m_default_queue->Submit(cb1);
+    m_errorMonitor->VerifyFound();  // SYNC-HAZARD-WRITE-AFTER-READ error message
+    m_default_queue->Wait();
+
+    // Re-recording replaces the label commands seen by the next submissions
+    label.pLabelName = "RegionB";
+    cb0.Begin();
+    vk::CmdBeginDebugUtilsLabelEXT(cb0, &label);
+    vk::CmdCopyBuffer(cb0, buffer_a, buffer_b, 1, &region);
+    vk::CmdEndDebugUtilsLabelEXT(cb0);
+    cb0.End();
+    m_default_queue->Submit(cb0);
+    m_errorMonitor->SetDesiredError("RegionB");
+    m_default_queue->Submit(cb1);
+    m_errorMonitor->VerifyFound();  // SYNC-HAZARD-WRITE-AFTER-READ error message
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeSyncVal, UseShaderReadAccessForUniformBuffer) {
     TEST_DESCRIPTION("SHADER_READ_BIT barrier cannot protect UNIFORM_READ_BIT accesses");
     SetTargetApiVersion(VK_API_VERSION_1_3);
@@ -6491,3 +6595,194 @@ TEST_F(NegativeSyncVal, ResourceHandleIndexStability) {
 
     m_default_queue->Wait();
 }
+
+TEST_F(NegativeSyncVal, BufferCopyManyRegions) {
+    TEST_DESCRIPTION("Regions given out of order and with gaps are all recorded, and only them");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 2048, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, 2048, transfer_usage);
+    vkt::Buffer buffer_c(*m_device, 2048, transfer_usage);
+
+    // Every other 16 byte block, last one first
+    std::vector<VkBufferCopy> regions;
+    for (uint32_t i = 0; i < 64; ++i) {
+        const VkDeviceSize offset = (63 - i) * 32;
+        regions.push_back({offset, offset, 16});
+    }
+
+    m_command_buffer.Begin();
+    vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_a.handle(), buffer_b.handle(), size32(regions), regions.data());
+
+    // The gaps are not accessed
+    VkBufferCopy gap = {16, 16, 16};
+    vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_c.handle(), buffer_b.handle(), 1, &gap);
+    vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_c.handle(), buffer_a.handle(), 1, &gap);
+
+    VkBufferCopy first = {0, 0, 16};
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-READ");
+    vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_c.handle(), buffer_a.handle(), 1, &first);
+    m_errorMonitor->VerifyFound();
+
+    VkBufferCopy middle = {1024, 1024, 16};
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_c.handle(), buffer_b.handle(), 1, &middle);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
+
+TEST_F(NegativeSyncVal, OverlappingDescriptorAccessesOfOneDraw) {
+    TEST_DESCRIPTION("Overlapping buffer accesses of one draw are applied in recording order, not in address order");
+    AddRequiredFeature(vkt::Feature::fragmentStoresAndAtomics);
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    vkt::Buffer buffer(*m_device, 1024,
+                       VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                                     {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+    // The vertex shader reads [256, 512), the fragment shader then writes [0, 512)
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 256, 256, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    descriptor_set.WriteDescriptorBufferInfo(1, buffer.handle(), 0, 512, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    char const *vs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) uniform UBO { vec4 values[16]; } ubo;
+        void main() {
+            gl_Position = ubo.values[gl_VertexIndex % 16];
+        }
+    )glsl";
+    char const *fs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=1) buffer SSBO { vec4 values[32]; } ssbo;
+        layout(location=0) out vec4 color;
+        void main() {
+            ssbo.values[0] = vec4(1.0);
+            color = vec4(1.0);
+        }
+    )glsl";
+    VkShaderObj vs(this, vs_source, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, fs_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+    m_command_buffer.EndRenderPass();
+
+    // The write of the fragment shader replaced the read of the vertex shader. If the read had been applied after the write
+    // because of its higher address, this would be a WRITE_AFTER_READ instead.
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdFillBuffer(m_command_buffer.handle(), buffer.handle(), 256, 256, 0);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
+
+TEST_F(NegativeSyncVal, ParallelSubmitValidation) {
+    TEST_DESCRIPTION("Command buffer with enough accesses to be validated on worker threads at submit time");
+    SyncValSettings settings;
+    settings.submit_time_validation = true;
+    settings.parallel_submit_validation = true;
+    RETURN_IF_SKIP(InitSyncVal(&settings));
+
+    constexpr uint32_t region_count = 2048;
+    VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, region_count * 32, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, region_count * 32, transfer_usage);
+
+    // Gaps between the regions keep each of them a separate range
+    std::vector<VkBufferCopy> regions;
+    for (uint32_t i = 0; i < region_count; ++i) {
+        regions.push_back({i * 32, i * 32, 16});
+    }
+
+    m_command_buffer.Begin(VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+    vk::CmdCopyBuffer(m_command_buffer.handle(), buffer_a.handle(), buffer_b.handle(), size32(regions), regions.data());
+    m_command_buffer.End();
+
+    m_default_queue->Submit(m_command_buffer);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    m_default_queue->Submit(m_command_buffer);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+}
+
+TEST_F(NegativeSyncVal, BatchLogMemoryLimit) {
+    TEST_DESCRIPTION("Hazard against a command buffer whose records were dropped to stay within the batch log memory limit");
+    SyncValSettings settings;
+    settings.submit_time_validation = true;
+    settings.batch_log_memory_limit = 1;
+    RETURN_IF_SKIP(InitSyncVal(&settings));
+
+    VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_c(*m_device, 256, transfer_usage);
+    VkBufferCopy region = {0, 0, 256};
+
+    // Enough commands for the access log to go over one megabyte
+    constexpr uint32_t copy_count = 1 << 15;
+    vkt::CommandBuffer cb0(*m_device, m_command_pool);
+    cb0.Begin();
+    for (uint32_t i = 0; i < copy_count; ++i) {
+        vk::CmdCopyBuffer(cb0, buffer_a, buffer_b, 1, &region);
+        VkBufferMemoryBarrier barrier = vku::InitStructHelper();
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = buffer_b;
+        barrier.size = VK_WHOLE_SIZE;
+        vk::CmdPipelineBarrier(cb0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &barrier, 0,
+                               nullptr);
+    }
+    cb0.End();
+    m_default_queue->Submit(cb0);
+
+    // The hazard is still found, the message only names the submission of the prior access
+    vkt::CommandBuffer cb1(*m_device, m_command_pool);
+    cb1.Begin();
+    vk::CmdCopyBuffer(cb1, buffer_c, buffer_a, 1, &region);
+    cb1.End();
+    m_errorMonitor->SetDesiredError("command details are not available");
+    m_default_queue->Submit(cb1);
+    m_errorMonitor->VerifyFound();  // SYNC-HAZARD-WRITE-AFTER-READ error message
+    m_default_queue->Wait();
+}
+
+TEST_F(NegativeSyncVal, ManyExecutionOnlyGlobalBarriers) {
+    TEST_DESCRIPTION("Lazily applied execution only global barriers still leave a WAW hazard, also past the pending barrier limit");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    constexpr VkDeviceSize size = 256;
+    vkt::Buffer buffer_a(*m_device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer buffer_b(*m_device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_c(*m_device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    VkBufferCopy region = {0, 0, size};
+
+    m_command_buffer.Begin();
+    vk::CmdCopyBuffer(m_command_buffer, buffer_a, buffer_b, 1, &region);
+    for (uint32_t i = 0; i < 100; ++i) {
+        vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                               nullptr, 0, nullptr);
+    }
+    // Execution dependencies alone don't make the write visible
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdCopyBuffer(m_command_buffer, buffer_c, buffer_b, 1, &region);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
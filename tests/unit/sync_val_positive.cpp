@@ -51,6 +51,13 @@ void VkSyncValTest::InitSyncValFramework(const SyncValSettings *p_sync_settings)
     settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_shader_accesses_heuristic",
                                             VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &shader_accesses_heuristic});
 
+    const auto parallel_submit_validation = static_cast<VkBool32>(sync_settings.parallel_submit_validation);
+    settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_parallel_submit_validation",
+                                            VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &parallel_submit_validation});
+
+    settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_batch_log_memory_limit", VK_LAYER_SETTING_TYPE_UINT32_EXT,
+                                            1, &sync_settings.batch_log_memory_limit});
+
     VkLayerSettingsCreateInfoEXT settings_create_info = vku::InitStructHelper();
     settings_create_info.settingCount = size32(settings);
     settings_create_info.pSettings = settings.data();
@@ -2093,3 +2100,64 @@ TEST_F(PositiveSyncVal, IndirectDrawAndSuballocatedIndexBuffer) {
 
     m_command_buffer.End();
 }
+
+TEST_F(PositiveSyncVal, WriteToIdenticalImages) {
+    TEST_DESCRIPTION("Images with the same create info share their range encoder, writes to one must not hazard with the other");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    constexpr uint32_t width = 64;
+    constexpr uint32_t height = 64;
+    constexpr VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+
+    vkt::Buffer buffer(*m_device, width * height * 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Image image_a(*m_device, width, height, 1, format, VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    vkt::Image image_b(*m_device, width, height, 1, format, VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+
+    VkImageMemoryBarrier barriers[2];
+    barriers[0] = image_a.ImageMemoryBarrier(0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1});
+    barriers[1] = image_b.ImageMemoryBarrier(0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1});
+
+    VkBufferImageCopy region = {};
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageExtent = {width, height, 1};
+
+    m_command_buffer.Begin();
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr,
+                           2, barriers);
+    vk::CmdCopyBufferToImage(m_command_buffer, buffer, image_a, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    vk::CmdCopyBufferToImage(m_command_buffer, buffer, image_b, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    m_command_buffer.End();
+}
+
+TEST_F(PositiveSyncVal, ManyGlobalBarriers) {
+    TEST_DESCRIPTION("Global barriers are applied to the accesses when these are next used, also past the pending barrier limit");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    constexpr VkDeviceSize size = 256;
+    vkt::Buffer buffer_a(*m_device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer buffer_b(*m_device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_c(*m_device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    VkBufferCopy region = {0, 0, size};
+
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    m_command_buffer.Begin();
+    vk::CmdCopyBuffer(m_command_buffer, buffer_a, buffer_b, 1, &region);
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                           nullptr, 0, nullptr);
+    for (uint32_t i = 0; i < 100; ++i) {
+        vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                               nullptr, 0, nullptr);
+    }
+    vk::CmdCopyBuffer(m_command_buffer, buffer_c, buffer_b, 1, &region);
+    m_command_buffer.End();
+
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+}
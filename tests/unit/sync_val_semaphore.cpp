@@ -116,6 +116,35 @@ TEST_F(NegativeSyncValTimelineSemaphore, WaitBeforeSignal) {
     m_device->Wait();
 }
 
+TEST_F(NegativeSyncValTimelineSemaphore, WaitBeforeSignalSmallerSignalFirst) {
+    TEST_DESCRIPTION("Signal of a smaller value keeps the wait unresolved until the value is signaled");
+    RETURN_IF_SKIP(InitTimelineSemaphore());
+
+    if (!m_second_queue) {
+        GTEST_SKIP() << "Two queues are needed";
+    }
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    m_command_buffer.Begin();
+    m_command_buffer.Copy(buffer_a, buffer_b);
+    m_command_buffer.End();
+    m_second_command_buffer.Begin();
+    m_second_command_buffer.Copy(buffer_a, buffer_b);
+    m_second_command_buffer.End();
+
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+
+    m_default_queue->Submit2(m_command_buffer, vkt::TimelineWait(semaphore, 2));
+    m_second_queue->Submit2(vkt::no_cmd, vkt::TimelineSignal(semaphore, 1));
+    m_second_queue->Submit2(vkt::no_cmd, vkt::TimelineSignal(semaphore, 2));
+
+    // Writes on the second queue collide with writes on the main queue
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-RACING-WRITE");
+    m_second_queue->Submit2(m_second_command_buffer);
+    m_errorMonitor->VerifyFound();
+    m_device->Wait();
+}
+
 TEST_F(NegativeSyncValTimelineSemaphore, WaitBeforeSignalBatchFollowedByOneMoreBatch) {
     TEST_DESCRIPTION("Hazard between wait-before-signal batch and the next batch on the same queue");
     RETURN_IF_SKIP(InitTimelineSemaphore());
@@ -74,6 +74,91 @@ TEST_F(NegativeThreading, CommandBufferCollision) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeThreading, CommandBufferCollisionWithOwnership) {
+    TEST_DESCRIPTION("The thread owning the command pool loses its fast path once another thread records the command buffer");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "thread_safety_command_buffer_ownership",
+                                       VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    m_errorMonitor->SetDesiredError("THREADING ERROR");
+    m_errorMonitor->SetAllowedFailureMsg("THREADING ERROR");  // Ignore any extra threading errors found beyond the first one
+
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // Test takes magnitude of time longer for profiles and slows down testing
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    vkt::CommandBuffer commandBuffer(*m_device, m_command_pool);
+    // This thread claims the command pool
+    commandBuffer.Begin();
+
+    vkt::Event event(*m_device);
+    ASSERT_EQ(VK_SUCCESS, vk::ResetEvent(device(), event.handle()));
+
+    ThreadTestData data;
+    data.commandBuffer = commandBuffer.handle();
+    data.event = event.handle();
+    std::atomic<bool> bailout{false};
+    data.bailout = &bailout;
+    m_errorMonitor->SetBailout(data.bailout);
+
+    std::thread thread(AddToCommandBuffer, &data);
+    AddToCommandBuffer(&data);
+    thread.join();
+    commandBuffer.End();
+
+    m_errorMonitor->SetBailout(NULL);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeThreading, CommandBufferCollisionAdaptive) {
+    TEST_DESCRIPTION("Collisions are found once a second thread uses a device that was only used by one thread");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "thread_safety_adaptive", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    m_errorMonitor->SetDesiredError("THREADING ERROR");
+    m_errorMonitor->SetAllowedFailureMsg("THREADING ERROR");  // Ignore any extra threading errors found beyond the first one
+
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // Test takes magnitude of time longer for profiles and slows down testing
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    // Only this thread has used the device so far
+    vkt::CommandBuffer commandBuffer(*m_device, m_command_pool);
+    commandBuffer.Begin();
+
+    vkt::Event event(*m_device);
+    ASSERT_EQ(VK_SUCCESS, vk::ResetEvent(device(), event.handle()));
+
+    ThreadTestData data;
+    data.commandBuffer = commandBuffer.handle();
+    data.event = event.handle();
+    std::atomic<bool> bailout{false};
+    data.bailout = &bailout;
+    m_errorMonitor->SetBailout(data.bailout);
+
+    // A single call from a second thread, done before the colliding calls start, switches the device to the counters
+    std::thread second_thread([this, &event]() { vk::ResetEvent(device(), event.handle()); });
+    second_thread.join();
+
+    std::thread thread(AddToCommandBuffer, &data);
+    AddToCommandBuffer(&data);
+    thread.join();
+    commandBuffer.End();
+
+    m_errorMonitor->SetBailout(NULL);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeThreading, UpdateDescriptorCollision) {
     TEST_DESCRIPTION("Two threads updating the same descriptor set, expected to generate a threading error");
 
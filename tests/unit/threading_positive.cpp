@@ -243,6 +243,37 @@ TEST_F(PositiveThreading, DebugObjectNames) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(PositiveThreading, CreateShaderModules) {
+    TEST_DESCRIPTION("Create the same and different shader modules from many threads, as engines do at startup");
+    RETURN_IF_SKIP(Init());
+
+    std::vector<std::vector<uint32_t>> spirv;
+    for (uint32_t i = 1; i <= 4; ++i) {
+        const std::string cs_source = "#version 450\nlayout(local_size_x = " + std::to_string(i) + ") in;\nvoid main() {}\n";
+        spirv.emplace_back(GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, cs_source.c_str()));
+    }
+
+    constexpr uint32_t thread_count = 8;
+    constexpr uint32_t module_count = 200;
+    const auto create_modules = [&](uint32_t thread_index) {
+        for (uint32_t i = 0; i < module_count; ++i) {
+            const std::vector<uint32_t> &code = spirv[(thread_index + i) % spirv.size()];
+            VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+            module_ci.codeSize = code.size() * sizeof(uint32_t);
+            module_ci.pCode = code.data();
+            vkt::ShaderModule module(*m_device, module_ci);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        threads.emplace_back(create_modules, i);
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+}
+
 #endif  // GTEST_IS_THREADSAFE
 
 TEST_F(PositiveThreading, Queue) {
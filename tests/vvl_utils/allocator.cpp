@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "utils/allocator.h"
+
+TEST(Allocator, SizesAndAlignments) {
+    for (const size_t size : {0u, 1u, 15u, 16u, 17u, 1000u, 1024u, 1025u, 100000u}) {
+        void *ptr = vvl::allocator::Allocate(size);
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % vvl::allocator::kDefaultAlignment, 0u);
+        std::memset(ptr, 0xab, size);
+        vvl::allocator::Free(ptr, size);
+    }
+    void *aligned = vvl::allocator::Allocate(100, 256);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(aligned) % 256, 0u);
+    vvl::allocator::Free(aligned, 100, 256);
+}
+
+TEST(Allocator, FreedByAnotherThread) {
+    std::vector<uint64_t *> blocks;
+    std::thread producer([&blocks]() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            auto *block = static_cast<uint64_t *>(vvl::allocator::Allocate(sizeof(uint64_t) * 4));
+            block[0] = i;
+            blocks.emplace_back(block);
+        }
+    });
+    producer.join();
+    for (uint32_t i = 0; i < blocks.size(); ++i) {
+        ASSERT_EQ(blocks[i][0], i);
+        vvl::allocator::Free(blocks[i], sizeof(uint64_t) * 4);
+    }
+    // The blocks are reused by the freeing thread
+    void *ptr = vvl::allocator::Allocate(sizeof(uint64_t) * 4);
+    ASSERT_NE(ptr, nullptr);
+    vvl::allocator::Free(ptr, sizeof(uint64_t) * 4);
+}
+
+TEST(Allocator, Containers) {
+    std::vector<uint32_t, vvl::Allocator<uint32_t>> values;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        values.emplace_back(i);
+    }
+    ASSERT_EQ(values[999], 999u);
+
+    // Grows out of the small store, shrinks back, and moves the large store
+    small_vector<uint64_t, 2> small;
+    for (uint64_t i = 0; i < 100; ++i) {
+        small.emplace_back(i);
+    }
+    small.resize(10);
+    small.shrink_to_fit();
+    ASSERT_EQ(small.capacity(), 10u);
+    small_vector<uint64_t, 2> moved(std::move(small));
+    ASSERT_EQ(moved[9], 9u);
+    ASSERT_TRUE(small.empty());
+    moved.clear();
+    moved.shrink_to_fit();
+    ASSERT_EQ(moved.capacity(), 2u);
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+
+#include "containers/arena.h"
+
+TEST(CustomContainer, ArenaAlignment) {
+    vvl::MonotonicArena arena(64);
+    arena.Allocate(1, 1);
+    void *aligned = arena.Allocate(8, 16);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(aligned) % 16, 0u);
+    uint64_t *values = arena.AllocateArray<uint64_t>(4);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(values) % alignof(uint64_t), 0u);
+
+    // Larger than a block
+    void *large = arena.Allocate(1000, 8);
+    ASSERT_NE(large, nullptr);
+    ASSERT_GE(arena.Capacity(), 1000u);
+}
+
+TEST(CustomContainer, ArenaCopy) {
+    vvl::MonotonicArena arena(16);
+    const uint32_t data[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    auto copy = arena.Copy(data, 8);
+    ASSERT_EQ(copy.size(), 8u);
+    ASSERT_NE(copy.data(), data);
+    for (uint32_t i = 0; i < 8; ++i) {
+        ASSERT_EQ(copy[i], data[i]);
+    }
+    auto empty = arena.Copy(data, 0);
+    ASSERT_TRUE(empty.empty());
+}
+
+TEST(CustomContainer, ArenaResetKeepsMemory) {
+    vvl::MonotonicArena arena(32);
+    for (int i = 0; i < 100; ++i) {
+        arena.Allocate(24, 8);
+    }
+    const size_t capacity = arena.Capacity();
+    arena.Reset();
+    for (int j = 0; j < 10; ++j) {
+        for (int i = 0; i < 100; ++i) {
+            arena.Allocate(24, 8);
+        }
+        arena.Reset();
+    }
+    ASSERT_EQ(arena.Capacity(), capacity);
+}
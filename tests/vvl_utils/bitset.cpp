@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <bitset>
+#include <cstdint>
+
+#include "containers/bitset.h"
+
+// Flag constants must not need dynamic initialization
+static constexpr vvl::bitset<192> kBit3 = vvl::bitset<192>(1) << 3;
+static constexpr vvl::bitset<192> kBit130 = vvl::bitset<192>(1) << 130;
+static constexpr vvl::bitset<192> kMask = kBit3 | kBit130;
+static_assert(kMask.count() == 2);
+static_assert(kMask.intersects(kBit130) && !kBit3.intersects(kBit130));
+static_assert(kBit3.is_subset_of(kMask) && !kMask.is_subset_of(kBit3));
+
+TEST(CustomContainer, BitsetMatchesStdBitset) {
+    // Compare to std::bitset with bits on both sides of the word boundaries
+    const size_t positions[] = {0, 1, 63, 64, 65, 127, 128, 150, 191};
+    vvl::bitset<192> a;
+    std::bitset<192> expected_a;
+    for (size_t pos : positions) {
+        a.set(pos);
+        expected_a.set(pos);
+    }
+    vvl::bitset<192> b = a >> 1;
+    std::bitset<192> expected_b = expected_a >> 1;
+
+    auto compare = [](const vvl::bitset<192> &value, const std::bitset<192> &expected) {
+        ASSERT_EQ(value.to_string(), expected.to_string());
+        ASSERT_EQ(value.count(), expected.count());
+        ASSERT_EQ(value.any(), expected.any());
+        ASSERT_EQ(value.all(), expected.all());
+    };
+    compare(a, expected_a);
+    compare(b, expected_b);
+    compare(a & b, expected_a & expected_b);
+    compare(a | b, expected_a | expected_b);
+    compare(a ^ b, expected_a ^ expected_b);
+    compare(~a, ~expected_a);
+    for (size_t shift : {0, 1, 63, 64, 65, 191}) {
+        compare(a << shift, expected_a << shift);
+        compare(a >> shift, expected_a >> shift);
+    }
+    ASSERT_EQ(a.intersects(b), (expected_a & expected_b).any());
+
+    a[64] = false;
+    expected_a[64] = false;
+    compare(a, expected_a);
+    ASSERT_FALSE(a[64]);
+    ASSERT_TRUE(a[65]);
+
+    compare(vvl::bitset<192>().set(), std::bitset<192>().set());
+    compare(vvl::bitset<192>(0x8000000000000001ull), std::bitset<192>(0x8000000000000001ull));
+}
+
+TEST(CustomContainer, BitsetHash) {
+    const vvl::bitset<192> a = vvl::bitset<192>(1) << 100;
+    const vvl::bitset<192> b = vvl::bitset<192>(1) << 101;
+    ASSERT_EQ(std::hash<vvl::bitset<192>>()(a), std::hash<vvl::bitset<192>>()(vvl::bitset<192>(1) << 100));
+    ASSERT_NE(a, b);
+    ASSERT_NE(std::hash<vvl::bitset<192>>()(a), std::hash<vvl::bitset<192>>()(b));
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "containers/concurrent_counter_table.h"
+
+TEST(ConcurrentCounterTable, Limit) {
+    vvl::ConcurrentCounterTable<4> table;
+    ASSERT_EQ(table.Get(7), 0u);
+    for (uint32_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(table.IncrementBelow(7, 3));
+    }
+    ASSERT_FALSE(table.IncrementBelow(7, 3));
+    ASSERT_EQ(table.Get(7), 3u);
+
+    // Same slot as 7, and 0 is a valid key
+    ASSERT_TRUE(table.IncrementBelow(7 + 16, 1));
+    ASSERT_FALSE(table.IncrementBelow(7 + 16, 1));
+    ASSERT_TRUE(table.IncrementBelow(0, 1));
+    ASSERT_FALSE(table.IncrementBelow(0, 1));
+    ASSERT_EQ(table.Get(7), 3u);
+
+    // Fill the 13 slots left, new keys are then never limited
+    for (uint32_t key = 100; key < 113; ++key) {
+        ASSERT_TRUE(table.IncrementBelow(key, 1));
+        ASSERT_FALSE(table.IncrementBelow(key, 1));
+    }
+    ASSERT_TRUE(table.IncrementBelow(1000, 1));
+    ASSERT_TRUE(table.IncrementBelow(1000, 1));
+    ASSERT_FALSE(table.IncrementBelow(7, 3));
+}
+
+TEST(ConcurrentCounterTable, Threads) {
+    constexpr uint32_t kThreads = 4;
+    constexpr uint32_t kKeys = 64;
+    constexpr uint32_t kLimit = 100;
+    auto table = std::make_unique<vvl::ConcurrentCounterTable<>>();
+    std::atomic<uint32_t> passed{0};
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&]() {
+            for (uint32_t i = 0; i < kLimit; ++i) {
+                for (uint32_t key = 0; key < kKeys; ++key) {
+                    if (table->IncrementBelow(key * 0x9E3779B9u, kLimit)) {
+                        passed.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    // Exactly kLimit increments of each key went through
+    ASSERT_EQ(passed.load(), kKeys * kLimit);
+    for (uint32_t key = 0; key < kKeys; ++key) {
+        ASSERT_EQ(table->Get(key * 0x9E3779B9u), kLimit);
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <memory>
+#include <thread>
+
+#include "containers/concurrent_state_map.h"
+
+using IntMap = vvl::ConcurrentStateMap<uint64_t, std::shared_ptr<int>>;
+
+TEST(CustomContainer, ConcurrentStateMap) {
+    IntMap map;
+    for (uint64_t i = 1; i <= 100; ++i) {
+        map.insert_or_assign(i, std::make_shared<int>(static_cast<int>(i)));
+    }
+    ASSERT_FALSE(map.insert(5, std::make_shared<int>(0)));
+    ASSERT_EQ(map.size(), 100u);
+
+    int sum = 0;
+    map.ForEach([&sum](const std::shared_ptr<int> &value) { sum += *value; });
+    ASSERT_EQ(sum, 5050);
+    ASSERT_TRUE(map.AnyOf([](const std::shared_ptr<int> &value) { return *value == 42; }));
+
+    auto popped = map.pop(42);
+    ASSERT_NE(popped, map.end());
+    ASSERT_EQ(*popped->second, 42);
+    ASSERT_EQ(map.find(42), map.end());
+    ASSERT_FALSE(map.AnyOf([](const std::shared_ptr<int> &value) { return *value == 42; }));
+
+    // The callback runs with no lock held and can write to the map
+    map.ForEach([&map](const std::shared_ptr<int> &value) { map.insert_or_assign(static_cast<uint64_t>(*value), nullptr); });
+    ASSERT_EQ(map.size(), 99u);
+    ASSERT_EQ(map.find(1)->second, nullptr);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(CustomContainer, ConcurrentStateMapIterateWhileWriting) {
+    IntMap map;
+    std::thread writer([&map]() {
+        for (uint64_t i = 1; i < 4096; ++i) {
+            map.insert(i, std::make_shared<int>(1));
+            if (i > 64) {
+                map.erase(i - 64);
+            }
+        }
+    });
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint64_t count = 0;
+        map.ForEach([&count](const std::shared_ptr<int> &value) { count += static_cast<uint64_t>(*value); });
+        ASSERT_LE(count, 4096u);
+    }
+    writer.join();
+    ASSERT_EQ(map.size(), 64u);
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "containers/counting_bloom_filter.h"
+
+TEST(CountingBloomFilter, AddRemove) {
+    auto filter = std::make_unique<vvl::CountingBloomFilter<>>();
+    ASSERT_FALSE(filter->MayContain(0x1000));
+
+    filter->Add(0x1000);
+    filter->Add(0x2000);
+    ASSERT_TRUE(filter->MayContain(0x1000));
+    ASSERT_TRUE(filter->MayContain(0x2000));
+
+    // Same key added twice is only gone after both are removed
+    filter->Add(0x1000);
+    filter->Remove(0x1000);
+    ASSERT_TRUE(filter->MayContain(0x1000));
+    filter->Remove(0x1000);
+    ASSERT_FALSE(filter->MayContain(0x1000));
+    ASSERT_TRUE(filter->MayContain(0x2000));
+
+    filter->Remove(0x2000);
+    ASSERT_FALSE(filter->MayContain(0x2000));
+}
+
+TEST(CountingBloomFilter, FalsePositives) {
+    auto filter = std::make_unique<vvl::CountingBloomFilter<>>();
+    // Handles of a driver counting up, well below the 64K counters
+    constexpr uint64_t kKeys = 4096;
+    for (uint64_t key = 1; key <= kKeys; ++key) {
+        filter->Add(key);
+    }
+    for (uint64_t key = 1; key <= kKeys; ++key) {
+        ASSERT_TRUE(filter->MayContain(key));
+    }
+    uint32_t false_positives = 0;
+    for (uint64_t key = kKeys + 1; key <= kKeys * 2; ++key) {
+        false_positives += filter->MayContain(key) ? 1 : 0;
+    }
+    // About 0.5% expected for 3 hashes at this load
+    ASSERT_LT(false_positives, kKeys / 50);
+
+    for (uint64_t key = 1; key <= kKeys; ++key) {
+        filter->Remove(key);
+    }
+    for (uint64_t key = 1; key <= kKeys * 2; ++key) {
+        ASSERT_FALSE(filter->MayContain(key));
+    }
+}
+
+TEST(CountingBloomFilter, Saturated) {
+    vvl::CountingBloomFilter<4> filter;
+    // Far more adds than a counter can count, the keys must never be forgotten
+    for (uint64_t key = 0; key < 4096; ++key) {
+        filter.Add(key);
+    }
+    for (uint64_t key = 0; key < 4095; ++key) {
+        filter.Remove(key);
+    }
+    ASSERT_TRUE(filter.MayContain(4095));
+}
+
+TEST(CountingBloomFilter, Threads) {
+    constexpr uint32_t kThreads = 4;
+    constexpr uint64_t kKeys = 1024;
+    auto filter = std::make_unique<vvl::CountingBloomFilter<>>();
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&filter, t]() {
+            const uint64_t base = uint64_t(t + 1) << 40;
+            for (uint64_t key = 0; key < kKeys; ++key) {
+                filter->Add(base + key);
+            }
+            // Every other key is removed again
+            for (uint64_t key = 0; key < kKeys; key += 2) {
+                filter->Remove(base + key);
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        const uint64_t base = uint64_t(t + 1) << 40;
+        for (uint64_t key = 1; key < kKeys; key += 2) {
+            ASSERT_TRUE(filter->MayContain(base + key));
+        }
+    }
+}
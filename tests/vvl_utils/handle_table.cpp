@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "containers/handle_table.h"
+
+TEST(CustomContainer, HandleTableBasic) {
+    vvl::HandleTable table;
+    const uint64_t a = table.insert(0x1000);
+    const uint64_t b = table.insert(0x2000);
+    ASSERT_NE(a, 0u);
+    ASSERT_NE(b, 0u);
+    ASSERT_NE(a, b);
+
+    ASSERT_TRUE(table.find(a) != table.end());
+    ASSERT_EQ(table.find(a)->second, 0x1000u);
+    ASSERT_EQ(table.find(b)->second, 0x2000u);
+    ASSERT_TRUE(table.find(0) == table.end());
+
+    auto popped = table.pop(a);
+    ASSERT_TRUE(popped != table.end());
+    ASSERT_EQ(popped->second, 0x1000u);
+    ASSERT_TRUE(table.find(a) == table.end());
+    ASSERT_TRUE(table.pop(a) == table.end());
+
+    // The slot of a gets reused, but the stale id must not alias it
+    const uint64_t c = table.insert(0x3000);
+    ASSERT_NE(c, a);
+    ASSERT_TRUE(table.find(a) == table.end());
+    ASSERT_EQ(table.find(c)->second, 0x3000u);
+
+    ASSERT_FALSE(table.erase(a));
+    ASSERT_TRUE(table.erase(c));
+    ASSERT_TRUE(table.erase(b));
+    ASSERT_TRUE(table.find(b) == table.end());
+}
+
+TEST(CustomContainer, HandleTableConcurrent) {
+    vvl::HandleTable table;
+    const uint64_t shared_id = table.insert(42);
+    constexpr uint32_t kThreads = 4;
+    constexpr uint64_t kIterations = 10000;
+
+    std::vector<std::thread> threads;
+    std::atomic<bool> failed{false};
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&table, &failed, shared_id, t]() {
+            for (uint64_t i = 1; i <= kIterations; ++i) {
+                const uint64_t value = (uint64_t(t) << 32) | i;
+                const uint64_t id = table.insert(value);
+                auto found = table.find(id);
+                if (found == table.end() || found->second != value || table.find(shared_id)->second != 42) {
+                    failed = true;
+                }
+                table.erase(id);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_FALSE(failed);
+    ASSERT_EQ(table.find(shared_id)->second, 42u);
+}
+
+TEST(CustomContainer, HandleSlotArray) {
+    vvl::HandleTable table;
+    vvl::HandleSlotArray<uint64_t> slots;
+    const uint64_t a = table.insert(0x1000);
+    const uint64_t b = table.insert(0x2000);
+    ASSERT_EQ(slots.Find(a), nullptr);
+
+    slots.Get(a) = a;
+    slots.Get(b) = b;
+    ASSERT_NE(slots.Find(a), nullptr);
+    ASSERT_EQ(*slots.Find(a), a);
+    ASSERT_EQ(&slots.Get(b), slots.Find(b));
+
+    // A reused slot is shared with the stale id, the stored value tells them apart
+    table.erase(a);
+    const uint64_t c = table.insert(0x3000);
+    ASSERT_EQ(slots.Find(c), slots.Find(a));
+    ASSERT_NE(*slots.Find(c), c);
+}
+
+TEST(CustomContainer, HandleSlotArrayForEach) {
+    vvl::HandleTable table;
+    vvl::HandleSlotArray<uint64_t> slots;
+    const uint64_t a = table.insert(0x1000);
+    const uint64_t b = table.insert(0x2000);
+    slots.Get(a) = a;
+    slots.Get(b) = b;
+
+    uint64_t used_count = 0;
+    uint64_t slot_count = 0;
+    slots.ForEach([&](uint64_t &slot) {
+        used_count += (slot == a || slot == b) ? 1 : 0;
+        ++slot_count;
+    });
+    ASSERT_EQ(used_count, 2u);
+    // Both ids are in the first block, its unused slots are visited too
+    ASSERT_GT(slot_count, 2u);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "containers/index_map.h"
+
+TEST(IndexMap, FindAndIterateInKeyOrder) {
+    vvl::IndexMap<std::string> map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_TRUE(map.emplace(3, "three").second);
+    ASSERT_TRUE(map.emplace(0, "zero").second);
+    ASSERT_FALSE(map.emplace(3, "other").second);
+    map.insert_or_assign(7, std::string("seven"));
+    map.insert_or_assign(0, std::string("ZERO"));
+    ASSERT_EQ(map.size(), 3u);
+
+    ASSERT_EQ(*vvl::Find(map, 3), "three");
+    ASSERT_EQ(*vvl::Find(map, 0), "ZERO");
+    ASSERT_EQ(vvl::Find(map, 1), nullptr);
+    ASSERT_EQ(vvl::Find(map, 100), nullptr);
+
+    std::vector<uint32_t> keys;
+    for (const auto &[key, value] : map) {
+        keys.push_back(key);
+    }
+    ASSERT_EQ(keys, (std::vector<uint32_t>{0, 3, 7}));
+
+    ASSERT_EQ(map.erase(3), 1u);
+    ASSERT_EQ(map.erase(3), 0u);
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_FALSE(map.contains(3));
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.begin(), map.end());
+}
+
+TEST(IndexMap, LargeKeys) {
+    vvl::IndexMap<int, 16> map;
+    map.emplace(0xFFFFFFFF, 1);
+    map.emplace(1000, 2);
+    map.emplace(15, 3);
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_EQ(*vvl::Find(map, 0xFFFFFFFF), 1);
+    ASSERT_EQ(*vvl::Find(map, 1000), 2);
+    ASSERT_EQ(*vvl::Find(map, 15), 3);
+
+    ASSERT_EQ(map.erase(1000), 1u);
+    map.emplace(2000, 4);
+    int sum = 0;
+    for (const auto &entry : map) {
+        sum += entry.second;
+    }
+    ASSERT_EQ(sum, 8);
+}
+
+TEST(IndexMap, NestedCopy) {
+    vvl::IndexMap<vvl::IndexMap<int>> map;
+    map.emplace(2).first->second.emplace(5, 10);
+    vvl::IndexMap<vvl::IndexMap<int>> copy;
+    copy = map;
+    map.clear();
+    ASSERT_EQ(*vvl::Find(*vvl::Find(copy, 2), 5), 10);
+    map.insert_or_assign(2, copy.find(2)->second);
+    ASSERT_EQ(map.size(), 1u);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "containers/interval_overlap.h"
+
+using IndexPairs = std::vector<std::pair<uint32_t, uint32_t>>;
+
+static IndexPairs SweepPairs(std::vector<vvl::TaggedInterval> a, std::vector<vvl::TaggedInterval> b) {
+    IndexPairs pairs;
+    vvl::ForEachIntersectingPair(a, b, [&pairs](uint32_t a_index, uint32_t b_index) { pairs.emplace_back(a_index, b_index); });
+    return pairs;
+}
+
+static IndexPairs BruteForcePairs(const std::vector<vvl::TaggedInterval> &a, const std::vector<vvl::TaggedInterval> &b) {
+    IndexPairs pairs;
+    for (const auto &x : a) {
+        for (const auto &y : b) {
+            if (std::max(x.begin, y.begin) < std::min(x.end, y.end)) {
+                pairs.emplace_back(x.index, y.index);
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+TEST(CustomContainer, IntervalOverlapBasic) {
+    // Touching intervals do not overlap, empty and inverted intervals never overlap
+    const std::vector<vvl::TaggedInterval> a = {{0, 10, 0}, {10, 20, 1}, {5, 5, 2}, {30, 25, 3}};
+    const std::vector<vvl::TaggedInterval> b = {{15, 30, 0}, {0, 1, 1}, {20, 40, 2}, {5, 6, 3}};
+    const IndexPairs expected = {{0, 1}, {0, 3}, {1, 0}};
+    ASSERT_EQ(SweepPairs(a, b), expected);
+    ASSERT_TRUE(SweepPairs(a, {}).empty());
+}
+
+TEST(CustomContainer, IntervalOverlapMatchesBruteForce) {
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int64_t> position(-50, 50);
+    std::uniform_int_distribution<int64_t> length(-5, 20);
+    for (uint32_t iteration = 0; iteration < 100; ++iteration) {
+        std::vector<vvl::TaggedInterval> a;
+        std::vector<vvl::TaggedInterval> b;
+        for (uint32_t i = 0; i < 32; ++i) {
+            const int64_t a_begin = position(rng);
+            const int64_t b_begin = position(rng);
+            a.emplace_back(vvl::TaggedInterval{a_begin, a_begin + length(rng), i});
+            b.emplace_back(vvl::TaggedInterval{b_begin, b_begin + length(rng), i});
+        }
+        ASSERT_EQ(SweepPairs(a, b), BruteForcePairs(a, b));
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "error_message/json_message_log.h"
+
+static std::string ReadAll(FILE *file) {
+    rewind(file);
+    std::string content;
+    char buffer[256];
+    size_t read = 0;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        content.append(buffer, read);
+    }
+    return content;
+}
+
+TEST(JsonMessageLog, AppendString) {
+    std::string out;
+    vvl::JsonMessageLog::AppendString(out, "a\"b\\c\nd\x01");
+    ASSERT_EQ(out, "\"a\\\"b\\\\c\\nd\\u0001\"");
+}
+
+TEST(JsonMessageLog, Write) {
+    const char *filename = "json_message_log_test.json";
+    FILE *file = fopen(filename, "w");
+    ASSERT_NE(file, nullptr);
+    // The log owns the file, a second one reads it back
+    FILE *read_file = fopen(filename, "r");
+    ASSERT_NE(read_file, nullptr);
+    {
+        vvl::JsonMessageLog log(file, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT);
+        std::vector<VkDebugUtilsObjectNameInfoEXT> objects(2);
+        objects[0].objectType = VK_OBJECT_TYPE_BUFFER;
+        objects[0].objectHandle = 0x10;
+        objects[1].objectType = VK_OBJECT_TYPE_IMAGE;
+        objects[1].objectHandle = 0x20;
+        const std::vector<std::string> names = {"vertices", ""};
+        log.Write(VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, "VUID-x", 0x1234, nullptr, objects, names, "bad \"size\"");
+        log.Write(VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, nullptr, 0, nullptr, {}, {}, "second");
+        // Batched until flushed
+        ASSERT_TRUE(ReadAll(read_file).empty());
+        log.Flush();
+        ASSERT_EQ(ReadAll(read_file),
+                  "{\"severity\":\"error\",\"vuid\":\"VUID-x\",\"id\":\"0x00001234\",\"objects\":["
+                  "{\"type\":\"VK_OBJECT_TYPE_BUFFER\",\"handle\":\"0x10\",\"name\":\"vertices\"},"
+                  "{\"type\":\"VK_OBJECT_TYPE_IMAGE\",\"handle\":\"0x20\"}],\"message\":\"bad \\\"size\\\"\"}\n"
+                  "{\"severity\":\"error\",\"vuid\":\"\",\"id\":\"0x00000000\",\"objects\":[],\"message\":\"second\"}\n");
+    }
+    fclose(read_file);
+    remove(filename);
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <vector>
+
+#include "error_message/error_location.h"
+#include "error_message/record_object.h"
+
+TEST(LocationCapture, RoundTrip) {
+    const Location submit_loc(vvl::Func::vkQueueSubmit, vvl::Field::pSubmits, 1);
+    const Location cb_loc = submit_loc.dot(vvl::Struct::VkSubmitInfo, vvl::Field::pCommandBuffers, 2);
+    const Location pnext_loc =
+        submit_loc.pNext(vvl::Struct::VkTimelineSemaphoreSubmitInfo, vvl::Field::pSignalSemaphoreValues, 0);
+
+    std::vector<vvl::LocationCapture> captures;
+    {
+        const vvl::EncodedLocation encoded(cb_loc);
+        captures.emplace_back(encoded);
+        captures.emplace_back(pnext_loc);
+        captures.emplace_back(submit_loc);
+    }
+    // Copies (including the ones done when the vector grows) must not point into the capture they came from
+    captures.push_back(captures[0]);
+    captures[2] = captures[1];
+
+    ASSERT_EQ(captures[0].Get().Message(), cb_loc.Message());
+    ASSERT_EQ(captures[1].Get().Message(), pnext_loc.Message());
+    ASSERT_EQ(captures[2].Get().Message(), pnext_loc.Message());
+    ASSERT_EQ(captures[3].Get().Message(), cb_loc.Message());
+    ASSERT_EQ(captures[0].Get().function, vvl::Func::vkQueueSubmit);
+    ASSERT_TRUE(captures[1].Get().isPNext);
+}
+
+// Entry point locations are built at compile time
+static constexpr Location kConstexprSubmitLoc(vvl::Func::vkQueueSubmit, vvl::Field::pSubmits, 1);
+static_assert(kConstexprSubmitLoc.function == vvl::Func::vkQueueSubmit);
+static_assert(kConstexprSubmitLoc.structure == vvl::Struct::Empty);
+static_assert(kConstexprSubmitLoc.index == 1);
+static_assert(kConstexprSubmitLoc.prev == nullptr);
+static_assert(kConstexprSubmitLoc.dot(vvl::Struct::VkSubmitInfo, vvl::Field::pCommandBuffers, 2).prev == &kConstexprSubmitLoc);
+static_assert(RecordObject(vvl::Func::vkCmdDraw).location.function == vvl::Func::vkCmdDraw);
+
+TEST(LocationCapture, ConstexprLocation) {
+    const Location cb_loc = kConstexprSubmitLoc.dot(vvl::Struct::VkSubmitInfo, vvl::Field::pCommandBuffers, 2);
+    ASSERT_EQ(cb_loc.Fields(), "pSubmits[1].pCommandBuffers[2]");
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+
+#include "utils/lock_profiling.h"
+
+TEST(LockProfiling, ContentionIsRecorded) {
+    using Mutex = vvl::ProfiledSharedMutex<vvl::ProfiledLock::BufferAddress>;
+    vvl::lock_profiling::Enable();
+    vvl::lock_profiling::Reset();
+    const auto &stats = vvl::lock_profiling::Stats(vvl::ProfiledLock::BufferAddress);
+
+    Mutex mutex;
+    {
+        std::shared_lock<Mutex> first(mutex);
+        std::shared_lock<Mutex> second(mutex);
+    }
+    ASSERT_EQ(stats.acquisitions.load(), 2u);
+    ASSERT_EQ(stats.contended.load(), 0u);
+
+    std::atomic<bool> waiting{false};
+    std::unique_lock<Mutex> lock(mutex);
+    std::thread waiter([&]() {
+        waiting = true;
+        std::unique_lock<Mutex> waiter_lock(mutex);
+    });
+    while (!waiting) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    lock.unlock();
+    waiter.join();
+
+    ASSERT_EQ(stats.acquisitions.load(), 4u);
+    ASSERT_EQ(stats.contended.load(), 1u);
+    ASSERT_GT(stats.wait_ns.load(), 0u);
+    ASSERT_EQ(stats.max_wait_ns.load(), stats.wait_ns.load());
+    ASSERT_GE(stats.hold_ns.load(), stats.wait_ns.load());
+    uint64_t histogram_count = 0;
+    for (const auto &count : stats.wait_histogram) {
+        histogram_count += count.load();
+    }
+    ASSERT_EQ(histogram_count, 1u);
+
+    const std::string report = vvl::lock_profiling::Report();
+    ASSERT_NE(report.find("ValidationStateTracker::buffer_address_lock_: 4 acquisitions, 1 contended"), std::string::npos);
+    ASSERT_EQ(report.find("StateObject::tree_lock_"), std::string::npos);
+
+    const std::string json = vvl::lock_profiling::ReportJson();
+    ASSERT_EQ(json.front(), '[');
+    ASSERT_EQ(json.back(), ']');
+    ASSERT_NE(json.find("{\"lock\":\"ValidationStateTracker::buffer_address_lock_\",\"acquisitions\":4,\"contended\":1,"),
+              std::string::npos);
+    ASSERT_NE(json.find("{\"lock\":\"StateObject::tree_lock_\",\"acquisitions\":0,"), std::string::npos);
+    vvl::lock_profiling::Reset();
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "containers/node_pool_allocator.h"
+#include "utils/memory_accounting.h"
+
+// The counters are process wide, only differences are checked
+
+TEST(MemoryAccounting, TaggedAllocator) {
+    constexpr vvl::MemoryTag kTag = vvl::MemoryTag::SyncvalAccessLogs;
+    const uint64_t before = vvl::memory_accounting::CurrentBytes(kTag);
+    {
+        std::vector<uint64_t, vvl::TaggedAllocator<uint64_t, kTag>> values;
+        values.reserve(100);
+        ASSERT_EQ(vvl::memory_accounting::CurrentBytes(kTag), before + 100 * sizeof(uint64_t));
+        ASSERT_GE(vvl::memory_accounting::PeakBytes(kTag), before + 100 * sizeof(uint64_t));
+    }
+    ASSERT_EQ(vvl::memory_accounting::CurrentBytes(kTag), before);
+}
+
+TEST(MemoryAccounting, NodePoolBlocks) {
+    constexpr vvl::MemoryTag kTag = vvl::MemoryTag::SyncvalAccessMaps;
+    using PooledMap =
+        std::map<uint32_t, uint64_t, std::less<uint32_t>, vvl::NodePoolAllocator<std::pair<const uint32_t, uint64_t>, kTag>>;
+    const uint64_t before = vvl::memory_accounting::CurrentBytes(kTag);
+    {
+        PooledMap map;
+        for (uint32_t i = 0; i < 64; ++i) {
+            map.emplace(i, i);
+        }
+        ASSERT_GE(vvl::memory_accounting::CurrentBytes(kTag), before + 64 * sizeof(std::pair<const uint32_t, uint64_t>));
+
+        // The last node gives the blocks back
+        map.clear();
+        ASSERT_EQ(vvl::memory_accounting::CurrentBytes(kTag), before);
+        map.emplace(1u, 1u);
+    }
+    ASSERT_EQ(vvl::memory_accounting::CurrentBytes(kTag), before);
+}
+
+TEST(MemoryAccounting, Report) {
+    vvl::AccountedMemory memory(vvl::MemoryTag::SpirvModules, 4096);
+    const std::string report = vvl::memory_accounting::Report();
+    ASSERT_NE(report.find(vvl::memory_accounting::Name(vvl::MemoryTag::SpirvModules)), std::string::npos);
+    const std::string json = vvl::memory_accounting::ReportJson();
+    ASSERT_EQ(json.front(), '[');
+    ASSERT_EQ(json.back(), ']');
+    ASSERT_NE(json.find("\"peak_bytes\":"), std::string::npos);
+
+    vvl::memory_accounting::ResetPeaks();
+    ASSERT_EQ(vvl::memory_accounting::PeakBytes(vvl::MemoryTag::SpirvModules),
+              vvl::memory_accounting::CurrentBytes(vvl::MemoryTag::SpirvModules));
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "containers/mpsc_queue.h"
+
+TEST(MpscQueue, SingleThread) {
+    vvl::MpscQueue<std::unique_ptr<int>> queue;
+    ASSERT_FALSE(queue.TryPop().has_value());
+    for (int i = 0; i < 3; ++i) {
+        queue.Push(std::make_unique<int>(i));
+    }
+    for (int i = 0; i < 3; ++i) {
+        auto value = queue.TryPop();
+        ASSERT_TRUE(value.has_value());
+        ASSERT_EQ(**value, i);
+    }
+    ASSERT_FALSE(queue.TryPop().has_value());
+
+    // Values still queued are freed with the queue
+    queue.Push(std::make_unique<int>(3));
+}
+
+TEST(MpscQueue, MultipleProducers) {
+    constexpr uint32_t kProducers = 4;
+    constexpr uint32_t kValuesPerProducer = 10000;
+    vvl::MpscQueue<uint64_t> queue;
+
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < kProducers; ++producer) {
+        producers.emplace_back([&queue, producer]() {
+            for (uint32_t i = 0; i < kValuesPerProducer; ++i) {
+                queue.Push((uint64_t(producer) << 32) | i);
+            }
+        });
+    }
+
+    // Each producer's values must come out in the order it pushed them
+    std::vector<uint32_t> next_value(kProducers, 0);
+    uint32_t popped = 0;
+    while (popped < kProducers * kValuesPerProducer) {
+        auto value = queue.TryPop();
+        if (!value) {
+            std::this_thread::yield();
+            continue;
+        }
+        const uint32_t producer = static_cast<uint32_t>(*value >> 32);
+        ASSERT_LT(producer, kProducers);
+        ASSERT_EQ(static_cast<uint32_t>(*value), next_value[producer]);
+        ++next_value[producer];
+        ++popped;
+    }
+    for (std::thread &producer : producers) {
+        producer.join();
+    }
+    ASSERT_FALSE(queue.TryPop().has_value());
+}
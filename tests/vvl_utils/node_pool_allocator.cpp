@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "containers/node_pool_allocator.h"
+#include "containers/range_vector.h"
+
+using PooledMap = std::map<uint32_t, uint64_t, std::less<uint32_t>, vvl::NodePoolAllocator<std::pair<const uint32_t, uint64_t>>>;
+
+TEST(CustomContainer, NodePoolReuse) {
+    PooledMap map;
+    for (uint32_t i = 0; i < 100; ++i) {
+        map.emplace(i, i * 2);
+    }
+    const size_t blocks = map.get_allocator().pool().BlockCount();
+    ASSERT_GT(blocks, 0u);
+
+    // Erasing and inserting the same amount must not need more memory
+    for (uint32_t i = 0; i < 50; ++i) {
+        map.erase(i);
+    }
+    for (uint32_t i = 100; i < 150; ++i) {
+        map.emplace(i, i * 2);
+    }
+    ASSERT_EQ(map.get_allocator().pool().BlockCount(), blocks);
+    ASSERT_EQ(map.size(), 100u);
+    ASSERT_EQ(map.at(120), 240u);
+
+    // Empty map gives the memory back
+    map.clear();
+    ASSERT_EQ(map.get_allocator().pool().BlockCount(), 0u);
+}
+
+TEST(CustomContainer, NodePoolCopyMove) {
+    PooledMap map;
+    map.emplace(1u, 2u);
+    map.emplace(3u, 4u);
+
+    PooledMap copy(map);
+    ASSERT_NE(copy.get_allocator(), map.get_allocator());
+    map.clear();
+    ASSERT_EQ(copy.size(), 2u);
+    ASSERT_EQ(copy.at(3), 4u);
+
+    PooledMap moved(std::move(copy));
+    ASSERT_EQ(moved.size(), 2u);
+    // The moved from map shares the pool and is still usable
+    copy.emplace(5u, 6u);
+    ASSERT_EQ(copy.at(5), 6u);
+    moved = copy;
+    ASSERT_EQ(moved.size(), 1u);
+    ASSERT_EQ(moved.at(5), 6u);
+}
+
+TEST(CustomContainer, PooledRangeMap) {
+    using Map = sparse_container::pooled_range_map<uint64_t, uint32_t>;
+    using Range = sparse_container::range<uint64_t>;
+    Map map;
+    map.insert(std::make_pair(Range(0, 16), 1u));
+    map.insert(std::make_pair(Range(32, 48), 2u));
+    map.overwrite_range(std::make_pair(Range(8, 40), 3u));
+
+    std::vector<std::pair<Range, uint32_t>> expected = {{Range(0, 8), 1u}, {Range(8, 40), 3u}, {Range(40, 48), 2u}};
+    ASSERT_EQ(map.size(), expected.size());
+    size_t i = 0;
+    for (const auto &[range, value] : map) {
+        ASSERT_EQ(range, expected[i].first);
+        ASSERT_EQ(value, expected[i].second);
+        ++i;
+    }
+}
+
+TEST(CustomContainer, TypedPoolAllocatorSharedReuse) {
+    if (vvl::allocator::kCachesPerThread) {
+        GTEST_SKIP() << "The objects don't go through the pool with a vvl::allocator caching per thread";
+    }
+    struct Object {
+        explicit Object(uint64_t v) : value(v) {}
+        uint64_t value;
+    };
+    std::vector<std::shared_ptr<Object>> objects;
+    for (uint64_t i = 0; i < 100; ++i) {
+        objects.emplace_back(std::allocate_shared<Object>(vvl::TypedPoolAllocator<Object>(), i));
+    }
+    ASSERT_EQ(objects[42]->value, 42u);
+
+    // The last freed object and control block are handed out first
+    const Object *freed = objects.back().get();
+    objects.pop_back();
+    auto reused = std::allocate_shared<Object>(vvl::TypedPoolAllocator<Object>(), 7u);
+    ASSERT_EQ(reused.get(), freed);
+    ASSERT_EQ(reused->value, 7u);
+
+    // Memory is kept for the next objects of the type
+    using Pool = vvl::TypedPoolAllocator<uint64_t>;
+    uint64_t *value = Pool().allocate(1);
+    Pool().deallocate(value, 1);
+    ASSERT_GT(Pool::Pool().BlockCount(), 0u);
+    uint64_t *next_value = Pool().allocate(1);
+    Pool().deallocate(next_value, 1);
+    ASSERT_EQ(next_value, value);
+}
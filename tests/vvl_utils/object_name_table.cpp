@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <string>
+
+#include "error_message/object_name_table.h"
+
+TEST(ObjectNameTable, SetAndGet) {
+    vvl::ObjectNameTable table;
+    ASSERT_EQ(table.Get(1), nullptr);
+
+    table.Set(1, "buffer");
+    table.Set(2, "buffer");
+    table.Set(3, "image");
+    ASSERT_EQ(*table.Get(1), "buffer");
+    ASSERT_EQ(*table.Get(3), "image");
+    // Same name, same string
+    ASSERT_EQ(table.Get(1), table.Get(2));
+    ASSERT_EQ(table.InternedCount(), 2u);
+
+    table.Set(1, "");
+    table.Set(2, nullptr);
+    ASSERT_EQ(table.Get(1), nullptr);
+    ASSERT_EQ(table.Get(2), nullptr);
+    ASSERT_EQ(*table.Get(3), "image");
+}
+
+TEST(ObjectNameTable, UnusedNamesAreDropped) {
+    vvl::ObjectNameTable table;
+    // Every object gets renamed, only the last names stay referenced
+    for (uint64_t object = 1; object <= 16; ++object) {
+        for (uint32_t i = 0; i < 32; ++i) {
+            table.Set(object, ("object " + std::to_string(object) + " version " + std::to_string(i)).c_str());
+        }
+    }
+    ASSERT_LT(table.InternedCount(), 16u * 32u);
+    ASSERT_EQ(*table.Get(16), "object 16 version 31");
+}
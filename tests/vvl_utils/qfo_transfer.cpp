@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <vector>
+
+#include "containers/qfo_transfer.h"
+
+static QFOBufferTransferBarrier MakeBufferTransfer(uint64_t handle, uint32_t src, uint32_t dst, VkDeviceSize offset) {
+    QFOBufferTransferBarrier barrier;
+    barrier.handle = CastFromUint64<VkBuffer>(handle);
+    barrier.srcQueueFamilyIndex = src;
+    barrier.dstQueueFamilyIndex = dst;
+    barrier.offset = offset;
+    barrier.size = 64;
+    return barrier;
+}
+
+TEST(CustomContainer, QFOTransferBarrierList) {
+    QFOTransferBarrierList<QFOBufferTransferBarrier> list;
+    const auto a = MakeBufferTransfer(1, 0, 1, 0);
+    const auto b = MakeBufferTransfer(1, 0, 1, 64);
+    const auto c = MakeBufferTransfer(1, 1, 0, 0);
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.Find(a), nullptr);
+
+    list.Insert(c);
+    list.Insert(a);
+    list.Insert(b);
+    list.Insert(a);
+    ASSERT_NE(list.Find(a), nullptr);
+    ASSERT_NE(list.Find(b), nullptr);
+    ASSERT_NE(list.Find(c), nullptr);
+
+    // Copies are independent, the global map hands out copies
+    const auto copy = list;
+    list.Erase(b);
+    ASSERT_EQ(list.Find(b), nullptr);
+    ASSERT_NE(list.Find(a), nullptr);
+    ASSERT_NE(list.Find(c), nullptr);
+    ASSERT_NE(copy.Find(b), nullptr);
+
+    list.Erase(b);
+    list.Erase(a);
+    list.Erase(c);
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(CustomContainer, QFOTransferBarriersSortedByResource) {
+    QFOTransferBarrierSet<QFOBufferTransferBarrier> set;
+    for (uint64_t handle = 1; handle <= 8; ++handle) {
+        set.emplace(MakeBufferTransfer(handle, 0, 1, 0));
+        set.emplace(MakeBufferTransfer(handle, 0, 1, 128));
+    }
+    const auto sorted = SortedQFOTransferBarriers(set);
+    ASSERT_EQ(sorted.size(), set.size());
+    for (size_t i = 1; i < sorted.size(); ++i) {
+        ASSERT_TRUE(*sorted[i - 1] < *sorted[i]);
+        ASSERT_LE(CastToUint64(sorted[i - 1]->handle), CastToUint64(sorted[i]->handle));
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <utility>
+
+#include "containers/range_vector.h"
+
+using Range = sparse_container::range<uint32_t>;
+
+template <typename Map>
+static void CheckConsolidate() {
+    Map map;
+    map.insert(std::make_pair(Range(0, 4), 1u));
+    map.insert(std::make_pair(Range(4, 8), 2u));
+    map.insert(std::make_pair(Range(8, 12), 1u));
+    map.insert(std::make_pair(Range(12, 16), 2u));
+    map.insert(std::make_pair(Range(20, 24), 2u));
+
+    // Update of [4, 8) in two pieces, the runs touching it merge
+    map.overwrite_range(std::make_pair(Range(4, 6), 1u));
+    map.overwrite_range(std::make_pair(Range(6, 8), 1u));
+    ASSERT_EQ(map.size(), 6u);
+    sparse_container::consolidate(map, Range(4, 8));
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_EQ(map.find(uint32_t(5))->first, Range(0, 12));
+    ASSERT_EQ(map.find(uint32_t(5))->second, 1u);
+    ASSERT_EQ(map.find(uint32_t(12))->first, Range(12, 16));
+
+    // Ranges after the updated range are left for the next update or consolidate
+    map.insert(std::make_pair(Range(16, 18), 2u));
+    map.insert(std::make_pair(Range(18, 20), 2u));
+    sparse_container::consolidate(map, Range(0, 4));
+    ASSERT_EQ(map.size(), 5u);
+
+    // Equal values across the gap don't merge
+    map.erase(map.find(uint32_t(18)));
+    sparse_container::consolidate(map);
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_EQ(map.find(uint32_t(12))->first, Range(12, 18));
+    ASSERT_EQ(map.find(uint32_t(20))->first, Range(20, 24));
+}
+
+TEST(CustomContainer, RangeMapConsolidate) { CheckConsolidate<sparse_container::range_map<uint32_t, uint32_t>>(); }
+
+TEST(CustomContainer, SmallRangeMapConsolidate) {
+    CheckConsolidate<sparse_container::small_range_map<uint32_t, uint32_t, Range, 32>>();
+}
@@ -17,6 +17,7 @@
 #include <cstring>
 #include <array>
 #include <cstdarg>
+#include <memory>
 #include <vector>
 
 #include <vulkan/utility/vk_struct_helper.hpp>
@@ -425,6 +426,24 @@ TEST(CustomContainer, SmallVectorAssign) {
     ASSERT_TRUE(HaveSameElements(ref_xxl, v_dst));
 }
 
+TEST(CustomContainer, SmallVectorEmplaceMoveOnly) {
+    struct MoveOnly {
+        MoveOnly(std::unique_ptr<int> &&p, int v) : ptr(std::move(p)), value(v) {}
+        std::unique_ptr<int> ptr;
+        int value;
+    };
+    small_vector<MoveOnly, 2> sv;
+    for (int i = 0; i < 4; ++i) {
+        sv.emplace_back(std::make_unique<int>(i), i * 2);
+    }
+    small_vector<MoveOnly, 2> moved(std::move(sv));
+    ASSERT_EQ(moved.size(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ(*moved[i].ptr, i);
+        ASSERT_EQ(moved[i].value, i * 2);
+    }
+}
+
 TEST(CustomContainer, Enumerate) {
     small_vector<int, 2, size_t> sv = {1, 2, 3, 4};
     std::array ref_elements = {1, 2, 3, 4};
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <vector>
+
+#include "utils/spirv_analysis_cache.h"
+
+static std::shared_ptr<spirv::AnalysisResult> MakeResult() {
+    auto result = std::make_shared<spirv::AnalysisResult>();
+    auto &vertex = result->entry_points.emplace_back();
+    vertex.accessible_ids = {4, 8, 15, 16};
+    auto &geometry = result->entry_points.emplace_back();
+    geometry.emit_vertex_geometry = true;
+    geometry.accessible_ids = {23, 42};
+    result->function_arguments = {{7, 9}, {7, 11}, {12, 9}};
+    return result;
+}
+
+TEST(SpirvAnalysisCache, RoundTrip) {
+    const std::vector<uint32_t> words = {0x07230203, 0x00010000, 0, 100, 0};
+    const hash_util::Hash128 key = hash_util::ShaderHash128(words.data(), words.size() * sizeof(uint32_t));
+
+    spirv::AnalysisCache cache;
+    cache.Insert(key, MakeResult());
+    const std::vector<char> data = cache.Write();
+
+    spirv::AnalysisCache loaded;
+    loaded.Load(data);
+    ASSERT_EQ(loaded.Size(), 1u);
+    auto result = loaded.Find(key);
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(result->entry_points.size(), 2u);
+    ASSERT_FALSE(result->entry_points[0].emit_vertex_geometry);
+    ASSERT_EQ(result->entry_points[0].accessible_ids, (std::vector<uint32_t>{4, 8, 15, 16}));
+    ASSERT_TRUE(result->entry_points[1].emit_vertex_geometry);
+    ASSERT_EQ(result->entry_points[1].accessible_ids, (std::vector<uint32_t>{23, 42}));
+    ASSERT_EQ(result->function_arguments, (std::vector<std::pair<uint32_t, uint32_t>>{{7, 9}, {7, 11}, {12, 9}}));
+
+    // Different code, different key
+    const std::vector<uint32_t> other_words = {0x07230203, 0x00010000, 0, 101, 0};
+    ASSERT_EQ(loaded.Find(hash_util::ShaderHash128(other_words.data(), other_words.size() * sizeof(uint32_t))), nullptr);
+}
+
+TEST(SpirvAnalysisCache, WholeKeyRoundTrips) {
+    // Only the high half differs
+    const hash_util::Hash128 key_a{0x0123456789abcdefull, 1};
+    const hash_util::Hash128 key_b{0x0123456789abcdefull, 0x8000000000000001ull};
+
+    spirv::AnalysisCache cache;
+    cache.Insert(key_a, MakeResult());
+    spirv::AnalysisCache loaded;
+    loaded.Load(cache.Write());
+    ASSERT_NE(loaded.Find(key_a), nullptr);
+    ASSERT_EQ(loaded.Find(key_b), nullptr);
+}
+
+TEST(SpirvAnalysisCache, IgnoresBadData) {
+    spirv::AnalysisCache cache;
+    cache.Insert(hash_util::Hash128{1, 0}, MakeResult());
+    cache.Insert(hash_util::Hash128{2, 0}, MakeResult());
+    std::vector<char> data = cache.Write();
+
+    // Cut in the middle of the second result, only the first one is kept
+    std::vector<char> truncated(data.begin(), data.end() - 8);
+    spirv::AnalysisCache partial;
+    partial.Load(truncated);
+    ASSERT_EQ(partial.Size(), 1u);
+
+    // Written by another version
+    std::vector<char> other_version = data;
+    other_version[4] ^= 0xFF;
+    spirv::AnalysisCache versioned;
+    versioned.Load(other_version);
+    ASSERT_EQ(versioned.Size(), 0u);
+
+    spirv::AnalysisCache empty;
+    empty.Load({});
+    ASSERT_EQ(empty.Size(), 0u);
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/spirv_blob_cache.h"
+
+static const std::vector<char> kTag = {'t', 'a', 'g'};
+static const std::vector<uint32_t> kWords = {0x07230203, 0x00010000, 0x00080001, 100, 0, 0x00020011, 1, 0xFFFFFFFF};
+
+TEST(SpirvBlobCache, Compression) {
+    std::vector<uint8_t> bytes;
+    spirv::BlobCache::Compress(kWords, bytes);
+    ASSERT_LT(bytes.size(), kWords.size() * sizeof(uint32_t));
+
+    std::vector<uint32_t> words;
+    ASSERT_TRUE(spirv::BlobCache::Decompress(bytes, static_cast<uint32_t>(kWords.size()), words));
+    ASSERT_EQ(words, kWords);
+    ASSERT_FALSE(spirv::BlobCache::Decompress(bytes, static_cast<uint32_t>(kWords.size()) + 1, words));
+    bytes.back() |= 0x80;
+    ASSERT_FALSE(spirv::BlobCache::Decompress(bytes, static_cast<uint32_t>(kWords.size()), words));
+}
+
+TEST(SpirvBlobCache, RoundTrip) {
+    spirv::BlobCache cache;
+    cache.Add(1, kWords);
+    cache.Add(2, {0x07230203});
+    const std::vector<char> data = cache.Write(kTag);
+
+    spirv::BlobCache loaded;
+    loaded.Load(data, kTag);
+    ASSERT_EQ(loaded.Size(), 2u);
+    std::vector<uint32_t> words;
+    ASSERT_TRUE(loaded.Get(1, words));
+    ASSERT_EQ(words, kWords);
+    ASSERT_FALSE(loaded.Get(3, words));
+
+    // Different settings
+    spirv::BlobCache other_tag;
+    other_tag.Load(data, {'t', 'a', 'x'});
+    ASSERT_TRUE(other_tag.IsEmpty());
+
+    // Cut in the middle of the second entry, only the first one is kept
+    spirv::BlobCache partial;
+    partial.Load(std::vector<char>(data.begin(), data.end() - 2), kTag);
+    ASSERT_EQ(partial.Size(), 1u);
+}
+
+TEST(SpirvBlobCache, LeastRecentlyUsedDropped) {
+    std::vector<uint8_t> bytes;
+    spirv::BlobCache::Compress(kWords, bytes);
+    // Room for two entries
+    const size_t max_file_size = 4 * sizeof(uint32_t) + kTag.size() + 2 * (4 * sizeof(uint32_t) + bytes.size());
+
+    spirv::BlobCache first_run(max_file_size);
+    first_run.Add(1, kWords);
+    first_run.Add(2, kWords);
+    first_run.Add(3, kWords);
+    std::vector<char> data = first_run.Write(kTag);
+
+    spirv::BlobCache second_run(max_file_size);
+    second_run.Load(data, kTag);
+    ASSERT_EQ(second_run.Size(), 2u);
+    std::vector<uint32_t> words;
+    ASSERT_TRUE(second_run.Get(2, words));
+    second_run.Add(4, kWords);
+    data = second_run.Write(kTag);
+
+    // 2 and 4 were used by the last run
+    spirv::BlobCache third_run(max_file_size);
+    third_run.Load(data, kTag);
+    ASSERT_EQ(third_run.Size(), 2u);
+    ASSERT_TRUE(third_run.Get(2, words));
+    ASSERT_TRUE(third_run.Get(4, words));
+}
+
+TEST(SpirvBlobCache, MergeOnLoad) {
+    spirv::BlobCache process_a;
+    process_a.Add(1, kWords);
+    spirv::BlobCache process_b;
+    process_b.Add(2, kWords);
+
+    process_a.Load(process_b.Write(kTag), kTag);
+    ASSERT_EQ(process_a.Size(), 2u);
+    std::vector<uint32_t> words;
+    ASSERT_TRUE(process_a.Get(2, words));
+    ASSERT_EQ(words, kWords);
+}
+
+TEST(SpirvBlobCache, SaveFileConcurrently) {
+    const std::string path = testing::TempDir() + "vvl_spirv_blob_cache_concurrent_test.bin";
+    std::remove(path.c_str());
+
+    // Saves that overlap must not drop each other's entries
+    constexpr uint32_t kSaverCount = 8;
+    std::vector<spirv::BlobCache> savers(kSaverCount);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < kSaverCount; ++i) {
+        savers[i].Add(i + 1, kWords);
+        threads.emplace_back([&path, &saver = savers[i]]() { saver.SaveFile(path, kTag); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    spirv::BlobCache next_run;
+    ASSERT_TRUE(next_run.LoadFile(path, kTag));
+    ASSERT_EQ(next_run.Size(), kSaverCount);
+    std::remove(path.c_str());
+    std::remove((path + ".lock").c_str());
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/spirv_hash_set.h"
+
+static const std::vector<uint8_t> kPrefix = {'p', 'r', 'e', 'f', 'i', 'x'};
+
+static hash_util::Hash128 MakeHash(uint64_t value) { return hash_util::Hash128{value * 0x9E3779B97F4A7C15ull, value}; }
+
+static std::vector<uint8_t> WriteAll(const spirv::HashSet &set) {
+    std::vector<uint8_t> data(set.WriteSize(kPrefix.size()));
+    data.resize(set.Write(kPrefix, data.data(), data.size()));
+    return data;
+}
+
+TEST(SpirvHashSet, RoundTrip) {
+    spirv::HashSet set;
+    for (uint64_t i = 1; i <= 100; ++i) {
+        set.Insert(MakeHash(i));
+    }
+    const std::vector<uint8_t> data = WriteAll(set);
+    ASSERT_EQ(data.size(), set.WriteSize(kPrefix.size()));
+
+    spirv::HashSet loaded;
+    ASSERT_TRUE(loaded.Load(data.data(), data.size(), kPrefix));
+    ASSERT_EQ(loaded.Size(), 100u);
+    for (uint64_t i = 1; i <= 100; ++i) {
+        ASSERT_TRUE(loaded.Contains(MakeHash(i)));
+    }
+    ASSERT_FALSE(loaded.Contains(MakeHash(101)));
+    ASSERT_FALSE(loaded.Contains(hash_util::Hash128{MakeHash(1).low, 2}));
+
+    // Hashes of a loaded set are inserted once
+    loaded.Insert(MakeHash(1));
+    loaded.Insert(MakeHash(101));
+    ASSERT_EQ(loaded.Size(), 101u);
+    ASSERT_EQ(WriteAll(loaded).size(), loaded.WriteSize(kPrefix.size()));
+
+    // Different settings
+    spirv::HashSet other_prefix;
+    ASSERT_FALSE(other_prefix.Load(data.data(), data.size(), {'p', 'r', 'e', 'f', 'i', 'y'}));
+    ASSERT_EQ(other_prefix.Size(), 0u);
+
+    // Data cut short is ignored
+    spirv::HashSet partial;
+    ASSERT_FALSE(partial.Load(data.data(), data.size() - 1, kPrefix));
+    ASSERT_EQ(partial.Size(), 0u);
+}
+
+TEST(SpirvHashSet, WriteWhatFits) {
+    spirv::HashSet set;
+    for (uint64_t i = 1; i <= 10; ++i) {
+        set.Insert(MakeHash(i));
+    }
+    std::vector<uint8_t> data(set.WriteSize(kPrefix.size()) - 1);
+    data.resize(set.Write(kPrefix, data.data(), data.size()));
+
+    spirv::HashSet loaded;
+    ASSERT_TRUE(loaded.Load(data.data(), data.size(), kPrefix));
+    ASSERT_EQ(loaded.Size(), 9u);
+
+    ASSERT_EQ(set.Write(kPrefix, data.data(), kPrefix.size()), 0u);
+}
+
+TEST(SpirvHashSet, LeastRecentlyUsedDropped) {
+    spirv::HashSet first_run(3);
+    first_run.Insert(MakeHash(1));
+    first_run.Insert(MakeHash(2));
+    first_run.Insert(MakeHash(3));
+    std::vector<uint8_t> data = WriteAll(first_run);
+
+    spirv::HashSet second_run(2);
+    ASSERT_TRUE(second_run.Load(data.data(), data.size(), kPrefix));
+    ASSERT_EQ(second_run.Size(), 3u);
+    ASSERT_TRUE(second_run.Contains(MakeHash(2)));
+    second_run.Insert(MakeHash(4));
+    data = WriteAll(second_run);
+
+    // 2 and 4 were used by the last run
+    spirv::HashSet third_run;
+    ASSERT_TRUE(third_run.Load(data.data(), data.size(), kPrefix));
+    ASSERT_EQ(third_run.Size(), 2u);
+    ASSERT_TRUE(third_run.Contains(MakeHash(2)));
+    ASSERT_TRUE(third_run.Contains(MakeHash(4)));
+}
+
+TEST(SpirvHashSet, Merge) {
+    spirv::HashSet a;
+    a.Insert(MakeHash(1));
+    const std::vector<uint8_t> data = WriteAll(a);
+    spirv::HashSet loaded;
+    ASSERT_TRUE(loaded.Load(data.data(), data.size(), kPrefix));
+
+    spirv::HashSet b;
+    b.Insert(MakeHash(1));
+    b.Insert(MakeHash(2));
+    b.Merge(loaded);
+    ASSERT_EQ(b.Size(), 2u);
+    loaded.Merge(b);
+    ASSERT_EQ(loaded.Size(), 2u);
+    ASSERT_TRUE(loaded.Contains(MakeHash(2)));
+}
+
+TEST(SpirvHashSet, SaveFileMergesOtherProcesses) {
+    const std::string path = testing::TempDir() + "vvl_spirv_hash_set_test.bin";
+    std::remove(path.c_str());
+
+    // Two processes start without a file and exit one after the other
+    spirv::HashSet process_a;
+    spirv::HashSet process_b;
+    ASSERT_FALSE(process_a.LoadFile(path, kPrefix));
+    process_a.Insert(MakeHash(1));
+    process_b.Insert(MakeHash(2));
+    ASSERT_TRUE(process_a.SaveFile(path, kPrefix));
+    ASSERT_TRUE(process_b.SaveFile(path, kPrefix));
+
+    spirv::HashSet next_run;
+    ASSERT_TRUE(next_run.LoadFile(path, kPrefix));
+    ASSERT_EQ(next_run.Size(), 2u);
+    ASSERT_TRUE(next_run.Contains(MakeHash(1)));
+    next_run.Insert(MakeHash(3));
+    // The mapped file is replaced while in use
+    ASSERT_TRUE(next_run.SaveFile(path, kPrefix));
+    ASSERT_TRUE(next_run.Contains(MakeHash(2)));
+    ASSERT_EQ(next_run.Size(), 3u);
+
+    spirv::HashSet last_run;
+    ASSERT_TRUE(last_run.LoadFile(path, kPrefix));
+    ASSERT_EQ(last_run.Size(), 3u);
+    std::remove(path.c_str());
+}
+
+TEST(SpirvHashSet, SaveFileConcurrently) {
+    const std::string path = testing::TempDir() + "vvl_spirv_hash_set_concurrent_test.bin";
+    std::remove(path.c_str());
+
+    // Saves that overlap must not drop each other's entries
+    constexpr uint64_t kSaverCount = 8;
+    std::vector<spirv::HashSet> savers(kSaverCount);
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < kSaverCount; ++i) {
+        savers[i].Insert(MakeHash(i + 1));
+        threads.emplace_back([&path, &saver = savers[i]]() { saver.SaveFile(path, kPrefix); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    spirv::HashSet next_run;
+    ASSERT_TRUE(next_run.LoadFile(path, kPrefix));
+    ASSERT_EQ(next_run.Size(), kSaverCount);
+    for (uint64_t i = 0; i < kSaverCount; ++i) {
+        ASSERT_TRUE(next_run.Contains(MakeHash(i + 1)));
+    }
+    std::remove(path.c_str());
+    std::remove((path + ".lock").c_str());
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <vector>
+
+#include "utils/thread_pool.h"
+
+TEST(ThreadPool, TaskGroupWait) {
+    vvl::ThreadPool pool(4);
+    std::vector<uint32_t> results(256, 0);
+    {
+        vvl::TaskGroup tasks(pool);
+        for (uint32_t i = 0; i < results.size(); ++i) {
+            tasks.Post([&results, i]() { results[i] = i * 2; });
+        }
+        tasks.Wait();
+    }
+    for (uint32_t i = 0; i < results.size(); ++i) {
+        ASSERT_EQ(results[i], i * 2);
+    }
+}
+
+TEST(ThreadPool, DestructorRunsQueuedTasks) {
+    std::atomic<uint32_t> count{0};
+    {
+        vvl::ThreadPool pool(2);
+        for (uint32_t i = 0; i < 100; ++i) {
+            pool.Post([&count]() { ++count; });
+        }
+    }
+    ASSERT_EQ(count.load(), 100u);
+}
+
+TEST(ThreadPool, BlockingScopeAddsWorker) {
+    vvl::ThreadPool pool(1);
+    std::promise<void> dependency;
+    std::promise<void> done;
+    // The only worker waits for a task posted behind it, which needs a second worker to run
+    pool.Post([&]() {
+        pool.Post([&]() { dependency.set_value(); });
+        vvl::ThreadPool::BlockingScope blocking_scope;
+        dependency.get_future().wait();
+        done.set_value();
+    });
+    auto status = done.get_future().wait_for(std::chrono::seconds(10));
+    ASSERT_EQ(status, std::future_status::ready);
+    ASSERT_EQ(pool.ThreadCount(), 2u);
+}
+
+TEST(ThreadPool, WorkersStartOnFirstPost) {
+    // An unused pool is cheap to create and destroy
+    { vvl::ThreadPool unused(8); }
+
+    vvl::ThreadPool pool(2);
+    ASSERT_EQ(pool.ThreadCount(), 2u);
+    std::promise<void> done;
+    pool.Post([&done]() { done.set_value(); });
+    auto status = done.get_future().wait_for(std::chrono::seconds(10));
+    ASSERT_EQ(status, std::future_status::ready);
+    ASSERT_EQ(pool.ThreadCount(), 2u);
+}
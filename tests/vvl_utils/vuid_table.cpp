@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include "error_message/error_location.h"
+
+using vvl::Field;
+using vvl::Func;
+using vvl::Key;
+using vvl::Struct;
+
+TEST(VuidTable, FuzzyKeys) {
+    static const vvl::VuidTable table{
+        {Key(Func::vkCmdPipelineBarrier, Struct::VkMemoryBarrier, Field::srcAccessMask), "function-struct-field"},
+        {Key(Struct::VkBufferMemoryBarrier2, Field::dstStageMask), "struct-field"},
+        {Key(Struct::VkImageMemoryBarrier2), "struct"},
+        {Key(Func::vkCmdCopyImage2), "function"},
+    };
+
+    auto find = [](const Location &loc) { return vvl::FindVUID(loc, table); };
+    ASSERT_EQ(find(Location(Func::vkCmdPipelineBarrier, Struct::VkMemoryBarrier, Field::srcAccessMask)), "function-struct-field");
+    ASSERT_EQ(find(Location(Func::vkCmdPipelineBarrier, Struct::VkMemoryBarrier, Field::dstAccessMask)), "");
+    ASSERT_EQ(find(Location(Func::vkCmdPipelineBarrier2, Struct::VkBufferMemoryBarrier2, Field::dstStageMask)), "struct-field");
+    ASSERT_EQ(find(Location(Func::vkCmdPipelineBarrier2, Struct::VkImageMemoryBarrier2, Field::oldLayout)), "struct");
+    // KHR aliases use the core function
+    ASSERT_EQ(find(Location(Func::vkCmdCopyImage2KHR, Field::pCopyImageInfo)), "function");
+    ASSERT_EQ(find(Location(Func::vkCmdCopyImage, Field::pRegions)), "");
+}